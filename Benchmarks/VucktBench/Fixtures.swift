@@ -0,0 +1,182 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+import Vuckt
+
+
+
+/// A SplitMix64 generator, so every run (on every platform) benchmarks the same inputs, keeping results comparable to a stored baseline.
+struct FixtureGenerator
+{
+	private var state:UInt64
+	
+	init(seed:UInt64) {
+		self.state = seed
+	}
+	
+	mutating func next() -> UInt64 {
+		self.state &+= 0x9E3779B97F4A7C15
+		var z = self.state
+		z = (z ^ (z >> 30)) &* 0xBF58476D1CE4E5B9
+		z = (z ^ (z >> 27)) &* 0x94D049BB133111EB
+		return z ^ (z >> 31)
+	}
+	
+	mutating func float(in range:ClosedRange<Float>) -> Float {
+		let unit = Float(self.next() >> 40) / Float(1 << 24)
+		return range.lowerBound + unit * (range.upperBound - range.lowerBound)
+	}
+	
+	/// Excludes 0, so every value is a valid divisor.
+	mutating func nonzeroFloat() -> Float {
+		let magnitude = self.float(in: 0.5...100)
+		return (self.next() & 1 == 0) ? magnitude : -magnitude
+	}
+	
+	/// Excludes 0, so every value is a valid divisor; small enough that products can't overflow.
+	mutating func nonzeroInt32() -> Int32 {
+		let magnitude = Int32(truncatingIfNeeded: self.next() % 1_000) + 1
+		return (self.next() & 1 == 0) ? magnitude : -magnitude
+	}
+	
+	mutating func float3() -> Float3 { return Float3(self.nonzeroFloat(), self.nonzeroFloat(), self.nonzeroFloat()) }
+	
+	mutating func unitQuaternion() -> FloatQuaternion {
+		let axis = Float3(self.float(in: -1...1), self.float(in: -1...1), self.float(in: 0.1...1)).normalized()
+		return FloatQuaternion(angle: self.float(in: -Float.pi...Float.pi), axis: axis)
+	}
+}
+
+
+/// The inputs every benchmark reads, `count` of each, in both Vuckt & `simd` form (holding the same values).
+/// Buffers live for the life of the process.
+final class Fixtures
+{
+	let count:Int
+	
+	let int2A:UnsafeBufferPointer<Int2>, int2B:UnsafeBufferPointer<Int2>
+	let int3A:UnsafeBufferPointer<Int3>, int3B:UnsafeBufferPointer<Int3>
+	let int4A:UnsafeBufferPointer<Int4>, int4B:UnsafeBufferPointer<Int4>
+	let simdInt2A:UnsafeBufferPointer<simd_int2>, simdInt2B:UnsafeBufferPointer<simd_int2>
+	let simdInt3A:UnsafeBufferPointer<simd_int3>, simdInt3B:UnsafeBufferPointer<simd_int3>
+	let simdInt4A:UnsafeBufferPointer<simd_int4>, simdInt4B:UnsafeBufferPointer<simd_int4>
+	let int32Scalars:UnsafeBufferPointer<Int32>
+	
+	let float2A:UnsafeBufferPointer<Float2>, float2B:UnsafeBufferPointer<Float2>, float2Normals:UnsafeBufferPointer<Float2>
+	let float3A:UnsafeBufferPointer<Float3>, float3B:UnsafeBufferPointer<Float3>, float3Normals:UnsafeBufferPointer<Float3>
+	let float4A:UnsafeBufferPointer<Float4>, float4B:UnsafeBufferPointer<Float4>, float4Normals:UnsafeBufferPointer<Float4>
+	let simdFloat2A:UnsafeBufferPointer<simd_float2>, simdFloat2B:UnsafeBufferPointer<simd_float2>, simdFloat2Normals:UnsafeBufferPointer<simd_float2>
+	let simdFloat3A:UnsafeBufferPointer<simd_float3>, simdFloat3B:UnsafeBufferPointer<simd_float3>, simdFloat3Normals:UnsafeBufferPointer<simd_float3>
+	let simdFloat4A:UnsafeBufferPointer<simd_float4>, simdFloat4B:UnsafeBufferPointer<simd_float4>, simdFloat4Normals:UnsafeBufferPointer<simd_float4>
+	/// `float4A` narrowed to half precision.
+	let half4A:UnsafeBufferPointer<Half4>
+	/// `float3A` widened & moved out to `double3Origin`'s neighborhood (~10,000 km from the origin).
+	let double3A:UnsafeBufferPointer<Double3>
+	static let double3Origin = Double3(1e7, -2e7, 3e7)
+	let floatScalars:UnsafeBufferPointer<Float>
+	/// In [0, 1].
+	let ratios:UnsafeBufferPointer<Float>
+	
+	/// Unit-length.
+	let quaternionA:UnsafeBufferPointer<FloatQuaternion>, quaternionB:UnsafeBufferPointer<FloatQuaternion>
+	let quaternionC:UnsafeBufferPointer<FloatQuaternion>, quaternionD:UnsafeBufferPointer<FloatQuaternion>
+	let simdQuaternionA:UnsafeBufferPointer<simd_quatf>, simdQuaternionB:UnsafeBufferPointer<simd_quatf>
+	let simdQuaternionC:UnsafeBufferPointer<simd_quatf>, simdQuaternionD:UnsafeBufferPointer<simd_quatf>
+	
+	/// Invertible (scale & rotation; plus translation for the 4×4s).
+	let float3x3A:UnsafeBufferPointer<Float3x3>, float3x3B:UnsafeBufferPointer<Float3x3>
+	let float4x4A:UnsafeBufferPointer<Float4x4>, float4x4B:UnsafeBufferPointer<Float4x4>
+	let simdFloat3x3A:UnsafeBufferPointer<simd_float3x3>, simdFloat3x3B:UnsafeBufferPointer<simd_float3x3>
+	let simdFloat4x4A:UnsafeBufferPointer<simd_float4x4>, simdFloat4x4B:UnsafeBufferPointer<simd_float4x4>
+	/// Affine (the upper 3 rows of `float4x4A`/`B`).
+	let float4x3A:UnsafeBufferPointer<Float4x3>, float4x3B:UnsafeBufferPointer<Float4x3>
+	/// A random scene-graph hierarchy: each node's parent precedes it, & node 0 is the root (`-1`).
+	let parentIndices:UnsafeBufferPointer<Int32>
+	
+	init(count:Int, seed:UInt64 = 0x5675636B74) {
+		self.count = count
+		var g = FixtureGenerator(seed: seed)
+		
+		func make<T>(_ element:() -> T) -> UnsafeBufferPointer<T> {
+			let buffer = UnsafeMutableBufferPointer<T>.allocate(capacity: count)
+			for i in 0..<count {
+				(buffer.baseAddress! + i).initialize(to: element())
+			}
+			return UnsafeBufferPointer(buffer)
+		}
+		
+		self.int2A = make{ Int2(g.nonzeroInt32(), g.nonzeroInt32()) }
+		self.int2B = make{ Int2(g.nonzeroInt32(), g.nonzeroInt32()) }
+		self.int3A = make{ Int3(g.nonzeroInt32(), g.nonzeroInt32(), g.nonzeroInt32()) }
+		self.int3B = make{ Int3(g.nonzeroInt32(), g.nonzeroInt32(), g.nonzeroInt32()) }
+		self.int4A = make{ Int4(g.nonzeroInt32(), g.nonzeroInt32(), g.nonzeroInt32(), g.nonzeroInt32()) }
+		self.int4B = make{ Int4(g.nonzeroInt32(), g.nonzeroInt32(), g.nonzeroInt32(), g.nonzeroInt32()) }
+		self.int32Scalars = make{ g.nonzeroInt32() }
+		
+		self.float2A = make{ Float2(g.nonzeroFloat(), g.nonzeroFloat()) }
+		self.float2B = make{ Float2(g.nonzeroFloat(), g.nonzeroFloat()) }
+		self.float2Normals = make{ Float2(g.nonzeroFloat(), g.nonzeroFloat()).normalized() }
+		self.float3A = make{ g.float3() }
+		self.float3B = make{ g.float3() }
+		self.float3Normals = make{ g.float3().normalized() }
+		self.float4A = make{ Float4(g.nonzeroFloat(), g.nonzeroFloat(), g.nonzeroFloat(), g.nonzeroFloat()) }
+		self.float4B = make{ Float4(g.nonzeroFloat(), g.nonzeroFloat(), g.nonzeroFloat(), g.nonzeroFloat()) }
+		self.float4Normals = make{ Float4(g.nonzeroFloat(), g.nonzeroFloat(), g.nonzeroFloat(), g.nonzeroFloat()).normalized() }
+		self.floatScalars = make{ g.nonzeroFloat() }
+		self.ratios = make{ g.float(in: 0...1) }
+		
+		self.quaternionA = make{ g.unitQuaternion() }
+		self.quaternionB = make{ g.unitQuaternion() }
+		self.quaternionC = make{ g.unitQuaternion() }
+		self.quaternionD = make{ g.unitQuaternion() }
+		
+		self.float3x3A = make{ Float3x3(scale: g.float3(), rotation: g.unitQuaternion()) }
+		self.float3x3B = make{ Float3x3(scale: g.float3(), rotation: g.unitQuaternion()) }
+		self.float4x4A = make{ Float4x4(scale: g.float3(), rotation: g.unitQuaternion(), translation: g.float3()) }
+		self.float4x4B = make{ Float4x4(scale: g.float3(), rotation: g.unitQuaternion(), translation: g.float3()) }
+		var nodeIndex:UInt64 = 0
+		self.parentIndices = make{
+			defer { nodeIndex += 1 }
+			return (nodeIndex == 0) ? -1 : Int32(truncatingIfNeeded: g.next() % nodeIndex)
+		}
+		
+		func convert<T, S>(_ buffer:UnsafeBufferPointer<T>, _ conversion:(T) -> S) -> UnsafeBufferPointer<S> {
+			var i = 0
+			return make{ defer { i += 1 }; return conversion(buffer[i]) }
+		}
+		self.simdInt2A = convert(self.int2A){ $0.simdValue }
+		self.simdInt2B = convert(self.int2B){ $0.simdValue }
+		self.simdInt3A = convert(self.int3A){ $0.simdValue }
+		self.simdInt3B = convert(self.int3B){ $0.simdValue }
+		self.simdInt4A = convert(self.int4A){ $0.simdValue }
+		self.simdInt4B = convert(self.int4B){ $0.simdValue }
+		self.simdFloat2A = convert(self.float2A){ $0.simdValue }
+		self.simdFloat2B = convert(self.float2B){ $0.simdValue }
+		self.simdFloat2Normals = convert(self.float2Normals){ $0.simdValue }
+		self.simdFloat3A = convert(self.float3A){ $0.simdValue }
+		self.simdFloat3B = convert(self.float3B){ $0.simdValue }
+		self.simdFloat3Normals = convert(self.float3Normals){ $0.simdValue }
+		self.simdFloat4A = convert(self.float4A){ $0.simdValue }
+		self.simdFloat4B = convert(self.float4B){ $0.simdValue }
+		self.simdFloat4Normals = convert(self.float4Normals){ $0.simdValue }
+		self.simdQuaternionA = convert(self.quaternionA){ $0.simdValue }
+		self.simdQuaternionB = convert(self.quaternionB){ $0.simdValue }
+		self.simdQuaternionC = convert(self.quaternionC){ $0.simdValue }
+		self.simdQuaternionD = convert(self.quaternionD){ $0.simdValue }
+		self.simdFloat3x3A = convert(self.float3x3A){ $0.simdValue }
+		self.simdFloat3x3B = convert(self.float3x3B){ $0.simdValue }
+		self.simdFloat4x4A = convert(self.float4x4A){ $0.simdValue }
+		self.simdFloat4x4B = convert(self.float4x4B){ $0.simdValue }
+		self.half4A = convert(self.float4A){ Half4($0) }
+		self.double3A = convert(self.float3A){ Double3($0) + Fixtures.double3Origin }
+		self.float4x3A = convert(self.float4x4A){ Float4x3($0) }
+		self.float4x3B = convert(self.float4x4B){ Float4x3($0) }
+	}
+}
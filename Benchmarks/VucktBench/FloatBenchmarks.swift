@@ -0,0 +1,176 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+import Vuckt
+
+
+
+extension BenchmarkSuite
+{
+	mutating func addFloat2Benchmarks() {
+		let f = self.fixtures, n = f.count
+		let (a, b, normals, s, t) = (f.float2A, f.float2B, f.float2Normals, f.floatScalars, f.ratios)
+		let (sa, sb, sNormals) = (f.simdFloat2A, f.simdFloat2B, f.simdFloat2Normals)
+		let (lo, hi) = (Float2(-10, -10), Float2(10, 10))
+		
+		self.add("Float2.add", vuckt: { p in map(p, a, b){ $0 + $1 } }, simd: { p in map(p, sa, sb){ $0 + $1 } })
+		self.add("Float2.subtract", vuckt: { p in map(p, a, b){ $0 - $1 } }, simd: { p in map(p, sa, sb){ $0 - $1 } })
+		self.add("Float2.multiply", vuckt: { p in map(p, a, b){ $0 * $1 } }, simd: { p in map(p, sa, sb){ $0 * $1 } })
+		self.add("Float2.divide", vuckt: { p in map(p, a, b){ $0 / $1 } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Float2.remainder", vuckt: { p in map(p, a, b){ $0 % $1 } })
+		self.add("Float2.multiplyByScalar", vuckt: { p in map(p, a, s){ $0 * $1 } }, simd: { p in map(p, sa, s){ $0 * $1 } })
+		self.add("Float2.divideByScalar", vuckt: { p in map(p, a, s){ $0 / $1 } }, simd: { p in map(p, sa, s){ $0 / $1 } })
+		self.add("Float2.remainderByScalar", vuckt: { p in map(p, a, s){ $0 % $1 } })
+		self.add("Float2.negate", vuckt: { p in map(p, a){ -$0 } }, simd: { p in map(p, sa){ -$0 } })
+		self.add("Float2.equal", vuckt: { p in map(p, a, b){ $0 == $1 } }, simd: { p in map(p, sa, sb){ $0 == $1 } })
+		self.add("Float2.lessThan", vuckt: { p in map(p, a, b){ $0 < $1 } }, simd: { p in map(p, sa, sb){ all($0 .< $1) } })
+		self.add("Float2.lessThanOrEqual", vuckt: { p in map(p, a, b){ $0 <= $1 } }, simd: { p in map(p, sa, sb){ all($0 .<= $1) } })
+		self.add("Float2.min", vuckt: { p in map(p, a, b){ min($0, $1) } }, simd: { p in map(p, sa, sb){ simd_min($0, $1) } })
+		self.add("Float2.max", vuckt: { p in map(p, a, b){ max($0, $1) } }, simd: { p in map(p, sa, sb){ simd_max($0, $1) } })
+		self.add("Float2.clamped", vuckt: { p in map(p, a){ $0.clamped(to: lo...hi) } }, simd: { p in map(p, sa){ simd_clamp($0, lo.simdValue, hi.simdValue) } })
+		self.add("Float2.reciprocal", vuckt: { p in map(p, a){ $0.reciprocal() } }, simd: { p in map(p, sa){ simd_recip($0) } })
+		self.add("Float2.normalized", vuckt: { p in map(p, a){ $0.normalized() } }, simd: { p in map(p, sa){ simd_normalize($0) } })
+		self.add("Float2.length", vuckt: { p in map(p, a){ $0.length() } }, simd: { p in map(p, sa){ simd_length($0) } })
+		self.add("Float2.lengthSquared", vuckt: { p in map(p, a){ $0.lengthSquared() } }, simd: { p in map(p, sa){ simd_length_squared($0) } })
+		self.add("Float2.lOneNorm", vuckt: { p in map(p, a){ $0.lOneNorm() } }, simd: { p in map(p, sa){ simd_norm_one($0) } })
+		self.add("Float2.lInfinityNorm", vuckt: { p in map(p, a){ $0.lInfinityNorm() } }, simd: { p in map(p, sa){ simd_norm_inf($0) } })
+		self.add("Float2.dotProduct", vuckt: { p in map(p, a, b){ $0.dotProduct($1) } }, simd: { p in map(p, sa, sb){ simd_dot($0, $1) } })
+		self.add("Float2.crossProduct", vuckt: { p in map(p, a, b){ $0.crossProduct($1) } }, simd: { p in map(p, sa, sb){ simd_float3(0, 0, $0.x * $1.y - $0.y * $1.x) } })
+		self.add("Float2.distance", vuckt: { p in map(p, a, b){ distanceBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_distance($0, $1) } })
+		self.add("Float2.distanceSquared", vuckt: { p in map(p, a, b){ distanceSquaredBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_distance_squared($0, $1) } })
+		self.add("Float2.taxicabDistance", vuckt: { p in map(p, a, b){ taxicabDistanceBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_norm_one($1 - $0) } })
+		self.add("Float2.projected", vuckt: { p in map(p, a, b){ $0.projected(onto: $1) } }, simd: { p in map(p, sa, sb){ simd_project($0, $1) } })
+		self.add("Float2.reflected", vuckt: { p in map(p, a, normals){ $0.reflected(across: $1) } }, simd: { p in map(p, sa, sNormals){ simd_reflect($0, $1) } })
+		self.add("Float2.refracted", vuckt: { p in map(p, normals, normals){ (-$0).refracted(through: $1, index: 0.75) } }, simd: { p in map(p, sNormals, sNormals){ simd_refract(-$0, $1, 0.75) } })
+		self.add("Float2.interpolated.linear", vuckt: { p in map(p, a, b, t){ interpolateBetween($0, $1, ratio: $2, method: .linear) } }, simd: { p in map(p, sa, sb, t){ simd_mix($0, $1, simd_float2(repeating: $2)) } })
+		self.add("Float2.interpolated.hermite", vuckt: { p in map(p, a, b, t){ interpolateBetween($0, $1, ratio: $2, method: .hermite) } }, simd: { p in map(p, sa, sb, t){ simd_smoothstep($0, $1, simd_float2(repeating: $2)) } })
+		self.add("Float2.mixed", vuckt: { p in map(p, a, b, t){ $0.mixed(with: $1, ratio: $2) } }, simd: { p in map(p, sa, sb, t){ simd_mix($0, $1, simd_float2(repeating: $2)) } })
+		self.add("Float2.bulk.add", vuckt: { p in batch(p, count: n, of: Float2.self){ a.add(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 + $1 } })
+		self.add("Float2.bulk.subtract", vuckt: { p in batch(p, count: n, of: Float2.self){ a.subtract(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 - $1 } })
+		self.add("Float2.bulk.multiply", vuckt: { p in batch(p, count: n, of: Float2.self){ a.multiply(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 * $1 } })
+		self.add("Float2.bulk.divide", vuckt: { p in batch(p, count: n, of: Float2.self){ a.divide(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Float2.bulk.remainder", vuckt: { p in batch(p, count: n, of: Float2.self){ a.remainder(dividingBy: b, into: $0) } })
+		self.add("Float2.bulk.negate", vuckt: { p in batch(p, count: n, of: Float2.self){ a.negate(into: $0) } }, simd: { p in map(p, sa){ -$0 } })
+		self.add("Float2.bulk.multiplyByScalar", vuckt: { p in batch(p, count: n, of: Float2.self){ a.multiply(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 * 3 } })
+		self.add("Float2.bulk.divideByScalar", vuckt: { p in batch(p, count: n, of: Float2.self){ a.divide(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 / 3 } })
+		self.add("Float2.bulk.remainderByScalar", vuckt: { p in batch(p, count: n, of: Float2.self){ a.remainder(dividingBy: 3, into: $0) } })
+	}
+	
+	
+	mutating func addFloat3Benchmarks() {
+		let f = self.fixtures, n = f.count
+		let (a, b, normals, s, t) = (f.float3A, f.float3B, f.float3Normals, f.floatScalars, f.ratios)
+		let (sa, sb, sNormals) = (f.simdFloat3A, f.simdFloat3B, f.simdFloat3Normals)
+		let (lo, hi) = (Float3(-10, -10, -10), Float3(10, 10, 10))
+		
+		self.add("Float3.add", vuckt: { p in map(p, a, b){ $0 + $1 } }, simd: { p in map(p, sa, sb){ $0 + $1 } })
+		self.add("Float3.subtract", vuckt: { p in map(p, a, b){ $0 - $1 } }, simd: { p in map(p, sa, sb){ $0 - $1 } })
+		self.add("Float3.multiply", vuckt: { p in map(p, a, b){ $0 * $1 } }, simd: { p in map(p, sa, sb){ $0 * $1 } })
+		self.add("Float3.divide", vuckt: { p in map(p, a, b){ $0 / $1 } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Float3.remainder", vuckt: { p in map(p, a, b){ $0 % $1 } })
+		self.add("Float3.multiplyByScalar", vuckt: { p in map(p, a, s){ $0 * $1 } }, simd: { p in map(p, sa, s){ $0 * $1 } })
+		self.add("Float3.divideByScalar", vuckt: { p in map(p, a, s){ $0 / $1 } }, simd: { p in map(p, sa, s){ $0 / $1 } })
+		self.add("Float3.remainderByScalar", vuckt: { p in map(p, a, s){ $0 % $1 } })
+		self.add("Float3.negate", vuckt: { p in map(p, a){ -$0 } }, simd: { p in map(p, sa){ -$0 } })
+		self.add("Float3.equal", vuckt: { p in map(p, a, b){ $0 == $1 } }, simd: { p in map(p, sa, sb){ $0 == $1 } })
+		self.add("Float3.lessThan", vuckt: { p in map(p, a, b){ $0 < $1 } }, simd: { p in map(p, sa, sb){ all($0 .< $1) } })
+		self.add("Float3.lessThanOrEqual", vuckt: { p in map(p, a, b){ $0 <= $1 } }, simd: { p in map(p, sa, sb){ all($0 .<= $1) } })
+		self.add("Float3.min", vuckt: { p in map(p, a, b){ min($0, $1) } }, simd: { p in map(p, sa, sb){ simd_min($0, $1) } })
+		self.add("Float3.max", vuckt: { p in map(p, a, b){ max($0, $1) } }, simd: { p in map(p, sa, sb){ simd_max($0, $1) } })
+		self.add("Float3.clamped", vuckt: { p in map(p, a){ $0.clamped(to: lo...hi) } }, simd: { p in map(p, sa){ simd_clamp($0, lo.simdValue, hi.simdValue) } })
+		self.add("Float3.reciprocal", vuckt: { p in map(p, a){ $0.reciprocal() } }, simd: { p in map(p, sa){ simd_recip($0) } })
+		self.add("Float3.normalized", vuckt: { p in map(p, a){ $0.normalized() } }, simd: { p in map(p, sa){ simd_normalize($0) } })
+		self.add("Float3.reciprocal.fast", vuckt: { p in map(p, a){ $0.reciprocal(precision: .fast) } }, simd: { p in map(p, sa){ simd_recip($0) } })
+		self.add("Float3.normalized.fast", vuckt: { p in map(p, a){ $0.normalized(precision: .fast) } }, simd: { p in map(p, sa){ simd_normalize($0) } })
+		self.add("Float3.length", vuckt: { p in map(p, a){ $0.length() } }, simd: { p in map(p, sa){ simd_length($0) } })
+		self.add("Float3.length.fast", vuckt: { p in map(p, a){ $0.length(precision: .fast) } }, simd: { p in map(p, sa){ simd_length($0) } })
+		self.add("Float3.lengthSquared", vuckt: { p in map(p, a){ $0.lengthSquared() } }, simd: { p in map(p, sa){ simd_length_squared($0) } })
+		self.add("Float3.lOneNorm", vuckt: { p in map(p, a){ $0.lOneNorm() } }, simd: { p in map(p, sa){ simd_norm_one($0) } })
+		self.add("Float3.lInfinityNorm", vuckt: { p in map(p, a){ $0.lInfinityNorm() } }, simd: { p in map(p, sa){ simd_norm_inf($0) } })
+		self.add("Float3.dotProduct", vuckt: { p in map(p, a, b){ $0.dotProduct($1) } }, simd: { p in map(p, sa, sb){ simd_dot($0, $1) } })
+		self.add("Float3.crossProduct", vuckt: { p in map(p, a, b){ $0.crossProduct($1) } }, simd: { p in map(p, sa, sb){ simd_cross($0, $1) } })
+		self.add("Float3.distance", vuckt: { p in map(p, a, b){ distanceBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_distance($0, $1) } })
+		self.add("Float3.distanceSquared", vuckt: { p in map(p, a, b){ distanceSquaredBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_distance_squared($0, $1) } })
+		self.add("Float3.taxicabDistance", vuckt: { p in map(p, a, b){ taxicabDistanceBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_norm_one($1 - $0) } })
+		self.add("Float3.projected", vuckt: { p in map(p, a, b){ $0.projected(onto: $1) } }, simd: { p in map(p, sa, sb){ simd_project($0, $1) } })
+		self.add("Float3.reflected", vuckt: { p in map(p, a, normals){ $0.reflected(across: $1) } }, simd: { p in map(p, sa, sNormals){ simd_reflect($0, $1) } })
+		self.add("Float3.refracted", vuckt: { p in map(p, normals, normals){ (-$0).refracted(through: $1, index: 0.75) } }, simd: { p in map(p, sNormals, sNormals){ simd_refract(-$0, $1, 0.75) } })
+		self.add("Float3.interpolated.linear", vuckt: { p in map(p, a, b, t){ interpolateBetween($0, $1, ratio: $2, method: .linear) } }, simd: { p in map(p, sa, sb, t){ simd_mix($0, $1, simd_float3(repeating: $2)) } })
+		self.add("Float3.interpolated.hermite", vuckt: { p in map(p, a, b, t){ interpolateBetween($0, $1, ratio: $2, method: .hermite) } }, simd: { p in map(p, sa, sb, t){ simd_smoothstep($0, $1, simd_float3(repeating: $2)) } })
+		self.add("Float3.mixed", vuckt: { p in map(p, a, b, t){ $0.mixed(with: $1, ratio: $2) } }, simd: { p in map(p, sa, sb, t){ simd_mix($0, $1, simd_float3(repeating: $2)) } })
+		self.add("Float3.rotated", vuckt: { p in map(p, a, f.quaternionA){ $0.rotated(by: $1) } }, simd: { p in map(p, sa, f.simdQuaternionA){ simd_act($1, $0) } })
+		self.add("Float3.unrotated", vuckt: { p in map(p, a, f.quaternionA){ $0.unrotated(by: $1) } }, simd: { p in map(p, sa, f.simdQuaternionA){ simd_act(simd_inverse($1), $0) } })
+		self.add("Float3.bulk.add", vuckt: { p in batch(p, count: n, of: Float3.self){ a.add(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 + $1 } })
+		self.add("Float3.bulk.subtract", vuckt: { p in batch(p, count: n, of: Float3.self){ a.subtract(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 - $1 } })
+		self.add("Float3.bulk.multiply", vuckt: { p in batch(p, count: n, of: Float3.self){ a.multiply(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 * $1 } })
+		self.add("Float3.bulk.divide", vuckt: { p in batch(p, count: n, of: Float3.self){ a.divide(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Float3.bulk.remainder", vuckt: { p in batch(p, count: n, of: Float3.self){ a.remainder(dividingBy: b, into: $0) } })
+		self.add("Float3.bulk.negate", vuckt: { p in batch(p, count: n, of: Float3.self){ a.negate(into: $0) } }, simd: { p in map(p, sa){ -$0 } })
+		self.add("Float3.bulk.multiplyByScalar", vuckt: { p in batch(p, count: n, of: Float3.self){ a.multiply(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 * 3 } })
+		self.add("Float3.bulk.divideByScalar", vuckt: { p in batch(p, count: n, of: Float3.self){ a.divide(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 / 3 } })
+		self.add("Float3.bulk.remainderByScalar", vuckt: { p in batch(p, count: n, of: Float3.self){ a.remainder(dividingBy: 3, into: $0) } })
+		self.add("Double3.bulk.narrow", vuckt: { p in batch(p, count: n, of: Float3.self){ f.double3A.narrow(into: $0) } })
+		self.add("Double3.bulk.rebase", vuckt: { p in batch(p, count: n, of: Float3.self){ f.double3A.rebase(origin: Fixtures.double3Origin, into: $0) } })
+	}
+	
+	
+	mutating func addFloat4Benchmarks() {
+		let f = self.fixtures, n = f.count
+		let (a, b, normals, s, t) = (f.float4A, f.float4B, f.float4Normals, f.floatScalars, f.ratios)
+		let (sa, sb, sNormals) = (f.simdFloat4A, f.simdFloat4B, f.simdFloat4Normals)
+		let (lo, hi) = (Float4(-10, -10, -10, -10), Float4(10, 10, 10, 10))
+		
+		self.add("Float4.add", vuckt: { p in map(p, a, b){ $0 + $1 } }, simd: { p in map(p, sa, sb){ $0 + $1 } })
+		self.add("Float4.subtract", vuckt: { p in map(p, a, b){ $0 - $1 } }, simd: { p in map(p, sa, sb){ $0 - $1 } })
+		self.add("Float4.multiply", vuckt: { p in map(p, a, b){ $0 * $1 } }, simd: { p in map(p, sa, sb){ $0 * $1 } })
+		self.add("Float4.divide", vuckt: { p in map(p, a, b){ $0 / $1 } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Float4.remainder", vuckt: { p in map(p, a, b){ $0 % $1 } })
+		self.add("Float4.multiplyByScalar", vuckt: { p in map(p, a, s){ $0 * $1 } }, simd: { p in map(p, sa, s){ $0 * $1 } })
+		self.add("Float4.divideByScalar", vuckt: { p in map(p, a, s){ $0 / $1 } }, simd: { p in map(p, sa, s){ $0 / $1 } })
+		self.add("Float4.remainderByScalar", vuckt: { p in map(p, a, s){ $0 % $1 } })
+		self.add("Float4.negate", vuckt: { p in map(p, a){ -$0 } }, simd: { p in map(p, sa){ -$0 } })
+		self.add("Float4.equal", vuckt: { p in map(p, a, b){ $0 == $1 } }, simd: { p in map(p, sa, sb){ $0 == $1 } })
+		self.add("Float4.lessThan", vuckt: { p in map(p, a, b){ $0 < $1 } }, simd: { p in map(p, sa, sb){ all($0 .< $1) } })
+		self.add("Float4.lessThanOrEqual", vuckt: { p in map(p, a, b){ $0 <= $1 } }, simd: { p in map(p, sa, sb){ all($0 .<= $1) } })
+		self.add("Float4.min", vuckt: { p in map(p, a, b){ min($0, $1) } }, simd: { p in map(p, sa, sb){ simd_min($0, $1) } })
+		self.add("Float4.max", vuckt: { p in map(p, a, b){ max($0, $1) } }, simd: { p in map(p, sa, sb){ simd_max($0, $1) } })
+		self.add("Float4.clamped", vuckt: { p in map(p, a){ $0.clamped(to: lo...hi) } }, simd: { p in map(p, sa){ simd_clamp($0, lo.simdValue, hi.simdValue) } })
+		self.add("Float4.reciprocal", vuckt: { p in map(p, a){ $0.reciprocal() } }, simd: { p in map(p, sa){ simd_recip($0) } })
+		self.add("Float4.normalized", vuckt: { p in map(p, a){ $0.normalized() } }, simd: { p in map(p, sa){ simd_normalize($0) } })
+		self.add("Float4.reciprocal.fast", vuckt: { p in map(p, a){ $0.reciprocal(precision: .fast) } }, simd: { p in map(p, sa){ simd_recip($0) } })
+		self.add("Float4.normalized.fast", vuckt: { p in map(p, a){ $0.normalized(precision: .fast) } }, simd: { p in map(p, sa){ simd_normalize($0) } })
+		self.add("Float4.length", vuckt: { p in map(p, a){ $0.length() } }, simd: { p in map(p, sa){ simd_length($0) } })
+		self.add("Float4.length.fast", vuckt: { p in map(p, a){ $0.length(precision: .fast) } }, simd: { p in map(p, sa){ simd_length($0) } })
+		self.add("Float4.lengthSquared", vuckt: { p in map(p, a){ $0.lengthSquared() } }, simd: { p in map(p, sa){ simd_length_squared($0) } })
+		self.add("Float4.lOneNorm", vuckt: { p in map(p, a){ $0.lOneNorm() } }, simd: { p in map(p, sa){ simd_norm_one($0) } })
+		self.add("Float4.lInfinityNorm", vuckt: { p in map(p, a){ $0.lInfinityNorm() } }, simd: { p in map(p, sa){ simd_norm_inf($0) } })
+		self.add("Float4.dotProduct", vuckt: { p in map(p, a, b){ $0.dotProduct($1) } }, simd: { p in map(p, sa, sb){ simd_dot($0, $1) } })
+		self.add("Float4.distance", vuckt: { p in map(p, a, b){ distanceBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_distance($0, $1) } })
+		self.add("Float4.distanceSquared", vuckt: { p in map(p, a, b){ distanceSquaredBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_distance_squared($0, $1) } })
+		self.add("Float4.taxicabDistance", vuckt: { p in map(p, a, b){ taxicabDistanceBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_norm_one($1 - $0) } })
+		self.add("Float4.projected", vuckt: { p in map(p, a, b){ $0.projected(onto: $1) } }, simd: { p in map(p, sa, sb){ simd_project($0, $1) } })
+		self.add("Float4.reflected", vuckt: { p in map(p, a, normals){ $0.reflected(across: $1) } }, simd: { p in map(p, sa, sNormals){ simd_reflect($0, $1) } })
+		self.add("Float4.refracted", vuckt: { p in map(p, normals, normals){ (-$0).refracted(through: $1, index: 0.75) } }, simd: { p in map(p, sNormals, sNormals){ simd_refract(-$0, $1, 0.75) } })
+		self.add("Float4.interpolated.linear", vuckt: { p in map(p, a, b, t){ interpolateBetween($0, $1, ratio: $2, method: .linear) } }, simd: { p in map(p, sa, sb, t){ simd_mix($0, $1, simd_float4(repeating: $2)) } })
+		self.add("Float4.interpolated.hermite", vuckt: { p in map(p, a, b, t){ interpolateBetween($0, $1, ratio: $2, method: .hermite) } }, simd: { p in map(p, sa, sb, t){ simd_smoothstep($0, $1, simd_float4(repeating: $2)) } })
+		self.add("Float4.mixed", vuckt: { p in map(p, a, b, t){ $0.mixed(with: $1, ratio: $2) } }, simd: { p in map(p, sa, sb, t){ simd_mix($0, $1, simd_float4(repeating: $2)) } })
+		self.add("Float4.bulk.add", vuckt: { p in batch(p, count: n, of: Float4.self){ a.add(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 + $1 } })
+		self.add("Float4.bulk.subtract", vuckt: { p in batch(p, count: n, of: Float4.self){ a.subtract(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 - $1 } })
+		self.add("Float4.bulk.multiply", vuckt: { p in batch(p, count: n, of: Float4.self){ a.multiply(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 * $1 } })
+		self.add("Float4.bulk.divide", vuckt: { p in batch(p, count: n, of: Float4.self){ a.divide(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Float4.bulk.remainder", vuckt: { p in batch(p, count: n, of: Float4.self){ a.remainder(dividingBy: b, into: $0) } })
+		self.add("Float4.bulk.negate", vuckt: { p in batch(p, count: n, of: Float4.self){ a.negate(into: $0) } }, simd: { p in map(p, sa){ -$0 } })
+		self.add("Float4.bulk.multiplyByScalar", vuckt: { p in batch(p, count: n, of: Float4.self){ a.multiply(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 * 3 } })
+		self.add("Float4.bulk.divideByScalar", vuckt: { p in batch(p, count: n, of: Float4.self){ a.divide(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 / 3 } })
+		self.add("Float4.bulk.remainderByScalar", vuckt: { p in batch(p, count: n, of: Float4.self){ a.remainder(dividingBy: 3, into: $0) } })
+		self.add("Float4.bulk.narrow.half4", vuckt: { p in batch(p, count: n, of: Half4.self){ a.narrow(into: $0) } })
+		self.add("Float4.bulk.narrow.half4.towardZero", vuckt: { p in batch(p, count: n, of: Half4.self){ a.narrow(into: $0, rounding: .towardZero) } })
+		self.add("Half4.bulk.widen", vuckt: { p in batch(p, count: n, of: Float4.self){ f.half4A.widen(into: $0) } }, simd: { p in map(p, sa){ $0 } })
+	}
+}
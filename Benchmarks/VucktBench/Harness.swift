@@ -0,0 +1,147 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+
+
+
+/// Which implementation a benchmark exercises: Vuckt's, or the plain `SIMD…`/`simd_*` equivalent it's measured against.
+enum Implementation : String, Codable
+{
+	case vuckt
+	case simd
+}
+
+
+struct Benchmark
+{
+	/// `Type.operation`, e.g. `Float3.crossProduct`.
+	var name:String
+	var implementation:Implementation
+	/// The number of operations performed per pass of `run`.
+	var operationCount:Int
+	/// Runs `passes` passes over the benchmark's fixtures.
+	var run:(_ passes:Int) -> Void
+	
+	var identifier:String { return "\(self.name)/\(self.implementation.rawValue)" }
+}
+
+
+struct BenchmarkSuite
+{
+	let fixtures:Fixtures
+	private(set) var benchmarks:[Benchmark] = []
+	
+	init(fixtures:Fixtures) {
+		self.fixtures = fixtures
+	}
+	
+	/// Registers a Vuckt benchmark, & (if given) its `simd` baseline, both performing `fixtures.count` operations per pass.
+	mutating func add(_ name:String, vuckt:@escaping (_ passes:Int) -> Void, simd:((_ passes:Int) -> Void)? = nil) {
+		self.benchmarks.append(Benchmark(name: name, implementation: .vuckt, operationCount: self.fixtures.count, run: vuckt))
+		if let simd = simd {
+			self.benchmarks.append(Benchmark(name: name, implementation: .simd, operationCount: self.fixtures.count, run: simd))
+		}
+	}
+}
+
+
+
+// MARK: Kernels
+//
+// Each kernel writes every result to an output buffer & hands that buffer to `blackHole()` after each pass, so the optimizer can neither hoist nor discard the work, while the per-operation loop stays free of calls.
+// They're `@inline(__always)` so the operation closure (a literal at each call site) gets inlined into the loop.
+
+var _blackHoleSink:UInt8 = 0
+
+/// Makes the bytes at `pointer` observable, so the stores that produced them can't be eliminated.
+@inline(never) func blackHole<T>(_ pointer:UnsafeMutablePointer<T>) {
+	_blackHoleSink &+= UnsafeRawPointer(pointer).load(as: UInt8.self)
+}
+
+@inline(__always) func map<A, R>(_ passes:Int, _ a:UnsafeBufferPointer<A>, _ operation:(A) -> R) {
+	let out = UnsafeMutablePointer<R>.allocate(capacity: a.count)
+	defer { out.deallocate() }
+	for _ in 0..<passes {
+		for i in 0..<a.count {
+			(out + i).initialize(to: operation(a[i]))
+		}
+		blackHole(out)
+	}
+}
+
+@inline(__always) func map<A, B, R>(_ passes:Int, _ a:UnsafeBufferPointer<A>, _ b:UnsafeBufferPointer<B>, _ operation:(A, B) -> R) {
+	let out = UnsafeMutablePointer<R>.allocate(capacity: a.count)
+	defer { out.deallocate() }
+	for _ in 0..<passes {
+		for i in 0..<a.count {
+			(out + i).initialize(to: operation(a[i], b[i]))
+		}
+		blackHole(out)
+	}
+}
+
+@inline(__always) func map<A, B, C, R>(_ passes:Int, _ a:UnsafeBufferPointer<A>, _ b:UnsafeBufferPointer<B>, _ c:UnsafeBufferPointer<C>, _ operation:(A, B, C) -> R) {
+	let out = UnsafeMutablePointer<R>.allocate(capacity: a.count)
+	defer { out.deallocate() }
+	for _ in 0..<passes {
+		for i in 0..<a.count {
+			(out + i).initialize(to: operation(a[i], b[i], c[i]))
+		}
+		blackHole(out)
+	}
+}
+
+/// For the bulk (`…(into:)`) APIs, which process a whole buffer per call.
+@inline(__always) func batch<R>(_ passes:Int, count:Int, of _:R.Type, _ operation:(UnsafeMutableBufferPointer<R>) -> Void) {
+	let out = UnsafeMutableBufferPointer<R>.allocate(capacity: count)
+	defer { out.deallocate() }
+	for _ in 0..<passes {
+		operation(out)
+		blackHole(out.baseAddress!)
+	}
+}
+
+
+
+// MARK: Measurement
+
+struct MeasurementOptions
+{
+	var sampleCount = 15
+	var minimumSampleTime_ns:UInt64 = 10_000_000
+}
+
+@inline(__always) func now_ns() -> UInt64 {
+	return DispatchTime.now().uptimeNanoseconds
+}
+
+/// Warms `benchmark` up, grows its pass count until one sample takes at least `options.minimumSampleTime_ns`, then times `options.sampleCount` samples.
+func measure(_ benchmark:Benchmark, options:MeasurementOptions) -> BenchmarkResult {
+	benchmark.run(1)
+	
+	var passes = 1
+	while true {
+		let start = now_ns()
+		benchmark.run(passes)
+		let elapsed = now_ns() - start
+		if elapsed >= options.minimumSampleTime_ns || passes >= (1 << 24) {
+			break
+		}
+		let scale = Double(options.minimumSampleTime_ns) / Double(max(elapsed, 1))
+		passes = Int(Double(passes) * min(max(scale * 1.1, 2), 1_000))
+	}
+	
+	let operationsPerSample = passes * benchmark.operationCount
+	var samples_nsPerOp:[Double] = []
+	samples_nsPerOp.reserveCapacity(options.sampleCount)
+	for _ in 0..<options.sampleCount {
+		let start = now_ns()
+		benchmark.run(passes)
+		let elapsed = now_ns() - start
+		samples_nsPerOp.append(Double(elapsed) / Double(operationsPerSample))
+	}
+	
+	return BenchmarkResult(benchmark: benchmark, samples_nsPerOp: samples_nsPerOp, operationsPerSample: operationsPerSample)
+}
@@ -0,0 +1,159 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+import Vuckt
+
+
+
+extension BenchmarkSuite
+{
+	mutating func addInt2Benchmarks() {
+		let f = self.fixtures, n = f.count
+		let (a, b, s) = (f.int2A, f.int2B, f.int32Scalars)
+		let (sa, sb) = (f.simdInt2A, f.simdInt2B)
+		let (lo, hi) = (Int2(-100, -100), Int2(100, 100))
+		
+		self.add("Int2.add", vuckt: { p in map(p, a, b){ $0 + $1 } }, simd: { p in map(p, sa, sb){ $0 &+ $1 } })
+		self.add("Int2.subtract", vuckt: { p in map(p, a, b){ $0 - $1 } }, simd: { p in map(p, sa, sb){ $0 &- $1 } })
+		self.add("Int2.multiply", vuckt: { p in map(p, a, b){ $0 * $1 } }, simd: { p in map(p, sa, sb){ $0 &* $1 } })
+		self.add("Int2.divide", vuckt: { p in map(p, a, b){ $0 / $1 } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Int2.remainder", vuckt: { p in map(p, a, b){ $0 % $1 } }, simd: { p in map(p, sa, sb){ $0 % $1 } })
+		self.add("Int2.multiplyByScalar", vuckt: { p in map(p, a, s){ $0 * $1 } }, simd: { p in map(p, sa, s){ $0 &* $1 } })
+		self.add("Int2.divideByScalar", vuckt: { p in map(p, a, s){ $0 / $1 } }, simd: { p in map(p, sa, s){ $0 / $1 } })
+		self.add("Int2.remainderByScalar", vuckt: { p in map(p, a, s){ $0 % $1 } }, simd: { p in map(p, sa, s){ $0 % $1 } })
+		self.add("Int2.negate", vuckt: { p in map(p, a){ -$0 } }, simd: { p in map(p, sa){ 0 &- $0 } })
+		self.add("Int2.addingReportingOverflow", vuckt: { p in map(p, a, b){ $0.addingReportingOverflow($1) } })
+		self.add("Int2.subtractingReportingOverflow", vuckt: { p in map(p, a, b){ $0.subtractingReportingOverflow($1) } })
+		self.add("Int2.multipliedReportingOverflow", vuckt: { p in map(p, a, b){ $0.multipliedReportingOverflow(by: $1) } })
+		self.add("Int2.addingReportingLaneOverflow", vuckt: { p in map(p, a, b){ $0.addingReportingLaneOverflow($1) } })
+		self.add("Int2.multipliedReportingLaneOverflow", vuckt: { p in map(p, a, b){ $0.multipliedReportingLaneOverflow(by: $1) } })
+		self.add("Int2.addingSaturated", vuckt: { p in map(p, a, b){ $0.addingSaturated($1) } })
+		self.add("Int2.subtractingSaturated", vuckt: { p in map(p, a, b){ $0.subtractingSaturated($1) } })
+		self.add("Int2.multipliedSaturated", vuckt: { p in map(p, a, b){ $0.multipliedSaturated(by: $1) } })
+		self.add("Int2.wrappingAdd", vuckt: { p in map(p, a, b){ $0 &+ $1 } }, simd: { p in map(p, sa, sb){ $0 &+ $1 } })
+		self.add("Int2.wrappingMultiply", vuckt: { p in map(p, a, b){ $0 &* $1 } }, simd: { p in map(p, sa, sb){ $0 &* $1 } })
+		self.add("Int2.dividedReportingOverflow", vuckt: { p in map(p, a, b){ $0.dividedReportingOverflow(by: $1) } })
+		self.add("Int2.equal", vuckt: { p in map(p, a, b){ $0 == $1 } }, simd: { p in map(p, sa, sb){ $0 == $1 } })
+		self.add("Int2.lessThan", vuckt: { p in map(p, a, b){ $0 < $1 } }, simd: { p in map(p, sa, sb){ all($0 .< $1) } })
+		self.add("Int2.lessThanOrEqual", vuckt: { p in map(p, a, b){ $0 <= $1 } }, simd: { p in map(p, sa, sb){ all($0 .<= $1) } })
+		self.add("Int2.min", vuckt: { p in map(p, a, b){ min($0, $1) } }, simd: { p in map(p, sa, sb){ simd_min($0, $1) } })
+		self.add("Int2.max", vuckt: { p in map(p, a, b){ max($0, $1) } }, simd: { p in map(p, sa, sb){ simd_max($0, $1) } })
+		self.add("Int2.clamped", vuckt: { p in map(p, a){ $0.clamped(to: lo...hi) } }, simd: { p in map(p, sa){ simd_clamp($0, lo.simdValue, hi.simdValue) } })
+		self.add("Int2.lOneNorm", vuckt: { p in map(p, a){ $0.lOneNorm() } }, simd: { p in map(p, sa){ simd_reduce_add(simd_abs($0)) } })
+		self.add("Int2.lInfinityNorm", vuckt: { p in map(p, a){ $0.lInfinityNorm() } }, simd: { p in map(p, sa){ simd_reduce_max(simd_abs($0)) } })
+		self.add("Int2.taxicabDistance", vuckt: { p in map(p, a, b){ taxicabDistanceBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_reduce_add(simd_abs($0 &- $1)) } })
+		self.add("Int2.bulk.add", vuckt: { p in batch(p, count: n, of: Int2.self){ a.add(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 &+ $1 } })
+		self.add("Int2.bulk.subtract", vuckt: { p in batch(p, count: n, of: Int2.self){ a.subtract(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 &- $1 } })
+		self.add("Int2.bulk.multiply", vuckt: { p in batch(p, count: n, of: Int2.self){ a.multiply(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 &* $1 } })
+		self.add("Int2.bulk.divide", vuckt: { p in batch(p, count: n, of: Int2.self){ a.divide(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Int2.bulk.remainder", vuckt: { p in batch(p, count: n, of: Int2.self){ a.remainder(dividingBy: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 % $1 } })
+		self.add("Int2.bulk.negate", vuckt: { p in batch(p, count: n, of: Int2.self){ a.negate(into: $0) } }, simd: { p in map(p, sa){ 0 &- $0 } })
+		self.add("Int2.bulk.multiplyByScalar", vuckt: { p in batch(p, count: n, of: Int2.self){ a.multiply(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 &* 3 } })
+		self.add("Int2.bulk.divideByScalar", vuckt: { p in batch(p, count: n, of: Int2.self){ a.divide(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 / 3 } })
+		self.add("Int2.bulk.remainderByScalar", vuckt: { p in batch(p, count: n, of: Int2.self){ a.remainder(dividingBy: 3, into: $0) } }, simd: { p in map(p, sa){ $0 % 3 } })
+	}
+	
+	
+	mutating func addInt3Benchmarks() {
+		let f = self.fixtures, n = f.count
+		let (a, b, s) = (f.int3A, f.int3B, f.int32Scalars)
+		let (sa, sb) = (f.simdInt3A, f.simdInt3B)
+		let (lo, hi) = (Int3(-100, -100, -100), Int3(100, 100, 100))
+		
+		self.add("Int3.add", vuckt: { p in map(p, a, b){ $0 + $1 } }, simd: { p in map(p, sa, sb){ $0 &+ $1 } })
+		self.add("Int3.subtract", vuckt: { p in map(p, a, b){ $0 - $1 } }, simd: { p in map(p, sa, sb){ $0 &- $1 } })
+		self.add("Int3.multiply", vuckt: { p in map(p, a, b){ $0 * $1 } }, simd: { p in map(p, sa, sb){ $0 &* $1 } })
+		self.add("Int3.divide", vuckt: { p in map(p, a, b){ $0 / $1 } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Int3.remainder", vuckt: { p in map(p, a, b){ $0 % $1 } }, simd: { p in map(p, sa, sb){ $0 % $1 } })
+		self.add("Int3.multiplyByScalar", vuckt: { p in map(p, a, s){ $0 * $1 } }, simd: { p in map(p, sa, s){ $0 &* $1 } })
+		self.add("Int3.divideByScalar", vuckt: { p in map(p, a, s){ $0 / $1 } }, simd: { p in map(p, sa, s){ $0 / $1 } })
+		self.add("Int3.remainderByScalar", vuckt: { p in map(p, a, s){ $0 % $1 } }, simd: { p in map(p, sa, s){ $0 % $1 } })
+		self.add("Int3.negate", vuckt: { p in map(p, a){ -$0 } }, simd: { p in map(p, sa){ 0 &- $0 } })
+		self.add("Int3.addingReportingOverflow", vuckt: { p in map(p, a, b){ $0.addingReportingOverflow($1) } })
+		self.add("Int3.subtractingReportingOverflow", vuckt: { p in map(p, a, b){ $0.subtractingReportingOverflow($1) } })
+		self.add("Int3.multipliedReportingOverflow", vuckt: { p in map(p, a, b){ $0.multipliedReportingOverflow(by: $1) } })
+		self.add("Int3.addingReportingLaneOverflow", vuckt: { p in map(p, a, b){ $0.addingReportingLaneOverflow($1) } })
+		self.add("Int3.multipliedReportingLaneOverflow", vuckt: { p in map(p, a, b){ $0.multipliedReportingLaneOverflow(by: $1) } })
+		self.add("Int3.addingSaturated", vuckt: { p in map(p, a, b){ $0.addingSaturated($1) } })
+		self.add("Int3.subtractingSaturated", vuckt: { p in map(p, a, b){ $0.subtractingSaturated($1) } })
+		self.add("Int3.multipliedSaturated", vuckt: { p in map(p, a, b){ $0.multipliedSaturated(by: $1) } })
+		self.add("Int3.wrappingAdd", vuckt: { p in map(p, a, b){ $0 &+ $1 } }, simd: { p in map(p, sa, sb){ $0 &+ $1 } })
+		self.add("Int3.wrappingMultiply", vuckt: { p in map(p, a, b){ $0 &* $1 } }, simd: { p in map(p, sa, sb){ $0 &* $1 } })
+		self.add("Int3.dividedReportingOverflow", vuckt: { p in map(p, a, b){ $0.dividedReportingOverflow(by: $1) } })
+		self.add("Int3.equal", vuckt: { p in map(p, a, b){ $0 == $1 } }, simd: { p in map(p, sa, sb){ $0 == $1 } })
+		self.add("Int3.lessThan", vuckt: { p in map(p, a, b){ $0 < $1 } }, simd: { p in map(p, sa, sb){ all($0 .< $1) } })
+		self.add("Int3.lessThanOrEqual", vuckt: { p in map(p, a, b){ $0 <= $1 } }, simd: { p in map(p, sa, sb){ all($0 .<= $1) } })
+		self.add("Int3.min", vuckt: { p in map(p, a, b){ min($0, $1) } }, simd: { p in map(p, sa, sb){ simd_min($0, $1) } })
+		self.add("Int3.max", vuckt: { p in map(p, a, b){ max($0, $1) } }, simd: { p in map(p, sa, sb){ simd_max($0, $1) } })
+		self.add("Int3.clamped", vuckt: { p in map(p, a){ $0.clamped(to: lo...hi) } }, simd: { p in map(p, sa){ simd_clamp($0, lo.simdValue, hi.simdValue) } })
+		self.add("Int3.lOneNorm", vuckt: { p in map(p, a){ $0.lOneNorm() } }, simd: { p in map(p, sa){ simd_reduce_add(simd_abs($0)) } })
+		self.add("Int3.lInfinityNorm", vuckt: { p in map(p, a){ $0.lInfinityNorm() } }, simd: { p in map(p, sa){ simd_reduce_max(simd_abs($0)) } })
+		self.add("Int3.taxicabDistance", vuckt: { p in map(p, a, b){ taxicabDistanceBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_reduce_add(simd_abs($0 &- $1)) } })
+		self.add("Int3.bulk.add", vuckt: { p in batch(p, count: n, of: Int3.self){ a.add(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 &+ $1 } })
+		self.add("Int3.bulk.subtract", vuckt: { p in batch(p, count: n, of: Int3.self){ a.subtract(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 &- $1 } })
+		self.add("Int3.bulk.multiply", vuckt: { p in batch(p, count: n, of: Int3.self){ a.multiply(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 &* $1 } })
+		self.add("Int3.bulk.divide", vuckt: { p in batch(p, count: n, of: Int3.self){ a.divide(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Int3.bulk.remainder", vuckt: { p in batch(p, count: n, of: Int3.self){ a.remainder(dividingBy: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 % $1 } })
+		self.add("Int3.bulk.negate", vuckt: { p in batch(p, count: n, of: Int3.self){ a.negate(into: $0) } }, simd: { p in map(p, sa){ 0 &- $0 } })
+		self.add("Int3.bulk.multiplyByScalar", vuckt: { p in batch(p, count: n, of: Int3.self){ a.multiply(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 &* 3 } })
+		self.add("Int3.bulk.divideByScalar", vuckt: { p in batch(p, count: n, of: Int3.self){ a.divide(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 / 3 } })
+		self.add("Int3.bulk.remainderByScalar", vuckt: { p in batch(p, count: n, of: Int3.self){ a.remainder(dividingBy: 3, into: $0) } }, simd: { p in map(p, sa){ $0 % 3 } })
+	}
+	
+	
+	mutating func addInt4Benchmarks() {
+		let f = self.fixtures, n = f.count
+		let (a, b, s, fa) = (f.int4A, f.int4B, f.int32Scalars, f.float4A)
+		let (sa, sb) = (f.simdInt4A, f.simdInt4B)
+		let (lo, hi) = (Int4(-100, -100, -100, -100), Int4(100, 100, 100, 100))
+		
+		self.add("Int4.add", vuckt: { p in map(p, a, b){ $0 + $1 } }, simd: { p in map(p, sa, sb){ $0 &+ $1 } })
+		self.add("Int4.subtract", vuckt: { p in map(p, a, b){ $0 - $1 } }, simd: { p in map(p, sa, sb){ $0 &- $1 } })
+		self.add("Int4.multiply", vuckt: { p in map(p, a, b){ $0 * $1 } }, simd: { p in map(p, sa, sb){ $0 &* $1 } })
+		self.add("Int4.divide", vuckt: { p in map(p, a, b){ $0 / $1 } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Int4.remainder", vuckt: { p in map(p, a, b){ $0 % $1 } }, simd: { p in map(p, sa, sb){ $0 % $1 } })
+		self.add("Int4.multiplyByScalar", vuckt: { p in map(p, a, s){ $0 * $1 } }, simd: { p in map(p, sa, s){ $0 &* $1 } })
+		self.add("Int4.divideByScalar", vuckt: { p in map(p, a, s){ $0 / $1 } }, simd: { p in map(p, sa, s){ $0 / $1 } })
+		self.add("Int4.remainderByScalar", vuckt: { p in map(p, a, s){ $0 % $1 } }, simd: { p in map(p, sa, s){ $0 % $1 } })
+		self.add("Int4.negate", vuckt: { p in map(p, a){ -$0 } }, simd: { p in map(p, sa){ 0 &- $0 } })
+		self.add("Int4.addingReportingOverflow", vuckt: { p in map(p, a, b){ $0.addingReportingOverflow($1) } })
+		self.add("Int4.subtractingReportingOverflow", vuckt: { p in map(p, a, b){ $0.subtractingReportingOverflow($1) } })
+		self.add("Int4.multipliedReportingOverflow", vuckt: { p in map(p, a, b){ $0.multipliedReportingOverflow(by: $1) } })
+		self.add("Int4.addingReportingLaneOverflow", vuckt: { p in map(p, a, b){ $0.addingReportingLaneOverflow($1) } })
+		self.add("Int4.multipliedReportingLaneOverflow", vuckt: { p in map(p, a, b){ $0.multipliedReportingLaneOverflow(by: $1) } })
+		self.add("Int4.addingSaturated", vuckt: { p in map(p, a, b){ $0.addingSaturated($1) } })
+		self.add("Int4.subtractingSaturated", vuckt: { p in map(p, a, b){ $0.subtractingSaturated($1) } })
+		self.add("Int4.multipliedSaturated", vuckt: { p in map(p, a, b){ $0.multipliedSaturated(by: $1) } })
+		self.add("Int4.wrappingAdd", vuckt: { p in map(p, a, b){ $0 &+ $1 } }, simd: { p in map(p, sa, sb){ $0 &+ $1 } })
+		self.add("Int4.wrappingMultiply", vuckt: { p in map(p, a, b){ $0 &* $1 } }, simd: { p in map(p, sa, sb){ $0 &* $1 } })
+		self.add("Int4.dividedReportingOverflow", vuckt: { p in map(p, a, b){ $0.dividedReportingOverflow(by: $1) } })
+		self.add("Int4.equal", vuckt: { p in map(p, a, b){ $0 == $1 } }, simd: { p in map(p, sa, sb){ $0 == $1 } })
+		self.add("Int4.lessThan", vuckt: { p in map(p, a, b){ $0 < $1 } }, simd: { p in map(p, sa, sb){ all($0 .< $1) } })
+		self.add("Int4.lessThanOrEqual", vuckt: { p in map(p, a, b){ $0 <= $1 } }, simd: { p in map(p, sa, sb){ all($0 .<= $1) } })
+		self.add("Int4.min", vuckt: { p in map(p, a, b){ min($0, $1) } }, simd: { p in map(p, sa, sb){ simd_min($0, $1) } })
+		self.add("Int4.max", vuckt: { p in map(p, a, b){ max($0, $1) } }, simd: { p in map(p, sa, sb){ simd_max($0, $1) } })
+		self.add("Int4.clamped", vuckt: { p in map(p, a){ $0.clamped(to: lo...hi) } }, simd: { p in map(p, sa){ simd_clamp($0, lo.simdValue, hi.simdValue) } })
+		self.add("Int4.lOneNorm", vuckt: { p in map(p, a){ $0.lOneNorm() } }, simd: { p in map(p, sa){ simd_reduce_add(simd_abs($0)) } })
+		self.add("Int4.lInfinityNorm", vuckt: { p in map(p, a){ $0.lInfinityNorm() } }, simd: { p in map(p, sa){ simd_reduce_max(simd_abs($0)) } })
+		self.add("Int4.taxicabDistance", vuckt: { p in map(p, a, b){ taxicabDistanceBetween($0, $1) } }, simd: { p in map(p, sa, sb){ simd_reduce_add(simd_abs($0 &- $1)) } })
+		self.add("Int4.bulk.add", vuckt: { p in batch(p, count: n, of: Int4.self){ a.add(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 &+ $1 } })
+		self.add("Int4.bulk.subtract", vuckt: { p in batch(p, count: n, of: Int4.self){ a.subtract(b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 &- $1 } })
+		self.add("Int4.bulk.multiply", vuckt: { p in batch(p, count: n, of: Int4.self){ a.multiply(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 &* $1 } })
+		self.add("Int4.bulk.divide", vuckt: { p in batch(p, count: n, of: Int4.self){ a.divide(by: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 / $1 } })
+		self.add("Int4.bulk.remainder", vuckt: { p in batch(p, count: n, of: Int4.self){ a.remainder(dividingBy: b, into: $0) } }, simd: { p in map(p, sa, sb){ $0 % $1 } })
+		self.add("Int4.bulk.negate", vuckt: { p in batch(p, count: n, of: Int4.self){ a.negate(into: $0) } }, simd: { p in map(p, sa){ 0 &- $0 } })
+		self.add("Int4.bulk.multiplyByScalar", vuckt: { p in batch(p, count: n, of: Int4.self){ a.multiply(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 &* 3 } })
+		self.add("Int4.bulk.divideByScalar", vuckt: { p in batch(p, count: n, of: Int4.self){ a.divide(by: 3, into: $0) } }, simd: { p in map(p, sa){ $0 / 3 } })
+		self.add("Int4.bulk.remainderByScalar", vuckt: { p in batch(p, count: n, of: Int4.self){ a.remainder(dividingBy: 3, into: $0) } }, simd: { p in map(p, sa){ $0 % 3 } })
+		self.add("Int4.bulk.narrow.char4.truncating", vuckt: { p in batch(p, count: n, of: Char4.self){ a.narrow(into: $0) } }, simd: { p in map(p, sa){ simd_char4(truncatingIfNeeded: $0) } })
+		self.add("Int4.bulk.narrow.char4.clamping", vuckt: { p in batch(p, count: n, of: Char4.self){ a.narrow(into: $0, mode: .clamping) } }, simd: { p in map(p, sa){ simd_char4(clamping: $0) } })
+		self.add("Float4.bulk.narrow.uchar4.normalized", vuckt: { p in batch(p, count: n, of: UChar4.self){ fa.narrow(into: $0, mode: .normalized) } })
+		self.add("Float4.bulk.narrow.short4.saturating", vuckt: { p in batch(p, count: n, of: Short4.self){ fa.narrow(into: $0) } })
+	}
+}
@@ -0,0 +1,136 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+import Vuckt
+
+
+
+extension BenchmarkSuite
+{
+	mutating func addFloat3x3Benchmarks() {
+		let f = self.fixtures, n = f.count
+		let (a, b, v, q, s) = (f.float3x3A, f.float3x3B, f.float3A, f.quaternionA, f.floatScalars)
+		let (sa, sb, sv, sq) = (f.simdFloat3x3A, f.simdFloat3x3B, f.simdFloat3A, f.simdQuaternionA)
+		
+		self.add("Float3x3.add", vuckt: { p in map(p, a, b){ $0 + $1 } }, simd: { p in map(p, sa, sb){ simd_add($0, $1) } })
+		self.add("Float3x3.subtract", vuckt: { p in map(p, a, b){ $0 - $1 } }, simd: { p in map(p, sa, sb){ simd_sub($0, $1) } })
+		self.add("Float3x3.multiply", vuckt: { p in map(p, a, b){ $0 * $1 } }, simd: { p in map(p, sa, sb){ simd_mul($0, $1) } })
+		self.add("Float3x3.divide", vuckt: { p in map(p, a, b){ $0 / $1 } }, simd: { p in map(p, sa, sb){ simd_mul($0, simd_inverse($1)) } })
+		self.add("Float3x3.multiplyColumnVector", vuckt: { p in map(p, a, v){ $0 * $1 } }, simd: { p in map(p, sa, sv){ simd_mul($0, $1) } })
+		self.add("Float3x3.multiplyRowVector", vuckt: { p in map(p, v, a){ $0 * $1 } }, simd: { p in map(p, sv, sa){ simd_mul($0, $1) } })
+		self.add("Float3x3.multiplyByScalar", vuckt: { p in map(p, a, s){ $0 * $1 } }, simd: { p in map(p, sa, s){ simd_mul($1, $0) } })
+		self.add("Float3x3.divideByScalar", vuckt: { p in map(p, a, s){ $0 / $1 } }, simd: { p in map(p, sa, s){ simd_mul(1 / $1, $0) } })
+		self.add("Float3x3.equal", vuckt: { p in map(p, a, b){ $0 == $1 } }, simd: { p in map(p, sa, sb){ simd_equal($0, $1) } })
+		self.add("Float3x3.determinant", vuckt: { p in map(p, a){ $0.determinant() } }, simd: { p in map(p, sa){ simd_determinant($0) } })
+		self.add("Float3x3.trace", vuckt: { p in map(p, a){ $0.trace() } }, simd: { p in map(p, sa){ $0[0][0] + $0[1][1] + $0[2][2] } })
+		self.add("Float3x3.inversed", vuckt: { p in map(p, a){ $0.inversed() } }, simd: { p in map(p, sa){ simd_inverse($0) } })
+		self.add("Float3x3.transposed", vuckt: { p in map(p, a){ $0.transposed() } }, simd: { p in map(p, sa){ simd_transpose($0) } })
+		self.add("Float3x3.rotated", vuckt: { p in map(p, a, q){ $0.rotated(by: $1) } }, simd: { p in map(p, sa, sq){ simd_mul(simd_matrix3x3($1), $0) } })
+		self.add("Float3x3.unrotated", vuckt: { p in map(p, a, q){ $0.unrotated(by: $1) } }, simd: { p in map(p, sa, sq){ simd_mul(simd_matrix3x3(simd_inverse($1)), $0) } })
+		self.add("Float3x3.scaled", vuckt: { p in map(p, a, f.float3B){ $0.scaled(by: $1) } })
+		self.add("Float3x3.outerProduct", vuckt: { p in map(p, v, f.float3B){ outerProductOf($0, $1) } })
+		self.add("Float3x3.rotationEulerAngles", vuckt: { p in map(p, v){ Float3x3(rotationEulerAngles: $0) } })
+		self.add("Float3x3.bulk.rotationEulerAngles", vuckt: { p in batch(p, count: n, of: Float3x3.self){ Float3x3.fromRotationEulerAngles(v, into: $0) } })
+		self.add("Float3x3.normalMatrix", vuckt: { p in map(p, a){ $0.normalMatrix() } }, simd: { p in map(p, sa){ simd_transpose(simd_inverse($0)) } })
+		self.add("Float3x3.transformVectors", vuckt: { p in batch(p, count: n, of: Float3.self){ a[0].transformVectors(f.float3A, into: $0) } }, simd: { p in map(p, f.simdFloat3A){ simd_mul(sa[0], $0) } })
+		self.add("Float3x3.transformNormals",
+			vuckt: { p in batch(p, count: n, of: Float3.self){ a[0].transformNormals(f.float3Normals, into: $0, renormalize: true) } },
+			simd: { p in
+				let normalMatrix = simd_transpose(simd_inverse(sa[0]))
+				map(p, f.simdFloat3Normals){ simd_normalize(simd_mul(normalMatrix, $0)) }
+			}
+		)
+	}
+	
+	
+	mutating func addFloat4x4Benchmarks() {
+		let f = self.fixtures, n = f.count
+		let (a, b, v, q, s) = (f.float4x4A, f.float4x4B, f.float4A, f.quaternionA, f.floatScalars)
+		let (sa, sb, sv, sq) = (f.simdFloat4x4A, f.simdFloat4x4B, f.simdFloat4A, f.simdQuaternionA)
+		
+		self.add("Float4x4.add", vuckt: { p in map(p, a, b){ $0 + $1 } }, simd: { p in map(p, sa, sb){ simd_add($0, $1) } })
+		self.add("Float4x4.subtract", vuckt: { p in map(p, a, b){ $0 - $1 } }, simd: { p in map(p, sa, sb){ simd_sub($0, $1) } })
+		self.add("Float4x4.multiply", vuckt: { p in map(p, a, b){ $0 * $1 } }, simd: { p in map(p, sa, sb){ simd_mul($0, $1) } })
+		self.add("Float4x4.divide", vuckt: { p in map(p, a, b){ $0 / $1 } }, simd: { p in map(p, sa, sb){ simd_mul($0, simd_inverse($1)) } })
+		self.add("Float4x4.multiplyColumnVector", vuckt: { p in map(p, a, v){ $0 * $1 } }, simd: { p in map(p, sa, sv){ simd_mul($0, $1) } })
+		self.add("Float4x4.multiplyRowVector", vuckt: { p in map(p, v, a){ $0 * $1 } }, simd: { p in map(p, sv, sa){ simd_mul($0, $1) } })
+		self.add("Float4x4.multiplyByScalar", vuckt: { p in map(p, a, s){ $0 * $1 } }, simd: { p in map(p, sa, s){ simd_mul($1, $0) } })
+		self.add("Float4x4.divideByScalar", vuckt: { p in map(p, a, s){ $0 / $1 } }, simd: { p in map(p, sa, s){ simd_mul(1 / $1, $0) } })
+		self.add("Float4x4.equal", vuckt: { p in map(p, a, b){ $0 == $1 } }, simd: { p in map(p, sa, sb){ simd_equal($0, $1) } })
+		self.add("Float4x4.determinant", vuckt: { p in map(p, a){ $0.determinant() } }, simd: { p in map(p, sa){ simd_determinant($0) } })
+		self.add("Float4x4.trace", vuckt: { p in map(p, a){ $0.trace() } }, simd: { p in map(p, sa){ $0[0][0] + $0[1][1] + $0[2][2] + $0[3][3] } })
+		self.add("Float4x4.inversed", vuckt: { p in map(p, a){ $0.inversed() } }, simd: { p in map(p, sa){ simd_inverse($0) } })
+		self.add("Float4x4.transposed", vuckt: { p in map(p, a){ $0.transposed() } }, simd: { p in map(p, sa){ simd_transpose($0) } })
+		self.add("Float4x4.rotated", vuckt: { p in map(p, a, q){ $0.rotated(by: $1) } }, simd: { p in map(p, sa, sq){ simd_mul(simd_matrix4x4($1), $0) } })
+		self.add("Float4x4.unrotated", vuckt: { p in map(p, a, q){ $0.unrotated(by: $1) } }, simd: { p in map(p, sa, sq){ simd_mul(simd_matrix4x4(simd_inverse($1)), $0) } })
+		self.add("Float4x4.scaled", vuckt: { p in map(p, a, f.float3B){ $0.scaled(by: $1) } })
+		self.add("Float4x4.translated", vuckt: { p in map(p, a, f.float3B){ $0.translated(by: $1) } })
+		self.add("Float4x4.rotationEulerAngles", vuckt: { p in map(p, f.float3A){ Float4x4(rotationEulerAngles: $0) } })
+		self.add("Float4x4.bulk.rotationEulerAngles", vuckt: { p in batch(p, count: n, of: Float4x4.self){ Float4x4.fromRotationEulerAngles(f.float3A, into: $0) } })
+		self.add("Float4x4.outerProduct", vuckt: { p in map(p, v, f.float4B){ outerProductOf($0, $1) } })
+		self.add("Float4x4.transformPoints",
+			vuckt: { p in batch(p, count: n, of: Float3.self){ a[0].transformPoints(f.float3A, into: $0) } },
+			simd: { p in map(p, f.simdFloat3A){ (point:simd_float3) -> simd_float3 in
+				let r = simd_mul(sa[0], simd_float4(point.x, point.y, point.z, 1))
+				return simd_float3(r.x, r.y, r.z)
+			} }
+		)
+		self.add("Float4x4.transformPoints.perspectiveDivide",
+			vuckt: { p in batch(p, count: n, of: Float3.self){ a[0].transformPoints(f.float3A, into: $0, perspectiveDivide: true) } },
+			simd: { p in map(p, f.simdFloat3A){ (point:simd_float3) -> simd_float3 in
+				let r = simd_mul(sa[0], simd_float4(point.x, point.y, point.z, 1))
+				return simd_float3(r.x, r.y, r.z) / r.w
+			} }
+		)
+		self.add("Float4x4.transformVectors",
+			vuckt: { p in batch(p, count: n, of: Float3.self){ a[0].transformVectors(f.float3A, into: $0) } },
+			simd: { p in map(p, f.simdFloat3A){ (vector:simd_float3) -> simd_float3 in
+				let r = simd_mul(sa[0], simd_float4(vector.x, vector.y, vector.z, 0))
+				return simd_float3(r.x, r.y, r.z)
+			} }
+		)
+		self.add("Float4x4.transformNormals",
+			vuckt: { p in batch(p, count: n, of: Float3.self){ a[0].transformNormals(f.float3Normals, into: $0, renormalize: true) } }
+		)
+		self.add("Float4x4.propagateHierarchy",
+			vuckt: { p in batch(p, count: n, of: Float4x4.self){ Float4x4.propagateHierarchy(local: a, parentIndices: f.parentIndices, world: $0) } },
+			simd: { p in batch(p, count: n, of: simd_float4x4.self){ world in
+				for i in 0..<n {
+					let parentIndex = Int(f.parentIndices[i])
+					world[i] = (parentIndex < 0) ? sa[i] : simd_mul(world[parentIndex], sa[i])
+				}
+			} }
+		)
+	}
+	
+	
+	mutating func addFloat4x3Benchmarks() {
+		let f = self.fixtures
+		let (a, b, v) = (f.float4x3A, f.float4x3B, f.float3A)
+		let (sa, sb, sv) = (f.simdFloat4x4A, f.simdFloat4x4B, f.simdFloat3A)
+		
+		self.add("Float4x3.multiply", vuckt: { p in map(p, a, b){ $0 * $1 } }, simd: { p in map(p, sa, sb){ simd_mul($0, $1) } })
+		self.add("Float4x3.inversed", vuckt: { p in map(p, a){ $0.inversed() } }, simd: { p in map(p, sa){ simd_inverse($0) } })
+		self.add("Float4x3.orthogonalInversed", vuckt: { p in map(p, a){ $0.orthogonalInversed() } }, simd: { p in map(p, sa){ simd_inverse($0) } })
+		self.add("Float4x3.transformPoint",
+			vuckt: { p in map(p, a, v){ $0.transformPoint($1) } },
+			simd: { p in map(p, sa, sv){ (m:simd_float4x4, point:simd_float3) -> simd_float3 in
+				let r = simd_mul(m, simd_float4(point.x, point.y, point.z, 1))
+				return simd_float3(r.x, r.y, r.z)
+			} }
+		)
+		self.add("Float4x3.fromScaleRotationTranslation",
+			vuckt: { p in map(p, f.float3A, f.quaternionA, f.float3B){ Float4x3(scale: $0, rotation: $1, translation: $2) } },
+			simd: { p in map(p, sv, f.simdQuaternionA, f.simdFloat3B){ (scale:simd_float3, rotation:simd_quatf, translation:simd_float3) -> simd_float4x4 in
+				let r = simd_matrix4x4(rotation)
+				return simd_float4x4(r[0] * scale.x, r[1] * scale.y, r[2] * scale.z, simd_float4(translation.x, translation.y, translation.z, 1))
+			} }
+		)
+	}
+}
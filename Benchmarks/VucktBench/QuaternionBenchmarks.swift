@@ -0,0 +1,59 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+import Vuckt
+
+
+
+extension BenchmarkSuite
+{
+	mutating func addFloatQuaternionBenchmarks() {
+		let f = self.fixtures, n = f.count
+		let (a, b, c, d, v, s, t) = (f.quaternionA, f.quaternionB, f.quaternionC, f.quaternionD, f.float3A, f.floatScalars, f.ratios)
+		let (sa, sb, sc, sd, sv) = (f.simdQuaternionA, f.simdQuaternionB, f.simdQuaternionC, f.simdQuaternionD, f.simdFloat3A)
+		
+		self.add("FloatQuaternion.add", vuckt: { p in map(p, a, b){ $0 + $1 } }, simd: { p in map(p, sa, sb){ simd_add($0, $1) } })
+		self.add("FloatQuaternion.subtract", vuckt: { p in map(p, a, b){ $0 - $1 } }, simd: { p in map(p, sa, sb){ simd_sub($0, $1) } })
+		self.add("FloatQuaternion.negate", vuckt: { p in map(p, a){ $0.negated() } }, simd: { p in map(p, sa){ simd_negate($0) } })
+		self.add("FloatQuaternion.multiply", vuckt: { p in map(p, a, b){ $0 * $1 } }, simd: { p in map(p, sa, sb){ simd_mul($0, $1) } })
+		self.add("FloatQuaternion.divide", vuckt: { p in map(p, a, b){ $0 / $1 } }, simd: { p in map(p, sa, sb){ simd_mul($0, simd_inverse($1)) } })
+		self.add("FloatQuaternion.multiplyByScalar", vuckt: { p in map(p, a, s){ $0 * $1 } }, simd: { p in map(p, sa, s){ simd_mul($0, $1) } })
+		self.add("FloatQuaternion.divideByScalar", vuckt: { p in map(p, a, s){ $0 / $1 } }, simd: { p in map(p, sa, s){ simd_mul($0, 1 / $1) } })
+		self.add("FloatQuaternion.rotate", vuckt: { p in map(p, a, v){ $0 * $1 } }, simd: { p in map(p, sa, sv){ simd_act($0, $1) } })
+		self.add("FloatQuaternion.unrotate", vuckt: { p in map(p, a, v){ $0.unrotate($1) } }, simd: { p in map(p, sa, sv){ simd_act(simd_inverse($0), $1) } })
+		self.add("FloatQuaternion.dotProduct", vuckt: { p in map(p, a, b){ $0.dotProduct($1) } }, simd: { p in map(p, sa, sb){ simd_dot($0, $1) } })
+		self.add("FloatQuaternion.inversed", vuckt: { p in map(p, a){ $0.inversed() } }, simd: { p in map(p, sa){ simd_inverse($0) } })
+		self.add("FloatQuaternion.conjugated", vuckt: { p in map(p, a){ $0.conjugated() } }, simd: { p in map(p, sa){ simd_conjugate($0) } })
+		self.add("FloatQuaternion.normalized", vuckt: { p in map(p, a){ $0.normalized() } }, simd: { p in map(p, sa){ simd_normalize($0) } })
+		self.add("FloatQuaternion.length", vuckt: { p in map(p, a){ $0.length() } }, simd: { p in map(p, sa){ simd_length($0) } })
+		self.add("FloatQuaternion.normalized.fast", vuckt: { p in map(p, a){ $0.normalized(precision: .fast) } }, simd: { p in map(p, sa){ simd_normalize($0) } })
+		self.add("FloatQuaternion.length.fast", vuckt: { p in map(p, a){ $0.length(precision: .fast) } }, simd: { p in map(p, sa){ simd_length($0) } })
+		self.add("FloatQuaternion.eulerAngles", vuckt: { p in map(p, v){ FloatQuaternion(eulerAngles: $0) } })
+		self.add("FloatQuaternion.eulerAngles.fast", vuckt: { p in map(p, v){ FloatQuaternion(eulerAngles: $0, precision: .fast) } })
+		self.add("FloatQuaternion.eulerAngles.roundTrip", vuckt: { p in map(p, v){ FloatQuaternion(eulerAngles: $0).eulerAngles() } })
+		self.add("FloatQuaternion.bulk.eulerAngles", vuckt: { p in batch(p, count: n, of: FloatQuaternion.self){ FloatQuaternion.fromEulerAngles(v, into: $0) } })
+		self.add("FloatQuaternion.equal", vuckt: { p in map(p, a, b){ $0 == $1 } }, simd: { p in map(p, sa, sb){ $0.vector == $1.vector } })
+		self.add("FloatQuaternion.interpolated.shortest", vuckt: { p in map(p, a, b, t){ interpolateBetween($0, $1, ratio: $2, method: .shortest) } }, simd: { p in map(p, sa, sb, t){ simd_slerp($0, $1, $2) } })
+		self.add("FloatQuaternion.interpolated.longest", vuckt: { p in map(p, a, b, t){ interpolateBetween($0, $1, ratio: $2, method: .longest) } }, simd: { p in map(p, sa, sb, t){ simd_slerp_longest($0, $1, $2) } })
+		self.add("FloatQuaternion.interpolated.bezier",
+			vuckt: { p in map(p, a, b, t){ interpolateBetween($0, c[0], d[0], $1, ratio: $2, method: .bezier) } },
+			simd: { p in map(p, sa, sb, t){ simd_bezier($0, sc[0], sd[0], $1, $2) } }
+		)
+		self.add("FloatQuaternion.interpolated.spline",
+			vuckt: { p in map(p, a, b, t){ interpolateBetween($0, c[0], d[0], $1, ratio: $2, method: .spline) } },
+			simd: { p in map(p, sa, sb, t){ simd_spline($0, sc[0], sd[0], $1, $2) } }
+		)
+		self.add("FloatQuaternion.bulk.interpolated.shortest", vuckt: { p in batch(p, count: n, of: FloatQuaternion.self){ interpolateBetween(a, b, ratios: t, into: $0) } }, simd: { p in map(p, sa, sb, t){ simd_slerp($0, $1, $2) } })
+		self.add("FloatQuaternion.bulk.interpolated.shortest.fast", vuckt: { p in batch(p, count: n, of: FloatQuaternion.self){ interpolateBetween(a, b, ratios: t, into: $0, precision: .fast) } }, simd: { p in map(p, sa, sb, t){ simd_slerp($0, $1, $2) } })
+		self.add("FloatQuaternion.bulk.interpolated.longest", vuckt: { p in batch(p, count: n, of: FloatQuaternion.self){ interpolateBetween(a, b, ratios: t, into: $0, method: .longest) } }, simd: { p in map(p, sa, sb, t){ simd_slerp_longest($0, $1, $2) } })
+		self.add("FloatQuaternion.bulk.normalizedLinearInterpolated", vuckt: { p in batch(p, count: n, of: FloatQuaternion.self){ normalizedLinearInterpolateBetween(a, b, ratios: t, into: $0) } })
+		self.add("FloatQuaternion.bulk.interpolated.bezier", vuckt: { p in batch(p, count: n, of: FloatQuaternion.self){ interpolateBetween(a, c, d, b, ratios: t, into: $0, method: .bezier) } })
+		self.add("FloatQuaternion.bulk.interpolated.spline", vuckt: { p in batch(p, count: n, of: FloatQuaternion.self){ interpolateBetween(a, c, d, b, ratios: t, into: $0, method: .spline) } })
+	}
+}
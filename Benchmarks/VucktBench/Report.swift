@@ -0,0 +1,162 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+
+
+
+struct BenchmarkResult : Codable
+{
+	var name:String
+	var implementation:Implementation
+	/// The median of the samples' ns/op.
+	var nanosecondsPerOperation:Double
+	var meanNanosecondsPerOperation:Double
+	var minimumNanosecondsPerOperation:Double
+	/// The (sample) variance of the samples' ns/op.
+	var variance:Double
+	var standardDeviation:Double
+	/// Derived from the median ns/op.
+	var operationsPerSecond:Double
+	var sampleCount:Int
+	var operationsPerSample:Int
+	/// For Vuckt results, this result's ns/op ÷ its `simd` baseline's (so < 1 is faster than `simd`).
+	var relativeToSIMD:Double?
+	
+	var identifier:String { return "\(self.name)/\(self.implementation.rawValue)" }
+	
+	init(benchmark:Benchmark, samples_nsPerOp samples:[Double], operationsPerSample:Int) {
+		let sorted = samples.sorted()
+		let median = (sorted.count % 2 == 1)
+			? sorted[sorted.count / 2]
+			: (sorted[sorted.count / 2 - 1] + sorted[sorted.count / 2]) / 2
+		let mean = samples.reduce(0, +) / Double(samples.count)
+		let variance = (samples.count > 1)
+			? samples.reduce(0){ $0 + ($1 - mean) * ($1 - mean) } / Double(samples.count - 1)
+			: 0
+		
+		self.name = benchmark.name
+		self.implementation = benchmark.implementation
+		self.nanosecondsPerOperation = median
+		self.meanNanosecondsPerOperation = mean
+		self.minimumNanosecondsPerOperation = sorted.first ?? median
+		self.variance = variance
+		self.standardDeviation = variance.squareRoot()
+		self.operationsPerSecond = (median > 0) ? 1e9 / median : 0
+		self.sampleCount = samples.count
+		self.operationsPerSample = operationsPerSample
+		self.relativeToSIMD = nil
+	}
+}
+
+
+struct BenchmarkReport : Codable
+{
+	var formatVersion = 1
+	/// `c` (`VucktC`) or `swift` (built with `VUCKT_SWIFT_BACKEND=1`).
+	var backend:String
+	var platform:String
+	var elementCount:Int
+	var sampleCount:Int
+	var minimumSampleTimeMilliseconds:Double
+	var results:[BenchmarkResult]
+	var comparison:BenchmarkComparison?
+	
+	/// Fills in each Vuckt result's `relativeToSIMD` from its baseline result.
+	mutating func relateToSIMDBaselines() {
+		var simdResults:[String:BenchmarkResult] = [:]
+		for result in self.results where result.implementation == .simd {
+			simdResults[result.name] = result
+		}
+		for i in self.results.indices where self.results[i].implementation == .vuckt {
+			if let simdResult = simdResults[self.results[i].name], simdResult.nanosecondsPerOperation > 0 {
+				self.results[i].relativeToSIMD = self.results[i].nanosecondsPerOperation / simdResult.nanosecondsPerOperation
+			}
+		}
+	}
+	
+	static var currentBackend:String {
+		#if VUCKT_SWIFT_BACKEND
+			return "swift"
+		#else
+			return "c"
+		#endif
+	}
+	
+	static var currentPlatform:String {
+		#if os(macOS)
+			let os = "macos"
+		#elseif os(iOS)
+			let os = "ios"
+		#elseif os(Linux)
+			let os = "linux"
+		#elseif os(Windows)
+			let os = "windows"
+		#else
+			let os = "unknown"
+		#endif
+		#if arch(x86_64)
+			let arch = "x86_64"
+		#elseif arch(arm64)
+			let arch = "arm64"
+		#else
+			let arch = "unknown"
+		#endif
+		return "\(os)-\(arch)"
+	}
+}
+
+
+
+// MARK: Comparison
+
+struct BenchmarkComparison : Codable
+{
+	enum Status : String, Codable
+	{
+		case regressed
+		case improved
+		case unchanged
+		/// No matching result in the baseline.
+		case new
+	}
+	
+	struct Entry : Codable
+	{
+		var name:String
+		var implementation:Implementation
+		var baselineNanosecondsPerOperation:Double?
+		var nanosecondsPerOperation:Double
+		/// `(current - baseline) / baseline`, as a percentage; positive is slower.
+		var changePercent:Double?
+		var status:Status
+	}
+	
+	var baselinePath:String
+	var thresholdPercent:Double
+	var entries:[Entry]
+	var regressionCount:Int
+	
+	/// Matches `results` to `baseline`'s by name & implementation, flagging any that got slower (by median ns/op) by more than `thresholdPercent`.
+	init(results:[BenchmarkResult], baseline:BenchmarkReport, baselinePath:String, thresholdPercent:Double) {
+		var baselineResults:[String:BenchmarkResult] = [:]
+		for result in baseline.results {
+			baselineResults[result.identifier] = result
+		}
+		
+		self.baselinePath = baselinePath
+		self.thresholdPercent = thresholdPercent
+		self.entries = results.map{ result in
+			guard let baselineResult = baselineResults[result.identifier], baselineResult.nanosecondsPerOperation > 0 else {
+				return Entry(name: result.name, implementation: result.implementation, baselineNanosecondsPerOperation: nil, nanosecondsPerOperation: result.nanosecondsPerOperation, changePercent: nil, status: .new)
+			}
+			let changePercent = (result.nanosecondsPerOperation - baselineResult.nanosecondsPerOperation) / baselineResult.nanosecondsPerOperation * 100
+			let status:Status = (changePercent > thresholdPercent) ? .regressed
+				: (changePercent < -thresholdPercent) ? .improved
+				: .unchanged
+			return Entry(name: result.name, implementation: result.implementation, baselineNanosecondsPerOperation: baselineResult.nanosecondsPerOperation, nanosecondsPerOperation: result.nanosecondsPerOperation, changePercent: changePercent, status: status)
+		}
+		self.regressionCount = self.entries.filter{ $0.status == .regressed }.count
+	}
+}
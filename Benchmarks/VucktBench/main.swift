@@ -0,0 +1,175 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+
+
+
+let usage = """
+	Usage: swift run -c release VucktBench [options]
+
+	Benchmarks Vuckt's operations against their `SIMD…`/`simd_*` equivalents, writing the results as JSON.
+
+	Options:
+	  --filter <text>        Only run benchmarks whose name contains <text> (repeatable).
+	  --list                 List the benchmark names & exit.
+	  --count <n>            Elements processed per pass (default: 1024).
+	  --samples <n>          Timed samples per benchmark (default: 15).
+	  --sample-time <ms>     Minimum duration of each sample (default: 10).
+	  --output <path>        Write the JSON report to <path> instead of stdout.
+	  --compare <path>       Compare against a previously-written report, exiting with status 1 if any
+	                         benchmark's ns/op regressed by more than the threshold.
+	  --threshold <percent>  Regression threshold for --compare (default: 10).
+	  --help                 Show this help.
+
+	"""
+
+
+func printError(_ message:String) {
+	FileHandle.standardError.write((message + "\n").data(using: .utf8)!)
+}
+
+func exitWithUsageError(_ message:String) -> Never {
+	printError("error: \(message)\n")
+	printError(usage)
+	exit(2)
+}
+
+
+struct Options
+{
+	var filters:[String] = []
+	var list = false
+	var elementCount = 1024
+	var measurement = MeasurementOptions()
+	var outputPath:String?
+	var comparePath:String?
+	var thresholdPercent = 10.0
+	
+	init(arguments:[String]) {
+		var arguments = arguments[...]
+		func value(for option:String) -> String {
+			guard let value = arguments.popFirst() else {
+				exitWithUsageError("\(option) requires a value")
+			}
+			return value
+		}
+		func number<N:LosslessStringConvertible>(for option:String, _:N.Type) -> N {
+			let string = value(for: option)
+			guard let number = N(string) else {
+				exitWithUsageError("\(option) expects a number, not “\(string)”")
+			}
+			return number
+		}
+		
+		while let argument = arguments.popFirst() {
+			switch argument {
+				case "--filter": self.filters.append(value(for: argument))
+				case "--list": self.list = true
+				case "--count": self.elementCount = number(for: argument, Int.self)
+				case "--samples": self.measurement.sampleCount = number(for: argument, Int.self)
+				case "--sample-time": self.measurement.minimumSampleTime_ns = UInt64(number(for: argument, Double.self) * 1_000_000)
+				case "--output": self.outputPath = value(for: argument)
+				case "--compare": self.comparePath = value(for: argument)
+				case "--threshold": self.thresholdPercent = number(for: argument, Double.self)
+				case "--help", "-h":
+					print(usage)
+					exit(0)
+				default:
+					exitWithUsageError("unknown option “\(argument)”")
+			}
+		}
+		
+		if self.elementCount < 1 { exitWithUsageError("--count must be at least 1") }
+		if self.measurement.sampleCount < 1 { exitWithUsageError("--samples must be at least 1") }
+	}
+}
+
+
+
+let options = Options(arguments: Array(CommandLine.arguments.dropFirst()))
+
+var suite = BenchmarkSuite(fixtures: Fixtures(count: options.elementCount))
+suite.addInt2Benchmarks()
+suite.addInt3Benchmarks()
+suite.addInt4Benchmarks()
+suite.addFloat2Benchmarks()
+suite.addFloat3Benchmarks()
+suite.addFloat4Benchmarks()
+suite.addFloatQuaternionBenchmarks()
+suite.addFloat3x3Benchmarks()
+suite.addFloat4x4Benchmarks()
+suite.addFloat4x3Benchmarks()
+
+let benchmarks = suite.benchmarks.filter{ benchmark in
+	options.filters.isEmpty || options.filters.contains{ benchmark.identifier.contains($0) }
+}
+
+if options.list {
+	benchmarks.forEach{ print($0.identifier) }
+	exit(0)
+}
+
+#if DEBUG
+	printError("warning: this is a debug build; run with `swift run -c release VucktBench` for meaningful numbers.")
+#endif
+
+var baseline:BenchmarkReport?
+if let comparePath = options.comparePath {
+	do {
+		let data = try Data(contentsOf: URL(fileURLWithPath: comparePath))
+		baseline = try JSONDecoder().decode(BenchmarkReport.self, from: data)
+	} catch {
+		printError("error: couldn't read baseline “\(comparePath)”: \(error)")
+		exit(2)
+	}
+}
+
+var results:[BenchmarkResult] = []
+for benchmark in benchmarks {
+	let result = measure(benchmark, options: options.measurement)
+	printError(benchmark.identifier.padding(toLength: 52, withPad: " ", startingAt: 0) + String(format: "  %10.3f ns/op  ±%.3f", result.nanosecondsPerOperation, result.standardDeviation))
+	results.append(result)
+}
+
+var report = BenchmarkReport(
+	backend: BenchmarkReport.currentBackend,
+	platform: BenchmarkReport.currentPlatform,
+	elementCount: options.elementCount,
+	sampleCount: options.measurement.sampleCount,
+	minimumSampleTimeMilliseconds: Double(options.measurement.minimumSampleTime_ns) / 1_000_000,
+	results: results,
+	comparison: nil
+)
+report.relateToSIMDBaselines()
+if let baseline = baseline {
+	report.comparison = BenchmarkComparison(results: report.results, baseline: baseline, baselinePath: options.comparePath!, thresholdPercent: options.thresholdPercent)
+}
+
+let encoder = JSONEncoder()
+if #available(macOS 10.13, iOS 11.0, tvOS 11.0, watchOS 4.0, *) {
+	encoder.outputFormatting = [ .prettyPrinted, .sortedKeys ]
+} else {
+	encoder.outputFormatting = .prettyPrinted
+}
+let json = try! encoder.encode(report)
+if let outputPath = options.outputPath {
+	do {
+		try json.write(to: URL(fileURLWithPath: outputPath))
+	} catch {
+		printError("error: couldn't write “\(outputPath)”: \(error)")
+		exit(2)
+	}
+} else {
+	FileHandle.standardOutput.write(json)
+	FileHandle.standardOutput.write("\n".data(using: .utf8)!)
+}
+
+if let comparison = report.comparison {
+	for entry in comparison.entries where entry.status == .regressed || entry.status == .improved {
+		printError("\(entry.status.rawValue.uppercased())  \(entry.name)/\(entry.implementation.rawValue) " + String(format: "%+.1f%%  (%.3f → %.3f ns/op)", entry.changePercent!, entry.baselineNanosecondsPerOperation!, entry.nanosecondsPerOperation))
+	}
+	printError("\(comparison.regressionCount) regression(s) beyond \(comparison.thresholdPercent)% vs. “\(comparison.baselinePath)”.")
+	exit(comparison.regressionCount > 0 ? 1 : 0)
+}
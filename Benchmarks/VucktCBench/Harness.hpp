@@ -0,0 +1,273 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+	#include <linux/perf_event.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+#define VUCKT_BENCH_ALWAYS_INLINE inline __attribute__((always_inline))
+
+#if defined(__x86_64__) || defined(__i386__)
+	#define VUCKT_BENCH_VECTOR_REGISTER "x"
+#elif defined(__aarch64__) || defined(__arm__)
+	#define VUCKT_BENCH_VECTOR_REGISTER "w"
+#endif
+
+
+
+namespace VucktBench {
+	
+	
+	
+#pragma mark Optimization Barriers
+	
+#if defined(VUCKT_BENCH_VECTOR_REGISTER)
+	typedef float OpaqueChunk __attribute__((vector_size(16)));
+	
+	VUCKT_BENCH_ALWAYS_INLINE void OpaqueChunkValue(OpaqueChunk &chunk)
+	{
+		asm volatile("" : "+" VUCKT_BENCH_VECTOR_REGISTER(chunk));
+	}
+	
+	template <size_t... I>
+	VUCKT_BENCH_ALWAYS_INLINE void OpaqueChunks(OpaqueChunk *chunks, std::index_sequence<I...>)
+	{
+		(OpaqueChunkValue(chunks[I]), ...);
+	}
+#endif
+	
+/// Tells the optimizer `value` may have been read & rewritten here, without moving it out of its register(s) (for types that fit in vector registers).
+/// Applied to a chain's value after every step, this stops the compiler from folding steps together (e.g. `-(-x)` → `x`, or `x + b + b` → `x + 2b`), hoisting work out of the loop, or discarding unused results, at no runtime cost.
+template <typename T>
+VUCKT_BENCH_ALWAYS_INLINE void Opaque(T &value)
+{
+#if defined(VUCKT_BENCH_VECTOR_REGISTER)
+	if constexpr (sizeof(T) % 16 == 0) {
+		OpaqueChunk chunks[sizeof(T) / 16];
+		std::memcpy(chunks, &value, sizeof(T));
+		OpaqueChunks(chunks, std::make_index_sequence<sizeof(T) / 16>());
+		std::memcpy(&value, chunks, sizeof(T));
+		return;
+	}
+	else if constexpr (sizeof(T) == 8 && !std::is_integral_v<T>) {
+		double chunk;
+		std::memcpy(&chunk, &value, sizeof(T));
+		asm volatile("" : "+" VUCKT_BENCH_VECTOR_REGISTER(chunk));
+		std::memcpy(&value, &chunk, sizeof(T));
+		return;
+	}
+	else if constexpr (std::is_same_v<T, float>) {
+		asm volatile("" : "+" VUCKT_BENCH_VECTOR_REGISTER(value));
+		return;
+	}
+#endif
+	if constexpr (std::is_integral_v<T>) {
+		asm volatile("" : "+r"(value));
+	} else {
+		asm volatile("" : "+m"(value));
+	}
+}
+	
+/// Tells the optimizer all memory (e.g. an output array) may have been read here, so the stores before it can't be discarded.
+VUCKT_BENCH_ALWAYS_INLINE void ClobberMemory()
+{
+	asm volatile("" : : : "memory");
+}
+	
+	
+	
+#pragma mark Hardware Counters
+	
+/// Cycle & retired-instruction counters for the calling thread, via Linux's `perf_event_open(2)`.
+/// Unavailable (`isAvailable() == false`) on other platforms, & wherever the kernel refuses (e.g. `perf_event_paranoid` > 2, or most containers); the harness then reports time only.
+class HardwareCounters
+{
+public:
+	struct Reading {
+		uint64_t cycles = 0;
+		uint64_t instructions = 0;
+	};
+		
+	HardwareCounters()
+	{
+	#if defined(__linux__)
+		_cyclesFD = open(PERF_COUNT_HW_CPU_CYCLES, -1);
+		if (_cyclesFD >= 0) {
+			_instructionsFD = open(PERF_COUNT_HW_INSTRUCTIONS, _cyclesFD);
+			if (_instructionsFD < 0) {
+				close(_cyclesFD);
+				_cyclesFD = -1;
+			}
+		}
+	#endif
+	}
+	~HardwareCounters()
+	{
+	#if defined(__linux__)
+		if (_instructionsFD >= 0) close(_instructionsFD);
+		if (_cyclesFD >= 0) close(_cyclesFD);
+	#endif
+	}
+	HardwareCounters(const HardwareCounters &) = delete;
+	HardwareCounters &operator=(const HardwareCounters &) = delete;
+		
+	bool isAvailable() const { return _cyclesFD >= 0; }
+		
+	void start()
+	{
+	#if defined(__linux__)
+		if (!isAvailable()) return;
+		ioctl(_cyclesFD, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(_cyclesFD, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	#endif
+	}
+	Reading stop()
+	{
+		Reading reading;
+	#if defined(__linux__)
+		if (!isAvailable()) return reading;
+		ioctl(_cyclesFD, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+		// `PERF_FORMAT_GROUP` layout: the event count, then each event's value, leader first.
+		uint64_t values[3] = {};
+		if (read(_cyclesFD, values, sizeof(values)) == (ssize_t)sizeof(values)) {
+			reading.cycles = values[1];
+			reading.instructions = values[2];
+		}
+	#endif
+		return reading;
+	}
+		
+private:
+	int _cyclesFD = -1;
+	int _instructionsFD = -1;
+		
+#if defined(__linux__)
+	static int open(uint64_t config, int groupFD)
+	{
+		perf_event_attr attributes;
+		std::memset(&attributes, 0, sizeof(attributes));
+		attributes.type = PERF_TYPE_HARDWARE;
+		attributes.size = sizeof(attributes);
+		attributes.config = config;
+		attributes.disabled = (groupFD == -1);
+		attributes.exclude_kernel = 1;
+		attributes.exclude_hv = 1;
+		attributes.read_format = PERF_FORMAT_GROUP;
+		return (int)syscall(SYS_perf_event_open, &attributes, 0, -1, groupFD, 0);
+	}
+#endif
+};
+	
+	
+	
+#pragma mark Measurement
+	
+struct Options {
+	std::vector<std::string> filters;
+	double minimumSampleTime_ms = 20;
+	int sampleCount = 5;
+	bool json = false;
+};
+	
+/// The fastest of a benchmark's samples (the one least disturbed by interrupts, frequency ramps, etc.), per operation.
+struct Measurement {
+	double nanoseconds = 0;
+	double cycles = -1; ///< -1 when hardware counters are unavailable.
+	double instructions = -1;
+};
+	
+/// Runs `body(iterationCount)` (which must perform `operationsPerIteration × iterationCount` operations), growing `iterationCount` until a run takes `options.minimumSampleTime_ms`, then keeps the fastest of `options.sampleCount` runs.
+template <typename Body>
+Measurement Measure(const Options &options, HardwareCounters &counters, size_t operationsPerIteration, Body body)
+{
+	using Clock = std::chrono::steady_clock;
+	const double minimumSampleTime_ns = options.minimumSampleTime_ms * 1e6;
+		
+	size_t iterationCount = 1;
+	body(iterationCount);
+	while (true) {
+		auto start = Clock::now();
+		body(iterationCount);
+		double elapsed_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+		if (elapsed_ns >= minimumSampleTime_ns || iterationCount >= ((size_t)1 << 40)) break;
+		double scale = minimumSampleTime_ns / std::max(elapsed_ns, 1.0);
+		iterationCount = (size_t)((double)iterationCount * std::clamp(scale * 1.1, 2.0, 1000.0));
+	}
+		
+	const double operationCount = (double)iterationCount * (double)operationsPerIteration;
+	Measurement best;
+	best.nanoseconds = INFINITY;
+	for (int sampleI = 0; sampleI < options.sampleCount; ++sampleI) {
+		counters.start();
+		auto start = Clock::now();
+		body(iterationCount);
+		double elapsed_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+		HardwareCounters::Reading reading = counters.stop();
+		if (elapsed_ns / operationCount < best.nanoseconds) {
+			best.nanoseconds = elapsed_ns / operationCount;
+			if (counters.isAvailable()) {
+				best.cycles = (double)reading.cycles / operationCount;
+				best.instructions = (double)reading.instructions / operationCount;
+			}
+		}
+	}
+	return best;
+}
+	
+	
+	
+#pragma mark Chains
+	
+/// The number of independent chains interleaved for the throughput measurement: enough to cover the latency of most vector ops, without spilling `T` out of the (16) vector registers.
+template <typename T>
+constexpr size_t ThroughputLaneCount = std::clamp<size_t>(128 / sizeof(T), 2, 8);
+	
+/// Latency: `x = step(x, operand)`, each step waiting on the last.
+template <typename T, typename Operand, typename Step>
+VUCKT_BENCH_ALWAYS_INLINE void RunDependentChain(T x, Operand operand, Step step, size_t iterationCount)
+{
+	Opaque(x);
+	for (size_t i = 0; i < iterationCount; ++i) {
+		Opaque(operand);
+		x = step(x, operand);
+		Opaque(x);
+	}
+}
+	
+template <typename T, typename Operand, typename Step, size_t... Lane>
+VUCKT_BENCH_ALWAYS_INLINE void RunIndependentChains(T x, Operand operand, Step step, size_t iterationCount, std::index_sequence<Lane...>)
+{
+	T lanes[] = { ((void)Lane, x)... };
+	(Opaque(lanes[Lane]), ...);
+	for (size_t i = 0; i < iterationCount; ++i) {
+		Opaque(operand);
+		((lanes[Lane] = step(lanes[Lane], operand), Opaque(lanes[Lane])), ...);
+	}
+}
+	
+/// Throughput: `ThroughputLaneCount<T>` independent copies of the chain, stepped in lockstep so the CPU can overlap them.
+template <typename T, typename Operand, typename Step>
+VUCKT_BENCH_ALWAYS_INLINE void RunIndependentChains(T x, Operand operand, Step step, size_t iterationCount)
+{
+	RunIndependentChains(x, operand, step, iterationCount, std::make_index_sequence<ThroughputLaneCount<T>>());
+}
+	
+	
+	
+} // namespace VucktBench
@@ -0,0 +1,1102 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+// Micro-benchmarks for the `NS_INLINE` C functions in Vuckt's headers, measuring each op's latency (one dependent chain) & throughput (several independent chains), plus cycles & instructions per op where Linux's `perf_event_open(2)` is permitted.
+// Build & run either via SwiftPM:
+//     swift run -c release VucktCBench
+// or directly:
+//     c++ -std=c++17 -O2 -march=native -ffp-contract=off Benchmarks/VucktCBench/main.cpp -o vuckt-cbench && ./vuckt-cbench
+// (`-ffp-contract=off` matters to GCC only, which otherwise fuses the `VUCKT_NO_FP_CONTRACT` kernels' multiplies & adds anyway; see `Ray3IntersectTriangle()`.)
+//
+// Each chain benchmark repeats `x = step(x, operand)`, where `step` is the op under test.  Ops whose result isn't the same type as `x` (comparisons, outer products, conversions) fold their result back into `x` with the cheapest step that keeps the dependency (a lane insert, a select, or a column reinterpret), which is included in their numbers.
+// Operands are identities (0 for add, 1 for multiply/divide, etc.) or otherwise chosen to keep millions of steps finite & normal; the `Opaque()` barriers keep the compiler from knowing that.
+
+// GCC (without AVX) issues the `double` vector types' `-Wpsabi` warning at this file's first call returning each such type— outside the headers' `VUCKT_DIAGNOSTICS_BEGIN`/`END`— so this file silences it ahead of the includes; nothing here passes those types across a translation unit.
+// (GCC's one-time note that passing a 32-byte-aligned `Double3` by value changed ABI in GCC 4.6 isn't a diagnostic any pragma reaches; build with `-Wno-psabi` to drop it, or with AVX, where it doesn't apply.)
+#if __GNUC__ && !__clang__
+	#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+#include "Harness.hpp"
+
+#include "../../Sources/Int2/Int2.h"
+#include "../../Sources/Int3/Int3.h"
+#include "../../Sources/Int4/Int4.h"
+#include "../../Sources/Float2/Float2.h"
+#include "../../Sources/Float3/Float3.h"
+#include "../../Sources/Float4/Float4.h"
+#include "../../Sources/FloatQuaternion/FloatQuaternion.h"
+#include "../../Sources/Float3x3/Float3x3.h"
+#include "../../Sources/Float4x4/Float4x4.h"
+#include "../../Sources/Float4x3/Float4x3.h"
+#include "../../Sources/PackedFloat3/PackedFloat3.h"
+#include "../../Sources/UChar4/UChar4.h"
+#include "../../Sources/Short4/Short4.h"
+#include "../../Sources/Half3/Half3.h"
+#include "../../Sources/Half4/Half4.h"
+#include "../../Sources/Double3/Double3.h"
+#include "../../Sources/Double4x4/Double4x4.h"
+#include "../../Sources/AABB3/AABB3.h"
+#include "../../Sources/Frustum/Frustum.h"
+#include "../../Sources/Ray3/Ray3.h"
+#include "../../Sources/BVH/BVH.h"
+#include "../../Sources/BulkCodec/BulkCodec.h"
+#include "../../Sources/Curve/Curve.h"
+#include "../../Sources/Parallel/Parallel.hpp"
+#include "../../Sources/Vuckt.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+using namespace VucktBench;
+
+
+
+#pragma mark 3-Lane Barriers
+
+// Where `simd_float3` is really a 4-lane vector (GCC; see `VUCKT_SIMD3_IS_SIMD4`), a 3-lane struct's padding lane is left undefined by the ops, so barrier just the payload lanes (via the same conversions the ops use) rather than the raw 16 bytes, which would bounce through memory & stall store-forwarding.
+// (Found by `Harness.hpp`'s chain runners through argument-dependent lookup.)
+
+VUCKT_BENCH_ALWAYS_INLINE void Opaque(Float3 &v)
+{
+	simd_float3 simdValue = Float3ToSimd(v);
+	VucktBench::Opaque(simdValue);
+	v = Float3FromSimd(simdValue);
+}
+
+VUCKT_BENCH_ALWAYS_INLINE void Opaque(Int3 &v)
+{
+	simd_int3 simdValue = Int3ToSimd(v);
+	VucktBench::Opaque(simdValue);
+	v = Int3FromSimd(simdValue);
+}
+
+VUCKT_BENCH_ALWAYS_INLINE void Opaque(Float3x3 &m)
+{
+	Float3 c0 = { m.m00, m.m01, m.m02 }, c1 = { m.m10, m.m11, m.m12 }, c2 = { m.m20, m.m21, m.m22 };
+	Opaque(c0), Opaque(c1), Opaque(c2);
+	m = Float3x3{
+		c0.x, c0.y, c0.z,
+		c1.x, c1.y, c1.z,
+		c2.x, c2.y, c2.z,
+	};
+}
+
+
+
+#pragma mark Values
+
+/// A vector with each of its lanes (padding included) set to `s`.
+template <typename V, typename S>
+static V Splat(S s)
+{
+	V v;
+	for (size_t laneI = 0; laneI < sizeof(V) / sizeof(S); ++laneI)
+		std::memcpy((char *)&v + laneI * sizeof(S), &s, sizeof(S));
+	return v;
+}
+
+/// A vector with lanes `start`, `start + step`, `start + 2·step`, ….
+template <typename V, typename S>
+static V Ramp(S start, S step)
+{
+	V v;
+	for (size_t laneI = 0; laneI < sizeof(V) / sizeof(S); ++laneI) {
+		S s = start + step * (S)laneI;
+		std::memcpy((char *)&v + laneI * sizeof(S), &s, sizeof(S));
+	}
+	return v;
+}
+
+/// Folds a comparison's result back into `x`.
+template <typename V>
+VUCKT_BENCH_ALWAYS_INLINE V FeedBack(V x, bool result)
+{
+	x.x = result ? x.y : x.x;
+	return x;
+}
+
+/// Folds a matrix result back into a vector `x` by reinterpreting the matrix's column 0.
+template <typename V, typename M>
+VUCKT_BENCH_ALWAYS_INLINE V Column0(M m)
+{
+	static_assert(sizeof(V) <= sizeof(M), "column must fit within the matrix");
+	V column;
+	std::memcpy(&column, &m, sizeof(V));
+	return column;
+}
+
+static Float4x3 MakeTransform()
+{
+	const FloatQuaternion rotation = { 0.2f, 0.4f, 0.4f, 0.8f }; // unit length
+	return Float4x3FromScaleRotationTranslation(Float3{ 1, 1, 1 }, rotation, Float3{ 3, -4, 5 });
+}
+
+
+
+#pragma mark Runner
+
+/// What a stream's ns/op is also reported as, for benchmarks whose natural unit isn't a per-element time.
+enum class StreamRate {
+	none,
+	/// A build's milliseconds per million primitives (numerically its ns per primitive).
+	millisecondsPerMillionPrimitives,
+	/// Queries per second (10⁹ ÷ ns per query).
+	queriesPerSecond,
+};
+
+struct Result {
+	std::string name;
+	/// `chains` for latency+throughput chains, or `stream` for array functions (throughput only).
+	const char *kind;
+	size_t chainCount;
+	Measurement latency;
+	Measurement throughput;
+	/// The bytes each operation moves, for reporting a stream's bandwidth (0 where it's not reported).
+	size_t bytesPerOperation;
+	StreamRate rate;
+};
+
+class Runner
+{
+public:
+	explicit Runner(const Options &options) : _options(options) {}
+	
+	bool hasHardwareCounters() const { return _counters.isAvailable(); }
+	const std::vector<Result> &results() const { return _results; }
+	
+	bool isSelected(const char *name) const
+	{
+		if (_options.filters.empty()) return true;
+		for (const std::string &filter : _options.filters)
+			if (std::strstr(name, filter.c_str()) != nullptr) return true;
+		return false;
+	}
+	
+	/// Measures `step`'s latency & throughput, with `x` as the chain's starting value.
+	template <typename T, typename Operand, typename Step>
+	void chain(const char *name, T x, Operand operand, Step step)
+	{
+		if (!isSelected(name)) return;
+		Result result = { name, "chains", ThroughputLaneCount<T>, {}, {}, 0, StreamRate::none };
+		result.latency = Measure(_options, _counters, 1, [&](size_t iterationCount) {
+			RunDependentChain(x, operand, step, iterationCount);
+		});
+		result.throughput = Measure(_options, _counters, ThroughputLaneCount<T>, [&](size_t iterationCount) {
+			RunIndependentChains(x, operand, step, iterationCount);
+		});
+		report(result);
+	}
+	
+	/// Measures `body()`, an array function over `elementCount` elements, per element (& its bandwidth, given the `bytesPerElement` it moves).
+	template <typename Body>
+	void stream(const char *name, size_t elementCount, Body body, size_t bytesPerElement = 0)
+	{
+		stream(name, elementCount, StreamRate::none, body, bytesPerElement);
+	}
+	/// As above, also reporting the per-element time as `rate`.
+	template <typename Body>
+	void stream(const char *name, size_t elementCount, StreamRate rate, Body body, size_t bytesPerElement = 0)
+	{
+		if (!isSelected(name)) return;
+		Result result = { name, "stream", 0, {}, {}, bytesPerElement, rate };
+		result.latency.nanoseconds = -1;
+		result.throughput = Measure(_options, _counters, elementCount, [&](size_t iterationCount) {
+			for (size_t i = 0; i < iterationCount; ++i) {
+				body();
+				ClobberMemory();
+			}
+		});
+		report(result);
+	}
+	
+private:
+	const Options &_options;
+	HardwareCounters _counters;
+	std::vector<Result> _results;
+	
+	void report(const Result &result)
+	{
+		if (!_options.json)
+			printRow(result);
+		_results.push_back(result);
+	}
+	
+	static void printMeasurement(const Measurement &measurement)
+	{
+		if (measurement.nanoseconds < 0) { std::printf("  %9s %8s", "-", "-"); return; }
+		std::printf("  %9.3f", measurement.nanoseconds);
+		if (measurement.cycles >= 0) std::printf(" %8.2f", measurement.cycles);
+		else std::printf(" %8s", "n/a");
+	}
+	
+	static void printRow(const Result &result)
+	{
+		std::printf("%-44s", result.name.c_str());
+		printMeasurement(result.latency);
+		printMeasurement(result.throughput);
+		const Measurement &throughput = result.throughput;
+		if (throughput.instructions >= 0) std::printf(" %9.2f %6.2f", throughput.instructions, (throughput.cycles > 0) ? throughput.instructions / throughput.cycles : 0);
+		else std::printf(" %9s %6s", "n/a", "n/a");
+		if (result.chainCount > 0) std::printf("  %zu chains\n", result.chainCount);
+		else if (result.rate == StreamRate::millisecondsPerMillionPrimitives) std::printf("  stream, %.1f ms per 1M primitives\n", throughput.nanoseconds);
+		else if (result.rate == StreamRate::queriesPerSecond) std::printf("  stream, %.3fM queries/s\n", 1e3 / throughput.nanoseconds);
+		else if (result.bytesPerOperation > 0) std::printf("  stream, %.2f GB/s\n", (double)result.bytesPerOperation / throughput.nanoseconds);
+		else std::printf("  stream\n");
+		std::fflush(stdout);
+	}
+	
+public:
+	static void printHeader(bool hasHardwareCounters)
+	{
+		std::printf("%-44s  %18s  %18s %16s\n", "", "latency", "throughput", "");
+		std::printf("%-44s  %9s %8s  %9s %8s %9s %6s\n", "benchmark", "ns/op", "cyc/op", "ns/op", "cyc/op", "instr/op", "IPC");
+		if (!hasHardwareCounters)
+			std::printf("(hardware counters unavailable: perf_event_open not permitted or not supported here; reporting time only)\n");
+	}
+};
+
+
+
+#pragma mark Vector Benchmarks
+
+/// The per-lane ops shared by every `Int*`/`Float*` vector type.  (`…ModulusingScalar` is omitted: `s % x` can't be chained without eventually reaching `s % 0`.)
+#define VUCKT_BENCH_VECTOR_CHAINS(runner, T, S, bigS) \
+	do { \
+		const T seed = Ramp<T, S>(3, 2); \
+		const T zeros = Splat<T, S>(0), ones = Splat<T, S>(1), bigs = Splat<T, S>(bigS); \
+		runner.chain(#T "ToSimd+" #T "FromSimd", seed, 0, [](T x, int) { return T##FromSimd(T##ToSimd(x)); }); \
+		runner.chain(#T "Add", seed, zeros, [](T x, T b) { return T##Add(x, b); }); \
+		runner.chain(#T "Subtract", seed, zeros, [](T x, T b) { return T##Subtract(x, b); }); \
+		runner.chain(#T "Negate", seed, 0, [](T x, int) { return T##Negate(x); }); \
+		runner.chain(#T "Multiply", seed, ones, [](T x, T b) { return T##Multiply(x, b); }); \
+		runner.chain(#T "Divide", seed, ones, [](T x, T b) { return T##Divide(x, b); }); \
+		runner.chain(#T "Modulus", seed, bigs, [](T x, T b) { return T##Modulus(x, b); }); \
+		runner.chain(#T "MultiplyByScalar", seed, (S)1, [](T x, S s) { return T##MultiplyByScalar(x, s); }); \
+		runner.chain(#T "MultiplyingScalar", seed, (S)1, [](T x, S s) { return T##MultiplyingScalar(s, x); }); \
+		runner.chain(#T "DivideByScalar", seed, (S)1, [](T x, S s) { return T##DivideByScalar(x, s); }); \
+		runner.chain(#T "DividingScalar", ones, (S)1, [](T x, S s) { return T##DividingScalar(s, x); }); \
+		runner.chain(#T "ModulusByScalar", seed, (S)(bigS), [](T x, S s) { return T##ModulusByScalar(x, s); }); \
+		runner.chain(#T "LessThan", seed, bigs, [](T x, T b) { return FeedBack(x, T##LessThan(x, b)); }); \
+		runner.chain(#T "LessThanOrEqual", seed, bigs, [](T x, T b) { return FeedBack(x, T##LessThanOrEqual(x, b)); }); \
+		runner.chain(#T "GreaterThan", seed, zeros, [](T x, T b) { return FeedBack(x, T##GreaterThan(x, b)); }); \
+		runner.chain(#T "GreaterThanOrEqual", seed, zeros, [](T x, T b) { return FeedBack(x, T##GreaterThanOrEqual(x, b)); }); \
+	} while (0)
+
+static void RunVectorBenchmarks(Runner &runner)
+{
+	VUCKT_BENCH_VECTOR_CHAINS(runner, Int2, int, 1 << 20);
+	VUCKT_BENCH_VECTOR_CHAINS(runner, Int3, int, 1 << 20);
+	VUCKT_BENCH_VECTOR_CHAINS(runner, Int4, int, 1 << 20);
+	VUCKT_BENCH_VECTOR_CHAINS(runner, Float2, float, 1e6f);
+	VUCKT_BENCH_VECTOR_CHAINS(runner, Float3, float, 1e6f);
+	VUCKT_BENCH_VECTOR_CHAINS(runner, Float4, float, 1e6f);
+	
+	// A unit `b` keeps `a ∧ b` at a constant length (after the first step it just rotates `a` 90° about `b`).
+	runner.chain("Float3WedgeProduct", Ramp<Float3, float>(3, 2), Float3{ 0, 0.6f, 0.8f }, [](Float3 x, Float3 b) { return Float3WedgeProduct(x, b); });
+	runner.chain("PackedFloat3FromFloat3+PackedFloat3ToFloat3", Ramp<Float3, float>(3, 2), 0, [](Float3 x, int) {
+		return PackedFloat3ToFloat3(PackedFloat3FromFloat3(x));
+	});
+	runner.chain("FloatQuaternionToSimd+FloatQuaternionFromSimd", FloatQuaternion{ 0.2f, 0.4f, 0.4f, 0.8f }, 0, [](FloatQuaternion x, int) {
+		return FloatQuaternionFromSimd(FloatQuaternionToSimd(x));
+	});
+}
+
+static void RunVectorStreamBenchmarks(Runner &runner, size_t n)
+{
+	std::vector<Float3> float3A(n, Ramp<Float3, float>(3, 2)), float3B(n, Splat<Float3, float>(0.5f)), float3Out(n);
+	std::vector<Float4> float4A(n, Ramp<Float4, float>(3, 2)), float4B(n, Splat<Float4, float>(0.5f)), float4Out(n);
+	std::vector<Int3> int3A(n, Ramp<Int3, int>(3, 2)), int3B(n, Splat<Int3, int>(7)), int3Out(n);
+	std::vector<PackedFloat3> packed(n, PackedFloat3FromFloat3(Ramp<Float3, float>(3, 2)));
+	
+	runner.stream("Float3AddArrays", n, [&] { Float3AddArrays(float3A.data(), float3B.data(), float3Out.data(), n); });
+	runner.stream("Float3MultiplyArrays", n, [&] { Float3MultiplyArrays(float3A.data(), float3B.data(), float3Out.data(), n); });
+	runner.stream("Float3MultiplyByScalarArray", n, [&] { Float3MultiplyByScalarArray(float3A.data(), 0.5f, float3Out.data(), n); });
+	runner.stream("Float3DivideArrays", n, [&] { Float3DivideArrays(float3A.data(), float3B.data(), float3Out.data(), n); });
+	runner.stream("Float4AddArrays", n, [&] { Float4AddArrays(float4A.data(), float4B.data(), float4Out.data(), n); });
+	runner.stream("Int3AddArrays", n, [&] { Int3AddArrays(int3A.data(), int3B.data(), int3Out.data(), n); });
+	runner.stream("Int3ModulusArrays", n, [&] { Int3ModulusArrays(int3A.data(), int3B.data(), int3Out.data(), n); });
+	runner.stream("PackedFloat3ArrayToFloat3Array", n, [&] { PackedFloat3ArrayToFloat3Array(packed.data(), float3Out.data(), n); });
+	runner.stream("PackedFloat3ArrayFromFloat3Array", n, [&] { PackedFloat3ArrayFromFloat3Array(float3A.data(), packed.data(), n); });
+}
+
+
+
+#pragma mark Integer Overflow Benchmarks
+
+/// Each `…ReportingOverflow` chain folds its overflow mask back in with a wrapping add (so the mask isn't dead code); `Int4AddReportingOverflow.reference` is the lane-at-a-time `__builtin_add_overflow()` equivalent, for the speed-up.
+#define VUCKT_BENCH_OVERFLOW_CHAINS(runner, T) \
+	do { \
+		const T seed = Ramp<T, int>(3, 2); \
+		const T zeros = Splat<T, int>(0), ones = Splat<T, int>(1); \
+		runner.chain(#T "AddWrapping", seed, zeros, [](T x, T b) { return T##AddWrapping(x, b); }); \
+		runner.chain(#T "SubtractWrapping", seed, zeros, [](T x, T b) { return T##SubtractWrapping(x, b); }); \
+		runner.chain(#T "MultiplyWrapping", seed, ones, [](T x, T b) { return T##MultiplyWrapping(x, b); }); \
+		runner.chain(#T "AddReportingOverflow", seed, zeros, [](T x, T b) { T overflowMask; T r = T##AddReportingOverflow(x, b, &overflowMask); return T##AddWrapping(r, overflowMask); }); \
+		runner.chain(#T "SubtractReportingOverflow", seed, zeros, [](T x, T b) { T overflowMask; T r = T##SubtractReportingOverflow(x, b, &overflowMask); return T##AddWrapping(r, overflowMask); }); \
+		runner.chain(#T "MultiplyReportingOverflow", seed, ones, [](T x, T b) { T overflowMask; T r = T##MultiplyReportingOverflow(x, b, &overflowMask); return T##AddWrapping(r, overflowMask); }); \
+		runner.chain(#T "AddSaturated", seed, zeros, [](T x, T b) { return T##AddSaturated(x, b); }); \
+		runner.chain(#T "SubtractSaturated", seed, zeros, [](T x, T b) { return T##SubtractSaturated(x, b); }); \
+		runner.chain(#T "MultiplySaturated", seed, ones, [](T x, T b) { return T##MultiplySaturated(x, b); }); \
+	} while (0)
+
+VUCKT_BENCH_ALWAYS_INLINE Int4 Int4ReferenceAddReportingOverflow(Int4 a, Int4 b, Int4 *outOverflowMask)
+{
+	Int4 sum;
+	outOverflowMask->x = __builtin_add_overflow(a.x, b.x, &sum.x) ? -1 : 0;
+	outOverflowMask->y = __builtin_add_overflow(a.y, b.y, &sum.y) ? -1 : 0;
+	outOverflowMask->z = __builtin_add_overflow(a.z, b.z, &sum.z) ? -1 : 0;
+	outOverflowMask->w = __builtin_add_overflow(a.w, b.w, &sum.w) ? -1 : 0;
+	return sum;
+}
+
+static void RunIntegerOverflowBenchmarks(Runner &runner)
+{
+	VUCKT_BENCH_OVERFLOW_CHAINS(runner, Int2);
+	VUCKT_BENCH_OVERFLOW_CHAINS(runner, Int3);
+	VUCKT_BENCH_OVERFLOW_CHAINS(runner, Int4);
+	runner.chain("Int4AddReportingOverflow.reference", Ramp<Int4, int>(3, 2), Splat<Int4, int>(0), [](Int4 x, Int4 b) {
+		Int4 overflowMask;
+		Int4 r = Int4ReferenceAddReportingOverflow(x, b, &overflowMask);
+		return Int4AddWrapping(r, overflowMask);
+	});
+}
+
+
+
+#pragma mark Narrow Integer Conversion Benchmarks
+
+/// `UChar4ArrayFromFloat4ArrayNormalized.reference` is the lane-at-a-time `fminf()`/`fmaxf()`/`lrintf()` equivalent, for the speed-up.
+static void UChar4ArrayFromFloat4ArrayNormalizedReference(const Float4 *values, UChar4 *out, size_t n)
+{
+	for (size_t i = 0; i < n; ++i) {
+		const float *lanes = &values[i].x;
+		unsigned char *outLanes = &out[i].x;
+		for (int laneI = 0; laneI < 4; ++laneI)
+			outLanes[laneI] = (unsigned char)lrintf(fminf(fmaxf(lanes[laneI], 0.0f), 1.0f) * 255.0f);
+	}
+}
+
+static void RunNarrowIntegerStreamBenchmarks(Runner &runner, size_t n)
+{
+	std::vector<Int4> int4A(n, Ramp<Int4, int>(-300, 211)), int4Out(n);
+	std::vector<Float4> float4A(n, Ramp<Float4, float>(-0.25f, 0.5f)), float4Out(n);
+	std::vector<UChar4> uchar4A(n, UChar4FromFloat4Normalized(Ramp<Float4, float>(0.1f, 0.25f)));
+	std::vector<Short4> short4A(n, Short4FromInt4Saturating(Ramp<Int4, int>(-300, 211)));
+	
+	runner.stream("UChar4ArrayToInt4Array", n, [&] { UChar4ArrayToInt4Array(uchar4A.data(), int4Out.data(), n); });
+	runner.stream("UChar4ArrayFromInt4ArrayTruncating", n, [&] { UChar4ArrayFromInt4ArrayTruncating(int4A.data(), uchar4A.data(), n); });
+	runner.stream("UChar4ArrayFromInt4ArraySaturating", n, [&] { UChar4ArrayFromInt4ArraySaturating(int4A.data(), uchar4A.data(), n); });
+	runner.stream("UChar4ArrayToFloat4ArrayNormalized", n, [&] { UChar4ArrayToFloat4ArrayNormalized(uchar4A.data(), float4Out.data(), n); });
+	runner.stream("UChar4ArrayFromFloat4ArrayNormalized", n, [&] { UChar4ArrayFromFloat4ArrayNormalized(float4A.data(), uchar4A.data(), n); });
+	runner.stream("UChar4ArrayFromFloat4ArrayNormalized.reference", n, [&] { UChar4ArrayFromFloat4ArrayNormalizedReference(float4A.data(), uchar4A.data(), n); });
+	runner.stream("Short4ArrayToFloat4ArrayNormalized", n, [&] { Short4ArrayToFloat4ArrayNormalized(short4A.data(), float4Out.data(), n); });
+	runner.stream("Short4ArrayFromFloat4ArrayNormalized", n, [&] { Short4ArrayFromFloat4ArrayNormalized(float4A.data(), short4A.data(), n); });
+	runner.stream("Short4ArrayFromFloat4ArraySaturating", n, [&] { Short4ArrayFromFloat4ArraySaturating(float4A.data(), short4A.data(), n); });
+}
+
+
+
+#pragma mark Half-Precision Conversion Benchmarks
+
+/// `Float4ArrayCopy.reference` moves the same elements kept as `Float4`s (twice the bytes), for comparison with widening from `Half4` storage.
+static void RunHalfStreamBenchmarks(Runner &runner, size_t n)
+{
+	std::vector<Float4> float4A(n, Ramp<Float4, float>(-0.25f, 0.5f)), float4Out(n);
+	std::vector<Float3> float3A(n, Ramp<Float3, float>(-0.25f, 0.5f)), float3Out(n);
+	std::vector<Half4> half4A(n, Half4FromFloat4(Ramp<Float4, float>(-0.25f, 0.5f)));
+	std::vector<Half3> half3A(n, Half3FromFloat3(Ramp<Float3, float>(-0.25f, 0.5f)));
+	
+	runner.stream("Half4ArrayToFloat4Array", n, [&] { Half4ArrayToFloat4Array(half4A.data(), float4Out.data(), n); });
+	runner.stream("Float4ArrayCopy.reference", n, [&] { std::memcpy(float4Out.data(), float4A.data(), n * sizeof(Float4)); });
+	runner.stream("Half4ArrayFromFloat4Array", n, [&] { Half4ArrayFromFloat4Array(float4A.data(), half4A.data(), n); });
+	runner.stream("Half4ArrayFromFloat4ArrayTowardZero", n, [&] { Half4ArrayFromFloat4ArrayTowardZero(float4A.data(), half4A.data(), n); });
+	runner.stream("Half3ArrayToFloat3Array", n, [&] { Half3ArrayToFloat3Array(half3A.data(), float3Out.data(), n); });
+	runner.stream("Half3ArrayFromFloat3Array", n, [&] { Half3ArrayFromFloat3Array(float3A.data(), half3A.data(), n); });
+}
+
+
+
+#pragma mark Double-Precision Rebasing Benchmarks
+
+/// The `.reference`s are the element-at-a-time compositions of the struct functions (`Double3Subtract()` then `Double3ToFloat3()`, & `Double4x4RebaseToFloat4x4()` per matrix), for the speed-up.
+static void Double3RebaseArrayToFloat3ArrayReference(const Double3 *points, Double3 origin, Float3 *out, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		out[i] = Double3ToFloat3(Double3Subtract(points[i], origin));
+}
+
+static void Double4x4RebaseArrayToFloat4x4ArrayReference(const Double4x4 *matrices, Double3 origin, Float4x4 *out, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		out[i] = Double4x4RebaseToFloat4x4(matrices[i], origin);
+}
+
+static void RunDoubleStreamBenchmarks(Runner &runner, size_t n)
+{
+	const Double3 origin = { 1e7, -2e7, 3e7 };
+	std::vector<Double3> double3A(n, Double3Add(origin, Ramp<Double3, double>(3, 2))), double3Out(n);
+	std::vector<Float3> float3A(n, Ramp<Float3, float>(3, 2)), float3Out(n);
+	std::vector<PackedFloat3> packedOut(n);
+	std::vector<Double4x4> double4x4A(n, Double4x4FromFloat4x4(Float4x3ToFloat4x4(MakeTransform())));
+	std::vector<Float4x4> float4x4Out(n);
+	for (Double4x4 &m : double4x4A) {
+		m.m30 += origin.x, m.m31 += origin.y, m.m32 += origin.z;
+	}
+	
+	runner.stream("Double3ArrayToFloat3Array", n, [&] { Double3ArrayToFloat3Array(double3A.data(), float3Out.data(), n); });
+	runner.stream("Double3ArrayFromFloat3Array", n, [&] { Double3ArrayFromFloat3Array(float3A.data(), double3Out.data(), n); });
+	runner.stream("Double3RebaseArrayToFloat3Array", n, [&] { Double3RebaseArrayToFloat3Array(double3A.data(), origin, float3Out.data(), n); });
+	runner.stream("Double3RebaseArrayToFloat3Array.reference", n, [&] { Double3RebaseArrayToFloat3ArrayReference(double3A.data(), origin, float3Out.data(), n); });
+	runner.stream("Double3RebaseArrayToPackedFloat3Array", n, [&] { Double3RebaseArrayToPackedFloat3Array(double3A.data(), origin, packedOut.data(), n); });
+	runner.stream("Double4x4RebaseArrayToFloat4x4Array", n, [&] { Double4x4RebaseArrayToFloat4x4Array(double4x4A.data(), origin, float4x4Out.data(), n); });
+	runner.stream("Double4x4RebaseArrayToFloat4x4Array.reference", n, [&] { Double4x4RebaseArrayToFloat4x4ArrayReference(double4x4A.data(), origin, float4x4Out.data(), n); });
+}
+
+
+
+#pragma mark Bounds & Culling Benchmarks
+
+/// The `.reference` is the box-at-a-time, plane-at-a-time test (bailing out at the first plane the box is outside), for the speed-up.
+static size_t FrustumCullAABB3ArrayToIndicesReference(Frustum frustum, const AABB3 *boxes, uint32_t *outVisibleIndices, size_t n)
+{
+	const Float4 planes[6] = { frustum.left, frustum.right, frustum.bottom, frustum.top, frustum.near, frustum.far };
+	size_t visibleCount = 0;
+	for (size_t i = 0; i < n; ++i) {
+		Float3 center = AABB3Center(boxes[i]), extents = AABB3Extents(boxes[i]);
+		bool outside = false;
+		for (size_t planeI = 0; planeI < 6 && !outside; ++planeI) {
+			Float4 plane = planes[planeI];
+			float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+			float radius = fabsf(plane.x) * extents.x + fabsf(plane.y) * extents.y + fabsf(plane.z) * extents.z;
+			outside = (distance < -radius);
+		}
+		if (!outside)
+			outVisibleIndices[visibleCount++] = (uint32_t)i;
+	}
+	return visibleCount;
+}
+
+static void RunBoundsStreamBenchmarks(Runner &runner, size_t n)
+{
+	// Unit-ish boxes scattered through a 200-unit cube around a 90°-FOV camera (near 1, far 100) looking down -z, so roughly a quarter land inside, a few straddle, & the rest are outside.
+	const float near = 1, far = 100;
+	const Float4x4 projection = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, far / (near - far), -1, 0, 0, near * far / (near - far), 0 };
+	const Frustum frustum = FrustumFromViewProjection(projection, true);
+	std::vector<AABB3> boxes(n), boxesOut(n);
+	uint32_t state = 1;
+	auto nextCoordinate = [&state] { state = state * 1664525u + 1013904223u; return (float)(state >> 8) / (float)(1u << 24) * 200 - 100; };
+	for (AABB3 &box : boxes) {
+		float x = nextCoordinate(), y = nextCoordinate(), z = nextCoordinate();
+		box = AABB3FromCenterExtents(Float3{ x, y, z }, Float3{ 0.5f, 1, 1.5f });
+	}
+	std::vector<uint8_t> codes(n), visibleBits((n + 7) / 8);
+	std::vector<uint32_t> visibleIndices(n);
+	
+	runner.stream("AABB3TransformArray", n, [&] { AABB3TransformArray(boxes.data(), Float4x3ToFloat4x4(MakeTransform()), boxesOut.data(), n); });
+	runner.stream("AABB3MergeArray", n, [&] { boxesOut[0] = AABB3MergeArray(boxes.data(), n); });
+	runner.stream("FrustumClassifyAABB3Array", n, [&] { FrustumClassifyAABB3Array(frustum, boxes.data(), codes.data(), n); });
+	runner.stream("FrustumCullAABB3ArrayToBitmask", n, [&] { FrustumCullAABB3ArrayToBitmask(frustum, boxes.data(), visibleBits.data(), n); });
+	runner.stream("FrustumCullAABB3ArrayToIndices", n, [&] { FrustumCullAABB3ArrayToIndices(frustum, boxes.data(), visibleIndices.data(), n); });
+	runner.stream("FrustumCullAABB3ArrayToIndices.reference", n, [&] { FrustumCullAABB3ArrayToIndicesReference(frustum, boxes.data(), visibleIndices.data(), n); });
+}
+
+
+
+#pragma mark BVH Benchmarks
+
+/// The parallel build as the Swift `BVH.init()` runs it: the top levels on this thread, then the subtree tasks across all cores (plain threads pulling from a shared counter, standing in for `DispatchQueue.concurrentPerform`).
+static size_t BVHBuildParallel(const AABB3 *primitiveBounds, uint32_t *primitiveIndices, BVHNode *nodes, size_t n)
+{
+	const size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+	std::vector<BVHBuildTask> tasks(threadCount * 4);
+	const size_t taskCount = BVHBuildTopLevels(primitiveBounds, primitiveIndices, nodes, n, tasks.data(), tasks.size());
+	std::atomic<size_t> nextTaskI{ 0 };
+	auto buildTasks = [&] {
+		for (size_t taskI; (taskI = nextTaskI.fetch_add(1)) < taskCount; )
+			BVHBuildSubtree(primitiveBounds, primitiveIndices, nodes, tasks[taskI]);
+	};
+	std::vector<std::thread> threads;
+	for (size_t threadI = 1; threadI < std::min(threadCount, taskCount); ++threadI)
+		threads.emplace_back(buildTasks);
+	buildTasks();
+	for (std::thread &thread : threads)
+		thread.join();
+	return BVHBuildFlatten(nodes, nodes);
+}
+
+/// Builds & queries BVHs over a `columnCount`×`rowCount`-quad height-field terrain (2 triangles per quad), naming each benchmark with `nameSuffix` appended.
+/// The builds report milliseconds per million triangles & the queries report queries per second (per core), alongside their ns/op.
+static void RunBVHBenchmarks(Runner &runner, size_t n, size_t columnCount, size_t rowCount, const char *nameSuffix)
+{
+	const char *const baseNames[] = { "BVHTriangleBounds", "BVHBuild", "BVHBuild.parallel", "BVHIntersectRayTriangles", "BVHOccludedRayTriangles", "BVHOverlapTriangles", "BVHNearestTrianglePoint" };
+	std::string names[std::size(baseNames)];
+	bool isAnySelected = false;
+	for (size_t nameI = 0; nameI < std::size(baseNames); ++nameI) {
+		names[nameI] = std::string(baseNames[nameI]) + nameSuffix;
+		isAnySelected = isAnySelected || runner.isSelected(names[nameI].c_str());
+	}
+	if (!isAnySelected) return; // (skipping the terrain setup & the untimed build, which take a while for the large terrain)
+	
+	const size_t triangleCount = columnCount * rowCount * 2;
+	std::vector<Float3> vertices;
+	for (size_t z = 0; z <= rowCount; ++z) {
+		for (size_t x = 0; x <= columnCount; ++x)
+			vertices.push_back(Float3{ (float)x, 4 * sinf((float)x * 0.05f) * cosf((float)z * 0.07f) + sinf((float)(x * z) * 0.01f), (float)z });
+	}
+	std::vector<uint32_t> triangleVertexIndices;
+	for (uint32_t z = 0; z < rowCount; ++z) {
+		for (uint32_t x = 0; x < columnCount; ++x) {
+			const uint32_t corner = z * (uint32_t)(columnCount + 1) + x, rowStride = (uint32_t)columnCount + 1;
+			for (uint32_t vertexIndex : { corner, corner + rowStride, corner + 1, corner + 1, corner + rowStride, corner + rowStride + 1 })
+				triangleVertexIndices.push_back(vertexIndex);
+		}
+	}
+	std::vector<AABB3> triangleBounds(triangleCount);
+	BVHTriangleBounds(vertices.data(), triangleVertexIndices.data(), triangleBounds.data(), triangleCount);
+	std::vector<uint32_t> primitiveIndices(triangleCount);
+	std::vector<BVHNode> nodes(2 * triangleCount - 1), scratchNodes(2 * triangleCount - 1);
+	
+	runner.stream(names[0].c_str(), triangleCount, [&] { BVHTriangleBounds(vertices.data(), triangleVertexIndices.data(), triangleBounds.data(), triangleCount); });
+	runner.stream(names[1].c_str(), triangleCount, StreamRate::millisecondsPerMillionPrimitives, [&] { BVHBuild(triangleBounds.data(), primitiveIndices.data(), scratchNodes.data(), nodes.data(), triangleCount); });
+	runner.stream(names[2].c_str(), triangleCount, StreamRate::millisecondsPerMillionPrimitives, [&] { BVHBuildParallel(triangleBounds.data(), primitiveIndices.data(), scratchNodes.data(), triangleCount); });
+	BVHBuild(triangleBounds.data(), primitiveIndices.data(), scratchNodes.data(), nodes.data(), triangleCount);
+	
+	// `n` queries per pass, scattered over the terrain.
+	uint32_t state = 1;
+	auto nextUnit = [&state] { state = state * 1664525u + 1013904223u; return (float)(state >> 8) / (float)(1u << 24); };
+	std::vector<Float3> queryPoints(n), rayDirections(n);
+	std::vector<AABB3> queryBoxes(n);
+	for (size_t i = 0; i < n; ++i) {
+		queryPoints[i] = Float3{ nextUnit() * columnCount, 10 + nextUnit() * 10, nextUnit() * rowCount };
+		rayDirections[i] = Float3{ nextUnit() - 0.5f, -1, nextUnit() - 0.5f };
+		queryBoxes[i] = AABB3FromCenterExtents(Float3{ queryPoints[i].x, 0, queryPoints[i].z }, Float3{ 2, 2, 2 });
+	}
+	const Float3 lightDirection = { 0.6f, 0.3f, 0.2f };
+	std::vector<uint32_t> overlapIndices(4096);
+	BVHRayHit rayHit;
+	BVHNearestHit nearestHit;
+	size_t resultSum = 0;
+	
+	runner.stream(names[3].c_str(), n, StreamRate::queriesPerSecond, [&] {
+		for (size_t i = 0; i < n; ++i)
+			resultSum += BVHIntersectRayTriangles(nodes.data(), primitiveIndices.data(), vertices.data(), triangleVertexIndices.data(), queryPoints[i], rayDirections[i], INFINITY, &rayHit);
+	});
+	// Shadow rays from the primary hits' neighborhood toward a low light, so most cross a good stretch of terrain.
+	runner.stream(names[4].c_str(), n, StreamRate::queriesPerSecond, [&] {
+		for (size_t i = 0; i < n; ++i)
+			resultSum += BVHOccludedRayTriangles(nodes.data(), primitiveIndices.data(), vertices.data(), triangleVertexIndices.data(), Float3{ queryPoints[i].x, 0, queryPoints[i].z }, lightDirection, INFINITY);
+	});
+	runner.stream(names[5].c_str(), n, StreamRate::queriesPerSecond, [&] {
+		for (size_t i = 0; i < n; ++i)
+			resultSum += BVHOverlapTriangles(nodes.data(), primitiveIndices.data(), vertices.data(), triangleVertexIndices.data(), queryBoxes[i], overlapIndices.data(), overlapIndices.size());
+	});
+	runner.stream(names[6].c_str(), n, StreamRate::queriesPerSecond, [&] {
+		for (size_t i = 0; i < n; ++i)
+			resultSum += BVHNearestTrianglePoint(nodes.data(), primitiveIndices.data(), vertices.data(), triangleVertexIndices.data(), queryPoints[i], INFINITY, &nearestHit);
+	});
+	Opaque(resultSum);
+}
+static void RunBVHBenchmarks(Runner &runner, size_t n)
+{
+	RunBVHBenchmarks(runner, n, 256, 128, ""); // 65,536 triangles
+	RunBVHBenchmarks(runner, n, 1024, 512, ".1M"); // 1,048,576 triangles
+}
+
+
+
+#pragma mark Ray Packet Benchmarks
+
+// The `.reference`s call the scalar `Ray3IntersectTriangle()`/`Ray3IntersectAABB3()` a pair at a time (which the batch kernels match bit-for-bit), for the speed-up.
+
+static void RunRayStreamBenchmarks(Runner &runner, size_t n)
+{
+	// Rays from around a point above a 20-unit square, aimed down at random spots on it; & a triangle & box over part of it, & triangles & boxes scattered over it, so roughly half the pairs hit.
+	uint32_t state = 1;
+	auto nextUnit = [&state] { state = state * 1664525u + 1013904223u; return (float)(state >> 8) / (float)(1u << 24); };
+	std::vector<Ray3> rays(n);
+	for (Ray3 &ray : rays) {
+		Float3 origin = { nextUnit() - 0.5f, 10, nextUnit() - 0.5f };
+		ray = (Ray3){ origin, Float3{ nextUnit() * 20 - 10 - origin.x, -10, nextUnit() * 20 - 10 - origin.z } };
+	}
+	const Float3 a = { -10, 0, -10 }, b = { 10, 0, -10 }, c = { -10, 0, 10 };
+	const AABB3 box = { { -10, -1, -10 }, { 3, 1, 3 } };
+	std::vector<Float3> vertices(n + 2);
+	for (Float3 &vertex : vertices)
+		vertex = Float3{ nextUnit() * 20 - 10, nextUnit() - 0.5f, nextUnit() * 20 - 10 };
+	std::vector<uint32_t> triangleVertexIndices(3 * n);
+	std::vector<AABB3> boxes(n);
+	for (size_t i = 0; i < n; ++i) {
+		triangleVertexIndices[i * 3] = (uint32_t)i, triangleVertexIndices[i * 3 + 1] = (uint32_t)i + 1, triangleVertexIndices[i * 3 + 2] = (uint32_t)i + 2;
+		boxes[i] = AABB3FromCenterExtents(vertices[i], Float3{ 4, 4, 4 });
+	}
+	const Ray3 ray = { { 0, 10, 0 }, { 0.1f, -1, 0.2f } };
+	std::vector<float> distances(n);
+	std::vector<uint8_t> hitBits((n + 7) / 8);
+	
+	runner.stream("Ray3ArrayIntersectTriangle", n, [&] { Ray3ArrayIntersectTriangle(rays.data(), a, b, c, INFINITY, distances.data(), hitBits.data(), n); });
+	runner.stream("Ray3ArrayIntersectTriangle.reference", n, [&] {
+		for (size_t i = 0; i < n; ++i)
+			distances[i] = Ray3IntersectTriangle(rays[i], a, b, c, INFINITY, NULL, NULL);
+	});
+	runner.stream("Ray3ArrayIntersectAABB3", n, [&] { Ray3ArrayIntersectAABB3(rays.data(), box, INFINITY, distances.data(), hitBits.data(), n); });
+	runner.stream("Ray3ArrayIntersectAABB3.reference", n, [&] {
+		for (size_t i = 0; i < n; ++i)
+			distances[i] = Ray3IntersectAABB3(rays[i], box, INFINITY);
+	});
+	runner.stream("Ray3IntersectTriangleArray", n, [&] { Ray3IntersectTriangleArray(ray, vertices.data(), triangleVertexIndices.data(), INFINITY, distances.data(), hitBits.data(), n); });
+	runner.stream("Ray3IntersectTriangleArray.reference", n, [&] {
+		for (size_t i = 0; i < n; ++i)
+			distances[i] = Ray3IntersectTriangle(ray, vertices[triangleVertexIndices[i * 3]], vertices[triangleVertexIndices[i * 3 + 1]], vertices[triangleVertexIndices[i * 3 + 2]], INFINITY, NULL, NULL);
+	});
+	runner.stream("Ray3IntersectAABB3Array", n, [&] { Ray3IntersectAABB3Array(ray, boxes.data(), INFINITY, distances.data(), hitBits.data(), n); });
+	runner.stream("Ray3IntersectAABB3Array.reference", n, [&] {
+		for (size_t i = 0; i < n; ++i)
+			distances[i] = Ray3IntersectAABB3(ray, boxes[i], INFINITY);
+	});
+}
+
+
+
+#pragma mark Bulk Encoding Benchmarks
+
+// Bandwidths are of the canonical encoding (12 bytes per `Float3`, 16 per `FloatQuaternion`), whether read or written; the `.reference`s are plain `memcpy()`s of the arrays, as the ceiling.
+// The deltas are against snapshots with 1 in 10 elements changed (the rest bit-for-bit the same), as replicating moving objects would see.
+
+static void RunBulkCodecBenchmarks(Runner &runner, size_t n)
+{
+	uint32_t state = 1;
+	auto nextUnit = [&state] { state = state * 1664525u + 1013904223u; return (float)(state >> 8) / (float)(1u << 24); };
+	std::vector<Float3> positions(n), previousPositions(n), positionsOut(n);
+	std::vector<FloatQuaternion> rotations(n), previousRotations(n), rotationsOut(n);
+	for (size_t i = 0; i < n; ++i) {
+		previousPositions[i] = Float3{ nextUnit() * 1000, nextUnit() * 1000, nextUnit() * 1000 };
+		positions[i] = (i % 10 == 0) ? Float3{ nextUnit() * 1000, nextUnit() * 1000, nextUnit() * 1000 } : previousPositions[i];
+		previousRotations[i] = FloatQuaternionNormalizeFast(FloatQuaternion{ nextUnit() - 0.5f, nextUnit() - 0.5f, nextUnit() - 0.5f, nextUnit() - 0.5f });
+		rotations[i] = (i % 10 == 0) ? FloatQuaternionNormalizeFast(FloatQuaternion{ nextUnit() - 0.5f, nextUnit() - 0.5f, nextUnit() - 0.5f, nextUnit() - 0.5f }) : previousRotations[i];
+	}
+	const BulkCodecLayout positionLayout = BulkCodecLayoutMake(4, 3, 1, sizeof(Float3)), rotationLayout = BulkCodecLayoutMake(4, 4, 1, sizeof(FloatQuaternion));
+	std::vector<uint8_t> positionBytes(BulkCodecCompactedSizeLimit(positionLayout, n)), positionDeltaBytes(BulkCodecCompactedSizeLimit(positionLayout, n));
+	std::vector<uint8_t> rotationBytes(BulkCodecCompactedSizeLimit(rotationLayout, n)), rotationDeltaBytes(BulkCodecCompactedSizeLimit(rotationLayout, n));
+	BulkCodecEncode(positionLayout, positions.data(), NULL, n, positionBytes.data());
+	size_t positionDeltaSize = BulkCodecEncodeCompacted(positionLayout, positions.data(), previousPositions.data(), n, positionDeltaBytes.data());
+	BulkCodecEncode(rotationLayout, rotations.data(), NULL, n, rotationBytes.data());
+	size_t rotationDeltaSize = BulkCodecEncodeCompacted(rotationLayout, rotations.data(), previousRotations.data(), n, rotationDeltaBytes.data());
+	
+	runner.stream("BulkCodecEncode(Float3)", n, [&] { BulkCodecEncode(positionLayout, positions.data(), NULL, n, positionBytes.data()); }, 12);
+	runner.stream("BulkCodecEncode(Float3).reference", n, [&] { std::memcpy(positionsOut.data(), positions.data(), n * sizeof(Float3)); }, 12);
+	runner.stream("BulkCodecDecode(Float3)", n, [&] { BulkCodecDecode(positionLayout, positionBytes.data(), NULL, n, positionsOut.data()); }, 12);
+	runner.stream("BulkCodecEncode(Float3)Delta", n, [&] { BulkCodecEncode(positionLayout, positions.data(), previousPositions.data(), n, positionBytes.data()); }, 12);
+	runner.stream("BulkCodecEncodeCompacted(Float3)Delta", n, [&] { BulkCodecEncodeCompacted(positionLayout, positions.data(), previousPositions.data(), n, positionDeltaBytes.data()); }, 12);
+	runner.stream("BulkCodecDecodeCompacted(Float3)Delta", n, [&] { BulkCodecDecodeCompacted(positionLayout, positionDeltaBytes.data(), positionDeltaSize, previousPositions.data(), n, positionsOut.data(), NULL); }, 12);
+	runner.stream("BulkCodecEncode(FloatQuaternion)", n, [&] { BulkCodecEncode(rotationLayout, rotations.data(), NULL, n, rotationBytes.data()); }, 16);
+	runner.stream("BulkCodecEncode(FloatQuaternion).reference", n, [&] { std::memcpy(rotationsOut.data(), rotations.data(), n * sizeof(FloatQuaternion)); }, 16);
+	runner.stream("BulkCodecDecode(FloatQuaternion)", n, [&] { BulkCodecDecode(rotationLayout, rotationBytes.data(), NULL, n, rotationsOut.data()); }, 16);
+	runner.stream("BulkCodecEncodeCompacted(FloatQuaternion)", n, [&] { BulkCodecEncodeCompacted(rotationLayout, rotations.data(), NULL, n, rotationBytes.data()); }, 16);
+	runner.stream("BulkCodecEncodeCompacted(FloatQuaternion)Delta", n, [&] { BulkCodecEncodeCompacted(rotationLayout, rotations.data(), previousRotations.data(), n, rotationDeltaBytes.data()); }, 16);
+	runner.stream("BulkCodecDecodeCompacted(FloatQuaternion)Delta", n, [&] { BulkCodecDecodeCompacted(rotationLayout, rotationDeltaBytes.data(), rotationDeltaSize, previousRotations.data(), n, rotationsOut.data(), NULL); }, 16);
+}
+
+
+
+#pragma mark Curve Benchmarks
+
+// The easing & segment kernels are paired with a `.reference` loop over the scalar formula (`CurveEase()`, or the basis weights applied per point), for the speed-up; the eased slerp's `.reference` is the un-eased `FloatQuaternionSlerpArrays()`, for the easing's cost.
+
+static void RunCurveBenchmarks(Runner &runner, size_t n)
+{
+	uint32_t state = 1;
+	auto nextUnit = [&state] { state = state * 1664525u + 1013904223u; return (float)(state >> 8) / (float)(1u << 24); };
+	std::vector<float> ratios(n), eased(n), times(n);
+	std::vector<Float3> points(n);
+	std::vector<FloatQuaternion> from(n), to(n), rotations(n);
+	for (size_t i = 0; i < n; ++i) {
+		ratios[i] = nextUnit();
+		times[i] = nextUnit() * 15;
+		from[i] = FloatQuaternionNormalizeFast(FloatQuaternion{ nextUnit() - 0.5f, nextUnit() - 0.5f, nextUnit() - 0.5f, nextUnit() - 0.5f });
+		to[i] = FloatQuaternionNormalizeFast(FloatQuaternion{ nextUnit() - 0.5f, nextUnit() - 0.5f, nextUnit() - 0.5f, nextUnit() - 0.5f });
+	}
+	const Float3 controlPoints[4] = { { 0, 0, 0 }, { 0, 1, 0 }, { 1, 1, 1 }, { 1, 0, 1 } };
+	std::vector<Float3> keyframes(16);
+	for (size_t i = 0; i < keyframes.size(); ++i)
+		keyframes[i] = Float3{ nextUnit(), nextUnit(), nextUnit() };
+	
+	runner.stream("CurveEaseArrays(cubicInOut)", n, [&] { CurveEaseArrays(VUCKT_EASING_CUBIC_IN_OUT, ratios.data(), eased.data(), n); }, 8);
+	runner.stream("CurveEaseArrays(cubicInOut).reference", n, [&] {
+		for (size_t i = 0; i < n; ++i)
+			eased[i] = CurveEase(VUCKT_EASING_CUBIC_IN_OUT, ratios[i]);
+	}, 8);
+	runner.stream("CurveEaseArrays(elasticOut)", n, [&] { CurveEaseArrays(VUCKT_EASING_ELASTIC_OUT, ratios.data(), eased.data(), n); }, 8);
+	runner.stream("CurveEaseArrays(elasticOut).reference", n, [&] {
+		for (size_t i = 0; i < n; ++i)
+			eased[i] = CurveEase(VUCKT_EASING_ELASTIC_OUT, ratios[i]);
+	}, 8);
+	runner.stream("CurveSampleSegmentLanes(Float3,bezier)", n, [&] { CurveSampleSegmentLanes(VUCKT_CURVE_BASIS_BEZIER, (const float *)controlPoints, 3, sizeof(Float3) / sizeof(float), ratios.data(), (float *)points.data(), n); }, 4 + sizeof(Float3));
+	runner.stream("CurveSampleSegmentLanes(Float3,bezier).reference", n, [&] {
+		for (size_t i = 0; i < n; ++i) {
+			float weights[4];
+			CurveBasisWeights(VUCKT_CURVE_BASIS_BEZIER, ratios[i], weights);
+			points[i] = controlPoints[0] * weights[0] + controlPoints[1] * weights[1] + controlPoints[2] * weights[2] + controlPoints[3] * weights[3];
+		}
+	}, 4 + sizeof(Float3));
+	runner.stream("CurveSampleTrackLanes(Float3,catmullRom)", n, [&] { CurveSampleTrackLanes(VUCKT_CURVE_BASIS_CATMULL_ROM, (const float *)keyframes.data(), keyframes.size(), 3, sizeof(Float3) / sizeof(float), times.data(), (float *)points.data(), n); }, 4 + sizeof(Float3));
+	runner.stream("CurveEasedSlerpArrays(cubicInOut)", n, [&] { CurveEasedSlerpArrays(VUCKT_EASING_CUBIC_IN_OUT, from.data(), to.data(), ratios.data(), 1, rotations.data(), n, false); }, 3 * sizeof(FloatQuaternion) + 4);
+	runner.stream("CurveEasedSlerpArrays(cubicInOut).reference", n, [&] { FloatQuaternionSlerpArrays(from.data(), to.data(), ratios.data(), 1, rotations.data(), n, false); }, 3 * sizeof(FloatQuaternion) + 4);
+}
+
+
+
+#pragma mark Parallel Benchmarks
+
+// `Parallel.hpp`'s bulk operations over `--parallel-count` elements (4M by default, well past the caches) on pools of 1, 2, 4, … threads, up to one per hardware thread, for how they scale; `/1threads` is the single-threaded kernel plus the chunking overhead.
+// Past the memory bandwidth a few cores can saturate, the streaming ops stop scaling; the sums, reading half as much per element, go further.
+
+static void RunParallelBenchmarks(Runner &runner, size_t n)
+{
+	const size_t hardwareThreadCount = std::max(1u, std::thread::hardware_concurrency());
+	std::vector<size_t> threadCounts;
+	for (size_t threadCount = 1; threadCount < hardwareThreadCount; threadCount *= 2)
+		threadCounts.push_back(threadCount);
+	threadCounts.push_back(hardwareThreadCount);
+	
+	const char *const operationNames[] = { "parallelNormalize(Float3)", "parallelNormalize(Float4)", "parallelTransformPoints(Float3)", "parallelSum(Float3)", "parallelSum(Float4)" };
+	auto benchmarkName = [](const char *operationName, size_t threadCount) { return std::string(operationName) + "/" + std::to_string(threadCount) + "threads"; };
+	bool isAnySelected = false;
+	for (const char *operationName : operationNames)
+		for (size_t threadCount : threadCounts)
+			isAnySelected = isAnySelected || runner.isSelected(benchmarkName(operationName, threadCount).c_str());
+	if (!isAnySelected)
+		return;
+	
+	uint32_t state = 1;
+	auto nextUnit = [&state] { state = state * 1664525u + 1013904223u; return (float)(state >> 8) / (float)(1u << 24); };
+	std::vector<Float3> points(n), pointsOut(n);
+	std::vector<Float4> vectors(n), vectorsOut(n);
+	for (size_t i = 0; i < n; ++i) {
+		points[i] = Float3{ nextUnit() * 200 - 100, nextUnit() * 200 - 100, nextUnit() * 200 - 100 };
+		vectors[i] = Float4{ nextUnit() - 0.5f, nextUnit() - 0.5f, nextUnit() - 0.5f, nextUnit() - 0.5f };
+	}
+	const Float4x4 transform = { 0.8f, 0.6f, 0, 0, -0.6f, 0.8f, 0, 0, 0, 0, 1, 0, 10, 20, 30, 1 };
+	
+	for (size_t threadCount : threadCounts) {
+		vuckt::ThreadPool pool(threadCount);
+		runner.stream(benchmarkName(operationNames[0], threadCount).c_str(), n, [&] { vuckt::parallelNormalize(points.data(), pointsOut.data(), n, pool); }, 2 * sizeof(Float3));
+		runner.stream(benchmarkName(operationNames[1], threadCount).c_str(), n, [&] { vuckt::parallelNormalize(vectors.data(), vectorsOut.data(), n, pool); }, 2 * sizeof(Float4));
+		runner.stream(benchmarkName(operationNames[2], threadCount).c_str(), n, [&] { vuckt::parallelTransformPoints(transform, points.data(), pointsOut.data(), n, false, pool); }, 2 * sizeof(Float3));
+		runner.stream(benchmarkName(operationNames[3], threadCount).c_str(), n, [&] { Float3 sum = vuckt::parallelSum(points.data(), n, pool); Opaque(sum); }, sizeof(Float3));
+		runner.stream(benchmarkName(operationNames[4], threadCount).c_str(), n, [&] { Float4 sum = vuckt::parallelSum(vectors.data(), n, pool); Opaque(sum); }, sizeof(Float4));
+	}
+}
+
+
+
+/// Back-to-back small jobs (2–61 tasks each) on a pool of at least 4 threads, oversubscribing small machines so workers get preempted mid-job: ns/op is per job (the pool's dispatch overhead), & every pass checks each task ran exactly once, aborting if not.
+/// (This is also the pool's stress test: a job published while a worker from the last one was still waking once lost stolen tasks & hung here.)
+static void RunThreadPoolStressBenchmark(Runner &runner)
+{
+	const size_t threadCount = std::max<size_t>(4, std::thread::hardware_concurrency());
+	const std::string name = "ThreadPool.parallelFor(smallJobs)/" + std::to_string(threadCount) + "threads";
+	if (!runner.isSelected(name.c_str()))
+		return;
+	
+	vuckt::ThreadPool pool(threadCount);
+	const size_t jobCount = 60, maxTaskCount = 61;
+	std::vector<std::atomic<uint32_t>> taskRunCounts(jobCount * maxTaskCount);
+	uint32_t passCount = 0;
+	runner.stream(name.c_str(), jobCount, [&] {
+		++passCount;
+		for (size_t jobI = 0; jobI < jobCount; ++jobI) {
+			std::atomic<uint32_t> *jobRunCounts = &taskRunCounts[jobI * maxTaskCount];
+			pool.parallelFor(2 + jobI, [&](size_t taskI) { jobRunCounts[taskI].fetch_add(1, std::memory_order_relaxed); });
+		}
+		for (size_t jobI = 0; jobI < jobCount; ++jobI) {
+			for (size_t taskI = 0; taskI < 2 + jobI; ++taskI) {
+				if (taskRunCounts[jobI * maxTaskCount + taskI].load(std::memory_order_relaxed) != passCount) {
+					std::fprintf(stderr, "error: %s: task %zu of job %zu ran %u times in %u passes\n", name.c_str(), taskI, jobI, taskRunCounts[jobI * maxTaskCount + taskI].load(), passCount);
+					std::abort();
+				}
+			}
+		}
+	});
+}
+
+
+
+#pragma mark Fast-Approximate Math Benchmarks
+
+// Each `…Fast` op is paired with a `…Fast.reference` chain computing the same thing at full precision (`sqrtf()`, division, `sinf()`/`cosf()`), for the speed-up.
+
+VUCKT_BENCH_ALWAYS_INLINE float Float3ReferenceLength(Float3 v)
+{
+	return sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+}
+
+static void RunFastMathBenchmarks(Runner &runner)
+{
+	// `normalize(normalize(x))` re-normalizes a unit vector every step after the first; a length fed back into lane 0 (then halved) settles at a fixed point.
+	runner.chain("Float3NormalizeFast", Ramp<Float3, float>(3, 2), 0, [](Float3 x, int) { return Float3NormalizeFast(x); });
+	runner.chain("Float3NormalizeFast.reference", Ramp<Float3, float>(3, 2), 0, [](Float3 x, int) { return Float3DivideByScalar(x, Float3ReferenceLength(x)); });
+	runner.chain("Float3LengthFast", Ramp<Float3, float>(3, 2), 0.5f, [](Float3 x, float s) { x.x = Float3LengthFast(x) * s; return x; });
+	runner.chain("Float3LengthFast.reference", Ramp<Float3, float>(3, 2), 0.5f, [](Float3 x, float s) { x.x = Float3ReferenceLength(x) * s; return x; });
+	runner.chain("Float3ReciprocalFast", Ramp<Float3, float>(3, 2), 0, [](Float3 x, int) { return Float3ReciprocalFast(x); });
+	runner.chain("Float3ReciprocalFast.reference", Ramp<Float3, float>(3, 2), 1.0f, [](Float3 x, float s) { return Float3DividingScalar(s, x); });
+	runner.chain("Float4NormalizeFast", Ramp<Float4, float>(3, 2), 0, [](Float4 x, int) { return Float4NormalizeFast(x); });
+	runner.chain("Float4ReciprocalFast", Ramp<Float4, float>(3, 2), 0, [](Float4 x, int) { return Float4ReciprocalFast(x); });
+	runner.chain("FloatQuaternionNormalizeFast", FloatQuaternion{ 0.2f, 0.4f, 0.4f, 0.8f }, 0, [](FloatQuaternion x, int) { return FloatQuaternionNormalizeFast(x); });
+	
+	// `sin(x) + cos(x)` stays within ±√2, folding both results into the chain.
+	runner.chain("Float3SinCosFast", Ramp<Float3, float>(0.5f, 1), 0, [](Float3 x, int) {
+		Float3 sinOfX, cosOfX;
+		Float3SinCosFast(x, &sinOfX, &cosOfX);
+		return Float3Add(sinOfX, cosOfX);
+	});
+	runner.chain("Float3SinCosFast.reference", Ramp<Float3, float>(0.5f, 1), 0, [](Float3 x, int) {
+		Float3 sinOfX = { sinf(x.x), sinf(x.y), sinf(x.z) }, cosOfX = { cosf(x.x), cosf(x.y), cosf(x.z) };
+		return Float3Add(sinOfX, cosOfX);
+	});
+}
+
+
+
+#pragma mark C++ Operator Benchmarks
+
+// `Vuckt.hpp`'s operators fold at compile time…
+static_assert(Float3UnitX * 2.0f + Float3UnitY == Float3{ 2, 1, 0 }, "Vuckt.hpp's Float3 operators aren't constant-evaluated.");
+static_assert(vuckt::swizzle<2, 1, 0>(Int3{ 1, 2, 3 }) % 2 == Int3{ 1, 0, 1 }, "Vuckt.hpp's Int3 swizzles/operators aren't constant-evaluated.");
+static_assert(Float4x4Identity * Float4x4Identity * Float4{ 1, 2, 3, 4 } == Float4{ 1, 2, 3, 4 }, "Vuckt.hpp's Float4x4 operators aren't constant-evaluated.");
+
+// …& at run time should match the C functions they call (compare with the `Float3Add` &c. chains above).
+static void RunOperatorBenchmarks(Runner &runner)
+{
+	const Float4x4 transform4x4 = Float4x3ToFloat4x4(MakeTransform());
+	
+	runner.chain("Float3 operator+", Ramp<Float3, float>(3, 2), Float3Zero, [](Float3 x, Float3 b) { return x + b; });
+	runner.chain("Float3 operator*(float)", Ramp<Float3, float>(3, 2), 1.0f, [](Float3 x, float s) { return x * s; });
+	runner.chain("Int4 operator-", Ramp<Int4, int>(3, 2), Int4Zero, [](Int4 x, Int4 b) { return x - b; });
+	runner.chain("Float4x4 operator*", transform4x4, Float4x4Identity, [](Float4x4 x, Float4x4 b) { return x * b; });
+	runner.chain("Float4x4 operator*(Float4)", Ramp<Float4, float>(3, 2), Float4x4Identity, [](Float4 x, Float4x4 m) { return m * x; });
+	runner.chain("FloatQuaternion operator*", FloatQuaternion{ 0.2f, 0.4f, 0.4f, 0.8f }, FloatQuaternionIdentity, [](FloatQuaternion x, FloatQuaternion b) { return x * b; });
+}
+
+
+
+#pragma mark Matrix Benchmarks
+
+static void RunMatrixBenchmarks(Runner &runner)
+{
+	const Float4x3 transform = MakeTransform();
+	const Float4x4 transform4x4 = Float4x3ToFloat4x4(transform);
+	const Float3x3 rotation3x3 = Float4x4UpperLeft3x3(transform4x4);
+	const Float4x3 identity = Float4x3FromScaleRotationTranslation(Float3{ 1, 1, 1 }, FloatQuaternion{ 0, 0, 0, 1 }, Float3{ 0, 0, 0 });
+	const Float4x4 identity4x4 = Float4x3ToFloat4x4(identity);
+	
+	runner.chain("Float3x3ToSimd+Float3x3FromSimd", rotation3x3, 0, [](Float3x3 x, int) { return Float3x3FromSimd(Float3x3ToSimd(x)); });
+	runner.chain("Float3x3OuterProduct", Ramp<Float3, float>(3, 2), Splat<Float3, float>(1), [](Float3 x, Float3 b) {
+		return Column0<Float3>(Float3x3OuterProduct(x, b));
+	});
+	runner.chain("Float3x3NormalMatrix", rotation3x3, 0, [](Float3x3 x, int) { return Float3x3NormalMatrix(x); });
+	
+	runner.chain("Float4x4ToSimd+Float4x4FromSimd", transform4x4, 0, [](Float4x4 x, int) { return Float4x4FromSimd(Float4x4ToSimd(x)); });
+	runner.chain("Float4x4OuterProduct", Ramp<Float4, float>(3, 2), Splat<Float4, float>(1), [](Float4 x, Float4 b) {
+		return Column0<Float4>(Float4x4OuterProduct(x, b));
+	});
+	runner.chain("Float4x4Concatenate", transform4x4, identity4x4, [](Float4x4 x, Float4x4 b) { return Float4x4Concatenate(x, b); });
+	runner.chain("Float4x4Inverse", transform4x4, 0, [](Float4x4 x, int) { return Float4x4Inverse(x); });
+	
+	runner.chain("Float4x3ToFloat4x4+Float4x3FromFloat4x4", transform, 0, [](Float4x3 x, int) { return Float4x3FromFloat4x4(Float4x3ToFloat4x4(x)); });
+	runner.chain("Float4x3Concatenate", transform, identity, [](Float4x3 x, Float4x3 b) { return Float4x3Concatenate(x, b); });
+	runner.chain("Float4x3Inverse", transform, 0, [](Float4x3 x, int) { return Float4x3Inverse(x); });
+	runner.chain("Float4x3OrthogonalInverse", transform, 0, [](Float4x3 x, int) { return Float4x3OrthogonalInverse(x); });
+	runner.chain("Float4x3TransformPoint", Ramp<Float3, float>(3, 2), identity, [](Float3 x, Float4x3 m) { return Float4x3TransformPoint(m, x); });
+	runner.chain("Float4x3TransformVector", Ramp<Float3, float>(3, 2), identity, [](Float3 x, Float4x3 m) { return Float4x3TransformVector(m, x); });
+	struct ScaleRotation { Float3 scale; FloatQuaternion rotation; };
+	runner.chain("Float4x3FromScaleRotationTranslation", transform, ScaleRotation{ Float3{ 1, 1, 1 }, FloatQuaternion{ 0.2f, 0.4f, 0.4f, 0.8f } }, [](Float4x3 x, ScaleRotation b) {
+		return Float4x3FromScaleRotationTranslation(b.scale, b.rotation, Float3{ x.m30, x.m31, x.m32 });
+	});
+}
+
+static void RunMatrixStreamBenchmarks(Runner &runner, size_t n)
+{
+	const Float4x4 transform4x4 = Float4x3ToFloat4x4(MakeTransform());
+	const Float3x3 rotation3x3 = Float4x4UpperLeft3x3(transform4x4);
+	std::vector<Float3> points(n, Ramp<Float3, float>(3, 2)), pointsOut(n);
+	std::vector<Float3> normals(n, Float3{ 0, 0.6f, 0.8f });
+	std::vector<PackedFloat3> packedPoints(n, PackedFloat3FromFloat3(Ramp<Float3, float>(3, 2))), packedOut(n);
+	std::vector<Float4x4> locals(n, transform4x4), worlds(n), worldInverses(n);
+	std::vector<int> parentIndices(n);
+	for (size_t i = 0; i < n; ++i)
+		parentIndices[i] = (i == 0) ? -1 : (int)((i - 1) / 2);
+	
+	runner.stream("Float3x3TransformVectors", n, [&] { Float3x3TransformVectors(rotation3x3, points.data(), pointsOut.data(), n); });
+	runner.stream("Float3x3TransformNormals", n, [&] { Float3x3TransformNormals(rotation3x3, normals.data(), pointsOut.data(), n, true); });
+	runner.stream("Float4x4TransformPoints", n, [&] { Float4x4TransformPoints(transform4x4, points.data(), pointsOut.data(), n, false); });
+	runner.stream("Float4x4TransformPoints.perspectiveDivide", n, [&] { Float4x4TransformPoints(transform4x4, points.data(), pointsOut.data(), n, true); });
+	runner.stream("Float4x4TransformPackedPoints", n, [&] { Float4x4TransformPackedPoints(transform4x4, packedPoints.data(), packedOut.data(), n, false); });
+	runner.stream("Float4x4TransformNormals", n, [&] { Float4x4TransformNormals(transform4x4, normals.data(), pointsOut.data(), n, true); });
+	runner.stream("Float4x4PropagateHierarchy", n, [&] { Float4x4PropagateHierarchy(locals.data(), parentIndices.data(), worlds.data(), nullptr, n); });
+	runner.stream("Float4x4PropagateHierarchy.inverses", n, [&] { Float4x4PropagateHierarchy(locals.data(), parentIndices.data(), worlds.data(), worldInverses.data(), n); });
+}
+
+
+
+#pragma mark Quaternion Benchmarks
+
+static void RunQuaternionStreamBenchmarks(Runner &runner, size_t n)
+{
+	// Rotations about a spread of axes & angles (some past 180° apart, to exercise the shorter-arc sign fix-up), unit-length.
+	std::vector<FloatQuaternion> q0(n), q1(n), q2(n), q3(n), out(n);
+	std::vector<float> ratios(n);
+	for (size_t i = 0; i < n; ++i) {
+		auto make = [&](float phase) {
+			float halfAngle = 0.37f * (float)i + phase, axisAngle = 0.61f * (float)i + phase;
+			float s = std::sin(halfAngle);
+			return FloatQuaternion{ s * std::cos(axisAngle) * 0.6f, s * std::sin(axisAngle) * 0.6f, s * 0.8f, std::cos(halfAngle) };
+		};
+		q0[i] = make(0.0f); q1[i] = make(0.5f); q2[i] = make(1.0f); q3[i] = make(1.5f);
+		ratios[i] = (float)(i % 17) / 16.0f;
+	}
+	const float sharedRatio = 0.3f;
+	
+	runner.stream("FloatQuaternionSlerpArrays", n, [&] { FloatQuaternionSlerpArrays(q0.data(), q1.data(), ratios.data(), 1, out.data(), n, false); });
+	runner.stream("FloatQuaternionSlerpArrays.sharedRatio", n, [&] { FloatQuaternionSlerpArrays(q0.data(), q1.data(), &sharedRatio, 0, out.data(), n, false); });
+	runner.stream("FloatQuaternionSlerpArrays.longest", n, [&] { FloatQuaternionSlerpArrays(q0.data(), q1.data(), ratios.data(), 1, out.data(), n, true); });
+	runner.stream("FloatQuaternionSlerpFastArrays", n, [&] { FloatQuaternionSlerpFastArrays(q0.data(), q1.data(), ratios.data(), 1, out.data(), n); });
+	runner.stream("FloatQuaternionNlerpArrays", n, [&] { FloatQuaternionNlerpArrays(q0.data(), q1.data(), ratios.data(), 1, out.data(), n); });
+	runner.stream("FloatQuaternionBezierArrays", n, [&] { FloatQuaternionBezierArrays(q0.data(), q1.data(), q2.data(), q3.data(), ratios.data(), 1, out.data(), n); });
+	runner.stream("FloatQuaternionSplineArrays", n, [&] { FloatQuaternionSplineArrays(q0.data(), q1.data(), q2.data(), q3.data(), ratios.data(), 1, out.data(), n); });
+}
+
+
+
+#pragma mark Euler-Angle Benchmarks
+
+static void RunEulerAngleBenchmarks(Runner &runner, size_t n)
+{
+	// Rotation order z-x-y (Swift's default `RotationOrder.zxy`).  Each round trip reproduces its (in-range) input angles, so the chains stay put.
+	runner.chain("FloatQuaternionFromEulerAngles+ToEulerAngles", Float3{ 0.3f, -0.7f, 1.1f }, 0, [](Float3 x, int) {
+		return FloatQuaternionToEulerAngles(FloatQuaternionFromEulerAngles(x, 2, 0, 1), 2, 0, 1);
+	});
+	runner.chain("FloatQuaternionFromEulerAnglesFast+ToEulerAngles", Float3{ 0.3f, -0.7f, 1.1f }, 0, [](Float3 x, int) {
+		return FloatQuaternionToEulerAngles(FloatQuaternionFromEulerAnglesFast(x, 2, 0, 1), 2, 0, 1);
+	});
+	runner.chain("Float3x3FromEulerAngles+ToEulerAngles", Float3{ 0.3f, -0.7f, 1.1f }, 0, [](Float3 x, int) {
+		return Float3x3ToEulerAngles(Float3x3FromEulerAngles(x, 2, 0, 1), 2, 0, 1);
+	});
+	
+	std::vector<Float3> eulerAngles(n);
+	for (size_t i = 0; i < n; ++i)
+		eulerAngles[i] = Float3{ 0.37f * (float)(i % 17) - 3, 0.11f * (float)(i % 29) - 1.5f, 0.23f * (float)(i % 27) - 3 };
+	std::vector<FloatQuaternion> quaternions(n);
+	std::vector<Float3x3> matrices3x3(n);
+	std::vector<Float4x4> matrices4x4(n);
+	runner.stream("FloatQuaternionFromEulerAnglesArray", n, [&] { FloatQuaternionFromEulerAnglesArray(eulerAngles.data(), quaternions.data(), n, 2, 0, 1); });
+	runner.stream("Float3x3FromEulerAnglesArray", n, [&] { Float3x3FromEulerAnglesArray(eulerAngles.data(), matrices3x3.data(), n, 2, 0, 1); });
+	runner.stream("Float4x4FromEulerAnglesArray", n, [&] { Float4x4FromEulerAnglesArray(eulerAngles.data(), matrices4x4.data(), n, 2, 0, 1); });
+}
+
+
+
+#pragma mark Main
+
+static const char *const usage =
+	"Usage: vuckt-cbench [options]\n"
+	"\n"
+	"Measures the latency & throughput of Vuckt's C header functions (plus cycles & instructions per op, where perf_event_open is permitted).\n"
+	"\n"
+	"Options:\n"
+	"  --filter <text>      Only run benchmarks whose name contains <text> (repeatable).\n"
+	"  --samples <n>        Timed samples per measurement; the fastest is kept (default: 5).\n"
+	"  --sample-time <ms>   Minimum duration of each sample (default: 20).\n"
+	"  --count <n>          Elements per pass for the array (stream) benchmarks (default: 512).\n"
+	"  --parallel-count <n> Elements per pass for the multi-threaded benchmarks (default: 4194304).\n"
+	"  --json               Write the results as JSON instead of a table.\n"
+	"  --help               Show this help.\n";
+
+static void PrintJSONMeasurement(const char *key, const Measurement &measurement)
+{
+	if (measurement.nanoseconds < 0) { std::printf("\"%s\": null", key); return; }
+	std::printf("\"%s\": { \"nanosecondsPerOperation\": %.4f", key, measurement.nanoseconds);
+	if (measurement.cycles >= 0)
+		std::printf(", \"cyclesPerOperation\": %.4f, \"instructionsPerOperation\": %.4f", measurement.cycles, measurement.instructions);
+	std::printf(" }");
+}
+
+static void PrintJSON(const Runner &runner)
+{
+	std::printf("{\n\t\"formatVersion\": 1,\n\t\"hardwareCounters\": %s,\n\t\"results\": [", runner.hasHardwareCounters() ? "true" : "false");
+	bool isFirst = true;
+	for (const Result &result : runner.results()) {
+		std::printf("%s\n\t\t{ \"name\": \"%s\", \"kind\": \"%s\", \"chainCount\": %zu, ", isFirst ? "" : ",", result.name.c_str(), result.kind, result.chainCount);
+		PrintJSONMeasurement("latency", result.latency);
+		std::printf(", ");
+		PrintJSONMeasurement("throughput", result.throughput);
+		if (result.bytesPerOperation > 0)
+			std::printf(", \"bytesPerOperation\": %zu, \"gigabytesPerSecond\": %.4f", result.bytesPerOperation, (double)result.bytesPerOperation / result.throughput.nanoseconds);
+		if (result.rate == StreamRate::millisecondsPerMillionPrimitives)
+			std::printf(", \"millisecondsPerMillionPrimitives\": %.4f", result.throughput.nanoseconds);
+		else if (result.rate == StreamRate::queriesPerSecond)
+			std::printf(", \"queriesPerSecond\": %.1f", 1e9 / result.throughput.nanoseconds);
+		std::printf(" }");
+		isFirst = false;
+	}
+	std::printf("\n\t]\n}\n");
+}
+
+int main(int argc, const char *argv[])
+{
+	Options options;
+	size_t streamElementCount = 512, parallelElementCount = (size_t)1 << 22;
+	for (int argI = 1; argI < argc; ++argI) {
+		const std::string argument = argv[argI];
+		const char *value = (argI + 1 < argc) ? argv[argI + 1] : nullptr;
+		bool takesValue = (argument == "--filter" || argument == "--samples" || argument == "--sample-time" || argument == "--count" || argument == "--parallel-count");
+		if (takesValue && value == nullptr) {
+			std::fprintf(stderr, "error: %s requires a value\n\n%s", argument.c_str(), usage);
+			return 2;
+		}
+		
+		if (argument == "--filter") options.filters.push_back(value);
+		else if (argument == "--samples") options.sampleCount = std::max(1, std::atoi(value));
+		else if (argument == "--sample-time") options.minimumSampleTime_ms = std::max(0.0, std::atof(value));
+		else if (argument == "--count") streamElementCount = (size_t)std::max(1L, std::atol(value));
+		else if (argument == "--parallel-count") parallelElementCount = (size_t)std::max(1L, std::atol(value));
+		else if (argument == "--json") options.json = true;
+		else if (argument == "--help" || argument == "-h") {
+			std::printf("%s", usage);
+			return 0;
+		}
+		else {
+			std::fprintf(stderr, "error: unknown option “%s”\n\n%s", argument.c_str(), usage);
+			return 2;
+		}
+		if (takesValue) ++argI;
+	}
+	
+	Runner runner(options);
+	if (!options.json)
+		Runner::printHeader(runner.hasHardwareCounters());
+	RunVectorBenchmarks(runner);
+	RunOperatorBenchmarks(runner);
+	RunMatrixBenchmarks(runner);
+	RunFastMathBenchmarks(runner);
+	RunIntegerOverflowBenchmarks(runner);
+	RunVectorStreamBenchmarks(runner, streamElementCount);
+	RunNarrowIntegerStreamBenchmarks(runner, streamElementCount);
+	RunHalfStreamBenchmarks(runner, streamElementCount);
+	RunDoubleStreamBenchmarks(runner, streamElementCount);
+	RunBoundsStreamBenchmarks(runner, streamElementCount);
+	RunBVHBenchmarks(runner, streamElementCount);
+	RunRayStreamBenchmarks(runner, streamElementCount);
+	RunBulkCodecBenchmarks(runner, streamElementCount);
+	RunCurveBenchmarks(runner, streamElementCount);
+	RunParallelBenchmarks(runner, parallelElementCount);
+	RunThreadPoolStressBenchmark(runner);
+	RunMatrixStreamBenchmarks(runner, streamElementCount);
+	RunQuaternionStreamBenchmarks(runner, streamElementCount);
+	RunEulerAngleBenchmarks(runner, streamElementCount);
+	if (options.json)
+		PrintJSON(runner);
+	return 0;
+}
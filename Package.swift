@@ -1,5 +1,6 @@
 // swift-tools-version:5.0
 import PackageDescription
+import Foundation
 
 
 
@@ -10,6 +11,11 @@ let isSimdAvailable: Bool
 	isSimdAvailable = false
 #endif // !canImport(simd)
 
+/// Set `VUCKT_SWIFT_BACKEND=1` to build the pure-Swift `*_NoObjCBridge.swift` implementations instead of the C backend (`VucktC`), e.g. for before/after benchmarking.
+let useSwiftBackend = (ProcessInfo.processInfo.environment["VUCKT_SWIFT_BACKEND"] ?? "0") != "0"
+
+let vectorTypeNames = [ "Float2", "Float3", "Float4", "FloatQuaternion", "Int2", "Int3", "Int4", "Float3x3", "Float4x4", "Float3SoA", "Float4SoA", "PackedFloat3", "Float4x3", "Char4", "UChar4", "Short2", "Short3", "Short4", "UShort4", "Half2", "Half3", "Half4", "Double2", "Double3", "Double4", "Double4x4", "AABB3", "Frustum", "Ray3", "BVH", "ArrayFile", "BulkCodec", "Curve", "Parallel" ]
+
 extension Array
 {
 	func appendingOnlyIfSimdUnavailable(_ element: Element) -> Self {
@@ -27,6 +33,8 @@ let package = Package(
 	name: "Vuckt",
 	products: [
 		.library(name: "Vuckt", targets: ["Vuckt"]),
+		.executable(name: "VucktBench", targets: ["VucktBench"]),
+		.executable(name: "VucktCBench", targets: ["VucktCBench"]),
 	],
 	dependencies: [
 		.package(url: "https://github.com/apple/swift-numerics", from: "1.1.1"),
@@ -34,40 +42,46 @@ let package = Package(
 		.package(url: "https://github.com/keyvariable/kvSIMD.swift.git", from: "1.1.0")
 	),
 	targets: [
+		.target(name: "VucktC",
+			path: "Sources/VucktC/",
+			sources: [ "Vuckt.c" ],
+			publicHeadersPath: "include"
+		),
 		.target(name: "Vuckt",
-			dependencies: []
+			dependencies: (useSwiftBackend ? [] : [ "VucktC" ] as [Target.Dependency])
 				.appendingOnlyIfSimdUnavailable(
 					.product(name: "kvSIMD", package: "kvSIMD.swift")
 				),
 			path: "Sources/",
-			sources: [
-				"Vuckt.swift",
-				"Float2/Float2_NoObjCBridge.swift",
-				"Float2/Float2.swift",
-				"Float3/Float3_NoObjCBridge.swift",
-				"Float3/Float3.swift",
-				"Float4/Float4_NoObjCBridge.swift",
-				"Float4/Float4.swift",
-				"FloatQuaternion/FloatQuaternion_NoObjCBridge.swift",
-				"FloatQuaternion/FloatQuaternion.swift",
-				"Int2/Int2_NoObjCBridge.swift",
-				"Int2/Int2.swift",
-				"Int3/Int3_NoObjCBridge.swift",
-				"Int3/Int3.swift",
-				"Int4/Int4_NoObjCBridge.swift",
-				"Int4/Int4.swift",
-				"Float3x3/Float3x3_NoObjCBridge.swift",
-				"Float3x3/Float3x3.swift",
-				"Float4x4/Float4x4_NoObjCBridge.swift",
-				"Float4x4/Float4x4.swift",
-			],
+			exclude: [ "VucktC" ],
+			sources: [ "Vuckt.swift" ]
+				+ (useSwiftBackend ? [] : [ "VucktPlatform.swift" ])
+				+ vectorTypeNames.flatMap{ typeName -> [String] in
+					useSwiftBackend
+						? [ "\(typeName)/\(typeName)_NoObjCBridge.swift", "\(typeName)/\(typeName).swift" ]
+						: [ "\(typeName)/\(typeName).swift" ]
+				},
 			swiftSettings: [ .define("NO_OBJC_BRIDGE") ]
 		),
+		.target(name: "VucktBench",
+			dependencies: ([ "Vuckt" ] as [Target.Dependency])
+				.appendingOnlyIfSimdUnavailable(
+					.product(name: "kvSIMD", package: "kvSIMD.swift")
+				),
+			path: "Benchmarks/VucktBench/",
+			swiftSettings: useSwiftBackend ? [ .define("VUCKT_SWIFT_BACKEND") ] : []
+		),
+		.target(name: "VucktCBench",
+			path: "Benchmarks/VucktCBench/",
+			sources: [ "main.cpp" ]
+		),
 		.testTarget(name: "VucktTests",
 			dependencies: [
 				"Vuckt",
 				.product(name: "Numerics", package: "swift-numerics"),
-			],
+			].appendingOnlyIfSimdUnavailable(
+				.product(name: "kvSIMD", package: "kvSIMD.swift")
+			),
 			path: "Tests/",
 			sources: [ "VucktTests.swift", "VucktPerformanceTests.swift" ],
 			swiftSettings: [ .define("NO_OBJC_BRIDGE") ]
@@ -77,5 +91,6 @@ let package = Package(
 		.version("4"),
 		.version("4.2"),
 		.version("5"),
-	]
+	],
+	cxxLanguageStandard: .cxx1z
 )
@@ -0,0 +1,186 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+#if __has_include(<Vuckt/Float4x4.h>)
+	#import <Vuckt/Float4x4.h>
+#else
+	#include "../Float4x4/Float4x4.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#include <math.h>
+#include <string.h>
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// An axis-aligned bounding box, as its minimum & maximum corners (32 bytes: two padded `Float3`s).
+/// The “empty” box (`AABB3Empty()`) has `min` at +∞ & `max` at −∞, so merging anything into it yields that thing's bounds.
+struct AABB3 {
+	Float3 min;
+	Float3 max;
+};
+typedef struct AABB3 AABB3;
+
+
+
+#pragma mark Construction & Queries
+
+NS_INLINE AABB3 AABB3Empty(void) {
+	return (AABB3){ { INFINITY, INFINITY, INFINITY }, { -INFINITY, -INFINITY, -INFINITY } };
+}
+/// The box centered on `center`, reaching `extents` (its half-size) out from it along each axis.
+NS_INLINE AABB3 AABB3FromCenterExtents(Float3 center, Float3 extents) {
+	return (AABB3){ Float3Subtract(center, extents), Float3Add(center, extents) };
+}
+NS_INLINE Float3 AABB3Center(AABB3 box) {
+	return Float3MultiplyByScalar(Float3Add(box.min, box.max), 0.5f);
+}
+/// Half of `box`'s size along each axis.
+NS_INLINE Float3 AABB3Extents(AABB3 box) {
+	return Float3MultiplyByScalar(Float3Subtract(box.max, box.min), 0.5f);
+}
+
+/// Whether `box` contains no points— any axis with `min` past `max` (as `AABB3Empty()` has).
+NS_INLINE bool AABB3IsEmpty(AABB3 box) {
+	return !(box.min.x <= box.max.x && box.min.y <= box.max.y && box.min.z <= box.max.z);
+}
+/// Whether `point` is within `box`, boundary included.
+NS_INLINE bool AABB3ContainsPoint(AABB3 box, Float3 point) {
+	return Float3LessThanOrEqual(box.min, point) && Float3LessThanOrEqual(point, box.max);
+}
+/// Whether `a` & `b` overlap, touching boundaries included.
+NS_INLINE bool AABB3Intersects(AABB3 a, AABB3 b) {
+	return Float3LessThanOrEqual(a.min, b.max) && Float3LessThanOrEqual(b.min, a.max);
+}
+
+
+
+#pragma mark Merging
+
+/// The smallest box containing both `a` & `b`.
+NS_INLINE AABB3 AABB3Merge(AABB3 a, AABB3 b) {
+	return (AABB3){
+		{ (b.min.x < a.min.x ? b.min.x : a.min.x), (b.min.y < a.min.y ? b.min.y : a.min.y), (b.min.z < a.min.z ? b.min.z : a.min.z) },
+		{ (b.max.x > a.max.x ? b.max.x : a.max.x), (b.max.y > a.max.y ? b.max.y : a.max.y), (b.max.z > a.max.z ? b.max.z : a.max.z) },
+	};
+}
+/// The smallest box containing both `box` & `point`.
+NS_INLINE AABB3 AABB3MergePoint(AABB3 box, Float3 point) {
+	return AABB3Merge(box, (AABB3){ point, point });
+}
+
+// Reductions over `n`-element arrays, returning `AABB3Empty()` for `n` = 0.
+// Each runs as a 4-lane min & max per element into accumulators carried across the whole array, with each `Float3`'s padding lane zeroed as it's loaded (it's never written by Vuckt, so may hold a NaN that would raise `FE_INVALID` in the comparisons).
+
+/// Loads `point`'s full (padded) width as a vector, its 4th lane 0.
+NS_INLINE simd_float4 _AABB3LoadLanes(const Float3 *point) {
+	simd_float4 lanes;
+	memcpy(&lanes, point, sizeof(simd_float4));
+	return (simd_float4)((simd_int4)lanes & (simd_int4){ -1, -1, -1, 0 });
+}
+
+/// The smallest box containing every one of `points`.
+NS_INLINE AABB3 AABB3FromPoints(const Float3 *points, size_t n) {
+	simd_float4 minimum = { INFINITY, INFINITY, INFINITY, INFINITY }, maximum = -minimum;
+	for (size_t i = 0; i < n; ++i) {
+		simd_float4 point = _AABB3LoadLanes(&points[i]);
+		minimum = vuckt_simd_select4(point < minimum, point, minimum);
+		maximum = vuckt_simd_select4(point > maximum, point, maximum);
+	}
+	return (AABB3){ { minimum[0], minimum[1], minimum[2] }, { maximum[0], maximum[1], maximum[2] } };
+}
+/// The smallest box containing every one of `boxes`.
+NS_INLINE AABB3 AABB3MergeArray(const AABB3 *boxes, size_t n) {
+	simd_float4 minimum = { INFINITY, INFINITY, INFINITY, INFINITY }, maximum = -minimum;
+	for (size_t i = 0; i < n; ++i) {
+		simd_float4 boxMinimum = _AABB3LoadLanes(&boxes[i].min), boxMaximum = _AABB3LoadLanes(&boxes[i].max);
+		minimum = vuckt_simd_select4(boxMinimum < minimum, boxMinimum, minimum);
+		maximum = vuckt_simd_select4(boxMaximum > maximum, boxMaximum, maximum);
+	}
+	return (AABB3){ { minimum[0], minimum[1], minimum[2] }, { maximum[0], maximum[1], maximum[2] } };
+}
+
+
+
+#pragma mark Transformation
+
+// Arvo's method (“Transforming Axis-Aligned Bounding Boxes”, Graphics Gems, 1990), in its center/extents form: the new center is `m` times the old, & each new extent is the old extents dotted with the absolute values of that row of `m`'s upper-left 3×3.
+// That is the exact bounds of the transformed box's 8 corners, for 2 column-broadcast multiplies rather than 8.
+// `m` must be affine (bottom row 0, 0, 0, 1), & `box` non-empty (whose infinities would become NaNs).
+
+/// The smallest axis-aligned box containing `box` transformed by `m`.
+NS_INLINE AABB3 AABB3Transform(AABB3 box, Float4x4 m) {
+	simd_float4x4 m_simd = Float4x4ToSimd(m);
+	simd_float4 c0 = m_simd.columns[0], c1 = m_simd.columns[1], c2 = m_simd.columns[2], c3 = m_simd.columns[3];
+	Float3 center = AABB3Center(box), extents = AABB3Extents(box);
+	simd_float4 newCenter = c0 * center.x + c1 * center.y + c2 * center.z + c3;
+	simd_float4 newExtents = vuckt_simd_abs4(c0) * extents.x + vuckt_simd_abs4(c1) * extents.y + vuckt_simd_abs4(c2) * extents.z;
+	simd_float4 newMinimum = newCenter - newExtents, newMaximum = newCenter + newExtents;
+	return (AABB3){ { newMinimum[0], newMinimum[1], newMinimum[2] }, { newMaximum[0], newMaximum[1], newMaximum[2] } };
+}
+/// `out[i] = AABB3Transform(boxes[i], m)`, with `m`'s absolute columns computed once for the whole batch.  `out` may be the same array as `boxes`, but must not otherwise overlap it.
+NS_INLINE void AABB3TransformArray(const AABB3 *boxes, Float4x4 m, AABB3 *out, size_t n) {
+	simd_float4x4 m_simd = Float4x4ToSimd(m);
+	simd_float4 c0 = m_simd.columns[0], c1 = m_simd.columns[1], c2 = m_simd.columns[2], c3 = m_simd.columns[3];
+	simd_float4 a0 = vuckt_simd_abs4(c0), a1 = vuckt_simd_abs4(c1), a2 = vuckt_simd_abs4(c2);
+	for (size_t i = 0; i < n; ++i) {
+		Float3 center = AABB3Center(boxes[i]), extents = AABB3Extents(boxes[i]);
+		simd_float4 newCenter = c0 * center.x + c1 * center.y + c2 * center.z + c3;
+		simd_float4 newExtents = a0 * extents.x + a1 * extents.y + a2 * extents.z;
+		simd_float4 newMinimum = newCenter - newExtents, newMaximum = newCenter + newExtents;
+		memcpy(&out[i].min, &newMinimum, sizeof(Float3));
+		memcpy(&out[i].max, &newMaximum, sizeof(Float3));
+	}
+}
+
+
+
+#pragma mark Lanes
+
+/// 4 boxes transposed for batch kernels, as centers & extents: lane `l` of each vector is for the `l`th box.
+/// An empty box's center & extents are meaningless (`AABB3Empty()`'s come out NaN & −∞), so `emptyMask` flags those lanes (all-ones where `AABB3IsEmpty()`, else 0).
+typedef struct AABB3Lanes {
+	simd_float4 centerX, centerY, centerZ;
+	simd_float4 extentX, extentY, extentZ;
+	simd_int4 emptyMask;
+} AABB3Lanes;
+
+/// Transposes `boxes[0..<count]` (`count` ≤ 4) into lanes, repeating the last box in any lanes past `count`.
+NS_INLINE AABB3Lanes AABB3LanesLoad(const AABB3 *boxes, size_t count) {
+	simd_float4 minimums[4], maximums[4];
+	for (size_t laneI = 0; laneI < 4; ++laneI) {
+		const AABB3 *box = &boxes[(laneI < count) ? laneI : count - 1];
+		memcpy(&minimums[laneI], &box->min, sizeof(simd_float4));
+		memcpy(&maximums[laneI], &box->max, sizeof(simd_float4));
+	}
+	vuckt_simd_transpose4(&minimums[0], &minimums[1], &minimums[2], &minimums[3]);
+	vuckt_simd_transpose4(&maximums[0], &maximums[1], &maximums[2], &maximums[3]);
+	return (AABB3Lanes){
+		(minimums[0] + maximums[0]) * 0.5f, (minimums[1] + maximums[1]) * 0.5f, (minimums[2] + maximums[2]) * 0.5f,
+		(maximums[0] - minimums[0]) * 0.5f, (maximums[1] - minimums[1]) * 0.5f, (maximums[2] - minimums[2]) * 0.5f,
+		~((minimums[0] <= maximums[0]) & (minimums[1] <= maximums[1]) & (minimums[2] <= maximums[2])),
+	};
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,14 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "AABB3.h"
+
+
+
+#pragma mark Struct Layout Sanity Checks
+
+static_assert(offsetof(AABB3, max) == sizeof(simd_float4),
+	"AABB3's max corner does not start 1 simd_float4 in on this platform (which the lane loads rely on).");
+static_assert(sizeof(AABB3) == 2 * sizeof(simd_float4),
+	"AABB3's size does not match 2 simd_float4s' on this platform (which the lane loads rely on).");
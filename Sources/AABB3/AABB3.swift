@@ -0,0 +1,170 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+/// Axis-aligned bounding box, as its minimum & maximum corners.
+extension AABB3
+{
+	// MARK: `init`s
+	
+	/// Initialize to the box centered on `center`, reaching `extents` (its half-size) out from it along each axis.
+	@_transparent public init(center:Float3, extents:Float3) {
+		self = AABB3FromCenterExtents(center, extents)
+	}
+	
+	/// Initialize to the smallest box containing every one of `points` (or to `.empty` if there are none).
+	@_alwaysEmitIntoClient public init(containing points:[Float3]) {
+		self = points.withUnsafeBufferPointer{ AABB3(containing: $0) }
+	}
+	/// Initialize to the smallest box containing every one of `points` (or to `.empty` if there are none).
+	@_alwaysEmitIntoClient public init(containing points:UnsafeBufferPointer<Float3>) {
+		self = (points.count > 0) ? AABB3FromPoints(points.baseAddress!, points.count) : AABB3Empty()
+	}
+	
+	/// Initialize to the smallest box containing every one of `boxes` (or to `.empty` if there are none).
+	@_alwaysEmitIntoClient public init(merging boxes:[AABB3]) {
+		self = boxes.withUnsafeBufferPointer{ AABB3(merging: $0) }
+	}
+	/// Initialize to the smallest box containing every one of `boxes` (or to `.empty` if there are none).
+	@_alwaysEmitIntoClient public init(merging boxes:UnsafeBufferPointer<AABB3>) {
+		self = (boxes.count > 0) ? AABB3MergeArray(boxes.baseAddress!, boxes.count) : AABB3Empty()
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	/// The box containing nothing (`min` at +∞ & `max` at −∞), which merging anything into yields that thing's bounds.
+	@_transparent public static var empty:AABB3 { return AABB3Empty() }
+	
+	
+	// MARK: Center/Extents Form
+	
+	@_transparent public var center:Float3 {
+		return AABB3Center(self)
+	}
+	/// Half of the box's size along each axis.
+	@_transparent public var extents:Float3 {
+		return AABB3Extents(self)
+	}
+	@_transparent public var size:Float3 {
+		return self.max - self.min
+	}
+	
+	
+	// MARK: Is… Flags
+	
+	/// Whether the box contains no points— any axis with `min` past `max` (as `.empty` has).
+	@_transparent public var isEmpty:Bool {
+		return AABB3IsEmpty(self)
+	}
+	
+	
+	// MARK: Queries
+	
+	/// Whether `point` is within the box, boundary included.
+	@_transparent public func contains(_ point:Float3) -> Bool {
+		return AABB3ContainsPoint(self, point)
+	}
+	/// Whether the box & `other` overlap, touching boundaries included.
+	@_transparent public func intersects(_ other:AABB3) -> Bool {
+		return AABB3Intersects(self, other)
+	}
+}
+
+
+extension AABB3 : CustomStringConvertible
+{
+	public var description:String {
+		return "[\(self.min) … \(self.max)]"
+	}
+}
+
+
+extension AABB3 : Equatable
+{
+	@_transparent public static func ==(a:AABB3, b:AABB3) -> Bool {
+		return a.min == b.min && a.max == b.max
+	}
+}
+
+
+extension AABB3 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			hasher.combine(self.min)
+			hasher.combine(self.max)
+		}
+	#else
+		public var hashValue:Int {
+			return self.min.hashValue &* 31 &+ self.max.hashValue
+		}
+	#endif
+}
+
+
+extension AABB3 // Merging
+{
+	/// The smallest box containing both this box & `other`.
+	@_transparent public func merged(with other:AABB3) -> AABB3 {
+		return AABB3Merge(self, other)
+	}
+	/// Grows the box to contain `other`.
+	@_transparent public mutating func merge(with other:AABB3) {
+		self = self.merged(with: other)
+	}
+	
+	/// The smallest box containing both this box & `point`.
+	@_transparent public func merged(with point:Float3) -> AABB3 {
+		return AABB3MergePoint(self, point)
+	}
+	/// Grows the box to contain `point`.
+	@_transparent public mutating func merge(with point:Float3) {
+		self = self.merged(with: point)
+	}
+}
+
+
+extension AABB3 // Transformation
+{
+	/// The smallest axis-aligned box containing this box transformed by `transform` (via Arvo's method: exact, without transforming all 8 corners).
+	/// - Precondition: `transform` must be affine, & the box non-empty.
+	@_transparent public func transformed(by transform:Float4x4) -> AABB3 {
+		return AABB3Transform(self, transform)
+	}
+	/// - Precondition: `transform` must be affine, & the box non-empty.
+	@_transparent public mutating func transform(by transform:Float4x4) {
+		self = self.transformed(by: transform)
+	}
+}
+
+extension UnsafeBufferPointer where Element == AABB3 // Transformation
+{
+	/// Writes each box transformed by `transform` (see `AABB3.transformed(by:)`) into `out`.  (Both buffers must have the same count; they may be the same buffer, but must not otherwise overlap.)
+	@_alwaysEmitIntoClient public func transform(by transform:Float4x4, into out:UnsafeMutableBufferPointer<AABB3>) {
+		self._vucktBulkOperation(into: out){ AABB3TransformArray($0, transform, $1, $2) }
+	}
+}
+
+extension Array where Element == AABB3 // Transformation
+{
+	/// Each box transformed by `transform`— see `AABB3.transformed(by:)`.
+	@_alwaysEmitIntoClient public func transformed(by transform:Float4x4) -> [AABB3] {
+		return self._vucktBulkOperation{ AABB3TransformArray($0, transform, $1, $2) }
+	}
+	@_alwaysEmitIntoClient public mutating func transform(by transform:Float4x4) {
+		self._vucktFormBulkOperation{ AABB3TransformArray($0, transform, $1, $2) }
+	}
+}
@@ -0,0 +1,102 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct AABB3
+{
+	public var min:Float3
+	public var max:Float3
+	
+	public init() {
+		self.min = Float3()
+		self.max = Float3()
+	}
+	
+	public init(min:Float3, max:Float3) {
+		self.min = min
+		self.max = max
+	}
+}
+
+
+
+// MARK: Construction & Queries
+
+@_transparent public func AABB3Empty() -> AABB3 {
+	return AABB3(min: Float3(.infinity, .infinity, .infinity), max: Float3(-.infinity, -.infinity, -.infinity))
+}
+@_transparent public func AABB3FromCenterExtents(_ center:Float3, _ extents:Float3) -> AABB3 {
+	return AABB3(min: center - extents, max: center + extents)
+}
+@_transparent public func AABB3Center(_ box:AABB3) -> Float3 {
+	return (box.min + box.max) * 0.5
+}
+@_transparent public func AABB3Extents(_ box:AABB3) -> Float3 {
+	return (box.max - box.min) * 0.5
+}
+
+@_transparent public func AABB3IsEmpty(_ box:AABB3) -> Bool {
+	return !(box.min.x <= box.max.x && box.min.y <= box.max.y && box.min.z <= box.max.z)
+}
+@_transparent public func AABB3ContainsPoint(_ box:AABB3, _ point:Float3) -> Bool {
+	return box.min <= point && point <= box.max
+}
+@_transparent public func AABB3Intersects(_ a:AABB3, _ b:AABB3) -> Bool {
+	return a.min <= b.max && b.min <= a.max
+}
+
+
+
+// MARK: Merging
+
+@_transparent public func AABB3Merge(_ a:AABB3, _ b:AABB3) -> AABB3 {
+	return AABB3(min: min(a.min, b.min), max: max(a.max, b.max))
+}
+@_transparent public func AABB3MergePoint(_ box:AABB3, _ point:Float3) -> AABB3 {
+	return AABB3Merge(box, AABB3(min: point, max: point))
+}
+
+@_alwaysEmitIntoClient public func AABB3FromPoints(_ points:UnsafePointer<Float3>, _ n:Int) -> AABB3 {
+	var bounds = AABB3Empty()
+	for i in 0..<n {
+		bounds = AABB3MergePoint(bounds, points[i])
+	}
+	return bounds
+}
+@_alwaysEmitIntoClient public func AABB3MergeArray(_ boxes:UnsafePointer<AABB3>, _ n:Int) -> AABB3 {
+	var bounds = AABB3Empty()
+	for i in 0..<n {
+		bounds = AABB3Merge(bounds, boxes[i])
+	}
+	return bounds
+}
+
+
+
+// MARK: Transformation
+
+@_alwaysEmitIntoClient public func AABB3Transform(_ box:AABB3, _ m:Float4x4) -> AABB3 {
+	let center = AABB3Center(box), extents = AABB3Extents(box)
+	let newCenter = (m.c0 * center.x + m.c1 * center.y + m.c2 * center.z + m.c3).xyz
+	let newExtents = Float3(
+		abs(m.m00) * extents.x + abs(m.m10) * extents.y + abs(m.m20) * extents.z,
+		abs(m.m01) * extents.x + abs(m.m11) * extents.y + abs(m.m21) * extents.z,
+		abs(m.m02) * extents.x + abs(m.m12) * extents.y + abs(m.m22) * extents.z
+	)
+	return AABB3(min: newCenter - newExtents, max: newCenter + newExtents)
+}
+@_alwaysEmitIntoClient public func AABB3TransformArray(_ boxes:UnsafePointer<AABB3>, _ m:Float4x4, _ out:UnsafeMutablePointer<AABB3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = AABB3Transform(boxes[i], m)
+	}
+}
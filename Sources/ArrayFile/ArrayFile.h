@@ -0,0 +1,150 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#include <stdint.h>
+#include <string.h>
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+// A binary container for one array of a Vuckt type, laid out so it can be memory-mapped & used in place: a 64-byte header, then (at `dataOffset`, a multiple of the elements' alignment) `count` elements, `stride` bytes apart, exactly as they're laid out in memory.
+// Files are written in the writer's byte order, which the header records; a reader with the other byte order rejects them rather than swapping.
+// A file's element data is only as portable as the type's layout: e.g. `Float3` is 16 bytes (padded) in the C backend but 12 in the pure-Swift one, which the header's `stride` catches.
+
+
+
+#pragma mark Format Constants
+
+/// The format version this header describes (bumped on any incompatible change).
+#define VUCKT_ARRAY_FILE_VERSION 1
+/// The header's size (& the least `dataOffset`).
+#define VUCKT_ARRAY_FILE_HEADER_SIZE 64
+/// `byteOrderMark`'s value, as read back in the writer's byte order (so `0x04030201` in the other).
+#define VUCKT_ARRAY_FILE_BYTE_ORDER_MARK 0x01020304u
+
+// Element type tags.  (Tag 0 is untyped data, for other element types; the rest are fixed for good.)
+#define VUCKT_ARRAY_FILE_TYPE_UNTYPED 0
+#define VUCKT_ARRAY_FILE_TYPE_FLOAT2 1
+#define VUCKT_ARRAY_FILE_TYPE_FLOAT3 2
+#define VUCKT_ARRAY_FILE_TYPE_FLOAT4 3
+#define VUCKT_ARRAY_FILE_TYPE_FLOAT_QUATERNION 4
+#define VUCKT_ARRAY_FILE_TYPE_FLOAT3X3 5
+#define VUCKT_ARRAY_FILE_TYPE_FLOAT4X4 6
+#define VUCKT_ARRAY_FILE_TYPE_FLOAT4X3 7
+#define VUCKT_ARRAY_FILE_TYPE_PACKED_FLOAT3 8
+#define VUCKT_ARRAY_FILE_TYPE_INT2 9
+#define VUCKT_ARRAY_FILE_TYPE_INT3 10
+#define VUCKT_ARRAY_FILE_TYPE_INT4 11
+#define VUCKT_ARRAY_FILE_TYPE_CHAR4 12
+#define VUCKT_ARRAY_FILE_TYPE_UCHAR4 13
+#define VUCKT_ARRAY_FILE_TYPE_SHORT2 14
+#define VUCKT_ARRAY_FILE_TYPE_SHORT3 15
+#define VUCKT_ARRAY_FILE_TYPE_SHORT4 16
+#define VUCKT_ARRAY_FILE_TYPE_USHORT4 17
+#define VUCKT_ARRAY_FILE_TYPE_HALF2 18
+#define VUCKT_ARRAY_FILE_TYPE_HALF3 19
+#define VUCKT_ARRAY_FILE_TYPE_HALF4 20
+#define VUCKT_ARRAY_FILE_TYPE_DOUBLE2 21
+#define VUCKT_ARRAY_FILE_TYPE_DOUBLE3 22
+#define VUCKT_ARRAY_FILE_TYPE_DOUBLE4 23
+#define VUCKT_ARRAY_FILE_TYPE_DOUBLE4X4 24
+#define VUCKT_ARRAY_FILE_TYPE_AABB3 25
+#define VUCKT_ARRAY_FILE_TYPE_RAY3 26
+
+// Validation codes returned by `ArrayFileHeaderValidate()` (matching the Swift `ArrayFileError` enum's raw values).
+//	0: valid.
+//	1: not an array file— too short for a header, or the wrong magic.
+//	2: a format version this code doesn't read.
+//	3: written in the other byte order.
+//	4: a bad layout— a zero stride, an alignment that isn't a power of 2, or a `dataOffset` inside the header or not a multiple of the alignment.
+//	5: truncated— shorter than its elements' data.
+//	6: a different element type tag than expected.
+//	7: a different element stride than expected (e.g. the same type, from a build with another layout for it).
+//	8: a `dataOffset` that isn't a multiple of the expected alignment.
+
+
+
+#pragma mark Struct Definition
+
+/// The 64-byte header at the start of an array file.
+struct ArrayFileHeader {
+	/// `"VucktArr"`, in ASCII.
+	uint8_t magic[8];
+	uint32_t version;
+	/// `VUCKT_ARRAY_FILE_BYTE_ORDER_MARK`, in the writer's byte order.
+	uint32_t byteOrderMark;
+	/// One of the `VUCKT_ARRAY_FILE_TYPE_…` tags.
+	uint32_t typeTag;
+	/// The bytes from one element to the next.
+	uint32_t stride;
+	/// The alignment the elements need in memory (a power of 2), which `dataOffset` is a multiple of.
+	uint32_t alignment;
+	uint32_t reserved0;
+	uint64_t count;
+	/// Where the first element starts, from the start of the file.
+	uint64_t dataOffset;
+	uint8_t reserved1[16];
+};
+typedef struct ArrayFileHeader ArrayFileHeader;
+
+
+
+#pragma mark Header Construction & Validation
+
+/// The header for `count` elements tagged `typeTag`, `stride` bytes apart & needing `alignment` (a power of 2), placed at the first multiple of `alignment` past the header.
+NS_INLINE ArrayFileHeader ArrayFileHeaderMake(uint32_t typeTag, uint32_t stride, uint32_t alignment, uint64_t count) {
+	ArrayFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "VucktArr", sizeof(header.magic));
+	header.version = VUCKT_ARRAY_FILE_VERSION;
+	header.byteOrderMark = VUCKT_ARRAY_FILE_BYTE_ORDER_MARK;
+	header.typeTag = typeTag;
+	header.stride = stride;
+	header.alignment = alignment;
+	header.count = count;
+	header.dataOffset = ((uint64_t)VUCKT_ARRAY_FILE_HEADER_SIZE + alignment - 1) / alignment * alignment;
+	return header;
+}
+
+/// The size of the file `header` heads: through the end of its last element.
+NS_INLINE uint64_t ArrayFileSize(ArrayFileHeader header) {
+	return header.dataOffset + header.count * header.stride;
+}
+
+/// The validation code (see above) of a file of `fileSize` bytes starting with `header` (read from its first `VUCKT_ARRAY_FILE_HEADER_SIZE` bytes, or zeroed if the file's shorter), to be read as elements tagged `expectedTypeTag`, `expectedStride` bytes apart & needing `expectedAlignment` (a power of 2).
+NS_INLINE uint32_t ArrayFileHeaderValidate(ArrayFileHeader header, uint64_t fileSize, uint32_t expectedTypeTag, uint32_t expectedStride, uint32_t expectedAlignment) {
+	if (fileSize < VUCKT_ARRAY_FILE_HEADER_SIZE || memcmp(header.magic, "VucktArr", sizeof(header.magic)) != 0)
+		return 1;
+	if (header.byteOrderMark != VUCKT_ARRAY_FILE_BYTE_ORDER_MARK)
+		return (header.byteOrderMark == 0x04030201u) ? 3 : 1;
+	if (header.version != VUCKT_ARRAY_FILE_VERSION)
+		return 2;
+	if (header.stride == 0 || header.alignment == 0 || (header.alignment & (header.alignment - 1)) != 0
+		|| header.dataOffset < VUCKT_ARRAY_FILE_HEADER_SIZE || header.dataOffset % header.alignment != 0)
+		return 4;
+	if (header.dataOffset > fileSize || header.count > (fileSize - header.dataOffset) / header.stride)
+		return 5;
+	if (header.typeTag != expectedTypeTag)
+		return 6;
+	if (header.stride != expectedStride)
+		return 7;
+	if (header.dataOffset % expectedAlignment != 0)
+		return 8;
+	return 0;
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,14 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "ArrayFile.h"
+
+
+
+#pragma mark Struct Layout Sanity Checks
+
+static_assert(sizeof(ArrayFileHeader) == VUCKT_ARRAY_FILE_HEADER_SIZE,
+	"ArrayFileHeader's size does not match the format's header size on this platform.");
+static_assert(offsetof(ArrayFileHeader, count) == 32 && offsetof(ArrayFileHeader, dataOffset) == 40,
+	"ArrayFileHeader's 64-bit fields are not at the format's offsets on this platform.");
@@ -0,0 +1,276 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(Darwin)
+	import Darwin
+#elseif canImport(Glibc)
+	import Glibc
+#endif
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+/// A Vuckt type that can be stored in an array file (see `ArrayFile.h`), under a fixed type tag.
+public protocol ArrayFileElement
+{
+	/// The `VUCKT_ARRAY_FILE_TYPE_…` tag files of this type are written with, & checked for when read.
+	static var arrayFileTypeTag:UInt32 { get }
+}
+
+extension Float2 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_FLOAT2) } }
+extension Float3 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_FLOAT3) } }
+extension Float4 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_FLOAT4) } }
+extension FloatQuaternion : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_FLOAT_QUATERNION) } }
+extension Float3x3 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_FLOAT3X3) } }
+extension Float4x4 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_FLOAT4X4) } }
+extension Float4x3 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_FLOAT4X3) } }
+extension PackedFloat3 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_PACKED_FLOAT3) } }
+extension Int2 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_INT2) } }
+extension Int3 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_INT3) } }
+extension Int4 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_INT4) } }
+extension Char4 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_CHAR4) } }
+extension UChar4 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_UCHAR4) } }
+extension Short2 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_SHORT2) } }
+extension Short3 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_SHORT3) } }
+extension Short4 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_SHORT4) } }
+extension UShort4 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_USHORT4) } }
+extension Half2 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_HALF2) } }
+extension Half3 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_HALF3) } }
+extension Half4 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_HALF4) } }
+extension Double2 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_DOUBLE2) } }
+extension Double3 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_DOUBLE3) } }
+extension Double4 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_DOUBLE4) } }
+extension Double4x4 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_DOUBLE4X4) } }
+extension AABB3 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_AABB3) } }
+extension Ray3 : ArrayFileElement { @_transparent public static var arrayFileTypeTag:UInt32 { return UInt32(VUCKT_ARRAY_FILE_TYPE_RAY3) } }
+
+
+
+/// Why an array file couldn't be read as the requested element type.  (The raw values are `ArrayFileHeaderValidate()`'s codes.)
+/// I/O failures are thrown as `POSIXError`s instead.
+public enum ArrayFileError : UInt32, Error
+{
+	/// Too short for a header, or not starting with one.
+	case notAnArrayFile = 1
+	/// Written in a format version this code doesn't read.
+	case unsupportedVersion = 2
+	/// Written on a machine with the other byte order.
+	case byteOrderMismatch = 3
+	/// A header with a nonsensical stride, alignment, or data offset.
+	case badLayout = 4
+	/// Shorter than the header says its elements need.
+	case truncated = 5
+	/// Holding a different element type.
+	case typeMismatch = 6
+	/// Holding the same element type, but laid out with a different stride (e.g. from a build with the other backend).
+	case strideMismatch = 7
+	/// Holding elements at an offset that isn't aligned for the element type.
+	case alignmentMismatch = 8
+}
+
+@usableFromInline internal func _vucktPOSIXError() -> POSIXError {
+	return POSIXError(POSIXErrorCode(rawValue: errno) ?? .EIO)
+}
+
+
+
+/// An array file, memory-mapped read-only & viewed in place as its elements— nothing's copied or decoded, & pages are only read in as they're touched, so files larger than RAM can be walked.
+/// The mapping (& so `elements`) lives as long as this object does.
+public final class MappedArrayFile<Element : ArrayFileElement> : RandomAccessCollection
+{
+	/// The file's header.
+	public let header:ArrayFileHeader
+	/// The file's elements, in the mapped memory; the base address is aligned for `Element` (& to at least 16 bytes for the SIMD types).
+	public let elements:UnsafeBufferPointer<Element>
+	
+	private let mapping:UnsafeMutableRawPointer
+	private let mappingSize:Int
+	
+	
+	// MARK: `init`s & `deinit`
+	
+	/// Map the array file at `path`, throwing an `ArrayFileError` if it isn't one of `Element`s laid out as this build lays them out, or a `POSIXError` if it can't be opened or mapped.
+	public init(path:String) throws {
+		let fileDescriptor = open(path, O_RDONLY)
+		guard fileDescriptor >= 0 else { throw _vucktPOSIXError() }
+		defer { close(fileDescriptor) }
+		
+		var fileStatus = stat()
+		guard fstat(fileDescriptor, &fileStatus) == 0 else { throw _vucktPOSIXError() }
+		let fileSize = Int(fileStatus.st_size)
+		guard fileSize >= Int(VUCKT_ARRAY_FILE_HEADER_SIZE) else { throw ArrayFileError.notAnArrayFile }
+		
+		let mapping = mmap(nil, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0)
+		guard let mapping = mapping, mapping != UnsafeMutableRawPointer(bitPattern: -1) else { throw _vucktPOSIXError() }
+		
+		var header = ArrayFileHeader()
+		withUnsafeMutableBytes(of: &header){ $0.copyMemory(from: UnsafeRawBufferPointer(start: mapping, count: Int(VUCKT_ARRAY_FILE_HEADER_SIZE))) }
+		let validation = ArrayFileHeaderValidate(header, UInt64(fileSize), Element.arrayFileTypeTag, UInt32(MemoryLayout<Element>.stride), UInt32(MemoryLayout<Element>.alignment))
+		guard validation == 0 else {
+			munmap(mapping, fileSize)
+			throw ArrayFileError(rawValue: validation)!
+		}
+		
+		let count = Int(header.count)
+		self.header = header
+		self.elements = UnsafeBufferPointer(start: (count > 0) ? UnsafeRawPointer(mapping + Int(header.dataOffset)).bindMemory(to: Element.self, capacity: count) : nil, count: count)
+		self.mapping = mapping
+		self.mappingSize = fileSize
+	}
+	
+	deinit {
+		munmap(self.mapping, self.mappingSize)
+	}
+	
+	
+	// MARK: Element Access
+	
+	@_transparent public var startIndex:Int { return 0 }
+	@_transparent public var endIndex:Int { return self.elements.count }
+	
+	@_transparent public subscript(index:Int) -> Element {
+		return self.elements[index]
+	}
+	
+	/// Calls `body` with the mapped elements, for passing to the bulk operations.  (The buffer is only valid during the call, unless this object's kept alive.)
+	@_alwaysEmitIntoClient public func withUnsafeBufferPointer<Result>(_ body:(UnsafeBufferPointer<Element>) throws -> Result) rethrows -> Result {
+		return try withExtendedLifetime(self){ try body(self.elements) }
+	}
+}
+
+
+
+/// Streams `Element`s out to a new array file at `path`, through a fixed-size buffer, so files larger than RAM can be written from data produced piecemeal.
+/// The header's count is only filled in by `finish()`; until then (or if this is discarded without it), the file doesn't read back as an array file.
+public final class ArrayFileWriter<Element : ArrayFileElement>
+{
+	/// The number of elements appended so far.
+	public private(set) var count:Int = 0
+	
+	private var fileDescriptor:Int32
+	private var header:ArrayFileHeader
+	private let buffer:UnsafeMutableRawBufferPointer
+	private var bufferedByteCount:Int = 0
+	
+	
+	// MARK: `init`s & `deinit`
+	
+	/// Create (or truncate) the file at `path`, buffering appends `bufferSize` bytes at a time (appends at least that big skip the buffer).
+	public init(path:String, bufferSize:Int = 1 << 20) throws {
+		precondition(bufferSize >= MemoryLayout<Element>.stride, "Buffer must hold at least 1 element.")
+		
+		let fileDescriptor = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0o644)
+		guard fileDescriptor >= 0 else { throw _vucktPOSIXError() }
+		
+		self.fileDescriptor = fileDescriptor
+		self.header = ArrayFileHeaderMake(Element.arrayFileTypeTag, UInt32(MemoryLayout<Element>.stride), UInt32(MemoryLayout<Element>.alignment), 0)
+		self.buffer = UnsafeMutableRawBufferPointer.allocate(byteCount: bufferSize, alignment: MemoryLayout<Element>.alignment)
+		
+		// Zeros up to the data, for now; `finish()` writes the real header over them.
+		let placeholder = [UInt8](repeating: 0, count: Int(self.header.dataOffset))
+		do {
+			try placeholder.withUnsafeBytes{ try self.writeFully($0) }
+		} catch {
+			close(fileDescriptor)
+			self.fileDescriptor = -1
+			throw error
+		}
+	}
+	
+	deinit {
+		if self.fileDescriptor >= 0 {
+			close(self.fileDescriptor)
+		}
+		self.buffer.deallocate()
+	}
+	
+	
+	// MARK: Writing
+	
+	/// Appends `element`.
+	public func append(_ element:Element) throws {
+		try withUnsafePointer(to: element){ try self.append(contentsOf: UnsafeBufferPointer(start: $0, count: 1)) }
+	}
+	
+	/// Appends `elements`.
+	public func append(contentsOf elements:UnsafeBufferPointer<Element>) throws {
+		precondition(self.fileDescriptor >= 0, "Can't append to a finished array file.")
+		let bytes = UnsafeRawBufferPointer(elements)
+		if self.bufferedByteCount + bytes.count > self.buffer.count {
+			try self.flush()
+		}
+		if bytes.count >= self.buffer.count {
+			try self.writeFully(bytes)
+		}
+		else if bytes.count > 0 {
+			UnsafeMutableRawBufferPointer(rebasing: self.buffer[self.bufferedByteCount..<(self.bufferedByteCount + bytes.count)]).copyMemory(from: bytes)
+			self.bufferedByteCount += bytes.count
+		}
+		self.count += elements.count
+	}
+	/// Appends `elements`.
+	public func append(contentsOf elements:[Element]) throws {
+		try elements.withUnsafeBufferPointer{ try self.append(contentsOf: $0) }
+	}
+	
+	/// Writes out the buffered elements & the header, & closes the file.  Nothing can be appended after.
+	public func finish() throws {
+		precondition(self.fileDescriptor >= 0, "Array file already finished.")
+		try self.flush()
+		
+		self.header.count = UInt64(self.count)
+		guard lseek(self.fileDescriptor, 0, SEEK_SET) == 0 else { throw _vucktPOSIXError() }
+		try withUnsafeBytes(of: self.header){ try self.writeFully($0) }
+		
+		let result = close(self.fileDescriptor)
+		self.fileDescriptor = -1
+		guard result == 0 else { throw _vucktPOSIXError() }
+	}
+	
+	
+	// MARK: Internal Helpers
+	
+	private func flush() throws {
+		guard self.bufferedByteCount > 0 else { return }
+		try self.writeFully(UnsafeRawBufferPointer(rebasing: self.buffer[0..<self.bufferedByteCount]))
+		self.bufferedByteCount = 0
+	}
+	
+	private func writeFully(_ bytes:UnsafeRawBufferPointer) throws {
+		var writtenCount = 0
+		while writtenCount < bytes.count {
+			let result = write(self.fileDescriptor, bytes.baseAddress! + writtenCount, bytes.count - writtenCount)
+			if result < 0 {
+				if errno == EINTR { continue }
+				throw _vucktPOSIXError()
+			}
+			writtenCount += result
+		}
+	}
+}
+
+
+
+extension Array where Element : ArrayFileElement // Array Files
+{
+	/// Initialize by copying the elements out of the array file at `path` (see `MappedArrayFile` to use them in place instead).
+	public init(contentsOfArrayFile path:String) throws {
+		self = try MappedArrayFile<Element>(path: path).withUnsafeBufferPointer{ Array($0) }
+	}
+	
+	/// Write the elements out to a new array file at `path`.
+	public func write(toArrayFile path:String) throws {
+		let writer = try ArrayFileWriter<Element>(path: path, bufferSize: MemoryLayout<Element>.stride)
+		try writer.append(contentsOf: self)
+		try writer.finish()
+	}
+}
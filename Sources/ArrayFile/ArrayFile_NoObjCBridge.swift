@@ -0,0 +1,126 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+
+
+// MARK: Format Constants
+
+public let VUCKT_ARRAY_FILE_VERSION:Int32 = 1
+public let VUCKT_ARRAY_FILE_HEADER_SIZE:Int32 = 64
+public let VUCKT_ARRAY_FILE_BYTE_ORDER_MARK:UInt32 = 0x01020304
+
+public let VUCKT_ARRAY_FILE_TYPE_UNTYPED:Int32 = 0
+public let VUCKT_ARRAY_FILE_TYPE_FLOAT2:Int32 = 1
+public let VUCKT_ARRAY_FILE_TYPE_FLOAT3:Int32 = 2
+public let VUCKT_ARRAY_FILE_TYPE_FLOAT4:Int32 = 3
+public let VUCKT_ARRAY_FILE_TYPE_FLOAT_QUATERNION:Int32 = 4
+public let VUCKT_ARRAY_FILE_TYPE_FLOAT3X3:Int32 = 5
+public let VUCKT_ARRAY_FILE_TYPE_FLOAT4X4:Int32 = 6
+public let VUCKT_ARRAY_FILE_TYPE_FLOAT4X3:Int32 = 7
+public let VUCKT_ARRAY_FILE_TYPE_PACKED_FLOAT3:Int32 = 8
+public let VUCKT_ARRAY_FILE_TYPE_INT2:Int32 = 9
+public let VUCKT_ARRAY_FILE_TYPE_INT3:Int32 = 10
+public let VUCKT_ARRAY_FILE_TYPE_INT4:Int32 = 11
+public let VUCKT_ARRAY_FILE_TYPE_CHAR4:Int32 = 12
+public let VUCKT_ARRAY_FILE_TYPE_UCHAR4:Int32 = 13
+public let VUCKT_ARRAY_FILE_TYPE_SHORT2:Int32 = 14
+public let VUCKT_ARRAY_FILE_TYPE_SHORT3:Int32 = 15
+public let VUCKT_ARRAY_FILE_TYPE_SHORT4:Int32 = 16
+public let VUCKT_ARRAY_FILE_TYPE_USHORT4:Int32 = 17
+public let VUCKT_ARRAY_FILE_TYPE_HALF2:Int32 = 18
+public let VUCKT_ARRAY_FILE_TYPE_HALF3:Int32 = 19
+public let VUCKT_ARRAY_FILE_TYPE_HALF4:Int32 = 20
+public let VUCKT_ARRAY_FILE_TYPE_DOUBLE2:Int32 = 21
+public let VUCKT_ARRAY_FILE_TYPE_DOUBLE3:Int32 = 22
+public let VUCKT_ARRAY_FILE_TYPE_DOUBLE4:Int32 = 23
+public let VUCKT_ARRAY_FILE_TYPE_DOUBLE4X4:Int32 = 24
+public let VUCKT_ARRAY_FILE_TYPE_AABB3:Int32 = 25
+public let VUCKT_ARRAY_FILE_TYPE_RAY3:Int32 = 26
+
+
+
+// MARK: Struct Definition
+
+public struct ArrayFileHeader
+{
+	public var magic:(UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8)
+	public var version:UInt32
+	public var byteOrderMark:UInt32
+	public var typeTag:UInt32
+	public var stride:UInt32
+	public var alignment:UInt32
+	public var reserved0:UInt32
+	public var count:UInt64
+	public var dataOffset:UInt64
+	public var reserved1:(UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8)
+	
+	public init() {
+		self.magic = (0, 0, 0, 0, 0, 0, 0, 0)
+		self.version = UInt32()
+		self.byteOrderMark = UInt32()
+		self.typeTag = UInt32()
+		self.stride = UInt32()
+		self.alignment = UInt32()
+		self.reserved0 = UInt32()
+		self.count = UInt64()
+		self.dataOffset = UInt64()
+		self.reserved1 = (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+	}
+}
+
+@usableFromInline internal let _vucktArrayFileMagic:(UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8) = (0x56, 0x75, 0x63, 0x6B, 0x74, 0x41, 0x72, 0x72) // "VucktArr"
+
+
+
+// MARK: Header Construction & Validation
+
+@_alwaysEmitIntoClient public func ArrayFileHeaderMake(_ typeTag:UInt32, _ stride:UInt32, _ alignment:UInt32, _ count:UInt64) -> ArrayFileHeader {
+	var header = ArrayFileHeader()
+	header.magic = _vucktArrayFileMagic
+	header.version = UInt32(VUCKT_ARRAY_FILE_VERSION)
+	header.byteOrderMark = VUCKT_ARRAY_FILE_BYTE_ORDER_MARK
+	header.typeTag = typeTag
+	header.stride = stride
+	header.alignment = alignment
+	header.count = count
+	header.dataOffset = (UInt64(VUCKT_ARRAY_FILE_HEADER_SIZE) + UInt64(alignment) - 1) / UInt64(alignment) * UInt64(alignment)
+	return header
+}
+
+@_transparent public func ArrayFileSize(_ header:ArrayFileHeader) -> UInt64 {
+	return header.dataOffset &+ header.count &* UInt64(header.stride)
+}
+
+@_alwaysEmitIntoClient public func ArrayFileHeaderValidate(_ header:ArrayFileHeader, _ fileSize:UInt64, _ expectedTypeTag:UInt32, _ expectedStride:UInt32, _ expectedAlignment:UInt32) -> UInt32 {
+	let magic = header.magic, expectedMagic = _vucktArrayFileMagic
+	let isMagicCorrect = magic.0 == expectedMagic.0 && magic.1 == expectedMagic.1 && magic.2 == expectedMagic.2 && magic.3 == expectedMagic.3
+		&& magic.4 == expectedMagic.4 && magic.5 == expectedMagic.5 && magic.6 == expectedMagic.6 && magic.7 == expectedMagic.7
+	if fileSize < UInt64(VUCKT_ARRAY_FILE_HEADER_SIZE) || !isMagicCorrect {
+		return 1
+	}
+	if header.byteOrderMark != VUCKT_ARRAY_FILE_BYTE_ORDER_MARK {
+		return (header.byteOrderMark == 0x04030201) ? 3 : 1
+	}
+	if header.version != UInt32(VUCKT_ARRAY_FILE_VERSION) {
+		return 2
+	}
+	if header.stride == 0 || header.alignment == 0 || (header.alignment & (header.alignment - 1)) != 0
+		|| header.dataOffset < UInt64(VUCKT_ARRAY_FILE_HEADER_SIZE) || header.dataOffset % UInt64(header.alignment) != 0
+	{
+		return 4
+	}
+	if header.dataOffset > fileSize || header.count > (fileSize - header.dataOffset) / UInt64(header.stride) {
+		return 5
+	}
+	if header.typeTag != expectedTypeTag {
+		return 6
+	}
+	if header.stride != expectedStride {
+		return 7
+	}
+	if header.dataOffset % UInt64(expectedAlignment) != 0 {
+		return 8
+	}
+	return 0
+}
@@ -0,0 +1,683 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+#if __has_include(<Vuckt/AABB3.h>)
+	#import <Vuckt/AABB3.h>
+#else
+	#include "../AABB3/AABB3.h"
+#endif
+#if __has_include(<Vuckt/Ray3.h>)
+	#import <Vuckt/Ray3.h>
+#else
+	#include "../Ray3/Ray3.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#include <stdint.h>
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+// Bounding volume hierarchies over triangle meshes & point sets: a binary tree of boxes, built by binned surface-area-heuristic (SAH) splits, flattened into one array of 32-byte nodes.
+// Nodes are laid out depth-first— an interior node's left child immediately follows it, & its right child follows the whole left subtree— so a traversal mostly walks forward through memory.
+// Primitives aren't moved: the tree's leaves each cover a run of a primitive-index array, which the build permutes into leaf order.
+//
+// Building goes through a gapped scratch array (sized `2n − 1` for `n` primitives) in which every subtree's nodes have a reserved, non-overlapping range, so independent subtrees can be built on different threads:
+//	1. `BVHBuildTopLevels()` splits the top of the tree (serially) down into up-to-`maxTaskCount` subtree tasks,
+//	2. `BVHBuildSubtree()` builds each task's subtree (on any thread, concurrently with the others),
+//	3. `BVHBuildFlatten()` compacts the gapped scratch into the final depth-first node array.
+// `BVHBuild()` runs all three on the calling thread.
+
+
+
+#pragma mark Struct Definitions
+
+/// The maximum primitives per leaf; the build only makes bigger leaves than its SAH cost model favors where the primitives' centroids can't be told apart.
+#define VUCKT_BVH_MAX_LEAF_SIZE 8
+/// The SAH build's bin count per axis.
+#define VUCKT_BVH_BIN_COUNT 16
+/// The maximum tree depth (& thus traversal stack size); the build falls back to median splits near it, so even degenerate inputs stay within it.
+#define VUCKT_BVH_MAX_DEPTH 64
+/// The smallest primitive count `BVHBuildTopLevels()` splits into further tasks, below which a subtree isn't worth a thread of its own.
+#define VUCKT_BVH_MIN_TASK_SIZE 4096
+
+/// One node of a flattened hierarchy: its bounds' corners, each followed by a 32-bit field (32 bytes, so two share a cache line).
+struct BVHNode {
+	float minX, minY, minZ;
+	/// For an interior node, the index of its right child (its left child being the next node); for a leaf, the index of its first primitive's entry in the primitive-index array.
+	uint32_t rightChildOrFirstPrimitive;
+	float maxX, maxY, maxZ;
+	/// 0 for an interior node; for a leaf, its number of primitives (1…`VUCKT_BVH_MAX_LEAF_SIZE`).
+	uint32_t primitiveCount;
+};
+typedef struct BVHNode BVHNode;
+
+/// A subtree for `BVHBuildSubtree()` to build: the primitives `primitiveIndices[firstPrimitive..<(firstPrimitive + primitiveCount)]`, into the gapped scratch node `nodeIndex` on down, at `depth` in the whole tree.
+struct BVHBuildTask {
+	uint32_t nodeIndex;
+	uint32_t firstPrimitive;
+	uint32_t primitiveCount;
+	uint32_t depth;
+};
+typedef struct BVHBuildTask BVHBuildTask;
+
+/// Where a ray hit a triangle: at `origin + distance · direction`, with barycentric coordinates `u` & `v` (the weights of the triangle's 2nd & 3rd vertices).
+struct BVHRayHit {
+	float distance;
+	float u;
+	float v;
+	/// The triangle's index (in the original primitive order).
+	uint32_t primitiveIndex;
+};
+typedef struct BVHRayHit BVHRayHit;
+
+/// The nearest point to a query: `point`, on (or being) primitive `primitiveIndex`, at `distanceSquared` from the query.
+struct BVHNearestHit {
+	Float3 point;
+	float distanceSquared;
+	uint32_t primitiveIndex;
+};
+typedef struct BVHNearestHit BVHNearestHit;
+
+
+
+#pragma mark Primitive Bounds
+
+/// Writes each of the `triangleCount` triangles' bounds into `out`— the triangles being `vertices` indexed by each 3 consecutive `triangleVertexIndices`.
+NS_INLINE void BVHTriangleBounds(const Float3 *vertices, const uint32_t *triangleVertexIndices, AABB3 *out, size_t triangleCount) {
+	for (size_t triangleI = 0; triangleI < triangleCount; ++triangleI) {
+		const uint32_t *vertexIndices = &triangleVertexIndices[triangleI * 3];
+		out[triangleI] = AABB3MergePoint((AABB3){ vertices[vertexIndices[0]], vertices[vertexIndices[0]] }, vertices[vertexIndices[1]]);
+		out[triangleI] = AABB3MergePoint(out[triangleI], vertices[vertexIndices[2]]);
+	}
+}
+/// Writes each of the `n` points' (zero-size) bounds into `out`.
+NS_INLINE void BVHPointBounds(const Float3 *points, AABB3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = (AABB3){ points[i], points[i] };
+	}
+}
+
+
+
+#pragma mark Building
+
+/// Each lane of `x` but the 4th, which is zeroed (so whatever padding or integer field it was loaded from can't be a denormal, NaN, or ∞ that slows or poisons the arithmetic).
+NS_INLINE simd_float4 _BVHClearLane3(simd_float4 x) {
+	return (simd_float4)((simd_int4)x & (simd_int4){ -1, -1, -1, 0 });
+}
+/// Loads `box`'s corners as vectors (their 4th lanes 0).
+NS_INLINE void _BVHLoadBounds(const AABB3 *box, simd_float4 *outMin, simd_float4 *outMax) {
+	memcpy(outMin, &box->min, sizeof(simd_float4));
+	memcpy(outMax, &box->max, sizeof(simd_float4));
+	*outMin = _BVHClearLane3(*outMin);
+	*outMax = _BVHClearLane3(*outMax);
+}
+/// Loads `node`'s corners as vectors (their 4th lanes 0, rather than its integer fields).
+NS_INLINE void _BVHLoadNodeBounds(const BVHNode *node, simd_float4 *outMin, simd_float4 *outMax) {
+	memcpy(outMin, &node->minX, sizeof(simd_float4));
+	memcpy(outMax, &node->maxX, sizeof(simd_float4));
+	*outMin = _BVHClearLane3(*outMin);
+	*outMax = _BVHClearLane3(*outMax);
+}
+/// Half the surface area of the box from `min` to `max`, as the SAH weighs it.
+NS_INLINE float _BVHHalfArea(simd_float4 min, simd_float4 max) {
+	simd_float4 size = max - min;
+	return size[0] * size[1] + size[1] * size[2] + size[2] * size[0];
+}
+/// The SAH bin (0…`binCount − 1`) of each axis for the doubled centroid `centroid`.
+NS_INLINE simd_int4 _BVHBinIndices(simd_float4 centroid, simd_float4 centroidMin, simd_float4 binScale, int binCount) {
+	simd_int4 binIndices = __builtin_convertvector((centroid - centroidMin) * binScale, simd_int4);
+	simd_int4 isInRange = (binIndices < binCount - 1);
+	return (binIndices & isInRange) | ((binCount - 1) & ~isInRange);
+}
+
+/// `box`'s doubled centroid's component along `axis`.
+NS_INLINE float _BVHCentroid(const AABB3 *box, int axis) {
+	return (axis == 0) ? box->min.x + box->max.x : (axis == 1) ? box->min.y + box->max.y : box->min.z + box->max.z;
+}
+/// Reorders `indices[0..<count]` so the first `count / 2` are those whose centroids are lowest along `axis` (by Wirth's quickselect).
+NS_INLINE void _BVHPartitionAtMedian(const AABB3 *primitiveBounds, uint32_t *indices, size_t count, int axis) {
+	ptrdiff_t low = 0, high = (ptrdiff_t)count - 1, median = (ptrdiff_t)(count / 2);
+	while (low < high) {
+		float pivot = _BVHCentroid(&primitiveBounds[indices[median]], axis);
+		ptrdiff_t i = low, j = high;
+		do {
+			while (_BVHCentroid(&primitiveBounds[indices[i]], axis) < pivot) ++i;
+			while (pivot < _BVHCentroid(&primitiveBounds[indices[j]], axis)) --j;
+			if (i <= j) {
+				uint32_t swapped = indices[i];
+				indices[i] = indices[j];
+				indices[j] = swapped;
+				++i;
+				--j;
+			}
+		} while (i <= j);
+		if (j < median) low = i;
+		if (median < i) high = j;
+	}
+}
+
+/// Builds the node for `task` into `scratchNodes[task.nodeIndex]`: a leaf, or an interior node whose two children's tasks it writes into `outChildTasks` (returning whether it did).
+NS_INLINE bool _BVHBuildNode(const AABB3 *primitiveBounds, uint32_t *primitiveIndices, BVHNode *scratchNodes, BVHBuildTask task, BVHBuildTask outChildTasks[2]) {
+	uint32_t *indices = &primitiveIndices[task.firstPrimitive];
+	const size_t count = task.primitiveCount;
+	
+	// The node's bounds, & the bounds of its primitives' centroids (doubled— `min + max`— throughout, saving the halving).
+	simd_float4 nodeMin = { INFINITY, INFINITY, INFINITY, INFINITY }, nodeMax = -nodeMin;
+	simd_float4 centroidMin = nodeMin, centroidMax = nodeMax;
+	for (size_t i = 0; i < count; ++i) {
+		simd_float4 boxMin, boxMax;
+		_BVHLoadBounds(&primitiveBounds[indices[i]], &boxMin, &boxMax);
+		simd_float4 centroid = boxMin + boxMax;
+		nodeMin = vuckt_simd_select4(boxMin < nodeMin, boxMin, nodeMin);
+		nodeMax = vuckt_simd_select4(boxMax > nodeMax, boxMax, nodeMax);
+		centroidMin = vuckt_simd_select4(centroid < centroidMin, centroid, centroidMin);
+		centroidMax = vuckt_simd_select4(centroid > centroidMax, centroid, centroidMax);
+	}
+	scratchNodes[task.nodeIndex] = (BVHNode){ nodeMin[0], nodeMin[1], nodeMin[2], task.firstPrimitive, nodeMax[0], nodeMax[1], nodeMax[2], (uint32_t)count };
+	if (count <= 1)
+		return false;
+	
+	simd_float4 centroidExtent = centroidMax - centroidMin;
+	int widestAxis = (centroidExtent[1] > centroidExtent[0]) ? 1 : 0;
+	widestAxis = (centroidExtent[2] > centroidExtent[widestAxis]) ? 2 : widestAxis;
+	size_t leftCount;
+	
+	size_t countDepth = 0; // ⌈log₂(count)⌉
+	while (((size_t)1 << countDepth) < count) ++countDepth;
+	float nodeArea = _BVHHalfArea(nodeMin, nodeMax);
+	if (!(centroidExtent[widestAxis] > 0)) {
+		// Indistinguishable centroids: no split separates them, so keep them as one leaf if possible, else halve them arbitrarily.
+		if (count <= VUCKT_BVH_MAX_LEAF_SIZE)
+			return false;
+		leftCount = count / 2;
+	}
+	else if (task.depth + countDepth >= VUCKT_BVH_MAX_DEPTH || !(nodeArea > 0)) {
+		// Near the depth limit (or where the SAH is meaningless, for flat-to-a-line bounds), split at the median, which bounds the remaining depth by ⌈log₂(count)⌉.
+		if (count <= VUCKT_BVH_MAX_LEAF_SIZE)
+			return false;
+		_BVHPartitionAtMedian(primitiveBounds, indices, count, widestAxis);
+		leftCount = count / 2;
+	}
+	else {
+		// Bin the centroids along all three axes at once (into fewer bins for small nodes, which can't fill many, & are most of the tree).
+		const int binCount = (count < VUCKT_BVH_BIN_COUNT) ? (int)count : VUCKT_BVH_BIN_COUNT;
+		simd_float4 binScale = ((float)binCount * 0.99999f) / centroidExtent;
+		binScale = vuckt_simd_select4(centroidExtent > 0, binScale, (simd_float4){ 0, 0, 0, 0 });
+		simd_float4 binMin[3][VUCKT_BVH_BIN_COUNT], binMax[3][VUCKT_BVH_BIN_COUNT];
+		uint32_t binPrimitiveCounts[3][VUCKT_BVH_BIN_COUNT];
+		for (int axis = 0; axis < 3; ++axis) {
+			for (int binI = 0; binI < binCount; ++binI) {
+				binMin[axis][binI] = (simd_float4){ INFINITY, INFINITY, INFINITY, INFINITY };
+				binMax[axis][binI] = -binMin[axis][binI];
+				binPrimitiveCounts[axis][binI] = 0;
+			}
+		}
+		for (size_t i = 0; i < count; ++i) {
+			simd_float4 boxMin, boxMax;
+			_BVHLoadBounds(&primitiveBounds[indices[i]], &boxMin, &boxMax);
+			simd_int4 binIndices = _BVHBinIndices(boxMin + boxMax, centroidMin, binScale, binCount);
+			for (int axis = 0; axis < 3; ++axis) {
+				int binI = binIndices[axis];
+				binMin[axis][binI] = vuckt_simd_select4(boxMin < binMin[axis][binI], boxMin, binMin[axis][binI]);
+				binMax[axis][binI] = vuckt_simd_select4(boxMax > binMax[axis][binI], boxMax, binMax[axis][binI]);
+				binPrimitiveCounts[axis][binI] += 1;
+			}
+		}
+		
+		// Sweep each axis's bins from the right (accumulating each split's right-side area & count), then from the left (costing each split).
+		float bestCost = INFINITY;
+		int bestAxis = widestAxis, bestSplitBin = binCount / 2;
+		for (int axis = 0; axis < 3; ++axis) {
+			if (!(centroidExtent[axis] > 0))
+				continue;
+			float rightArea[VUCKT_BVH_BIN_COUNT];
+			uint32_t rightCount[VUCKT_BVH_BIN_COUNT];
+			simd_float4 sideMin = { INFINITY, INFINITY, INFINITY, INFINITY }, sideMax = -sideMin;
+			uint32_t sideCount = 0;
+			for (int binI = binCount - 1; binI > 0; --binI) {
+				sideMin = vuckt_simd_select4(binMin[axis][binI] < sideMin, binMin[axis][binI], sideMin);
+				sideMax = vuckt_simd_select4(binMax[axis][binI] > sideMax, binMax[axis][binI], sideMax);
+				sideCount += binPrimitiveCounts[axis][binI];
+				rightArea[binI] = (sideCount > 0) ? _BVHHalfArea(sideMin, sideMax) : 0;
+				rightCount[binI] = sideCount;
+			}
+			sideMin = (simd_float4){ INFINITY, INFINITY, INFINITY, INFINITY };
+			sideMax = -sideMin;
+			sideCount = 0;
+			for (int splitBinI = 1; splitBinI < binCount; ++splitBinI) {
+				sideMin = vuckt_simd_select4(binMin[axis][splitBinI - 1] < sideMin, binMin[axis][splitBinI - 1], sideMin);
+				sideMax = vuckt_simd_select4(binMax[axis][splitBinI - 1] > sideMax, binMax[axis][splitBinI - 1], sideMax);
+				sideCount += binPrimitiveCounts[axis][splitBinI - 1];
+				if (sideCount == 0 || rightCount[splitBinI] == 0)
+					continue;
+				float cost = _BVHHalfArea(sideMin, sideMax) * (float)sideCount + rightArea[splitBinI] * (float)rightCount[splitBinI];
+				if (cost < bestCost) {
+					bestCost = cost;
+					bestAxis = axis;
+					bestSplitBin = splitBinI;
+				}
+			}
+		}
+		
+		// Keep a leaf where it's cheaper than a split: with a node visit costing about one primitive test, that's where `count` tests beat `1 + (each child's area share × its count)`.
+		if (count <= VUCKT_BVH_MAX_LEAF_SIZE && bestCost >= ((float)count - 1) * nodeArea)
+			return false;
+		
+		size_t i = 0, j = count;
+		while (i < j) {
+			simd_float4 boxMin, boxMax;
+			_BVHLoadBounds(&primitiveBounds[indices[i]], &boxMin, &boxMax);
+			if (_BVHBinIndices(boxMin + boxMax, centroidMin, binScale, binCount)[bestAxis] < bestSplitBin) {
+				++i;
+			}
+			else {
+				uint32_t swapped = indices[i];
+				indices[i] = indices[--j];
+				indices[j] = swapped;
+			}
+		}
+		leftCount = i;
+		if (leftCount == 0 || leftCount == count) { // (only if binning was inconsistent with the partition, which it shouldn't be)
+			_BVHPartitionAtMedian(primitiveBounds, indices, count, widestAxis);
+			leftCount = count / 2;
+		}
+	}
+	
+	// The left subtree's nodes get the `2·leftCount − 1` slots after this one, the right subtree's those after them.
+	uint32_t rightNodeIndex = task.nodeIndex + 2 * (uint32_t)leftCount;
+	scratchNodes[task.nodeIndex].rightChildOrFirstPrimitive = rightNodeIndex;
+	scratchNodes[task.nodeIndex].primitiveCount = 0;
+	outChildTasks[0] = (BVHBuildTask){ task.nodeIndex + 1, task.firstPrimitive, (uint32_t)leftCount, task.depth + 1 };
+	outChildTasks[1] = (BVHBuildTask){ rightNodeIndex, task.firstPrimitive + (uint32_t)leftCount, (uint32_t)(count - leftCount), task.depth + 1 };
+	return true;
+}
+
+/// Starts a build over the `n` primitives bounded by `primitiveBounds`: fills `primitiveIndices` (room for `n`) with `0..<n`, builds the top of the tree into `scratchNodes` (room for `2n − 1`), & writes up to `maxTaskCount` subtree tasks covering the rest into `outTasks`, returning how many.
+/// Tasks are split (largest first) until there are `maxTaskCount` or none left with `VUCKT_BVH_MIN_TASK_SIZE` primitives; `maxTaskCount` = 1 leaves the whole tree as one task.
+/// - Precondition: `n` must be at least 1 & at most 2³¹.
+NS_INLINE size_t BVHBuildTopLevels(const AABB3 *primitiveBounds, uint32_t *primitiveIndices, BVHNode *scratchNodes, size_t n, BVHBuildTask *outTasks, size_t maxTaskCount) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		primitiveIndices[i] = (uint32_t)i;
+	}
+	outTasks[0] = (BVHBuildTask){ 0, 0, (uint32_t)n, 0 };
+	size_t taskCount = 1;
+	while (taskCount > 0 && taskCount < maxTaskCount) {
+		size_t largestTaskI = 0;
+		for (size_t taskI = 1; taskI < taskCount; ++taskI) {
+			if (outTasks[taskI].primitiveCount > outTasks[largestTaskI].primitiveCount)
+				largestTaskI = taskI;
+		}
+		if (outTasks[largestTaskI].primitiveCount < VUCKT_BVH_MIN_TASK_SIZE)
+			break;
+		BVHBuildTask childTasks[2];
+		if (_BVHBuildNode(primitiveBounds, primitiveIndices, scratchNodes, outTasks[largestTaskI], childTasks)) {
+			outTasks[largestTaskI] = childTasks[0];
+			outTasks[taskCount++] = childTasks[1];
+		}
+		else {
+			outTasks[largestTaskI] = outTasks[--taskCount];
+		}
+	}
+	return taskCount;
+}
+
+/// Builds `task`'s subtree into `scratchNodes`, reordering its run of `primitiveIndices`.
+/// Tasks from the same `BVHBuildTopLevels()` call touch disjoint nodes & primitive indices, so may be built concurrently.
+NS_INLINE void BVHBuildSubtree(const AABB3 *primitiveBounds, uint32_t *primitiveIndices, BVHNode *scratchNodes, BVHBuildTask task) {
+	BVHBuildTask stack[VUCKT_BVH_MAX_DEPTH + 1];
+	size_t stackCount = 0;
+	for (;;) {
+		BVHBuildTask childTasks[2];
+		if (_BVHBuildNode(primitiveBounds, primitiveIndices, scratchNodes, task, childTasks)) {
+			stack[stackCount++] = childTasks[1];
+			task = childTasks[0];
+		}
+		else if (stackCount > 0) {
+			task = stack[--stackCount];
+		}
+		else {
+			break;
+		}
+	}
+}
+
+/// Compacts the built tree in `scratchNodes` into `outNodes` (room for `2n − 1`; may be `scratchNodes` itself) in depth-first order, returning the node count.
+NS_INLINE size_t BVHBuildFlatten(const BVHNode *scratchNodes, BVHNode *outNodes) {
+	// The scratch layout is already depth-first, just gapped, so each node moves to an index ≤ its own, after every node it could overwrite has been read.
+	uint32_t stack[VUCKT_BVH_MAX_DEPTH + 1]; // the interior nodes (by output index) whose right children haven't been reached
+	uint32_t rightScratchIndices[VUCKT_BVH_MAX_DEPTH + 1];
+	size_t stackCount = 0, nodeCount = 0;
+	uint32_t scratchIndex = 0;
+	for (;;) {
+		BVHNode node = scratchNodes[scratchIndex];
+		outNodes[nodeCount] = node;
+		if (node.primitiveCount == 0) {
+			stack[stackCount] = (uint32_t)nodeCount;
+			rightScratchIndices[stackCount++] = node.rightChildOrFirstPrimitive;
+			scratchIndex += 1;
+			nodeCount += 1;
+		}
+		else if (stackCount > 0) {
+			nodeCount += 1;
+			--stackCount;
+			outNodes[stack[stackCount]].rightChildOrFirstPrimitive = (uint32_t)nodeCount;
+			scratchIndex = rightScratchIndices[stackCount];
+		}
+		else {
+			return nodeCount + 1;
+		}
+	}
+}
+
+/// Builds a hierarchy over the `n` primitives bounded by `primitiveBounds` on the calling thread, into `outNodes` (room for `2n − 1`; may be `scratchNodes`) & `primitiveIndices` (room for `n`), returning the node count.
+/// - Precondition: `n` must be at least 1 & at most 2³¹.
+NS_INLINE size_t BVHBuild(const AABB3 *primitiveBounds, uint32_t *primitiveIndices, BVHNode *scratchNodes, BVHNode *outNodes, size_t n) {
+	BVHBuildTask rootTask;
+	if (BVHBuildTopLevels(primitiveBounds, primitiveIndices, scratchNodes, n, &rootTask, 1) > 0)
+		BVHBuildSubtree(primitiveBounds, primitiveIndices, scratchNodes, rootTask);
+	return BVHBuildFlatten(scratchNodes, outNodes);
+}
+
+
+
+#pragma mark Ray Queries
+
+// Rays are `origin + t · direction` for `t` in [ 0, `maxDistance` ]; distances are in units of `direction`'s length (so true distances if it's normalized).
+// Triangles are hit from either side, by `Ray3IntersectTriangle()` (so watertight on shared edges).
+
+/// Where the ray enters `node`'s box (clamped to 0), or +∞ if it misses it or only enters past `maxDistance` (by the slab test).
+NS_INLINE float _BVHRayNodeEntryDistance(const BVHNode *node, simd_float4 origin, simd_float4 inverseDirection, float maxDistance) {
+	simd_float4 nodeMin, nodeMax;
+	_BVHLoadNodeBounds(node, &nodeMin, &nodeMax);
+	simd_float4 t0 = (nodeMin - origin) * inverseDirection, t1 = (nodeMax - origin) * inverseDirection;
+	simd_int4 isT0Nearer = (t0 < t1);
+	simd_float4 tNear = vuckt_simd_select4(isT0Nearer, t0, t1), tFar = vuckt_simd_select4(isT0Nearer, t1, t0);
+	// A ray along one of the box's faces (zero direction component, zero offset) gets `0 · ∞` = NaN there, but is within that slab.
+	simd_int4 isDefined = (t0 == t0) & (t1 == t1);
+	tNear = vuckt_simd_select4(isDefined, tNear, (simd_float4){ -INFINITY, -INFINITY, -INFINITY, -INFINITY });
+	tFar = vuckt_simd_select4(isDefined, tFar, (simd_float4){ INFINITY, INFINITY, INFINITY, INFINITY });
+	float entry = 0, exit = maxDistance;
+	for (int axis = 0; axis < 3; ++axis) {
+		entry = (tNear[axis] > entry) ? tNear[axis] : entry;
+		exit = (tFar[axis] < exit) ? tFar[axis] : exit;
+	}
+	return (entry <= exit) ? entry : INFINITY;
+}
+
+/// The nearest hit within `maxDistance` of the ray from `origin` along `direction` on the triangles (`vertices` indexed by each 3 consecutive `triangleVertexIndices`) of the hierarchy `nodes`/`primitiveIndices`, written to `*outHit`, returning whether there was one.
+NS_INLINE bool BVHIntersectRayTriangles(const BVHNode *nodes, const uint32_t *primitiveIndices, const Float3 *vertices, const uint32_t *triangleVertexIndices, Float3 origin, Float3 direction, float maxDistance, BVHRayHit *outHit) {
+	Ray3 ray = { origin, direction };
+	simd_float4 rayOrigin = { origin.x, origin.y, origin.z, 0 };
+	simd_float4 inverseDirection = 1.0f / (simd_float4){ direction.x, direction.y, direction.z, 1 };
+	float closestDistance = maxDistance;
+	bool didHit = false;
+	
+	// Nearer child first; the farther one is stacked with its entry distance, so it's skipped if a closer hit turns up meanwhile.
+	uint32_t stack[VUCKT_BVH_MAX_DEPTH];
+	float stackEntryDistances[VUCKT_BVH_MAX_DEPTH];
+	size_t stackCount = 0;
+	uint32_t nodeI = 0;
+	if (_BVHRayNodeEntryDistance(&nodes[0], rayOrigin, inverseDirection, closestDistance) == INFINITY)
+		return false;
+	for (;;) {
+		const BVHNode *node = &nodes[nodeI];
+		if (node->primitiveCount == 0) {
+			uint32_t leftI = nodeI + 1, rightI = node->rightChildOrFirstPrimitive;
+			float leftEntry = _BVHRayNodeEntryDistance(&nodes[leftI], rayOrigin, inverseDirection, closestDistance);
+			float rightEntry = _BVHRayNodeEntryDistance(&nodes[rightI], rayOrigin, inverseDirection, closestDistance);
+			if (leftEntry != INFINITY || rightEntry != INFINITY) {
+				bool isLeftNearer = (leftEntry <= rightEntry);
+				nodeI = isLeftNearer ? leftI : rightI;
+				float fartherEntry = isLeftNearer ? rightEntry : leftEntry;
+				if (fartherEntry != INFINITY) {
+					stack[stackCount] = isLeftNearer ? rightI : leftI;
+					stackEntryDistances[stackCount++] = fartherEntry;
+				}
+				continue;
+			}
+		}
+		else {
+			for (uint32_t entryI = node->rightChildOrFirstPrimitive, entryEnd = entryI + node->primitiveCount; entryI < entryEnd; ++entryI) {
+				uint32_t triangleI = primitiveIndices[entryI];
+				const uint32_t *vertexIndices = &triangleVertexIndices[triangleI * 3];
+				float u, v;
+				float distance = Ray3IntersectTriangle(ray, vertices[vertexIndices[0]], vertices[vertexIndices[1]], vertices[vertexIndices[2]], closestDistance, &u, &v);
+				if (distance != INFINITY) {
+					closestDistance = distance;
+					*outHit = (BVHRayHit){ distance, u, v, triangleI };
+					didHit = true;
+				}
+			}
+		}
+		do {
+			if (stackCount == 0)
+				return didHit;
+			nodeI = stack[--stackCount];
+		} while (stackEntryDistances[stackCount] > closestDistance);
+	}
+}
+
+/// Whether the ray from `origin` along `direction` hits any of the triangles (see `BVHIntersectRayTriangles()`) within `maxDistance`— stopping at the first hit found, which needn't be the nearest (e.g. for shadow rays).
+NS_INLINE bool BVHOccludedRayTriangles(const BVHNode *nodes, const uint32_t *primitiveIndices, const Float3 *vertices, const uint32_t *triangleVertexIndices, Float3 origin, Float3 direction, float maxDistance) {
+	Ray3 ray = { origin, direction };
+	simd_float4 rayOrigin = { origin.x, origin.y, origin.z, 0 };
+	simd_float4 inverseDirection = 1.0f / (simd_float4){ direction.x, direction.y, direction.z, 1 };
+	uint32_t stack[VUCKT_BVH_MAX_DEPTH + 1];
+	size_t stackCount = 0;
+	stack[stackCount++] = 0;
+	while (stackCount > 0) {
+		uint32_t nodeI = stack[--stackCount];
+		const BVHNode *node = &nodes[nodeI];
+		if (_BVHRayNodeEntryDistance(node, rayOrigin, inverseDirection, maxDistance) == INFINITY)
+			continue;
+		if (node->primitiveCount == 0) {
+			stack[stackCount++] = node->rightChildOrFirstPrimitive;
+			stack[stackCount++] = nodeI + 1;
+			continue;
+		}
+		for (uint32_t entryI = node->rightChildOrFirstPrimitive, entryEnd = entryI + node->primitiveCount; entryI < entryEnd; ++entryI) {
+			const uint32_t *vertexIndices = &triangleVertexIndices[primitiveIndices[entryI] * 3];
+			if (Ray3IntersectTriangle(ray, vertices[vertexIndices[0]], vertices[vertexIndices[1]], vertices[vertexIndices[2]], maxDistance, NULL, NULL) != INFINITY)
+				return true;
+		}
+	}
+	return false;
+}
+
+
+
+#pragma mark Overlap Queries
+
+/// Whether `node`'s box & the box `queryMin`…`queryMax` overlap, touching included.
+NS_INLINE bool _BVHNodeOverlaps(const BVHNode *node, simd_float4 queryMin, simd_float4 queryMax) {
+	simd_float4 nodeMin, nodeMax;
+	_BVHLoadNodeBounds(node, &nodeMin, &nodeMax);
+	simd_int4 overlaps = (nodeMin <= queryMax) & (queryMin <= nodeMax);
+	return (overlaps[0] & overlaps[1] & overlaps[2]) != 0;
+}
+
+/// Runs the statement `...` for each leaf of `nodes` overlapping `query`, with `entryI` & `entryEnd` (the leaf's run of the primitive-index array) in scope.
+#define _VUCKT_BVH_FOR_EACH_OVERLAPPING_LEAF(nodes, query, entryI, entryEnd, ...) \
+	do { \
+		simd_float4 queryMin, queryMax; \
+		_BVHLoadBounds(&(query), &queryMin, &queryMax); \
+		uint32_t stack[VUCKT_BVH_MAX_DEPTH + 1]; \
+		size_t stackCount = 0; \
+		stack[stackCount++] = 0; \
+		while (stackCount > 0) { \
+			uint32_t nodeI = stack[--stackCount]; \
+			const BVHNode *node = &(nodes)[nodeI]; \
+			if (!_BVHNodeOverlaps(node, queryMin, queryMax)) continue; \
+			if (node->primitiveCount == 0) { \
+				stack[stackCount++] = node->rightChildOrFirstPrimitive; \
+				stack[stackCount++] = nodeI + 1; \
+				continue; \
+			} \
+			for (uint32_t entryI = node->rightChildOrFirstPrimitive, entryEnd = entryI + node->primitiveCount; entryI < entryEnd; ++entryI) { __VA_ARGS__; } \
+		} \
+	} while (0)
+
+/// Writes the indices of the triangles (see `BVHIntersectRayTriangles()`) whose bounds overlap `query` (touching included) into `outTriangleIndices`, up to `capacity` of them, returning how many there are in all (which may be more).
+NS_INLINE size_t BVHOverlapTriangles(const BVHNode *nodes, const uint32_t *primitiveIndices, const Float3 *vertices, const uint32_t *triangleVertexIndices, AABB3 query, uint32_t *VUCKT_NULLABLE outTriangleIndices, size_t capacity) {
+	size_t overlapCount = 0;
+	_VUCKT_BVH_FOR_EACH_OVERLAPPING_LEAF(nodes, query, entryI, entryEnd, {
+		uint32_t triangleI = primitiveIndices[entryI];
+		AABB3 triangleBounds;
+		BVHTriangleBounds(vertices, &triangleVertexIndices[triangleI * 3], &triangleBounds, 1);
+		if (AABB3Intersects(triangleBounds, query)) {
+			if (overlapCount < capacity)
+				outTriangleIndices[overlapCount] = triangleI;
+			overlapCount += 1;
+		}
+	});
+	return overlapCount;
+}
+/// Writes the indices of the `points` within `query` (boundary included) into `outPointIndices`, up to `capacity` of them, returning how many there are in all (which may be more).
+NS_INLINE size_t BVHOverlapPoints(const BVHNode *nodes, const uint32_t *primitiveIndices, const Float3 *points, AABB3 query, uint32_t *VUCKT_NULLABLE outPointIndices, size_t capacity) {
+	size_t overlapCount = 0;
+	_VUCKT_BVH_FOR_EACH_OVERLAPPING_LEAF(nodes, query, entryI, entryEnd, {
+		uint32_t pointI = primitiveIndices[entryI];
+		if (AABB3ContainsPoint(query, points[pointI])) {
+			if (overlapCount < capacity)
+				outPointIndices[overlapCount] = pointI;
+			overlapCount += 1;
+		}
+	});
+	return overlapCount;
+}
+
+
+
+#pragma mark Nearest-Point Queries
+
+/// The squared distance from `point` to `node`'s box (0 if inside).
+NS_INLINE float _BVHNodeDistanceSquared(const BVHNode *node, simd_float4 point) {
+	simd_float4 nodeMin, nodeMax;
+	_BVHLoadNodeBounds(node, &nodeMin, &nodeMax);
+	simd_float4 belowMin = nodeMin - point, aboveMax = point - nodeMax;
+	simd_float4 outside = vuckt_simd_select4(belowMin > aboveMax, belowMin, aboveMax);
+	outside = vuckt_simd_select4(outside > 0, outside, (simd_float4){ 0, 0, 0, 0 });
+	return outside[0] * outside[0] + outside[1] * outside[1] + outside[2] * outside[2];
+}
+/// The point on triangle `a`,`b`,`c` nearest `point` (Ericson's region-by-region method, from _Real-Time Collision Detection_ §5.1.5).
+NS_INLINE simd_float4 _BVHClosestPointOnTriangle(simd_float4 point, Float3 a, Float3 b, Float3 c) {
+	simd_float4 vertexA = { a.x, a.y, a.z, 0 }, vertexB = { b.x, b.y, b.z, 0 }, vertexC = { c.x, c.y, c.z, 0 };
+	simd_float4 ab = vertexB - vertexA, ac = vertexC - vertexA, ap = point - vertexA;
+	#define _VUCKT_BVH_DOT3(u, w) ((u)[0] * (w)[0] + (u)[1] * (w)[1] + (u)[2] * (w)[2])
+	float d1 = _VUCKT_BVH_DOT3(ab, ap), d2 = _VUCKT_BVH_DOT3(ac, ap);
+	if (d1 <= 0 && d2 <= 0) return vertexA;
+	simd_float4 bp = point - vertexB;
+	float d3 = _VUCKT_BVH_DOT3(ab, bp), d4 = _VUCKT_BVH_DOT3(ac, bp);
+	if (d3 >= 0 && d4 <= d3) return vertexB;
+	float vc = d1 * d4 - d3 * d2;
+	if (vc <= 0 && d1 >= 0 && d3 <= 0) return vertexA + ab * (d1 / (d1 - d3));
+	simd_float4 cp = point - vertexC;
+	float d5 = _VUCKT_BVH_DOT3(ab, cp), d6 = _VUCKT_BVH_DOT3(ac, cp);
+	if (d6 >= 0 && d5 <= d6) return vertexC;
+	float vb = d5 * d2 - d1 * d6;
+	if (vb <= 0 && d2 >= 0 && d6 <= 0) return vertexA + ac * (d2 / (d2 - d6));
+	float va = d3 * d6 - d5 * d4;
+	if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) return vertexB + (vertexC - vertexB) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+	float denominator = 1.0f / (va + vb + vc);
+	return vertexA + ab * (vb * denominator) + ac * (vc * denominator);
+	#undef _VUCKT_BVH_DOT3
+}
+
+/// Runs the statement `...` for each leaf of `nodes` nearer to `queryPoint` than `bestDistanceSquared` (which `...` narrows as it finds nearer primitives), nearer child first, with `entryI` & `entryEnd` (the leaf's run of the primitive-index array) in scope.
+#define _VUCKT_BVH_FOR_EACH_NEAR_LEAF(nodes, queryPoint, bestDistanceSquared, entryI, entryEnd, ...) \
+	do { \
+		uint32_t stack[VUCKT_BVH_MAX_DEPTH]; \
+		float stackDistancesSquared[VUCKT_BVH_MAX_DEPTH]; \
+		size_t stackCount = 0; \
+		uint32_t nodeI = 0; \
+		bool isDone = (_BVHNodeDistanceSquared(&(nodes)[0], (queryPoint)) > (bestDistanceSquared)); \
+		while (!isDone) { \
+			const BVHNode *node = &(nodes)[nodeI]; \
+			if (node->primitiveCount == 0) { \
+				uint32_t leftI = nodeI + 1, rightI = node->rightChildOrFirstPrimitive; \
+				float leftDistanceSquared = _BVHNodeDistanceSquared(&(nodes)[leftI], (queryPoint)); \
+				float rightDistanceSquared = _BVHNodeDistanceSquared(&(nodes)[rightI], (queryPoint)); \
+				bool isLeftNearer = (leftDistanceSquared <= rightDistanceSquared); \
+				float nearerDistanceSquared = isLeftNearer ? leftDistanceSquared : rightDistanceSquared; \
+				float fartherDistanceSquared = isLeftNearer ? rightDistanceSquared : leftDistanceSquared; \
+				if (nearerDistanceSquared <= (bestDistanceSquared)) { \
+					if (fartherDistanceSquared <= (bestDistanceSquared)) { \
+						stack[stackCount] = isLeftNearer ? rightI : leftI; \
+						stackDistancesSquared[stackCount++] = fartherDistanceSquared; \
+					} \
+					nodeI = isLeftNearer ? leftI : rightI; \
+					continue; \
+				} \
+			} \
+			else { \
+				for (uint32_t entryI = node->rightChildOrFirstPrimitive, entryEnd = entryI + node->primitiveCount; entryI < entryEnd; ++entryI) { __VA_ARGS__; } \
+			} \
+			for (;;) { \
+				if (stackCount == 0) { isDone = true; break; } \
+				nodeI = stack[--stackCount]; \
+				if (stackDistancesSquared[stackCount] <= (bestDistanceSquared)) break; \
+			} \
+		} \
+	} while (0)
+
+/// The nearest of `points` to `queryPoint` within `maxDistance`, written to `*outHit`, returning whether there was one.
+NS_INLINE bool BVHNearestPoint(const BVHNode *nodes, const uint32_t *primitiveIndices, const Float3 *points, Float3 queryPoint, float maxDistance, BVHNearestHit *outHit) {
+	simd_float4 query = { queryPoint.x, queryPoint.y, queryPoint.z, 0 };
+	float bestDistanceSquared = maxDistance * maxDistance;
+	bool didFind = false;
+	_VUCKT_BVH_FOR_EACH_NEAR_LEAF(nodes, query, bestDistanceSquared, entryI, entryEnd, {
+		uint32_t pointI = primitiveIndices[entryI];
+		Float3 point = points[pointI];
+		float dx = point.x - queryPoint.x, dy = point.y - queryPoint.y, dz = point.z - queryPoint.z;
+		float distanceSquared = dx * dx + dy * dy + dz * dz;
+		if (distanceSquared <= bestDistanceSquared) {
+			bestDistanceSquared = distanceSquared;
+			*outHit = (BVHNearestHit){ point, distanceSquared, pointI };
+			didFind = true;
+		}
+	});
+	return didFind;
+}
+/// The nearest point on the triangles (see `BVHIntersectRayTriangles()`) to `queryPoint` within `maxDistance`, written to `*outHit`, returning whether there was one.
+NS_INLINE bool BVHNearestTrianglePoint(const BVHNode *nodes, const uint32_t *primitiveIndices, const Float3 *vertices, const uint32_t *triangleVertexIndices, Float3 queryPoint, float maxDistance, BVHNearestHit *outHit) {
+	simd_float4 query = { queryPoint.x, queryPoint.y, queryPoint.z, 0 };
+	float bestDistanceSquared = maxDistance * maxDistance;
+	bool didFind = false;
+	_VUCKT_BVH_FOR_EACH_NEAR_LEAF(nodes, query, bestDistanceSquared, entryI, entryEnd, {
+		uint32_t triangleI = primitiveIndices[entryI];
+		const uint32_t *vertexIndices = &triangleVertexIndices[triangleI * 3];
+		simd_float4 point = _BVHClosestPointOnTriangle(query, vertices[vertexIndices[0]], vertices[vertexIndices[1]], vertices[vertexIndices[2]]);
+		simd_float4 offset = point - query;
+		float distanceSquared = offset[0] * offset[0] + offset[1] * offset[1] + offset[2] * offset[2];
+		if (distanceSquared <= bestDistanceSquared) {
+			bestDistanceSquared = distanceSquared;
+			*outHit = (BVHNearestHit){ { point[0], point[1], point[2] }, distanceSquared, triangleI };
+			didFind = true;
+		}
+	});
+	return didFind;
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
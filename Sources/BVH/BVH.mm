@@ -0,0 +1,16 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "BVH.h"
+
+
+
+#pragma mark Struct Layout Sanity Checks
+
+static_assert(sizeof(BVHNode) == 32,
+	"BVHNode's size is not 32 bytes on this platform (which keeps two nodes to a cache line).");
+static_assert(offsetof(BVHNode, minX) == 0,
+	"BVHNode's min corner does not start at its beginning on this platform (which the bounds' lane loads rely on).");
+static_assert(offsetof(BVHNode, maxX) == sizeof(simd_float4),
+	"BVHNode's max corner does not start 1 simd_float4 in on this platform (which the bounds' lane loads rely on).");
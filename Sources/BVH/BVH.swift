@@ -0,0 +1,202 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+/// A bounding volume hierarchy over some primitives' bounding boxes— the node array & leaf-ordered primitive indices the C `BVH…()` queries take (see `BVH.h`).
+/// `TriangleBVH` & `PointBVH` pair one with the geometry it was built over.
+public struct BVH
+{
+	/// The flattened, depth-first nodes (empty if built over no primitives).
+	public let nodes:[BVHNode]
+	/// The primitives' indices, permuted into leaf order; each leaf covers a run of these.
+	public let primitiveIndices:[UInt32]
+	
+	
+	// MARK: `init`s
+	
+	/// Build over the primitives bounded by `primitiveBounds`.
+	/// With `isParallel`, the top of the tree is built first, then its subtrees on all cores (via `DispatchQueue.concurrentPerform`); the resulting tree is the same either way.
+	@_alwaysEmitIntoClient public init(primitiveBounds:[AABB3], isParallel:Bool = true) {
+		self = primitiveBounds.withUnsafeBufferPointer{ BVH(primitiveBounds: $0, isParallel: isParallel) }
+	}
+	/// Build over the primitives bounded by `primitiveBounds`— see `init(primitiveBounds:isParallel:)`.
+	@_alwaysEmitIntoClient public init(primitiveBounds:UnsafeBufferPointer<AABB3>, isParallel:Bool = true) {
+		let n = primitiveBounds.count
+		guard n > 0 else {
+			self.nodes = []
+			self.primitiveIndices = []
+			return
+		}
+		precondition(n <= (1 << 31), "Too many primitives for 32-bit indices.")
+		
+		var nodes = [BVHNode](repeating: BVHNode(), count: 2 * n - 1)
+		var primitiveIndices = [UInt32](repeating: 0, count: n)
+		let nodeCount = nodes.withUnsafeMutableBufferPointer{ nodesBuffer in
+			primitiveIndices.withUnsafeMutableBufferPointer{ indicesBuffer -> Int in
+				let bounds = primitiveBounds.baseAddress!, indices = indicesBuffer.baseAddress!, scratchNodes = nodesBuffer.baseAddress!
+				let maxTaskCount = isParallel ? ProcessInfo.processInfo.activeProcessorCount * 4 : 1
+				var tasks = [BVHBuildTask](repeating: BVHBuildTask(), count: maxTaskCount)
+				let taskCount = BVHBuildTopLevels(bounds, indices, scratchNodes, n, &tasks, maxTaskCount)
+				if taskCount > 1 {
+					DispatchQueue.concurrentPerform(iterations: taskCount){ BVHBuildSubtree(bounds, indices, scratchNodes, tasks[$0]) }
+				}
+				else if taskCount == 1 {
+					BVHBuildSubtree(bounds, indices, scratchNodes, tasks[0])
+				}
+				return BVHBuildFlatten(scratchNodes, scratchNodes)
+			}
+		}
+		nodes.removeSubrange(nodeCount...)
+		
+		self.nodes = nodes
+		self.primitiveIndices = primitiveIndices
+	}
+	
+	
+	// MARK: Is… Flags
+	
+	@_transparent public var isEmpty:Bool {
+		return self.nodes.isEmpty
+	}
+	
+	
+	// MARK: Internal Helpers
+	
+	/// Calls `body` with the base addresses of `nodes` & `primitiveIndices` (or returns `emptyResult`, without calling it, if the hierarchy is empty).
+	@usableFromInline internal func _withUnsafePointers<Result>(emptyResult:Result, _ body:(UnsafePointer<BVHNode>, UnsafePointer<UInt32>) throws -> Result) rethrows -> Result {
+		guard !self.isEmpty else { return emptyResult }
+		return try self.nodes.withUnsafeBufferPointer{ nodesBuffer in
+			try self.primitiveIndices.withUnsafeBufferPointer{ indicesBuffer in
+				try body(nodesBuffer.baseAddress!, indicesBuffer.baseAddress!)
+			}
+		}
+	}
+	
+	/// Runs a C overlap query (which returns its total count, writing up to `capacity` indices) into a fitted array, retrying once with room for them all if the first guess was short.
+	@usableFromInline internal static func _overlapQueryResults(_ query:(UnsafeMutablePointer<UInt32>?, Int) -> Int) -> [UInt32] {
+		var capacity = 64
+		while true {
+			var totalCount = 0
+			let results = [UInt32](unsafeUninitializedCapacity: capacity){ buffer, initializedCount in
+				totalCount = query(buffer.baseAddress, capacity)
+				initializedCount = Swift.min(totalCount, capacity)
+			}
+			if totalCount <= capacity {
+				return results
+			}
+			capacity = totalCount
+		}
+	}
+}
+
+
+/// A triangle mesh (as a vertex array & 3 vertex indices per triangle) & the `BVH` over its triangles, for ray, box-overlap, & nearest-point queries.
+public struct TriangleBVH
+{
+	public let vertices:[Float3]
+	/// Each triangle's 3 indices into `vertices`, consecutively.
+	public let triangleVertexIndices:[UInt32]
+	public let hierarchy:BVH
+	
+	
+	// MARK: `init`s
+	
+	/// - Precondition: `triangleVertexIndices.count` must be a multiple of 3, & each index within `vertices`.
+	@_alwaysEmitIntoClient public init(vertices:[Float3], triangleVertexIndices:[UInt32], isParallel:Bool = true) {
+		precondition(triangleVertexIndices.count % 3 == 0, "Triangle vertex indices must come in 3s.")
+		let triangleCount = triangleVertexIndices.count / 3
+		let triangleBounds = [AABB3](unsafeUninitializedCapacity: triangleCount){ buffer, initializedCount in
+			if triangleCount > 0 {
+				BVHTriangleBounds(vertices, triangleVertexIndices, buffer.baseAddress!, triangleCount)
+			}
+			initializedCount = triangleCount
+		}
+		self.vertices = vertices
+		self.triangleVertexIndices = triangleVertexIndices
+		self.hierarchy = BVH(primitiveBounds: triangleBounds, isParallel: isParallel)
+	}
+	
+	
+	// MARK: Queries
+	
+	/// The nearest triangle hit by the ray from `origin` along `direction` within `maxDistance` (measured in `direction`-lengths), if any.
+	@_alwaysEmitIntoClient public func intersect(origin:Float3, direction:Float3, maxDistance:Float = .infinity) -> BVHRayHit? {
+		return self.hierarchy._withUnsafePointers(emptyResult: nil){ nodes, primitiveIndices in
+			var hit = BVHRayHit()
+			return BVHIntersectRayTriangles(nodes, primitiveIndices, self.vertices, self.triangleVertexIndices, origin, direction, maxDistance, &hit) ? hit : nil
+		}
+	}
+	/// Whether any triangle is hit by the ray from `origin` along `direction` within `maxDistance` (stopping at the first found, so cheaper than `intersect(origin:direction:maxDistance:)`).
+	@_alwaysEmitIntoClient public func isOccluded(origin:Float3, direction:Float3, maxDistance:Float = .infinity) -> Bool {
+		return self.hierarchy._withUnsafePointers(emptyResult: false){ nodes, primitiveIndices in
+			BVHOccludedRayTriangles(nodes, primitiveIndices, self.vertices, self.triangleVertexIndices, origin, direction, maxDistance)
+		}
+	}
+	
+	/// The indices of the triangles whose bounds overlap `box`, in no particular order.
+	@_alwaysEmitIntoClient public func triangles(overlapping box:AABB3) -> [UInt32] {
+		return self.hierarchy._withUnsafePointers(emptyResult: []){ nodes, primitiveIndices in
+			BVH._overlapQueryResults{ BVHOverlapTriangles(nodes, primitiveIndices, self.vertices, self.triangleVertexIndices, box, $0, $1) }
+		}
+	}
+	
+	/// The point on the mesh nearest to `point`, within `maxDistance`, if any.
+	@_alwaysEmitIntoClient public func nearestPoint(to point:Float3, maxDistance:Float = .infinity) -> BVHNearestHit? {
+		return self.hierarchy._withUnsafePointers(emptyResult: nil){ nodes, primitiveIndices in
+			var hit = BVHNearestHit()
+			return BVHNearestTrianglePoint(nodes, primitiveIndices, self.vertices, self.triangleVertexIndices, point, maxDistance, &hit) ? hit : nil
+		}
+	}
+}
+
+
+/// A point set & the `BVH` over its points, for box-overlap & nearest-neighbor queries.
+public struct PointBVH
+{
+	public let points:[Float3]
+	public let hierarchy:BVH
+	
+	
+	// MARK: `init`s
+	
+	@_alwaysEmitIntoClient public init(points:[Float3], isParallel:Bool = true) {
+		let pointBounds = [AABB3](unsafeUninitializedCapacity: points.count){ buffer, initializedCount in
+			if points.count > 0 {
+				BVHPointBounds(points, buffer.baseAddress!, points.count)
+			}
+			initializedCount = points.count
+		}
+		self.points = points
+		self.hierarchy = BVH(primitiveBounds: pointBounds, isParallel: isParallel)
+	}
+	
+	
+	// MARK: Queries
+	
+	/// The indices of the points within `box` (boundary included), in no particular order.
+	@_alwaysEmitIntoClient public func points(in box:AABB3) -> [UInt32] {
+		return self.hierarchy._withUnsafePointers(emptyResult: []){ nodes, primitiveIndices in
+			BVH._overlapQueryResults{ BVHOverlapPoints(nodes, primitiveIndices, self.points, box, $0, $1) }
+		}
+	}
+	
+	/// The point nearest to `point`, within `maxDistance`, if any.
+	@_alwaysEmitIntoClient public func nearest(to point:Float3, maxDistance:Float = .infinity) -> BVHNearestHit? {
+		return self.hierarchy._withUnsafePointers(emptyResult: nil){ nodes, primitiveIndices in
+			var hit = BVHNearestHit()
+			return BVHNearestPoint(nodes, primitiveIndices, self.points, point, maxDistance, &hit) ? hit : nil
+		}
+	}
+}
@@ -0,0 +1,628 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definitions
+
+public let VUCKT_BVH_MAX_LEAF_SIZE:Int32 = 8
+public let VUCKT_BVH_BIN_COUNT:Int32 = 16
+public let VUCKT_BVH_MAX_DEPTH:Int32 = 64
+public let VUCKT_BVH_MIN_TASK_SIZE:Int32 = 4096
+
+public struct BVHNode
+{
+	public var minX:Float
+	public var minY:Float
+	public var minZ:Float
+	public var rightChildOrFirstPrimitive:UInt32
+	public var maxX:Float
+	public var maxY:Float
+	public var maxZ:Float
+	public var primitiveCount:UInt32
+	
+	public init() {
+		self.minX = Float()
+		self.minY = Float()
+		self.minZ = Float()
+		self.rightChildOrFirstPrimitive = UInt32()
+		self.maxX = Float()
+		self.maxY = Float()
+		self.maxZ = Float()
+		self.primitiveCount = UInt32()
+	}
+	
+	public init(minX:Float, minY:Float, minZ:Float, rightChildOrFirstPrimitive:UInt32, maxX:Float, maxY:Float, maxZ:Float, primitiveCount:UInt32) {
+		self.minX = minX
+		self.minY = minY
+		self.minZ = minZ
+		self.rightChildOrFirstPrimitive = rightChildOrFirstPrimitive
+		self.maxX = maxX
+		self.maxY = maxY
+		self.maxZ = maxZ
+		self.primitiveCount = primitiveCount
+	}
+}
+
+public struct BVHBuildTask
+{
+	public var nodeIndex:UInt32
+	public var firstPrimitive:UInt32
+	public var primitiveCount:UInt32
+	public var depth:UInt32
+	
+	public init() {
+		self.nodeIndex = UInt32()
+		self.firstPrimitive = UInt32()
+		self.primitiveCount = UInt32()
+		self.depth = UInt32()
+	}
+	
+	public init(nodeIndex:UInt32, firstPrimitive:UInt32, primitiveCount:UInt32, depth:UInt32) {
+		self.nodeIndex = nodeIndex
+		self.firstPrimitive = firstPrimitive
+		self.primitiveCount = primitiveCount
+		self.depth = depth
+	}
+}
+
+public struct BVHRayHit
+{
+	public var distance:Float
+	public var u:Float
+	public var v:Float
+	public var primitiveIndex:UInt32
+	
+	public init() {
+		self.distance = Float()
+		self.u = Float()
+		self.v = Float()
+		self.primitiveIndex = UInt32()
+	}
+	
+	public init(distance:Float, u:Float, v:Float, primitiveIndex:UInt32) {
+		self.distance = distance
+		self.u = u
+		self.v = v
+		self.primitiveIndex = primitiveIndex
+	}
+}
+
+public struct BVHNearestHit
+{
+	public var point:Float3
+	public var distanceSquared:Float
+	public var primitiveIndex:UInt32
+	
+	public init() {
+		self.point = Float3()
+		self.distanceSquared = Float()
+		self.primitiveIndex = UInt32()
+	}
+	
+	public init(point:Float3, distanceSquared:Float, primitiveIndex:UInt32) {
+		self.point = point
+		self.distanceSquared = distanceSquared
+		self.primitiveIndex = primitiveIndex
+	}
+}
+
+
+
+// MARK: Primitive Bounds
+
+@_alwaysEmitIntoClient public func BVHTriangleBounds(_ vertices:UnsafePointer<Float3>, _ triangleVertexIndices:UnsafePointer<UInt32>, _ out:UnsafeMutablePointer<AABB3>, _ triangleCount:Int) {
+	for triangleI in 0..<triangleCount {
+		let a = vertices[Int(triangleVertexIndices[triangleI * 3])], b = vertices[Int(triangleVertexIndices[triangleI * 3 + 1])], c = vertices[Int(triangleVertexIndices[triangleI * 3 + 2])]
+		out[triangleI] = AABB3MergePoint(AABB3MergePoint(AABB3(min: a, max: a), b), c)
+	}
+}
+@_alwaysEmitIntoClient public func BVHPointBounds(_ points:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<AABB3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = AABB3(min: points[i], max: points[i])
+	}
+}
+
+
+
+// MARK: Building
+
+@usableFromInline internal func _vucktBVHNodeMin(_ node:BVHNode) -> SIMD3<Float> {
+	return SIMD3<Float>(node.minX, node.minY, node.minZ)
+}
+@usableFromInline internal func _vucktBVHNodeMax(_ node:BVHNode) -> SIMD3<Float> {
+	return SIMD3<Float>(node.maxX, node.maxY, node.maxZ)
+}
+@usableFromInline internal func _vucktBVHHalfArea(_ min:SIMD3<Float>, _ max:SIMD3<Float>) -> Float {
+	let size = max - min
+	return size.x * size.y + size.y * size.z + size.z * size.x
+}
+@usableFromInline internal func _vucktBVHCentroid(_ box:AABB3) -> SIMD3<Float> {
+	return Float3ToSimd(box.min) + Float3ToSimd(box.max)
+}
+@usableFromInline internal func _vucktBVHBinIndex(_ centroid:Float, _ centroidMin:Float, _ binScale:Float, _ binCount:Int) -> Int {
+	return Swift.min(Int((centroid - centroidMin) * binScale), binCount - 1)
+}
+
+@usableFromInline internal func _vucktBVHPartitionAtMedian(_ primitiveBounds:UnsafePointer<AABB3>, _ indices:UnsafeMutablePointer<UInt32>, _ count:Int, _ axis:Int) {
+	func centroid(_ entryI:Int) -> Float {
+		return _vucktBVHCentroid(primitiveBounds[Int(indices[entryI])])[axis]
+	}
+	var low = 0, high = count - 1
+	let median = count / 2
+	while low < high {
+		let pivot = centroid(median)
+		var i = low, j = high
+		repeat {
+			while centroid(i) < pivot { i += 1 }
+			while pivot < centroid(j) { j -= 1 }
+			if i <= j {
+				(indices[i], indices[j]) = (indices[j], indices[i])
+				i += 1
+				j -= 1
+			}
+		} while i <= j
+		if j < median { low = i }
+		if median < i { high = j }
+	}
+}
+
+@usableFromInline internal func _vucktBVHBuildNode(_ primitiveBounds:UnsafePointer<AABB3>, _ primitiveIndices:UnsafeMutablePointer<UInt32>, _ scratchNodes:UnsafeMutablePointer<BVHNode>, _ task:BVHBuildTask) -> (BVHBuildTask, BVHBuildTask)? {
+	let indices = primitiveIndices + Int(task.firstPrimitive)
+	let count = Int(task.primitiveCount)
+	
+	var nodeMin = SIMD3<Float>(repeating: .infinity), nodeMax = -nodeMin
+	var centroidMin = nodeMin, centroidMax = nodeMax
+	for i in 0..<count {
+		let box = primitiveBounds[Int(indices[i])]
+		let centroid = _vucktBVHCentroid(box)
+		nodeMin = pointwiseMin(nodeMin, Float3ToSimd(box.min))
+		nodeMax = pointwiseMax(nodeMax, Float3ToSimd(box.max))
+		centroidMin = pointwiseMin(centroidMin, centroid)
+		centroidMax = pointwiseMax(centroidMax, centroid)
+	}
+	scratchNodes[Int(task.nodeIndex)] = BVHNode(minX: nodeMin.x, minY: nodeMin.y, minZ: nodeMin.z, rightChildOrFirstPrimitive: task.firstPrimitive, maxX: nodeMax.x, maxY: nodeMax.y, maxZ: nodeMax.z, primitiveCount: UInt32(count))
+	if count <= 1 {
+		return nil
+	}
+	
+	let centroidExtent = centroidMax - centroidMin
+	var widestAxis = (centroidExtent.y > centroidExtent.x) ? 1 : 0
+	widestAxis = (centroidExtent.z > centroidExtent[widestAxis]) ? 2 : widestAxis
+	var leftCount:Int
+	
+	var countDepth = 0
+	while (1 << countDepth) < count { countDepth += 1 }
+	let nodeArea = _vucktBVHHalfArea(nodeMin, nodeMax)
+	if !(centroidExtent[widestAxis] > 0) {
+		if count <= Int(VUCKT_BVH_MAX_LEAF_SIZE) {
+			return nil
+		}
+		leftCount = count / 2
+	}
+	else if Int(task.depth) + countDepth >= Int(VUCKT_BVH_MAX_DEPTH) || !(nodeArea > 0) {
+		if count <= Int(VUCKT_BVH_MAX_LEAF_SIZE) {
+			return nil
+		}
+		_vucktBVHPartitionAtMedian(primitiveBounds, indices, count, widestAxis)
+		leftCount = count / 2
+	}
+	else {
+		let binCount = Swift.min(count, Int(VUCKT_BVH_BIN_COUNT))
+		var binScale = SIMD3<Float>()
+		for axis in 0..<3 where centroidExtent[axis] > 0 {
+			binScale[axis] = (Float(binCount) * 0.99999) / centroidExtent[axis]
+		}
+		var binMin = [[SIMD3<Float>]](repeating: [SIMD3<Float>](repeating: SIMD3<Float>(repeating: .infinity), count: binCount), count: 3)
+		var binMax = [[SIMD3<Float>]](repeating: [SIMD3<Float>](repeating: SIMD3<Float>(repeating: -.infinity), count: binCount), count: 3)
+		var binPrimitiveCounts = [[Int]](repeating: [Int](repeating: 0, count: binCount), count: 3)
+		for i in 0..<count {
+			let box = primitiveBounds[Int(indices[i])]
+			let centroid = _vucktBVHCentroid(box)
+			for axis in 0..<3 {
+				let binI = _vucktBVHBinIndex(centroid[axis], centroidMin[axis], binScale[axis], binCount)
+				binMin[axis][binI] = pointwiseMin(binMin[axis][binI], Float3ToSimd(box.min))
+				binMax[axis][binI] = pointwiseMax(binMax[axis][binI], Float3ToSimd(box.max))
+				binPrimitiveCounts[axis][binI] += 1
+			}
+		}
+		
+		var bestCost = Float.infinity
+		var bestAxis = widestAxis, bestSplitBin = binCount / 2
+		for axis in 0..<3 where centroidExtent[axis] > 0 {
+			var rightArea = [Float](repeating: 0, count: binCount)
+			var rightCount = [Int](repeating: 0, count: binCount)
+			var sideMin = SIMD3<Float>(repeating: .infinity), sideMax = -sideMin
+			var sideCount = 0
+			for binI in stride(from: binCount - 1, to: 0, by: -1) {
+				sideMin = pointwiseMin(sideMin, binMin[axis][binI])
+				sideMax = pointwiseMax(sideMax, binMax[axis][binI])
+				sideCount += binPrimitiveCounts[axis][binI]
+				rightArea[binI] = (sideCount > 0) ? _vucktBVHHalfArea(sideMin, sideMax) : 0
+				rightCount[binI] = sideCount
+			}
+			sideMin = SIMD3<Float>(repeating: .infinity)
+			sideMax = -sideMin
+			sideCount = 0
+			for splitBinI in 1..<binCount {
+				sideMin = pointwiseMin(sideMin, binMin[axis][splitBinI - 1])
+				sideMax = pointwiseMax(sideMax, binMax[axis][splitBinI - 1])
+				sideCount += binPrimitiveCounts[axis][splitBinI - 1]
+				if sideCount == 0 || rightCount[splitBinI] == 0 {
+					continue
+				}
+				let cost = _vucktBVHHalfArea(sideMin, sideMax) * Float(sideCount) + rightArea[splitBinI] * Float(rightCount[splitBinI])
+				if cost < bestCost {
+					bestCost = cost
+					bestAxis = axis
+					bestSplitBin = splitBinI
+				}
+			}
+		}
+		
+		if count <= Int(VUCKT_BVH_MAX_LEAF_SIZE) && bestCost >= (Float(count) - 1) * nodeArea {
+			return nil
+		}
+		
+		var i = 0, j = count
+		while i < j {
+			let centroid = _vucktBVHCentroid(primitiveBounds[Int(indices[i])])
+			if _vucktBVHBinIndex(centroid[bestAxis], centroidMin[bestAxis], binScale[bestAxis], binCount) < bestSplitBin {
+				i += 1
+			}
+			else {
+				j -= 1
+				(indices[i], indices[j]) = (indices[j], indices[i])
+			}
+		}
+		leftCount = i
+		if leftCount == 0 || leftCount == count {
+			_vucktBVHPartitionAtMedian(primitiveBounds, indices, count, widestAxis)
+			leftCount = count / 2
+		}
+	}
+	
+	let rightNodeIndex = task.nodeIndex + 2 * UInt32(leftCount)
+	scratchNodes[Int(task.nodeIndex)].rightChildOrFirstPrimitive = rightNodeIndex
+	scratchNodes[Int(task.nodeIndex)].primitiveCount = 0
+	return (
+		BVHBuildTask(nodeIndex: task.nodeIndex + 1, firstPrimitive: task.firstPrimitive, primitiveCount: UInt32(leftCount), depth: task.depth + 1),
+		BVHBuildTask(nodeIndex: rightNodeIndex, firstPrimitive: task.firstPrimitive + UInt32(leftCount), primitiveCount: UInt32(count - leftCount), depth: task.depth + 1)
+	)
+}
+
+@_alwaysEmitIntoClient public func BVHBuildTopLevels(_ primitiveBounds:UnsafePointer<AABB3>, _ primitiveIndices:UnsafeMutablePointer<UInt32>, _ scratchNodes:UnsafeMutablePointer<BVHNode>, _ n:Int, _ outTasks:UnsafeMutablePointer<BVHBuildTask>, _ maxTaskCount:Int) -> Int {
+	for i in 0..<n {
+		primitiveIndices[i] = UInt32(i)
+	}
+	outTasks[0] = BVHBuildTask(nodeIndex: 0, firstPrimitive: 0, primitiveCount: UInt32(n), depth: 0)
+	var taskCount = 1
+	while taskCount > 0 && taskCount < maxTaskCount {
+		var largestTaskI = 0
+		for taskI in 1..<taskCount where outTasks[taskI].primitiveCount > outTasks[largestTaskI].primitiveCount {
+			largestTaskI = taskI
+		}
+		if outTasks[largestTaskI].primitiveCount < UInt32(VUCKT_BVH_MIN_TASK_SIZE) {
+			break
+		}
+		if let (leftTask, rightTask) = _vucktBVHBuildNode(primitiveBounds, primitiveIndices, scratchNodes, outTasks[largestTaskI]) {
+			outTasks[largestTaskI] = leftTask
+			outTasks[taskCount] = rightTask
+			taskCount += 1
+		}
+		else {
+			taskCount -= 1
+			outTasks[largestTaskI] = outTasks[taskCount]
+		}
+	}
+	return taskCount
+}
+
+@_alwaysEmitIntoClient public func BVHBuildSubtree(_ primitiveBounds:UnsafePointer<AABB3>, _ primitiveIndices:UnsafeMutablePointer<UInt32>, _ scratchNodes:UnsafeMutablePointer<BVHNode>, _ task:BVHBuildTask) {
+	var stack:[BVHBuildTask] = []
+	var task = task
+	while true {
+		if let (leftTask, rightTask) = _vucktBVHBuildNode(primitiveBounds, primitiveIndices, scratchNodes, task) {
+			stack.append(rightTask)
+			task = leftTask
+		}
+		else if let stackedTask = stack.popLast() {
+			task = stackedTask
+		}
+		else {
+			break
+		}
+	}
+}
+
+@_alwaysEmitIntoClient public func BVHBuildFlatten(_ scratchNodes:UnsafePointer<BVHNode>, _ outNodes:UnsafeMutablePointer<BVHNode>) -> Int {
+	var stack:[(nodeI:Int, rightScratchIndex:Int)] = []
+	var nodeCount = 0
+	var scratchIndex = 0
+	while true {
+		let node = scratchNodes[scratchIndex]
+		outNodes[nodeCount] = node
+		if node.primitiveCount == 0 {
+			stack.append((nodeI: nodeCount, rightScratchIndex: Int(node.rightChildOrFirstPrimitive)))
+			scratchIndex += 1
+			nodeCount += 1
+		}
+		else if let (parentI, rightScratchIndex) = stack.popLast() {
+			nodeCount += 1
+			outNodes[parentI].rightChildOrFirstPrimitive = UInt32(nodeCount)
+			scratchIndex = rightScratchIndex
+		}
+		else {
+			return nodeCount + 1
+		}
+	}
+}
+
+@_alwaysEmitIntoClient public func BVHBuild(_ primitiveBounds:UnsafePointer<AABB3>, _ primitiveIndices:UnsafeMutablePointer<UInt32>, _ scratchNodes:UnsafeMutablePointer<BVHNode>, _ outNodes:UnsafeMutablePointer<BVHNode>, _ n:Int) -> Int {
+	var rootTask = BVHBuildTask()
+	if BVHBuildTopLevels(primitiveBounds, primitiveIndices, scratchNodes, n, &rootTask, 1) > 0 {
+		BVHBuildSubtree(primitiveBounds, primitiveIndices, scratchNodes, rootTask)
+	}
+	return BVHBuildFlatten(scratchNodes, outNodes)
+}
+
+
+
+// MARK: Ray Queries
+
+@usableFromInline internal func _vucktBVHRayNodeEntryDistance(_ node:BVHNode, _ origin:SIMD3<Float>, _ inverseDirection:SIMD3<Float>, _ maxDistance:Float) -> Float {
+	let t0 = (_vucktBVHNodeMin(node) - origin) * inverseDirection, t1 = (_vucktBVHNodeMax(node) - origin) * inverseDirection
+	var entry:Float = 0, exit = maxDistance
+	for axis in 0..<3 where !t0[axis].isNaN && !t1[axis].isNaN {
+		entry = Swift.max(entry, Swift.min(t0[axis], t1[axis]))
+		exit = Swift.min(exit, Swift.max(t0[axis], t1[axis]))
+	}
+	return (entry <= exit) ? entry : .infinity
+}
+@usableFromInline internal func _vucktBVHTriangle(_ vertices:UnsafePointer<Float3>, _ triangleVertexIndices:UnsafePointer<UInt32>, _ triangleI:UInt32) -> (Float3, Float3, Float3) {
+	let vertexIndices = triangleVertexIndices + Int(triangleI) * 3
+	return (vertices[Int(vertexIndices[0])], vertices[Int(vertexIndices[1])], vertices[Int(vertexIndices[2])])
+}
+
+@_alwaysEmitIntoClient public func BVHIntersectRayTriangles(_ nodes:UnsafePointer<BVHNode>, _ primitiveIndices:UnsafePointer<UInt32>, _ vertices:UnsafePointer<Float3>, _ triangleVertexIndices:UnsafePointer<UInt32>, _ origin:Float3, _ direction:Float3, _ maxDistance:Float, _ outHit:UnsafeMutablePointer<BVHRayHit>) -> Bool {
+	let ray = Ray3(origin: origin, direction: direction)
+	let rayOrigin = Float3ToSimd(origin), inverseDirection = 1 / Float3ToSimd(direction)
+	var closestDistance = maxDistance
+	var didHit = false
+	var stack:[(nodeI:Int, entryDistance:Float)] = []
+	var nodeI = 0
+	if _vucktBVHRayNodeEntryDistance(nodes[0], rayOrigin, inverseDirection, closestDistance) == .infinity {
+		return false
+	}
+	while true {
+		let node = nodes[nodeI]
+		if node.primitiveCount == 0 {
+			let leftI = nodeI + 1, rightI = Int(node.rightChildOrFirstPrimitive)
+			let leftEntry = _vucktBVHRayNodeEntryDistance(nodes[leftI], rayOrigin, inverseDirection, closestDistance)
+			let rightEntry = _vucktBVHRayNodeEntryDistance(nodes[rightI], rayOrigin, inverseDirection, closestDistance)
+			if leftEntry != .infinity || rightEntry != .infinity {
+				let isLeftNearer = (leftEntry <= rightEntry)
+				nodeI = isLeftNearer ? leftI : rightI
+				let fartherEntry = isLeftNearer ? rightEntry : leftEntry
+				if fartherEntry != .infinity {
+					stack.append((nodeI: isLeftNearer ? rightI : leftI, entryDistance: fartherEntry))
+				}
+				continue
+			}
+		}
+		else {
+			let firstEntryI = Int(node.rightChildOrFirstPrimitive)
+			for entryI in firstEntryI..<(firstEntryI + Int(node.primitiveCount)) {
+				let triangleI = primitiveIndices[entryI]
+				let (a, b, c) = _vucktBVHTriangle(vertices, triangleVertexIndices, triangleI)
+				var u:Float = 0, v:Float = 0
+				let distance = Ray3IntersectTriangle(ray, a, b, c, closestDistance, &u, &v)
+				if distance != .infinity {
+					closestDistance = distance
+					outHit.pointee = BVHRayHit(distance: distance, u: u, v: v, primitiveIndex: triangleI)
+					didHit = true
+				}
+			}
+		}
+		repeat {
+			guard let stacked = stack.popLast() else {
+				return didHit
+			}
+			nodeI = stacked.nodeI
+			if stacked.entryDistance <= closestDistance {
+				break
+			}
+		} while true
+	}
+}
+
+@_alwaysEmitIntoClient public func BVHOccludedRayTriangles(_ nodes:UnsafePointer<BVHNode>, _ primitiveIndices:UnsafePointer<UInt32>, _ vertices:UnsafePointer<Float3>, _ triangleVertexIndices:UnsafePointer<UInt32>, _ origin:Float3, _ direction:Float3, _ maxDistance:Float) -> Bool {
+	let ray = Ray3(origin: origin, direction: direction)
+	let rayOrigin = Float3ToSimd(origin), inverseDirection = 1 / Float3ToSimd(direction)
+	var stack = [ 0 ]
+	while let nodeI = stack.popLast() {
+		let node = nodes[nodeI]
+		if _vucktBVHRayNodeEntryDistance(node, rayOrigin, inverseDirection, maxDistance) == .infinity {
+			continue
+		}
+		if node.primitiveCount == 0 {
+			stack.append(Int(node.rightChildOrFirstPrimitive))
+			stack.append(nodeI + 1)
+			continue
+		}
+		let firstEntryI = Int(node.rightChildOrFirstPrimitive)
+		for entryI in firstEntryI..<(firstEntryI + Int(node.primitiveCount)) {
+			let (a, b, c) = _vucktBVHTriangle(vertices, triangleVertexIndices, primitiveIndices[entryI])
+			if Ray3IntersectTriangle(ray, a, b, c, maxDistance, nil, nil) != .infinity {
+				return true
+			}
+		}
+	}
+	return false
+}
+
+
+
+// MARK: Overlap Queries
+
+@usableFromInline internal func _vucktBVHForEachOverlappingLeafEntry(_ nodes:UnsafePointer<BVHNode>, _ query:AABB3, _ body:(Int) -> Void) {
+	let queryMin = Float3ToSimd(query.min), queryMax = Float3ToSimd(query.max)
+	var stack = [ 0 ]
+	while let nodeI = stack.popLast() {
+		let node = nodes[nodeI]
+		if !(all(_vucktBVHNodeMin(node) .<= queryMax) && all(queryMin .<= _vucktBVHNodeMax(node))) {
+			continue
+		}
+		if node.primitiveCount == 0 {
+			stack.append(Int(node.rightChildOrFirstPrimitive))
+			stack.append(nodeI + 1)
+			continue
+		}
+		let firstEntryI = Int(node.rightChildOrFirstPrimitive)
+		for entryI in firstEntryI..<(firstEntryI + Int(node.primitiveCount)) {
+			body(entryI)
+		}
+	}
+}
+
+@_alwaysEmitIntoClient public func BVHOverlapTriangles(_ nodes:UnsafePointer<BVHNode>, _ primitiveIndices:UnsafePointer<UInt32>, _ vertices:UnsafePointer<Float3>, _ triangleVertexIndices:UnsafePointer<UInt32>, _ query:AABB3, _ outTriangleIndices:UnsafeMutablePointer<UInt32>?, _ capacity:Int) -> Int {
+	var overlapCount = 0
+	_vucktBVHForEachOverlappingLeafEntry(nodes, query){ entryI in
+		let triangleI = primitiveIndices[entryI]
+		var triangleBounds = AABB3()
+		BVHTriangleBounds(vertices, triangleVertexIndices + Int(triangleI) * 3, &triangleBounds, 1)
+		if AABB3Intersects(triangleBounds, query) {
+			if overlapCount < capacity {
+				outTriangleIndices![overlapCount] = triangleI
+			}
+			overlapCount += 1
+		}
+	}
+	return overlapCount
+}
+@_alwaysEmitIntoClient public func BVHOverlapPoints(_ nodes:UnsafePointer<BVHNode>, _ primitiveIndices:UnsafePointer<UInt32>, _ points:UnsafePointer<Float3>, _ query:AABB3, _ outPointIndices:UnsafeMutablePointer<UInt32>?, _ capacity:Int) -> Int {
+	var overlapCount = 0
+	_vucktBVHForEachOverlappingLeafEntry(nodes, query){ entryI in
+		let pointI = primitiveIndices[entryI]
+		if AABB3ContainsPoint(query, points[Int(pointI)]) {
+			if overlapCount < capacity {
+				outPointIndices![overlapCount] = pointI
+			}
+			overlapCount += 1
+		}
+	}
+	return overlapCount
+}
+
+
+
+// MARK: Nearest-Point Queries
+
+@usableFromInline internal func _vucktBVHNodeDistanceSquared(_ node:BVHNode, _ point:SIMD3<Float>) -> Float {
+	let outside = pointwiseMax(pointwiseMax(_vucktBVHNodeMin(node) - point, point - _vucktBVHNodeMax(node)), SIMD3<Float>())
+	return dot(outside, outside)
+}
+@usableFromInline internal func _vucktBVHClosestPointOnTriangle(_ point:SIMD3<Float>, _ a:Float3, _ b:Float3, _ c:Float3) -> SIMD3<Float> {
+	let vertexA = Float3ToSimd(a), vertexB = Float3ToSimd(b), vertexC = Float3ToSimd(c)
+	let ab = vertexB - vertexA, ac = vertexC - vertexA, ap = point - vertexA
+	let d1 = dot(ab, ap), d2 = dot(ac, ap)
+	if d1 <= 0 && d2 <= 0 { return vertexA }
+	let bp = point - vertexB
+	let d3 = dot(ab, bp), d4 = dot(ac, bp)
+	if d3 >= 0 && d4 <= d3 { return vertexB }
+	let vc = d1 * d4 - d3 * d2
+	if vc <= 0 && d1 >= 0 && d3 <= 0 { return vertexA + ab * (d1 / (d1 - d3)) }
+	let cp = point - vertexC
+	let d5 = dot(ab, cp), d6 = dot(ac, cp)
+	if d6 >= 0 && d5 <= d6 { return vertexC }
+	let vb = d5 * d2 - d1 * d6
+	if vb <= 0 && d2 >= 0 && d6 <= 0 { return vertexA + ac * (d2 / (d2 - d6)) }
+	let va = d3 * d6 - d5 * d4
+	if va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0 { return vertexB + (vertexC - vertexB) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))) }
+	let denominator = 1 / (va + vb + vc)
+	return vertexA + ab * (vb * denominator) + ac * (vc * denominator)
+}
+
+/// Calls `body` with each leaf entry of `nodes` nearer to `queryPoint` than `bestDistanceSquared` (which `body` narrows as it finds nearer primitives), nearer child first.
+@usableFromInline internal func _vucktBVHForEachNearLeafEntry(_ nodes:UnsafePointer<BVHNode>, _ queryPoint:SIMD3<Float>, _ bestDistanceSquared:inout Float, _ body:(Int, inout Float) -> Void) {
+	var stack:[(nodeI:Int, distanceSquared:Float)] = []
+	var nodeI = 0
+	if _vucktBVHNodeDistanceSquared(nodes[0], queryPoint) > bestDistanceSquared {
+		return
+	}
+	while true {
+		let node = nodes[nodeI]
+		if node.primitiveCount == 0 {
+			let leftI = nodeI + 1, rightI = Int(node.rightChildOrFirstPrimitive)
+			let leftDistanceSquared = _vucktBVHNodeDistanceSquared(nodes[leftI], queryPoint)
+			let rightDistanceSquared = _vucktBVHNodeDistanceSquared(nodes[rightI], queryPoint)
+			let isLeftNearer = (leftDistanceSquared <= rightDistanceSquared)
+			let nearerDistanceSquared = isLeftNearer ? leftDistanceSquared : rightDistanceSquared
+			let fartherDistanceSquared = isLeftNearer ? rightDistanceSquared : leftDistanceSquared
+			if nearerDistanceSquared <= bestDistanceSquared {
+				if fartherDistanceSquared <= bestDistanceSquared {
+					stack.append((nodeI: isLeftNearer ? rightI : leftI, distanceSquared: fartherDistanceSquared))
+				}
+				nodeI = isLeftNearer ? leftI : rightI
+				continue
+			}
+		}
+		else {
+			let firstEntryI = Int(node.rightChildOrFirstPrimitive)
+			for entryI in firstEntryI..<(firstEntryI + Int(node.primitiveCount)) {
+				body(entryI, &bestDistanceSquared)
+			}
+		}
+		repeat {
+			guard let stacked = stack.popLast() else {
+				return
+			}
+			nodeI = stacked.nodeI
+			if stacked.distanceSquared <= bestDistanceSquared {
+				break
+			}
+		} while true
+	}
+}
+
+@_alwaysEmitIntoClient public func BVHNearestPoint(_ nodes:UnsafePointer<BVHNode>, _ primitiveIndices:UnsafePointer<UInt32>, _ points:UnsafePointer<Float3>, _ queryPoint:Float3, _ maxDistance:Float, _ outHit:UnsafeMutablePointer<BVHNearestHit>) -> Bool {
+	let query = Float3ToSimd(queryPoint)
+	var bestDistanceSquared = maxDistance * maxDistance
+	var didFind = false
+	_vucktBVHForEachNearLeafEntry(nodes, query, &bestDistanceSquared){ entryI, bestDistanceSquared in
+		let pointI = primitiveIndices[entryI]
+		let offset = Float3ToSimd(points[Int(pointI)]) - query
+		let distanceSquared = dot(offset, offset)
+		if distanceSquared <= bestDistanceSquared {
+			bestDistanceSquared = distanceSquared
+			outHit.pointee = BVHNearestHit(point: points[Int(pointI)], distanceSquared: distanceSquared, primitiveIndex: pointI)
+			didFind = true
+		}
+	}
+	return didFind
+}
+@_alwaysEmitIntoClient public func BVHNearestTrianglePoint(_ nodes:UnsafePointer<BVHNode>, _ primitiveIndices:UnsafePointer<UInt32>, _ vertices:UnsafePointer<Float3>, _ triangleVertexIndices:UnsafePointer<UInt32>, _ queryPoint:Float3, _ maxDistance:Float, _ outHit:UnsafeMutablePointer<BVHNearestHit>) -> Bool {
+	let query = Float3ToSimd(queryPoint)
+	var bestDistanceSquared = maxDistance * maxDistance
+	var didFind = false
+	_vucktBVHForEachNearLeafEntry(nodes, query, &bestDistanceSquared){ entryI, bestDistanceSquared in
+		let triangleI = primitiveIndices[entryI]
+		let (a, b, c) = _vucktBVHTriangle(vertices, triangleVertexIndices, triangleI)
+		let point = _vucktBVHClosestPointOnTriangle(query, a, b, c)
+		let offset = point - query
+		let distanceSquared = dot(offset, offset)
+		if distanceSquared <= bestDistanceSquared {
+			bestDistanceSquared = distanceSquared
+			outHit.pointee = BVHNearestHit(point: Float3FromSimd(point), distanceSquared: distanceSquared, primitiveIndex: triangleI)
+			didFind = true
+		}
+	}
+	return didFind
+}
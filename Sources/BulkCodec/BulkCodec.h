@@ -0,0 +1,381 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+// A bulk binary encoding for arrays of Vuckt values, for sending many of them at once (e.g. replicating positions & rotations over a network).
+// An array's canonical encoding is its elements' components back to back, each little-endian & without any of the in-memory padding (so a `Float3` is 12 bytes, whichever backend or byte order wrote it).
+// An encoding can be a delta against a previous snapshot of the same count: the XOR of the two arrays' encodings, which is all zeros wherever a component's unchanged.
+// A compacted encoding shrinks the canonical bytes by their zeros.  It's a sequence of 8-byte groups (the last zero-padded), each either:
+//	• a mask byte of the group's nonzero bytes, followed by those bytes; or
+//	• a 0 mask byte, followed by a count byte `k`, for the group & the next `k` all being zero.
+// So a group takes 1–9 bytes, & up to 256 unchanged groups (2 KB) of a delta take 2 bytes.
+
+
+
+#pragma mark Format Constants
+
+/// The bytes of canonical encoding the compacted coders stage (on the stack) at a time.  Each element's encoding must fit ⅛th of this (all the Vuckt types' take 128 or fewer).
+#define VUCKT_BULK_CODEC_BLOCK_SIZE 4096
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	#define VUCKT_BULK_CODEC_IS_BIG_ENDIAN 1
+#else
+	#define VUCKT_BULK_CODEC_IS_BIG_ENDIAN 0
+#endif
+
+
+
+#pragma mark Struct Definition
+
+/// How an element type's components lie in memory: `spanCount` spans (vectors, or matrix columns), each of `spanWordCount` components `wordSize` bytes big, in `slotWordCount` components' room (the rest being padding).
+struct BulkCodecLayout {
+	/// The bytes per component: 1, 2, 4, or 8.
+	uint32_t wordSize;
+	uint32_t spanWordCount;
+	uint32_t slotWordCount;
+	uint32_t spanCount;
+};
+typedef struct BulkCodecLayout BulkCodecLayout;
+
+
+
+#pragma mark Layout Construction & Sizes
+
+/// The layout of an element type `elementStride` bytes apart in memory made of `spanCount` spans of `spanWordCount` components, each `wordSize` bytes big.  E.g. `BulkCodecLayoutMake(4, 3, 1, sizeof(Float3))` or `BulkCodecLayoutMake(4, 3, 3, sizeof(Float3x3))`.
+NS_INLINE BulkCodecLayout BulkCodecLayoutMake(uint32_t wordSize, uint32_t spanWordCount, uint32_t spanCount, size_t elementStride) {
+	return (BulkCodecLayout){ wordSize, spanWordCount, (uint32_t)(elementStride / spanCount / wordSize), spanCount };
+}
+
+/// The bytes one element's canonical encoding takes.
+NS_INLINE size_t BulkCodecEncodedElementSize(BulkCodecLayout layout) {
+	return (size_t)layout.wordSize * layout.spanWordCount * layout.spanCount;
+}
+/// The bytes one element takes in memory.
+NS_INLINE size_t BulkCodecElementStride(BulkCodecLayout layout) {
+	return (size_t)layout.wordSize * layout.slotWordCount * layout.spanCount;
+}
+
+/// The bytes `n` elements' canonical encoding takes.
+NS_INLINE size_t BulkCodecEncodedSize(BulkCodecLayout layout, size_t n) {
+	return n * BulkCodecEncodedElementSize(layout);
+}
+/// The most bytes `n` elements' compacted encoding can take (the room `BulkCodecEncodeCompacted()` needs to write it).
+NS_INLINE size_t BulkCodecCompactedSizeLimit(BulkCodecLayout layout, size_t n) {
+	return (BulkCodecEncodedSize(layout, n) + 7) / 8 * 9;
+}
+
+
+
+#pragma mark Internal Helpers
+
+/// The index within a span's canonical encoding of byte `byteI` of the span in memory.
+NS_INLINE size_t _BulkCodecCanonicalByteIndex(size_t byteI, size_t wordSize) {
+	#if VUCKT_BULK_CODEC_IS_BIG_ENDIAN
+		return byteI - byteI % wordSize + (wordSize - 1 - byteI % wordSize);
+	#else
+		(void)wordSize;
+		return byteI;
+	#endif
+}
+
+/// Copies the `SPAN_SIZE`-byte spans of `n` `SLOT_SIZE`-byte slots back to back, XORing them a `WORD_TYPE` at a time with the same in `previous`, if given (all constants, so the copies compile to plain moves).
+#define _VUCKT_BULK_CODEC_GATHER_SPANS(SPAN_SIZE, SLOT_SIZE, WORD_TYPE, src, previous, n, out) \
+	if ((previous) == NULL) { \
+		for (size_t spanI = 0; spanI < (n); ++spanI) \
+			memcpy((out) + spanI * (SPAN_SIZE), (src) + spanI * (SLOT_SIZE), SPAN_SIZE); \
+	} else { \
+		for (size_t spanI = 0; spanI < (n); ++spanI) { \
+			WORD_TYPE span[(SPAN_SIZE) / sizeof(WORD_TYPE)], previousSpan[(SPAN_SIZE) / sizeof(WORD_TYPE)]; \
+			memcpy(span, (src) + spanI * (SLOT_SIZE), SPAN_SIZE); \
+			memcpy(previousSpan, (previous) + spanI * (SLOT_SIZE), SPAN_SIZE); \
+			for (size_t wordI = 0; wordI < (SPAN_SIZE) / sizeof(WORD_TYPE); ++wordI) \
+				span[wordI] ^= previousSpan[wordI]; \
+			memcpy((out) + spanI * (SPAN_SIZE), span, SPAN_SIZE); \
+		} \
+	}
+/// The reverse of `_VUCKT_BULK_CODEC_GATHER_SPANS()`, zeroing each slot's padding.  Each slot's `previous` span is read before the slot's written, so `previous` may be `out`.
+#define _VUCKT_BULK_CODEC_SCATTER_SPANS(SPAN_SIZE, SLOT_SIZE, WORD_TYPE, in, previous, n, out) \
+	for (size_t spanI = 0; spanI < (n); ++spanI) { \
+		WORD_TYPE span[(SPAN_SIZE) / sizeof(WORD_TYPE)]; \
+		memcpy(span, (in) + spanI * (SPAN_SIZE), SPAN_SIZE); \
+		if ((previous) != NULL) { \
+			WORD_TYPE previousSpan[(SPAN_SIZE) / sizeof(WORD_TYPE)]; \
+			memcpy(previousSpan, (previous) + spanI * (SLOT_SIZE), SPAN_SIZE); \
+			for (size_t wordI = 0; wordI < (SPAN_SIZE) / sizeof(WORD_TYPE); ++wordI) \
+				span[wordI] ^= previousSpan[wordI]; \
+		} \
+		memcpy((out) + spanI * (SLOT_SIZE), span, SPAN_SIZE); \
+		memset((out) + spanI * (SLOT_SIZE) + (SPAN_SIZE), 0, (SLOT_SIZE) - (SPAN_SIZE)); \
+	}
+
+NS_INLINE void _BulkCodecGatherSpans(const uint8_t *src, const uint8_t *VUCKT_NULLABLE previous, size_t n, size_t spanSize, size_t slotSize, size_t wordSize, uint8_t *out) {
+	#if !VUCKT_BULK_CODEC_IS_BIG_ENDIAN
+		if (spanSize == slotSize) {
+			// Unpadded: the encoding's just the bytes.
+			size_t size = n * spanSize;
+			if (previous == NULL) {
+				memcpy(out, src, size);
+				return;
+			}
+			size_t byteI = 0;
+			for (; byteI + 8 <= size; byteI += 8) {
+				uint64_t word, previousWord;
+				memcpy(&word, src + byteI, 8);
+				memcpy(&previousWord, previous + byteI, 8);
+				word ^= previousWord;
+				memcpy(out + byteI, &word, 8);
+			}
+			for (; byteI < size; ++byteI)
+				out[byteI] = src[byteI] ^ previous[byteI];
+			return;
+		}
+		// The padded Vuckt types' spans: 3 components in the room of 4.
+		if (slotSize * 3 == spanSize * 4) {
+			switch (spanSize) {
+				case 6: _VUCKT_BULK_CODEC_GATHER_SPANS(6, 8, uint16_t, src, previous, n, out) return;
+				case 12: _VUCKT_BULK_CODEC_GATHER_SPANS(12, 16, uint32_t, src, previous, n, out) return;
+				case 24: _VUCKT_BULK_CODEC_GATHER_SPANS(24, 32, uint64_t, src, previous, n, out) return;
+			}
+		}
+	#endif
+	for (size_t spanI = 0; spanI < n; ++spanI) {
+		for (size_t byteI = 0; byteI < spanSize; ++byteI) {
+			uint8_t byte = src[spanI * slotSize + byteI];
+			if (previous != NULL)
+				byte ^= previous[spanI * slotSize + byteI];
+			out[spanI * spanSize + _BulkCodecCanonicalByteIndex(byteI, wordSize)] = byte;
+		}
+	}
+}
+
+/// Reads the canonical encoding of `n` spans of `spanSize` bytes from `in` (XORing each with the same in `previous`, if given) into `out`'s `slotSize`-byte slots, zeroing their padding.  `previous` may be `out`.
+NS_INLINE void _BulkCodecScatterSpans(const uint8_t *in, const uint8_t *VUCKT_NULLABLE previous, size_t n, size_t spanSize, size_t slotSize, size_t wordSize, uint8_t *out) {
+	#if !VUCKT_BULK_CODEC_IS_BIG_ENDIAN
+		if (spanSize == slotSize) {
+			size_t size = n * spanSize;
+			if (previous == NULL) {
+				memcpy(out, in, size);
+				return;
+			}
+			size_t byteI = 0;
+			for (; byteI + 8 <= size; byteI += 8) {
+				uint64_t word, previousWord;
+				memcpy(&word, in + byteI, 8);
+				memcpy(&previousWord, previous + byteI, 8);
+				word ^= previousWord;
+				memcpy(out + byteI, &word, 8);
+			}
+			for (; byteI < size; ++byteI)
+				out[byteI] = in[byteI] ^ previous[byteI];
+			return;
+		}
+		if (slotSize * 3 == spanSize * 4) {
+			switch (spanSize) {
+				case 6: _VUCKT_BULK_CODEC_SCATTER_SPANS(6, 8, uint16_t, in, previous, n, out) return;
+				case 12: _VUCKT_BULK_CODEC_SCATTER_SPANS(12, 16, uint32_t, in, previous, n, out) return;
+				case 24: _VUCKT_BULK_CODEC_SCATTER_SPANS(24, 32, uint64_t, in, previous, n, out) return;
+			}
+		}
+	#endif
+	for (size_t spanI = 0; spanI < n; ++spanI) {
+		for (size_t byteI = 0; byteI < spanSize; ++byteI) {
+			uint8_t byte = in[spanI * spanSize + _BulkCodecCanonicalByteIndex(byteI, wordSize)];
+			if (previous != NULL)
+				byte ^= previous[spanI * slotSize + byteI];
+			out[spanI * slotSize + byteI] = byte;
+		}
+		memset(out + spanI * slotSize + spanSize, 0, slotSize - spanSize);
+	}
+}
+
+/// A mask of which of `group`'s 8 bytes are nonzero (bit `b` for byte `b`).
+NS_INLINE unsigned _BulkCodecNonzeroByteMask(const uint8_t *group) {
+	#if !VUCKT_BULK_CODEC_IS_BIG_ENDIAN
+		// Fold each byte's bits down into its low bit, then gather the 8 low bits into the top byte.
+		uint64_t word;
+		memcpy(&word, group, 8);
+		word |= word >> 4;
+		word |= word >> 2;
+		word |= word >> 1;
+		return (unsigned)(((word & 0x0101010101010101ull) * 0x0102040810204080ull) >> 56);
+	#else
+		unsigned mask = 0;
+		for (unsigned byteI = 0; byteI < 8; ++byteI)
+			mask |= (unsigned)(group[byteI] != 0) << byteI;
+		return mask;
+	#endif
+}
+
+/// Writes the compacted form of `groupCount` 8-byte groups of `bytes` to `out`, returning the end of what it wrote.
+/// `zeroRunCount` is the count byte of the zero run the last group written ended in (if it did), which this extends, & updates; it starts `NULL`.
+/// Writes up to 8 bytes past the returned end (but within 9 bytes per group of `out`).
+NS_INLINE uint8_t *_BulkCodecCompactGroups(const uint8_t *bytes, size_t groupCount, uint8_t *out, uint8_t **zeroRunCount) {
+	for (size_t groupI = 0; groupI < groupCount; ++groupI) {
+		const uint8_t *group = bytes + groupI * 8;
+		unsigned mask = _BulkCodecNonzeroByteMask(group);
+		if (mask == 0) {
+			if (*zeroRunCount != NULL && **zeroRunCount < 255) {
+				++**zeroRunCount;
+			} else {
+				out[0] = 0;
+				out[1] = 0;
+				*zeroRunCount = out + 1;
+				out += 2;
+			}
+			continue;
+		}
+		*zeroRunCount = NULL;
+		*out++ = (uint8_t)mask;
+		#if defined(__BMI2__) && !VUCKT_BULK_CODEC_IS_BIG_ENDIAN
+			// Gather the nonzero bytes to the bottom of a word & store it whole.
+			uint64_t word, packedWord;
+			memcpy(&word, group, 8);
+			packedWord = _pext_u64(word, _pdep_u64(mask, 0x0101010101010101ull) * 0xFF);
+			memcpy(out, &packedWord, 8);
+			out += __builtin_popcount(mask);
+		#else
+			for (unsigned byteI = 0; byteI < 8; ++byteI) {
+				*out = group[byteI];
+				out += (mask >> byteI) & 1;
+			}
+		#endif
+	}
+	return out;
+}
+
+/// Reads the compacted form of `groupCount` 8-byte groups from `in` (ending before `inEnd`) into `out`, returning the end of what it read, or `NULL` if it's malformed.
+/// `pendingZeroGroups` is the count of groups left in the zero run the last group read was in, which this continues, & updates; it starts 0.
+NS_INLINE const uint8_t *VUCKT_NULLABLE _BulkCodecExpandGroups(const uint8_t *in, const uint8_t *inEnd, size_t groupCount, uint8_t *out, size_t *pendingZeroGroups) {
+	for (size_t groupI = 0; groupI < groupCount; ++groupI) {
+		uint8_t *group = out + groupI * 8;
+		if (*pendingZeroGroups > 0) {
+			--*pendingZeroGroups;
+			memset(group, 0, 8);
+			continue;
+		}
+		if (inEnd - in < 1)
+			return NULL;
+		unsigned mask = *in++;
+		if (mask == 0) {
+			if (inEnd - in < 1)
+				return NULL;
+			*pendingZeroGroups = *in++;
+			memset(group, 0, 8);
+			continue;
+		}
+		ptrdiff_t byteCount = __builtin_popcount(mask);
+		if (inEnd - in < byteCount)
+			return NULL;
+		if (inEnd - in >= 8) {
+			// Branchless, reading up to 8 bytes past the group's.
+			#if defined(__BMI2__) && !VUCKT_BULK_CODEC_IS_BIG_ENDIAN
+				uint64_t packedWord, word;
+				memcpy(&packedWord, in, 8);
+				word = _pdep_u64(packedWord, _pdep_u64(mask, 0x0101010101010101ull) * 0xFF);
+				memcpy(group, &word, 8);
+				in += byteCount;
+			#else
+				for (unsigned byteI = 0; byteI < 8; ++byteI) {
+					unsigned isNonzero = (mask >> byteI) & 1;
+					group[byteI] = *in & (uint8_t)-isNonzero;
+					in += isNonzero;
+				}
+			#endif
+		} else {
+			for (unsigned byteI = 0; byteI < 8; ++byteI)
+				group[byteI] = ((mask >> byteI) & 1) ? *in++ : 0;
+		}
+	}
+	return in;
+}
+
+
+
+#pragma mark Canonical Encoding
+
+/// Writes the canonical encoding of `n` elements of `layout` (or, with `previous`, of their XOR with `previous`'s `n`) to `out` (`BulkCodecEncodedSize()` bytes), returning its size.
+NS_INLINE size_t BulkCodecEncode(BulkCodecLayout layout, const void *elements, const void *VUCKT_NULLABLE previous, size_t n, void *out) {
+	size_t spanSize = (size_t)layout.wordSize * layout.spanWordCount, slotSize = (size_t)layout.wordSize * layout.slotWordCount;
+	_BulkCodecGatherSpans((const uint8_t *)elements, (const uint8_t *)previous, n * layout.spanCount, spanSize, slotSize, layout.wordSize, (uint8_t *)out);
+	return BulkCodecEncodedSize(layout, n);
+}
+
+/// Reads `n` elements of `layout` from their canonical encoding in `bytes` (`BulkCodecEncodedSize()` bytes; or, with `previous`, their XOR with `previous`'s `n`) into `outElements`, zeroing any padding, & returns the bytes read.
+/// `previous` may be `outElements`, to apply a delta in place.
+NS_INLINE size_t BulkCodecDecode(BulkCodecLayout layout, const void *bytes, const void *VUCKT_NULLABLE previous, size_t n, void *outElements) {
+	size_t spanSize = (size_t)layout.wordSize * layout.spanWordCount, slotSize = (size_t)layout.wordSize * layout.slotWordCount;
+	_BulkCodecScatterSpans((const uint8_t *)bytes, (const uint8_t *)previous, n * layout.spanCount, spanSize, slotSize, layout.wordSize, (uint8_t *)outElements);
+	return BulkCodecEncodedSize(layout, n);
+}
+
+
+
+#pragma mark Compacted Encoding
+
+/// Writes the compacted encoding of `n` elements of `layout` (or, with `previous`, of their XOR with `previous`'s `n`) to `out`, which must have room for `BulkCodecCompactedSizeLimit()` bytes, & returns its size.
+NS_INLINE size_t BulkCodecEncodeCompacted(BulkCodecLayout layout, const void *elements, const void *VUCKT_NULLABLE previous, size_t n, void *out) {
+	const size_t elementStride = BulkCodecElementStride(layout);
+	const size_t blockElementCount = VUCKT_BULK_CODEC_BLOCK_SIZE / BulkCodecEncodedElementSize(layout) / 8 * 8;
+	uint8_t block[VUCKT_BULK_CODEC_BLOCK_SIZE];
+	uint8_t *outBytes = (uint8_t *)out, *zeroRunCount = NULL;
+	for (size_t first = 0; first < n; first += blockElementCount) {
+		size_t count = (n - first < blockElementCount) ? n - first : blockElementCount;
+		size_t size = BulkCodecEncode(layout, (const uint8_t *)elements + first * elementStride, (previous != NULL) ? (const uint8_t *)previous + first * elementStride : NULL, count, block);
+		size_t groupCount = (size + 7) / 8;
+		memset(block + size, 0, groupCount * 8 - size);
+		outBytes = _BulkCodecCompactGroups(block, groupCount, outBytes, &zeroRunCount);
+	}
+	return (size_t)(outBytes - (uint8_t *)out);
+}
+
+/// Reads `n` elements of `layout` from their compacted encoding at the start of the `byteCount` `bytes` (or, with `previous`, their XOR with `previous`'s `n`) into `outElements`, zeroing any padding, & sets `outReadByteCount` to the bytes read.
+/// Returns false if `bytes` don't start with a valid encoding of `n` elements (including if they're cut short), leaving `outElements` partly written.
+/// `previous` may be `outElements`, to apply a delta in place.
+NS_INLINE bool BulkCodecDecodeCompacted(BulkCodecLayout layout, const void *bytes, size_t byteCount, const void *VUCKT_NULLABLE previous, size_t n, void *outElements, size_t *VUCKT_NULLABLE outReadByteCount) {
+	const size_t elementStride = BulkCodecElementStride(layout);
+	const size_t blockElementCount = VUCKT_BULK_CODEC_BLOCK_SIZE / BulkCodecEncodedElementSize(layout) / 8 * 8;
+	uint8_t block[VUCKT_BULK_CODEC_BLOCK_SIZE];
+	const uint8_t *in = (const uint8_t *)bytes, *inEnd = in + byteCount;
+	size_t pendingZeroGroups = 0;
+	for (size_t first = 0; first < n; first += blockElementCount) {
+		size_t count = (n - first < blockElementCount) ? n - first : blockElementCount;
+		size_t size = BulkCodecEncodedSize(layout, count);
+		size_t groupCount = (size + 7) / 8;
+		const uint8_t *blockEnd = _BulkCodecExpandGroups(in, inEnd, groupCount, block, &pendingZeroGroups);
+		if (blockEnd == NULL)
+			return false;
+		in = blockEnd;
+		for (size_t byteI = size; byteI < groupCount * 8; ++byteI) {
+			if (block[byteI] != 0)
+				return false;
+		}
+		BulkCodecDecode(layout, block, (previous != NULL) ? (const uint8_t *)previous + first * elementStride : NULL, count, (uint8_t *)outElements + first * elementStride);
+	}
+	if (pendingZeroGroups != 0)
+		return false;
+	if (outReadByteCount != NULL)
+		*outReadByteCount = (size_t)(in - (const uint8_t *)bytes);
+	return true;
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
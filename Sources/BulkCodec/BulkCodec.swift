@@ -0,0 +1,137 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+/// A Vuckt type arrays of which can be bulk-encoded (see `BulkCodec.h`): components of a fixed size, in spans of a fixed count.
+public protocol BulkCodable
+{
+	/// How the type's components lie in memory (which differs between the C & pure-Swift backends for the padded types, though their encodings don't).
+	static var bulkCodecLayout:BulkCodecLayout { get }
+}
+
+extension BulkCodable
+{
+	/// The most bytes `count` elements' encoding can take: exactly that, for the canonical encoding, & the room `bulkEncode(…, isCompacted: true, …)` needs, for the compacted.
+	@_alwaysEmitIntoClient public static func bulkEncodedByteCountLimit(count:Int, isCompacted:Bool = false) -> Int {
+		return isCompacted ? BulkCodecCompactedSizeLimit(self.bulkCodecLayout, count) : BulkCodecEncodedSize(self.bulkCodecLayout, count)
+	}
+}
+
+extension Float2 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 2, 1, MemoryLayout<Self>.stride) } }
+extension Float3 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 3, 1, MemoryLayout<Self>.stride) } }
+extension Float4 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 4, 1, MemoryLayout<Self>.stride) } }
+extension FloatQuaternion : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 4, 1, MemoryLayout<Self>.stride) } }
+extension Float3x3 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 3, 3, MemoryLayout<Self>.stride) } }
+extension Float4x4 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 4, 4, MemoryLayout<Self>.stride) } }
+extension Float4x3 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 4, 3, MemoryLayout<Self>.stride) } }
+extension PackedFloat3 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 3, 1, MemoryLayout<Self>.stride) } }
+extension Int2 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 2, 1, MemoryLayout<Self>.stride) } }
+extension Int3 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 3, 1, MemoryLayout<Self>.stride) } }
+extension Int4 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 4, 1, MemoryLayout<Self>.stride) } }
+extension Char4 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(1, 4, 1, MemoryLayout<Self>.stride) } }
+extension UChar4 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(1, 4, 1, MemoryLayout<Self>.stride) } }
+extension Short2 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(2, 2, 1, MemoryLayout<Self>.stride) } }
+extension Short3 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(2, 3, 1, MemoryLayout<Self>.stride) } }
+extension Short4 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(2, 4, 1, MemoryLayout<Self>.stride) } }
+extension UShort4 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(2, 4, 1, MemoryLayout<Self>.stride) } }
+extension Half2 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(2, 2, 1, MemoryLayout<Self>.stride) } }
+extension Half3 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(2, 3, 1, MemoryLayout<Self>.stride) } }
+extension Half4 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(2, 4, 1, MemoryLayout<Self>.stride) } }
+extension Double2 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(8, 2, 1, MemoryLayout<Self>.stride) } }
+extension Double3 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(8, 3, 1, MemoryLayout<Self>.stride) } }
+extension Double4 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(8, 4, 1, MemoryLayout<Self>.stride) } }
+extension Double4x4 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(8, 4, 4, MemoryLayout<Self>.stride) } }
+extension AABB3 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 3, 2, MemoryLayout<Self>.stride) } }
+extension Ray3 : BulkCodable { @_transparent public static var bulkCodecLayout:BulkCodecLayout { return BulkCodecLayoutMake(4, 3, 2, MemoryLayout<Self>.stride) } }
+
+
+
+/// Why bytes couldn't be bulk-decoded.
+public enum BulkCodecError : Error
+{
+	/// Fewer bytes than the elements' encoding takes, or (for a compacted encoding) bytes that aren't one.
+	case malformedData
+}
+
+
+
+extension UnsafeBufferPointer where Element : BulkCodable // Bulk Encoding
+{
+	/// Writes the elements' encoding (or, with `previous`, the delta from it— which must have the same count) to the start of `out`, returning its size.
+	/// `out` must have room for `Element.bulkEncodedByteCountLimit(count: self.count, isCompacted: isCompacted)` bytes.
+	@_alwaysEmitIntoClient public func bulkEncode(deltaFrom previous:UnsafeBufferPointer<Element>? = nil, isCompacted:Bool = false, into out:UnsafeMutableRawBufferPointer) -> Int {
+		precondition(previous == nil || previous!.count == self.count, "Delta snapshot must have the same count.")
+		precondition(out.count >= Element.bulkEncodedByteCountLimit(count: self.count, isCompacted: isCompacted), "Encoding buffer is too small.")
+		guard self.count > 0 else { return 0 }
+		let previousBase = previous.map{ UnsafeRawPointer($0.baseAddress!) }
+		return isCompacted
+			? BulkCodecEncodeCompacted(Element.bulkCodecLayout, self.baseAddress!, previousBase, self.count, out.baseAddress!)
+			: BulkCodecEncode(Element.bulkCodecLayout, self.baseAddress!, previousBase, self.count, out.baseAddress!)
+	}
+}
+
+extension UnsafeMutableBufferPointer where Element : BulkCodable // Bulk Decoding
+{
+	/// Overwrites the elements with those encoded at the start of `bytes` (or, with `previous`, with `previous` plus the delta encoded there— `previous` must have the same count, & may be these elements themselves), returning the bytes read.
+	/// Throws `BulkCodecError.malformedData` (leaving the elements partly overwritten) if `bytes` don't start with an encoding of this many elements.
+	@_alwaysEmitIntoClient public func bulkDecode(from bytes:UnsafeRawBufferPointer, deltaFrom previous:UnsafeBufferPointer<Element>? = nil, isCompacted:Bool = false) throws -> Int {
+		precondition(previous == nil || previous!.count == self.count, "Delta snapshot must have the same count.")
+		guard self.count > 0 else { return 0 }
+		guard let bytesBase = bytes.baseAddress else { throw BulkCodecError.malformedData }
+		let previousBase = previous.map{ UnsafeRawPointer($0.baseAddress!) }
+		if isCompacted {
+			var readByteCount = 0
+			guard BulkCodecDecodeCompacted(Element.bulkCodecLayout, bytesBase, bytes.count, previousBase, self.count, self.baseAddress!, &readByteCount) else {
+				throw BulkCodecError.malformedData
+			}
+			return readByteCount
+		} else {
+			guard bytes.count >= BulkCodecEncodedSize(Element.bulkCodecLayout, self.count) else { throw BulkCodecError.malformedData }
+			return BulkCodecDecode(Element.bulkCodecLayout, bytesBase, previousBase, self.count, self.baseAddress!)
+		}
+	}
+}
+
+extension Array where Element : BulkCodable // Bulk Coding
+{
+	/// Writes the elements' encoding (or, with `previous`, the delta from it) to the start of `out`, returning its size— see `UnsafeBufferPointer.bulkEncode(deltaFrom:isCompacted:into:)`.
+	@_alwaysEmitIntoClient public func bulkEncode(deltaFrom previous:[Element]? = nil, isCompacted:Bool = false, into out:UnsafeMutableRawBufferPointer) -> Int {
+		return self.withUnsafeBufferPointer{ selfBuffer -> Int in
+			guard let previous = previous else {
+				return selfBuffer.bulkEncode(isCompacted: isCompacted, into: out)
+			}
+			return previous.withUnsafeBufferPointer{ selfBuffer.bulkEncode(deltaFrom: $0, isCompacted: isCompacted, into: out) }
+		}
+	}
+	
+	/// Initialize with `count` elements decoded from the start of `bytes` (or, with `previous`, `previous` plus the delta encoded there)— see `UnsafeMutableBufferPointer.bulkDecode(from:deltaFrom:isCompacted:)`.
+	@_alwaysEmitIntoClient public init(bulkDecoding bytes:UnsafeRawBufferPointer, count:Int, deltaFrom previous:[Element]? = nil, isCompacted:Bool = false) throws {
+		self = try [Element](unsafeUninitializedCapacity: count){ outBuffer, initializedCount in
+			let out = UnsafeMutableBufferPointer(rebasing: outBuffer[0..<count])
+			if let previous = previous {
+				_ = try previous.withUnsafeBufferPointer{ try out.bulkDecode(from: bytes, deltaFrom: $0, isCompacted: isCompacted) }
+			} else {
+				_ = try out.bulkDecode(from: bytes, isCompacted: isCompacted)
+			}
+			initializedCount = count
+		}
+	}
+	
+	/// Applies the delta encoded at the start of `bytes` to the elements in place, returning the bytes read.
+	/// Throws `BulkCodecError.malformedData` (leaving the elements partly updated) if `bytes` don't start with a delta of this many elements.
+	@_alwaysEmitIntoClient public mutating func bulkApplyDelta(from bytes:UnsafeRawBufferPointer, isCompacted:Bool = false) throws -> Int {
+		return try self.withUnsafeMutableBufferPointer{ try $0.bulkDecode(from: bytes, deltaFrom: UnsafeBufferPointer($0), isCompacted: isCompacted) }
+	}
+}
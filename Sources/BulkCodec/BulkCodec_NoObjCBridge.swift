@@ -0,0 +1,206 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+
+
+// MARK: Struct Definition
+
+public let VUCKT_BULK_CODEC_BLOCK_SIZE:Int32 = 4096
+
+public struct BulkCodecLayout
+{
+	public var wordSize:UInt32
+	public var spanWordCount:UInt32
+	public var slotWordCount:UInt32
+	public var spanCount:UInt32
+	
+	public init() {
+		self.wordSize = UInt32()
+		self.spanWordCount = UInt32()
+		self.slotWordCount = UInt32()
+		self.spanCount = UInt32()
+	}
+	
+	public init(wordSize:UInt32, spanWordCount:UInt32, slotWordCount:UInt32, spanCount:UInt32) {
+		self.wordSize = wordSize
+		self.spanWordCount = spanWordCount
+		self.slotWordCount = slotWordCount
+		self.spanCount = spanCount
+	}
+}
+
+
+
+// MARK: Layout Construction & Sizes
+
+@_transparent public func BulkCodecLayoutMake(_ wordSize:UInt32, _ spanWordCount:UInt32, _ spanCount:UInt32, _ elementStride:Int) -> BulkCodecLayout {
+	return BulkCodecLayout(wordSize: wordSize, spanWordCount: spanWordCount, slotWordCount: UInt32(elementStride / Int(spanCount) / Int(wordSize)), spanCount: spanCount)
+}
+
+@_transparent public func BulkCodecEncodedElementSize(_ layout:BulkCodecLayout) -> Int {
+	return Int(layout.wordSize) * Int(layout.spanWordCount) * Int(layout.spanCount)
+}
+@_transparent public func BulkCodecElementStride(_ layout:BulkCodecLayout) -> Int {
+	return Int(layout.wordSize) * Int(layout.slotWordCount) * Int(layout.spanCount)
+}
+
+@_transparent public func BulkCodecEncodedSize(_ layout:BulkCodecLayout, _ n:Int) -> Int {
+	return n * BulkCodecEncodedElementSize(layout)
+}
+@_transparent public func BulkCodecCompactedSizeLimit(_ layout:BulkCodecLayout, _ n:Int) -> Int {
+	return (BulkCodecEncodedSize(layout, n) + 7) / 8 * 9
+}
+
+
+
+// MARK: Internal Helpers
+
+@usableFromInline internal func _vucktBulkCodecCanonicalByteIndex(_ byteI:Int, _ wordSize:Int) -> Int {
+	return (1.littleEndian == 1) ? byteI : byteI - byteI % wordSize + (wordSize - 1 - byteI % wordSize)
+}
+
+@usableFromInline internal func _vucktBulkCodecGatherSpans(_ src:UnsafeRawPointer, _ previous:UnsafeRawPointer?, _ n:Int, _ spanSize:Int, _ slotSize:Int, _ wordSize:Int, _ out:UnsafeMutableRawPointer) {
+	for spanI in 0..<n {
+		for byteI in 0..<spanSize {
+			var byte = src.load(fromByteOffset: spanI * slotSize + byteI, as: UInt8.self)
+			if let previous = previous {
+				byte ^= previous.load(fromByteOffset: spanI * slotSize + byteI, as: UInt8.self)
+			}
+			out.storeBytes(of: byte, toByteOffset: spanI * spanSize + _vucktBulkCodecCanonicalByteIndex(byteI, wordSize), as: UInt8.self)
+		}
+	}
+}
+
+@usableFromInline internal func _vucktBulkCodecScatterSpans(_ input:UnsafeRawPointer, _ previous:UnsafeRawPointer?, _ n:Int, _ spanSize:Int, _ slotSize:Int, _ wordSize:Int, _ out:UnsafeMutableRawPointer) {
+	for spanI in 0..<n {
+		for byteI in 0..<spanSize {
+			var byte = input.load(fromByteOffset: spanI * spanSize + _vucktBulkCodecCanonicalByteIndex(byteI, wordSize), as: UInt8.self)
+			if let previous = previous {
+				byte ^= previous.load(fromByteOffset: spanI * slotSize + byteI, as: UInt8.self)
+			}
+			out.storeBytes(of: byte, toByteOffset: spanI * slotSize + byteI, as: UInt8.self)
+		}
+		(out + spanI * slotSize + spanSize).initializeMemory(as: UInt8.self, repeating: 0, count: slotSize - spanSize)
+	}
+}
+
+@usableFromInline internal func _vucktBulkCodecCompactGroups(_ bytes:UnsafePointer<UInt8>, _ groupCount:Int, _ out:UnsafeMutablePointer<UInt8>, _ zeroRunCount:inout UnsafeMutablePointer<UInt8>?) -> UnsafeMutablePointer<UInt8> {
+	var out = out
+	for groupI in 0..<groupCount {
+		let group = bytes + groupI * 8
+		var mask:UInt8 = 0
+		for byteI in 0..<8 where group[byteI] != 0 {
+			mask |= 1 << UInt8(byteI)
+		}
+		if mask == 0 {
+			if let count = zeroRunCount, count.pointee < 255 {
+				count.pointee += 1
+			} else {
+				out[0] = 0
+				out[1] = 0
+				zeroRunCount = out + 1
+				out += 2
+			}
+			continue
+		}
+		zeroRunCount = nil
+		out.pointee = mask
+		out += 1
+		for byteI in 0..<8 where (mask >> UInt8(byteI)) & 1 != 0 {
+			out.pointee = group[byteI]
+			out += 1
+		}
+	}
+	return out
+}
+
+@usableFromInline internal func _vucktBulkCodecExpandGroups(_ input:UnsafePointer<UInt8>, _ inputEnd:UnsafePointer<UInt8>, _ groupCount:Int, _ out:UnsafeMutablePointer<UInt8>, _ pendingZeroGroups:inout Int) -> UnsafePointer<UInt8>? {
+	var input = input
+	for groupI in 0..<groupCount {
+		let group = out + groupI * 8
+		if pendingZeroGroups > 0 {
+			pendingZeroGroups -= 1
+			group.initialize(repeating: 0, count: 8)
+			continue
+		}
+		guard inputEnd - input >= 1 else { return nil }
+		let mask = input.pointee
+		input += 1
+		if mask == 0 {
+			guard inputEnd - input >= 1 else { return nil }
+			pendingZeroGroups = Int(input.pointee)
+			input += 1
+			group.initialize(repeating: 0, count: 8)
+			continue
+		}
+		guard inputEnd - input >= mask.nonzeroBitCount else { return nil }
+		for byteI in 0..<8 {
+			if (mask >> UInt8(byteI)) & 1 != 0 {
+				group[byteI] = input.pointee
+				input += 1
+			} else {
+				group[byteI] = 0
+			}
+		}
+	}
+	return input
+}
+
+
+
+// MARK: Canonical Encoding
+
+@_alwaysEmitIntoClient public func BulkCodecEncode(_ layout:BulkCodecLayout, _ elements:UnsafeRawPointer, _ previous:UnsafeRawPointer?, _ n:Int, _ out:UnsafeMutableRawPointer) -> Int {
+	let wordSize = Int(layout.wordSize)
+	_vucktBulkCodecGatherSpans(elements, previous, n * Int(layout.spanCount), wordSize * Int(layout.spanWordCount), wordSize * Int(layout.slotWordCount), wordSize, out)
+	return BulkCodecEncodedSize(layout, n)
+}
+
+@_alwaysEmitIntoClient public func BulkCodecDecode(_ layout:BulkCodecLayout, _ bytes:UnsafeRawPointer, _ previous:UnsafeRawPointer?, _ n:Int, _ outElements:UnsafeMutableRawPointer) -> Int {
+	let wordSize = Int(layout.wordSize)
+	_vucktBulkCodecScatterSpans(bytes, previous, n * Int(layout.spanCount), wordSize * Int(layout.spanWordCount), wordSize * Int(layout.slotWordCount), wordSize, outElements)
+	return BulkCodecEncodedSize(layout, n)
+}
+
+
+
+// MARK: Compacted Encoding
+
+@_alwaysEmitIntoClient public func BulkCodecEncodeCompacted(_ layout:BulkCodecLayout, _ elements:UnsafeRawPointer, _ previous:UnsafeRawPointer?, _ n:Int, _ out:UnsafeMutableRawPointer) -> Int {
+	let elementStride = BulkCodecElementStride(layout)
+	let blockElementCount = Int(VUCKT_BULK_CODEC_BLOCK_SIZE) / BulkCodecEncodedElementSize(layout) / 8 * 8
+	let block = UnsafeMutablePointer<UInt8>.allocate(capacity: Int(VUCKT_BULK_CODEC_BLOCK_SIZE))
+	defer { block.deallocate() }
+	let outStart = out.assumingMemoryBound(to: UInt8.self)
+	var outBytes = outStart, zeroRunCount:UnsafeMutablePointer<UInt8>? = nil
+	for first in stride(from: 0, to: n, by: blockElementCount) {
+		let count = Swift.min(blockElementCount, n - first)
+		let size = BulkCodecEncode(layout, elements + first * elementStride, previous.map{ $0 + first * elementStride }, count, block)
+		let groupCount = (size + 7) / 8
+		(block + size).initialize(repeating: 0, count: groupCount * 8 - size)
+		outBytes = _vucktBulkCodecCompactGroups(block, groupCount, outBytes, &zeroRunCount)
+	}
+	return outBytes - outStart
+}
+
+@_alwaysEmitIntoClient public func BulkCodecDecodeCompacted(_ layout:BulkCodecLayout, _ bytes:UnsafeRawPointer, _ byteCount:Int, _ previous:UnsafeRawPointer?, _ n:Int, _ outElements:UnsafeMutableRawPointer, _ outReadByteCount:UnsafeMutablePointer<Int>?) -> Bool {
+	let elementStride = BulkCodecElementStride(layout)
+	let blockElementCount = Int(VUCKT_BULK_CODEC_BLOCK_SIZE) / BulkCodecEncodedElementSize(layout) / 8 * 8
+	let block = UnsafeMutablePointer<UInt8>.allocate(capacity: Int(VUCKT_BULK_CODEC_BLOCK_SIZE))
+	defer { block.deallocate() }
+	let inputStart = bytes.assumingMemoryBound(to: UInt8.self), inputEnd = inputStart + byteCount
+	var input = inputStart, pendingZeroGroups = 0
+	for first in stride(from: 0, to: n, by: blockElementCount) {
+		let count = Swift.min(blockElementCount, n - first)
+		let size = BulkCodecEncodedSize(layout, count)
+		let groupCount = (size + 7) / 8
+		guard let blockEnd = _vucktBulkCodecExpandGroups(input, inputEnd, groupCount, block, &pendingZeroGroups) else { return false }
+		input = blockEnd
+		guard (size..<(groupCount * 8)).allSatisfy({ block[$0] == 0 }) else { return false }
+		_ = BulkCodecDecode(layout, block, previous.map{ $0 + first * elementStride }, count, outElements + first * elementStride)
+	}
+	guard pendingZeroGroups == 0 else { return false }
+	outReadByteCount?.pointee = input - inputStart
+	return true
+}
@@ -0,0 +1,158 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Int4.h>)
+	#import <Vuckt/Int4.h>
+#else
+	#include "../Int4/Int4.h"
+#endif
+#if __has_include(<Vuckt/Float4.h>)
+	#import <Vuckt/Float4.h>
+#else
+	#include "../Float4/Float4.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 4-component vector of 8-bit signed integers (4 bytes, matching `simd_char4`), for compact storage— quantized normals & tangents, voxel data, & the like.
+/// Widen to `Int4` or `Float4` (e.g. with `Char4ToInt4()`, or in bulk with `Char4ArrayToInt4Array()`) to do math.
+struct Char4 {
+	signed char x, y, z, w;
+} __attribute__((aligned(__alignof__(simd_char4))));
+typedef struct Char4 Char4;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Char4` struct to `simd_char4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_char4 Char4ToSimd(Char4 structValue) {
+	return *(simd_char4 *)&structValue;
+}
+/// Converts a `Char4` struct from `simd_char4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Char4 Char4FromSimd(simd_char4 simdValue) {
+	return *(Char4 *)&simdValue;
+}
+
+
+
+#pragma mark Int4 Conversion
+
+/// Widens each element to `int` (exactly).
+NS_INLINE Int4 Char4ToInt4(Char4 value) {
+	return Int4FromSimd(__builtin_convertvector(Char4ToSimd(value), simd_int4));
+}
+/// Narrows each element to its low 8 bits, wrapping out-of-range values around (as a `(signed char)` cast does).
+NS_INLINE Char4 Char4FromInt4Truncating(Int4 value) {
+	return Char4FromSimd(__builtin_convertvector(Int4ToSimd(value), simd_char4));
+}
+/// Narrows each element, clamping it to [ -128, 127 ].
+NS_INLINE Char4 Char4FromInt4Saturating(Int4 value) {
+	return Char4FromSimd(__builtin_convertvector(vuckt_simd_clamp4(Int4ToSimd(value), -128, 127), simd_char4));
+}
+
+
+
+#pragma mark Float4 Conversion
+
+/// Converts each element to `float` (exactly).
+NS_INLINE Float4 Char4ToFloat4(Char4 value) {
+	return Float4FromSimd(__builtin_convertvector(Char4ToSimd(value), simd_float4));
+}
+/// Converts each element, clamping it to [ -128, 127 ] (NaN becoming 0) & truncating toward zero.
+NS_INLINE Char4 Char4FromFloat4Saturating(Float4 value) {
+	return Char4FromSimd(__builtin_convertvector(vuckt_simd_float_to_int_clamped4(Float4ToSimd(value), -128.0f, 127.0f), simd_char4));
+}
+/// Decodes each element as SNORM, mapping [ -127, 127 ] onto [ -1, 1 ] (with -128 also mapping to -1).
+NS_INLINE Float4 Char4ToFloat4Normalized(Char4 value) {
+	return Float4FromSimd(vuckt_simd_snorm_to_float4(__builtin_convertvector(Char4ToSimd(value), simd_int4), 127.0f));
+}
+/// Encodes each element as SNORM: clamps it to [ -1, 1 ] (NaN becoming 0) & maps that onto [ -127, 127 ], rounding to nearest.
+NS_INLINE Char4 Char4FromFloat4Normalized(Float4 value) {
+	return Char4FromSimd(__builtin_convertvector(vuckt_simd_snorm_from_float4(Float4ToSimd(value), 127.0f), simd_char4));
+}
+
+
+
+#pragma mark Bulk Conversion
+
+// Element-wise conversions over `n`-element arrays.  `out` must not overlap the input array.
+// The widening & truncating conversions loop over the flat lanes, so the compiler can vectorize them across elements at the target's full vector width; the clamping & normalizing ones go element-by-element through the branch-free vector kernels above.
+
+/// `out[i] = Char4ToInt4(values[i])`
+NS_INLINE void Char4ArrayToInt4Array(const Char4 *values, Int4 *out, size_t n) {
+	const signed char *valueLanes = (const signed char *)values;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Char4) / sizeof(signed char)); ++laneI) {
+		outLanes[laneI] = valueLanes[laneI];
+	}
+}
+/// `out[i] = Char4FromInt4Truncating(values[i])`
+NS_INLINE void Char4ArrayFromInt4ArrayTruncating(const Int4 *values, Char4 *out, size_t n) {
+	const int *valueLanes = (const int *)values;
+	signed char *outLanes = (signed char *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int4) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (signed char)valueLanes[laneI];
+	}
+}
+/// `out[i] = Char4FromInt4Saturating(values[i])`
+NS_INLINE void Char4ArrayFromInt4ArraySaturating(const Int4 *values, Char4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Char4FromInt4Saturating(values[i]);
+	}
+}
+/// `out[i] = Char4ToFloat4(values[i])`
+NS_INLINE void Char4ArrayToFloat4Array(const Char4 *values, Float4 *out, size_t n) {
+	const signed char *valueLanes = (const signed char *)values;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Char4) / sizeof(signed char)); ++laneI) {
+		outLanes[laneI] = (float)valueLanes[laneI];
+	}
+}
+/// `out[i] = Char4FromFloat4Saturating(values[i])`
+NS_INLINE void Char4ArrayFromFloat4ArraySaturating(const Float4 *values, Char4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Char4FromFloat4Saturating(values[i]);
+	}
+}
+/// `out[i] = Char4ToFloat4Normalized(values[i])`
+NS_INLINE void Char4ArrayToFloat4ArrayNormalized(const Char4 *values, Float4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Char4ToFloat4Normalized(values[i]);
+	}
+}
+/// `out[i] = Char4FromFloat4Normalized(values[i])`
+NS_INLINE void Char4ArrayFromFloat4ArrayNormalized(const Float4 *values, Char4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Char4FromFloat4Normalized(values[i]);
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
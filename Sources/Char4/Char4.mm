@@ -0,0 +1,18 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Char4.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Char4, x) == sizeof(simd_char1),
+	"Char4's first member's size does not match simd_char1's on this platform.");
+static_assert(sizeof(Char4) == sizeof(simd_char4),
+	"Char4's size does not match simd_char4's on this platform.");
+static_assert(sizeof_member(Char4, x) == sizeof_member(simd_char4, x),
+	"Char4's first member's size does not match simd_char4's first member's on this platform.");
+static_assert(alignof(Char4) == alignof(simd_char4),
+	"Char4's alignment requirements does not match simd_char4's on this platform.");
@@ -0,0 +1,214 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension Char4
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements.
+	@_transparent public init(_ x:Int8, _ y:Int8, _ z:Int8, _ w:Int8) {
+		self.init(x: x, y: y, z: z, w: w)
+	}
+	
+	/// Initialize to a vector with all elements equal to `scalar`.
+	@_transparent public init(scalar:Int8) {
+		self.init(scalar, scalar, scalar, scalar)
+	}
+	
+	/// Initialize to a SIMD vector.
+	@_transparent public init(_ value:SIMD4<Int8>) {
+		self = Char4FromSimd(value)
+	}
+	
+	/// Initialize from an `Int4` value, keeping each element's low 8 bits (wrapping out-of-range values around).
+	@_transparent public init(truncatingIfNeeded int4Value:Int4) {
+		self = Char4FromInt4Truncating(int4Value)
+	}
+	/// Initialize from an `Int4` value, clamping to the representable range of the element type.
+	@_transparent public init(clamping int4Value:Int4) {
+		self = Char4FromInt4Saturating(int4Value)
+	}
+	/// Initialize from a `Float4` value, clamping to the representable range of the element type (NaN becoming 0) & truncating toward zero.
+	@_transparent public init(saturating float4Value:Float4) {
+		self = Char4FromFloat4Saturating(float4Value)
+	}
+	/// Initialize from a `Float4` value by SNORM encoding, clamping each element to [ -1, 1 ] & mapping it onto [ -127, 127 ], rounding to nearest.
+	@_transparent public init(normalized float4Value:Float4) {
+		self = Char4FromFloat4Normalized(float4Value)
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Char4 { return Char4(scalar: 0) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	@_transparent public var asTuple:(x:Int8,y:Int8,z:Int8,w:Int8) {
+		return ( self.x, self.y, self.z, self.w )
+	}
+	
+	@_transparent public var asArray:[Int8] {
+		return [ self.x, self.y, self.z, self.w ]
+	}
+	
+	/// Each element widened to `Int32`.
+	@_transparent public var int4Value:Int4 {
+		return Char4ToInt4(self)
+	}
+	
+	/// Each element converted to `Float`.
+	@_transparent public var float4Value:Float4 {
+		return Char4ToFloat4(self)
+	}
+	
+	/// Each element decoded as SNORM, mapping [ -127, 127 ] onto [ -1, 1 ] (with -128 also mapping to -1).
+	@_transparent public var normalizedFloat4Value:Float4 {
+		return Char4ToFloat4Normalized(self)
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	@_transparent public var simdValue:SIMD4<Int8> {
+		return Char4ToSimd(self)
+	}
+}
+
+
+extension Int4
+{
+	/// Initialize from a `Char4` value, widening each element.
+	@_transparent public init(_ char4Value:Char4) {
+		self = Char4ToInt4(char4Value)
+	}
+}
+
+extension Float4
+{
+	/// Initialize from a `Char4` value, converting each element.
+	@_transparent public init(_ char4Value:Char4) {
+		self = Char4ToFloat4(char4Value)
+	}
+	
+	/// Initialize from a `Char4` value by SNORM decoding, mapping [ -127, 127 ] onto [ -1, 1 ] (with -128 also mapping to -1).
+	@_transparent public init(normalized char4Value:Char4) {
+		self = Char4ToFloat4Normalized(char4Value)
+	}
+}
+
+
+extension Char4 : CustomStringConvertible
+{
+	public var description:String {
+		return "(\(self.x), \(self.y), \(self.z), \(self.w))"
+	}
+}
+
+
+extension Char4 : Equatable
+{
+	@_transparent public static func ==(a:Char4, b:Char4) -> Bool {
+		return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w
+	}
+}
+
+
+extension Char4 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			self.asArray.forEach{ hasher.combine($0) }
+		}
+	#else
+		public var hashValue:Int {
+			return self.asArray.enumerated().reduce(0){ (hashValue, element:(offset:Int,value:Int8)) in
+				return hashValue | ((Int(truncatingIfNeeded: element.value) & 0xFF) << (element.offset * 8))
+			}
+		}
+	#endif
+}
+
+
+extension UnsafeBufferPointer where Element == Char4 // Bulk Conversion
+{
+	/// Widens every element into `out`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkConversion(into: out, Char4ArrayToInt4Array)
+	}
+	/// Converts every element into `out`, decoding them as SNORM if `normalized`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Float4>, normalized:Bool = false) {
+		self._vucktBulkConversion(into: out, normalized ? Char4ArrayToFloat4ArrayNormalized : Char4ArrayToFloat4Array)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Int4 // Bulk Conversion
+{
+	/// Narrows every element into `out`, handling out-of-range values per `mode`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Char4>, mode:IntegerNarrowingMode = .truncating) {
+		switch mode {
+			case .truncating: self._vucktBulkConversion(into: out, Char4ArrayFromInt4ArrayTruncating)
+			case .clamping: self._vucktBulkConversion(into: out, Char4ArrayFromInt4ArraySaturating)
+		}
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float4 // Bulk Conversion
+{
+	/// Narrows every element into `out`, per `mode`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Char4>, mode:FloatNarrowingMode = .saturating) {
+		switch mode {
+			case .saturating: self._vucktBulkConversion(into: out, Char4ArrayFromFloat4ArraySaturating)
+			case .normalized: self._vucktBulkConversion(into: out, Char4ArrayFromFloat4ArrayNormalized)
+		}
+	}
+}
+
+extension Array where Element == Int4
+{
+	/// Widens an array of `Char4`s.
+	@_alwaysEmitIntoClient public init(_ char4Values:[Char4]) {
+		self = char4Values._vucktBulkConversion(Char4ArrayToInt4Array)
+	}
+}
+
+extension Array where Element == Float4
+{
+	/// Converts an array of `Char4`s, decoding them as SNORM if `normalized`.
+	@_alwaysEmitIntoClient public init(_ char4Values:[Char4], normalized:Bool = false) {
+		self = char4Values._vucktBulkConversion(normalized ? Char4ArrayToFloat4ArrayNormalized : Char4ArrayToFloat4Array)
+	}
+}
+
+extension Array where Element == Char4
+{
+	/// Narrows an array of `Int4`s, handling out-of-range values per `mode`.
+	@_alwaysEmitIntoClient public init(_ int4Values:[Int4], mode:IntegerNarrowingMode = .truncating) {
+		switch mode {
+			case .truncating: self = int4Values._vucktBulkConversion(Char4ArrayFromInt4ArrayTruncating)
+			case .clamping: self = int4Values._vucktBulkConversion(Char4ArrayFromInt4ArraySaturating)
+		}
+	}
+	
+	/// Narrows an array of `Float4`s, per `mode`.
+	@_alwaysEmitIntoClient public init(_ float4Values:[Float4], mode:FloatNarrowingMode = .saturating) {
+		switch mode {
+			case .saturating: self = float4Values._vucktBulkConversion(Char4ArrayFromFloat4ArraySaturating)
+			case .normalized: self = float4Values._vucktBulkConversion(Char4ArrayFromFloat4ArrayNormalized)
+		}
+	}
+}
@@ -0,0 +1,119 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Char4
+{
+	public var x:Int8
+	public var y:Int8
+	public var z:Int8
+	public var w:Int8
+	
+	public init() {
+		self.x = Int8()
+		self.y = Int8()
+		self.z = Int8()
+		self.w = Int8()
+	}
+	
+	public init(x:Int8, y:Int8, z:Int8, w:Int8) {
+		self.x = x
+		self.y = y
+		self.z = z
+		self.w = w
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Char4` struct to `SIMD4<Int8>` vector using passing-individual-members initialization.
+@_transparent public func Char4ToSimd(_ structValue:Char4) -> SIMD4<Int8> {
+	return SIMD4<Int8>(structValue.x, structValue.y, structValue.z, structValue.w)
+}
+/// Converts a `Char4` struct from `SIMD4<Int8>` vector using passing-individual-members initialization.
+@_transparent public func Char4FromSimd(_ simdValue:SIMD4<Int8>) -> Char4 {
+	return Char4(x: simdValue.x, y: simdValue.y, z: simdValue.z, w: simdValue.w)
+}
+
+
+
+// MARK: Int4 Conversion
+
+@_transparent public func Char4ToInt4(_ value:Char4) -> Int4 {
+	return Int4FromSimd(simd_int4(truncatingIfNeeded: Char4ToSimd(value)))
+}
+@_transparent public func Char4FromInt4Truncating(_ value:Int4) -> Char4 {
+	return Char4FromSimd(SIMD4<Int8>(truncatingIfNeeded: Int4ToSimd(value)))
+}
+@_transparent public func Char4FromInt4Saturating(_ value:Int4) -> Char4 {
+	return Char4FromSimd(SIMD4<Int8>(clamping: Int4ToSimd(value)))
+}
+
+
+
+// MARK: Float4 Conversion
+
+@_transparent public func Char4ToFloat4(_ value:Char4) -> Float4 {
+	return Float4FromSimd(simd_float4(Char4ToSimd(value)))
+}
+@_alwaysEmitIntoClient public func Char4FromFloat4Saturating(_ value:Float4) -> Char4 {
+	return Char4FromSimd(SIMD4<Int8>(truncatingIfNeeded: _vucktFloatToIntClamped(Float4ToSimd(value), -128, 127)))
+}
+@_alwaysEmitIntoClient public func Char4ToFloat4Normalized(_ value:Char4) -> Float4 {
+	return Float4FromSimd(_vucktSnormToFloat(simd_int4(truncatingIfNeeded: Char4ToSimd(value)), 127))
+}
+@_alwaysEmitIntoClient public func Char4FromFloat4Normalized(_ value:Float4) -> Char4 {
+	return Char4FromSimd(SIMD4<Int8>(truncatingIfNeeded: _vucktSnormFromFloat(Float4ToSimd(value), 127)))
+}
+
+
+
+// MARK: Bulk Conversion
+
+@_alwaysEmitIntoClient public func Char4ArrayToInt4Array(_ values:UnsafePointer<Char4>, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Char4ToInt4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Char4ArrayFromInt4ArrayTruncating(_ values:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<Char4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Char4FromInt4Truncating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Char4ArrayFromInt4ArraySaturating(_ values:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<Char4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Char4FromInt4Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Char4ArrayToFloat4Array(_ values:UnsafePointer<Char4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Char4ToFloat4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Char4ArrayFromFloat4ArraySaturating(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Char4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Char4FromFloat4Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Char4ArrayToFloat4ArrayNormalized(_ values:UnsafePointer<Char4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Char4ToFloat4Normalized(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Char4ArrayFromFloat4ArrayNormalized(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Char4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Char4FromFloat4Normalized(values[i])
+	}
+}
@@ -0,0 +1,458 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/FloatQuaternion.h>)
+	#import <Vuckt/FloatQuaternion.h>
+#else
+	#include "../FloatQuaternion/FloatQuaternion.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+// Easing & cubic-spline evaluation for animation, over arrays: many samples of one curve, or one sample each of many curves, per call.
+// Easings are Robert Penner's (<https://robertpenner.com/easing/>), each mapping a ratio in 0…1 to an eased ratio, from exactly 0 at 0 to exactly 1 at 1 (the back, elastic, & bounce ones overshooting in between).  Ratios outside 0…1 extrapolate each easing's formula.
+// Splines are runs of cubic segments, each given by 4 control points in one of the bases below.  Their values are handled as `componentCount` (1–4) `float` lanes `stride` floats apart, so the same kernels serve `float`s, `Float2`s, `Float3`s, & `Float4`s (& the pure-Swift types' tighter strides).
+// The 4-lane easing kernels are branch-free (sine & elastic through `vuckt_simd_fast_sincos4()`, exponential & elastic through `vuckt_simd_fast_exp2_4()`), so they're within 1.5e-6 (absolute, measured against the formulas in double precision over 0…1, elastic-out being the worst at 1.34e-6) rather than exact.
+
+
+
+#pragma mark Easing Constants
+
+#define VUCKT_EASING_LINEAR 0
+#define VUCKT_EASING_QUADRATIC_IN 1
+#define VUCKT_EASING_QUADRATIC_OUT 2
+#define VUCKT_EASING_QUADRATIC_IN_OUT 3
+#define VUCKT_EASING_CUBIC_IN 4
+#define VUCKT_EASING_CUBIC_OUT 5
+#define VUCKT_EASING_CUBIC_IN_OUT 6
+#define VUCKT_EASING_QUARTIC_IN 7
+#define VUCKT_EASING_QUARTIC_OUT 8
+#define VUCKT_EASING_QUARTIC_IN_OUT 9
+#define VUCKT_EASING_QUINTIC_IN 10
+#define VUCKT_EASING_QUINTIC_OUT 11
+#define VUCKT_EASING_QUINTIC_IN_OUT 12
+#define VUCKT_EASING_SINE_IN 13
+#define VUCKT_EASING_SINE_OUT 14
+#define VUCKT_EASING_SINE_IN_OUT 15
+#define VUCKT_EASING_EXPONENTIAL_IN 16
+#define VUCKT_EASING_EXPONENTIAL_OUT 17
+#define VUCKT_EASING_EXPONENTIAL_IN_OUT 18
+#define VUCKT_EASING_CIRCULAR_IN 19
+#define VUCKT_EASING_CIRCULAR_OUT 20
+#define VUCKT_EASING_CIRCULAR_IN_OUT 21
+#define VUCKT_EASING_BACK_IN 22
+#define VUCKT_EASING_BACK_OUT 23
+#define VUCKT_EASING_BACK_IN_OUT 24
+#define VUCKT_EASING_ELASTIC_IN 25
+#define VUCKT_EASING_ELASTIC_OUT 26
+#define VUCKT_EASING_ELASTIC_IN_OUT 27
+#define VUCKT_EASING_BOUNCE_IN 28
+#define VUCKT_EASING_BOUNCE_OUT 29
+#define VUCKT_EASING_BOUNCE_IN_OUT 30
+/// One past the last easing; codes outside `VUCKT_EASING_LINEAR`…`VUCKT_EASING_BOUNCE_IN_OUT` ease linearly.
+#define VUCKT_EASING_COUNT 31
+
+
+
+#pragma mark Spline Basis Constants
+
+/// Control points `p0, m0, p1, m1`: the segment runs from `p0` to `p1`, leaving with tangent `m0` & arriving with tangent `m1` (both per unit of ratio).
+/// A track's keyframes alternate values & tangents (`p0, m0, p1, m1, p2, m2, …`), segment `s` running from `p[s]` to `p[s + 1]`.
+#define VUCKT_CURVE_BASIS_HERMITE 0
+/// Control points `p-1, p0, p1, p2`: the segment runs from `p0` to `p1`, with the tangents `(p1 - p-1) / 2` & `(p2 - p0) / 2`, so consecutive segments of a track join smoothly.
+/// A track's keyframes are just its values (`p0, p1, p2, …`), segment `s` running from `p[s]` to `p[s + 1]`; the first & last keyframes stand in for their missing neighbors.
+#define VUCKT_CURVE_BASIS_CATMULL_ROM 1
+/// Control points `p0, c0, c1, p1`: the segment runs from `p0` to `p1`, leaving toward `c0` & arriving from `c1`.
+/// A track's keyframes are its values with each segment's 2 inner control points between them (`p0, c0, c1, p1, c2, c3, p2, …`).
+#define VUCKT_CURVE_BASIS_BEZIER 2
+
+
+
+#pragma mark Internal Helpers
+
+NS_INLINE simd_float4 _CurveLanesLoad(const float *values, size_t count) {
+	simd_float4 lanes = { 0, 0, 0, 0 };
+	memcpy(&lanes, values, count * sizeof(float));
+	return lanes;
+}
+NS_INLINE void _CurveLanesStore(simd_float4 lanes, float *values, size_t count) {
+	memcpy(values, &lanes, count * sizeof(float));
+}
+
+NS_INLINE simd_float4 _CurveBounceOutLanes(simd_float4 t) {
+	const float n1 = 7.5625f, d1 = 2.75f;
+	simd_float4 x1 = t, x2 = t - 1.5f / d1, x3 = t - 2.25f / d1, x4 = t - 2.625f / d1;
+	simd_float4 eased = n1 * x4 * x4 + 0.984375f;
+	eased = vuckt_simd_select4((t < 2.5f / d1), n1 * x3 * x3 + 0.9375f, eased);
+	eased = vuckt_simd_select4((t < 2.0f / d1), n1 * x2 * x2 + 0.75f, eased);
+	return vuckt_simd_select4((t < 1.0f / d1), n1 * x1 * x1, eased);
+}
+
+/// The “in” easing of family `family` (`(easing - 1) / 3`, 0 being quadratic & 9 bounce), or for the back & elastic families, with `isInOut`, the variant Penner's in-out easings are made of (overshooting further, & oscillating more slowly, respectively).
+NS_INLINE simd_float4 _CurveEaseInLanes(int family, simd_float4 t, bool isInOut) {
+	switch (family) {
+		case 0: return t * t;
+		case 1: return t * t * t;
+		case 2: { simd_float4 t2 = t * t; return t2 * t2; }
+		case 3: { simd_float4 t2 = t * t; return t2 * t2 * t; }
+		case 4: {
+			simd_float4 sinOfAngle, cosOfAngle;
+			vuckt_simd_fast_sincos4(t * 1.570796327f, &sinOfAngle, &cosOfAngle);
+			return 1.0f - cosOfAngle;
+		}
+		case 5: return vuckt_simd_fast_exp2_4(10.0f * t - 10.0f);
+		case 6: return 1.0f - vuckt_simd_sqrt4((1.0f - t) * (1.0f + t)); // (`1 - t²` factored, which stays accurate as `t` nears 1)
+		case 7: {
+			const float overshoot = isInOut ? 1.70158f * 1.525f : 1.70158f;
+			return t * t * ((overshoot + 1.0f) * t - overshoot);
+		}
+		case 8: {
+			// A period of 0.3 (0.45 for in-out) of the ratio, i.e. 3 (4.5) of `10t`, starting a quarter-period before the end.
+			const float period = isInOut ? 4.5f : 3.0f;
+			simd_float4 sinOfAngle, cosOfAngle;
+			vuckt_simd_fast_sincos4((10.0f * t - 10.0f - 0.25f * period) * (6.283185307f / period), &sinOfAngle, &cosOfAngle);
+			return -vuckt_simd_fast_exp2_4(10.0f * t - 10.0f) * sinOfAngle;
+		}
+		default: return 1.0f - _CurveBounceOutLanes(1.0f - t);
+	}
+}
+
+/// The easing of family `family` in mode `mode` (`(easing - 1) % 3`: in, out, or in-out), each of the latter two built from the first: out as `1 - in(1 - t)`, & in-out as in then out over each half.
+NS_INLINE simd_float4 _CurveEaseFamilyLanes(int family, int mode, simd_float4 t) {
+	simd_float4 eased;
+	switch (mode) {
+		case 0:
+			eased = _CurveEaseInLanes(family, t, false);
+			break;
+		case 1:
+			// Circular-out, `√(1 - (1 - t)²)`, is evaluated as `√(t(2 - t))`, since `1 - in(1 - t)` loses most of its precision as `t` nears 0.
+			eased = (family == 6) ? vuckt_simd_sqrt4(t * (2.0f - t)) : 1.0f - _CurveEaseInLanes(family, 1.0f - t, false);
+			break;
+		default: {
+			simd_int4 isFirstHalf = (t < 0.5f);
+			simd_float4 halfEased = 0.5f * _CurveEaseInLanes(family, vuckt_simd_select4(isFirstHalf, 2.0f * t, 2.0f - 2.0f * t), true);
+			eased = vuckt_simd_select4(isFirstHalf, halfEased, 1.0f - halfEased);
+			break;
+		}
+	}
+	// Pins the ends, which the exponential & elastic formulas (& the approximations the others go through) miss by a little.
+	eased = vuckt_simd_select4((t == 0.0f), (simd_float4){ 0, 0, 0, 0 }, eased);
+	return vuckt_simd_select4((t == 1.0f), (simd_float4){ 1, 1, 1, 1 }, eased);
+}
+
+/// Calls `FUNCTION(basis, componentCount, stride, …)` with constant arguments for each basis & the common layouts (`float`s, & `Float2`s, `Float3`s, & `Float4`s from either backend), so each inlines as a loop specialized to it; & with the given arguments otherwise.
+#define _VUCKT_CURVE_LAYOUT_CASES(FUNCTION, BASIS, ...) \
+	case (BASIS) * 100 + 11: FUNCTION((BASIS), 1, 1, __VA_ARGS__); break; \
+	case (BASIS) * 100 + 22: FUNCTION((BASIS), 2, 2, __VA_ARGS__); break; \
+	case (BASIS) * 100 + 33: FUNCTION((BASIS), 3, 3, __VA_ARGS__); break; \
+	case (BASIS) * 100 + 34: FUNCTION((BASIS), 3, 4, __VA_ARGS__); break; \
+	case (BASIS) * 100 + 44: FUNCTION((BASIS), 4, 4, __VA_ARGS__); break;
+#define _VUCKT_CURVE_SPECIALIZED_CALL(FUNCTION, basis, componentCount, stride, ...) \
+	switch (((basis) >= 0 && (componentCount) <= 4 && (stride) <= 4) ? (int)(basis) * 100 + (int)(componentCount) * 10 + (int)(stride) : -1) { \
+		_VUCKT_CURVE_LAYOUT_CASES(FUNCTION, VUCKT_CURVE_BASIS_HERMITE, __VA_ARGS__) \
+		_VUCKT_CURVE_LAYOUT_CASES(FUNCTION, VUCKT_CURVE_BASIS_CATMULL_ROM, __VA_ARGS__) \
+		_VUCKT_CURVE_LAYOUT_CASES(FUNCTION, VUCKT_CURVE_BASIS_BEZIER, __VA_ARGS__) \
+		default: FUNCTION((basis), (componentCount), (stride), __VA_ARGS__); break; \
+	}
+
+
+
+#pragma mark Easing
+
+/// `easing` applied to each of the 4 lanes of `t`.
+NS_INLINE simd_float4 CurveEaseLanes(int easing, simd_float4 t) {
+	if (easing <= VUCKT_EASING_LINEAR || easing >= VUCKT_EASING_COUNT)
+		return t;
+	return _CurveEaseFamilyLanes((easing - 1) / 3, (easing - 1) % 3, t);
+}
+
+/// `ratio` eased by `easing` (a `VUCKT_EASING_…` code).
+NS_INLINE float CurveEase(int easing, float ratio) {
+	return CurveEaseLanes(easing, (simd_float4){ ratio, ratio, ratio, ratio })[0];
+}
+
+/// `out[i] = CurveEase(easing, ratios[i])`, 4 at a time, with the easing chosen once for the whole array.  (`out` may be the memory of `ratios`.)
+NS_INLINE void CurveEaseArrays(int easing, const float *ratios, float *out, size_t n) {
+	if (easing <= VUCKT_EASING_LINEAR || easing >= VUCKT_EASING_COUNT) {
+		if (out != ratios)
+			memmove(out, ratios, n * sizeof(float));
+		return;
+	}
+	const int mode = (easing - 1) % 3;
+	#define _VUCKT_CURVE_EASE_FAMILY_CASE(FAMILY) \
+		case FAMILY: \
+			VUCKT_FOR_EACH_BLOCK4(n, i, count, { \
+				_CurveLanesStore(_CurveEaseFamilyLanes(FAMILY, mode, _CurveLanesLoad(ratios + i, count)), out + i, count); \
+			}); \
+			break;
+	switch ((easing - 1) / 3) {
+		_VUCKT_CURVE_EASE_FAMILY_CASE(0)
+		_VUCKT_CURVE_EASE_FAMILY_CASE(1)
+		_VUCKT_CURVE_EASE_FAMILY_CASE(2)
+		_VUCKT_CURVE_EASE_FAMILY_CASE(3)
+		_VUCKT_CURVE_EASE_FAMILY_CASE(4)
+		_VUCKT_CURVE_EASE_FAMILY_CASE(5)
+		_VUCKT_CURVE_EASE_FAMILY_CASE(6)
+		_VUCKT_CURVE_EASE_FAMILY_CASE(7)
+		_VUCKT_CURVE_EASE_FAMILY_CASE(8)
+		_VUCKT_CURVE_EASE_FAMILY_CASE(9)
+	}
+	#undef _VUCKT_CURVE_EASE_FAMILY_CASE
+}
+
+
+
+#pragma mark Spline Segments
+
+/// Writes the weights of a segment's 4 control points at `ratio` along it, in `basis` (a `VUCKT_CURVE_BASIS_…` code), to `outWeights[0…3]`; the segment's value there is the control points' sum so weighted.
+NS_INLINE void CurveBasisWeights(int basis, float ratio, float *outWeights) {
+	float t = ratio, t2 = t * t, t3 = t2 * t;
+	switch (basis) {
+		case VUCKT_CURVE_BASIS_HERMITE:
+			outWeights[0] = 2.0f * t3 - 3.0f * t2 + 1.0f;
+			outWeights[1] = t3 - 2.0f * t2 + t;
+			outWeights[2] = 3.0f * t2 - 2.0f * t3;
+			outWeights[3] = t3 - t2;
+			break;
+		case VUCKT_CURVE_BASIS_CATMULL_ROM:
+			outWeights[0] = 0.5f * (2.0f * t2 - t3 - t);
+			outWeights[1] = 0.5f * (3.0f * t3 - 5.0f * t2 + 2.0f);
+			outWeights[2] = 0.5f * (4.0f * t2 - 3.0f * t3 + t);
+			outWeights[3] = 0.5f * (t3 - t2);
+			break;
+		default: {
+			float u = 1.0f - t;
+			outWeights[0] = u * u * u;
+			outWeights[1] = 3.0f * u * u * t;
+			outWeights[2] = 3.0f * u * t2;
+			outWeights[3] = t3;
+			break;
+		}
+	}
+}
+
+/// `outStride` 0 means `stride`.
+NS_INLINE void _CurveSampleSegmentLanes(int basis, size_t componentCount, size_t stride, const float *controlPoints, const float *ratios, float *out, size_t outStride, size_t n) {
+	if (outStride == 0)
+		outStride = stride;
+	simd_float4 p0 = _CurveLanesLoad(controlPoints, componentCount), p1 = _CurveLanesLoad(controlPoints + stride, componentCount);
+	simd_float4 p2 = _CurveLanesLoad(controlPoints + 2 * stride, componentCount), p3 = _CurveLanesLoad(controlPoints + 3 * stride, componentCount);
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float weights[4];
+		CurveBasisWeights(basis, ratios[i], weights);
+		_CurveLanesStore(weights[0] * p0 + weights[1] * p1 + weights[2] * p2 + weights[3] * p3, out + i * outStride, componentCount);
+	}
+}
+
+NS_INLINE void _CurveEvaluateSegmentLanes(int basis, size_t componentCount, size_t stride, const float *controlPoints, const float *ratios, float *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float weights[4];
+		CurveBasisWeights(basis, ratios[i], weights);
+		const float *points = controlPoints + i * 4 * stride;
+		simd_float4 value = weights[0] * _CurveLanesLoad(points, componentCount) + weights[1] * _CurveLanesLoad(points + stride, componentCount);
+		value += weights[2] * _CurveLanesLoad(points + 2 * stride, componentCount) + weights[3] * _CurveLanesLoad(points + 3 * stride, componentCount);
+		_CurveLanesStore(value, out + i * stride, componentCount);
+	}
+}
+
+/// Samples one segment at each of `n` ratios, `out[i]` being its value at `ratios[i]`.
+/// `controlPoints` is the segment's 4 control points; it & `out` each hold values of `componentCount` (1–4) lanes, `stride` floats apart.
+NS_INLINE void CurveSampleSegmentLanes(int basis, const float *controlPoints, size_t componentCount, size_t stride, const float *ratios, float *out, size_t n) {
+	_VUCKT_CURVE_SPECIALIZED_CALL(_CurveSampleSegmentLanes, basis, componentCount, stride, controlPoints, ratios, out, 0, n)
+}
+
+/// Evaluates `n` segments once each (e.g. many animated objects' current keyframe segments), `out[i]` being segment `i`'s value at `ratios[i]`.
+/// `controlPoints` is the segments' 4 control points each, back to back; it & `out` each hold values of `componentCount` (1–4) lanes, `stride` floats apart.
+NS_INLINE void CurveEvaluateSegmentLanes(int basis, const float *controlPoints, size_t componentCount, size_t stride, const float *ratios, float *out, size_t n) {
+	_VUCKT_CURVE_SPECIALIZED_CALL(_CurveEvaluateSegmentLanes, basis, componentCount, stride, controlPoints, ratios, out, n)
+}
+
+
+
+#pragma mark Spline Tracks
+
+/// The segments a track of `keyframeCount` keyframes in `basis` has (see the `VUCKT_CURVE_BASIS_…` codes for their layouts), or 0 if it hasn't enough for one.
+NS_INLINE size_t CurveTrackSegmentCount(int basis, size_t keyframeCount) {
+	switch (basis) {
+		case VUCKT_CURVE_BASIS_HERMITE: return (keyframeCount >= 4) ? keyframeCount / 2 - 1 : 0;
+		case VUCKT_CURVE_BASIS_CATMULL_ROM: return (keyframeCount >= 2) ? keyframeCount - 1 : 0;
+		default: return (keyframeCount >= 4) ? (keyframeCount - 1) / 3 : 0;
+	}
+}
+
+/// `outStride` 0 means `stride`.
+NS_INLINE void _CurveSampleTrackLanes(int basis, size_t componentCount, size_t stride, const float *keyframes, size_t keyframeCount, const float *times, float *out, size_t outStride, size_t n) {
+	if (outStride == 0)
+		outStride = stride;
+	const size_t segmentCount = CurveTrackSegmentCount(basis, keyframeCount);
+	const float endTime = (float)segmentCount;
+	// Segment `s`'s first control point is keyframe `s·step + offset`; Catmull-Rom's start a keyframe before their segments (& are clamped to the track).
+	const ptrdiff_t step = (basis == VUCKT_CURVE_BASIS_HERMITE) ? 2 : (basis == VUCKT_CURVE_BASIS_CATMULL_ROM) ? 1 : 3;
+	const ptrdiff_t offset = (basis == VUCKT_CURVE_BASIS_CATMULL_ROM) ? -1 : 0;
+	const ptrdiff_t lastKeyframe = (ptrdiff_t)keyframeCount - 1;
+	for (size_t i = 0; i < n; ++i) {
+		float time = times[i];
+		time = (time > 0.0f) ? ((time < endTime) ? time : endTime) : 0.0f;
+		size_t segment = (size_t)time;
+		segment = (segment < segmentCount) ? segment : segmentCount - 1;
+		float weights[4];
+		CurveBasisWeights(basis, time - (float)segment, weights);
+		const float *points[4];
+		for (ptrdiff_t pointI = 0; pointI < 4; ++pointI) {
+			ptrdiff_t keyframeI = (ptrdiff_t)segment * step + offset + pointI;
+			keyframeI = (keyframeI > 0) ? ((keyframeI < lastKeyframe) ? keyframeI : lastKeyframe) : 0;
+			points[pointI] = keyframes + keyframeI * stride;
+		}
+		for (size_t componentI = 0; componentI < componentCount; ++componentI)
+			out[i * outStride + componentI] = weights[0] * points[0][componentI] + weights[1] * points[1][componentI] + weights[2] * points[2][componentI] + weights[3] * points[3][componentI];
+	}
+}
+
+/// Samples a track of `keyframeCount` keyframes (laid out per `basis`; at least a segment's worth) at each of `n` times, `out[i]` being its value at `times[i]`: time `s + r` is ratio `r` along segment `s`, & times outside 0…`CurveTrackSegmentCount()` clamp to the track's ends.
+/// `keyframes` & `out` each hold values of `componentCount` (1–4) lanes, `stride` floats apart.
+NS_INLINE void CurveSampleTrackLanes(int basis, const float *keyframes, size_t keyframeCount, size_t componentCount, size_t stride, const float *times, float *out, size_t n) {
+	_VUCKT_CURVE_SPECIALIZED_CALL(_CurveSampleTrackLanes, basis, componentCount, stride, keyframes, keyframeCount, times, out, 0, n)
+}
+
+
+
+#pragma mark Arc Length
+
+// A track's speed varies along it (with the spacing of its keyframes, & within each segment), so evenly spaced times don't give evenly spaced points.
+// An arc-length table maps between the two: entry `j` of `tableCount` is the track's length up to time `j · segmentCount / (tableCount - 1)`, measured along chords between those times.
+// Mapping evenly spaced distances through it to times (& sampling the track at those) moves along the track at constant speed, to within the chords' approximation of it.
+
+/// Writes the arc-length table of a track of `keyframeCount` keyframes (see `CurveSampleTrackLanes()`) to `outTable[0…tableCount - 1]` (`tableCount` ≥ 2); `outTable[tableCount - 1]` is then the track's length.
+NS_INLINE void CurveArcLengthTableBuild(int basis, const float *keyframes, size_t keyframeCount, size_t componentCount, size_t stride, float *outTable, size_t tableCount) {
+	const float timeScale = (float)CurveTrackSegmentCount(basis, keyframeCount) / (float)(tableCount - 1);
+	float times[64], points[(64 + 1) * 4] = { 0 }; // `points[0…3]` holding the previous block's last point
+	float length = 0.0f;
+	for (size_t first = 0; first < tableCount; first += 64) {
+		size_t count = (tableCount - first < 64) ? tableCount - first : 64;
+		for (size_t pointI = 0; pointI < count; ++pointI)
+			times[pointI] = (float)(first + pointI) * timeScale;
+		_VUCKT_CURVE_SPECIALIZED_CALL(_CurveSampleTrackLanes, basis, componentCount, stride, keyframes, keyframeCount, times, points + 4, 4, count)
+		if (first == 0)
+			memcpy(points, points + 4, 4 * sizeof(float));
+		for (size_t pointI = 0; pointI < count; ++pointI) {
+			const float *from = points + pointI * 4, *to = from + 4;
+			float distanceSquared = 0.0f;
+			for (size_t componentI = 0; componentI < componentCount; ++componentI)
+				distanceSquared += (to[componentI] - from[componentI]) * (to[componentI] - from[componentI]);
+			length += vuckt_sqrtf(distanceSquared);
+			outTable[first + pointI] = length;
+		}
+		memcpy(points, points + count * 4, 4 * sizeof(float));
+	}
+}
+
+/// The time at which the track of `segmentCount` segments whose arc-length table is `table` reaches `distance` along it, interpolating linearly between the entries at either side (starting the search at entry `base`, which must be at or before them).
+NS_INLINE float _CurveArcLengthTime(const float *table, size_t tableCount, float timeScale, float distance, size_t base) {
+	size_t remaining = tableCount - 1 - base;
+	while (remaining > 1) {
+		size_t half = remaining / 2;
+		base = (table[base + half] <= distance) ? base + half : base;
+		remaining -= half;
+	}
+	float span = table[base + 1] - table[base];
+	float ratio = (span > 0.0f) ? (distance - table[base]) / span : 0.0f;
+	ratio = (ratio > 0.0f) ? ((ratio < 1.0f) ? ratio : 1.0f) : 0.0f;
+	return ((float)base + ratio) * timeScale;
+}
+
+/// Writes to `outTimes[i]` the time at which the track reaches `distances[i]` along it (clamped to 0…its length), per its `tableCount`-entry arc-length `table` (from `CurveArcLengthTableBuild()`) & its `segmentCount`.
+NS_INLINE void CurveArcLengthTimes(const float *table, size_t tableCount, size_t segmentCount, const float *distances, float *outTimes, size_t n) {
+	const float timeScale = (float)segmentCount / (float)(tableCount - 1);
+	for (size_t i = 0; i < n; ++i)
+		outTimes[i] = _CurveArcLengthTime(table, tableCount, timeScale, distances[i], 0);
+}
+
+/// Writes to `outTimes[0…n - 1]` the times at `n` evenly spaced distances along the track, from its start to its end (just its start, for `n` = 1), per its arc-length `table` as for `CurveArcLengthTimes()`.
+/// The distances rising, each search resumes from where the last left off, so this costs O(n + `tableCount`) rather than O(n · log `tableCount`).
+NS_INLINE void CurveArcLengthUniformTimes(const float *table, size_t tableCount, size_t segmentCount, float *outTimes, size_t n) {
+	const float timeScale = (float)segmentCount / (float)(tableCount - 1);
+	const float spacing = (n > 1) ? table[tableCount - 1] / (float)(n - 1) : 0.0f;
+	size_t base = 0;
+	for (size_t i = 0; i < n; ++i) {
+		float distance = (float)i * spacing;
+		while (base + 2 < tableCount && table[base + 1] <= distance)
+			++base;
+		outTimes[i] = _CurveArcLengthTime(table, tableCount, timeScale, distance, base);
+	}
+}
+
+
+
+#pragma mark Eased Rotations
+
+// The `FloatQuaternion…Arrays()` interpolations with each ratio first eased by `easing`, so a rotation can ease in & out as a vector does.
+// The eased ratios are staged (on the stack) `VUCKT_CURVE_EASING_BLOCK_SIZE` at a time.
+
+#define VUCKT_CURVE_EASING_BLOCK_SIZE 64
+
+/// Writes `count` ratios `ratios[i · ratioStride]`, eased by `easing`, to `outEased`.
+NS_INLINE void _CurveEaseStridedRatios(int easing, const float *ratios, size_t ratioStride, float *outEased, size_t count) {
+	if (ratioStride != 1) {
+		for (size_t i = 0; i < count; ++i)
+			outEased[i] = ratios[i * ratioStride];
+		ratios = outEased;
+	}
+	CurveEaseArrays(easing, ratios, outEased, count);
+}
+
+/// Runs `BODY` over `n` elements' eased ratios in blocks, each block's first element being `first`, its element count `count`, & its eased ratios `easedRatios` (`easedStride` apart: 0 if `ratioStride` is, as one eased ratio then serves all the elements).
+#define _VUCKT_CURVE_FOR_EACH_EASED_BLOCK(easing, ratios, ratioStride, n, first, count, easedRatios, easedStride, BODY) \
+	do { \
+		float easedRatios[VUCKT_CURVE_EASING_BLOCK_SIZE]; \
+		const size_t easedStride = ((ratioStride) == 0) ? 0 : 1; \
+		if ((ratioStride) == 0 && (n) > 0) \
+			easedRatios[0] = CurveEase((easing), (ratios)[0]); \
+		for (size_t first = 0; first < (n); first += VUCKT_CURVE_EASING_BLOCK_SIZE) { \
+			const size_t count = ((n) - first < VUCKT_CURVE_EASING_BLOCK_SIZE) ? (n) - first : VUCKT_CURVE_EASING_BLOCK_SIZE; \
+			if ((ratioStride) != 0) \
+				_CurveEaseStridedRatios((easing), (ratios) + first * (ratioStride), (ratioStride), easedRatios, count); \
+			BODY; \
+		} \
+	} while (0)
+
+/// `FloatQuaternionSlerpArrays()` with eased ratios.
+NS_INLINE void CurveEasedSlerpArrays(int easing, const FloatQuaternion *from, const FloatQuaternion *to, const float *ratios, size_t ratioStride, FloatQuaternion *out, size_t n, bool longest) {
+	_VUCKT_CURVE_FOR_EACH_EASED_BLOCK(easing, ratios, ratioStride, n, first, count, easedRatios, easedStride, {
+		FloatQuaternionSlerpArrays(from + first, to + first, easedRatios, easedStride, out + first, count, longest);
+	});
+}
+/// `FloatQuaternionBezierArrays()` with eased ratios.
+NS_INLINE void CurveEasedBezierArrays(int easing, const FloatQuaternion *q0, const FloatQuaternion *q1, const FloatQuaternion *q2, const FloatQuaternion *q3, const float *ratios, size_t ratioStride, FloatQuaternion *out, size_t n) {
+	_VUCKT_CURVE_FOR_EACH_EASED_BLOCK(easing, ratios, ratioStride, n, first, count, easedRatios, easedStride, {
+		FloatQuaternionBezierArrays(q0 + first, q1 + first, q2 + first, q3 + first, easedRatios, easedStride, out + first, count);
+	});
+}
+/// `FloatQuaternionSplineArrays()` with eased ratios.
+NS_INLINE void CurveEasedSplineArrays(int easing, const FloatQuaternion *q0, const FloatQuaternion *q1, const FloatQuaternion *q2, const FloatQuaternion *q3, const float *ratios, size_t ratioStride, FloatQuaternion *out, size_t n) {
+	_VUCKT_CURVE_FOR_EACH_EASED_BLOCK(easing, ratios, ratioStride, n, first, count, easedRatios, easedStride, {
+		FloatQuaternionSplineArrays(q0 + first, q1 + first, q2 + first, q3 + first, easedRatios, easedStride, out + first, count);
+	});
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
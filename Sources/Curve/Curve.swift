@@ -0,0 +1,308 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+/// One of Robert Penner's easings (see `Curve.h`), mapping a ratio in 0…1 to an eased ratio, from exactly 0 at 0 to exactly 1 at 1.  (The raw values are the `VUCKT_EASING_…` codes.)
+public enum Easing : Int32
+{
+	case linear = 0
+	case quadraticIn = 1, quadraticOut = 2, quadraticInOut = 3
+	case cubicIn = 4, cubicOut = 5, cubicInOut = 6
+	case quarticIn = 7, quarticOut = 8, quarticInOut = 9
+	case quinticIn = 10, quinticOut = 11, quinticInOut = 12
+	case sineIn = 13, sineOut = 14, sineInOut = 15
+	case exponentialIn = 16, exponentialOut = 17, exponentialInOut = 18
+	case circularIn = 19, circularOut = 20, circularInOut = 21
+	/// Pulls back (below 0) before setting off.
+	case backIn = 22, backOut = 23, backInOut = 24
+	/// Oscillates with growing amplitude before setting off.
+	case elasticIn = 25, elasticOut = 26, elasticInOut = 27
+	/// Bounces off 0 with growing height before setting off.
+	case bounceIn = 28, bounceOut = 29, bounceInOut = 30
+	
+	/// `ratio` eased.  (With the C backend, within 1.5e-6 of Penner's formula; see `Curve.h`.)
+	@_transparent public func eased(_ ratio:Float) -> Float {
+		return CurveEase(self.rawValue, ratio)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float // Easing
+{
+	/// Each ratio eased by `easing`, written to `out`, 4 at a time.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func ease(by easing:Easing, into out:UnsafeMutableBufferPointer<Float>) {
+		precondition(out.count == self.count, "Bulk operation buffers must all have the same count.")
+		guard self.count > 0 else { return }
+		CurveEaseArrays(easing.rawValue, self.baseAddress!, out.baseAddress!, self.count)
+	}
+}
+
+extension Array where Element == Float // Easing
+{
+	/// Each ratio eased by `easing`.
+	@_alwaysEmitIntoClient public func eased(by easing:Easing) -> [Float] {
+		return self.withUnsafeBufferPointer{ ratios in
+			_vucktCurveResult(count: ratios.count){ ratios.ease(by: easing, into: $0) }
+		}
+	}
+}
+
+extension Float2 {
+	/// `interpolated(to: other, ratio: easing.eased(ratio))`.
+	@_transparent public func interpolated(to other:Float2, ratio:Float, easing:Easing) -> Float2 {
+		return interpolateBetween(self, other, ratio: easing.eased(ratio))
+	}
+}
+extension Float3 {
+	/// `interpolated(to: other, ratio: easing.eased(ratio))`.
+	@_transparent public func interpolated(to other:Float3, ratio:Float, easing:Easing) -> Float3 {
+		return interpolateBetween(self, other, ratio: easing.eased(ratio))
+	}
+}
+extension Float4 {
+	/// `interpolated(to: other, ratio: easing.eased(ratio))`.
+	@_transparent public func interpolated(to other:Float4, ratio:Float, easing:Easing) -> Float4 {
+		return interpolateBetween(self, other, ratio: easing.eased(ratio))
+	}
+}
+
+
+
+/// How a cubic spline segment's 4 control points shape it.  (The raw values are the `VUCKT_CURVE_BASIS_…` codes, whose docs in `Curve.h` also give each basis' track keyframe layout.)
+public enum CurveBasis : Int32
+{
+	/// Control points `p0, m0, p1, m1`: from `p0` to `p1`, leaving with tangent `m0` & arriving with tangent `m1`.
+	case hermite = 0
+	/// Control points `p-1, p0, p1, p2`: from `p0` to `p1`, with tangents taken from the neighbors, so consecutive segments join smoothly.
+	case catmullRom = 1
+	/// Control points `p0, c0, c1, p1`: from `p0` to `p1`, leaving toward `c0` & arriving from `c1`.
+	case bezier = 2
+}
+
+/// A type splines can run through, handled by the curve kernels as `curveComponentCount` `Float` lanes.
+public protocol CurveInterpolable
+{
+	static var curveComponentCount:Int { get }
+}
+
+extension Float : CurveInterpolable { @_transparent public static var curveComponentCount:Int { return 1 } }
+extension Float2 : CurveInterpolable { @_transparent public static var curveComponentCount:Int { return 2 } }
+extension Float3 : CurveInterpolable { @_transparent public static var curveComponentCount:Int { return 3 } }
+extension Float4 : CurveInterpolable { @_transparent public static var curveComponentCount:Int { return 4 } }
+
+extension CurveInterpolable
+{
+	/// The `Float`s from one value to the next in an array (which differs between the C & pure-Swift backends for `Float3`).
+	@_transparent @usableFromInline internal static var _vucktCurveStride:Int { return MemoryLayout<Self>.stride / MemoryLayout<Float>.stride }
+}
+
+@usableFromInline internal func _vucktCurveLanes<Point>(_ values:UnsafeBufferPointer<Point>) -> UnsafePointer<Float> {
+	return UnsafeRawPointer(values.baseAddress!).assumingMemoryBound(to: Float.self)
+}
+@usableFromInline internal func _vucktCurveLanes<Point>(_ values:UnsafeMutableBufferPointer<Point>) -> UnsafeMutablePointer<Float> {
+	return UnsafeMutableRawPointer(values.baseAddress!).assumingMemoryBound(to: Float.self)
+}
+
+@usableFromInline internal func _vucktCurveResult<Element>(count:Int, _ body:(UnsafeMutableBufferPointer<Element>) -> Void) -> [Element] {
+	return Array(unsafeUninitializedCapacity: count) { outBuffer, initializedCount in
+		body(UnsafeMutableBufferPointer(rebasing: outBuffer[0..<count]))
+		initializedCount = count
+	}
+}
+
+
+
+/// One cubic spline segment: 4 control points in a `CurveBasis`.
+public struct CurveSegment<Point : CurveInterpolable>
+{
+	public var basis:CurveBasis
+	public var controlPoints:(Point, Point, Point, Point)
+	
+	@_transparent public init(basis:CurveBasis, _ p0:Point, _ p1:Point, _ p2:Point, _ p3:Point) {
+		self.basis = basis
+		self.controlPoints = (p0, p1, p2, p3)
+	}
+	
+	/// The segment's value at `ratio` along it.
+	@_alwaysEmitIntoClient public func point(at ratio:Float) -> Point {
+		return withUnsafePointer(to: ratio){ ratioPointer in
+			self.points(at: UnsafeBufferPointer(start: ratioPointer, count: 1))[0]
+		}
+	}
+	
+	/// The segment's value at each of `ratios`, written to `out`, in a single pass specialized to `Point`.  (Both buffers must have the same count.)
+	@_alwaysEmitIntoClient public func points(at ratios:UnsafeBufferPointer<Float>, into out:UnsafeMutableBufferPointer<Point>) {
+		precondition(out.count == ratios.count, "Bulk operation buffers must all have the same count.")
+		guard ratios.count > 0 else { return }
+		withUnsafeBytes(of: self.controlPoints){ controlPoints in
+			CurveSampleSegmentLanes(self.basis.rawValue, controlPoints.baseAddress!.assumingMemoryBound(to: Float.self), Point.curveComponentCount, Point._vucktCurveStride, ratios.baseAddress!, _vucktCurveLanes(out), ratios.count)
+		}
+	}
+	/// The segment's value at each of `ratios`.
+	@_alwaysEmitIntoClient public func points(at ratios:[Float]) -> [Point] {
+		return ratios.withUnsafeBufferPointer{ ratios in
+			_vucktCurveResult(count: ratios.count){ self.points(at: ratios, into: $0) }
+		}
+	}
+	
+	/// Evaluates `ratios.count` segments in `basis` once each (e.g. many animated objects' current keyframe segments), `out[i]` being the value at `ratios[i]` of the segment whose control points are `controlPoints[4i…4i + 3]`.  (`controlPoints` must have 4 times the others' count.)
+	@_alwaysEmitIntoClient public static func points(basis:CurveBasis, controlPoints:UnsafeBufferPointer<Point>, at ratios:UnsafeBufferPointer<Float>, into out:UnsafeMutableBufferPointer<Point>) {
+		precondition(controlPoints.count == ratios.count * 4 && out.count == ratios.count, "Bulk operation buffers must all have the same count (of segments).")
+		guard ratios.count > 0 else { return }
+		CurveEvaluateSegmentLanes(basis.rawValue, _vucktCurveLanes(controlPoints), Point.curveComponentCount, Point._vucktCurveStride, ratios.baseAddress!, _vucktCurveLanes(out), ratios.count)
+	}
+	@_alwaysEmitIntoClient public static func points(basis:CurveBasis, controlPoints:[Point], at ratios:[Float]) -> [Point] {
+		return controlPoints.withUnsafeBufferPointer{ controlPoints in ratios.withUnsafeBufferPointer{ ratios in
+			_vucktCurveResult(count: ratios.count){ self.points(basis: basis, controlPoints: controlPoints, at: ratios, into: $0) }
+		} }
+	}
+}
+
+
+
+/// A keyframe track: a run of cubic spline segments, their keyframes laid out per `basis` (see `CurveBasis`).
+/// Time `s + r` along the track is ratio `r` along segment `s`, so the track spans times 0…`segmentCount`; times outside that clamp to its ends.
+public struct CurveTrack<Point : CurveInterpolable>
+{
+	public var basis:CurveBasis
+	public var keyframes:[Point]
+	
+	/// `keyframes` must make up at least one segment in `basis`.
+	@_alwaysEmitIntoClient public init(basis:CurveBasis, keyframes:[Point]) {
+		precondition(CurveTrackSegmentCount(basis.rawValue, keyframes.count) > 0, "Too few keyframes for a segment.")
+		self.basis = basis
+		self.keyframes = keyframes
+	}
+	
+	@_alwaysEmitIntoClient public var segmentCount:Int {
+		return CurveTrackSegmentCount(self.basis.rawValue, self.keyframes.count)
+	}
+	
+	/// The track's value at `time`.
+	@_alwaysEmitIntoClient public func point(at time:Float) -> Point {
+		return withUnsafePointer(to: time){ timePointer in
+			self.points(at: UnsafeBufferPointer(start: timePointer, count: 1))[0]
+		}
+	}
+	
+	/// The track's value at each of `times`, written to `out`.  (Both buffers must have the same count.)
+	@_alwaysEmitIntoClient public func points(at times:UnsafeBufferPointer<Float>, into out:UnsafeMutableBufferPointer<Point>) {
+		precondition(out.count == times.count, "Bulk operation buffers must all have the same count.")
+		guard times.count > 0 else { return }
+		self.keyframes.withUnsafeBufferPointer{ keyframes in
+			CurveSampleTrackLanes(self.basis.rawValue, _vucktCurveLanes(keyframes), keyframes.count, Point.curveComponentCount, Point._vucktCurveStride, times.baseAddress!, _vucktCurveLanes(out), times.count)
+		}
+	}
+	/// The track's value at each of `times`.
+	@_alwaysEmitIntoClient public func points(at times:[Float]) -> [Point] {
+		return times.withUnsafeBufferPointer{ times in
+			_vucktCurveResult(count: times.count){ self.points(at: times, into: $0) }
+		}
+	}
+	
+	/// The track's arc-length table, of `entryCount` (≥ 2) entries; more entries follow the track's curvature more closely.
+	@_alwaysEmitIntoClient public func arcLengthTable(entryCount:Int = 256) -> CurveArcLengthTable {
+		precondition(entryCount >= 2, "An arc-length table needs at least 2 entries.")
+		let lengths:[Float] = self.keyframes.withUnsafeBufferPointer{ keyframes in
+			_vucktCurveResult(count: entryCount){ CurveArcLengthTableBuild(self.basis.rawValue, _vucktCurveLanes(keyframes), keyframes.count, Point.curveComponentCount, Point._vucktCurveStride, $0.baseAddress!, entryCount) }
+		}
+		return CurveArcLengthTable(segmentCount: self.segmentCount, lengths: lengths)
+	}
+	
+	/// `count` points evenly spaced by distance along the track, from its start to its end (i.e. sampled at constant speed), per `table` (by default, a 256-entry `arcLengthTable()`).
+	@_alwaysEmitIntoClient public func uniformlySpacedPoints(count:Int, table:CurveArcLengthTable? = nil) -> [Point] {
+		let table = table ?? self.arcLengthTable()
+		return self.points(at: table.uniformTimes(count: count))
+	}
+}
+
+/// A track's length up to each of evenly spaced times along it, for mapping distances along the track to times (see `Curve.h`).
+public struct CurveArcLengthTable
+{
+	public let segmentCount:Int
+	/// `lengths[j]` is the track's length up to time `j · segmentCount / (lengths.count - 1)`.
+	public let lengths:[Float]
+	
+	@_alwaysEmitIntoClient public init(segmentCount:Int, lengths:[Float]) {
+		precondition(lengths.count >= 2, "An arc-length table needs at least 2 entries.")
+		self.segmentCount = segmentCount
+		self.lengths = lengths
+	}
+	
+	/// The track's total length.
+	@_alwaysEmitIntoClient public var length:Float { return self.lengths[self.lengths.count - 1] }
+	
+	/// The time at which the track reaches `distance` along it (clamped to 0…`length`).
+	@_alwaysEmitIntoClient public func time(atDistance distance:Float) -> Float {
+		return self.times(atDistances: [ distance ])[0]
+	}
+	/// The time at which the track reaches each of `distances` along it.
+	@_alwaysEmitIntoClient public func times(atDistances distances:[Float]) -> [Float] {
+		return self.lengths.withUnsafeBufferPointer{ lengths in distances.withUnsafeBufferPointer{ distances in
+			_vucktCurveResult(count: distances.count){ CurveArcLengthTimes(lengths.baseAddress!, lengths.count, self.segmentCount, distances.baseAddress!, $0.baseAddress!, distances.count) }
+		} }
+	}
+	/// The times at `count` evenly spaced distances along the track, from its start to its end, in a single pass over the table.
+	@_alwaysEmitIntoClient public func uniformTimes(count:Int) -> [Float] {
+		return self.lengths.withUnsafeBufferPointer{ lengths in
+			_vucktCurveResult(count: count){ CurveArcLengthUniformTimes(lengths.baseAddress!, lengths.count, self.segmentCount, $0.baseAddress!, count) }
+		}
+	}
+}
+
+
+
+extension FloatQuaternion // Eased Interpolation
+{
+	/// `interpolated(to: other, ratio: easing.eased(ratio), method: method)`.
+	@_transparent public func interpolated(to other:FloatQuaternion, ratio:Float, easing:Easing, method:FloatQuaternion.SphericalLinearInterpolationMethod = .shortest) -> FloatQuaternion {
+		return interpolateBetween(self, other, ratio: easing.eased(ratio), method: method)
+	}
+	@_transparent public mutating func interpolate(to other:FloatQuaternion, ratio:Float, easing:Easing, method:FloatQuaternion.SphericalLinearInterpolationMethod = .shortest) {
+		self = interpolateBetween(self, other, ratio: easing.eased(ratio), method: method)
+	}
+}
+
+/// Element-wise `interpolateBetween(a[i], b[i], ratio: easing.eased(ratios[i]), method: method)`, written to `out`, easing the ratios a block at a time.  (All buffers must have the same count.)
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, ratios:UnsafeBufferPointer<Float>, easing:Easing, into out:UnsafeMutableBufferPointer<FloatQuaternion>, method:FloatQuaternion.SphericalLinearInterpolationMethod = .shortest) {
+	precondition(b.count == a.count && ratios.count == a.count && out.count == a.count, "Bulk operation buffers must all have the same count.")
+	guard a.count > 0 else { return }
+	CurveEasedSlerpArrays(easing.rawValue, a.baseAddress!, b.baseAddress!, ratios.baseAddress!, 1, out.baseAddress!, a.count, method == .longest)
+}
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:[FloatQuaternion], _ b:[FloatQuaternion], ratios:[Float], easing:Easing, method:FloatQuaternion.SphericalLinearInterpolationMethod = .shortest) -> [FloatQuaternion] {
+	return _vucktBatchInterpolationResult(count: a.count){ out in
+		a.withUnsafeBufferPointer{ a in b.withUnsafeBufferPointer{ b in ratios.withUnsafeBufferPointer{ ratios in
+			interpolateBetween(a, b, ratios: ratios, easing: easing, into: out, method: method)
+		} } }
+	}
+}
+
+/// Element-wise `interpolateBetween(a[i], control1[i], control2[i], b[i], ratio: easing.eased(ratios[i]), method: method)`, written to `out`, easing the ratios a block at a time.  (All buffers must have the same count.)
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:UnsafeBufferPointer<FloatQuaternion>, _ control1:UnsafeBufferPointer<FloatQuaternion>, _ control2:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, ratios:UnsafeBufferPointer<Float>, easing:Easing, into out:UnsafeMutableBufferPointer<FloatQuaternion>, method:FloatQuaternion.SphericalCubicInterpolationMethod) {
+	precondition(control1.count == a.count && control2.count == a.count && b.count == a.count && ratios.count == a.count && out.count == a.count, "Bulk operation buffers must all have the same count.")
+	guard a.count > 0 else { return }
+	switch method {
+		case .bezier:
+			CurveEasedBezierArrays(easing.rawValue, a.baseAddress!, control1.baseAddress!, control2.baseAddress!, b.baseAddress!, ratios.baseAddress!, 1, out.baseAddress!, a.count)
+		case .spline:
+			CurveEasedSplineArrays(easing.rawValue, a.baseAddress!, control1.baseAddress!, control2.baseAddress!, b.baseAddress!, ratios.baseAddress!, 1, out.baseAddress!, a.count)
+	}
+}
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:[FloatQuaternion], _ control1:[FloatQuaternion], _ control2:[FloatQuaternion], _ b:[FloatQuaternion], ratios:[Float], easing:Easing, method:FloatQuaternion.SphericalCubicInterpolationMethod) -> [FloatQuaternion] {
+	return _vucktBatchInterpolationResult(count: a.count){ out in
+		a.withUnsafeBufferPointer{ a in control1.withUnsafeBufferPointer{ control1 in control2.withUnsafeBufferPointer{ control2 in b.withUnsafeBufferPointer{ b in ratios.withUnsafeBufferPointer{ ratios in
+			interpolateBetween(a, control1, control2, b, ratios: ratios, easing: easing, into: out, method: method)
+		} } } } }
+	}
+}
@@ -0,0 +1,254 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+
+
+
+// MARK: Constants
+
+public let VUCKT_EASING_LINEAR:Int32 = 0
+public let VUCKT_EASING_QUADRATIC_IN:Int32 = 1
+public let VUCKT_EASING_QUADRATIC_OUT:Int32 = 2
+public let VUCKT_EASING_QUADRATIC_IN_OUT:Int32 = 3
+public let VUCKT_EASING_CUBIC_IN:Int32 = 4
+public let VUCKT_EASING_CUBIC_OUT:Int32 = 5
+public let VUCKT_EASING_CUBIC_IN_OUT:Int32 = 6
+public let VUCKT_EASING_QUARTIC_IN:Int32 = 7
+public let VUCKT_EASING_QUARTIC_OUT:Int32 = 8
+public let VUCKT_EASING_QUARTIC_IN_OUT:Int32 = 9
+public let VUCKT_EASING_QUINTIC_IN:Int32 = 10
+public let VUCKT_EASING_QUINTIC_OUT:Int32 = 11
+public let VUCKT_EASING_QUINTIC_IN_OUT:Int32 = 12
+public let VUCKT_EASING_SINE_IN:Int32 = 13
+public let VUCKT_EASING_SINE_OUT:Int32 = 14
+public let VUCKT_EASING_SINE_IN_OUT:Int32 = 15
+public let VUCKT_EASING_EXPONENTIAL_IN:Int32 = 16
+public let VUCKT_EASING_EXPONENTIAL_OUT:Int32 = 17
+public let VUCKT_EASING_EXPONENTIAL_IN_OUT:Int32 = 18
+public let VUCKT_EASING_CIRCULAR_IN:Int32 = 19
+public let VUCKT_EASING_CIRCULAR_OUT:Int32 = 20
+public let VUCKT_EASING_CIRCULAR_IN_OUT:Int32 = 21
+public let VUCKT_EASING_BACK_IN:Int32 = 22
+public let VUCKT_EASING_BACK_OUT:Int32 = 23
+public let VUCKT_EASING_BACK_IN_OUT:Int32 = 24
+public let VUCKT_EASING_ELASTIC_IN:Int32 = 25
+public let VUCKT_EASING_ELASTIC_OUT:Int32 = 26
+public let VUCKT_EASING_ELASTIC_IN_OUT:Int32 = 27
+public let VUCKT_EASING_BOUNCE_IN:Int32 = 28
+public let VUCKT_EASING_BOUNCE_OUT:Int32 = 29
+public let VUCKT_EASING_BOUNCE_IN_OUT:Int32 = 30
+public let VUCKT_EASING_COUNT:Int32 = 31
+
+public let VUCKT_CURVE_BASIS_HERMITE:Int32 = 0
+public let VUCKT_CURVE_BASIS_CATMULL_ROM:Int32 = 1
+public let VUCKT_CURVE_BASIS_BEZIER:Int32 = 2
+
+public let VUCKT_CURVE_EASING_BLOCK_SIZE:Int32 = 64
+
+
+
+// MARK: Internal Helpers
+
+@usableFromInline internal func _vucktCurveBounceOut(_ t:Float) -> Float {
+	let n1:Float = 7.5625, d1:Float = 2.75
+	if t < 1 / d1 {
+		return n1 * t * t
+	} else if t < 2 / d1 {
+		let x = t - 1.5 / d1
+		return n1 * x * x + 0.75
+	} else if t < 2.5 / d1 {
+		let x = t - 2.25 / d1
+		return n1 * x * x + 0.9375
+	} else {
+		let x = t - 2.625 / d1
+		return n1 * x * x + 0.984375
+	}
+}
+
+@usableFromInline internal func _vucktCurveEaseIn(_ family:Int32, _ t:Float, _ isInOut:Bool) -> Float {
+	switch family {
+		case 0: return t * t
+		case 1: return t * t * t
+		case 2: return t * t * t * t
+		case 3: return t * t * t * t * t
+		case 4: return 1 - cos(t * (Float.pi / 2))
+		case 5: return pow(2, 10 * t - 10)
+		case 6: return 1 - sqrt((1 - t) * (1 + t))
+		case 7:
+			let overshoot:Float = isInOut ? 1.70158 * 1.525 : 1.70158
+			return t * t * ((overshoot + 1) * t - overshoot)
+		case 8:
+			let period:Float = isInOut ? 4.5 : 3
+			return -pow(2, 10 * t - 10) * sin((10 * t - 10 - 0.25 * period) * (2 * Float.pi / period))
+		default: return 1 - _vucktCurveBounceOut(1 - t)
+	}
+}
+
+@usableFromInline internal func _vucktCurveSegmentPoint(_ basis:Int32, _ points:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>), _ componentCount:Int, _ ratio:Float, _ out:UnsafeMutablePointer<Float>) {
+	var weights:(Float, Float, Float, Float) = (0, 0, 0, 0)
+	withUnsafeMutableBytes(of: &weights){ CurveBasisWeights(basis, ratio, $0.baseAddress!.assumingMemoryBound(to: Float.self)) }
+	for componentI in 0..<componentCount {
+		out[componentI] = weights.0 * points.0[componentI] + weights.1 * points.1[componentI] + weights.2 * points.2[componentI] + weights.3 * points.3[componentI]
+	}
+}
+
+@usableFromInline internal func _vucktCurveTrackPoint(_ basis:Int32, _ keyframes:UnsafePointer<Float>, _ keyframeCount:Int, _ componentCount:Int, _ stride:Int, _ time:Float, _ out:UnsafeMutablePointer<Float>) {
+	let segmentCount = CurveTrackSegmentCount(basis, keyframeCount)
+	let time = Swift.min(Swift.max(time, 0), Float(segmentCount))
+	let segment = Swift.min(Int(time), segmentCount - 1)
+	let step = (basis == VUCKT_CURVE_BASIS_HERMITE) ? 2 : (basis == VUCKT_CURVE_BASIS_CATMULL_ROM) ? 1 : 3
+	let offset = (basis == VUCKT_CURVE_BASIS_CATMULL_ROM) ? -1 : 0
+	let point:(Int) -> UnsafePointer<Float> = { keyframes + Swift.min(Swift.max(segment * step + offset + $0, 0), keyframeCount - 1) * stride }
+	_vucktCurveSegmentPoint(basis, (point(0), point(1), point(2), point(3)), componentCount, time - Float(segment), out)
+}
+
+@usableFromInline internal func _vucktCurveArcLengthTime(_ table:UnsafePointer<Float>, _ tableCount:Int, _ segmentCount:Int, _ distance:Float) -> Float {
+	var base = 0
+	while base + 2 < tableCount && table[base + 1] <= distance {
+		base += 1
+	}
+	let span = table[base + 1] - table[base]
+	let ratio = (span > 0) ? Swift.min(Swift.max((distance - table[base]) / span, 0), 1) : 0
+	return (Float(base) + ratio) * (Float(segmentCount) / Float(tableCount - 1))
+}
+
+
+
+// MARK: Easing
+
+@_alwaysEmitIntoClient public func CurveEase(_ easing:Int32, _ ratio:Float) -> Float {
+	guard easing > VUCKT_EASING_LINEAR && easing < VUCKT_EASING_COUNT else { return ratio }
+	if ratio == 0 || ratio == 1 {
+		return ratio
+	}
+	let family = (easing - 1) / 3
+	switch (easing - 1) % 3 {
+		case 0:
+			return _vucktCurveEaseIn(family, ratio, false)
+		case 1:
+			// (Circular-out as `√(t(2 - t))`; see `_CurveEaseFamilyLanes()` in Curve.h.)
+			return (family == 6) ? sqrt(ratio * (2 - ratio)) : 1 - _vucktCurveEaseIn(family, 1 - ratio, false)
+		default:
+			return (ratio < 0.5)
+				? 0.5 * _vucktCurveEaseIn(family, 2 * ratio, true)
+				: 1 - 0.5 * _vucktCurveEaseIn(family, 2 - 2 * ratio, true)
+	}
+}
+
+@_alwaysEmitIntoClient public func CurveEaseArrays(_ easing:Int32, _ ratios:UnsafePointer<Float>, _ out:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = CurveEase(easing, ratios[i])
+	}
+}
+
+
+
+// MARK: Spline Segments
+
+@_alwaysEmitIntoClient public func CurveBasisWeights(_ basis:Int32, _ ratio:Float, _ outWeights:UnsafeMutablePointer<Float>) {
+	let t = ratio, t2 = t * t, t3 = t2 * t
+	switch basis {
+		case VUCKT_CURVE_BASIS_HERMITE:
+			outWeights[0] = 2 * t3 - 3 * t2 + 1
+			outWeights[1] = t3 - 2 * t2 + t
+			outWeights[2] = 3 * t2 - 2 * t3
+			outWeights[3] = t3 - t2
+		case VUCKT_CURVE_BASIS_CATMULL_ROM:
+			outWeights[0] = 0.5 * (2 * t2 - t3 - t)
+			outWeights[1] = 0.5 * (3 * t3 - 5 * t2 + 2)
+			outWeights[2] = 0.5 * (4 * t2 - 3 * t3 + t)
+			outWeights[3] = 0.5 * (t3 - t2)
+		default:
+			let u = 1 - t
+			outWeights[0] = u * u * u
+			outWeights[1] = 3 * u * u * t
+			outWeights[2] = 3 * u * t2
+			outWeights[3] = t3
+	}
+}
+
+@_alwaysEmitIntoClient public func CurveSampleSegmentLanes(_ basis:Int32, _ controlPoints:UnsafePointer<Float>, _ componentCount:Int, _ stride:Int, _ ratios:UnsafePointer<Float>, _ out:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		_vucktCurveSegmentPoint(basis, (controlPoints, controlPoints + stride, controlPoints + 2 * stride, controlPoints + 3 * stride), componentCount, ratios[i], out + i * stride)
+	}
+}
+
+@_alwaysEmitIntoClient public func CurveEvaluateSegmentLanes(_ basis:Int32, _ controlPoints:UnsafePointer<Float>, _ componentCount:Int, _ stride:Int, _ ratios:UnsafePointer<Float>, _ out:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		CurveSampleSegmentLanes(basis, controlPoints + i * 4 * stride, componentCount, stride, ratios + i, out + i * stride, 1)
+	}
+}
+
+
+
+// MARK: Spline Tracks
+
+@_alwaysEmitIntoClient public func CurveTrackSegmentCount(_ basis:Int32, _ keyframeCount:Int) -> Int {
+	switch basis {
+		case VUCKT_CURVE_BASIS_HERMITE: return (keyframeCount >= 4) ? keyframeCount / 2 - 1 : 0
+		case VUCKT_CURVE_BASIS_CATMULL_ROM: return (keyframeCount >= 2) ? keyframeCount - 1 : 0
+		default: return (keyframeCount >= 4) ? (keyframeCount - 1) / 3 : 0
+	}
+}
+
+@_alwaysEmitIntoClient public func CurveSampleTrackLanes(_ basis:Int32, _ keyframes:UnsafePointer<Float>, _ keyframeCount:Int, _ componentCount:Int, _ stride:Int, _ times:UnsafePointer<Float>, _ out:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		_vucktCurveTrackPoint(basis, keyframes, keyframeCount, componentCount, stride, times[i], out + i * stride)
+	}
+}
+
+
+
+// MARK: Arc Length
+
+@_alwaysEmitIntoClient public func CurveArcLengthTableBuild(_ basis:Int32, _ keyframes:UnsafePointer<Float>, _ keyframeCount:Int, _ componentCount:Int, _ stride:Int, _ outTable:UnsafeMutablePointer<Float>, _ tableCount:Int) {
+	let timeScale = Float(CurveTrackSegmentCount(basis, keyframeCount)) / Float(tableCount - 1)
+	var previous:[Float] = [ 0, 0, 0, 0 ], point:[Float] = [ 0, 0, 0, 0 ]
+	var length:Float = 0
+	for entryI in 0..<tableCount {
+		_vucktCurveTrackPoint(basis, keyframes, keyframeCount, componentCount, stride, Float(entryI) * timeScale, &point)
+		if entryI > 0 {
+			length += sqrt((0..<componentCount).reduce(0){ $0 + (point[$1] - previous[$1]) * (point[$1] - previous[$1]) })
+		}
+		outTable[entryI] = length
+		previous = point
+	}
+}
+
+@_alwaysEmitIntoClient public func CurveArcLengthTimes(_ table:UnsafePointer<Float>, _ tableCount:Int, _ segmentCount:Int, _ distances:UnsafePointer<Float>, _ outTimes:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		outTimes[i] = _vucktCurveArcLengthTime(table, tableCount, segmentCount, distances[i])
+	}
+}
+
+@_alwaysEmitIntoClient public func CurveArcLengthUniformTimes(_ table:UnsafePointer<Float>, _ tableCount:Int, _ segmentCount:Int, _ outTimes:UnsafeMutablePointer<Float>, _ n:Int) {
+	let spacing = (n > 1) ? table[tableCount - 1] / Float(n - 1) : 0
+	for i in 0..<n {
+		outTimes[i] = _vucktCurveArcLengthTime(table, tableCount, segmentCount, Float(i) * spacing)
+	}
+}
+
+
+
+// MARK: Eased Rotations
+
+@_alwaysEmitIntoClient public func CurveEasedSlerpArrays(_ easing:Int32, _ from:UnsafePointer<FloatQuaternion>, _ to:UnsafePointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, _ out:UnsafeMutablePointer<FloatQuaternion>, _ n:Int, _ longest:Bool) {
+	for i in 0..<n {
+		var easedRatio = CurveEase(easing, ratios[i * ratioStride])
+		FloatQuaternionSlerpArrays(from + i, to + i, &easedRatio, 0, out + i, 1, longest)
+	}
+}
+@_alwaysEmitIntoClient public func CurveEasedBezierArrays(_ easing:Int32, _ q0:UnsafePointer<FloatQuaternion>, _ q1:UnsafePointer<FloatQuaternion>, _ q2:UnsafePointer<FloatQuaternion>, _ q3:UnsafePointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, _ out:UnsafeMutablePointer<FloatQuaternion>, _ n:Int) {
+	for i in 0..<n {
+		var easedRatio = CurveEase(easing, ratios[i * ratioStride])
+		FloatQuaternionBezierArrays(q0 + i, q1 + i, q2 + i, q3 + i, &easedRatio, 0, out + i, 1)
+	}
+}
+@_alwaysEmitIntoClient public func CurveEasedSplineArrays(_ easing:Int32, _ q0:UnsafePointer<FloatQuaternion>, _ q1:UnsafePointer<FloatQuaternion>, _ q2:UnsafePointer<FloatQuaternion>, _ q3:UnsafePointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, _ out:UnsafeMutablePointer<FloatQuaternion>, _ n:Int) {
+	for i in 0..<n {
+		var easedRatio = CurveEase(easing, ratios[i * ratioStride])
+		FloatQuaternionSplineArrays(q0 + i, q1 + i, q2 + i, q3 + i, &easedRatio, 0, out + i, 1)
+	}
+}
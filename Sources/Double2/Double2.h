@@ -0,0 +1,230 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float2.h>)
+	#import <Vuckt/Float2.h>
+#else
+	#include "../Float2/Float2.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 2-component vector of `double`s; the double-precision counterpart of `Float2`.
+struct Double2 {
+	double x, y;
+} __attribute__((aligned(__alignof__(simd_double2))));
+typedef struct Double2 Double2;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Double2` struct to `simd_double2` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_double2 Double2ToSimd(Double2 structValue) {
+	return *(simd_double2 *)&structValue;
+}
+/// Converts a `Double2` struct from `simd_double2` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Double2 Double2FromSimd(simd_double2 simdValue) {
+	return *(Double2 *)&simdValue;
+}
+
+
+
+#pragma mark SIMD-Accelerated Operator Access
+
+NS_INLINE Double2 Double2Add(Double2 a, Double2 b) {
+	return Double2FromSimd(Double2ToSimd(a) + Double2ToSimd(b));
+}
+NS_INLINE Double2 Double2Subtract(Double2 a, Double2 b) {
+	return Double2FromSimd(Double2ToSimd(a) - Double2ToSimd(b));
+}
+NS_INLINE Double2 Double2Negate(Double2 v) {
+	return Double2FromSimd(-Double2ToSimd(v));
+}
+NS_INLINE Double2 Double2Multiply(Double2 a, Double2 b) {
+	return Double2FromSimd(Double2ToSimd(a) * Double2ToSimd(b));
+}
+NS_INLINE Double2 Double2Divide(Double2 a, Double2 b) {
+	return Double2FromSimd(Double2ToSimd(a) / Double2ToSimd(b));
+}
+NS_INLINE Double2 Double2Modulus(Double2 a, Double2 b) {
+	return Double2FromSimd(vuckt_simd_fmod(Double2ToSimd(a), Double2ToSimd(b)));
+}
+NS_INLINE Double2 Double2MultiplyByScalar(Double2 v, double s) {
+	return Double2FromSimd(Double2ToSimd(v) * s);
+}
+NS_INLINE Double2 Double2MultiplyingScalar(double s, Double2 v) {
+	return Double2FromSimd(Double2ToSimd(v) * s);
+}
+NS_INLINE Double2 Double2DivideByScalar(Double2 v, double s) {
+	return Double2FromSimd(Double2ToSimd(v) / s);
+}
+NS_INLINE Double2 Double2DividingScalar(double s, Double2 v) {
+	return Double2FromSimd(s / Double2ToSimd(v));
+}
+NS_INLINE Double2 Double2ModulusByScalar(Double2 v, double s) {
+	return Double2Modulus(v, (Double2){ s, s });
+}
+NS_INLINE Double2 Double2ModulusingScalar(double s, Double2 v) {
+	return Double2Modulus((Double2){ s, s }, v);
+}
+
+NS_INLINE bool Double2LessThan(Double2 a, Double2 b) {
+	return simd_all(Double2ToSimd(a) < Double2ToSimd(b));
+}
+NS_INLINE bool Double2LessThanOrEqual(Double2 a, Double2 b) {
+	return simd_all(Double2ToSimd(a) <= Double2ToSimd(b));
+}
+NS_INLINE bool Double2GreaterThan(Double2 a, Double2 b) {
+	return simd_all(Double2ToSimd(a) > Double2ToSimd(b));
+}
+NS_INLINE bool Double2GreaterThanOrEqual(Double2 a, Double2 b) {
+	return simd_all(Double2ToSimd(a) >= Double2ToSimd(b));
+}
+
+
+
+#pragma mark Float2 Conversion
+
+/// Narrows each element to `float`, rounding to nearest.
+NS_INLINE Float2 Double2ToFloat2(Double2 value) {
+	return (Float2){ (float)value.x, (float)value.y };
+}
+/// Widens each element to `double` (exactly).
+NS_INLINE Double2 Double2FromFloat2(Float2 value) {
+	return (Double2){ value.x, value.y };
+}
+
+
+
+#pragma mark Array Operations
+
+// Element-wise operations over `n`-element arrays, for bulk passes that would otherwise pay per-element call & load overhead.
+// `out` may be the same array as an input (for in-place operation), but must not otherwise overlap one.
+// Where possible these loop over the flat `double` lanes rather than per-`Double2`, so the compiler can vectorize across elements at the target's full vector width.
+
+/// `out[i] = a[i] + b[i]`
+NS_INLINE void Double2AddArrays(const Double2 *a, const Double2 *b, Double2 *out, size_t n) {
+	const double *aLanes = (const double *)a, *bLanes = (const double *)b;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double2) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] + bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] - b[i]`
+NS_INLINE void Double2SubtractArrays(const Double2 *a, const Double2 *b, Double2 *out, size_t n) {
+	const double *aLanes = (const double *)a, *bLanes = (const double *)b;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double2) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] - bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] * b[i]`
+NS_INLINE void Double2MultiplyArrays(const Double2 *a, const Double2 *b, Double2 *out, size_t n) {
+	const double *aLanes = (const double *)a, *bLanes = (const double *)b;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double2) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] * bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] / b[i]`
+NS_INLINE void Double2DivideArrays(const Double2 *a, const Double2 *b, Double2 *out, size_t n) {
+	const double *aLanes = (const double *)a, *bLanes = (const double *)b;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double2) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] / bLanes[laneI];
+	}
+}
+/// `out[i] = fmod(a[i], b[i])`
+NS_INLINE void Double2ModulusArrays(const Double2 *a, const Double2 *b, Double2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Double2Modulus(a[i], b[i]);
+	}
+}
+/// `out[i] = -v[i]`
+NS_INLINE void Double2NegateArray(const Double2 *v, Double2 *out, size_t n) {
+	const double *vLanes = (const double *)v;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double2) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = -vLanes[laneI];
+	}
+}
+/// `out[i] = v[i] * s`
+NS_INLINE void Double2MultiplyByScalarArray(const Double2 *v, double s, Double2 *out, size_t n) {
+	const double *vLanes = (const double *)v;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double2) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = vLanes[laneI] * s;
+	}
+}
+/// `out[i] = v[i] / s`
+NS_INLINE void Double2DivideByScalarArray(const Double2 *v, double s, Double2 *out, size_t n) {
+	const double *vLanes = (const double *)v;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double2) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = vLanes[laneI] / s;
+	}
+}
+/// `out[i] = fmod(v[i], s)`
+NS_INLINE void Double2ModulusByScalarArray(const Double2 *v, double s, Double2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Double2ModulusByScalar(v[i], s);
+	}
+}
+
+
+
+#pragma mark Bulk Float2 Conversion
+
+// `out` must not overlap the input array.
+// These run over the flat lanes (2 per element on both sides), so each vector of `double`s narrows or widens in one instruction where the target has one (e.g. `cvtpd2ps`).
+
+/// `out[i] = Double2ToFloat2(values[i])`
+NS_INLINE void Double2ArrayToFloat2Array(const Double2 *values, Float2 *out, size_t n) {
+	const double *valueLanes = (const double *)values;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double2) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = (float)valueLanes[laneI];
+	}
+}
+/// `out[i] = Double2FromFloat2(values[i])`
+NS_INLINE void Double2ArrayFromFloat2Array(const Float2 *values, Double2 *out, size_t n) {
+	const float *valueLanes = (const float *)values;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double2) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = (double)valueLanes[laneI];
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,20 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Double2.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Double2, x) == sizeof(simd_double1),
+	"Double2's first member's size does not match simd_double1's on this platform.");
+static_assert(sizeof(Double2) == sizeof(simd_double2),
+	"Double2's size does not match simd_double2's on this platform.");
+static_assert(sizeof_member(Double2, x) == sizeof_member(simd_double2, x),
+	"Double2's first member's size does not match simd_double2's first member's on this platform.");
+static_assert(alignof(Double2) == alignof(simd_double2),
+	"Double2's alignment requirements does not match simd_double2's on this platform.");
+static_assert(sizeof(Double2) / sizeof(double) == sizeof(Float2) / sizeof(float),
+	"Double2's lane count does not match Float2's on this platform (which the bulk conversions rely on).");
@@ -0,0 +1,474 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension Double2
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements.
+	@_transparent public init(_ x:Double, _ y:Double) {
+		self.init(x: x, y: y)
+	}
+	
+	/// Initialize to a vector with all elements equal to `scalar`.
+	@_transparent public init(scalar:Double) {
+		self.init(scalar, scalar)
+	}
+	/// Alias of: `init(scalar:)`
+	@_transparent public init(_ scalar:Double) { self.init(scalar: scalar) }
+	
+	/// Initialize to a SIMD vector.
+	@_transparent public init(_ value:simd_double2) {
+		self = Double2FromSimd(value)
+	}
+	
+	/// Initialize from an `Int2` value (exactly).
+	@_transparent public init(_ int2Value:Int2) {
+		self.init(Double(int2Value.x), Double(int2Value.y))
+	}
+	
+	/// Initialize from a `Float2` value, widening each element (exactly).
+	@_transparent public init(_ float2Value:Float2) {
+		self = Double2FromFloat2(float2Value)
+	}
+	
+	/// Initialize to a vector with elements taken from `array`.
+	///
+	/// - Precondition: `array` must have exactly two elements.
+	@_transparent public init(array:[Double]) {
+		precondition(array.count == 2)
+		self.init(array[0], array[1])
+	}
+	
+	/// Initialize using the given 2-element tuple.
+	@_transparent public init(tuple:(x:Double,y:Double)) {
+		self.init(tuple.x, tuple.y)
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Double2 { return Double2(scalar: 0) }
+	
+	@_transparent public static var one:Double2 { return Self.positiveOne }
+	@_transparent public static var positiveOne:Double2 { return Double2(scalar: 1) }
+	@_transparent public static var negativeOne:Double2 { return Double2(scalar: -1) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	@_transparent public var asTuple:(x:Double,y:Double) {
+		return ( self.x, self.y )
+	}
+	
+	@_transparent public var asArray:[Double] {
+		return [ self.x, self.y ]
+	}
+	
+	/// Each element narrowed to `Float`, rounding to nearest.  (For positions far from the origin, prefer rebasing relative to a nearby origin first.)
+	@_transparent public var float2Value:Float2 {
+		return Double2ToFloat2(self)
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	@_transparent public var simdValue:simd_double2 {
+		return Double2ToSimd(self)
+	}
+	
+	
+	// MARK: Is… Flags
+	
+	@_transparent public var isFinite:Bool {
+		return self.x.isFinite && self.y.isFinite
+	}
+	@_transparent public var isInfinite:Bool {
+		return self.x.isInfinite || self.y.isInfinite
+	}
+	@_transparent public var isNaN:Bool {
+		return self.x.isNaN || self.y.isNaN
+	}
+	@_transparent public var isZero:Bool {
+		return self == Self.zero
+	}
+}
+
+
+extension Float2
+{
+	/// Initialize from a `Double2` value, narrowing each element (rounding to nearest).
+	@_transparent public init(_ double2Value:Double2) {
+		self = Double2ToFloat2(double2Value)
+	}
+}
+
+
+extension Double2 : CustomStringConvertible
+{
+	public var description:String {
+		return "(\(self.x), \(self.y))"
+	}
+}
+
+
+// MARK: Element-wise `min`/`max`
+
+@_transparent public func min(_ a:Double2, _ b:Double2) -> Double2 {
+	return Double2(simd_min(a.simdValue, b.simdValue))
+}
+
+@_transparent public func max(_ a:Double2, _ b:Double2) -> Double2 {
+	return Double2(simd_max(a.simdValue, b.simdValue))
+}
+
+
+extension Double2 : ExpressibleByArrayLiteral
+{
+	public typealias Element = Double
+	
+	/// Initialize using `arrayLiteral`.
+	///
+	/// - Precondition: the array literal must exactly two elements.
+	@_transparent public init(arrayLiteral elements:Double...) {
+		precondition(elements.count == 2)
+		self.init(elements[0], elements[1])
+	}
+}
+
+
+extension Double2 : Equatable
+{
+	@_transparent public static func ==(a:Double2, b:Double2) -> Bool {
+		return simd_equal(a.simdValue, b.simdValue)
+	}
+}
+
+
+extension Double2 : Comparable
+{
+	@_transparent public static func < (a:Double2, b:Double2) -> Bool {
+		return Double2LessThan(a, b)
+	}
+	
+	@_transparent public static func <= (a:Double2, b:Double2) -> Bool {
+		return Double2LessThanOrEqual(a, b)
+	}
+	
+	@_transparent public static func > (a:Double2, b:Double2) -> Bool {
+		return Double2GreaterThan(a, b)
+	}
+	
+	@_transparent public static func >= (a:Double2, b:Double2) -> Bool {
+		return Double2GreaterThanOrEqual(a, b)
+	}
+}
+
+
+extension Double2 // Basic Math Operations
+{
+	@_transparent public static func + (a:Double2, b:Double2) -> Double2 {
+		return Double2Add(a, b)
+	}
+	@_transparent public static func += (v:inout Double2, o:Double2) {
+		v = v + o
+	}
+	
+	
+	@_transparent public static func - (a:Double2, b:Double2) -> Double2 {
+		return Double2Subtract(a, b)
+	}
+	@_transparent public static func -= (v:inout Double2, o:Double2) {
+		v = v - o
+	}
+	
+	
+	@_transparent public static func * (a:Double2, b:Double2) -> Double2 {
+		return Double2Multiply(a, b)
+	}
+	@_transparent public static func *= (v:inout Double2, o:Double2) {
+		v = v * o
+	}
+	
+	
+	@_transparent public static func / (a:Double2, b:Double2) -> Double2 {
+		return Double2Divide(a, b)
+	}
+	@_transparent public static func /= (v:inout Double2, o:Double2) {
+		v = v / o
+	}
+	
+	
+	@_transparent public static func % (a:Double2, b:Double2) -> Double2 {
+		return Double2Modulus(a, b)
+	}
+	@_transparent public static func %= (v:inout Double2, o:Double2) {
+		v = v % o
+	}
+	
+	
+	@_transparent public static func * (v:Double2, scale:Double) -> Double2 {
+		return Double2MultiplyByScalar(v, scale)
+	}
+	@_transparent public static func *= (v:inout Double2, scale:Double) {
+		v = v * scale
+	}
+	@_transparent public static func * (scale:Double, v:Double2) -> Double2 {
+		return Double2MultiplyingScalar(scale, v)
+	}
+	
+	
+	@_transparent public static func / (v:Double2, inverseScale:Double) -> Double2 {
+		return Double2DivideByScalar(v, inverseScale)
+	}
+	@_transparent public static func /= (v:inout Double2, inverseScale:Double) {
+		v = v / inverseScale
+	}
+	@_transparent public static func / (inverseScale:Double, v:Double2) -> Double2 {
+		return Double2DividingScalar(inverseScale, v)
+	}
+	
+	
+	@_transparent public static func % (v:Double2, inverseScale:Double) -> Double2 {
+		return Double2ModulusByScalar(v, inverseScale)
+	}
+	@_transparent public static func %= (v:inout Double2, inverseScale:Double) {
+		v = v % inverseScale
+	}
+	@_transparent public static func % (inverseScale:Double, v:Double2) -> Double2 {
+		return Double2ModulusingScalar(inverseScale, v)
+	}
+	
+	
+	@_transparent public static prefix func - (v:Double2) -> Double2 { return v.negated() }
+	@_transparent public func negated() -> Double2 {
+		return Double2Negate(self)
+	}
+	@_transparent public mutating func negate() {
+		self = self.negated()
+	}
+	
+	
+	@_transparent public func reciprocal() -> Double2 {
+		return Double2(simd_recip(self.simdValue))
+	}
+	@_transparent public mutating func formReciprocal() {
+		self = self.reciprocal()
+	}
+}
+
+
+extension Double2 // Geometric Math Operations
+{
+	/// Produces a unit-length vector.  (Not to be confused with a “normal”/“normal vector”.)
+	/// See: https://mathworld.wolfram.com/NormalVector.html
+	@_transparent public func normalized() -> Double2 {
+		return Double2(simd_normalize(self.simdValue))
+	}
+	/// Modifies the vector to be unit-length.  (Not to be confused with a “normal”/“normal vector”.)
+	/// See: https://mathworld.wolfram.com/NormalVector.html
+	@_transparent public mutating func normalize() {
+		self = self.normalized()
+	}
+	
+	
+	@_transparent public func length() -> Double {
+		return simd_length(self.simdValue)
+	}
+	/// Alias of: `length()`
+	@_transparent public func magnitude() -> Double { return self.length() }
+	
+	@_transparent public func lengthSquared() -> Double {
+		return simd_length_squared(self.simdValue)
+	}
+	/// Alias of: `lengthSquared()`
+	@_transparent public func magnitudeSquared() -> Double { return self.lengthSquared() }
+	
+	
+	/// Also known as the Interior Product.
+	@_transparent public func dotProduct(_ other:Double2) -> Double {
+		return simd_dot(self.simdValue, other.simdValue)
+	}
+	
+	
+	@_transparent public func mixed(with other:Double2, ratio:Double) -> Double2 {
+		return Double2(simd_mix(self.simdValue, other.simdValue, simd_double2(repeating: ratio)))
+	}
+	@_transparent public mutating func mix(with other:Double2, ratio:Double) {
+		self = self.mixed(with: other, ratio: ratio)
+	}
+}
+
+@_transparent public func distanceBetween(_ a:Double2, _ b:Double2) -> Double {
+	return simd_distance(a.simdValue, b.simdValue)
+}
+@_transparent public func distanceSquaredBetween(_ a:Double2, _ b:Double2) -> Double {
+	return simd_distance_squared(a.simdValue, b.simdValue)
+}
+
+
+extension UnsafeBufferPointer where Element == Double2 // Bulk Math Operations
+{
+	/// Element-wise `self[i] + other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func add(_ other:UnsafeBufferPointer<Double2>, into out:UnsafeMutableBufferPointer<Double2>) {
+		self._vucktBulkOperation(other, into: out, Double2AddArrays)
+	}
+	/// Element-wise `self[i] - other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func subtract(_ other:UnsafeBufferPointer<Double2>, into out:UnsafeMutableBufferPointer<Double2>) {
+		self._vucktBulkOperation(other, into: out, Double2SubtractArrays)
+	}
+	/// Element-wise `self[i] * other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func multiply(by other:UnsafeBufferPointer<Double2>, into out:UnsafeMutableBufferPointer<Double2>) {
+		self._vucktBulkOperation(other, into: out, Double2MultiplyArrays)
+	}
+	/// Element-wise `self[i] / other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func divide(by other:UnsafeBufferPointer<Double2>, into out:UnsafeMutableBufferPointer<Double2>) {
+		self._vucktBulkOperation(other, into: out, Double2DivideArrays)
+	}
+	/// Element-wise `self[i] % other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:UnsafeBufferPointer<Double2>, into out:UnsafeMutableBufferPointer<Double2>) {
+		self._vucktBulkOperation(other, into: out, Double2ModulusArrays)
+	}
+	/// Element-wise `-self[i]`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func negate(into out:UnsafeMutableBufferPointer<Double2>) {
+		self._vucktBulkOperation(into: out, Double2NegateArray)
+	}
+	/// Element-wise `self[i] * scale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func multiply(by scale:Double, into out:UnsafeMutableBufferPointer<Double2>) {
+		self._vucktBulkOperation(scale, into: out, Double2MultiplyByScalarArray)
+	}
+	/// Element-wise `self[i] / inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func divide(by inverseScale:Double, into out:UnsafeMutableBufferPointer<Double2>) {
+		self._vucktBulkOperation(inverseScale, into: out, Double2DivideByScalarArray)
+	}
+	/// Element-wise `self[i] % inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Double, into out:UnsafeMutableBufferPointer<Double2>) {
+		self._vucktBulkOperation(inverseScale, into: out, Double2ModulusByScalarArray)
+	}
+}
+
+extension Array where Element == Double2 // Bulk Math Operations
+{
+	@_alwaysEmitIntoClient public func adding(_ other:[Double2]) -> [Double2] {
+		return self._vucktBulkOperation(other, Double2AddArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func add(_ other:[Double2]) {
+		self._vucktFormBulkOperation(other, Double2AddArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func subtracting(_ other:[Double2]) -> [Double2] {
+		return self._vucktBulkOperation(other, Double2SubtractArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func subtract(_ other:[Double2]) {
+		self._vucktFormBulkOperation(other, Double2SubtractArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by other:[Double2]) -> [Double2] {
+		return self._vucktBulkOperation(other, Double2MultiplyArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by other:[Double2]) {
+		self._vucktFormBulkOperation(other, Double2MultiplyArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by other:[Double2]) -> [Double2] {
+		return self._vucktBulkOperation(other, Double2DivideArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by other:[Double2]) {
+		self._vucktFormBulkOperation(other, Double2DivideArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:[Double2]) -> [Double2] {
+		return self._vucktBulkOperation(other, Double2ModulusArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy other:[Double2]) {
+		self._vucktFormBulkOperation(other, Double2ModulusArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func negated() -> [Double2] {
+		return self._vucktBulkOperation(Double2NegateArray)
+	}
+	@_alwaysEmitIntoClient public mutating func negate() {
+		self._vucktFormBulkOperation(Double2NegateArray)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by scale:Double) -> [Double2] {
+		return self._vucktBulkOperation(scale, Double2MultiplyByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by scale:Double) {
+		self._vucktFormBulkOperation(scale, Double2MultiplyByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by inverseScale:Double) -> [Double2] {
+		return self._vucktBulkOperation(inverseScale, Double2DivideByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by inverseScale:Double) {
+		self._vucktFormBulkOperation(inverseScale, Double2DivideByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Double) -> [Double2] {
+		return self._vucktBulkOperation(inverseScale, Double2ModulusByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy inverseScale:Double) {
+		self._vucktFormBulkOperation(inverseScale, Double2ModulusByScalarArray)
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == Double2 // Bulk Conversion
+{
+	/// Narrows every element into `out` (rounding to nearest).  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkConversion(into: out, Double2ArrayToFloat2Array)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float2 // Bulk Conversion
+{
+	/// Widens every element into `out` (exactly).  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Double2>) {
+		self._vucktBulkConversion(into: out, Double2ArrayFromFloat2Array)
+	}
+}
+
+extension Array where Element == Float2
+{
+	/// Narrows an array of `Double2`s (rounding to nearest).
+	@_alwaysEmitIntoClient public init(_ double2Values:[Double2]) {
+		self = double2Values._vucktBulkConversion(Double2ArrayToFloat2Array)
+	}
+}
+
+extension Array where Element == Double2
+{
+	/// Widens an array of `Float2`s (exactly).
+	@_alwaysEmitIntoClient public init(_ float2Values:[Float2]) {
+		self = float2Values._vucktBulkConversion(Double2ArrayFromFloat2Array)
+	}
+}
+
+
+extension Double2 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			self.asArray.forEach{ hasher.combine($0) }
+		}
+	#else
+		public var hashValue:Int {
+			return self.asArray.reduce(0){ $0 &* 31 &+ $1.hashValue }
+		}
+	#endif
+}
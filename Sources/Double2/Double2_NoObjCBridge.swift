@@ -0,0 +1,172 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Double2
+{
+	public var x:Double
+	public var y:Double
+	
+	public init() {
+		self.x = Double()
+		self.y = Double()
+	}
+	
+	public init(x:Double, y:Double) {
+		self.x = x
+		self.y = y
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Double2` struct to `simd_double2` vector using passing-individual-members initialization.
+@_transparent public func Double2ToSimd(_ structValue:Double2) -> simd_double2 {
+	return simd_double2(structValue.x, structValue.y)
+}
+/// Converts a `Double2` struct from `simd_double2` vector using passing-individual-members initialization.
+@_transparent public func Double2FromSimd(_ simdValue:simd_double2) -> Double2 {
+	return Double2(x: simdValue.x, y: simdValue.y)
+}
+
+
+
+// MARK: SIMD-Accelerated Operator Access
+
+@_transparent public func Double2Add(_ a:Double2, _ b:Double2) -> Double2 {
+	return Double2FromSimd(Double2ToSimd(a) + Double2ToSimd(b))
+}
+@_transparent public func Double2Subtract(_ a:Double2, _ b:Double2) -> Double2 {
+	return Double2FromSimd(Double2ToSimd(a) - Double2ToSimd(b))
+}
+@_transparent public func Double2Negate(_ v:Double2) -> Double2 {
+	return Double2FromSimd(-Double2ToSimd(v))
+}
+@_transparent public func Double2Multiply(_ a:Double2, _ b:Double2) -> Double2 {
+	return Double2FromSimd(Double2ToSimd(a) * Double2ToSimd(b))
+}
+@_transparent public func Double2Divide(_ a:Double2, _ b:Double2) -> Double2 {
+	return Double2FromSimd(Double2ToSimd(a) / Double2ToSimd(b))
+}
+@_transparent public func Double2Modulus(_ a:Double2, _ b:Double2) -> Double2 {
+	return Double2(x: a.x.truncatingRemainder(dividingBy: b.x), y: a.y.truncatingRemainder(dividingBy: b.y))
+}
+@_transparent public func Double2MultiplyByScalar(_ v:Double2, _ s:Double) -> Double2 {
+	return Double2FromSimd(Double2ToSimd(v) * s)
+}
+@_transparent public func Double2MultiplyingScalar(_ s:Double, _ v:Double2) -> Double2 {
+	return Double2FromSimd(Double2ToSimd(v) * s)
+}
+@_transparent public func Double2DivideByScalar(_ v:Double2, _ s:Double) -> Double2 {
+	return Double2FromSimd(Double2ToSimd(v) / s)
+}
+@_transparent public func Double2DividingScalar(_ s:Double, _ v:Double2) -> Double2 {
+	return Double2FromSimd(s / Double2ToSimd(v))
+}
+@_transparent public func Double2ModulusByScalar(_ v:Double2, _ s:Double) -> Double2 {
+	return Double2Modulus(v, Double2(x: s, y: s))
+}
+@_transparent public func Double2ModulusingScalar(_ s:Double, _ v:Double2) -> Double2 {
+	return Double2Modulus(Double2(x: s, y: s), v)
+}
+
+@_alwaysEmitIntoClient public func Double2LessThan(_ a:Double2, _ b:Double2) -> Bool {
+	return all(a.simdValue .< b.simdValue)
+}
+@_alwaysEmitIntoClient public func Double2LessThanOrEqual(_ a:Double2, _ b:Double2) -> Bool {
+	return all(a.simdValue .<= b.simdValue)
+}
+@_alwaysEmitIntoClient public func Double2GreaterThan(_ a:Double2, _ b:Double2) -> Bool {
+	return all(a.simdValue .> b.simdValue)
+}
+@_alwaysEmitIntoClient public func Double2GreaterThanOrEqual(_ a:Double2, _ b:Double2) -> Bool {
+	return all(a.simdValue .>= b.simdValue)
+}
+
+
+
+// MARK: Float2 Conversion
+
+@_transparent public func Double2ToFloat2(_ value:Double2) -> Float2 {
+	return Float2(x: Float(value.x), y: Float(value.y))
+}
+@_transparent public func Double2FromFloat2(_ value:Float2) -> Double2 {
+	return Double2(x: Double(value.x), y: Double(value.y))
+}
+
+
+
+// MARK: Array Operations
+
+@_alwaysEmitIntoClient public func Double2AddArrays(_ a:UnsafePointer<Double2>, _ b:UnsafePointer<Double2>, _ out:UnsafeMutablePointer<Double2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2Add(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double2SubtractArrays(_ a:UnsafePointer<Double2>, _ b:UnsafePointer<Double2>, _ out:UnsafeMutablePointer<Double2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2Subtract(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double2MultiplyArrays(_ a:UnsafePointer<Double2>, _ b:UnsafePointer<Double2>, _ out:UnsafeMutablePointer<Double2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2Multiply(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double2DivideArrays(_ a:UnsafePointer<Double2>, _ b:UnsafePointer<Double2>, _ out:UnsafeMutablePointer<Double2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2Divide(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double2ModulusArrays(_ a:UnsafePointer<Double2>, _ b:UnsafePointer<Double2>, _ out:UnsafeMutablePointer<Double2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2Modulus(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double2NegateArray(_ v:UnsafePointer<Double2>, _ out:UnsafeMutablePointer<Double2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2Negate(v[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double2MultiplyByScalarArray(_ v:UnsafePointer<Double2>, _ s:Double, _ out:UnsafeMutablePointer<Double2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2MultiplyByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Double2DivideByScalarArray(_ v:UnsafePointer<Double2>, _ s:Double, _ out:UnsafeMutablePointer<Double2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2DivideByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Double2ModulusByScalarArray(_ v:UnsafePointer<Double2>, _ s:Double, _ out:UnsafeMutablePointer<Double2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2ModulusByScalar(v[i], s)
+	}
+}
+
+
+
+// MARK: Bulk Float2 Conversion
+
+@_alwaysEmitIntoClient public func Double2ArrayToFloat2Array(_ values:UnsafePointer<Double2>, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2ToFloat2(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double2ArrayFromFloat2Array(_ values:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Double2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double2FromFloat2(values[i])
+	}
+}
@@ -0,0 +1,280 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+#if __has_include(<Vuckt/PackedFloat3.h>)
+	#import <Vuckt/PackedFloat3.h>
+#else
+	#include "../PackedFloat3/PackedFloat3.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 3-component vector of `double`s, for values past where `Float3` keeps enough precision— e.g. positions in a large world, which `float` only resolves to ~1 mm out to ~16 km from the origin.
+/// Rebase to `Float3` relative to a nearby origin (e.g. the camera) for rendering & bulk math, with `Double3RebaseArrayToFloat3Array()`.
+struct Double3 { // @expected: Padding size of 'Double3' with 8 bytes to alignment boundary
+	double x, y, z;
+} __attribute__((aligned(__alignof__(simd_double3))));
+typedef struct Double3 Double3;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Double3` struct to `simd_double3` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_double3 Double3ToSimd(Double3 structValue) {
+	#if VUCKT_SIMD3_IS_SIMD4
+		simd_double3 simdValue;
+		memcpy(&simdValue, &structValue, sizeof simdValue);
+		return __builtin_shuffle(simdValue, (simd_long3){ 0, 1, 2, 2 });
+	#else
+		return *(simd_double3 *)&structValue;
+	#endif
+}
+/// Converts a `Double3` struct from `simd_double3` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Double3 Double3FromSimd(simd_double3 simdValue) {
+	#if VUCKT_SIMD3_IS_SIMD4
+		Double3 structValue;
+		memcpy(&structValue, &simdValue, sizeof structValue);
+		return structValue;
+	#else
+		return *(Double3 *)&simdValue;
+	#endif
+}
+
+
+
+#pragma mark SIMD-Accelerated Operator Access
+
+NS_INLINE Double3 Double3Add(Double3 a, Double3 b) {
+	return Double3FromSimd(Double3ToSimd(a) + Double3ToSimd(b));
+}
+NS_INLINE Double3 Double3Subtract(Double3 a, Double3 b) {
+	return Double3FromSimd(Double3ToSimd(a) - Double3ToSimd(b));
+}
+NS_INLINE Double3 Double3Negate(Double3 v) {
+	return Double3FromSimd(-Double3ToSimd(v));
+}
+NS_INLINE Double3 Double3Multiply(Double3 a, Double3 b) {
+	return Double3FromSimd(Double3ToSimd(a) * Double3ToSimd(b));
+}
+NS_INLINE Double3 Double3Divide(Double3 a, Double3 b) {
+	return Double3FromSimd(Double3ToSimd(a) / Double3ToSimd(b));
+}
+NS_INLINE Double3 Double3Modulus(Double3 a, Double3 b) {
+	return Double3FromSimd(vuckt_simd_fmod(Double3ToSimd(a), Double3ToSimd(b)));
+}
+NS_INLINE Double3 Double3MultiplyByScalar(Double3 v, double s) {
+	return Double3FromSimd(Double3ToSimd(v) * s);
+}
+NS_INLINE Double3 Double3MultiplyingScalar(double s, Double3 v) {
+	return Double3FromSimd(Double3ToSimd(v) * s);
+}
+NS_INLINE Double3 Double3DivideByScalar(Double3 v, double s) {
+	return Double3FromSimd(Double3ToSimd(v) / s);
+}
+NS_INLINE Double3 Double3DividingScalar(double s, Double3 v) {
+	return Double3FromSimd(s / Double3ToSimd(v));
+}
+NS_INLINE Double3 Double3ModulusByScalar(Double3 v, double s) {
+	return Double3Modulus(v, (Double3){ s, s, s });
+}
+NS_INLINE Double3 Double3ModulusingScalar(double s, Double3 v) {
+	return Double3Modulus((Double3){ s, s, s }, v);
+}
+
+NS_INLINE bool Double3LessThan(Double3 a, Double3 b) {
+	return simd_all(Double3ToSimd(a) < Double3ToSimd(b));
+}
+NS_INLINE bool Double3LessThanOrEqual(Double3 a, Double3 b) {
+	return simd_all(Double3ToSimd(a) <= Double3ToSimd(b));
+}
+NS_INLINE bool Double3GreaterThan(Double3 a, Double3 b) {
+	return simd_all(Double3ToSimd(a) > Double3ToSimd(b));
+}
+NS_INLINE bool Double3GreaterThanOrEqual(Double3 a, Double3 b) {
+	return simd_all(Double3ToSimd(a) >= Double3ToSimd(b));
+}
+
+NS_INLINE Double3 Double3WedgeProduct(Double3 a, Double3 b) {
+	return (Double3){ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+
+
+#pragma mark Float3 Conversion
+
+/// Narrows each element to `float`, rounding to nearest.
+NS_INLINE Float3 Double3ToFloat3(Double3 value) {
+	return (Float3){ (float)value.x, (float)value.y, (float)value.z };
+}
+/// Widens each element to `double` (exactly).
+NS_INLINE Double3 Double3FromFloat3(Float3 value) {
+	return (Double3){ value.x, value.y, value.z };
+}
+
+
+
+#pragma mark Array Operations
+
+// Element-wise operations over `n`-element arrays, for bulk passes that would otherwise pay per-element call & load overhead.
+// `out` may be the same array as an input (for in-place operation), but must not otherwise overlap one.
+// Each runs on whole elements' 4-lane storage, which for `Double3` is already a full AVX vector (& a pair of SSE or NEON ones).
+// Padding lanes are loaded as `0` (`1` for divisors), so nothing uninitialized is ever operated on, & `out`'s padding lanes keep their values.
+
+/// Loads `element`'s 4-lane storage, its padding lane as `padding`.
+NS_INLINE simd_double4 _Double3LoadLanes(const Double3 *element, double padding) {
+	const simd_long4 dataLanes = { -1, -1, -1, 0 };
+	simd_double4 lanes;
+	memcpy(&lanes, element, sizeof lanes);
+	return (simd_double4)(((simd_long4)lanes & dataLanes) | ((simd_long4)(simd_double4){ padding, padding, padding, padding } & ~dataLanes));
+}
+/// Stores `lanes` to `element`'s storage, but for its padding lane, which keeps its value.
+NS_INLINE void _Double3StoreLanes(Double3 *element, simd_double4 lanes) {
+	const simd_long4 dataLanes = { -1, -1, -1, 0 };
+	simd_double4 original;
+	memcpy(&original, element, sizeof original);
+	lanes = (simd_double4)(((simd_long4)lanes & dataLanes) | ((simd_long4)original & ~dataLanes));
+	memcpy(element, &lanes, sizeof lanes);
+}
+
+/// `out[i] = a[i] + b[i]`
+NS_INLINE void Double3AddArrays(const Double3 *a, const Double3 *b, Double3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		_Double3StoreLanes(&out[i], _Double3LoadLanes(&a[i], 0) + _Double3LoadLanes(&b[i], 0));
+	}
+}
+/// `out[i] = a[i] - b[i]`
+NS_INLINE void Double3SubtractArrays(const Double3 *a, const Double3 *b, Double3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		_Double3StoreLanes(&out[i], _Double3LoadLanes(&a[i], 0) - _Double3LoadLanes(&b[i], 0));
+	}
+}
+/// `out[i] = a[i] * b[i]`
+NS_INLINE void Double3MultiplyArrays(const Double3 *a, const Double3 *b, Double3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		_Double3StoreLanes(&out[i], _Double3LoadLanes(&a[i], 0) * _Double3LoadLanes(&b[i], 0));
+	}
+}
+/// `out[i] = a[i] / b[i]`
+NS_INLINE void Double3DivideArrays(const Double3 *a, const Double3 *b, Double3 *out, size_t n) {
+	// (Each padding lane is divided by 1, never by 0.)
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		_Double3StoreLanes(&out[i], _Double3LoadLanes(&a[i], 0) / _Double3LoadLanes(&b[i], 1));
+	}
+}
+/// `out[i] = fmod(a[i], b[i])`
+NS_INLINE void Double3ModulusArrays(const Double3 *a, const Double3 *b, Double3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Double3Modulus(a[i], b[i]);
+	}
+}
+/// `out[i] = -v[i]`
+NS_INLINE void Double3NegateArray(const Double3 *v, Double3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		_Double3StoreLanes(&out[i], -_Double3LoadLanes(&v[i], 0));
+	}
+}
+/// `out[i] = v[i] * s`
+NS_INLINE void Double3MultiplyByScalarArray(const Double3 *v, double s, Double3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		_Double3StoreLanes(&out[i], _Double3LoadLanes(&v[i], 0) * s);
+	}
+}
+/// `out[i] = v[i] / s`
+NS_INLINE void Double3DivideByScalarArray(const Double3 *v, double s, Double3 *out, size_t n) {
+	// (Each padding lane is divided by 1, never by 0.)
+	const simd_double4 divisor = { s, s, s, 1 };
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		_Double3StoreLanes(&out[i], _Double3LoadLanes(&v[i], 0) / divisor);
+	}
+}
+/// `out[i] = fmod(v[i], s)`
+NS_INLINE void Double3ModulusByScalarArray(const Double3 *v, double s, Double3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Double3ModulusByScalar(v[i], s);
+	}
+}
+
+
+
+#pragma mark Bulk Float3 Conversion
+
+// `out` must not overlap the input array.
+// These run on each element's whole 4-lane storage (as the array operations above do), so each vector of `double`s narrows or widens in one instruction where the target has one (e.g. `cvtpd2ps`); padding lanes are loaded as `0`, & `out`'s keep their values.
+
+/// `out[i] = Double3ToFloat3(values[i])`
+NS_INLINE void Double3ArrayToFloat3Array(const Double3 *values, Float3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		_Float3StoreLanes(&out[i], __builtin_convertvector(_Double3LoadLanes(&values[i], 0), simd_float4));
+	}
+}
+/// `out[i] = Double3FromFloat3(values[i])`
+NS_INLINE void Double3ArrayFromFloat3Array(const Float3 *values, Double3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		_Double3StoreLanes(&out[i], __builtin_convertvector(_Float3LoadLanes(&values[i], 0), simd_double4));
+	}
+}
+
+
+
+#pragma mark Origin Rebasing
+
+// Camera-relative (“floating origin”) conversion for large worlds: positions stay `Double3`s, and each frame are rebased to `Float3`s relative to an origin near the viewer (typically the camera's position).
+// Subtracting in `double` before narrowing spends all of `float`'s precision on the offset from the origin, which is small for everything near enough to see in detail.
+// (Pair with `Double4x4RebaseViewToFloat4x4()`, which rebases the view matrix to the same origin.)
+// `out` must not overlap the input array.
+
+/// `out[i] = Double3ToFloat3(points[i] - origin)`, in one pass.
+NS_INLINE void Double3RebaseArrayToFloat3Array(const Double3 *points, Double3 origin, Float3 *out, size_t n) {
+	// Each element as one 4-lane subtract & one narrowing conversion.
+	const simd_double4 originLanes = { origin.x, origin.y, origin.z, 0 };
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		_Float3StoreLanes(&out[i], __builtin_convertvector(_Double3LoadLanes(&points[i], 0) - originLanes, simd_float4));
+	}
+}
+/// `out[i] = PackedFloat3FromFloat3(Double3ToFloat3(points[i] - origin))`, in one pass; for writing straight into tightly-packed vertex buffers.
+NS_INLINE void Double3RebaseArrayToPackedFloat3Array(const Double3 *points, Double3 origin, PackedFloat3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = (PackedFloat3){ (float)(points[i].x - origin.x), (float)(points[i].y - origin.y), (float)(points[i].z - origin.z) };
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
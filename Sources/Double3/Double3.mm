@@ -0,0 +1,20 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Double3.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Double3, x) == sizeof(simd_double1),
+	"Double3's first member's size does not match simd_double1's on this platform.");
+static_assert(sizeof(Double3) == sizeof(simd_double3),
+	"Double3's size does not match simd_double3's on this platform.");
+static_assert(sizeof_member(Double3, x) == sizeof_member(simd_double3, x),
+	"Double3's first member's size does not match simd_double3's first member's on this platform.");
+static_assert(alignof(Double3) == alignof(simd_double3),
+	"Double3's alignment requirements does not match simd_double3's on this platform.");
+static_assert(sizeof(Double3) / sizeof(double) == sizeof(Float3) / sizeof(float),
+	"Double3's lane count does not match Float3's on this platform (which the bulk conversions rely on).");
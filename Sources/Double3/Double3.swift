@@ -0,0 +1,502 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension Double3
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements.
+	@_transparent public init(_ x:Double, _ y:Double, _ z:Double) {
+		self.init(x: x, y: y, z: z)
+	}
+	
+	/// Initialize to a vector with all elements equal to `scalar`.
+	@_transparent public init(scalar:Double) {
+		self.init(scalar, scalar, scalar)
+	}
+	/// Alias of: `init(scalar:)`
+	@_transparent public init(_ scalar:Double) { self.init(scalar: scalar) }
+	
+	/// Initialize to a SIMD vector.
+	@_transparent public init(_ value:simd_double3) {
+		self = Double3FromSimd(value)
+	}
+	
+	/// Initialize from an `Int3` value (exactly).
+	@_transparent public init(_ int3Value:Int3) {
+		self.init(Double(int3Value.x), Double(int3Value.y), Double(int3Value.z))
+	}
+	
+	/// Initialize from a `Float3` value, widening each element (exactly).
+	@_transparent public init(_ float3Value:Float3) {
+		self = Double3FromFloat3(float3Value)
+	}
+	
+	/// Initialize to a vector with elements taken from `array`.
+	///
+	/// - Precondition: `array` must have exactly three elements.
+	@_transparent public init(array:[Double]) {
+		precondition(array.count == 3)
+		self.init(array[0], array[1], array[2])
+	}
+	
+	/// Initialize using the given 3-element tuple.
+	@_transparent public init(tuple:(x:Double,y:Double,z:Double)) {
+		self.init(tuple.x, tuple.y, tuple.z)
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Double3 { return Double3(scalar: 0) }
+	
+	@_transparent public static var one:Double3 { return Self.positiveOne }
+	@_transparent public static var positiveOne:Double3 { return Double3(scalar: 1) }
+	@_transparent public static var negativeOne:Double3 { return Double3(scalar: -1) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	@_transparent public var asTuple:(x:Double,y:Double,z:Double) {
+		return ( self.x, self.y, self.z )
+	}
+	
+	@_transparent public var asArray:[Double] {
+		return [ self.x, self.y, self.z ]
+	}
+	
+	/// Each element narrowed to `Float`, rounding to nearest.  (For positions far from the origin, prefer rebasing relative to a nearby origin first.)
+	@_transparent public var float3Value:Float3 {
+		return Double3ToFloat3(self)
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	@_transparent public var simdValue:simd_double3 {
+		return Double3ToSimd(self)
+	}
+	
+	
+	// MARK: Is… Flags
+	
+	@_transparent public var isFinite:Bool {
+		return self.x.isFinite && self.y.isFinite && self.z.isFinite
+	}
+	@_transparent public var isInfinite:Bool {
+		return self.x.isInfinite || self.y.isInfinite || self.z.isInfinite
+	}
+	@_transparent public var isNaN:Bool {
+		return self.x.isNaN || self.y.isNaN || self.z.isNaN
+	}
+	@_transparent public var isZero:Bool {
+		return self == Self.zero
+	}
+}
+
+
+extension Float3
+{
+	/// Initialize from a `Double3` value, narrowing each element (rounding to nearest).
+	@_transparent public init(_ double3Value:Double3) {
+		self = Double3ToFloat3(double3Value)
+	}
+}
+
+
+extension Double3 : CustomStringConvertible
+{
+	public var description:String {
+		return "(\(self.x), \(self.y), \(self.z))"
+	}
+}
+
+
+// MARK: Element-wise `min`/`max`
+
+@_transparent public func min(_ a:Double3, _ b:Double3) -> Double3 {
+	return Double3(simd_min(a.simdValue, b.simdValue))
+}
+
+@_transparent public func max(_ a:Double3, _ b:Double3) -> Double3 {
+	return Double3(simd_max(a.simdValue, b.simdValue))
+}
+
+
+extension Double3 : ExpressibleByArrayLiteral
+{
+	public typealias Element = Double
+	
+	/// Initialize using `arrayLiteral`.
+	///
+	/// - Precondition: the array literal must exactly three elements.
+	@_transparent public init(arrayLiteral elements:Double...) {
+		precondition(elements.count == 3)
+		self.init(elements[0], elements[1], elements[2])
+	}
+}
+
+
+extension Double3 : Equatable
+{
+	@_transparent public static func ==(a:Double3, b:Double3) -> Bool {
+		return simd_equal(a.simdValue, b.simdValue)
+	}
+}
+
+
+extension Double3 : Comparable
+{
+	@_transparent public static func < (a:Double3, b:Double3) -> Bool {
+		return Double3LessThan(a, b)
+	}
+	
+	@_transparent public static func <= (a:Double3, b:Double3) -> Bool {
+		return Double3LessThanOrEqual(a, b)
+	}
+	
+	@_transparent public static func > (a:Double3, b:Double3) -> Bool {
+		return Double3GreaterThan(a, b)
+	}
+	
+	@_transparent public static func >= (a:Double3, b:Double3) -> Bool {
+		return Double3GreaterThanOrEqual(a, b)
+	}
+}
+
+
+extension Double3 // Basic Math Operations
+{
+	@_transparent public static func + (a:Double3, b:Double3) -> Double3 {
+		return Double3Add(a, b)
+	}
+	@_transparent public static func += (v:inout Double3, o:Double3) {
+		v = v + o
+	}
+	
+	
+	@_transparent public static func - (a:Double3, b:Double3) -> Double3 {
+		return Double3Subtract(a, b)
+	}
+	@_transparent public static func -= (v:inout Double3, o:Double3) {
+		v = v - o
+	}
+	
+	
+	@_transparent public static func * (a:Double3, b:Double3) -> Double3 {
+		return Double3Multiply(a, b)
+	}
+	@_transparent public static func *= (v:inout Double3, o:Double3) {
+		v = v * o
+	}
+	
+	
+	@_transparent public static func / (a:Double3, b:Double3) -> Double3 {
+		return Double3Divide(a, b)
+	}
+	@_transparent public static func /= (v:inout Double3, o:Double3) {
+		v = v / o
+	}
+	
+	
+	@_transparent public static func % (a:Double3, b:Double3) -> Double3 {
+		return Double3Modulus(a, b)
+	}
+	@_transparent public static func %= (v:inout Double3, o:Double3) {
+		v = v % o
+	}
+	
+	
+	@_transparent public static func * (v:Double3, scale:Double) -> Double3 {
+		return Double3MultiplyByScalar(v, scale)
+	}
+	@_transparent public static func *= (v:inout Double3, scale:Double) {
+		v = v * scale
+	}
+	@_transparent public static func * (scale:Double, v:Double3) -> Double3 {
+		return Double3MultiplyingScalar(scale, v)
+	}
+	
+	
+	@_transparent public static func / (v:Double3, inverseScale:Double) -> Double3 {
+		return Double3DivideByScalar(v, inverseScale)
+	}
+	@_transparent public static func /= (v:inout Double3, inverseScale:Double) {
+		v = v / inverseScale
+	}
+	@_transparent public static func / (inverseScale:Double, v:Double3) -> Double3 {
+		return Double3DividingScalar(inverseScale, v)
+	}
+	
+	
+	@_transparent public static func % (v:Double3, inverseScale:Double) -> Double3 {
+		return Double3ModulusByScalar(v, inverseScale)
+	}
+	@_transparent public static func %= (v:inout Double3, inverseScale:Double) {
+		v = v % inverseScale
+	}
+	@_transparent public static func % (inverseScale:Double, v:Double3) -> Double3 {
+		return Double3ModulusingScalar(inverseScale, v)
+	}
+	
+	
+	@_transparent public static prefix func - (v:Double3) -> Double3 { return v.negated() }
+	@_transparent public func negated() -> Double3 {
+		return Double3Negate(self)
+	}
+	@_transparent public mutating func negate() {
+		self = self.negated()
+	}
+	
+	
+	@_transparent public func reciprocal() -> Double3 {
+		return Double3(simd_recip(self.simdValue))
+	}
+	@_transparent public mutating func formReciprocal() {
+		self = self.reciprocal()
+	}
+}
+
+
+extension Double3 // Geometric Math Operations
+{
+	/// Produces a unit-length vector.  (Not to be confused with a “normal”/“normal vector”.)
+	/// See: https://mathworld.wolfram.com/NormalVector.html
+	@_transparent public func normalized() -> Double3 {
+		return Double3(simd_normalize(self.simdValue))
+	}
+	/// Modifies the vector to be unit-length.  (Not to be confused with a “normal”/“normal vector”.)
+	/// See: https://mathworld.wolfram.com/NormalVector.html
+	@_transparent public mutating func normalize() {
+		self = self.normalized()
+	}
+	
+	
+	@_transparent public func length() -> Double {
+		return simd_length(self.simdValue)
+	}
+	/// Alias of: `length()`
+	@_transparent public func magnitude() -> Double { return self.length() }
+	
+	@_transparent public func lengthSquared() -> Double {
+		return simd_length_squared(self.simdValue)
+	}
+	/// Alias of: `lengthSquared()`
+	@_transparent public func magnitudeSquared() -> Double { return self.lengthSquared() }
+	
+	
+	/// Also known as the Interior Product.
+	@_transparent public func dotProduct(_ other:Double3) -> Double {
+		return simd_dot(self.simdValue, other.simdValue)
+	}
+	
+	
+	@_transparent public func crossProduct(_ other:Double3) -> Double3 {
+		return Double3(simd_cross(self.simdValue, other.simdValue))
+	}
+	@_transparent public mutating func formCrossProduct(_ other:Double3) {
+		self = self.crossProduct(other)
+	}
+	
+	
+	/// Also known as the Exterior Product.  Produces a bivector result (as a `Double3`).
+	@_transparent public func wedgeProduct(_ other:Double3) -> Double3 {
+		return Double3WedgeProduct(self, other)
+	}
+	
+	
+	@_transparent public func mixed(with other:Double3, ratio:Double) -> Double3 {
+		return Double3(simd_mix(self.simdValue, other.simdValue, simd_double3(repeating: ratio)))
+	}
+	@_transparent public mutating func mix(with other:Double3, ratio:Double) {
+		self = self.mixed(with: other, ratio: ratio)
+	}
+}
+
+@_transparent public func distanceBetween(_ a:Double3, _ b:Double3) -> Double {
+	return simd_distance(a.simdValue, b.simdValue)
+}
+@_transparent public func distanceSquaredBetween(_ a:Double3, _ b:Double3) -> Double {
+	return simd_distance_squared(a.simdValue, b.simdValue)
+}
+
+
+extension UnsafeBufferPointer where Element == Double3 // Bulk Math Operations
+{
+	/// Element-wise `self[i] + other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func add(_ other:UnsafeBufferPointer<Double3>, into out:UnsafeMutableBufferPointer<Double3>) {
+		self._vucktBulkOperation(other, into: out, Double3AddArrays)
+	}
+	/// Element-wise `self[i] - other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func subtract(_ other:UnsafeBufferPointer<Double3>, into out:UnsafeMutableBufferPointer<Double3>) {
+		self._vucktBulkOperation(other, into: out, Double3SubtractArrays)
+	}
+	/// Element-wise `self[i] * other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func multiply(by other:UnsafeBufferPointer<Double3>, into out:UnsafeMutableBufferPointer<Double3>) {
+		self._vucktBulkOperation(other, into: out, Double3MultiplyArrays)
+	}
+	/// Element-wise `self[i] / other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func divide(by other:UnsafeBufferPointer<Double3>, into out:UnsafeMutableBufferPointer<Double3>) {
+		self._vucktBulkOperation(other, into: out, Double3DivideArrays)
+	}
+	/// Element-wise `self[i] % other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:UnsafeBufferPointer<Double3>, into out:UnsafeMutableBufferPointer<Double3>) {
+		self._vucktBulkOperation(other, into: out, Double3ModulusArrays)
+	}
+	/// Element-wise `-self[i]`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func negate(into out:UnsafeMutableBufferPointer<Double3>) {
+		self._vucktBulkOperation(into: out, Double3NegateArray)
+	}
+	/// Element-wise `self[i] * scale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func multiply(by scale:Double, into out:UnsafeMutableBufferPointer<Double3>) {
+		self._vucktBulkOperation(scale, into: out, Double3MultiplyByScalarArray)
+	}
+	/// Element-wise `self[i] / inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func divide(by inverseScale:Double, into out:UnsafeMutableBufferPointer<Double3>) {
+		self._vucktBulkOperation(inverseScale, into: out, Double3DivideByScalarArray)
+	}
+	/// Element-wise `self[i] % inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Double, into out:UnsafeMutableBufferPointer<Double3>) {
+		self._vucktBulkOperation(inverseScale, into: out, Double3ModulusByScalarArray)
+	}
+}
+
+extension Array where Element == Double3 // Bulk Math Operations
+{
+	@_alwaysEmitIntoClient public func adding(_ other:[Double3]) -> [Double3] {
+		return self._vucktBulkOperation(other, Double3AddArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func add(_ other:[Double3]) {
+		self._vucktFormBulkOperation(other, Double3AddArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func subtracting(_ other:[Double3]) -> [Double3] {
+		return self._vucktBulkOperation(other, Double3SubtractArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func subtract(_ other:[Double3]) {
+		self._vucktFormBulkOperation(other, Double3SubtractArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by other:[Double3]) -> [Double3] {
+		return self._vucktBulkOperation(other, Double3MultiplyArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by other:[Double3]) {
+		self._vucktFormBulkOperation(other, Double3MultiplyArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by other:[Double3]) -> [Double3] {
+		return self._vucktBulkOperation(other, Double3DivideArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by other:[Double3]) {
+		self._vucktFormBulkOperation(other, Double3DivideArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:[Double3]) -> [Double3] {
+		return self._vucktBulkOperation(other, Double3ModulusArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy other:[Double3]) {
+		self._vucktFormBulkOperation(other, Double3ModulusArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func negated() -> [Double3] {
+		return self._vucktBulkOperation(Double3NegateArray)
+	}
+	@_alwaysEmitIntoClient public mutating func negate() {
+		self._vucktFormBulkOperation(Double3NegateArray)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by scale:Double) -> [Double3] {
+		return self._vucktBulkOperation(scale, Double3MultiplyByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by scale:Double) {
+		self._vucktFormBulkOperation(scale, Double3MultiplyByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by inverseScale:Double) -> [Double3] {
+		return self._vucktBulkOperation(inverseScale, Double3DivideByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by inverseScale:Double) {
+		self._vucktFormBulkOperation(inverseScale, Double3DivideByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Double) -> [Double3] {
+		return self._vucktBulkOperation(inverseScale, Double3ModulusByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy inverseScale:Double) {
+		self._vucktFormBulkOperation(inverseScale, Double3ModulusByScalarArray)
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == Double3 // Bulk Conversion
+{
+	/// Narrows every element into `out` (rounding to nearest).  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkConversion(into: out, Double3ArrayToFloat3Array)
+	}
+	
+	/// Writes every element's offset from `origin`, narrowed, into `out`— for rendering positions relative to a nearby origin (typically the camera's position) without losing `Float`'s precision to their distance from the world origin.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func rebase(origin:Double3, into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkConversion(into: out){ Double3RebaseArrayToFloat3Array($0, origin, $1, $2) }
+	}
+	/// Writes every element's offset from `origin`, narrowed, into tightly-packed `out` (e.g. a vertex buffer).  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func rebase(origin:Double3, into out:UnsafeMutableBufferPointer<PackedFloat3>) {
+		self._vucktBulkConversion(into: out){ Double3RebaseArrayToPackedFloat3Array($0, origin, $1, $2) }
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float3 // Bulk Conversion
+{
+	/// Widens every element into `out` (exactly).  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Double3>) {
+		self._vucktBulkConversion(into: out, Double3ArrayFromFloat3Array)
+	}
+}
+
+extension Array where Element == Float3
+{
+	/// Narrows an array of `Double3`s (rounding to nearest).
+	@_alwaysEmitIntoClient public init(_ double3Values:[Double3]) {
+		self = double3Values._vucktBulkConversion(Double3ArrayToFloat3Array)
+	}
+}
+
+extension Array where Element == Double3
+{
+	/// Widens an array of `Float3`s (exactly).
+	@_alwaysEmitIntoClient public init(_ float3Values:[Float3]) {
+		self = float3Values._vucktBulkConversion(Double3ArrayFromFloat3Array)
+	}
+	
+	/// Every element's offset from `origin`, narrowed— see `UnsafeBufferPointer.rebase(origin:into:)`.
+	@_alwaysEmitIntoClient public func rebased(origin:Double3) -> [Float3] {
+		return self._vucktBulkConversion{ Double3RebaseArrayToFloat3Array($0, origin, $1, $2) }
+	}
+}
+
+
+extension Double3 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			self.asArray.forEach{ hasher.combine($0) }
+		}
+	#else
+		public var hashValue:Int {
+			return self.asArray.reduce(0){ $0 &* 31 &+ $1.hashValue }
+		}
+	#endif
+}
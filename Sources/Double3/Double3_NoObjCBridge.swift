@@ -0,0 +1,195 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Double3
+{
+	public var x:Double
+	public var y:Double
+	public var z:Double
+	
+	public init() {
+		self.x = Double()
+		self.y = Double()
+		self.z = Double()
+	}
+	
+	public init(x:Double, y:Double, z:Double) {
+		self.x = x
+		self.y = y
+		self.z = z
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Double3` struct to `simd_double3` vector using passing-individual-members initialization.
+@_transparent public func Double3ToSimd(_ structValue:Double3) -> simd_double3 {
+	return simd_double3(structValue.x, structValue.y, structValue.z)
+}
+/// Converts a `Double3` struct from `simd_double3` vector using passing-individual-members initialization.
+@_transparent public func Double3FromSimd(_ simdValue:simd_double3) -> Double3 {
+	return Double3(x: simdValue.x, y: simdValue.y, z: simdValue.z)
+}
+
+
+
+// MARK: SIMD-Accelerated Operator Access
+
+@_transparent public func Double3Add(_ a:Double3, _ b:Double3) -> Double3 {
+	return Double3FromSimd(Double3ToSimd(a) + Double3ToSimd(b))
+}
+@_transparent public func Double3Subtract(_ a:Double3, _ b:Double3) -> Double3 {
+	return Double3FromSimd(Double3ToSimd(a) - Double3ToSimd(b))
+}
+@_transparent public func Double3Negate(_ v:Double3) -> Double3 {
+	return Double3FromSimd(-Double3ToSimd(v))
+}
+@_transparent public func Double3Multiply(_ a:Double3, _ b:Double3) -> Double3 {
+	return Double3FromSimd(Double3ToSimd(a) * Double3ToSimd(b))
+}
+@_transparent public func Double3Divide(_ a:Double3, _ b:Double3) -> Double3 {
+	return Double3FromSimd(Double3ToSimd(a) / Double3ToSimd(b))
+}
+@_transparent public func Double3Modulus(_ a:Double3, _ b:Double3) -> Double3 {
+	return Double3(x: a.x.truncatingRemainder(dividingBy: b.x), y: a.y.truncatingRemainder(dividingBy: b.y), z: a.z.truncatingRemainder(dividingBy: b.z))
+}
+@_transparent public func Double3MultiplyByScalar(_ v:Double3, _ s:Double) -> Double3 {
+	return Double3FromSimd(Double3ToSimd(v) * s)
+}
+@_transparent public func Double3MultiplyingScalar(_ s:Double, _ v:Double3) -> Double3 {
+	return Double3FromSimd(Double3ToSimd(v) * s)
+}
+@_transparent public func Double3DivideByScalar(_ v:Double3, _ s:Double) -> Double3 {
+	return Double3FromSimd(Double3ToSimd(v) / s)
+}
+@_transparent public func Double3DividingScalar(_ s:Double, _ v:Double3) -> Double3 {
+	return Double3FromSimd(s / Double3ToSimd(v))
+}
+@_transparent public func Double3ModulusByScalar(_ v:Double3, _ s:Double) -> Double3 {
+	return Double3Modulus(v, Double3(x: s, y: s, z: s))
+}
+@_transparent public func Double3ModulusingScalar(_ s:Double, _ v:Double3) -> Double3 {
+	return Double3Modulus(Double3(x: s, y: s, z: s), v)
+}
+
+@_alwaysEmitIntoClient public func Double3LessThan(_ a:Double3, _ b:Double3) -> Bool {
+	return all(a.simdValue .< b.simdValue)
+}
+@_alwaysEmitIntoClient public func Double3LessThanOrEqual(_ a:Double3, _ b:Double3) -> Bool {
+	return all(a.simdValue .<= b.simdValue)
+}
+@_alwaysEmitIntoClient public func Double3GreaterThan(_ a:Double3, _ b:Double3) -> Bool {
+	return all(a.simdValue .> b.simdValue)
+}
+@_alwaysEmitIntoClient public func Double3GreaterThanOrEqual(_ a:Double3, _ b:Double3) -> Bool {
+	return all(a.simdValue .>= b.simdValue)
+}
+
+@_alwaysEmitIntoClient public func Double3WedgeProduct(_ a:Double3, _ b:Double3) -> Double3 {
+	return Double3(x: a.y * b.z - a.z * b.y, y: a.z * b.x - a.x * b.z, z: a.x * b.y - a.y * b.x)
+}
+
+
+
+// MARK: Float3 Conversion
+
+@_transparent public func Double3ToFloat3(_ value:Double3) -> Float3 {
+	return Float3(x: Float(value.x), y: Float(value.y), z: Float(value.z))
+}
+@_transparent public func Double3FromFloat3(_ value:Float3) -> Double3 {
+	return Double3(x: Double(value.x), y: Double(value.y), z: Double(value.z))
+}
+
+
+
+// MARK: Array Operations
+
+@_alwaysEmitIntoClient public func Double3AddArrays(_ a:UnsafePointer<Double3>, _ b:UnsafePointer<Double3>, _ out:UnsafeMutablePointer<Double3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3Add(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double3SubtractArrays(_ a:UnsafePointer<Double3>, _ b:UnsafePointer<Double3>, _ out:UnsafeMutablePointer<Double3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3Subtract(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double3MultiplyArrays(_ a:UnsafePointer<Double3>, _ b:UnsafePointer<Double3>, _ out:UnsafeMutablePointer<Double3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3Multiply(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double3DivideArrays(_ a:UnsafePointer<Double3>, _ b:UnsafePointer<Double3>, _ out:UnsafeMutablePointer<Double3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3Divide(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double3ModulusArrays(_ a:UnsafePointer<Double3>, _ b:UnsafePointer<Double3>, _ out:UnsafeMutablePointer<Double3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3Modulus(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double3NegateArray(_ v:UnsafePointer<Double3>, _ out:UnsafeMutablePointer<Double3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3Negate(v[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double3MultiplyByScalarArray(_ v:UnsafePointer<Double3>, _ s:Double, _ out:UnsafeMutablePointer<Double3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3MultiplyByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Double3DivideByScalarArray(_ v:UnsafePointer<Double3>, _ s:Double, _ out:UnsafeMutablePointer<Double3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3DivideByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Double3ModulusByScalarArray(_ v:UnsafePointer<Double3>, _ s:Double, _ out:UnsafeMutablePointer<Double3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3ModulusByScalar(v[i], s)
+	}
+}
+
+
+
+// MARK: Bulk Float3 Conversion
+
+@_alwaysEmitIntoClient public func Double3ArrayToFloat3Array(_ values:UnsafePointer<Double3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3ToFloat3(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double3ArrayFromFloat3Array(_ values:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Double3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3FromFloat3(values[i])
+	}
+}
+
+
+
+// MARK: Origin Rebasing
+
+@_alwaysEmitIntoClient public func Double3RebaseArrayToFloat3Array(_ points:UnsafePointer<Double3>, _ origin:Double3, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double3ToFloat3(Double3Subtract(points[i], origin))
+	}
+}
+@_alwaysEmitIntoClient public func Double3RebaseArrayToPackedFloat3Array(_ points:UnsafePointer<Double3>, _ origin:Double3, _ out:UnsafeMutablePointer<PackedFloat3>, _ n:Int) {
+	for i in 0..<n {
+		let p = points[i]
+		out[i] = PackedFloat3(x: Float(p.x - origin.x), y: Float(p.y - origin.y), z: Float(p.z - origin.z))
+	}
+}
@@ -0,0 +1,230 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float4.h>)
+	#import <Vuckt/Float4.h>
+#else
+	#include "../Float4/Float4.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 4-component vector of `double`s; the double-precision counterpart of `Float4`.
+struct Double4 {
+	double x, y, z, w;
+} __attribute__((aligned(__alignof__(simd_double4))));
+typedef struct Double4 Double4;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Double4` struct to `simd_double4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_double4 Double4ToSimd(Double4 structValue) {
+	return *(simd_double4 *)&structValue;
+}
+/// Converts a `Double4` struct from `simd_double4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Double4 Double4FromSimd(simd_double4 simdValue) {
+	return *(Double4 *)&simdValue;
+}
+
+
+
+#pragma mark SIMD-Accelerated Operator Access
+
+NS_INLINE Double4 Double4Add(Double4 a, Double4 b) {
+	return Double4FromSimd(Double4ToSimd(a) + Double4ToSimd(b));
+}
+NS_INLINE Double4 Double4Subtract(Double4 a, Double4 b) {
+	return Double4FromSimd(Double4ToSimd(a) - Double4ToSimd(b));
+}
+NS_INLINE Double4 Double4Negate(Double4 v) {
+	return Double4FromSimd(-Double4ToSimd(v));
+}
+NS_INLINE Double4 Double4Multiply(Double4 a, Double4 b) {
+	return Double4FromSimd(Double4ToSimd(a) * Double4ToSimd(b));
+}
+NS_INLINE Double4 Double4Divide(Double4 a, Double4 b) {
+	return Double4FromSimd(Double4ToSimd(a) / Double4ToSimd(b));
+}
+NS_INLINE Double4 Double4Modulus(Double4 a, Double4 b) {
+	return Double4FromSimd(vuckt_simd_fmod(Double4ToSimd(a), Double4ToSimd(b)));
+}
+NS_INLINE Double4 Double4MultiplyByScalar(Double4 v, double s) {
+	return Double4FromSimd(Double4ToSimd(v) * s);
+}
+NS_INLINE Double4 Double4MultiplyingScalar(double s, Double4 v) {
+	return Double4FromSimd(Double4ToSimd(v) * s);
+}
+NS_INLINE Double4 Double4DivideByScalar(Double4 v, double s) {
+	return Double4FromSimd(Double4ToSimd(v) / s);
+}
+NS_INLINE Double4 Double4DividingScalar(double s, Double4 v) {
+	return Double4FromSimd(s / Double4ToSimd(v));
+}
+NS_INLINE Double4 Double4ModulusByScalar(Double4 v, double s) {
+	return Double4Modulus(v, (Double4){ s, s, s, s });
+}
+NS_INLINE Double4 Double4ModulusingScalar(double s, Double4 v) {
+	return Double4Modulus((Double4){ s, s, s, s }, v);
+}
+
+NS_INLINE bool Double4LessThan(Double4 a, Double4 b) {
+	return simd_all(Double4ToSimd(a) < Double4ToSimd(b));
+}
+NS_INLINE bool Double4LessThanOrEqual(Double4 a, Double4 b) {
+	return simd_all(Double4ToSimd(a) <= Double4ToSimd(b));
+}
+NS_INLINE bool Double4GreaterThan(Double4 a, Double4 b) {
+	return simd_all(Double4ToSimd(a) > Double4ToSimd(b));
+}
+NS_INLINE bool Double4GreaterThanOrEqual(Double4 a, Double4 b) {
+	return simd_all(Double4ToSimd(a) >= Double4ToSimd(b));
+}
+
+
+
+#pragma mark Float4 Conversion
+
+/// Narrows each element to `float`, rounding to nearest.
+NS_INLINE Float4 Double4ToFloat4(Double4 value) {
+	return (Float4){ (float)value.x, (float)value.y, (float)value.z, (float)value.w };
+}
+/// Widens each element to `double` (exactly).
+NS_INLINE Double4 Double4FromFloat4(Float4 value) {
+	return (Double4){ value.x, value.y, value.z, value.w };
+}
+
+
+
+#pragma mark Array Operations
+
+// Element-wise operations over `n`-element arrays, for bulk passes that would otherwise pay per-element call & load overhead.
+// `out` may be the same array as an input (for in-place operation), but must not otherwise overlap one.
+// Where possible these loop over the flat `double` lanes rather than per-`Double4`, so the compiler can vectorize across elements at the target's full vector width.
+
+/// `out[i] = a[i] + b[i]`
+NS_INLINE void Double4AddArrays(const Double4 *a, const Double4 *b, Double4 *out, size_t n) {
+	const double *aLanes = (const double *)a, *bLanes = (const double *)b;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double4) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] + bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] - b[i]`
+NS_INLINE void Double4SubtractArrays(const Double4 *a, const Double4 *b, Double4 *out, size_t n) {
+	const double *aLanes = (const double *)a, *bLanes = (const double *)b;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double4) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] - bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] * b[i]`
+NS_INLINE void Double4MultiplyArrays(const Double4 *a, const Double4 *b, Double4 *out, size_t n) {
+	const double *aLanes = (const double *)a, *bLanes = (const double *)b;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double4) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] * bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] / b[i]`
+NS_INLINE void Double4DivideArrays(const Double4 *a, const Double4 *b, Double4 *out, size_t n) {
+	const double *aLanes = (const double *)a, *bLanes = (const double *)b;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double4) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] / bLanes[laneI];
+	}
+}
+/// `out[i] = fmod(a[i], b[i])`
+NS_INLINE void Double4ModulusArrays(const Double4 *a, const Double4 *b, Double4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Double4Modulus(a[i], b[i]);
+	}
+}
+/// `out[i] = -v[i]`
+NS_INLINE void Double4NegateArray(const Double4 *v, Double4 *out, size_t n) {
+	const double *vLanes = (const double *)v;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double4) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = -vLanes[laneI];
+	}
+}
+/// `out[i] = v[i] * s`
+NS_INLINE void Double4MultiplyByScalarArray(const Double4 *v, double s, Double4 *out, size_t n) {
+	const double *vLanes = (const double *)v;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double4) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = vLanes[laneI] * s;
+	}
+}
+/// `out[i] = v[i] / s`
+NS_INLINE void Double4DivideByScalarArray(const Double4 *v, double s, Double4 *out, size_t n) {
+	const double *vLanes = (const double *)v;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double4) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = vLanes[laneI] / s;
+	}
+}
+/// `out[i] = fmod(v[i], s)`
+NS_INLINE void Double4ModulusByScalarArray(const Double4 *v, double s, Double4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Double4ModulusByScalar(v[i], s);
+	}
+}
+
+
+
+#pragma mark Bulk Float4 Conversion
+
+// `out` must not overlap the input array.
+// These run over the flat lanes (4 per element on both sides), so each vector of `double`s narrows or widens in one instruction where the target has one (e.g. `cvtpd2ps`).
+
+/// `out[i] = Double4ToFloat4(values[i])`
+NS_INLINE void Double4ArrayToFloat4Array(const Double4 *values, Float4 *out, size_t n) {
+	const double *valueLanes = (const double *)values;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double4) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = (float)valueLanes[laneI];
+	}
+}
+/// `out[i] = Double4FromFloat4(values[i])`
+NS_INLINE void Double4ArrayFromFloat4Array(const Float4 *values, Double4 *out, size_t n) {
+	const float *valueLanes = (const float *)values;
+	double *outLanes = (double *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Double4) / sizeof(double)); ++laneI) {
+		outLanes[laneI] = (double)valueLanes[laneI];
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
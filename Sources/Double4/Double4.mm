@@ -0,0 +1,20 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Double4.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Double4, x) == sizeof(simd_double1),
+	"Double4's first member's size does not match simd_double1's on this platform.");
+static_assert(sizeof(Double4) == sizeof(simd_double4),
+	"Double4's size does not match simd_double4's on this platform.");
+static_assert(sizeof_member(Double4, x) == sizeof_member(simd_double4, x),
+	"Double4's first member's size does not match simd_double4's first member's on this platform.");
+static_assert(alignof(Double4) == alignof(simd_double4),
+	"Double4's alignment requirements does not match simd_double4's on this platform.");
+static_assert(sizeof(Double4) / sizeof(double) == sizeof(Float4) / sizeof(float),
+	"Double4's lane count does not match Float4's on this platform (which the bulk conversions rely on).");
@@ -0,0 +1,474 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension Double4
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements.
+	@_transparent public init(_ x:Double, _ y:Double, _ z:Double, _ w:Double) {
+		self.init(x: x, y: y, z: z, w: w)
+	}
+	
+	/// Initialize to a vector with all elements equal to `scalar`.
+	@_transparent public init(scalar:Double) {
+		self.init(scalar, scalar, scalar, scalar)
+	}
+	/// Alias of: `init(scalar:)`
+	@_transparent public init(_ scalar:Double) { self.init(scalar: scalar) }
+	
+	/// Initialize to a SIMD vector.
+	@_transparent public init(_ value:simd_double4) {
+		self = Double4FromSimd(value)
+	}
+	
+	/// Initialize from an `Int4` value (exactly).
+	@_transparent public init(_ int4Value:Int4) {
+		self.init(Double(int4Value.x), Double(int4Value.y), Double(int4Value.z), Double(int4Value.w))
+	}
+	
+	/// Initialize from a `Float4` value, widening each element (exactly).
+	@_transparent public init(_ float4Value:Float4) {
+		self = Double4FromFloat4(float4Value)
+	}
+	
+	/// Initialize to a vector with elements taken from `array`.
+	///
+	/// - Precondition: `array` must have exactly four elements.
+	@_transparent public init(array:[Double]) {
+		precondition(array.count == 4)
+		self.init(array[0], array[1], array[2], array[3])
+	}
+	
+	/// Initialize using the given 4-element tuple.
+	@_transparent public init(tuple:(x:Double,y:Double,z:Double,w:Double)) {
+		self.init(tuple.x, tuple.y, tuple.z, tuple.w)
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Double4 { return Double4(scalar: 0) }
+	
+	@_transparent public static var one:Double4 { return Self.positiveOne }
+	@_transparent public static var positiveOne:Double4 { return Double4(scalar: 1) }
+	@_transparent public static var negativeOne:Double4 { return Double4(scalar: -1) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	@_transparent public var asTuple:(x:Double,y:Double,z:Double,w:Double) {
+		return ( self.x, self.y, self.z, self.w )
+	}
+	
+	@_transparent public var asArray:[Double] {
+		return [ self.x, self.y, self.z, self.w ]
+	}
+	
+	/// Each element narrowed to `Float`, rounding to nearest.  (For positions far from the origin, prefer rebasing relative to a nearby origin first.)
+	@_transparent public var float4Value:Float4 {
+		return Double4ToFloat4(self)
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	@_transparent public var simdValue:simd_double4 {
+		return Double4ToSimd(self)
+	}
+	
+	
+	// MARK: Is… Flags
+	
+	@_transparent public var isFinite:Bool {
+		return self.x.isFinite && self.y.isFinite && self.z.isFinite && self.w.isFinite
+	}
+	@_transparent public var isInfinite:Bool {
+		return self.x.isInfinite || self.y.isInfinite || self.z.isInfinite || self.w.isInfinite
+	}
+	@_transparent public var isNaN:Bool {
+		return self.x.isNaN || self.y.isNaN || self.z.isNaN || self.w.isNaN
+	}
+	@_transparent public var isZero:Bool {
+		return self == Self.zero
+	}
+}
+
+
+extension Float4
+{
+	/// Initialize from a `Double4` value, narrowing each element (rounding to nearest).
+	@_transparent public init(_ double4Value:Double4) {
+		self = Double4ToFloat4(double4Value)
+	}
+}
+
+
+extension Double4 : CustomStringConvertible
+{
+	public var description:String {
+		return "(\(self.x), \(self.y), \(self.z), \(self.w))"
+	}
+}
+
+
+// MARK: Element-wise `min`/`max`
+
+@_transparent public func min(_ a:Double4, _ b:Double4) -> Double4 {
+	return Double4(simd_min(a.simdValue, b.simdValue))
+}
+
+@_transparent public func max(_ a:Double4, _ b:Double4) -> Double4 {
+	return Double4(simd_max(a.simdValue, b.simdValue))
+}
+
+
+extension Double4 : ExpressibleByArrayLiteral
+{
+	public typealias Element = Double
+	
+	/// Initialize using `arrayLiteral`.
+	///
+	/// - Precondition: the array literal must exactly four elements.
+	@_transparent public init(arrayLiteral elements:Double...) {
+		precondition(elements.count == 4)
+		self.init(elements[0], elements[1], elements[2], elements[3])
+	}
+}
+
+
+extension Double4 : Equatable
+{
+	@_transparent public static func ==(a:Double4, b:Double4) -> Bool {
+		return simd_equal(a.simdValue, b.simdValue)
+	}
+}
+
+
+extension Double4 : Comparable
+{
+	@_transparent public static func < (a:Double4, b:Double4) -> Bool {
+		return Double4LessThan(a, b)
+	}
+	
+	@_transparent public static func <= (a:Double4, b:Double4) -> Bool {
+		return Double4LessThanOrEqual(a, b)
+	}
+	
+	@_transparent public static func > (a:Double4, b:Double4) -> Bool {
+		return Double4GreaterThan(a, b)
+	}
+	
+	@_transparent public static func >= (a:Double4, b:Double4) -> Bool {
+		return Double4GreaterThanOrEqual(a, b)
+	}
+}
+
+
+extension Double4 // Basic Math Operations
+{
+	@_transparent public static func + (a:Double4, b:Double4) -> Double4 {
+		return Double4Add(a, b)
+	}
+	@_transparent public static func += (v:inout Double4, o:Double4) {
+		v = v + o
+	}
+	
+	
+	@_transparent public static func - (a:Double4, b:Double4) -> Double4 {
+		return Double4Subtract(a, b)
+	}
+	@_transparent public static func -= (v:inout Double4, o:Double4) {
+		v = v - o
+	}
+	
+	
+	@_transparent public static func * (a:Double4, b:Double4) -> Double4 {
+		return Double4Multiply(a, b)
+	}
+	@_transparent public static func *= (v:inout Double4, o:Double4) {
+		v = v * o
+	}
+	
+	
+	@_transparent public static func / (a:Double4, b:Double4) -> Double4 {
+		return Double4Divide(a, b)
+	}
+	@_transparent public static func /= (v:inout Double4, o:Double4) {
+		v = v / o
+	}
+	
+	
+	@_transparent public static func % (a:Double4, b:Double4) -> Double4 {
+		return Double4Modulus(a, b)
+	}
+	@_transparent public static func %= (v:inout Double4, o:Double4) {
+		v = v % o
+	}
+	
+	
+	@_transparent public static func * (v:Double4, scale:Double) -> Double4 {
+		return Double4MultiplyByScalar(v, scale)
+	}
+	@_transparent public static func *= (v:inout Double4, scale:Double) {
+		v = v * scale
+	}
+	@_transparent public static func * (scale:Double, v:Double4) -> Double4 {
+		return Double4MultiplyingScalar(scale, v)
+	}
+	
+	
+	@_transparent public static func / (v:Double4, inverseScale:Double) -> Double4 {
+		return Double4DivideByScalar(v, inverseScale)
+	}
+	@_transparent public static func /= (v:inout Double4, inverseScale:Double) {
+		v = v / inverseScale
+	}
+	@_transparent public static func / (inverseScale:Double, v:Double4) -> Double4 {
+		return Double4DividingScalar(inverseScale, v)
+	}
+	
+	
+	@_transparent public static func % (v:Double4, inverseScale:Double) -> Double4 {
+		return Double4ModulusByScalar(v, inverseScale)
+	}
+	@_transparent public static func %= (v:inout Double4, inverseScale:Double) {
+		v = v % inverseScale
+	}
+	@_transparent public static func % (inverseScale:Double, v:Double4) -> Double4 {
+		return Double4ModulusingScalar(inverseScale, v)
+	}
+	
+	
+	@_transparent public static prefix func - (v:Double4) -> Double4 { return v.negated() }
+	@_transparent public func negated() -> Double4 {
+		return Double4Negate(self)
+	}
+	@_transparent public mutating func negate() {
+		self = self.negated()
+	}
+	
+	
+	@_transparent public func reciprocal() -> Double4 {
+		return Double4(simd_recip(self.simdValue))
+	}
+	@_transparent public mutating func formReciprocal() {
+		self = self.reciprocal()
+	}
+}
+
+
+extension Double4 // Geometric Math Operations
+{
+	/// Produces a unit-length vector.  (Not to be confused with a “normal”/“normal vector”.)
+	/// See: https://mathworld.wolfram.com/NormalVector.html
+	@_transparent public func normalized() -> Double4 {
+		return Double4(simd_normalize(self.simdValue))
+	}
+	/// Modifies the vector to be unit-length.  (Not to be confused with a “normal”/“normal vector”.)
+	/// See: https://mathworld.wolfram.com/NormalVector.html
+	@_transparent public mutating func normalize() {
+		self = self.normalized()
+	}
+	
+	
+	@_transparent public func length() -> Double {
+		return simd_length(self.simdValue)
+	}
+	/// Alias of: `length()`
+	@_transparent public func magnitude() -> Double { return self.length() }
+	
+	@_transparent public func lengthSquared() -> Double {
+		return simd_length_squared(self.simdValue)
+	}
+	/// Alias of: `lengthSquared()`
+	@_transparent public func magnitudeSquared() -> Double { return self.lengthSquared() }
+	
+	
+	/// Also known as the Interior Product.
+	@_transparent public func dotProduct(_ other:Double4) -> Double {
+		return simd_dot(self.simdValue, other.simdValue)
+	}
+	
+	
+	@_transparent public func mixed(with other:Double4, ratio:Double) -> Double4 {
+		return Double4(simd_mix(self.simdValue, other.simdValue, simd_double4(repeating: ratio)))
+	}
+	@_transparent public mutating func mix(with other:Double4, ratio:Double) {
+		self = self.mixed(with: other, ratio: ratio)
+	}
+}
+
+@_transparent public func distanceBetween(_ a:Double4, _ b:Double4) -> Double {
+	return simd_distance(a.simdValue, b.simdValue)
+}
+@_transparent public func distanceSquaredBetween(_ a:Double4, _ b:Double4) -> Double {
+	return simd_distance_squared(a.simdValue, b.simdValue)
+}
+
+
+extension UnsafeBufferPointer where Element == Double4 // Bulk Math Operations
+{
+	/// Element-wise `self[i] + other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func add(_ other:UnsafeBufferPointer<Double4>, into out:UnsafeMutableBufferPointer<Double4>) {
+		self._vucktBulkOperation(other, into: out, Double4AddArrays)
+	}
+	/// Element-wise `self[i] - other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func subtract(_ other:UnsafeBufferPointer<Double4>, into out:UnsafeMutableBufferPointer<Double4>) {
+		self._vucktBulkOperation(other, into: out, Double4SubtractArrays)
+	}
+	/// Element-wise `self[i] * other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func multiply(by other:UnsafeBufferPointer<Double4>, into out:UnsafeMutableBufferPointer<Double4>) {
+		self._vucktBulkOperation(other, into: out, Double4MultiplyArrays)
+	}
+	/// Element-wise `self[i] / other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func divide(by other:UnsafeBufferPointer<Double4>, into out:UnsafeMutableBufferPointer<Double4>) {
+		self._vucktBulkOperation(other, into: out, Double4DivideArrays)
+	}
+	/// Element-wise `self[i] % other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:UnsafeBufferPointer<Double4>, into out:UnsafeMutableBufferPointer<Double4>) {
+		self._vucktBulkOperation(other, into: out, Double4ModulusArrays)
+	}
+	/// Element-wise `-self[i]`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func negate(into out:UnsafeMutableBufferPointer<Double4>) {
+		self._vucktBulkOperation(into: out, Double4NegateArray)
+	}
+	/// Element-wise `self[i] * scale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func multiply(by scale:Double, into out:UnsafeMutableBufferPointer<Double4>) {
+		self._vucktBulkOperation(scale, into: out, Double4MultiplyByScalarArray)
+	}
+	/// Element-wise `self[i] / inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func divide(by inverseScale:Double, into out:UnsafeMutableBufferPointer<Double4>) {
+		self._vucktBulkOperation(inverseScale, into: out, Double4DivideByScalarArray)
+	}
+	/// Element-wise `self[i] % inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Double, into out:UnsafeMutableBufferPointer<Double4>) {
+		self._vucktBulkOperation(inverseScale, into: out, Double4ModulusByScalarArray)
+	}
+}
+
+extension Array where Element == Double4 // Bulk Math Operations
+{
+	@_alwaysEmitIntoClient public func adding(_ other:[Double4]) -> [Double4] {
+		return self._vucktBulkOperation(other, Double4AddArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func add(_ other:[Double4]) {
+		self._vucktFormBulkOperation(other, Double4AddArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func subtracting(_ other:[Double4]) -> [Double4] {
+		return self._vucktBulkOperation(other, Double4SubtractArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func subtract(_ other:[Double4]) {
+		self._vucktFormBulkOperation(other, Double4SubtractArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by other:[Double4]) -> [Double4] {
+		return self._vucktBulkOperation(other, Double4MultiplyArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by other:[Double4]) {
+		self._vucktFormBulkOperation(other, Double4MultiplyArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by other:[Double4]) -> [Double4] {
+		return self._vucktBulkOperation(other, Double4DivideArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by other:[Double4]) {
+		self._vucktFormBulkOperation(other, Double4DivideArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:[Double4]) -> [Double4] {
+		return self._vucktBulkOperation(other, Double4ModulusArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy other:[Double4]) {
+		self._vucktFormBulkOperation(other, Double4ModulusArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func negated() -> [Double4] {
+		return self._vucktBulkOperation(Double4NegateArray)
+	}
+	@_alwaysEmitIntoClient public mutating func negate() {
+		self._vucktFormBulkOperation(Double4NegateArray)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by scale:Double) -> [Double4] {
+		return self._vucktBulkOperation(scale, Double4MultiplyByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by scale:Double) {
+		self._vucktFormBulkOperation(scale, Double4MultiplyByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by inverseScale:Double) -> [Double4] {
+		return self._vucktBulkOperation(inverseScale, Double4DivideByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by inverseScale:Double) {
+		self._vucktFormBulkOperation(inverseScale, Double4DivideByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Double) -> [Double4] {
+		return self._vucktBulkOperation(inverseScale, Double4ModulusByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy inverseScale:Double) {
+		self._vucktFormBulkOperation(inverseScale, Double4ModulusByScalarArray)
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == Double4 // Bulk Conversion
+{
+	/// Narrows every element into `out` (rounding to nearest).  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkConversion(into: out, Double4ArrayToFloat4Array)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float4 // Bulk Conversion
+{
+	/// Widens every element into `out` (exactly).  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Double4>) {
+		self._vucktBulkConversion(into: out, Double4ArrayFromFloat4Array)
+	}
+}
+
+extension Array where Element == Float4
+{
+	/// Narrows an array of `Double4`s (rounding to nearest).
+	@_alwaysEmitIntoClient public init(_ double4Values:[Double4]) {
+		self = double4Values._vucktBulkConversion(Double4ArrayToFloat4Array)
+	}
+}
+
+extension Array where Element == Double4
+{
+	/// Widens an array of `Float4`s (exactly).
+	@_alwaysEmitIntoClient public init(_ float4Values:[Float4]) {
+		self = float4Values._vucktBulkConversion(Double4ArrayFromFloat4Array)
+	}
+}
+
+
+extension Double4 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			self.asArray.forEach{ hasher.combine($0) }
+		}
+	#else
+		public var hashValue:Int {
+			return self.asArray.reduce(0){ $0 &* 31 &+ $1.hashValue }
+		}
+	#endif
+}
@@ -0,0 +1,178 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Double4
+{
+	public var x:Double
+	public var y:Double
+	public var z:Double
+	public var w:Double
+	
+	public init() {
+		self.x = Double()
+		self.y = Double()
+		self.z = Double()
+		self.w = Double()
+	}
+	
+	public init(x:Double, y:Double, z:Double, w:Double) {
+		self.x = x
+		self.y = y
+		self.z = z
+		self.w = w
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Double4` struct to `simd_double4` vector using passing-individual-members initialization.
+@_transparent public func Double4ToSimd(_ structValue:Double4) -> simd_double4 {
+	return simd_double4(structValue.x, structValue.y, structValue.z, structValue.w)
+}
+/// Converts a `Double4` struct from `simd_double4` vector using passing-individual-members initialization.
+@_transparent public func Double4FromSimd(_ simdValue:simd_double4) -> Double4 {
+	return Double4(x: simdValue.x, y: simdValue.y, z: simdValue.z, w: simdValue.w)
+}
+
+
+
+// MARK: SIMD-Accelerated Operator Access
+
+@_transparent public func Double4Add(_ a:Double4, _ b:Double4) -> Double4 {
+	return Double4FromSimd(Double4ToSimd(a) + Double4ToSimd(b))
+}
+@_transparent public func Double4Subtract(_ a:Double4, _ b:Double4) -> Double4 {
+	return Double4FromSimd(Double4ToSimd(a) - Double4ToSimd(b))
+}
+@_transparent public func Double4Negate(_ v:Double4) -> Double4 {
+	return Double4FromSimd(-Double4ToSimd(v))
+}
+@_transparent public func Double4Multiply(_ a:Double4, _ b:Double4) -> Double4 {
+	return Double4FromSimd(Double4ToSimd(a) * Double4ToSimd(b))
+}
+@_transparent public func Double4Divide(_ a:Double4, _ b:Double4) -> Double4 {
+	return Double4FromSimd(Double4ToSimd(a) / Double4ToSimd(b))
+}
+@_transparent public func Double4Modulus(_ a:Double4, _ b:Double4) -> Double4 {
+	return Double4(x: a.x.truncatingRemainder(dividingBy: b.x), y: a.y.truncatingRemainder(dividingBy: b.y), z: a.z.truncatingRemainder(dividingBy: b.z), w: a.w.truncatingRemainder(dividingBy: b.w))
+}
+@_transparent public func Double4MultiplyByScalar(_ v:Double4, _ s:Double) -> Double4 {
+	return Double4FromSimd(Double4ToSimd(v) * s)
+}
+@_transparent public func Double4MultiplyingScalar(_ s:Double, _ v:Double4) -> Double4 {
+	return Double4FromSimd(Double4ToSimd(v) * s)
+}
+@_transparent public func Double4DivideByScalar(_ v:Double4, _ s:Double) -> Double4 {
+	return Double4FromSimd(Double4ToSimd(v) / s)
+}
+@_transparent public func Double4DividingScalar(_ s:Double, _ v:Double4) -> Double4 {
+	return Double4FromSimd(s / Double4ToSimd(v))
+}
+@_transparent public func Double4ModulusByScalar(_ v:Double4, _ s:Double) -> Double4 {
+	return Double4Modulus(v, Double4(x: s, y: s, z: s, w: s))
+}
+@_transparent public func Double4ModulusingScalar(_ s:Double, _ v:Double4) -> Double4 {
+	return Double4Modulus(Double4(x: s, y: s, z: s, w: s), v)
+}
+
+@_alwaysEmitIntoClient public func Double4LessThan(_ a:Double4, _ b:Double4) -> Bool {
+	return all(a.simdValue .< b.simdValue)
+}
+@_alwaysEmitIntoClient public func Double4LessThanOrEqual(_ a:Double4, _ b:Double4) -> Bool {
+	return all(a.simdValue .<= b.simdValue)
+}
+@_alwaysEmitIntoClient public func Double4GreaterThan(_ a:Double4, _ b:Double4) -> Bool {
+	return all(a.simdValue .> b.simdValue)
+}
+@_alwaysEmitIntoClient public func Double4GreaterThanOrEqual(_ a:Double4, _ b:Double4) -> Bool {
+	return all(a.simdValue .>= b.simdValue)
+}
+
+
+
+// MARK: Float4 Conversion
+
+@_transparent public func Double4ToFloat4(_ value:Double4) -> Float4 {
+	return Float4(x: Float(value.x), y: Float(value.y), z: Float(value.z), w: Float(value.w))
+}
+@_transparent public func Double4FromFloat4(_ value:Float4) -> Double4 {
+	return Double4(x: Double(value.x), y: Double(value.y), z: Double(value.z), w: Double(value.w))
+}
+
+
+
+// MARK: Array Operations
+
+@_alwaysEmitIntoClient public func Double4AddArrays(_ a:UnsafePointer<Double4>, _ b:UnsafePointer<Double4>, _ out:UnsafeMutablePointer<Double4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4Add(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double4SubtractArrays(_ a:UnsafePointer<Double4>, _ b:UnsafePointer<Double4>, _ out:UnsafeMutablePointer<Double4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4Subtract(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double4MultiplyArrays(_ a:UnsafePointer<Double4>, _ b:UnsafePointer<Double4>, _ out:UnsafeMutablePointer<Double4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4Multiply(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double4DivideArrays(_ a:UnsafePointer<Double4>, _ b:UnsafePointer<Double4>, _ out:UnsafeMutablePointer<Double4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4Divide(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double4ModulusArrays(_ a:UnsafePointer<Double4>, _ b:UnsafePointer<Double4>, _ out:UnsafeMutablePointer<Double4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4Modulus(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double4NegateArray(_ v:UnsafePointer<Double4>, _ out:UnsafeMutablePointer<Double4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4Negate(v[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double4MultiplyByScalarArray(_ v:UnsafePointer<Double4>, _ s:Double, _ out:UnsafeMutablePointer<Double4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4MultiplyByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Double4DivideByScalarArray(_ v:UnsafePointer<Double4>, _ s:Double, _ out:UnsafeMutablePointer<Double4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4DivideByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Double4ModulusByScalarArray(_ v:UnsafePointer<Double4>, _ s:Double, _ out:UnsafeMutablePointer<Double4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4ModulusByScalar(v[i], s)
+	}
+}
+
+
+
+// MARK: Bulk Float4 Conversion
+
+@_alwaysEmitIntoClient public func Double4ArrayToFloat4Array(_ values:UnsafePointer<Double4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4ToFloat4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Double4ArrayFromFloat4Array(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Double4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4FromFloat4(values[i])
+	}
+}
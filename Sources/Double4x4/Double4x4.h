@@ -0,0 +1,224 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Double3.h>)
+	#import <Vuckt/Double3.h>
+#else
+	#include "../Double3/Double3.h"
+#endif
+#if __has_include(<Vuckt/Double4.h>)
+	#import <Vuckt/Double4.h>
+#else
+	#include "../Double4/Double4.h"
+#endif
+#if __has_include(<Vuckt/Float4x4.h>)
+	#import <Vuckt/Float4x4.h>
+#else
+	#include "../Float4x4/Float4x4.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 4×4 matrix of `double`s (column-major, like `Float4x4`), for transforms positioned too far out for `float`'s precision.
+/// Rebase to `Float4x4` relative to a nearby origin for rendering, with `Double4x4RebaseToFloat4x4()` (model matrices) & `Double4x4RebaseViewToFloat4x4()` (view matrices).
+struct Double4x4 {
+	double m00 __attribute__((aligned(__alignof__(simd_double4))));
+	double m01;
+	double m02;
+	double m03;
+	double m10 __attribute__((aligned(__alignof__(simd_double4))));
+	double m11;
+	double m12;
+	double m13;
+	double m20 __attribute__((aligned(__alignof__(simd_double4))));
+	double m21;
+	double m22;
+	double m23;
+	double m30 __attribute__((aligned(__alignof__(simd_double4))));
+	double m31;
+	double m32;
+	double m33;
+} __attribute__((aligned(__alignof__(simd_double4x4)))) VUCKT_SIMD_MAY_ALIAS;
+typedef struct Double4x4 Double4x4;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Double4x4` struct to `simd_double4x4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_double4x4 Double4x4ToSimd(Double4x4 structValue) {
+	return *(simd_double4x4 *)&structValue;
+}
+/// Converts a `Double4x4` struct from `simd_double4x4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Double4x4 Double4x4FromSimd(simd_double4x4 simdValue) {
+	return *(Double4x4 *)&simdValue;
+}
+
+
+
+#pragma mark SIMD-Accelerated Operator Access
+
+NS_INLINE Double4x4 Double4x4OuterProduct(Double4 a, Double4 b) {
+	simd_double4 a_simd = Double4ToSimd(a);
+	simd_double4x4 result = { {
+		(a_simd * b.x), (a_simd * b.y), (a_simd * b.z), (a_simd * b.w)
+	} };
+	return Double4x4FromSimd(result);
+}
+
+/// `a * b`, column-broadcast: each column of the result is `a`'s columns scaled by the components of `b`'s matching column & summed.
+NS_INLINE Double4x4 Double4x4Concatenate(Double4x4 a, Double4x4 b) {
+	simd_double4x4 a_simd = Double4x4ToSimd(a), b_simd = Double4x4ToSimd(b);
+	simd_double4 a0 = a_simd.columns[0], a1 = a_simd.columns[1], a2 = a_simd.columns[2], a3 = a_simd.columns[3];
+	simd_double4 b0 = b_simd.columns[0], b1 = b_simd.columns[1], b2 = b_simd.columns[2], b3 = b_simd.columns[3];
+	simd_double4x4 result = { {
+		(a0 * b0[0] + a1 * b0[1] + a2 * b0[2] + a3 * b0[3]),
+		(a0 * b1[0] + a1 * b1[1] + a2 * b1[2] + a3 * b1[3]),
+		(a0 * b2[0] + a1 * b2[1] + a2 * b2[2] + a3 * b2[3]),
+		(a0 * b3[0] + a1 * b3[1] + a2 * b3[2] + a3 * b3[3]),
+	} };
+	return Double4x4FromSimd(result);
+}
+
+/// Returns the inverse of `m`, via the adjugate built from 2×2 sub-determinants.  (Singular matrices produce infinities/NaNs, as `simd_inverse()` does.)
+NS_INLINE Double4x4 Double4x4Inverse(Double4x4 m) {
+	double s0 = m.m00 * m.m11 - m.m10 * m.m01;
+	double s1 = m.m00 * m.m12 - m.m10 * m.m02;
+	double s2 = m.m00 * m.m13 - m.m10 * m.m03;
+	double s3 = m.m01 * m.m12 - m.m11 * m.m02;
+	double s4 = m.m01 * m.m13 - m.m11 * m.m03;
+	double s5 = m.m02 * m.m13 - m.m12 * m.m03;
+	double c5 = m.m22 * m.m33 - m.m32 * m.m23;
+	double c4 = m.m21 * m.m33 - m.m31 * m.m23;
+	double c3 = m.m21 * m.m32 - m.m31 * m.m22;
+	double c2 = m.m20 * m.m33 - m.m30 * m.m23;
+	double c1 = m.m20 * m.m32 - m.m30 * m.m22;
+	double c0 = m.m20 * m.m31 - m.m30 * m.m21;
+	double inverseDeterminant = 1.0 / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+	return (Double4x4){
+		( m.m11 * c5 - m.m12 * c4 + m.m13 * c3) * inverseDeterminant,
+		(-m.m01 * c5 + m.m02 * c4 - m.m03 * c3) * inverseDeterminant,
+		( m.m31 * s5 - m.m32 * s4 + m.m33 * s3) * inverseDeterminant,
+		(-m.m21 * s5 + m.m22 * s4 - m.m23 * s3) * inverseDeterminant,
+		(-m.m10 * c5 + m.m12 * c2 - m.m13 * c1) * inverseDeterminant,
+		( m.m00 * c5 - m.m02 * c2 + m.m03 * c1) * inverseDeterminant,
+		(-m.m30 * s5 + m.m32 * s2 - m.m33 * s1) * inverseDeterminant,
+		( m.m20 * s5 - m.m22 * s2 + m.m23 * s1) * inverseDeterminant,
+		( m.m10 * c4 - m.m11 * c2 + m.m13 * c0) * inverseDeterminant,
+		(-m.m00 * c4 + m.m01 * c2 - m.m03 * c0) * inverseDeterminant,
+		( m.m30 * s4 - m.m31 * s2 + m.m33 * s0) * inverseDeterminant,
+		(-m.m20 * s4 + m.m21 * s2 - m.m23 * s0) * inverseDeterminant,
+		(-m.m10 * c3 + m.m11 * c1 - m.m12 * c0) * inverseDeterminant,
+		( m.m00 * c3 - m.m01 * c1 + m.m02 * c0) * inverseDeterminant,
+		(-m.m30 * s3 + m.m31 * s1 - m.m32 * s0) * inverseDeterminant,
+		( m.m20 * s3 - m.m21 * s1 + m.m22 * s0) * inverseDeterminant,
+	};
+}
+
+
+
+#pragma mark Float4x4 Conversion
+
+/// Narrows each element to `float`, rounding to nearest.  (For a transform far from the origin, prefer `Double4x4RebaseToFloat4x4()`, which keeps the translation's precision.)
+NS_INLINE Float4x4 Double4x4ToFloat4x4(Double4x4 m) {
+	return (Float4x4){
+		(float)m.m00, (float)m.m01, (float)m.m02, (float)m.m03,
+		(float)m.m10, (float)m.m11, (float)m.m12, (float)m.m13,
+		(float)m.m20, (float)m.m21, (float)m.m22, (float)m.m23,
+		(float)m.m30, (float)m.m31, (float)m.m32, (float)m.m33,
+	};
+}
+/// Widens each element to `double` (exactly).
+NS_INLINE Double4x4 Double4x4FromFloat4x4(Float4x4 m) {
+	return (Double4x4){
+		m.m00, m.m01, m.m02, m.m03,
+		m.m10, m.m11, m.m12, m.m13,
+		m.m20, m.m21, m.m22, m.m23,
+		m.m30, m.m31, m.m32, m.m33,
+	};
+}
+
+
+
+#pragma mark Batch Transforms
+
+/// `out[i] = (m * Double4(points[i], 1)).xyz`, or with `perspectiveDivide`, that divided by its `w`.  (Column-broadcast, as `Float4x4TransformPoints()` is.)
+/// `out` may be the same array as the input (for in-place operation), but must not otherwise overlap it.
+NS_INLINE void Double4x4TransformPoints(Double4x4 m, const Double3 *points, Double3 *out, size_t n, bool perspectiveDivide) {
+	simd_double4x4 m_simd = Double4x4ToSimd(m);
+	simd_double4 c0 = m_simd.columns[0], c1 = m_simd.columns[1], c2 = m_simd.columns[2], c3 = m_simd.columns[3];
+	for (size_t i = 0; i < n; ++i) {
+		Double3 p = points[i];
+		simd_double4 r = c0 * p.x + c1 * p.y + c2 * p.z + c3;
+		if (perspectiveDivide) {
+			r = r / r[3];
+		}
+		out[i] = (Double3){ r[0], r[1], r[2] };
+	}
+}
+
+
+
+#pragma mark Origin Rebasing
+
+// Camera-relative counterparts of `Double3RebaseArrayToFloat3Array()` for matrices: the translation (the only part that grows with distance from the origin) is moved to `origin` in `double`, so the narrowed `Float4x4` carries only the small offset.
+// Rebase model matrices & the view matrix to the same `origin` (typically the camera's position): `rebasedView * rebasedModel` is then `view * model` to within `float` rounding of the nearby values, without either large translation reaching `float`.
+
+/// `translation(-origin) * m`, narrowed to `Float4x4`— `m`'s transform, re-expressed relative to `origin`.  For model (object-to-world) matrices.
+NS_INLINE Float4x4 Double4x4RebaseToFloat4x4(Double4x4 m, Double3 origin) {
+	// Translating by -origin subtracts `origin` scaled by each column's `w` from that column's `xyz`.
+	return (Float4x4){
+		(float)(m.m00 - origin.x * m.m03), (float)(m.m01 - origin.y * m.m03), (float)(m.m02 - origin.z * m.m03), (float)m.m03,
+		(float)(m.m10 - origin.x * m.m13), (float)(m.m11 - origin.y * m.m13), (float)(m.m12 - origin.z * m.m13), (float)m.m13,
+		(float)(m.m20 - origin.x * m.m23), (float)(m.m21 - origin.y * m.m23), (float)(m.m22 - origin.z * m.m23), (float)m.m23,
+		(float)(m.m30 - origin.x * m.m33), (float)(m.m31 - origin.y * m.m33), (float)(m.m32 - origin.z * m.m33), (float)m.m33,
+	};
+}
+/// `view * translation(origin)`, narrowed to `Float4x4`— a view (world-to-camera) matrix for geometry rebased to `origin`.
+/// With `origin` at the camera's position, the result's translation is ~0, so none of `view`'s large translation is lost to `float`.
+NS_INLINE Float4x4 Double4x4RebaseViewToFloat4x4(Double4x4 view, Double3 origin) {
+	// Only the translation column changes: it becomes `view` applied to the point `origin`.
+	simd_double4x4 view_simd = Double4x4ToSimd(view);
+	simd_double4 translation = view_simd.columns[0] * origin.x + view_simd.columns[1] * origin.y + view_simd.columns[2] * origin.z + view_simd.columns[3];
+	return (Float4x4){
+		(float)view.m00, (float)view.m01, (float)view.m02, (float)view.m03,
+		(float)view.m10, (float)view.m11, (float)view.m12, (float)view.m13,
+		(float)view.m20, (float)view.m21, (float)view.m22, (float)view.m23,
+		(float)translation[0], (float)translation[1], (float)translation[2], (float)translation[3],
+	};
+}
+
+/// `out[i] = Double4x4RebaseToFloat4x4(matrices[i], origin)`, in one pass.
+NS_INLINE void Double4x4RebaseArrayToFloat4x4Array(const Double4x4 *matrices, Double3 origin, Float4x4 *out, size_t n) {
+	// Per column: `xyz -= origin * w`, as one multiply-subtract & one narrowing conversion of the whole column.
+	const simd_double4 *columns = (const simd_double4 *)matrices;
+	simd_float4 *outColumns = (simd_float4 *)out;
+	const simd_double4 originLanes = { origin.x, origin.y, origin.z, 0 };
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n * 4; ++i) {
+		simd_double4 column = columns[i];
+		outColumns[i] = __builtin_convertvector(column - originLanes * column[3], simd_float4);
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,26 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Double4x4.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Double4x4, m00) == sizeof(simd_double1),
+	"Double4x4's first member's size does not match simd_double1's on this platform.");
+static_assert((offsetof(Double4x4, m10) - offsetof(Double4x4, m00)) == sizeof(simd_double4),
+	"Double4x4's 1st column's size does not match simd_double4's on this platform.");
+static_assert((offsetof(Double4x4, m20) - offsetof(Double4x4, m10)) == sizeof(simd_double4),
+	"Double4x4's 2nd column's size does not match simd_double4's on this platform.");
+static_assert((offsetof(Double4x4, m30) - offsetof(Double4x4, m20)) == sizeof(simd_double4),
+	"Double4x4's 3rd column's size does not match simd_double4's on this platform.");
+static_assert((sizeof(Double4x4) - offsetof(Double4x4, m30)) == sizeof(simd_double4),
+	"Double4x4's 4th column's size does not match simd_double4's on this platform.");
+static_assert(sizeof_member(Double4x4, m00) == sizeof_member(simd_double4x4, columns[0].x),
+	"Double4x4's first member's size does not match simd_double4x4's first member's on this platform.");
+static_assert(sizeof(Double4x4) == sizeof(simd_double4x4),
+	"Double4x4's size does not match simd_double4x4's on this platform.");
+static_assert(alignof(Double4x4) == alignof(simd_double4x4),
+	"Double4x4's alignment requirements does not match simd_double4x4's on this platform.");
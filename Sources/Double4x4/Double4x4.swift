@@ -0,0 +1,280 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+/// 4×4 `Double`-element matrix, for transforms positioned too far from the origin for `Float4x4`'s precision.
+extension Double4x4
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified members.
+	@_transparent public init(
+		_ m00:Double, _ m01:Double, _ m02:Double, _ m03:Double,
+		_ m10:Double, _ m11:Double, _ m12:Double, _ m13:Double,
+		_ m20:Double, _ m21:Double, _ m22:Double, _ m23:Double,
+		_ m30:Double, _ m31:Double, _ m32:Double, _ m33:Double
+	) {
+		self.init(
+			m00: m00, m01: m01, m02: m02, m03: m03,
+			m10: m10, m11: m11, m12: m12, m13: m13,
+			m20: m20, m21: m21, m22: m22, m23: m23,
+			m30: m30, m31: m31, m32: m32, m33: m33
+		)
+	}
+	/// Initialize a vector with the specified column vectors.
+	@_transparent public init(columns c0:Double4, _ c1:Double4, _ c2:Double4, _ c3:Double4) {
+		self.init(
+			c0.x, c0.y, c0.z, c0.w,
+			c1.x, c1.y, c1.z, c1.w,
+			c2.x, c2.y, c2.z, c2.w,
+			c3.x, c3.y, c3.z, c3.w
+		)
+	}
+	
+	/// Initialize to a vector with diagonal elements equal to `scalar`.
+	@_transparent public init(diagonal scalar:Double) {
+		self.init(diagonal: Double4(scalar: scalar))
+	}
+	
+	/// Initialize to a vector with diagonal elements equal to `vector`.
+	@_transparent public init(diagonal vector:Double4) {
+		self.init(
+			vector.x, 0, 0, 0,
+			0, vector.y, 0, 0,
+			0, 0, vector.z, 0,
+			0, 0, 0, vector.w
+		)
+	}
+	
+	/// Initialize to a SIMD vector.
+	@_transparent public init(_ value:simd_double4x4) {
+		self = Double4x4FromSimd(value)
+	}
+	
+	/// Initialize from a `Float4x4` matrix, widening each element (exactly).
+	@_transparent public init(_ float4x4Value:Float4x4) {
+		self = Double4x4FromFloat4x4(float4x4Value)
+	}
+	
+	/// Initialize to a vector with elements taken from `array`.
+	///
+	/// - Precondition: `array` must have exactly sixteen elements.
+	@_transparent public init(array columnMajorArray:[Double]) {
+		precondition(columnMajorArray.count == 16)
+		self.init(
+			columnMajorArray[0], columnMajorArray[1], columnMajorArray[2], columnMajorArray[3],
+			columnMajorArray[4], columnMajorArray[5], columnMajorArray[6], columnMajorArray[7],
+			columnMajorArray[8], columnMajorArray[9], columnMajorArray[10], columnMajorArray[11],
+			columnMajorArray[12], columnMajorArray[13], columnMajorArray[14], columnMajorArray[15]
+		)
+	}
+	
+	
+	public init(scale:Double3) {
+		self.init(diagonal: Double4(scale.x, scale.y, scale.z, 1))
+	}
+	
+	public init(translation:Double3) {
+		self.init(
+			1, 0, 0, 0,
+			0, 1, 0, 0,
+			0, 0, 1, 0,
+			translation.x, translation.y, translation.z, 1
+		)
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Double4x4 { return Double4x4() }
+	@_transparent public static var identity:Double4x4 { return Double4x4(diagonal: 1) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	@_transparent public var asArray:[Double] {
+		return [ self.m00, self.m01, self.m02, self.m03, self.m10, self.m11, self.m12, self.m13, self.m20, self.m21, self.m22, self.m23, self.m30, self.m31, self.m32, self.m33 ]
+	}
+	
+	/// Each element narrowed to `Float`, rounding to nearest.  (For a transform far from the origin, prefer `rebased(origin:)`.)
+	@_transparent public var float4x4Value:Float4x4 {
+		return Double4x4ToFloat4x4(self)
+	}
+	
+	
+	// MARK: Column (`Double4`) Accessors
+	
+	@_transparent public var c0:Double4 {
+		get { return Double4(m00, m01, m02, m03) }
+		set { ( self.m00, self.m01, self.m02, self.m03 ) = ( newValue.x, newValue.y, newValue.z, newValue.w ) }
+	}
+	@_transparent public var c1:Double4 {
+		get { return Double4(m10, m11, m12, m13) }
+		set { ( self.m10, self.m11, self.m12, self.m13 ) = ( newValue.x, newValue.y, newValue.z, newValue.w ) }
+	}
+	@_transparent public var c2:Double4 {
+		get { return Double4(m20, m21, m22, m23) }
+		set { ( self.m20, self.m21, self.m22, self.m23 ) = ( newValue.x, newValue.y, newValue.z, newValue.w ) }
+	}
+	@_transparent public var c3:Double4 {
+		get { return Double4(m30, m31, m32, m33) }
+		set { ( self.m30, self.m31, self.m32, self.m33 ) = ( newValue.x, newValue.y, newValue.z, newValue.w ) }
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	@_transparent public var simdValue:simd_double4x4 {
+		return Double4x4ToSimd(self)
+	}
+	
+	
+	// MARK: Is… Flags
+	
+	@_transparent public var isZero:Bool {
+		return self == Self.zero
+	}
+	@_transparent public var isIdentity:Bool {
+		return self == Self.identity
+	}
+	@_transparent public var isFinite:Bool {
+		return self.c0.isFinite && self.c1.isFinite && self.c2.isFinite && self.c3.isFinite
+	}
+	@_transparent public var isNaN:Bool {
+		return self.c0.isNaN || self.c1.isNaN || self.c2.isNaN || self.c3.isNaN
+	}
+}
+
+
+extension Float4x4
+{
+	/// Initialize from a `Double4x4` matrix, narrowing each element (rounding to nearest).
+	@_transparent public init(_ double4x4Value:Double4x4) {
+		self = Double4x4ToFloat4x4(double4x4Value)
+	}
+}
+
+
+extension Double4x4 : CustomStringConvertible
+{
+	public var description:String {
+		return "[\(self.c0), \(self.c1), \(self.c2), \(self.c3)]"
+	}
+}
+
+
+extension Double4x4 : Equatable
+{
+	@_transparent public static func ==(a:Double4x4, b:Double4x4) -> Bool {
+		return a.c0 == b.c0 && a.c1 == b.c1 && a.c2 == b.c2 && a.c3 == b.c3
+	}
+}
+
+
+extension Double4x4 // Basic Math Operations
+{
+	@_transparent public static func * (a:Double4x4, b:Double4x4) -> Double4x4 { return a.concatenating(b) }
+	@_transparent public func concatenating(_ other:Double4x4) -> Double4x4 {
+		return Double4x4Concatenate(self, other)
+	}
+	@_transparent public static func *= (m:inout Double4x4, o:Double4x4) { m.concatenate(o) }
+	@_transparent public mutating func concatenate(_ other:Double4x4) {
+		self = self.concatenating(other)
+	}
+	
+	
+	@_transparent public static func * (m:Double4x4, columnVector:Double4) -> Double4 {
+		return m.c0 * columnVector.x + m.c1 * columnVector.y + m.c2 * columnVector.z + m.c3 * columnVector.w
+	}
+}
+
+
+extension Double4x4 // Geometric Math Operations
+{
+	@_transparent public func inversed() -> Double4x4 {
+		return Double4x4Inverse(self)
+	}
+	@_transparent public mutating func inverse() {
+		self = self.inversed()
+	}
+	
+	
+	@_transparent public func translated(by translation:Double3) -> Double4x4 {
+		return Double4x4(columns:
+			self.c0,
+			self.c1,
+			self.c2,
+			self.c3 + Double4(translation.x, translation.y, translation.z, 0)
+		)
+	}
+	@_transparent public mutating func translate(by translation:Double3) {
+		self = self.translated(by: translation)
+	}
+}
+
+
+extension Double4x4 // Batch Transforms
+{
+	/// Transforms each point in `points` (as `w = 1`) into `out`, dividing each result by its `w` if `perspectiveDivide` is set.  (Both buffers must have the same count; they may be the same buffer, but must not otherwise overlap.)
+	@_alwaysEmitIntoClient public func transformPoints(_ points:UnsafeBufferPointer<Double3>, into out:UnsafeMutableBufferPointer<Double3>, perspectiveDivide:Bool = false) {
+		points._vucktBulkOperation(into: out){ Double4x4TransformPoints(self, $0, $1, $2, perspectiveDivide) }
+	}
+	@_alwaysEmitIntoClient public func transformedPoints(_ points:[Double3], perspectiveDivide:Bool = false) -> [Double3] {
+		return points._vucktBulkOperation{ Double4x4TransformPoints(self, $0, $1, $2, perspectiveDivide) }
+	}
+}
+
+
+extension Double4x4 // Origin Rebasing
+{
+	/// This (model) matrix re-expressed relative to `origin`, narrowed to `Float4x4`— pair with `view.rebasedView(origin:)` for the same `origin` (typically the camera's position), so neither matrix's large translation reaches `Float`.
+	@_transparent public func rebased(origin:Double3) -> Float4x4 {
+		return Double4x4RebaseToFloat4x4(self, origin)
+	}
+	/// This view matrix, for geometry rebased to `origin`, narrowed to `Float4x4`.
+	@_transparent public func rebasedView(origin:Double3) -> Float4x4 {
+		return Double4x4RebaseViewToFloat4x4(self, origin)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Double4x4 // Origin Rebasing
+{
+	/// Writes every (model) matrix re-expressed relative to `origin`, narrowed, into `out`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func rebase(origin:Double3, into out:UnsafeMutableBufferPointer<Float4x4>) {
+		self._vucktBulkConversion(into: out){ Double4x4RebaseArrayToFloat4x4Array($0, origin, $1, $2) }
+	}
+}
+
+extension Array where Element == Double4x4 // Origin Rebasing
+{
+	/// Every (model) matrix re-expressed relative to `origin`, narrowed— see `Double4x4.rebased(origin:)`.
+	@_alwaysEmitIntoClient public func rebased(origin:Double3) -> [Float4x4] {
+		return self._vucktBulkConversion{ Double4x4RebaseArrayToFloat4x4Array($0, origin, $1, $2) }
+	}
+}
+
+
+extension Double4x4 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			self.asArray.forEach{ hasher.combine($0) }
+		}
+	#else
+		public var hashValue:Int {
+			return self.asArray.reduce(0){ $0 &* 31 &+ $1.hashValue }
+		}
+	#endif
+}
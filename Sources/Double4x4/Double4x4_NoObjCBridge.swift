@@ -0,0 +1,178 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Double4x4
+{
+	public var m00: Double
+	public var m01: Double
+	public var m02: Double
+	public var m03: Double
+	public var m10: Double
+	public var m11: Double
+	public var m12: Double
+	public var m13: Double
+	public var m20: Double
+	public var m21: Double
+	public var m22: Double
+	public var m23: Double
+	public var m30: Double
+	public var m31: Double
+	public var m32: Double
+	public var m33: Double
+	
+	public init() {
+		self.m00 = Double()
+		self.m01 = Double()
+		self.m02 = Double()
+		self.m03 = Double()
+		self.m10 = Double()
+		self.m11 = Double()
+		self.m12 = Double()
+		self.m13 = Double()
+		self.m20 = Double()
+		self.m21 = Double()
+		self.m22 = Double()
+		self.m23 = Double()
+		self.m30 = Double()
+		self.m31 = Double()
+		self.m32 = Double()
+		self.m33 = Double()
+	}
+	
+	public init(m00:Double, m01:Double, m02:Double, m03:Double, m10:Double, m11:Double, m12:Double, m13:Double, m20:Double, m21:Double, m22:Double, m23:Double, m30:Double, m31:Double, m32:Double, m33:Double) {
+		self.m00 = m00
+		self.m01 = m01
+		self.m02 = m02
+		self.m03 = m03
+		self.m10 = m10
+		self.m11 = m11
+		self.m12 = m12
+		self.m13 = m13
+		self.m20 = m20
+		self.m21 = m21
+		self.m22 = m22
+		self.m23 = m23
+		self.m30 = m30
+		self.m31 = m31
+		self.m32 = m32
+		self.m33 = m33
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Double4x4` struct to `simd_double4x4` vector using passing-individual-members initialization.
+@_transparent public func Double4x4ToSimd(_ structValue:Double4x4) -> simd_double4x4 {
+	return simd_double4x4(
+		simd_double4(structValue.m00, structValue.m01, structValue.m02, structValue.m03),
+		simd_double4(structValue.m10, structValue.m11, structValue.m12, structValue.m13),
+		simd_double4(structValue.m20, structValue.m21, structValue.m22, structValue.m23),
+		simd_double4(structValue.m30, structValue.m31, structValue.m32, structValue.m33)
+	)
+}
+/// Converts a `Double4x4` struct from `simd_double4x4` vector using passing-individual-members initialization.
+@_transparent public func Double4x4FromSimd(_ simdValue:simd_double4x4) -> Double4x4 {
+	return Double4x4(
+		m00: simdValue[0, 0], m01: simdValue[0, 1], m02: simdValue[0, 2], m03: simdValue[0, 3],
+		m10: simdValue[1, 0], m11: simdValue[1, 1], m12: simdValue[1, 2], m13: simdValue[1, 3],
+		m20: simdValue[2, 0], m21: simdValue[2, 1], m22: simdValue[2, 2], m23: simdValue[2, 3],
+		m30: simdValue[3, 0], m31: simdValue[3, 1], m32: simdValue[3, 2], m33: simdValue[3, 3]
+	)
+}
+
+
+
+// MARK: SIMD-Accelerated Operator Access
+
+@_transparent public func Double4x4OuterProduct(_ a:Double4, _ b:Double4) -> Double4x4 {
+	let a_simd = Double4ToSimd(a)
+	return Double4x4FromSimd(simd_double4x4(
+		(a_simd * b.x), (a_simd * b.y), (a_simd * b.z), (a_simd * b.w)
+	))
+}
+
+@_transparent public func Double4x4Concatenate(_ a:Double4x4, _ b:Double4x4) -> Double4x4 {
+	return Double4x4FromSimd(simd_mul(Double4x4ToSimd(a), Double4x4ToSimd(b)))
+}
+
+@_transparent public func Double4x4Inverse(_ m:Double4x4) -> Double4x4 {
+	return Double4x4FromSimd(simd_inverse(Double4x4ToSimd(m)))
+}
+
+
+
+// MARK: Float4x4 Conversion
+
+@_transparent public func Double4x4ToFloat4x4(_ m:Double4x4) -> Float4x4 {
+	return Float4x4(
+		m00: Float(m.m00), m01: Float(m.m01), m02: Float(m.m02), m03: Float(m.m03),
+		m10: Float(m.m10), m11: Float(m.m11), m12: Float(m.m12), m13: Float(m.m13),
+		m20: Float(m.m20), m21: Float(m.m21), m22: Float(m.m22), m23: Float(m.m23),
+		m30: Float(m.m30), m31: Float(m.m31), m32: Float(m.m32), m33: Float(m.m33)
+	)
+}
+@_transparent public func Double4x4FromFloat4x4(_ m:Float4x4) -> Double4x4 {
+	return Double4x4(
+		m00: Double(m.m00), m01: Double(m.m01), m02: Double(m.m02), m03: Double(m.m03),
+		m10: Double(m.m10), m11: Double(m.m11), m12: Double(m.m12), m13: Double(m.m13),
+		m20: Double(m.m20), m21: Double(m.m21), m22: Double(m.m22), m23: Double(m.m23),
+		m30: Double(m.m30), m31: Double(m.m31), m32: Double(m.m32), m33: Double(m.m33)
+	)
+}
+
+
+
+// MARK: Batch Transforms
+
+@_alwaysEmitIntoClient public func Double4x4TransformPoints(_ m:Double4x4, _ points:UnsafePointer<Double3>, _ out:UnsafeMutablePointer<Double3>, _ n:Int, _ perspectiveDivide:Bool) {
+	let m_simd = Double4x4ToSimd(m)
+	for i in 0..<n {
+		let p = points[i]
+		var r = simd_mul(m_simd, simd_double4(p.x, p.y, p.z, 1))
+		if perspectiveDivide {
+			r /= r.w
+		}
+		out[i] = Double3(x: r.x, y: r.y, z: r.z)
+	}
+}
+
+
+
+// MARK: Origin Rebasing
+
+@_alwaysEmitIntoClient public func Double4x4RebaseToFloat4x4(_ m:Double4x4, _ origin:Double3) -> Float4x4 {
+	return Float4x4(
+		m00: Float(m.m00 - origin.x * m.m03), m01: Float(m.m01 - origin.y * m.m03), m02: Float(m.m02 - origin.z * m.m03), m03: Float(m.m03),
+		m10: Float(m.m10 - origin.x * m.m13), m11: Float(m.m11 - origin.y * m.m13), m12: Float(m.m12 - origin.z * m.m13), m13: Float(m.m13),
+		m20: Float(m.m20 - origin.x * m.m23), m21: Float(m.m21 - origin.y * m.m23), m22: Float(m.m22 - origin.z * m.m23), m23: Float(m.m23),
+		m30: Float(m.m30 - origin.x * m.m33), m31: Float(m.m31 - origin.y * m.m33), m32: Float(m.m32 - origin.z * m.m33), m33: Float(m.m33)
+	)
+}
+@_alwaysEmitIntoClient public func Double4x4RebaseViewToFloat4x4(_ view:Double4x4, _ origin:Double3) -> Float4x4 {
+	let view_simd = Double4x4ToSimd(view)
+	let translation = simd_mul(view_simd, simd_double4(origin.x, origin.y, origin.z, 1))
+	return Float4x4(
+		m00: Float(view.m00), m01: Float(view.m01), m02: Float(view.m02), m03: Float(view.m03),
+		m10: Float(view.m10), m11: Float(view.m11), m12: Float(view.m12), m13: Float(view.m13),
+		m20: Float(view.m20), m21: Float(view.m21), m22: Float(view.m22), m23: Float(view.m23),
+		m30: Float(translation.x), m31: Float(translation.y), m32: Float(translation.z), m33: Float(translation.w)
+	)
+}
+@_alwaysEmitIntoClient public func Double4x4RebaseArrayToFloat4x4Array(_ matrices:UnsafePointer<Double4x4>, _ origin:Double3, _ out:UnsafeMutablePointer<Float4x4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Double4x4RebaseToFloat4x4(matrices[i], origin)
+	}
+}
@@ -3,18 +3,25 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 #pragma once
 
-#import <Foundation/NSValue.h>
-#import <simd/simd.h>
-#if TARGET_OS_MAC && !TARGET_OS_WATCH
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#if __OBJC__
+	#import <Foundation/NSValue.h>
+#endif
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 	#import <CoreImage/CIVector.h>
 #endif
-#if TARGET_OS_MAC
+#if __OBJC__ && TARGET_OS_MAC
 	#import <CoreGraphics/CGGeometry.h>
 #endif
 
 
 
 NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
 
 
 
@@ -60,11 +67,7 @@ NS_INLINE Float2 Float2Divide(Float2 a, Float2 b) {
 	return Float2FromSimd(Float2ToSimd(a) / Float2ToSimd(b));
 }
 NS_INLINE Float2 Float2Modulus(Float2 a, Float2 b) {
-	#ifdef __cplusplus
-		return Float2FromSimd(simd::fmod(Float2ToSimd(a), Float2ToSimd(b)));
-	#else
-		return Float2FromSimd(fmod(Float2ToSimd(a), Float2ToSimd(b)));
-	#endif
+	return Float2FromSimd(vuckt_simd_fmod(Float2ToSimd(a), Float2ToSimd(b)));
 }
 NS_INLINE Float2 Float2MultiplyByScalar(Float2 v, float s) {
 	return Float2FromSimd(Float2ToSimd(v) * s);
@@ -85,22 +88,108 @@ NS_INLINE Float2 Float2ModulusingScalar(float s, Float2 v) {
 	return Float2Modulus((Float2){ s, s }, v);
 }
 
-NS_INLINE BOOL Float2LessThan(Float2 a, Float2 b) {
+NS_INLINE bool Float2LessThan(Float2 a, Float2 b) {
 	return simd_all(Float2ToSimd(a) < Float2ToSimd(b));
 }
-NS_INLINE BOOL Float2LessThanOrEqual(Float2 a, Float2 b) {
+NS_INLINE bool Float2LessThanOrEqual(Float2 a, Float2 b) {
 	return simd_all(Float2ToSimd(a) <= Float2ToSimd(b));
 }
-NS_INLINE BOOL Float2GreaterThan(Float2 a, Float2 b) {
+NS_INLINE bool Float2GreaterThan(Float2 a, Float2 b) {
 	return simd_all(Float2ToSimd(a) > Float2ToSimd(b));
 }
-NS_INLINE BOOL Float2GreaterThanOrEqual(Float2 a, Float2 b) {
+NS_INLINE bool Float2GreaterThanOrEqual(Float2 a, Float2 b) {
 	return simd_all(Float2ToSimd(a) >= Float2ToSimd(b));
 }
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_WATCH
+#pragma mark Array Operations
+
+// Element-wise operations over `n`-element arrays, for bulk passes that would otherwise pay per-element call & load overhead.
+// `out` may be the same array as an input (for in-place operation), but must not otherwise overlap one.
+// Where possible these loop over the flat `float` lanes rather than per-`Float2`, so the compiler can vectorize across elements at the target's full vector width.
+
+/// `out[i] = a[i] + b[i]`
+NS_INLINE void Float2AddArrays(const Float2 *a, const Float2 *b, Float2 *out, size_t n) {
+	const float *aLanes = (const float *)a, *bLanes = (const float *)b;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float2) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] + bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] - b[i]`
+NS_INLINE void Float2SubtractArrays(const Float2 *a, const Float2 *b, Float2 *out, size_t n) {
+	const float *aLanes = (const float *)a, *bLanes = (const float *)b;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float2) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] - bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] * b[i]`
+NS_INLINE void Float2MultiplyArrays(const Float2 *a, const Float2 *b, Float2 *out, size_t n) {
+	const float *aLanes = (const float *)a, *bLanes = (const float *)b;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float2) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] * bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] / b[i]`
+NS_INLINE void Float2DivideArrays(const Float2 *a, const Float2 *b, Float2 *out, size_t n) {
+	const float *aLanes = (const float *)a, *bLanes = (const float *)b;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float2) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] / bLanes[laneI];
+	}
+}
+/// `out[i] = fmod(a[i], b[i])`
+NS_INLINE void Float2ModulusArrays(const Float2 *a, const Float2 *b, Float2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Float2Modulus(a[i], b[i]);
+	}
+}
+/// `out[i] = -v[i]`
+NS_INLINE void Float2NegateArray(const Float2 *v, Float2 *out, size_t n) {
+	const float *vLanes = (const float *)v;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float2) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = -vLanes[laneI];
+	}
+}
+/// `out[i] = v[i] * s`
+NS_INLINE void Float2MultiplyByScalarArray(const Float2 *v, float s, Float2 *out, size_t n) {
+	const float *vLanes = (const float *)v;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float2) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = vLanes[laneI] * s;
+	}
+}
+/// `out[i] = v[i] / s`
+NS_INLINE void Float2DivideByScalarArray(const Float2 *v, float s, Float2 *out, size_t n) {
+	const float *vLanes = (const float *)v;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float2) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = vLanes[laneI] / s;
+	}
+}
+/// `out[i] = fmod(v[i], s)`
+NS_INLINE void Float2ModulusByScalarArray(const Float2 *v, float s, Float2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Float2ModulusByScalar(v[i], s);
+	}
+}
+
+
+
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 	#pragma mark CoreImage Conversion
 
 	/// Converts an `Float2` struct to `CIVector` class using passing-individual-members initialization.
@@ -112,11 +201,11 @@ NS_INLINE BOOL Float2GreaterThanOrEqual(Float2 a, Float2 b) {
 		assert(ciVector.count == 2);
 		return (Float2){ (simd_float1)ciVector.X, (simd_float1)ciVector.Y };
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_WATCH
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 
 
 
-#if TARGET_OS_MAC
+#if __OBJC__ && TARGET_OS_MAC
 	#pragma mark CoreGraphics Conversion
 
 	/// Converts an `Float2` struct to `CGVector` struct using passing-individual-members initialization.
@@ -145,10 +234,11 @@ NS_INLINE BOOL Float2GreaterThanOrEqual(Float2 a, Float2 b) {
 	NS_INLINE Float2 Float2FromCGSize(CGSize cgSizeValue) {
 		return (Float2){ (simd_float1)cgSizeValue.width, (simd_float1)cgSizeValue.height };
 	}
-#endif // TARGET_OS_MAC
+#endif // __OBJC__ && TARGET_OS_MAC
 
 
 
+#if __OBJC__
 #pragma mark `NSValue`-Wrapping
 
 @interface NSValue (Float2Additions)
@@ -158,7 +248,9 @@ NS_INLINE BOOL Float2GreaterThanOrEqual(Float2 a, Float2 b) {
 @property(nonatomic, readonly) Float2 float2Value;
 
 @end
+#endif // __OBJC__
 
 
 
+VUCKT_DIAGNOSTICS_END
 NS_ASSUME_NONNULL_END
@@ -3,7 +3,14 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
 import Foundation
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
 #if canImport(CoreImage)
 	import CoreImage.CIVector
 #endif
@@ -97,19 +104,19 @@ extension Float2
 	
 	// MARK: commonly-used “presets”
 	
-	public static let zero = Float2(scalar: 0)
+	@_transparent public static var zero:Float2 { return Float2(scalar: 0) }
 	
-	public static let one = Self.positiveOne
-	public static let positiveOne = Float2(scalar: 1)
-	public static let negativeOne = Float2(scalar: -1)
+	@_transparent public static var one:Float2 { return Self.positiveOne }
+	@_transparent public static var positiveOne:Float2 { return Float2(scalar: 1) }
+	@_transparent public static var negativeOne:Float2 { return Float2(scalar: -1) }
 	
-	public static let unitX = Self.unitXPositive
-	public static let unitXPositive = Float2(x: 1)
-	public static let unitY = Self.unitYPositive
-	public static let unitYPositive = Float2(y: 1)
+	@_transparent public static var unitX:Float2 { return Self.unitXPositive }
+	@_transparent public static var unitXPositive:Float2 { return Float2(x: 1) }
+	@_transparent public static var unitY:Float2 { return Self.unitYPositive }
+	@_transparent public static var unitYPositive:Float2 { return Float2(y: 1) }
 	
-	public static let unitXNegative = Float2(x: -1)
-	public static let unitYNegative = Float2(y: -1)
+	@_transparent public static var unitXNegative:Float2 { return Float2(x: -1) }
+	@_transparent public static var unitYNegative:Float2 { return Float2(y: -1) }
 	
 	
 	
@@ -505,19 +512,20 @@ extension Float2 // Geometric Math Operations
 	
 	public enum InterpolationMethod {
 		case linear
+		/// Eases in & out along the cubic Hermite (smoothstep) curve `3t² - 2t³`: from `self` at ratio 0 to `other` at 1, with zero speed at both.
 		case hermite
 	}
 	@_transparent public func interpolated(to other:Float2, ratio:Float, method:Float2.InterpolationMethod = .linear) -> Float2 {
-		return interpolateBetween(self, other, ratio: ratio)
+		return interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	@_transparent public mutating func interpolate(to other:Float2, ratio:Float, method:Float2.InterpolationMethod = .linear) {
-		self = interpolateBetween(self, other, ratio: ratio)
+		self = interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	@_transparent public func interpolated(to other:Float2, ratio:Float2, method:Float2.InterpolationMethod = .linear) -> Float2 {
-		return interpolateBetween(self, other, ratio: ratio)
+		return interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	@_transparent public mutating func interpolate(to other:Float2, ratio:Float2, method:Float2.InterpolationMethod = .linear) {
-		self = interpolateBetween(self, other, ratio: ratio)
+		self = interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	
 	
@@ -563,7 +571,7 @@ extension Float2 // Geometric Math Operations
 		case .linear:
 			return Float2(simd_mix(a.simdValue, b.simdValue, ratio.simdValue))
 		case .hermite:
-			return Float2(simd_smoothstep(a.simdValue, b.simdValue, ratio.simdValue))
+			return Float2(simd_mix(a.simdValue, b.simdValue, simd_smoothstep(Float2.zero.simdValue, Float2.one.simdValue, ratio.simdValue)))
 	}
 }
 
@@ -576,6 +584,113 @@ extension Float2 // Geometric Math Operations
 }
 
 
+extension UnsafeBufferPointer where Element == Float2 // Bulk Math Operations
+{
+	/// Element-wise `self[i] + other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func add(_ other:UnsafeBufferPointer<Float2>, into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkOperation(other, into: out, Float2AddArrays)
+	}
+	/// Element-wise `self[i] - other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func subtract(_ other:UnsafeBufferPointer<Float2>, into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkOperation(other, into: out, Float2SubtractArrays)
+	}
+	/// Element-wise `self[i] * other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func multiply(by other:UnsafeBufferPointer<Float2>, into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkOperation(other, into: out, Float2MultiplyArrays)
+	}
+	/// Element-wise `self[i] / other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func divide(by other:UnsafeBufferPointer<Float2>, into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkOperation(other, into: out, Float2DivideArrays)
+	}
+	/// Element-wise `self[i] % other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:UnsafeBufferPointer<Float2>, into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkOperation(other, into: out, Float2ModulusArrays)
+	}
+	/// Element-wise `-self[i]`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func negate(into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkOperation(into: out, Float2NegateArray)
+	}
+	/// Element-wise `self[i] * scale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func multiply(by scale:Float, into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkOperation(scale, into: out, Float2MultiplyByScalarArray)
+	}
+	/// Element-wise `self[i] / inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func divide(by inverseScale:Float, into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkOperation(inverseScale, into: out, Float2DivideByScalarArray)
+	}
+	/// Element-wise `self[i] % inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Float, into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkOperation(inverseScale, into: out, Float2ModulusByScalarArray)
+	}
+}
+
+extension Array where Element == Float2 // Bulk Math Operations
+{
+	@_alwaysEmitIntoClient public func adding(_ other:[Float2]) -> [Float2] {
+		return self._vucktBulkOperation(other, Float2AddArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func add(_ other:[Float2]) {
+		self._vucktFormBulkOperation(other, Float2AddArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func subtracting(_ other:[Float2]) -> [Float2] {
+		return self._vucktBulkOperation(other, Float2SubtractArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func subtract(_ other:[Float2]) {
+		self._vucktFormBulkOperation(other, Float2SubtractArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by other:[Float2]) -> [Float2] {
+		return self._vucktBulkOperation(other, Float2MultiplyArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by other:[Float2]) {
+		self._vucktFormBulkOperation(other, Float2MultiplyArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by other:[Float2]) -> [Float2] {
+		return self._vucktBulkOperation(other, Float2DivideArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by other:[Float2]) {
+		self._vucktFormBulkOperation(other, Float2DivideArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:[Float2]) -> [Float2] {
+		return self._vucktBulkOperation(other, Float2ModulusArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy other:[Float2]) {
+		self._vucktFormBulkOperation(other, Float2ModulusArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func negated() -> [Float2] {
+		return self._vucktBulkOperation(Float2NegateArray)
+	}
+	@_alwaysEmitIntoClient public mutating func negate() {
+		self._vucktFormBulkOperation(Float2NegateArray)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by scale:Float) -> [Float2] {
+		return self._vucktBulkOperation(scale, Float2MultiplyByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by scale:Float) {
+		self._vucktFormBulkOperation(scale, Float2MultiplyByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by inverseScale:Float) -> [Float2] {
+		return self._vucktBulkOperation(inverseScale, Float2DivideByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by inverseScale:Float) {
+		self._vucktFormBulkOperation(inverseScale, Float2DivideByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Float) -> [Float2] {
+		return self._vucktBulkOperation(inverseScale, Float2ModulusByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy inverseScale:Float) {
+		self._vucktFormBulkOperation(inverseScale, Float2ModulusByScalarArray)
+	}
+}
+
+
 extension Float2 : Hashable
 {
 	private static let _hashingLargePrimes:[UInt] = [ 982_917_223, 3_572_352_083 ]
@@ -2,7 +2,11 @@
 // @author: Slipp Douglas Thompson
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
 #if canImport(CoreImage)
 	import CoreImage.CIVector
 #endif
@@ -99,6 +103,56 @@ public struct Float2
 
 
 
+// MARK: Array Operations
+
+@_alwaysEmitIntoClient public func Float2AddArrays(_ a:UnsafePointer<Float2>, _ b:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float2Add(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float2SubtractArrays(_ a:UnsafePointer<Float2>, _ b:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float2Subtract(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float2MultiplyArrays(_ a:UnsafePointer<Float2>, _ b:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float2Multiply(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float2DivideArrays(_ a:UnsafePointer<Float2>, _ b:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float2Divide(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float2ModulusArrays(_ a:UnsafePointer<Float2>, _ b:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float2Modulus(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float2NegateArray(_ v:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float2Negate(v[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float2MultiplyByScalarArray(_ v:UnsafePointer<Float2>, _ s:Float, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float2MultiplyByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Float2DivideByScalarArray(_ v:UnsafePointer<Float2>, _ s:Float, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float2DivideByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Float2ModulusByScalarArray(_ v:UnsafePointer<Float2>, _ s:Float, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float2ModulusByScalar(v[i], s)
+	}
+}
+
+
+
 #if canImport(CoreImage)
 	// MARK: CoreImage Conversion
 
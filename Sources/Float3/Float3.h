@@ -3,21 +3,28 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 #pragma once
 
-#import <Foundation/NSValue.h>
-#import <simd/simd.h>
-#if TARGET_OS_MAC
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#if __OBJC__
+	#import <Foundation/NSValue.h>
+#endif
+#if __OBJC__ && TARGET_OS_MAC
 	#import <SceneKit/SceneKitTypes.h>
 #endif
-#if TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 	#import <GLKit/GLKVector3.h>
 #endif
-#if TARGET_OS_MAC && !TARGET_OS_WATCH
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 	#import <CoreImage/CIVector.h>
 #endif
 
 
 
 NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
 
 
 
@@ -35,12 +42,24 @@ typedef struct Float3 Float3;
 /// Converts an `Float3` struct to `simd_float3` vector using zero-op/(dangerous?) C-casts.
 /// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
 NS_INLINE simd_float3 Float3ToSimd(Float3 structValue) {
-	return *(simd_float3 *)&structValue;
+	#if VUCKT_SIMD3_IS_SIMD4
+		simd_float3 simdValue;
+		memcpy(&simdValue, &structValue, sizeof simdValue);
+		return __builtin_shuffle(simdValue, (simd_int3){ 0, 1, 2, 2 });
+	#else
+		return *(simd_float3 *)&structValue;
+	#endif
 }
 /// Converts an `Float3` struct from `simd_float3` vector using zero-op/(dangerous?) C-casts.
 /// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
 NS_INLINE Float3 Float3FromSimd(simd_float3 simdValue) {
-	return *(Float3 *)&simdValue;
+	#if VUCKT_SIMD3_IS_SIMD4
+		Float3 structValue;
+		memcpy(&structValue, &simdValue, sizeof structValue);
+		return structValue;
+	#else
+		return *(Float3 *)&simdValue;
+	#endif
 }
 
 
@@ -63,11 +82,7 @@ NS_INLINE Float3 Float3Divide(Float3 a, Float3 b) {
 	return Float3FromSimd(Float3ToSimd(a) / Float3ToSimd(b));
 }
 NS_INLINE Float3 Float3Modulus(Float3 a, Float3 b) {
-	#ifdef __cplusplus
-		return Float3FromSimd(simd::fmod(Float3ToSimd(a), Float3ToSimd(b)));
-	#else
-		return Float3FromSimd(fmod(Float3ToSimd(a), Float3ToSimd(b)));
-	#endif
+	return Float3FromSimd(vuckt_simd_fmod(Float3ToSimd(a), Float3ToSimd(b)));
 }
 NS_INLINE Float3 Float3MultiplyByScalar(Float3 v, float s) {
 	return Float3FromSimd(Float3ToSimd(v) * s);
@@ -88,16 +103,16 @@ NS_INLINE Float3 Float3ModulusingScalar(float s, Float3 v) {
 	return Float3Modulus((Float3){ s, s, s }, v);
 }
 
-NS_INLINE BOOL Float3LessThan(Float3 a, Float3 b) {
+NS_INLINE bool Float3LessThan(Float3 a, Float3 b) {
 	return simd_all(Float3ToSimd(a) < Float3ToSimd(b));
 }
-NS_INLINE BOOL Float3LessThanOrEqual(Float3 a, Float3 b) {
+NS_INLINE bool Float3LessThanOrEqual(Float3 a, Float3 b) {
 	return simd_all(Float3ToSimd(a) <= Float3ToSimd(b));
 }
-NS_INLINE BOOL Float3GreaterThan(Float3 a, Float3 b) {
+NS_INLINE bool Float3GreaterThan(Float3 a, Float3 b) {
 	return simd_all(Float3ToSimd(a) > Float3ToSimd(b));
 }
-NS_INLINE BOOL Float3GreaterThanOrEqual(Float3 a, Float3 b) {
+NS_INLINE bool Float3GreaterThanOrEqual(Float3 a, Float3 b) {
 	return simd_all(Float3ToSimd(a) >= Float3ToSimd(b));
 }
 
@@ -105,9 +120,246 @@ NS_INLINE Float3 Float3WedgeProduct(Float3 a, Float3 b) {
 	return Float3FromSimd(simd_cross(Float3ToSimd(a), Float3ToSimd(b)));
 }
 
+/// The sine & cosine of each of `angles`' components (radians), at full precision.
+NS_INLINE void Float3SinCos(Float3 angles, Float3 *outSin, Float3 *outCos) {
+	*outSin = (Float3){ sinf(angles.x), sinf(angles.y), sinf(angles.z) };
+	*outCos = (Float3){ cosf(angles.x), cosf(angles.y), cosf(angles.z) };
+}
+
+
+
+#pragma mark Fast-Approximate Math
+
+// Faster, approximate counterparts of `Float3`'s `normalized()`, `length()`, & `reciprocal()`, and of the sine/cosine behind the Euler-angle rotation initializers; see `VucktPlatform.h`'s `vuckt_simd_fast_*()` kernels for their error bounds.
+
+/// `v` scaled to unit length, via `vuckt_fast_rsqrtf_unguarded()`.  A zero-length `v` yields NaNs, as the full-precision `normalized()` does.
+NS_INLINE Float3 Float3NormalizeFast(Float3 v) {
+	float inverseLength = vuckt_fast_rsqrtf_unguarded(v.x * v.x + v.y * v.y + v.z * v.z);
+	return (Float3){ v.x * inverseLength, v.y * inverseLength, v.z * inverseLength };
+}
+NS_INLINE float Float3LengthFast(Float3 v) {
+	return vuckt_fast_sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+}
+NS_INLINE Float3 Float3ReciprocalFast(Float3 v) {
+	simd_float4 reciprocal = vuckt_simd_fast_recip4((simd_float4){ v.x, v.y, v.z, v.z });
+	return (Float3){ reciprocal[0], reciprocal[1], reciprocal[2] };
+}
+/// The sine & cosine of each of `angles`' components (radians), computed together.
+NS_INLINE void Float3SinCosFast(Float3 angles, Float3 *outSin, Float3 *outCos) {
+	simd_float4 sinOfAngles, cosOfAngles;
+	vuckt_simd_fast_sincos4((simd_float4){ angles.x, angles.y, angles.z, angles.z }, &sinOfAngles, &cosOfAngles);
+	*outSin = (Float3){ sinOfAngles[0], sinOfAngles[1], sinOfAngles[2] };
+	*outCos = (Float3){ cosOfAngles[0], cosOfAngles[1], cosOfAngles[2] };
+}
+/// The sines & cosines of `scale` times `angles[0..<count]` (`count` ≤ 4), transposed for batch kernels into 3 vectors each: lane `l` of `outSin[axis]` & `outCos[axis]` is for `angles[l]`'s `axis` (0 = x, 1 = y, 2 = z) component, & lanes past `count` repeat the last element.
+/// 3 `vuckt_simd_fast_sincos4()` calls cover all 4 elements; its 2-ULP error (for angles up to 8192 radians) is on par with `Float3SinCos()`.
+NS_INLINE void Float3SinCosLanes(const Float3 *angles, size_t count, float scale, simd_float4 *outSin, simd_float4 *outCos) {
+	simd_float4 x, y, z;
+	for (size_t laneI = 0; laneI < 4; ++laneI) {
+		Float3 v = angles[(laneI < count) ? laneI : count - 1];
+		x[laneI] = v.x;
+		y[laneI] = v.y;
+		z[laneI] = v.z;
+	}
+	vuckt_simd_fast_sincos4(x * scale, &outSin[0], &outCos[0]);
+	vuckt_simd_fast_sincos4(y * scale, &outSin[1], &outCos[1]);
+	vuckt_simd_fast_sincos4(z * scale, &outSin[2], &outCos[2]);
+}
+
+
+
+#pragma mark Array Operations
+
+// Element-wise operations over `n`-element arrays, for bulk passes that would otherwise pay per-element call & load overhead.
+// `out` may be the same array as an input (for in-place operation), but must not otherwise overlap one.
+// Each runs on whole elements' 4-lane storage, 2 at a time as one 8-lane vector where `VUCKT_PAIRED_ARRAY_LANES`, so the compiler works across elements at the target's full vector width.
+// Padding lanes are loaded as `0` (`1` for divisors), so nothing uninitialized is ever operated on, & `out`'s padding lanes keep their values.
+
+/// Loads `element`'s 4-lane storage, its padding lane as `padding`.
+NS_INLINE simd_float4 _Float3LoadLanes(const Float3 *element, float padding) {
+	const simd_int4 dataLanes = { -1, -1, -1, 0 };
+	simd_float4 lanes;
+	memcpy(&lanes, element, sizeof lanes);
+	return (simd_float4)(((simd_int4)lanes & dataLanes) | ((simd_int4)(simd_float4){ padding, padding, padding, padding } & ~dataLanes));
+}
+/// Stores `lanes` to `element`'s storage, but for its padding lane, which keeps its value.
+NS_INLINE void _Float3StoreLanes(Float3 *element, simd_float4 lanes) {
+	const simd_int4 dataLanes = { -1, -1, -1, 0 };
+	simd_float4 original;
+	memcpy(&original, element, sizeof original);
+	lanes = (simd_float4)(((simd_int4)lanes & dataLanes) | ((simd_int4)original & ~dataLanes));
+	memcpy(element, &lanes, sizeof lanes);
+}
+#if VUCKT_PAIRED_ARRAY_LANES
+	/// Loads `elements[0]` & `elements[1]`'s storage as lanes 0–3 & 4–7, their padding lanes as `padding`.
+	NS_INLINE simd_float8 _Float3LoadPairLanes(const Float3 *elements, float padding) {
+		const simd_int8 dataLanes = { -1, -1, -1, 0, -1, -1, -1, 0 };
+		simd_float8 lanes;
+		memcpy(&lanes, elements, sizeof lanes);
+		return (simd_float8)(((simd_int8)lanes & dataLanes) | ((simd_int8)(simd_float8){ padding, padding, padding, padding, padding, padding, padding, padding } & ~dataLanes));
+	}
+	/// Stores `lanes` to `elements[0]` & `elements[1]`'s storage, but for their padding lanes, which keep their values.
+	NS_INLINE void _Float3StorePairLanes(Float3 *elements, simd_float8 lanes) {
+		const simd_int8 dataLanes = { -1, -1, -1, 0, -1, -1, -1, 0 };
+		simd_float8 original;
+		memcpy(&original, elements, sizeof original);
+		lanes = (simd_float8)(((simd_int8)lanes & dataLanes) | ((simd_int8)original & ~dataLanes));
+		memcpy(elements, &lanes, sizeof lanes);
+	}
+#endif
+
+/// `out[i] = a[i] + b[i]`
+NS_INLINE void Float3AddArrays(const Float3 *a, const Float3 *b, Float3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Float3StorePairLanes(&out[i], _Float3LoadPairLanes(&a[i], 0) + _Float3LoadPairLanes(&b[i], 0));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Float3StoreLanes(&out[i], _Float3LoadLanes(&a[i], 0) + _Float3LoadLanes(&b[i], 0));
+	}
+}
+/// `out[i] = a[i] - b[i]`
+NS_INLINE void Float3SubtractArrays(const Float3 *a, const Float3 *b, Float3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Float3StorePairLanes(&out[i], _Float3LoadPairLanes(&a[i], 0) - _Float3LoadPairLanes(&b[i], 0));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Float3StoreLanes(&out[i], _Float3LoadLanes(&a[i], 0) - _Float3LoadLanes(&b[i], 0));
+	}
+}
+/// `out[i] = a[i] * b[i]`
+NS_INLINE void Float3MultiplyArrays(const Float3 *a, const Float3 *b, Float3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Float3StorePairLanes(&out[i], _Float3LoadPairLanes(&a[i], 0) * _Float3LoadPairLanes(&b[i], 0));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Float3StoreLanes(&out[i], _Float3LoadLanes(&a[i], 0) * _Float3LoadLanes(&b[i], 0));
+	}
+}
+/// `out[i] = a[i] / b[i]`
+NS_INLINE void Float3DivideArrays(const Float3 *a, const Float3 *b, Float3 *out, size_t n) {
+	// (Each padding lane is divided by 1, never by 0.)
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Float3StorePairLanes(&out[i], _Float3LoadPairLanes(&a[i], 0) / _Float3LoadPairLanes(&b[i], 1));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Float3StoreLanes(&out[i], _Float3LoadLanes(&a[i], 0) / _Float3LoadLanes(&b[i], 1));
+	}
+}
+/// `out[i] = fmod(a[i], b[i])`
+NS_INLINE void Float3ModulusArrays(const Float3 *a, const Float3 *b, Float3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Float3Modulus(a[i], b[i]);
+	}
+}
+/// `out[i] = -v[i]`
+NS_INLINE void Float3NegateArray(const Float3 *v, Float3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Float3StorePairLanes(&out[i], -_Float3LoadPairLanes(&v[i], 0));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Float3StoreLanes(&out[i], -_Float3LoadLanes(&v[i], 0));
+	}
+}
+/// `out[i] = v[i] * s`
+NS_INLINE void Float3MultiplyByScalarArray(const Float3 *v, float s, Float3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Float3StorePairLanes(&out[i], _Float3LoadPairLanes(&v[i], 0) * s);
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Float3StoreLanes(&out[i], _Float3LoadLanes(&v[i], 0) * s);
+	}
+}
+/// `out[i] = v[i] / s`
+NS_INLINE void Float3DivideByScalarArray(const Float3 *v, float s, Float3 *out, size_t n) {
+	// (Each padding lane is divided by 1, never by 0.)
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		const simd_float8 pairDivisor = { s, s, s, 1, s, s, s, 1 };
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Float3StorePairLanes(&out[i], _Float3LoadPairLanes(&v[i], 0) / pairDivisor);
+		}
+	#endif
+	const simd_float4 divisor = { s, s, s, 1 };
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Float3StoreLanes(&out[i], _Float3LoadLanes(&v[i], 0) / divisor);
+	}
+}
+/// `out[i] = fmod(v[i], s)`
+NS_INLINE void Float3ModulusByScalarArray(const Float3 *v, float s, Float3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Float3ModulusByScalar(v[i], s);
+	}
+}
+/// `out[i] = v[i] / length(v[i])`  (A zero-length `v[i]` yields NaNs, as `normalized()` does.)
+NS_INLINE void Float3NormalizeArray(const Float3 *v, Float3 *out, size_t n) {
+	// 4 elements' lengths at a time, for one vector square root & division per 4.
+	VUCKT_FOR_EACH_BLOCK4(n, i, count, {
+		simd_float4 lengthsSquared = { 1, 1, 1, 1 };
+		for (size_t laneI = 0; laneI < count; ++laneI) {
+			Float3 p = v[i + laneI];
+			lengthsSquared[laneI] = p.x * p.x + p.y * p.y + p.z * p.z;
+		}
+		simd_float4 inverseLengths = 1.0f / vuckt_simd_sqrt4(lengthsSquared);
+		for (size_t laneI = 0; laneI < count; ++laneI) {
+			Float3 p = v[i + laneI];
+			float inverseLength = inverseLengths[laneI];
+			out[i + laneI] = (Float3){ p.x * inverseLength, p.y * inverseLength, p.z * inverseLength };
+		}
+	});
+}
+/// `v[0] + v[1] + … + v[n - 1]`, accumulated as 4 running sums (of every 4th element) added pairwise at the end, so the result depends only on `v` & `n`, not on the target's vector width.
+NS_INLINE Float3 Float3SumArray(const Float3 *v, size_t n) {
+	simd_float3 sum0 = Float3ToSimd((Float3){ 0, 0, 0 }), sum1 = sum0, sum2 = sum0, sum3 = sum0;
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		sum0 += Float3ToSimd(v[i]);
+		sum1 += Float3ToSimd(v[i + 1]);
+		sum2 += Float3ToSimd(v[i + 2]);
+		sum3 += Float3ToSimd(v[i + 3]);
+	}
+	if (i < n) sum0 += Float3ToSimd(v[i++]);
+	if (i < n) sum1 += Float3ToSimd(v[i++]);
+	if (i < n) sum2 += Float3ToSimd(v[i++]);
+	return Float3FromSimd((sum0 + sum1) + (sum2 + sum3));
+}
+
 
 
-#if TARGET_OS_MAC
+#if __OBJC__ && TARGET_OS_MAC
 	#pragma mark SceneKit Conversion
 
 	/// Converts an `Float3` struct to `SCNVector3` struct using SceneKit-provided SIMD↔SCNVector conversion helper function.
@@ -118,11 +370,11 @@ NS_INLINE Float3 Float3WedgeProduct(Float3 a, Float3 b) {
 	NS_INLINE Float3 Float3FromSCN(SCNVector3 scnValue) {
 		return Float3FromSimd(SCNVector3ToFloat3(scnValue));
 	}
-#endif // TARGET_OS_MAC
+#endif // __OBJC__ && TARGET_OS_MAC
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 	#pragma mark GLKit Conversion
 
 	/// Converts an `Float3` struct to `GLKVector3` struct using passing-individual-members initialization.
@@ -133,11 +385,11 @@ NS_INLINE Float3 Float3WedgeProduct(Float3 a, Float3 b) {
 	NS_INLINE Float3 Float3FromGLK(GLKVector3 glkValue) {
 		return (Float3){ glkValue.v[0], glkValue.v[1], glkValue.v[2] };
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_WATCH
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 	#pragma mark CoreImage Conversion
 
 	/// Converts an `Float3` struct to `CIVector` class using passing-individual-members initialization.
@@ -149,10 +401,11 @@ NS_INLINE Float3 Float3WedgeProduct(Float3 a, Float3 b) {
 		assert(ciVector.count == 3);
 		return (Float3){ (simd_float1)ciVector.X, (simd_float1)ciVector.Y, (simd_float1)ciVector.Z };
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_WATCH
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 
 
 
+#if __OBJC__
 #pragma mark `NSValue`-Wrapping
 
 @interface NSValue (Float3Additions)
@@ -162,7 +415,9 @@ NS_INLINE Float3 Float3WedgeProduct(Float3 a, Float3 b) {
 @property(nonatomic, readonly) Float3 float3Value;
 
 @end
+#endif // __OBJC__
 
 
 
+VUCKT_DIAGNOSTICS_END
 NS_ASSUME_NONNULL_END
@@ -3,7 +3,14 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
 import Foundation
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
 #if canImport(SceneKit)
 	import SceneKit.SceneKitTypes
 #endif
@@ -108,22 +115,22 @@ extension Float3
 	
 	// MARK: commonly-used “presets”
 	
-	public static let zero = Float3(scalar: 0)
+	@_transparent public static var zero:Float3 { return Float3(scalar: 0) }
 	
-	public static let one = Self.positiveOne
-	public static let positiveOne = Float3(scalar: 1)
-	public static let negativeOne = Float3(scalar: -1)
+	@_transparent public static var one:Float3 { return Self.positiveOne }
+	@_transparent public static var positiveOne:Float3 { return Float3(scalar: 1) }
+	@_transparent public static var negativeOne:Float3 { return Float3(scalar: -1) }
 	
-	public static let unitX = Self.unitXPositive
-	public static let unitXPositive = Float3(x: 1)
-	public static let unitY = Self.unitYPositive
-	public static let unitYPositive = Float3(y: 1)
-	public static let unitZ = Self.unitZPositive
-	public static let unitZPositive = Float3(z: 1)
+	@_transparent public static var unitX:Float3 { return Self.unitXPositive }
+	@_transparent public static var unitXPositive:Float3 { return Float3(x: 1) }
+	@_transparent public static var unitY:Float3 { return Self.unitYPositive }
+	@_transparent public static var unitYPositive:Float3 { return Float3(y: 1) }
+	@_transparent public static var unitZ:Float3 { return Self.unitZPositive }
+	@_transparent public static var unitZPositive:Float3 { return Float3(z: 1) }
 	
-	public static let unitXNegative = Float3(x: -1)
-	public static let unitYNegative = Float3(y: -1)
-	public static let unitZNegative = Float3(z: -1)
+	@_transparent public static var unitXNegative:Float3 { return Float3(x: -1) }
+	@_transparent public static var unitYNegative:Float3 { return Float3(y: -1) }
+	@_transparent public static var unitZNegative:Float3 { return Float3(z: -1) }
 	
 	
 	
@@ -484,6 +491,13 @@ extension Float3 // Basic Math Operations
 	@_transparent public func reciprocal() -> Float3 {
 		return Float3(simd_recip(self.simdValue))
 	}
+	/// With `.fast`, uses `Float3ReciprocalFast()`.
+	@_transparent public func reciprocal(precision:MathPrecision) -> Float3 {
+		switch precision {
+			case .full: return self.reciprocal()
+			case .fast: return Float3ReciprocalFast(self)
+		}
+	}
 	@_transparent public mutating func formReciprocal() {
 		self = self.reciprocal()
 	}
@@ -508,11 +522,28 @@ extension Float3 // Geometric Math Operations
 	@_transparent public mutating func normalize() {
 		self = self.normalized()
 	}
+	/// With `.fast`, uses `Float3NormalizeFast()`.
+	@_transparent public func normalized(precision:MathPrecision) -> Float3 {
+		switch precision {
+			case .full: return self.normalized()
+			case .fast: return Float3NormalizeFast(self)
+		}
+	}
+	@_transparent public mutating func normalize(precision:MathPrecision) {
+		self = self.normalized(precision: precision)
+	}
 	
 	
 	@_transparent public func length() -> Float {
 		return simd_length(self.simdValue)
 	}
+	/// With `.fast`, uses `Float3LengthFast()`.
+	@_transparent public func length(precision:MathPrecision) -> Float {
+		switch precision {
+			case .full: return self.length()
+			case .fast: return Float3LengthFast(self)
+		}
+	}
 	/// Alias of: `length()`
 	@_transparent public func magnitude() -> Float { return self.length() }
 	/// Alias of: `length()`
@@ -600,19 +631,20 @@ extension Float3 // Geometric Math Operations
 	
 	public enum InterpolationMethod {
 		case linear
+		/// Eases in & out along the cubic Hermite (smoothstep) curve `3t² - 2t³`: from `self` at ratio 0 to `other` at 1, with zero speed at both.
 		case hermite
 	}
 	@_transparent public func interpolated(to other:Float3, ratio:Float, method:Float3.InterpolationMethod = .linear) -> Float3 {
-		return interpolateBetween(self, other, ratio: ratio)
+		return interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	@_transparent public mutating func interpolate(to other:Float3, ratio:Float, method:Float3.InterpolationMethod = .linear) {
-		self = interpolateBetween(self, other, ratio: ratio)
+		self = interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	@_transparent public func interpolated(to other:Float3, ratio:Float3, method:Float3.InterpolationMethod = .linear) -> Float3 {
-		return interpolateBetween(self, other, ratio: ratio)
+		return interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	@_transparent public mutating func interpolate(to other:Float3, ratio:Float3, method:Float3.InterpolationMethod = .linear) {
-		self = interpolateBetween(self, other, ratio: ratio)
+		self = interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	
 	
@@ -663,7 +695,7 @@ extension Float3 // Geometric Math Operations
 		case .linear:
 			return Float3(simd_mix(a.simdValue, b.simdValue, ratio.simdValue))
 		case .hermite:
-			return Float3(simd_smoothstep(a.simdValue, b.simdValue, ratio.simdValue))
+			return Float3(simd_mix(a.simdValue, b.simdValue, simd_smoothstep(Float3.zero.simdValue, Float3.one.simdValue, ratio.simdValue)))
 	}
 }
 
@@ -676,6 +708,198 @@ extension Float3 // Geometric Math Operations
 }
 
 
+extension UnsafeBufferPointer where Element == Float3 // Bulk Math Operations
+{
+	/// Element-wise `self[i] + other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func add(_ other:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkOperation(other, into: out, Float3AddArrays)
+	}
+	/// Element-wise `self[i] - other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func subtract(_ other:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkOperation(other, into: out, Float3SubtractArrays)
+	}
+	/// Element-wise `self[i] * other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func multiply(by other:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkOperation(other, into: out, Float3MultiplyArrays)
+	}
+	/// Element-wise `self[i] / other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func divide(by other:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkOperation(other, into: out, Float3DivideArrays)
+	}
+	/// Element-wise `self[i] % other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkOperation(other, into: out, Float3ModulusArrays)
+	}
+	/// Element-wise `-self[i]`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func negate(into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkOperation(into: out, Float3NegateArray)
+	}
+	/// Element-wise `self[i] * scale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func multiply(by scale:Float, into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkOperation(scale, into: out, Float3MultiplyByScalarArray)
+	}
+	/// Element-wise `self[i] / inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func divide(by inverseScale:Float, into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkOperation(inverseScale, into: out, Float3DivideByScalarArray)
+	}
+	/// Element-wise `self[i] % inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Float, into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkOperation(inverseScale, into: out, Float3ModulusByScalarArray)
+	}
+	/// Element-wise `self[i].normalized()`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func normalize(into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkOperation(into: out, Float3NormalizeArray)
+	}
+	
+	/// The sum of the elements, in a fixed order (see `Float3SumArray()`), so the same elements always give the same sum.
+	@_alwaysEmitIntoClient public func sum() -> Float3 {
+		guard self.count > 0 else { return Float3() }
+		return Float3SumArray(self.baseAddress!, self.count)
+	}
+}
+
+extension Array where Element == Float3 // Bulk Math Operations
+{
+	@_alwaysEmitIntoClient public func adding(_ other:[Float3]) -> [Float3] {
+		return self._vucktBulkOperation(other, Float3AddArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func add(_ other:[Float3]) {
+		self._vucktFormBulkOperation(other, Float3AddArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func subtracting(_ other:[Float3]) -> [Float3] {
+		return self._vucktBulkOperation(other, Float3SubtractArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func subtract(_ other:[Float3]) {
+		self._vucktFormBulkOperation(other, Float3SubtractArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by other:[Float3]) -> [Float3] {
+		return self._vucktBulkOperation(other, Float3MultiplyArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by other:[Float3]) {
+		self._vucktFormBulkOperation(other, Float3MultiplyArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by other:[Float3]) -> [Float3] {
+		return self._vucktBulkOperation(other, Float3DivideArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by other:[Float3]) {
+		self._vucktFormBulkOperation(other, Float3DivideArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:[Float3]) -> [Float3] {
+		return self._vucktBulkOperation(other, Float3ModulusArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy other:[Float3]) {
+		self._vucktFormBulkOperation(other, Float3ModulusArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func negated() -> [Float3] {
+		return self._vucktBulkOperation(Float3NegateArray)
+	}
+	@_alwaysEmitIntoClient public mutating func negate() {
+		self._vucktFormBulkOperation(Float3NegateArray)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by scale:Float) -> [Float3] {
+		return self._vucktBulkOperation(scale, Float3MultiplyByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by scale:Float) {
+		self._vucktFormBulkOperation(scale, Float3MultiplyByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by inverseScale:Float) -> [Float3] {
+		return self._vucktBulkOperation(inverseScale, Float3DivideByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by inverseScale:Float) {
+		self._vucktFormBulkOperation(inverseScale, Float3DivideByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Float) -> [Float3] {
+		return self._vucktBulkOperation(inverseScale, Float3ModulusByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy inverseScale:Float) {
+		self._vucktFormBulkOperation(inverseScale, Float3ModulusByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func normalized() -> [Float3] {
+		return self._vucktBulkOperation(Float3NormalizeArray)
+	}
+	@_alwaysEmitIntoClient public mutating func normalize() {
+		self._vucktFormBulkOperation(Float3NormalizeArray)
+	}
+	
+	/// The sum of the elements— see `UnsafeBufferPointer.sum()`.
+	@_alwaysEmitIntoClient public func sum() -> Float3 {
+		return self.withUnsafeBufferPointer{ $0.sum() }
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == Float3 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `simd_float3`s (`SIMD3<Float>`s), in place: `Float3` is laid out as `simd_float3` is (see the `static_assert`s in `Float3.mm`), so nothing's copied.  (Except on the Swift backend, whose `Float3`s are packed into 12 bytes; there they're converted through a temporary buffer.)
+	@_alwaysEmitIntoClient public func withSimdMemoryRebound<Result>(_ body:(UnsafeBufferPointer<simd_float3>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: simd_float3.self, converting: Float3ToSimd, body)
+	}
+}
+
+extension UnsafeMutableBufferPointer where Element == Float3 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as mutable `simd_float3`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withSimdMemoryRebound<Result>(_ body:(UnsafeMutableBufferPointer<simd_float3>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: simd_float3.self, converting: Float3ToSimd, back: Float3FromSimd, body)
+	}
+}
+
+extension Array where Element == Float3 // Zero-Copy Views
+{
+	/// One component of each element (e.g. `components(\.x)`), viewed in place rather than copied out.
+	@_alwaysEmitIntoClient public func components(_ component:KeyPath<Float3, Float>) -> StridedArrayView<Float3, Float> {
+		return StridedArrayView(self, field: component)
+	}
+	
+	/// Calls `body` with the elements as `simd_float3`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withUnsafeSimdBufferPointer<Result>(_ body:(UnsafeBufferPointer<simd_float3>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeBufferPointer{ try $0.withSimdMemoryRebound(body) }
+	}
+	/// Calls `body` with the elements as mutable `simd_float3`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public mutating func withUnsafeMutableSimdBufferPointer<Result>(_ body:(UnsafeMutableBufferPointer<simd_float3>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeMutableBufferPointer{ try $0.withSimdMemoryRebound(body) }
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == simd_float3 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `Float3`s, in place— see the `Float3` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withFloat3MemoryRebound<Result>(_ body:(UnsafeBufferPointer<Float3>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: Float3.self, converting: Float3FromSimd, body)
+	}
+}
+
+extension UnsafeMutableBufferPointer where Element == simd_float3 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as mutable `Float3`s, in place— see the `Float3` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withFloat3MemoryRebound<Result>(_ body:(UnsafeMutableBufferPointer<Float3>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: Float3.self, converting: Float3FromSimd, back: Float3ToSimd, body)
+	}
+}
+
+extension Array where Element == simd_float3 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `Float3`s, in place— see the `Float3` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withUnsafeFloat3BufferPointer<Result>(_ body:(UnsafeBufferPointer<Float3>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeBufferPointer{ try $0.withFloat3MemoryRebound(body) }
+	}
+	/// Calls `body` with the elements as mutable `Float3`s, in place— see the `Float3` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public mutating func withUnsafeMutableFloat3BufferPointer<Result>(_ body:(UnsafeMutableBufferPointer<Float3>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeMutableBufferPointer{ try $0.withFloat3MemoryRebound(body) }
+	}
+}
+
+
 extension Float3 : Hashable
 {
 	private static let _hashingLargePrimes:[UInt] = [ 982_917_223, 3_572_352_083, 4_259_235_067 ]
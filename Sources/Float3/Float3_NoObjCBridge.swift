@@ -2,7 +2,12 @@
 // @author: Slipp Douglas Thompson
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
-import simd
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
 #if canImport(SceneKit)
 	import SceneKit.SceneKitTypes
 #endif
@@ -110,6 +115,98 @@ public struct Float3
 
 
 
+// MARK: Fast-Approximate Math
+
+/// The Swift backend has no estimate instructions to build on, so these use the full-precision operations (trivially meeting the C backend's error bounds).
+@_alwaysEmitIntoClient public func Float3NormalizeFast(_ v:Float3) -> Float3 {
+	return Float3FromSimd(simd_normalize(Float3ToSimd(v)))
+}
+@_alwaysEmitIntoClient public func Float3LengthFast(_ v:Float3) -> Float {
+	return simd_length(Float3ToSimd(v))
+}
+@_alwaysEmitIntoClient public func Float3ReciprocalFast(_ v:Float3) -> Float3 {
+	return Float3FromSimd(1 / Float3ToSimd(v))
+}
+@_alwaysEmitIntoClient public func Float3SinCos(_ angles:Float3, _ outSin:UnsafeMutablePointer<Float3>, _ outCos:UnsafeMutablePointer<Float3>) {
+	outSin.pointee = Float3(sin(angles.x), sin(angles.y), sin(angles.z))
+	outCos.pointee = Float3(cos(angles.x), cos(angles.y), cos(angles.z))
+}
+@_alwaysEmitIntoClient public func Float3SinCosFast(_ angles:Float3, _ outSin:UnsafeMutablePointer<Float3>, _ outCos:UnsafeMutablePointer<Float3>) {
+	outSin.pointee = Float3(sin(angles.x), sin(angles.y), sin(angles.z))
+	outCos.pointee = Float3(cos(angles.x), cos(angles.y), cos(angles.z))
+}
+
+
+
+// MARK: Array Operations
+
+@_alwaysEmitIntoClient public func Float3AddArrays(_ a:UnsafePointer<Float3>, _ b:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float3Add(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float3SubtractArrays(_ a:UnsafePointer<Float3>, _ b:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float3Subtract(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float3MultiplyArrays(_ a:UnsafePointer<Float3>, _ b:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float3Multiply(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float3DivideArrays(_ a:UnsafePointer<Float3>, _ b:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float3Divide(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float3ModulusArrays(_ a:UnsafePointer<Float3>, _ b:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float3Modulus(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float3NegateArray(_ v:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float3Negate(v[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float3MultiplyByScalarArray(_ v:UnsafePointer<Float3>, _ s:Float, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float3MultiplyByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Float3DivideByScalarArray(_ v:UnsafePointer<Float3>, _ s:Float, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float3DivideByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Float3ModulusByScalarArray(_ v:UnsafePointer<Float3>, _ s:Float, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float3ModulusByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Float3NormalizeArray(_ v:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		let p = v[i]
+		let inverseLength = 1 / (p.x * p.x + p.y * p.y + p.z * p.z).squareRoot()
+		out[i] = Float3(x: p.x * inverseLength, y: p.y * inverseLength, z: p.z * inverseLength)
+	}
+}
+@_alwaysEmitIntoClient public func Float3SumArray(_ v:UnsafePointer<Float3>, _ n:Int) -> Float3 {
+	var sums = (Float3(), Float3(), Float3(), Float3())
+	for i in 0..<n {
+		switch i % 4 {
+			case 0: sums.0 = Float3Add(sums.0, v[i])
+			case 1: sums.1 = Float3Add(sums.1, v[i])
+			case 2: sums.2 = Float3Add(sums.2, v[i])
+			default: sums.3 = Float3Add(sums.3, v[i])
+		}
+	}
+	return Float3Add(Float3Add(sums.0, sums.1), Float3Add(sums.2, sums.3))
+}
+
+
+
 #if canImport(SceneKit)
 	// MARK: SceneKit Conversion
 
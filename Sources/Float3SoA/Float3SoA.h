@@ -0,0 +1,151 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+// Structure-of-arrays (SoA) kernels: an array of `n` Float3s stored as three separate `float` arrays (`x[]`, `y[]`, `z[]`) instead of one array of `Float3`s.
+// Each kernel works one element per loop iteration across plain `float` arrays, so the compiler vectorizes it 4/8/16 elements at a time (SSE or NEON/AVX/AVX-512) with no lane shuffling, and without carrying `Float3`'s padding lane through memory.
+// Output arrays may be the same arrays as inputs (for in-place operation), but must not otherwise overlap them.
+
+
+
+#pragma mark AoS/SoA Transposition
+
+/// Splits `n` `Float3`s into separate per-component arrays.
+NS_INLINE void Float3ArrayToSoA(const Float3 *aos, float *x, float *y, float *z, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		x[i] = aos[i].x;
+		y[i] = aos[i].y;
+		z[i] = aos[i].z;
+	}
+}
+/// Interleaves separate per-component arrays back into `n` `Float3`s.
+NS_INLINE void Float3ArrayFromSoA(const float *x, const float *y, const float *z, Float3 *aos, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		aos[i] = (Float3){ x[i], y[i], z[i] };
+	}
+}
+
+
+
+#pragma mark SoA Math Operations
+
+/// `out[i] = dot(a[i], b[i])`
+NS_INLINE void Float3SoADotProduct(const float *aX, const float *aY, const float *aZ, const float *bX, const float *bY, const float *bZ, float *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float ax = aX[i], ay = aY[i], az = aZ[i];
+		float bx = bX[i], by = bY[i], bz = bZ[i];
+		out[i] = ax * bx + ay * by + az * bz;
+	}
+}
+/// `out[i] = cross(a[i], b[i])`
+NS_INLINE void Float3SoACrossProduct(const float *aX, const float *aY, const float *aZ, const float *bX, const float *bY, const float *bZ, float *outX, float *outY, float *outZ, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float ax = aX[i], ay = aY[i], az = aZ[i];
+		float bx = bX[i], by = bY[i], bz = bZ[i];
+		outX[i] = ay * bz - az * by;
+		outY[i] = az * bx - ax * bz;
+		outZ[i] = ax * by - ay * bx;
+	}
+}
+/// `out[i] = length_squared(v[i])`
+NS_INLINE void Float3SoALengthSquared(const float *vX, const float *vY, const float *vZ, float *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float vx = vX[i], vy = vY[i], vz = vZ[i];
+		out[i] = vx * vx + vy * vy + vz * vz;
+	}
+}
+/// `out[i] = length(v[i])`
+NS_INLINE void Float3SoALength(const float *vX, const float *vY, const float *vZ, float *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float vx = vX[i], vy = vY[i], vz = vZ[i];
+		out[i] = vuckt_sqrtf(vx * vx + vy * vy + vz * vz);
+	}
+}
+/// `out[i] = normalize(v[i])`  (Zero-length elements produce NaNs, as `simd_normalize()` does.)
+NS_INLINE void Float3SoANormalize(const float *vX, const float *vY, const float *vZ, float *outX, float *outY, float *outZ, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float vx = vX[i], vy = vY[i], vz = vZ[i];
+		float inverseLength = 1.0f / vuckt_sqrtf(vx * vx + vy * vy + vz * vz);
+		outX[i] = vx * inverseLength;
+		outY[i] = vy * inverseLength;
+		outZ[i] = vz * inverseLength;
+	}
+}
+/// `out[i] = mix(a[i], b[i], ratio)`  (Linear interpolation; `ratio` 0 gives `a[i]` & 1 gives `b[i]`.)
+NS_INLINE void Float3SoAMix(const float *aX, const float *aY, const float *aZ, const float *bX, const float *bY, const float *bZ, float ratio, float *outX, float *outY, float *outZ, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float ax = aX[i], ay = aY[i], az = aZ[i];
+		float bx = bX[i], by = bY[i], bz = bZ[i];
+		outX[i] = ax + (bx - ax) * ratio;
+		outY[i] = ay + (by - ay) * ratio;
+		outZ[i] = az + (bz - az) * ratio;
+	}
+}
+/// `out[i] = min(a[i], b[i])`, component-wise.  (Unlike `fminf()`, a NaN in `a` propagates; this is what lets it vectorize without `-ffinite-math-only`.)
+NS_INLINE void Float3SoAMin(const float *aX, const float *aY, const float *aZ, const float *bX, const float *bY, const float *bZ, float *outX, float *outY, float *outZ, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float ax = aX[i], ay = aY[i], az = aZ[i];
+		float bx = bX[i], by = bY[i], bz = bZ[i];
+		outX[i] = bx < ax ? bx : ax;
+		outY[i] = by < ay ? by : ay;
+		outZ[i] = bz < az ? bz : az;
+	}
+}
+/// `out[i] = max(a[i], b[i])`, component-wise.  (Unlike `fmaxf()`, a NaN in `a` propagates; this is what lets it vectorize without `-ffinite-math-only`.)
+NS_INLINE void Float3SoAMax(const float *aX, const float *aY, const float *aZ, const float *bX, const float *bY, const float *bZ, float *outX, float *outY, float *outZ, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float ax = aX[i], ay = aY[i], az = aZ[i];
+		float bx = bX[i], by = bY[i], bz = bZ[i];
+		outX[i] = bx > ax ? bx : ax;
+		outY[i] = by > ay ? by : ay;
+		outZ[i] = bz > az ? bz : az;
+	}
+}
+/// `out[i] = clamp(v[i], lowerBound, upperBound)`, component-wise.
+NS_INLINE void Float3SoAClamp(const float *vX, const float *vY, const float *vZ, Float3 lowerBound, Float3 upperBound, float *outX, float *outY, float *outZ, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float vx = vX[i], vy = vY[i], vz = vZ[i];
+		float clampedX = vx < lowerBound.x ? lowerBound.x : vx;
+		float clampedY = vy < lowerBound.y ? lowerBound.y : vy;
+		float clampedZ = vz < lowerBound.z ? lowerBound.z : vz;
+		outX[i] = clampedX > upperBound.x ? upperBound.x : clampedX;
+		outY[i] = clampedY > upperBound.y ? upperBound.y : clampedY;
+		outZ[i] = clampedZ > upperBound.z ? upperBound.z : clampedZ;
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,289 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+/// Structure-of-arrays storage for `Float3`s: each component in its own contiguous `[Float]` rather than interleaved in one `[Float3]`.
+/// Bulk math over it runs the `Float3SoA…` C kernels, which vectorize across elements instead of within each one.
+public struct Float3SoA
+{
+	public var x:[Float]
+	public var y:[Float]
+	public var z:[Float]
+	
+	/// - Precondition: the three component arrays must have the same count.
+	@inlinable public init(x:[Float], y:[Float], z:[Float]) {
+		precondition(y.count == x.count && z.count == x.count, "Float3SoA's component arrays must all have the same count.")
+		self.x = x
+		self.y = y
+		self.z = z
+	}
+	@inlinable public init() {
+		self.init(x: [], y: [], z: [])
+	}
+	@inlinable public init(repeating value:Float3, count:Int) {
+		self.init(x: [Float](repeating: value.x, count: count), y: [Float](repeating: value.y, count: count), z: [Float](repeating: value.z, count: count))
+	}
+	/// Transposes an array of `Float3`s into per-component arrays.
+	@inlinable public init(_ elements:[Float3]) {
+		let count = elements.count
+		self = elements.withUnsafeBufferPointer{ elementsBuffer in
+			Float3SoA(_unsafeUninitializedCount: count){ lanes in
+				Float3ArrayToSoA(elementsBuffer.baseAddress!, lanes.x, lanes.y, lanes.z, count)
+			}
+		}
+	}
+	
+	/// Initializes with `count` elements, all of which `initializer` must write through the given per-component pointers.
+	@inlinable internal init(_unsafeUninitializedCount count:Int, initializingWith initializer:(_MutableLanes) -> Void) {
+		guard count > 0 else {
+			self.init()
+			return
+		}
+		var x:[Float] = []
+		var y:[Float] = []
+		var z:[Float] = []
+		x = [Float](unsafeUninitializedCapacity: count){ xBuffer, xCount in
+			y = [Float](unsafeUninitializedCapacity: count){ yBuffer, yCount in
+				z = [Float](unsafeUninitializedCapacity: count){ zBuffer, zCount in
+					initializer(( x: xBuffer.baseAddress!, y: yBuffer.baseAddress!, z: zBuffer.baseAddress! ))
+					zCount = count
+				}
+				yCount = count
+			}
+			xCount = count
+		}
+		self.init(x: x, y: y, z: z)
+	}
+	
+	
+	// MARK: Lane Access
+	
+	@usableFromInline internal typealias _Lanes = (x:UnsafePointer<Float>, y:UnsafePointer<Float>, z:UnsafePointer<Float>)
+	@usableFromInline internal typealias _MutableLanes = (x:UnsafeMutablePointer<Float>, y:UnsafeMutablePointer<Float>, z:UnsafeMutablePointer<Float>)
+	
+	/// Calls `body` with pointers to the per-component arrays' storage.
+	/// - Precondition: `self` must not be empty (since an empty array may have no storage to point to).
+	@inlinable internal func _withLanes<Result>(_ body:(_Lanes) -> Result) -> Result {
+		return self.x.withUnsafeBufferPointer{ xBuffer in
+			self.y.withUnsafeBufferPointer{ yBuffer in
+				self.z.withUnsafeBufferPointer{ zBuffer in
+					body(( x: xBuffer.baseAddress!, y: yBuffer.baseAddress!, z: zBuffer.baseAddress! ))
+				}
+			}
+		}
+	}
+	/// Calls `body` with mutable pointers to the per-component arrays' storage.
+	/// - Precondition: `self` must not be empty (since an empty array may have no storage to point to).
+	@inlinable internal mutating func _withMutableLanes<Result>(_ body:(_MutableLanes) -> Result) -> Result {
+		return self.x.withUnsafeMutableBufferPointer{ xBuffer in
+			self.y.withUnsafeMutableBufferPointer{ yBuffer in
+				self.z.withUnsafeMutableBufferPointer{ zBuffer in
+					body(( x: xBuffer.baseAddress!, y: yBuffer.baseAddress!, z: zBuffer.baseAddress! ))
+				}
+			}
+		}
+	}
+}
+
+
+extension Array where Element == Float3
+{
+	/// Transposes a `Float3SoA` back into an array of `Float3`s.
+	@inlinable public init(_ soa:Float3SoA) {
+		self.init(unsafeUninitializedCapacity: soa.count){ buffer, initializedCount in
+			if soa.count > 0 {
+				soa._withLanes{ lanes in
+					Float3ArrayFromSoA(lanes.x, lanes.y, lanes.z, buffer.baseAddress!, soa.count)
+				}
+			}
+			initializedCount = soa.count
+		}
+	}
+}
+
+
+extension Float3SoA : RandomAccessCollection, MutableCollection
+{
+	public typealias Index = Int
+	
+	@inlinable public var startIndex:Int { return 0 }
+	@inlinable public var endIndex:Int { return self.x.count }
+	
+	@inlinable public subscript(index:Int) -> Float3 {
+		get {
+			return Float3(x: self.x[index], y: self.y[index], z: self.z[index])
+		}
+		set {
+			self.x[index] = newValue.x
+			self.y[index] = newValue.y
+			self.z[index] = newValue.z
+		}
+	}
+	
+	@inlinable public mutating func append(_ element:Float3) {
+		self.x.append(element.x)
+		self.y.append(element.y)
+		self.z.append(element.z)
+	}
+	@inlinable public mutating func reserveCapacity(_ minimumCapacity:Int) {
+		self.x.reserveCapacity(minimumCapacity)
+		self.y.reserveCapacity(minimumCapacity)
+		self.z.reserveCapacity(minimumCapacity)
+	}
+}
+
+
+extension Float3SoA : Equatable
+{
+	@inlinable public static func ==(a:Float3SoA, b:Float3SoA) -> Bool {
+		return a.x == b.x && a.y == b.y && a.z == b.z
+	}
+}
+
+
+extension Float3SoA // Geometric Math Operations
+{
+	/// Also known as the Interior Product.  Returns each element's dot product with the same-index element of `other`.
+	@inlinable public func dotProduct(_ other:Float3SoA) -> [Float] {
+		return self._reductionOperation(other, Float3SoADotProduct)
+	}
+	
+	
+	@inlinable public func crossProduct(_ other:Float3SoA) -> Float3SoA {
+		return self._binaryOperation(other, Float3SoACrossProduct)
+	}
+	@inlinable public mutating func formCrossProduct(_ other:Float3SoA) {
+		self._formBinaryOperation(other, Float3SoACrossProduct)
+	}
+	
+	
+	@inlinable public func lengths() -> [Float] {
+		return self._reductionOperation(Float3SoALength)
+	}
+	@inlinable public func lengthsSquared() -> [Float] {
+		return self._reductionOperation(Float3SoALengthSquared)
+	}
+	
+	
+	/// Produces unit-length vectors.  (Not to be confused with “normals”/“normal vectors”.)
+	@inlinable public func normalized() -> Float3SoA {
+		return self._unaryOperation(Float3SoANormalize)
+	}
+	/// Modifies each vector to be unit-length.  (Not to be confused with “normals”/“normal vectors”.)
+	@inlinable public mutating func normalize() {
+		self._formUnaryOperation(Float3SoANormalize)
+	}
+	
+	
+	/// Linearly interpolates each element toward the same-index element of `other`.
+	@inlinable public func mixed(with other:Float3SoA, ratio:Float) -> Float3SoA {
+		return self._binaryOperation(other){ aX, aY, aZ, bX, bY, bZ, outX, outY, outZ, n in
+			Float3SoAMix(aX, aY, aZ, bX, bY, bZ, ratio, outX, outY, outZ, n)
+		}
+	}
+	/// Linearly interpolates each element toward the same-index element of `other`.
+	@inlinable public mutating func mix(with other:Float3SoA, ratio:Float) {
+		self._formBinaryOperation(other){ aX, aY, aZ, bX, bY, bZ, outX, outY, outZ, n in
+			Float3SoAMix(aX, aY, aZ, bX, bY, bZ, ratio, outX, outY, outZ, n)
+		}
+	}
+	
+	
+	@inlinable public func clamped(to range:ClosedRange<Float3>) -> Float3SoA {
+		return self._unaryOperation{ vX, vY, vZ, outX, outY, outZ, n in
+			Float3SoAClamp(vX, vY, vZ, range.lowerBound, range.upperBound, outX, outY, outZ, n)
+		}
+	}
+	@inlinable public mutating func clamp(to range:ClosedRange<Float3>) {
+		self._formUnaryOperation{ vX, vY, vZ, outX, outY, outZ, n in
+			Float3SoAClamp(vX, vY, vZ, range.lowerBound, range.upperBound, outX, outY, outZ, n)
+		}
+	}
+}
+
+
+// MARK: Element-wise `min`/`max`
+
+@inlinable public func min(_ a:Float3SoA, _ b:Float3SoA) -> Float3SoA {
+	return a._binaryOperation(b, Float3SoAMin)
+}
+
+@inlinable public func max(_ a:Float3SoA, _ b:Float3SoA) -> Float3SoA {
+	return a._binaryOperation(b, Float3SoAMax)
+}
+
+
+extension Float3SoA // Kernel Plumbing
+{
+	@inlinable internal func _binaryOperation(_ other:Float3SoA, _ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) -> Float3SoA {
+		precondition(other.count == self.count, "Float3SoA operands must have the same count.")
+		return Float3SoA(_unsafeUninitializedCount: self.count){ out in
+			self._withLanes{ a in
+				other._withLanes{ b in
+					kernel(a.x, a.y, a.z, b.x, b.y, b.z, out.x, out.y, out.z, self.count)
+				}
+			}
+		}
+	}
+	@inlinable internal mutating func _formBinaryOperation(_ other:Float3SoA, _ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) {
+		precondition(other.count == self.count, "Float3SoA operands must have the same count.")
+		guard self.count > 0 else { return }
+		let count = self.count
+		other._withLanes{ b in
+			self._withMutableLanes{ a in
+				kernel(a.x, a.y, a.z, b.x, b.y, b.z, a.x, a.y, a.z, count)
+			}
+		}
+	}
+	
+	@inlinable internal func _unaryOperation(_ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) -> Float3SoA {
+		return Float3SoA(_unsafeUninitializedCount: self.count){ out in
+			self._withLanes{ v in
+				kernel(v.x, v.y, v.z, out.x, out.y, out.z, self.count)
+			}
+		}
+	}
+	@inlinable internal mutating func _formUnaryOperation(_ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) {
+		guard self.count > 0 else { return }
+		let count = self.count
+		self._withMutableLanes{ v in
+			kernel(v.x, v.y, v.z, v.x, v.y, v.z, count)
+		}
+	}
+	
+	@inlinable internal func _reductionOperation(_ other:Float3SoA, _ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) -> [Float] {
+		precondition(other.count == self.count, "Float3SoA operands must have the same count.")
+		return [Float](unsafeUninitializedCapacity: self.count){ buffer, initializedCount in
+			if self.count > 0 {
+				self._withLanes{ a in
+					other._withLanes{ b in
+						kernel(a.x, a.y, a.z, b.x, b.y, b.z, buffer.baseAddress!, self.count)
+					}
+				}
+			}
+			initializedCount = self.count
+		}
+	}
+	@inlinable internal func _reductionOperation(_ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) -> [Float] {
+		return [Float](unsafeUninitializedCapacity: self.count){ buffer, initializedCount in
+			if self.count > 0 {
+				self._withLanes{ v in
+					kernel(v.x, v.y, v.z, buffer.baseAddress!, self.count)
+				}
+			}
+			initializedCount = self.count
+		}
+	}
+}
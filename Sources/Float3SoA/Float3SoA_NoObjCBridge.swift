@@ -0,0 +1,106 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: AoS/SoA Transposition
+
+@_alwaysEmitIntoClient public func Float3ArrayToSoA(_ aos:UnsafePointer<Float3>, _ x:UnsafeMutablePointer<Float>, _ y:UnsafeMutablePointer<Float>, _ z:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		x[i] = aos[i].x
+		y[i] = aos[i].y
+		z[i] = aos[i].z
+	}
+}
+@_alwaysEmitIntoClient public func Float3ArrayFromSoA(_ x:UnsafePointer<Float>, _ y:UnsafePointer<Float>, _ z:UnsafePointer<Float>, _ aos:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		aos[i] = Float3(x: x[i], y: y[i], z: z[i])
+	}
+}
+
+
+
+// MARK: SoA Math Operations
+
+@_alwaysEmitIntoClient public func Float3SoADotProduct(_ aX:UnsafePointer<Float>, _ aY:UnsafePointer<Float>, _ aZ:UnsafePointer<Float>, _ bX:UnsafePointer<Float>, _ bY:UnsafePointer<Float>, _ bZ:UnsafePointer<Float>, _ out:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let ax = aX[i], ay = aY[i], az = aZ[i]
+		let bx = bX[i], by = bY[i], bz = bZ[i]
+		out[i] = ax * bx + ay * by + az * bz
+	}
+}
+@_alwaysEmitIntoClient public func Float3SoACrossProduct(_ aX:UnsafePointer<Float>, _ aY:UnsafePointer<Float>, _ aZ:UnsafePointer<Float>, _ bX:UnsafePointer<Float>, _ bY:UnsafePointer<Float>, _ bZ:UnsafePointer<Float>, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let ax = aX[i], ay = aY[i], az = aZ[i]
+		let bx = bX[i], by = bY[i], bz = bZ[i]
+		outX[i] = ay * bz - az * by
+		outY[i] = az * bx - ax * bz
+		outZ[i] = ax * by - ay * bx
+	}
+}
+@_alwaysEmitIntoClient public func Float3SoALengthSquared(_ vX:UnsafePointer<Float>, _ vY:UnsafePointer<Float>, _ vZ:UnsafePointer<Float>, _ out:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let vx = vX[i], vy = vY[i], vz = vZ[i]
+		out[i] = vx * vx + vy * vy + vz * vz
+	}
+}
+@_alwaysEmitIntoClient public func Float3SoALength(_ vX:UnsafePointer<Float>, _ vY:UnsafePointer<Float>, _ vZ:UnsafePointer<Float>, _ out:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let vx = vX[i], vy = vY[i], vz = vZ[i]
+		out[i] = (vx * vx + vy * vy + vz * vz).squareRoot()
+	}
+}
+@_alwaysEmitIntoClient public func Float3SoANormalize(_ vX:UnsafePointer<Float>, _ vY:UnsafePointer<Float>, _ vZ:UnsafePointer<Float>, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let vx = vX[i], vy = vY[i], vz = vZ[i]
+		let inverseLength = 1 / (vx * vx + vy * vy + vz * vz).squareRoot()
+		outX[i] = vx * inverseLength
+		outY[i] = vy * inverseLength
+		outZ[i] = vz * inverseLength
+	}
+}
+@_alwaysEmitIntoClient public func Float3SoAMix(_ aX:UnsafePointer<Float>, _ aY:UnsafePointer<Float>, _ aZ:UnsafePointer<Float>, _ bX:UnsafePointer<Float>, _ bY:UnsafePointer<Float>, _ bZ:UnsafePointer<Float>, _ ratio:Float, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let ax = aX[i], ay = aY[i], az = aZ[i]
+		let bx = bX[i], by = bY[i], bz = bZ[i]
+		outX[i] = ax + (bx - ax) * ratio
+		outY[i] = ay + (by - ay) * ratio
+		outZ[i] = az + (bz - az) * ratio
+	}
+}
+@_alwaysEmitIntoClient public func Float3SoAMin(_ aX:UnsafePointer<Float>, _ aY:UnsafePointer<Float>, _ aZ:UnsafePointer<Float>, _ bX:UnsafePointer<Float>, _ bY:UnsafePointer<Float>, _ bZ:UnsafePointer<Float>, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let ax = aX[i], ay = aY[i], az = aZ[i]
+		let bx = bX[i], by = bY[i], bz = bZ[i]
+		outX[i] = bx < ax ? bx : ax
+		outY[i] = by < ay ? by : ay
+		outZ[i] = bz < az ? bz : az
+	}
+}
+@_alwaysEmitIntoClient public func Float3SoAMax(_ aX:UnsafePointer<Float>, _ aY:UnsafePointer<Float>, _ aZ:UnsafePointer<Float>, _ bX:UnsafePointer<Float>, _ bY:UnsafePointer<Float>, _ bZ:UnsafePointer<Float>, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let ax = aX[i], ay = aY[i], az = aZ[i]
+		let bx = bX[i], by = bY[i], bz = bZ[i]
+		outX[i] = bx > ax ? bx : ax
+		outY[i] = by > ay ? by : ay
+		outZ[i] = bz > az ? bz : az
+	}
+}
+@_alwaysEmitIntoClient public func Float3SoAClamp(_ vX:UnsafePointer<Float>, _ vY:UnsafePointer<Float>, _ vZ:UnsafePointer<Float>, _ lowerBound:Float3, _ upperBound:Float3, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let vx = vX[i], vy = vY[i], vz = vZ[i]
+		let clampedX = vx < lowerBound.x ? lowerBound.x : vx
+		let clampedY = vy < lowerBound.y ? lowerBound.y : vy
+		let clampedZ = vz < lowerBound.z ? lowerBound.z : vz
+		outX[i] = clampedX > upperBound.x ? upperBound.x : clampedX
+		outY[i] = clampedY > upperBound.y ? upperBound.y : clampedY
+		outZ[i] = clampedZ > upperBound.z ? upperBound.z : clampedZ
+	}
+}
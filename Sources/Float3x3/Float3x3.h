@@ -3,15 +3,30 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 #pragma once
 
-#import <Vuckt/Float3.h>
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+#if __has_include(<Vuckt/PackedFloat3.h>)
+	#import <Vuckt/PackedFloat3.h>
+#else
+	#include "../PackedFloat3/PackedFloat3.h"
+#endif
 
-#import <Foundation/NSValue.h>
-#import <tgmath.h>
-#import <simd/simd.h>
-#if TARGET_OS_MAC
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#if __OBJC__
+	#import <Foundation/NSValue.h>
+#endif
+#include <tgmath.h>
+#if __OBJC__ && TARGET_OS_MAC
 	#import <SceneKit/SceneKitTypes.h>
 #endif
-#if TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 	#import <GLKit/GLKMatrix3.h>
 #endif
 //#if TARGET_OS_MAC
@@ -27,6 +42,7 @@
 
 
 NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
 
 
 
@@ -42,7 +58,7 @@ struct Float3x3 { // @expected: Padding size of 'Float3x3' with 4 bytes to align
 	float m20 __attribute__((aligned(__alignof__(simd_float3)))); // @expected: Padding struct 'Float3x3' with 4 bytes to align 'm20'
 	float m21;
 	float m22;
-} __attribute__((aligned(__alignof__(simd_float3x3))));
+} __attribute__((aligned(__alignof__(simd_float3x3)))) VUCKT_SIMD_MAY_ALIAS;
 typedef struct Float3x3 Float3x3;
 
 
@@ -66,14 +82,148 @@ NS_INLINE Float3x3 Float3x3FromSimd(simd_float3x3 simdValue) {
 
 NS_INLINE Float3x3 Float3x3OuterProduct(Float3 a, Float3 b) {
 	simd_float3 a_simd = Float3ToSimd(a);
-	simd_float3 b_simd = Float3ToSimd(b);
 	return Float3x3FromSimd(simd_matrix(
-		(a_simd * b_simd.x), (a_simd * b_simd.y), (a_simd * b_simd.z)
+		(a_simd * b.x), (a_simd * b.y), (a_simd * b.z)
 	));
 }
 
 
 
+#pragma mark Batch Transforms
+
+// Transforms of `n`-element arrays by a single matrix, for bulk passes (vertex buffers & the like) that would otherwise pay a matrix load & `simd_float3` round-trip per element.
+// The kernels are column-broadcast: the matrix's columns are loaded into vector registers once for the whole batch, then each element is `c0 * x + c1 * y + c2 * z` (contracted to FMAs where the target has them).
+// `out` may be the same array as the input (for in-place operation), but must not otherwise overlap it.
+
+/// Returns the normal matrix for `m`— its inverse-transpose, computed directly from the cofactors (cross products of the columns).
+NS_INLINE Float3x3 Float3x3NormalMatrix(Float3x3 m) {
+	simd_float3x3 m_simd = Float3x3ToSimd(m);
+	simd_float3 c0 = m_simd.columns[0], c1 = m_simd.columns[1], c2 = m_simd.columns[2];
+	simd_float3 n0 = simd_cross(c1, c2), n1 = simd_cross(c2, c0), n2 = simd_cross(c0, c1);
+	float inverseDeterminant = 1.0f / (c0[0] * n0[0] + c0[1] * n0[1] + c0[2] * n0[2]);
+	return Float3x3FromSimd(simd_matrix(
+		(n0 * inverseDeterminant), (n1 * inverseDeterminant), (n2 * inverseDeterminant)
+	));
+}
+
+/// `out[i] = m * vectors[i]`
+NS_INLINE void Float3x3TransformVectors(Float3x3 m, const Float3 *vectors, Float3 *out, size_t n) {
+	simd_float3x3 m_simd = Float3x3ToSimd(m);
+	simd_float3 c0 = m_simd.columns[0], c1 = m_simd.columns[1], c2 = m_simd.columns[2];
+	for (size_t i = 0; i < n; ++i) {
+		Float3 v = vectors[i];
+		out[i] = Float3FromSimd(c0 * v.x + c1 * v.y + c2 * v.z);
+	}
+}
+/// `out[i] = m * vectors[i]`, reading & writing tightly-packed 12-byte vectors.
+NS_INLINE void Float3x3TransformPackedVectors(Float3x3 m, const PackedFloat3 *vectors, PackedFloat3 *out, size_t n) {
+	simd_float3x3 m_simd = Float3x3ToSimd(m);
+	simd_float3 c0 = m_simd.columns[0], c1 = m_simd.columns[1], c2 = m_simd.columns[2];
+	for (size_t i = 0; i < n; ++i) {
+		PackedFloat3 v = vectors[i];
+		simd_float3 r = c0 * v.x + c1 * v.y + c2 * v.z;
+		out[i] = (PackedFloat3){ r[0], r[1], r[2] };
+	}
+}
+
+/// `out[i] = Float3x3NormalMatrix(m) * normals[i]`, with the normal matrix computed once for the whole batch.
+/// If `m` scales non-uniformly the results aren't unit-length; pass `renormalize` to normalize each one.  (Zero-length results then produce NaNs, as `simd_normalize()` does.)
+NS_INLINE void Float3x3TransformNormals(Float3x3 m, const Float3 *normals, Float3 *out, size_t n, bool renormalize) {
+	simd_float3x3 normalMatrix_simd = Float3x3ToSimd(Float3x3NormalMatrix(m));
+	simd_float3 c0 = normalMatrix_simd.columns[0], c1 = normalMatrix_simd.columns[1], c2 = normalMatrix_simd.columns[2];
+	for (size_t i = 0; i < n; ++i) {
+		Float3 v = normals[i];
+		simd_float3 r = c0 * v.x + c1 * v.y + c2 * v.z;
+		if (renormalize) {
+			r = r * (1.0f / vuckt_sqrtf(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]));
+		}
+		out[i] = Float3FromSimd(r);
+	}
+}
+/// `out[i] = Float3x3NormalMatrix(m) * normals[i]`, reading & writing tightly-packed 12-byte vectors.
+NS_INLINE void Float3x3TransformPackedNormals(Float3x3 m, const PackedFloat3 *normals, PackedFloat3 *out, size_t n, bool renormalize) {
+	simd_float3x3 normalMatrix_simd = Float3x3ToSimd(Float3x3NormalMatrix(m));
+	simd_float3 c0 = normalMatrix_simd.columns[0], c1 = normalMatrix_simd.columns[1], c2 = normalMatrix_simd.columns[2];
+	for (size_t i = 0; i < n; ++i) {
+		PackedFloat3 v = normals[i];
+		simd_float3 r = c0 * v.x + c1 * v.y + c2 * v.z;
+		if (renormalize) {
+			r = r * (1.0f / vuckt_sqrtf(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]));
+		}
+		out[i] = (PackedFloat3){ r[0], r[1], r[2] };
+	}
+}
+
+
+
+#pragma mark Euler-Angle Conversion
+
+// Rotation matrices to & from Euler angles (radians), rotating about `firstAxis`, then `secondAxis`, then `thirdAxis` (0 = x, 1 = y, 2 = z; e.g. `RotationOrder.zxy` is 2, 0, 1).  See `VucktPlatform.h`'s Euler-angle helpers for how one closed form covers every order.
+
+/// The rotation whose Euler angles have the given sines & cosines: the product of the three axis rotations, `Rk · Rj · Ri`, expanded.
+NS_INLINE Float3x3 Float3x3FromEulerSinCos(Float3 sinOfAngles, Float3 cosOfAngles, int firstAxis, int secondAxis, int thirdAxis) {
+	const float s[3] = { sinOfAngles.x, sinOfAngles.y, sinOfAngles.z }, c[3] = { cosOfAngles.x, cosOfAngles.y, cosOfAngles.z };
+	float parity = vuckt_euler_parity(firstAxis, secondAxis);
+	float si = parity * s[firstAxis], sj = parity * s[secondAxis], sk = parity * s[thirdAxis];
+	float ci = c[firstAxis], cj = c[secondAxis], ck = c[thirdAxis];
+	// `r[row][column]`, in relabeled axes.
+	const float r[3][3] = {
+		{ cj * ck, si * sj * ck - ci * sk, ci * sj * ck + si * sk },
+		{ cj * sk, si * sj * sk + ci * ck, ci * sj * sk - si * ck },
+		{ -sj, si * cj, ci * cj },
+	};
+	const int axes[3] = { firstAxis, secondAxis, thirdAxis };
+	float m[3][3]; // `m[column][row]`
+	for (int row = 0; row < 3; ++row) {
+		for (int column = 0; column < 3; ++column)
+			m[axes[column]][axes[row]] = r[row][column];
+	}
+	return (Float3x3){ m[0][0], m[0][1], m[0][2], m[1][0], m[1][1], m[1][2], m[2][0], m[2][1], m[2][2] };
+}
+NS_INLINE Float3x3 Float3x3FromEulerAngles(Float3 eulerAngles, int firstAxis, int secondAxis, int thirdAxis) {
+	Float3 sinOfAngles, cosOfAngles;
+	Float3SinCos(eulerAngles, &sinOfAngles, &cosOfAngles);
+	return Float3x3FromEulerSinCos(sinOfAngles, cosOfAngles, firstAxis, secondAxis, thirdAxis);
+}
+/// `Float3x3FromEulerAngles()`, with the sines & cosines from `Float3SinCosFast()`.
+NS_INLINE Float3x3 Float3x3FromEulerAnglesFast(Float3 eulerAngles, int firstAxis, int secondAxis, int thirdAxis) {
+	Float3 sinOfAngles, cosOfAngles;
+	Float3SinCosFast(eulerAngles, &sinOfAngles, &cosOfAngles);
+	return Float3x3FromEulerSinCos(sinOfAngles, cosOfAngles, firstAxis, secondAxis, thirdAxis);
+}
+
+/// The Euler angles of rotation matrix `m`, which `Float3x3FromEulerAngles()` turns back into `m`.
+NS_INLINE Float3 Float3x3ToEulerAngles(Float3x3 m, int firstAxis, int secondAxis, int thirdAxis) {
+	const float columns[3][3] = { { m.m00, m.m01, m.m02 }, { m.m10, m.m11, m.m12 }, { m.m20, m.m21, m.m22 } };
+	// `r[row][column]`, in relabeled axes.
+	const float r[3][3] = {
+		{ columns[firstAxis][firstAxis], columns[secondAxis][firstAxis], columns[thirdAxis][firstAxis] },
+		{ columns[firstAxis][secondAxis], columns[secondAxis][secondAxis], columns[thirdAxis][secondAxis] },
+		{ columns[firstAxis][thirdAxis], columns[secondAxis][thirdAxis], columns[thirdAxis][thirdAxis] },
+	};
+	float angles[3];
+	vuckt_euler_angles_from_rotation(r, firstAxis, secondAxis, thirdAxis, angles);
+	return (Float3){ angles[0], angles[1], angles[2] };
+}
+
+/// `out[i] = Float3x3FromEulerAngles(eulerAngles[i], firstAxis, secondAxis, thirdAxis)`, taking the sines & cosines of 4 elements at a time with `Float3SinCosLanes()`.
+/// `out` must not overlap `eulerAngles`.
+NS_INLINE void Float3x3FromEulerAnglesArray(const Float3 *eulerAngles, Float3x3 *out, size_t n, int firstAxis, int secondAxis, int thirdAxis) {
+	VUCKT_FOR_EACH_BLOCK4(n, i, count, {
+		simd_float4 sinOfAngles[3], cosOfAngles[3];
+		Float3SinCosLanes(eulerAngles + i, count, 1.0f, sinOfAngles, cosOfAngles);
+		for (size_t laneI = 0; laneI < count; ++laneI) {
+			out[i + laneI] = Float3x3FromEulerSinCos(
+				(Float3){ sinOfAngles[0][laneI], sinOfAngles[1][laneI], sinOfAngles[2][laneI] },
+				(Float3){ cosOfAngles[0][laneI], cosOfAngles[1][laneI], cosOfAngles[2][laneI] },
+				firstAxis, secondAxis, thirdAxis
+			);
+		}
+	});
+}
+
+
+
 //#if TARGET_OS_MAC
 //	#pragma mark SceneKit Conversion
 //
@@ -89,7 +239,7 @@ NS_INLINE Float3x3 Float3x3OuterProduct(Float3 a, Float3 b) {
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 	#pragma mark GLKit Conversion
 
 	/// Converts a `Float3x3` struct to `GLKMatrix3` struct using passing-individual-members initialization.
@@ -108,7 +258,7 @@ NS_INLINE Float3x3 Float3x3OuterProduct(Float3 a, Float3 b) {
 			glkValue.m20, glkValue.m21, glkValue.m22,
 		};
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_WATCH
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 
 
 
@@ -205,6 +355,7 @@ NS_INLINE Float3x3 Float3x3OuterProduct(Float3 a, Float3 b) {
 
 
 
+#if __OBJC__
 #pragma mark `NSValue`-Wrapping
 
 @interface NSValue (Float3x3Additions)
@@ -214,7 +365,9 @@ NS_INLINE Float3x3 Float3x3OuterProduct(Float3 a, Float3 b) {
 @property(nonatomic, readonly) Float3x3 float3x3Value;
 
 @end
+#endif // __OBJC__
 
 
 
+VUCKT_DIAGNOSTICS_END
 NS_ASSUME_NONNULL_END
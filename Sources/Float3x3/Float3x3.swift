@@ -3,7 +3,14 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
 import Foundation
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
 #if canImport(SceneKit)
 	import SceneKit.SceneKitTypes
 #endif
@@ -13,26 +20,6 @@ import simd
 
 
 
-fileprivate func simdSinAndCosFuncs() -> (sin: (_: simd_float3) -> simd_float3, cos: (_: simd_float3) -> simd_float3) {
-	let sin: (_: simd_float3) -> simd_float3
-	let cos: (_: simd_float3) -> simd_float3
-	#if canImport(Darwin)
-		if #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, visionOS 1.0, *) {
-			sin = simd.sin
-			cos = simd.cos
-		} else {
-			sin = __tg_sin
-			cos = __tg_cos
-		}
-	#else
-		sin = simd.sin
-		cos = simd.cos
-	#endif
-	return (sin, cos)
-}
-
-
-
 public typealias Matrix3 = Float3x3
 
 /// 3×3 `Float`-element matrix, typically used in 3D space for rotating and scaling.
@@ -118,8 +105,17 @@ extension Float3x3
 	// MARK: 3D Transform Initializers
 	
 	/// `axis` is expected to be a unit-length (“normalized”) vector.
-	public init(rotationAngle angle_radians:Float, axis:Float3) {
-		let (sinOfAngle, cosOfAngle) = ( sin(angle_radians), cos(angle_radians) )
+	/// With `precision: .fast`, computes the angle's sine & cosine with `Float3SinCosFast()`.
+	public init(rotationAngle angle_radians:Float, axis:Float3, precision:MathPrecision = .full) {
+		let (sinOfAngle, cosOfAngle): (Float, Float)
+		switch precision {
+			case .full:
+				(sinOfAngle, cosOfAngle) = ( sin(angle_radians), cos(angle_radians) )
+			case .fast:
+				var sinOfAngles = Float3(), cosOfAngles = Float3()
+				Float3SinCosFast(Float3(angle_radians, angle_radians, angle_radians), &sinOfAngles, &cosOfAngles)
+				(sinOfAngle, cosOfAngle) = ( sinOfAngles.x, cosOfAngles.x )
+		}
 
 		/* Based on https://en.wikipedia.org/wiki/Rotation_matrix#Rotation_matrix_from_axis_and_angle and https://github.com/g-truc/glm/blob/master/glm/ext/matrix_transform.inl */
 		self.init(columns:
@@ -129,47 +125,21 @@ extension Float3x3
 		)
 	}
 	@available(macOS 10.12, iOS 10.10, tvOS 10.10, watchOS 3.0, *)
-	@_transparent public init(rotationAngle angleMeasurement:Measurement<UnitAngle>, axis:Float3) {
+	@_transparent public init(rotationAngle angleMeasurement:Measurement<UnitAngle>, axis:Float3, precision:MathPrecision = .full) {
 		let angleMeasurement_radians = angleMeasurement.converted(to: .radians)
-		self.init(rotationAngle: Float(angleMeasurement_radians.value), axis: axis)
+		self.init(rotationAngle: Float(angleMeasurement_radians.value), axis: axis, precision: precision)
 	}
 	
-	public init(rotationEulerAngles eulerAngles_radians:Float3, order:RotationOrder = .zxy) {
-		let (sin, cos) = simdSinAndCosFuncs()
-		
-		let sinOfAngles = sin(eulerAngles_radians.simdValue)
-		let cosOfAngles = cos(eulerAngles_radians.simdValue)
-		
-		let xRotation = Self(columns:
-			Float3(1, 0, 0),
-			Float3(0, cosOfAngles.x, sinOfAngles.x),
-			Float3(0, -sinOfAngles.x, cosOfAngles.x)
-		)
-		let yRotation = Self(columns:
-			Float3(cosOfAngles.y, 0, -sinOfAngles.y),
-			Float3(0, 1, 0),
-			Float3(sinOfAngles.y, 0, cosOfAngles.y)
-		)
-		let zRotation = Self(columns:
-			Float3(cosOfAngles.z, sinOfAngles.z, 0),
-			Float3(-sinOfAngles.z, cosOfAngles.z, 0),
-			Float3(0, 0, 1)
-		)
-		let rotationsInOrder:[Self] = {
-			switch order {
-				case .xyz: return [ xRotation, yRotation, zRotation ]
-				case .xzy: return [ xRotation, zRotation, yRotation ]
-				case .yxz: return [ yRotation, xRotation, zRotation ]
-				case .yzx: return [ yRotation, zRotation, xRotation ]
-				case .zxy: return [ zRotation, xRotation, yRotation ]
-				case .zyx: return [ zRotation, yRotation, xRotation ]
-			}
-		}()
-		
-		self = rotationsInOrder[2] * rotationsInOrder[1] * rotationsInOrder[0]
+	/// Computes the rotation in closed form for `order` (see `Float3x3FromEulerAngles()`), with no intermediate axis rotations.  With `precision: .fast`, computes the angles' sines & cosines with `Float3SinCosFast()`.
+	@_transparent public init(rotationEulerAngles eulerAngles_radians:Float3, order:RotationOrder = .zxy, precision:MathPrecision = .full) {
+		let axes = order.axisIndices
+		switch precision {
+			case .full: self = Float3x3FromEulerAngles(eulerAngles_radians, axes.first, axes.second, axes.third)
+			case .fast: self = Float3x3FromEulerAnglesFast(eulerAngles_radians, axes.first, axes.second, axes.third)
+		}
 	}
 	@available(macOS 10.12, iOS 10.10, tvOS 10.10, watchOS 3.0, *)
-	@_transparent public init(rotationEulerAngles eulerAnglesMeasurements:(x:Measurement<UnitAngle>,y:Measurement<UnitAngle>,z:Measurement<UnitAngle>), order:RotationOrder = .zxy) {
+	@_transparent public init(rotationEulerAngles eulerAnglesMeasurements:(x:Measurement<UnitAngle>,y:Measurement<UnitAngle>,z:Measurement<UnitAngle>), order:RotationOrder = .zxy, precision:MathPrecision = .full) {
 		let eulerAnglesMeasurements_radians = (
 			x: eulerAnglesMeasurements.x.converted(to: .radians),
 			y: eulerAnglesMeasurements.y.converted(to: .radians),
@@ -181,9 +151,15 @@ extension Float3x3
 				Float(eulerAnglesMeasurements_radians.y.value),
 				Float(eulerAnglesMeasurements_radians.z.value)
 			),
-			order: order
+			order: order,
+			precision: precision
 		)
 	}
+	/// The Euler angles (radians) that `init(rotationEulerAngles:order:)` turns back into this rotation matrix.  The second-rotated axis' angle is in [ -π/2, π/2 ], the others in [ -π, π ].
+	@_transparent public func rotationEulerAngles(order:RotationOrder = .zxy) -> Float3 {
+		let axes = order.axisIndices
+		return Float3x3ToEulerAngles(self, axes.first, axes.second, axes.third)
+	}
 	
 	public init(scale:Float3) {
 		self.init(diagonal: scale)
@@ -196,8 +172,8 @@ extension Float3x3
 	
 	// MARK: commonly-used “presets”
 	
-	public static let zero = Float3x3()
-	public static let identity = Float3x3(matrix_identity_float3x3);
+	@_transparent public static var zero:Float3x3 { return Float3x3() }
+	@_transparent public static var identity:Float3x3 { return Float3x3(diagonal: 1) }
 	
 	
 	
@@ -612,6 +588,56 @@ extension Float3x3 // Geometric Math Operations
 }
 
 
+extension Float3x3 // Batch Transforms
+{
+	/// The inverse-transpose, for transforming normals.
+	@_transparent public func normalMatrix() -> Float3x3 {
+		return Float3x3NormalMatrix(self)
+	}
+	
+	
+	/// Transforms each vector in `vectors` into `out`.  (Both buffers must have the same count; they may be the same buffer, but must not otherwise overlap.)
+	@_alwaysEmitIntoClient public func transformVectors(_ vectors:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>) {
+		vectors._vucktBulkOperation(into: out){ Float3x3TransformVectors(self, $0, $1, $2) }
+	}
+	@_alwaysEmitIntoClient public func transformVectors(_ vectors:UnsafeBufferPointer<PackedFloat3>, into out:UnsafeMutableBufferPointer<PackedFloat3>) {
+		vectors._vucktBulkOperation(into: out){ Float3x3TransformPackedVectors(self, $0, $1, $2) }
+	}
+	@_alwaysEmitIntoClient public func transformedVectors(_ vectors:[Float3]) -> [Float3] {
+		return vectors._vucktBulkOperation{ Float3x3TransformVectors(self, $0, $1, $2) }
+	}
+	@_alwaysEmitIntoClient public func transformedVectors(_ vectors:[PackedFloat3]) -> [PackedFloat3] {
+		return vectors._vucktBulkOperation{ Float3x3TransformPackedVectors(self, $0, $1, $2) }
+	}
+	
+	
+	/// Transforms each normal in `normals` by the inverse-transpose (computed once for the whole batch) into `out`, normalizing each result if `renormalize` is set.  (Both buffers must have the same count; they may be the same buffer, but must not otherwise overlap.)
+	@_alwaysEmitIntoClient public func transformNormals(_ normals:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>, renormalize:Bool = false) {
+		normals._vucktBulkOperation(into: out){ Float3x3TransformNormals(self, $0, $1, $2, renormalize) }
+	}
+	@_alwaysEmitIntoClient public func transformNormals(_ normals:UnsafeBufferPointer<PackedFloat3>, into out:UnsafeMutableBufferPointer<PackedFloat3>, renormalize:Bool = false) {
+		normals._vucktBulkOperation(into: out){ Float3x3TransformPackedNormals(self, $0, $1, $2, renormalize) }
+	}
+	@_alwaysEmitIntoClient public func transformedNormals(_ normals:[Float3], renormalize:Bool = false) -> [Float3] {
+		return normals._vucktBulkOperation{ Float3x3TransformNormals(self, $0, $1, $2, renormalize) }
+	}
+	@_alwaysEmitIntoClient public func transformedNormals(_ normals:[PackedFloat3], renormalize:Bool = false) -> [PackedFloat3] {
+		return normals._vucktBulkOperation{ Float3x3TransformPackedNormals(self, $0, $1, $2, renormalize) }
+	}
+	
+	
+	/// The rotation matrix for each of `eulerAngles` (as `init(rotationEulerAngles:order:)`), written to `out`, taking the sines & cosines of 4 elements at a time.  (Both buffers must have the same count.)
+	@_alwaysEmitIntoClient public static func fromRotationEulerAngles(_ eulerAngles:UnsafeBufferPointer<Float3>, order:RotationOrder = .zxy, into out:UnsafeMutableBufferPointer<Float3x3>) {
+		let axes = order.axisIndices
+		eulerAngles._vucktBulkConversion(into: out){ Float3x3FromEulerAnglesArray($0, $1, $2, axes.first, axes.second, axes.third) }
+	}
+	@_alwaysEmitIntoClient public static func fromRotationEulerAngles(_ eulerAngles:[Float3], order:RotationOrder = .zxy) -> [Float3x3] {
+		let axes = order.axisIndices
+		return eulerAngles._vucktBulkConversion{ Float3x3FromEulerAnglesArray($0, $1, $2, axes.first, axes.second, axes.third) }
+	}
+}
+
+
 extension Float3x3 : Hashable
 {
 	private static let _hashingLargePrimes:[UInt] = [
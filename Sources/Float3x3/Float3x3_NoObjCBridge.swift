@@ -2,7 +2,12 @@
 // @author: Slipp Douglas Thompson
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
-import simd
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
 #if canImport(SceneKit)
 	import SceneKit.SceneKitTypes
 #endif
@@ -97,6 +102,82 @@ public struct Float3x3
 
 
 
+// MARK: Batch Transforms
+
+@_alwaysEmitIntoClient public func Float3x3NormalMatrix(_ m:Float3x3) -> Float3x3 {
+	return Float3x3FromSimd(simd_transpose(simd_inverse(Float3x3ToSimd(m))))
+}
+
+@_alwaysEmitIntoClient public func Float3x3TransformVectors(_ m:Float3x3, _ vectors:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	let m_simd = Float3x3ToSimd(m)
+	for i in 0..<n {
+		out[i] = Float3FromSimd(simd_mul(m_simd, Float3ToSimd(vectors[i])))
+	}
+}
+@_alwaysEmitIntoClient public func Float3x3TransformPackedVectors(_ m:Float3x3, _ vectors:UnsafePointer<PackedFloat3>, _ out:UnsafeMutablePointer<PackedFloat3>, _ n:Int) {
+	let m_simd = Float3x3ToSimd(m)
+	for i in 0..<n {
+		let v = vectors[i]
+		let r = simd_mul(m_simd, simd_float3(v.x, v.y, v.z))
+		out[i] = PackedFloat3(x: r.x, y: r.y, z: r.z)
+	}
+}
+
+@_alwaysEmitIntoClient public func Float3x3TransformNormals(_ m:Float3x3, _ normals:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int, _ renormalize:Bool) {
+	let normalMatrix_simd = Float3x3ToSimd(Float3x3NormalMatrix(m))
+	for i in 0..<n {
+		let r = simd_mul(normalMatrix_simd, Float3ToSimd(normals[i]))
+		out[i] = Float3FromSimd(renormalize ? simd_normalize(r) : r)
+	}
+}
+@_alwaysEmitIntoClient public func Float3x3TransformPackedNormals(_ m:Float3x3, _ normals:UnsafePointer<PackedFloat3>, _ out:UnsafeMutablePointer<PackedFloat3>, _ n:Int, _ renormalize:Bool) {
+	let normalMatrix_simd = Float3x3ToSimd(Float3x3NormalMatrix(m))
+	for i in 0..<n {
+		let v = normals[i]
+		var r = simd_mul(normalMatrix_simd, simd_float3(v.x, v.y, v.z))
+		if renormalize {
+			r = simd_normalize(r)
+		}
+		out[i] = PackedFloat3(x: r.x, y: r.y, z: r.z)
+	}
+}
+
+
+
+// MARK: Euler-Angle Conversion
+
+@_alwaysEmitIntoClient public func Float3x3FromEulerAngles(_ eulerAngles:Float3, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) -> Float3x3 {
+	return Float3x3FromSimd(simd_float3x3(FloatQuaternionToSimd(FloatQuaternionFromEulerAngles(eulerAngles, firstAxis, secondAxis, thirdAxis))))
+}
+/// The Swift backend uses the full-precision sines & cosines here (trivially meeting the C backend's error bounds).
+@_alwaysEmitIntoClient public func Float3x3FromEulerAnglesFast(_ eulerAngles:Float3, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) -> Float3x3 {
+	return Float3x3FromEulerAngles(eulerAngles, firstAxis, secondAxis, thirdAxis)
+}
+@_alwaysEmitIntoClient public func Float3x3ToEulerAngles(_ m:Float3x3, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) -> Float3 {
+	// A port of `VucktPlatform.h`'s `vuckt_euler_angles_from_rotation()`, reading the relabeled `r[row][column]` straight out of `columns[axes[column]][axes[row]]`.
+	let columns = Float3x3ToSimd(m)
+	let (i, j, k) = (Int(firstAxis), Int(secondAxis), Int(thirdAxis))
+	let parity:Float = ((j - i + 3) % 3 == 1) ? 1 : -1
+	var angles = simd_float3()
+	let cosOfSecond = (columns[i][i] * columns[i][i] + columns[i][j] * columns[i][j]).squareRoot()
+	angles[j] = parity * atan2(-columns[i][k], cosOfSecond)
+	if cosOfSecond > 4e-6 {
+		angles[i] = parity * atan2(columns[j][k], columns[k][k])
+		angles[k] = parity * atan2(columns[i][j], columns[i][i])
+	} else {
+		angles[i] = parity * atan2(-columns[k][j], columns[j][j])
+		angles[k] = 0
+	}
+	return Float3FromSimd(angles)
+}
+@_alwaysEmitIntoClient public func Float3x3FromEulerAnglesArray(_ eulerAngles:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3x3>, _ n:Int, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) {
+	for i in 0..<n {
+		out[i] = Float3x3FromEulerAngles(eulerAngles[i], firstAxis, secondAxis, thirdAxis)
+	}
+}
+
+
+
 //#if canImport(SceneKit)
 //	// MARK: SceneKit Conversion
 //		
@@ -3,21 +3,28 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 #pragma once
 
-#import <Foundation/NSValue.h>
-#import <simd/simd.h>
-#if TARGET_OS_MAC
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#if __OBJC__
+	#import <Foundation/NSValue.h>
+#endif
+#if __OBJC__ && TARGET_OS_MAC
 	#import <SceneKit/SceneKitTypes.h>
 #endif
-#if TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 	#import <GLKit/GLKVector4.h>
 #endif
-#if TARGET_OS_MAC && !TARGET_OS_WATCH
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 	#import <CoreImage/CIVector.h>
 #endif
 
 
 
 NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
 
 
 
@@ -63,11 +70,7 @@ NS_INLINE Float4 Float4Divide(Float4 a, Float4 b) {
 	return Float4FromSimd(Float4ToSimd(a) / Float4ToSimd(b));
 }
 NS_INLINE Float4 Float4Modulus(Float4 a, Float4 b) {
-	#ifdef __cplusplus
-		return Float4FromSimd(simd::fmod(Float4ToSimd(a), Float4ToSimd(b)));
-	#else
-		return Float4FromSimd(fmod(Float4ToSimd(a), Float4ToSimd(b)));
-	#endif
+	return Float4FromSimd(vuckt_simd_fmod(Float4ToSimd(a), Float4ToSimd(b)));
 }
 NS_INLINE Float4 Float4MultiplyByScalar(Float4 v, float s) {
 	return Float4FromSimd(Float4ToSimd(v) * s);
@@ -88,22 +91,158 @@ NS_INLINE Float4 Float4ModulusingScalar(float s, Float4 v) {
 	return Float4Modulus((Float4){ s, s, s, s }, v);
 }
 
-NS_INLINE BOOL Float4LessThan(Float4 a, Float4 b) {
+NS_INLINE bool Float4LessThan(Float4 a, Float4 b) {
 	return simd_all(Float4ToSimd(a) < Float4ToSimd(b));
 }
-NS_INLINE BOOL Float4LessThanOrEqual(Float4 a, Float4 b) {
+NS_INLINE bool Float4LessThanOrEqual(Float4 a, Float4 b) {
 	return simd_all(Float4ToSimd(a) <= Float4ToSimd(b));
 }
-NS_INLINE BOOL Float4GreaterThan(Float4 a, Float4 b) {
+NS_INLINE bool Float4GreaterThan(Float4 a, Float4 b) {
 	return simd_all(Float4ToSimd(a) > Float4ToSimd(b));
 }
-NS_INLINE BOOL Float4GreaterThanOrEqual(Float4 a, Float4 b) {
+NS_INLINE bool Float4GreaterThanOrEqual(Float4 a, Float4 b) {
 	return simd_all(Float4ToSimd(a) >= Float4ToSimd(b));
 }
 
 
 
-#if TARGET_OS_MAC
+#pragma mark Fast-Approximate Math
+
+// Faster, approximate counterparts of `Float4`'s `normalized()`, `length()`, & `reciprocal()`; see `VucktPlatform.h`'s `vuckt_simd_fast_*()` kernels for their error bounds.
+
+/// `v` scaled to unit length, via `vuckt_fast_rsqrtf_unguarded()`.  A zero-length `v` yields NaNs, as the full-precision `normalized()` does.
+NS_INLINE Float4 Float4NormalizeFast(Float4 v) {
+	simd_float4 simdValue = Float4ToSimd(v);
+	return Float4FromSimd(simdValue * vuckt_fast_rsqrtf_unguarded(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w));
+}
+NS_INLINE float Float4LengthFast(Float4 v) {
+	return vuckt_fast_sqrtf(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w);
+}
+NS_INLINE Float4 Float4ReciprocalFast(Float4 v) {
+	return Float4FromSimd(vuckt_simd_fast_recip4(Float4ToSimd(v)));
+}
+
+
+
+#pragma mark Array Operations
+
+// Element-wise operations over `n`-element arrays, for bulk passes that would otherwise pay per-element call & load overhead.
+// `out` may be the same array as an input (for in-place operation), but must not otherwise overlap one.
+// Where possible these loop over the flat `float` lanes rather than per-`Float4`, so the compiler can vectorize across elements at the target's full vector width.
+
+/// `out[i] = a[i] + b[i]`
+NS_INLINE void Float4AddArrays(const Float4 *a, const Float4 *b, Float4 *out, size_t n) {
+	const float *aLanes = (const float *)a, *bLanes = (const float *)b;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float4) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] + bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] - b[i]`
+NS_INLINE void Float4SubtractArrays(const Float4 *a, const Float4 *b, Float4 *out, size_t n) {
+	const float *aLanes = (const float *)a, *bLanes = (const float *)b;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float4) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] - bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] * b[i]`
+NS_INLINE void Float4MultiplyArrays(const Float4 *a, const Float4 *b, Float4 *out, size_t n) {
+	const float *aLanes = (const float *)a, *bLanes = (const float *)b;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float4) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] * bLanes[laneI];
+	}
+}
+/// `out[i] = a[i] / b[i]`
+NS_INLINE void Float4DivideArrays(const Float4 *a, const Float4 *b, Float4 *out, size_t n) {
+	const float *aLanes = (const float *)a, *bLanes = (const float *)b;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float4) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = aLanes[laneI] / bLanes[laneI];
+	}
+}
+/// `out[i] = fmod(a[i], b[i])`
+NS_INLINE void Float4ModulusArrays(const Float4 *a, const Float4 *b, Float4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Float4Modulus(a[i], b[i]);
+	}
+}
+/// `out[i] = -v[i]`
+NS_INLINE void Float4NegateArray(const Float4 *v, Float4 *out, size_t n) {
+	const float *vLanes = (const float *)v;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float4) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = -vLanes[laneI];
+	}
+}
+/// `out[i] = v[i] * s`
+NS_INLINE void Float4MultiplyByScalarArray(const Float4 *v, float s, Float4 *out, size_t n) {
+	const float *vLanes = (const float *)v;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float4) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = vLanes[laneI] * s;
+	}
+}
+/// `out[i] = v[i] / s`
+NS_INLINE void Float4DivideByScalarArray(const Float4 *v, float s, Float4 *out, size_t n) {
+	const float *vLanes = (const float *)v;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Float4) / sizeof(float)); ++laneI) {
+		outLanes[laneI] = vLanes[laneI] / s;
+	}
+}
+/// `out[i] = fmod(v[i], s)`
+NS_INLINE void Float4ModulusByScalarArray(const Float4 *v, float s, Float4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Float4ModulusByScalar(v[i], s);
+	}
+}
+/// `out[i] = v[i] / length(v[i])`  (A zero-length `v[i]` yields NaNs, as `normalized()` does.)
+NS_INLINE void Float4NormalizeArray(const Float4 *v, Float4 *out, size_t n) {
+	// 4 elements' lengths at a time, for one vector square root & division per 4.
+	VUCKT_FOR_EACH_BLOCK4(n, i, count, {
+		simd_float4 lengthsSquared = { 1, 1, 1, 1 };
+		for (size_t laneI = 0; laneI < count; ++laneI) {
+			Float4 p = v[i + laneI];
+			lengthsSquared[laneI] = p.x * p.x + p.y * p.y + p.z * p.z + p.w * p.w;
+		}
+		simd_float4 inverseLengths = 1.0f / vuckt_simd_sqrt4(lengthsSquared);
+		for (size_t laneI = 0; laneI < count; ++laneI) {
+			Float4 p = v[i + laneI];
+			float inverseLength = inverseLengths[laneI];
+			out[i + laneI] = (Float4){ p.x * inverseLength, p.y * inverseLength, p.z * inverseLength, p.w * inverseLength };
+		}
+	});
+}
+/// `v[0] + v[1] + … + v[n - 1]`, accumulated as 4 running sums (of every 4th element) added pairwise at the end, so the result depends only on `v` & `n`, not on the target's vector width.
+NS_INLINE Float4 Float4SumArray(const Float4 *v, size_t n) {
+	simd_float4 sum0 = Float4ToSimd((Float4){ 0, 0, 0, 0 }), sum1 = sum0, sum2 = sum0, sum3 = sum0;
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		sum0 += Float4ToSimd(v[i]);
+		sum1 += Float4ToSimd(v[i + 1]);
+		sum2 += Float4ToSimd(v[i + 2]);
+		sum3 += Float4ToSimd(v[i + 3]);
+	}
+	if (i < n) sum0 += Float4ToSimd(v[i++]);
+	if (i < n) sum1 += Float4ToSimd(v[i++]);
+	if (i < n) sum2 += Float4ToSimd(v[i++]);
+	return Float4FromSimd((sum0 + sum1) + (sum2 + sum3));
+}
+
+
+
+#if __OBJC__ && TARGET_OS_MAC
 	#pragma mark SceneKit Conversion
 
 	/// Converts an `Float4` struct to `SCNVector4` struct using SceneKit-provided SIMD↔SCNVector conversion helper function.
@@ -114,11 +253,11 @@ NS_INLINE BOOL Float4GreaterThanOrEqual(Float4 a, Float4 b) {
 	NS_INLINE Float4 Float4FromSCN(SCNVector4 scnValue) {
 		return Float4FromSimd(SCNVector4ToFloat4(scnValue));
 	}
-#endif // TARGET_OS_MAC
+#endif // __OBJC__ && TARGET_OS_MAC
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 	#pragma mark GLKit Conversion
 
 	/// Converts an `Float4` struct to `GLKVector4` struct using passing-individual-members initialization.
@@ -129,11 +268,11 @@ NS_INLINE BOOL Float4GreaterThanOrEqual(Float4 a, Float4 b) {
 	NS_INLINE Float4 Float4FromGLK(GLKVector4 glkValue) {
 		return (Float4){ glkValue.v[0], glkValue.v[1], glkValue.v[2], glkValue.v[3] };
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_WATCH
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 	#pragma mark CoreImage Conversion
 
 	/// Converts an `Float4` struct to `CIVector` class using passing-individual-members initialization.
@@ -145,10 +284,11 @@ NS_INLINE BOOL Float4GreaterThanOrEqual(Float4 a, Float4 b) {
 		assert(ciVector.count == 4);
 		return (Float4){ (simd_float1)ciVector.X, (simd_float1)ciVector.Y, (simd_float1)ciVector.Z, (simd_float1)ciVector.W };
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_WATCH
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 
 
 
+#if __OBJC__
 #pragma mark `NSValue`-Wrapping
 
 @interface NSValue (Float4Additions)
@@ -158,7 +298,9 @@ NS_INLINE BOOL Float4GreaterThanOrEqual(Float4 a, Float4 b) {
 @property(nonatomic, readonly) Float4 float4Value;
 
 @end
+#endif // __OBJC__
 
 
 
+VUCKT_DIAGNOSTICS_END
 NS_ASSUME_NONNULL_END
@@ -3,7 +3,14 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
 import Foundation
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
 #if canImport(SceneKit)
 	import SceneKit.SceneKitTypes
 #endif
@@ -144,25 +151,25 @@ extension Float4
 	
 	// MARK: commonly-used “presets”
 	
-	public static let zero = Float4(scalar: 0)
+	@_transparent public static var zero:Float4 { return Float4(scalar: 0) }
 	
-	public static let one = Self.positiveOne
-	public static let positiveOne = Float4(scalar: 1)
-	public static let negativeOne = Float4(scalar: -1)
+	@_transparent public static var one:Float4 { return Self.positiveOne }
+	@_transparent public static var positiveOne:Float4 { return Float4(scalar: 1) }
+	@_transparent public static var negativeOne:Float4 { return Float4(scalar: -1) }
 	
-	public static let unitX = Self.unitXPositive
-	public static let unitXPositive = Float4(x: 1)
-	public static let unitY = Self.unitYPositive
-	public static let unitYPositive = Float4(y: 1)
-	public static let unitZ = Self.unitZPositive
-	public static let unitZPositive = Float4(z: 1)
-	public static let unitW = Self.unitWPositive
-	public static let unitWPositive = Float4(w: 1)
+	@_transparent public static var unitX:Float4 { return Self.unitXPositive }
+	@_transparent public static var unitXPositive:Float4 { return Float4(x: 1) }
+	@_transparent public static var unitY:Float4 { return Self.unitYPositive }
+	@_transparent public static var unitYPositive:Float4 { return Float4(y: 1) }
+	@_transparent public static var unitZ:Float4 { return Self.unitZPositive }
+	@_transparent public static var unitZPositive:Float4 { return Float4(z: 1) }
+	@_transparent public static var unitW:Float4 { return Self.unitWPositive }
+	@_transparent public static var unitWPositive:Float4 { return Float4(w: 1) }
 	
-	public static let unitXNegative = Float4(x: -1)
-	public static let unitYNegative = Float4(y: -1)
-	public static let unitZNegative = Float4(z: -1)
-	public static let unitWNegative = Float4(w: -1)
+	@_transparent public static var unitXNegative:Float4 { return Float4(x: -1) }
+	@_transparent public static var unitYNegative:Float4 { return Float4(y: -1) }
+	@_transparent public static var unitZNegative:Float4 { return Float4(z: -1) }
+	@_transparent public static var unitWNegative:Float4 { return Float4(w: -1) }
 	
 	
 	
@@ -724,6 +731,13 @@ extension Float4 // Basic Math Operations
 	@_transparent public func reciprocal() -> Float4 {
 		return Float4(simd_recip(self.simdValue))
 	}
+	/// With `.fast`, uses `Float4ReciprocalFast()`.
+	@_transparent public func reciprocal(precision:MathPrecision) -> Float4 {
+		switch precision {
+			case .full: return self.reciprocal()
+			case .fast: return Float4ReciprocalFast(self)
+		}
+	}
 	@_transparent public mutating func formReciprocal() {
 		self = self.reciprocal()
 	}
@@ -748,11 +762,28 @@ extension Float4 // Geometric Math Operations
 	@_transparent public mutating func normalize() {
 		self = self.normalized()
 	}
+	/// With `.fast`, uses `Float4NormalizeFast()`.
+	@_transparent public func normalized(precision:MathPrecision) -> Float4 {
+		switch precision {
+			case .full: return self.normalized()
+			case .fast: return Float4NormalizeFast(self)
+		}
+	}
+	@_transparent public mutating func normalize(precision:MathPrecision) {
+		self = self.normalized(precision: precision)
+	}
 	
 	
 	@_transparent public func length() -> Float {
 		return simd_length(self.simdValue)
 	}
+	/// With `.fast`, uses `Float4LengthFast()`.
+	@_transparent public func length(precision:MathPrecision) -> Float {
+		switch precision {
+			case .full: return self.length()
+			case .fast: return Float4LengthFast(self)
+		}
+	}
 	/// Alias of: `length()`
 	@_transparent public func magnitude() -> Float { return self.length() }
 	/// Alias of: `length()`
@@ -809,19 +840,20 @@ extension Float4 // Geometric Math Operations
 	
 	public enum InterpolationMethod {
 		case linear
+		/// Eases in & out along the cubic Hermite (smoothstep) curve `3t² - 2t³`: from `self` at ratio 0 to `other` at 1, with zero speed at both.
 		case hermite
 	}
 	@_transparent public func interpolated(to other:Float4, ratio:Float, method:Float4.InterpolationMethod = .linear) -> Float4 {
-		return interpolateBetween(self, other, ratio: ratio)
+		return interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	@_transparent public mutating func interpolate(to other:Float4, ratio:Float, method:Float4.InterpolationMethod = .linear) {
-		self = interpolateBetween(self, other, ratio: ratio)
+		self = interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	@_transparent public func interpolated(to other:Float4, ratio:Float4, method:Float4.InterpolationMethod = .linear) -> Float4 {
-		return interpolateBetween(self, other, ratio: ratio)
+		return interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	@_transparent public mutating func interpolate(to other:Float4, ratio:Float4, method:Float4.InterpolationMethod = .linear) {
-		self = interpolateBetween(self, other, ratio: ratio)
+		self = interpolateBetween(self, other, ratio: ratio, method: method)
 	}
 	
 	
@@ -865,7 +897,7 @@ extension Float4 // Geometric Math Operations
 		case .linear:
 			return Float4(simd_mix(a.simdValue, b.simdValue, ratio.simdValue))
 		case .hermite:
-			return Float4(simd_smoothstep(a.simdValue, b.simdValue, ratio.simdValue))
+			return Float4(simd_mix(a.simdValue, b.simdValue, simd_smoothstep(Float4.zero.simdValue, Float4.one.simdValue, ratio.simdValue)))
 	}
 }
 
@@ -878,6 +910,198 @@ extension Float4 // Geometric Math Operations
 }
 
 
+extension UnsafeBufferPointer where Element == Float4 // Bulk Math Operations
+{
+	/// Element-wise `self[i] + other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func add(_ other:UnsafeBufferPointer<Float4>, into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkOperation(other, into: out, Float4AddArrays)
+	}
+	/// Element-wise `self[i] - other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func subtract(_ other:UnsafeBufferPointer<Float4>, into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkOperation(other, into: out, Float4SubtractArrays)
+	}
+	/// Element-wise `self[i] * other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func multiply(by other:UnsafeBufferPointer<Float4>, into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkOperation(other, into: out, Float4MultiplyArrays)
+	}
+	/// Element-wise `self[i] / other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func divide(by other:UnsafeBufferPointer<Float4>, into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkOperation(other, into: out, Float4DivideArrays)
+	}
+	/// Element-wise `self[i] % other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:UnsafeBufferPointer<Float4>, into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkOperation(other, into: out, Float4ModulusArrays)
+	}
+	/// Element-wise `-self[i]`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func negate(into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkOperation(into: out, Float4NegateArray)
+	}
+	/// Element-wise `self[i] * scale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func multiply(by scale:Float, into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkOperation(scale, into: out, Float4MultiplyByScalarArray)
+	}
+	/// Element-wise `self[i] / inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func divide(by inverseScale:Float, into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkOperation(inverseScale, into: out, Float4DivideByScalarArray)
+	}
+	/// Element-wise `self[i] % inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Float, into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkOperation(inverseScale, into: out, Float4ModulusByScalarArray)
+	}
+	/// Element-wise `self[i].normalized()`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func normalize(into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkOperation(into: out, Float4NormalizeArray)
+	}
+	
+	/// The sum of the elements, in a fixed order (see `Float4SumArray()`), so the same elements always give the same sum.
+	@_alwaysEmitIntoClient public func sum() -> Float4 {
+		guard self.count > 0 else { return Float4() }
+		return Float4SumArray(self.baseAddress!, self.count)
+	}
+}
+
+extension Array where Element == Float4 // Bulk Math Operations
+{
+	@_alwaysEmitIntoClient public func adding(_ other:[Float4]) -> [Float4] {
+		return self._vucktBulkOperation(other, Float4AddArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func add(_ other:[Float4]) {
+		self._vucktFormBulkOperation(other, Float4AddArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func subtracting(_ other:[Float4]) -> [Float4] {
+		return self._vucktBulkOperation(other, Float4SubtractArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func subtract(_ other:[Float4]) {
+		self._vucktFormBulkOperation(other, Float4SubtractArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by other:[Float4]) -> [Float4] {
+		return self._vucktBulkOperation(other, Float4MultiplyArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by other:[Float4]) {
+		self._vucktFormBulkOperation(other, Float4MultiplyArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by other:[Float4]) -> [Float4] {
+		return self._vucktBulkOperation(other, Float4DivideArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by other:[Float4]) {
+		self._vucktFormBulkOperation(other, Float4DivideArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:[Float4]) -> [Float4] {
+		return self._vucktBulkOperation(other, Float4ModulusArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy other:[Float4]) {
+		self._vucktFormBulkOperation(other, Float4ModulusArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func negated() -> [Float4] {
+		return self._vucktBulkOperation(Float4NegateArray)
+	}
+	@_alwaysEmitIntoClient public mutating func negate() {
+		self._vucktFormBulkOperation(Float4NegateArray)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by scale:Float) -> [Float4] {
+		return self._vucktBulkOperation(scale, Float4MultiplyByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by scale:Float) {
+		self._vucktFormBulkOperation(scale, Float4MultiplyByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by inverseScale:Float) -> [Float4] {
+		return self._vucktBulkOperation(inverseScale, Float4DivideByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by inverseScale:Float) {
+		self._vucktFormBulkOperation(inverseScale, Float4DivideByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Float) -> [Float4] {
+		return self._vucktBulkOperation(inverseScale, Float4ModulusByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy inverseScale:Float) {
+		self._vucktFormBulkOperation(inverseScale, Float4ModulusByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func normalized() -> [Float4] {
+		return self._vucktBulkOperation(Float4NormalizeArray)
+	}
+	@_alwaysEmitIntoClient public mutating func normalize() {
+		self._vucktFormBulkOperation(Float4NormalizeArray)
+	}
+	
+	/// The sum of the elements— see `UnsafeBufferPointer.sum()`.
+	@_alwaysEmitIntoClient public func sum() -> Float4 {
+		return self.withUnsafeBufferPointer{ $0.sum() }
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == Float4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `simd_float4`s (`SIMD4<Float>`s), in place: `Float4` is laid out as `simd_float4` is (see the `static_assert`s in `Float4.mm`), so nothing's copied.  (Except on the Swift backend, whose `Float4`s are only 4-byte aligned; there they're converted through a temporary buffer.)
+	@_alwaysEmitIntoClient public func withSimdMemoryRebound<Result>(_ body:(UnsafeBufferPointer<simd_float4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: simd_float4.self, converting: Float4ToSimd, body)
+	}
+}
+
+extension UnsafeMutableBufferPointer where Element == Float4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as mutable `simd_float4`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withSimdMemoryRebound<Result>(_ body:(UnsafeMutableBufferPointer<simd_float4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: simd_float4.self, converting: Float4ToSimd, back: Float4FromSimd, body)
+	}
+}
+
+extension Array where Element == Float4 // Zero-Copy Views
+{
+	/// One component of each element (e.g. `components(\.x)`), viewed in place rather than copied out.
+	@_alwaysEmitIntoClient public func components(_ component:KeyPath<Float4, Float>) -> StridedArrayView<Float4, Float> {
+		return StridedArrayView(self, field: component)
+	}
+	
+	/// Calls `body` with the elements as `simd_float4`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withUnsafeSimdBufferPointer<Result>(_ body:(UnsafeBufferPointer<simd_float4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeBufferPointer{ try $0.withSimdMemoryRebound(body) }
+	}
+	/// Calls `body` with the elements as mutable `simd_float4`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public mutating func withUnsafeMutableSimdBufferPointer<Result>(_ body:(UnsafeMutableBufferPointer<simd_float4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeMutableBufferPointer{ try $0.withSimdMemoryRebound(body) }
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == simd_float4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `Float4`s, in place— see the `Float4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withFloat4MemoryRebound<Result>(_ body:(UnsafeBufferPointer<Float4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: Float4.self, converting: Float4FromSimd, body)
+	}
+}
+
+extension UnsafeMutableBufferPointer where Element == simd_float4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as mutable `Float4`s, in place— see the `Float4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withFloat4MemoryRebound<Result>(_ body:(UnsafeMutableBufferPointer<Float4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: Float4.self, converting: Float4FromSimd, back: Float4ToSimd, body)
+	}
+}
+
+extension Array where Element == simd_float4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `Float4`s, in place— see the `Float4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withUnsafeFloat4BufferPointer<Result>(_ body:(UnsafeBufferPointer<Float4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeBufferPointer{ try $0.withFloat4MemoryRebound(body) }
+	}
+	/// Calls `body` with the elements as mutable `Float4`s, in place— see the `Float4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public mutating func withUnsafeMutableFloat4BufferPointer<Result>(_ body:(UnsafeMutableBufferPointer<Float4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeMutableBufferPointer{ try $0.withFloat4MemoryRebound(body) }
+	}
+}
+
+
 extension Float4 : Hashable
 {
 	private static let _hashingLargePrimes:[UInt] = [ 982_917_223, 3_572_352_083, 4_259_235_067, 454_923_701 ]
@@ -2,7 +2,11 @@
 // @author: Slipp Douglas Thompson
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
 #if canImport(SceneKit)
 	import SceneKit.SceneKitTypes
 #endif
@@ -107,6 +111,90 @@ public struct Float4
 
 
 
+// MARK: Fast-Approximate Math
+
+/// The Swift backend has no estimate instructions to build on, so these use the full-precision operations (trivially meeting the C backend's error bounds).
+@_alwaysEmitIntoClient public func Float4NormalizeFast(_ v:Float4) -> Float4 {
+	return Float4FromSimd(simd_normalize(Float4ToSimd(v)))
+}
+@_alwaysEmitIntoClient public func Float4LengthFast(_ v:Float4) -> Float {
+	return simd_length(Float4ToSimd(v))
+}
+@_alwaysEmitIntoClient public func Float4ReciprocalFast(_ v:Float4) -> Float4 {
+	return Float4FromSimd(1 / Float4ToSimd(v))
+}
+
+
+
+// MARK: Array Operations
+
+@_alwaysEmitIntoClient public func Float4AddArrays(_ a:UnsafePointer<Float4>, _ b:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float4Add(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float4SubtractArrays(_ a:UnsafePointer<Float4>, _ b:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float4Subtract(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float4MultiplyArrays(_ a:UnsafePointer<Float4>, _ b:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float4Multiply(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float4DivideArrays(_ a:UnsafePointer<Float4>, _ b:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float4Divide(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float4ModulusArrays(_ a:UnsafePointer<Float4>, _ b:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float4Modulus(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float4NegateArray(_ v:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float4Negate(v[i])
+	}
+}
+@_alwaysEmitIntoClient public func Float4MultiplyByScalarArray(_ v:UnsafePointer<Float4>, _ s:Float, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float4MultiplyByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Float4DivideByScalarArray(_ v:UnsafePointer<Float4>, _ s:Float, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float4DivideByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Float4ModulusByScalarArray(_ v:UnsafePointer<Float4>, _ s:Float, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Float4ModulusByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Float4NormalizeArray(_ v:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		let p = v[i]
+		let inverseLength = 1 / (p.x * p.x + p.y * p.y + p.z * p.z + p.w * p.w).squareRoot()
+		out[i] = Float4(x: p.x * inverseLength, y: p.y * inverseLength, z: p.z * inverseLength, w: p.w * inverseLength)
+	}
+}
+@_alwaysEmitIntoClient public func Float4SumArray(_ v:UnsafePointer<Float4>, _ n:Int) -> Float4 {
+	var sums = (Float4(), Float4(), Float4(), Float4())
+	for i in 0..<n {
+		switch i % 4 {
+			case 0: sums.0 = Float4Add(sums.0, v[i])
+			case 1: sums.1 = Float4Add(sums.1, v[i])
+			case 2: sums.2 = Float4Add(sums.2, v[i])
+			default: sums.3 = Float4Add(sums.3, v[i])
+		}
+	}
+	return Float4Add(Float4Add(sums.0, sums.1), Float4Add(sums.2, sums.3))
+}
+
+
+
 #if canImport(SceneKit)
 	// MARK: SceneKit Conversion
 
@@ -0,0 +1,147 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float4.h>)
+	#import <Vuckt/Float4.h>
+#else
+	#include "../Float4/Float4.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+// Structure-of-arrays (SoA) kernels: an array of `n` Float4s stored as four separate `float` arrays (`x[]`, `y[]`, `z[]`, `w[]`) instead of one array of `Float4`s.
+// Each kernel works one element per loop iteration across plain `float` arrays, so the compiler vectorizes it 4/8/16 elements at a time (SSE or NEON/AVX/AVX-512) with no lane shuffling, and no horizontal adds for reductions like dot products.
+// Output arrays may be the same arrays as inputs (for in-place operation), but must not otherwise overlap them.
+
+
+
+#pragma mark AoS/SoA Transposition
+
+/// Splits `n` `Float4`s into separate per-component arrays.
+NS_INLINE void Float4ArrayToSoA(const Float4 *aos, float *x, float *y, float *z, float *w, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		x[i] = aos[i].x;
+		y[i] = aos[i].y;
+		z[i] = aos[i].z;
+		w[i] = aos[i].w;
+	}
+}
+/// Interleaves separate per-component arrays back into `n` `Float4`s.
+NS_INLINE void Float4ArrayFromSoA(const float *x, const float *y, const float *z, const float *w, Float4 *aos, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		aos[i] = (Float4){ x[i], y[i], z[i], w[i] };
+	}
+}
+
+
+
+#pragma mark SoA Math Operations
+
+/// `out[i] = dot(a[i], b[i])`
+NS_INLINE void Float4SoADotProduct(const float *aX, const float *aY, const float *aZ, const float *aW, const float *bX, const float *bY, const float *bZ, const float *bW, float *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float ax = aX[i], ay = aY[i], az = aZ[i], aw = aW[i];
+		float bx = bX[i], by = bY[i], bz = bZ[i], bw = bW[i];
+		out[i] = ax * bx + ay * by + az * bz + aw * bw;
+	}
+}
+/// `out[i] = length_squared(v[i])`
+NS_INLINE void Float4SoALengthSquared(const float *vX, const float *vY, const float *vZ, const float *vW, float *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float vx = vX[i], vy = vY[i], vz = vZ[i], vw = vW[i];
+		out[i] = vx * vx + vy * vy + vz * vz + vw * vw;
+	}
+}
+/// `out[i] = length(v[i])`
+NS_INLINE void Float4SoALength(const float *vX, const float *vY, const float *vZ, const float *vW, float *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float vx = vX[i], vy = vY[i], vz = vZ[i], vw = vW[i];
+		out[i] = vuckt_sqrtf(vx * vx + vy * vy + vz * vz + vw * vw);
+	}
+}
+/// `out[i] = normalize(v[i])`  (Zero-length elements produce NaNs, as `simd_normalize()` does.)
+NS_INLINE void Float4SoANormalize(const float *vX, const float *vY, const float *vZ, const float *vW, float *outX, float *outY, float *outZ, float *outW, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float vx = vX[i], vy = vY[i], vz = vZ[i], vw = vW[i];
+		float inverseLength = 1.0f / vuckt_sqrtf(vx * vx + vy * vy + vz * vz + vw * vw);
+		outX[i] = vx * inverseLength;
+		outY[i] = vy * inverseLength;
+		outZ[i] = vz * inverseLength;
+		outW[i] = vw * inverseLength;
+	}
+}
+/// `out[i] = mix(a[i], b[i], ratio)`  (Linear interpolation; `ratio` 0 gives `a[i]` & 1 gives `b[i]`.)
+NS_INLINE void Float4SoAMix(const float *aX, const float *aY, const float *aZ, const float *aW, const float *bX, const float *bY, const float *bZ, const float *bW, float ratio, float *outX, float *outY, float *outZ, float *outW, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float ax = aX[i], ay = aY[i], az = aZ[i], aw = aW[i];
+		float bx = bX[i], by = bY[i], bz = bZ[i], bw = bW[i];
+		outX[i] = ax + (bx - ax) * ratio;
+		outY[i] = ay + (by - ay) * ratio;
+		outZ[i] = az + (bz - az) * ratio;
+		outW[i] = aw + (bw - aw) * ratio;
+	}
+}
+/// `out[i] = min(a[i], b[i])`, component-wise.  (Unlike `fminf()`, a NaN in `a` propagates; this is what lets it vectorize without `-ffinite-math-only`.)
+NS_INLINE void Float4SoAMin(const float *aX, const float *aY, const float *aZ, const float *aW, const float *bX, const float *bY, const float *bZ, const float *bW, float *outX, float *outY, float *outZ, float *outW, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float ax = aX[i], ay = aY[i], az = aZ[i], aw = aW[i];
+		float bx = bX[i], by = bY[i], bz = bZ[i], bw = bW[i];
+		outX[i] = bx < ax ? bx : ax;
+		outY[i] = by < ay ? by : ay;
+		outZ[i] = bz < az ? bz : az;
+		outW[i] = bw < aw ? bw : aw;
+	}
+}
+/// `out[i] = max(a[i], b[i])`, component-wise.  (Unlike `fmaxf()`, a NaN in `a` propagates; this is what lets it vectorize without `-ffinite-math-only`.)
+NS_INLINE void Float4SoAMax(const float *aX, const float *aY, const float *aZ, const float *aW, const float *bX, const float *bY, const float *bZ, const float *bW, float *outX, float *outY, float *outZ, float *outW, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float ax = aX[i], ay = aY[i], az = aZ[i], aw = aW[i];
+		float bx = bX[i], by = bY[i], bz = bZ[i], bw = bW[i];
+		outX[i] = bx > ax ? bx : ax;
+		outY[i] = by > ay ? by : ay;
+		outZ[i] = bz > az ? bz : az;
+		outW[i] = bw > aw ? bw : aw;
+	}
+}
+/// `out[i] = clamp(v[i], lowerBound, upperBound)`, component-wise.
+NS_INLINE void Float4SoAClamp(const float *vX, const float *vY, const float *vZ, const float *vW, Float4 lowerBound, Float4 upperBound, float *outX, float *outY, float *outZ, float *outW, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		float vx = vX[i], vy = vY[i], vz = vZ[i], vw = vW[i];
+		float clampedX = vx < lowerBound.x ? lowerBound.x : vx;
+		float clampedY = vy < lowerBound.y ? lowerBound.y : vy;
+		float clampedZ = vz < lowerBound.z ? lowerBound.z : vz;
+		float clampedW = vw < lowerBound.w ? lowerBound.w : vw;
+		outX[i] = clampedX > upperBound.x ? upperBound.x : clampedX;
+		outY[i] = clampedY > upperBound.y ? upperBound.y : clampedY;
+		outZ[i] = clampedZ > upperBound.z ? upperBound.z : clampedZ;
+		outW[i] = clampedW > upperBound.w ? upperBound.w : clampedW;
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
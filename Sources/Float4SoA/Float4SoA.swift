@@ -0,0 +1,294 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+/// Structure-of-arrays storage for `Float4`s: each component in its own contiguous `[Float]` rather than interleaved in one `[Float4]`.
+/// Bulk math over it runs the `Float4SoA…` C kernels, which vectorize across elements instead of within each one.
+public struct Float4SoA
+{
+	public var x:[Float]
+	public var y:[Float]
+	public var z:[Float]
+	public var w:[Float]
+	
+	/// - Precondition: the four component arrays must have the same count.
+	@inlinable public init(x:[Float], y:[Float], z:[Float], w:[Float]) {
+		precondition(y.count == x.count && z.count == x.count && w.count == x.count, "Float4SoA's component arrays must all have the same count.")
+		self.x = x
+		self.y = y
+		self.z = z
+		self.w = w
+	}
+	@inlinable public init() {
+		self.init(x: [], y: [], z: [], w: [])
+	}
+	@inlinable public init(repeating value:Float4, count:Int) {
+		self.init(x: [Float](repeating: value.x, count: count), y: [Float](repeating: value.y, count: count), z: [Float](repeating: value.z, count: count), w: [Float](repeating: value.w, count: count))
+	}
+	/// Transposes an array of `Float4`s into per-component arrays.
+	@inlinable public init(_ elements:[Float4]) {
+		let count = elements.count
+		self = elements.withUnsafeBufferPointer{ elementsBuffer in
+			Float4SoA(_unsafeUninitializedCount: count){ lanes in
+				Float4ArrayToSoA(elementsBuffer.baseAddress!, lanes.x, lanes.y, lanes.z, lanes.w, count)
+			}
+		}
+	}
+	
+	/// Initializes with `count` elements, all of which `initializer` must write through the given per-component pointers.
+	@inlinable internal init(_unsafeUninitializedCount count:Int, initializingWith initializer:(_MutableLanes) -> Void) {
+		guard count > 0 else {
+			self.init()
+			return
+		}
+		var x:[Float] = []
+		var y:[Float] = []
+		var z:[Float] = []
+		var w:[Float] = []
+		x = [Float](unsafeUninitializedCapacity: count){ xBuffer, xCount in
+			y = [Float](unsafeUninitializedCapacity: count){ yBuffer, yCount in
+				z = [Float](unsafeUninitializedCapacity: count){ zBuffer, zCount in
+					w = [Float](unsafeUninitializedCapacity: count){ wBuffer, wCount in
+						initializer(( x: xBuffer.baseAddress!, y: yBuffer.baseAddress!, z: zBuffer.baseAddress!, w: wBuffer.baseAddress! ))
+						wCount = count
+					}
+					zCount = count
+				}
+				yCount = count
+			}
+			xCount = count
+		}
+		self.init(x: x, y: y, z: z, w: w)
+	}
+	
+	
+	// MARK: Lane Access
+	
+	@usableFromInline internal typealias _Lanes = (x:UnsafePointer<Float>, y:UnsafePointer<Float>, z:UnsafePointer<Float>, w:UnsafePointer<Float>)
+	@usableFromInline internal typealias _MutableLanes = (x:UnsafeMutablePointer<Float>, y:UnsafeMutablePointer<Float>, z:UnsafeMutablePointer<Float>, w:UnsafeMutablePointer<Float>)
+	
+	/// Calls `body` with pointers to the per-component arrays' storage.
+	/// - Precondition: `self` must not be empty (since an empty array may have no storage to point to).
+	@inlinable internal func _withLanes<Result>(_ body:(_Lanes) -> Result) -> Result {
+		return self.x.withUnsafeBufferPointer{ xBuffer in
+			self.y.withUnsafeBufferPointer{ yBuffer in
+				self.z.withUnsafeBufferPointer{ zBuffer in
+					self.w.withUnsafeBufferPointer{ wBuffer in
+						body(( x: xBuffer.baseAddress!, y: yBuffer.baseAddress!, z: zBuffer.baseAddress!, w: wBuffer.baseAddress! ))
+					}
+				}
+			}
+		}
+	}
+	/// Calls `body` with mutable pointers to the per-component arrays' storage.
+	/// - Precondition: `self` must not be empty (since an empty array may have no storage to point to).
+	@inlinable internal mutating func _withMutableLanes<Result>(_ body:(_MutableLanes) -> Result) -> Result {
+		return self.x.withUnsafeMutableBufferPointer{ xBuffer in
+			self.y.withUnsafeMutableBufferPointer{ yBuffer in
+				self.z.withUnsafeMutableBufferPointer{ zBuffer in
+					self.w.withUnsafeMutableBufferPointer{ wBuffer in
+						body(( x: xBuffer.baseAddress!, y: yBuffer.baseAddress!, z: zBuffer.baseAddress!, w: wBuffer.baseAddress! ))
+					}
+				}
+			}
+		}
+	}
+}
+
+
+extension Array where Element == Float4
+{
+	/// Transposes a `Float4SoA` back into an array of `Float4`s.
+	@inlinable public init(_ soa:Float4SoA) {
+		self.init(unsafeUninitializedCapacity: soa.count){ buffer, initializedCount in
+			if soa.count > 0 {
+				soa._withLanes{ lanes in
+					Float4ArrayFromSoA(lanes.x, lanes.y, lanes.z, lanes.w, buffer.baseAddress!, soa.count)
+				}
+			}
+			initializedCount = soa.count
+		}
+	}
+}
+
+
+extension Float4SoA : RandomAccessCollection, MutableCollection
+{
+	public typealias Index = Int
+	
+	@inlinable public var startIndex:Int { return 0 }
+	@inlinable public var endIndex:Int { return self.x.count }
+	
+	@inlinable public subscript(index:Int) -> Float4 {
+		get {
+			return Float4(x: self.x[index], y: self.y[index], z: self.z[index], w: self.w[index])
+		}
+		set {
+			self.x[index] = newValue.x
+			self.y[index] = newValue.y
+			self.z[index] = newValue.z
+			self.w[index] = newValue.w
+		}
+	}
+	
+	@inlinable public mutating func append(_ element:Float4) {
+		self.x.append(element.x)
+		self.y.append(element.y)
+		self.z.append(element.z)
+		self.w.append(element.w)
+	}
+	@inlinable public mutating func reserveCapacity(_ minimumCapacity:Int) {
+		self.x.reserveCapacity(minimumCapacity)
+		self.y.reserveCapacity(minimumCapacity)
+		self.z.reserveCapacity(minimumCapacity)
+		self.w.reserveCapacity(minimumCapacity)
+	}
+}
+
+
+extension Float4SoA : Equatable
+{
+	@inlinable public static func ==(a:Float4SoA, b:Float4SoA) -> Bool {
+		return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w
+	}
+}
+
+
+extension Float4SoA // Geometric Math Operations
+{
+	/// Also known as the Interior Product.  Returns each element's dot product with the same-index element of `other`.
+	@inlinable public func dotProduct(_ other:Float4SoA) -> [Float] {
+		return self._reductionOperation(other, Float4SoADotProduct)
+	}
+	
+	
+	@inlinable public func lengths() -> [Float] {
+		return self._reductionOperation(Float4SoALength)
+	}
+	@inlinable public func lengthsSquared() -> [Float] {
+		return self._reductionOperation(Float4SoALengthSquared)
+	}
+	
+	
+	/// Produces unit-length vectors.  (Not to be confused with “normals”/“normal vectors”.)
+	@inlinable public func normalized() -> Float4SoA {
+		return self._unaryOperation(Float4SoANormalize)
+	}
+	/// Modifies each vector to be unit-length.  (Not to be confused with “normals”/“normal vectors”.)
+	@inlinable public mutating func normalize() {
+		self._formUnaryOperation(Float4SoANormalize)
+	}
+	
+	
+	/// Linearly interpolates each element toward the same-index element of `other`.
+	@inlinable public func mixed(with other:Float4SoA, ratio:Float) -> Float4SoA {
+		return self._binaryOperation(other){ aX, aY, aZ, aW, bX, bY, bZ, bW, outX, outY, outZ, outW, n in
+			Float4SoAMix(aX, aY, aZ, aW, bX, bY, bZ, bW, ratio, outX, outY, outZ, outW, n)
+		}
+	}
+	/// Linearly interpolates each element toward the same-index element of `other`.
+	@inlinable public mutating func mix(with other:Float4SoA, ratio:Float) {
+		self._formBinaryOperation(other){ aX, aY, aZ, aW, bX, bY, bZ, bW, outX, outY, outZ, outW, n in
+			Float4SoAMix(aX, aY, aZ, aW, bX, bY, bZ, bW, ratio, outX, outY, outZ, outW, n)
+		}
+	}
+	
+	
+	@inlinable public func clamped(to range:ClosedRange<Float4>) -> Float4SoA {
+		return self._unaryOperation{ vX, vY, vZ, vW, outX, outY, outZ, outW, n in
+			Float4SoAClamp(vX, vY, vZ, vW, range.lowerBound, range.upperBound, outX, outY, outZ, outW, n)
+		}
+	}
+	@inlinable public mutating func clamp(to range:ClosedRange<Float4>) {
+		self._formUnaryOperation{ vX, vY, vZ, vW, outX, outY, outZ, outW, n in
+			Float4SoAClamp(vX, vY, vZ, vW, range.lowerBound, range.upperBound, outX, outY, outZ, outW, n)
+		}
+	}
+}
+
+
+// MARK: Element-wise `min`/`max`
+
+@inlinable public func min(_ a:Float4SoA, _ b:Float4SoA) -> Float4SoA {
+	return a._binaryOperation(b, Float4SoAMin)
+}
+
+@inlinable public func max(_ a:Float4SoA, _ b:Float4SoA) -> Float4SoA {
+	return a._binaryOperation(b, Float4SoAMax)
+}
+
+
+extension Float4SoA // Kernel Plumbing
+{
+	@inlinable internal func _binaryOperation(_ other:Float4SoA, _ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) -> Float4SoA {
+		precondition(other.count == self.count, "Float4SoA operands must have the same count.")
+		return Float4SoA(_unsafeUninitializedCount: self.count){ out in
+			self._withLanes{ a in
+				other._withLanes{ b in
+					kernel(a.x, a.y, a.z, a.w, b.x, b.y, b.z, b.w, out.x, out.y, out.z, out.w, self.count)
+				}
+			}
+		}
+	}
+	@inlinable internal mutating func _formBinaryOperation(_ other:Float4SoA, _ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) {
+		precondition(other.count == self.count, "Float4SoA operands must have the same count.")
+		guard self.count > 0 else { return }
+		let count = self.count
+		other._withLanes{ b in
+			self._withMutableLanes{ a in
+				kernel(a.x, a.y, a.z, a.w, b.x, b.y, b.z, b.w, a.x, a.y, a.z, a.w, count)
+			}
+		}
+	}
+	
+	@inlinable internal func _unaryOperation(_ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) -> Float4SoA {
+		return Float4SoA(_unsafeUninitializedCount: self.count){ out in
+			self._withLanes{ v in
+				kernel(v.x, v.y, v.z, v.w, out.x, out.y, out.z, out.w, self.count)
+			}
+		}
+	}
+	@inlinable internal mutating func _formUnaryOperation(_ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) {
+		guard self.count > 0 else { return }
+		let count = self.count
+		self._withMutableLanes{ v in
+			kernel(v.x, v.y, v.z, v.w, v.x, v.y, v.z, v.w, count)
+		}
+	}
+	
+	@inlinable internal func _reductionOperation(_ other:Float4SoA, _ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) -> [Float] {
+		precondition(other.count == self.count, "Float4SoA operands must have the same count.")
+		return [Float](unsafeUninitializedCapacity: self.count){ buffer, initializedCount in
+			if self.count > 0 {
+				self._withLanes{ a in
+					other._withLanes{ b in
+						kernel(a.x, a.y, a.z, a.w, b.x, b.y, b.z, b.w, buffer.baseAddress!, self.count)
+					}
+				}
+			}
+			initializedCount = self.count
+		}
+	}
+	@inlinable internal func _reductionOperation(_ kernel:(UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafePointer<Float>, UnsafeMutablePointer<Float>, Int) -> Void) -> [Float] {
+		return [Float](unsafeUninitializedCapacity: self.count){ buffer, initializedCount in
+			if self.count > 0 {
+				self._withLanes{ v in
+					kernel(v.x, v.y, v.z, v.w, buffer.baseAddress!, self.count)
+				}
+			}
+			initializedCount = self.count
+		}
+	}
+}
@@ -0,0 +1,104 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: AoS/SoA Transposition
+
+@_alwaysEmitIntoClient public func Float4ArrayToSoA(_ aos:UnsafePointer<Float4>, _ x:UnsafeMutablePointer<Float>, _ y:UnsafeMutablePointer<Float>, _ z:UnsafeMutablePointer<Float>, _ w:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		x[i] = aos[i].x
+		y[i] = aos[i].y
+		z[i] = aos[i].z
+		w[i] = aos[i].w
+	}
+}
+@_alwaysEmitIntoClient public func Float4ArrayFromSoA(_ x:UnsafePointer<Float>, _ y:UnsafePointer<Float>, _ z:UnsafePointer<Float>, _ w:UnsafePointer<Float>, _ aos:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		aos[i] = Float4(x: x[i], y: y[i], z: z[i], w: w[i])
+	}
+}
+
+
+
+// MARK: SoA Math Operations
+
+@_alwaysEmitIntoClient public func Float4SoADotProduct(_ aX:UnsafePointer<Float>, _ aY:UnsafePointer<Float>, _ aZ:UnsafePointer<Float>, _ aW:UnsafePointer<Float>, _ bX:UnsafePointer<Float>, _ bY:UnsafePointer<Float>, _ bZ:UnsafePointer<Float>, _ bW:UnsafePointer<Float>, _ out:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let ax = aX[i], ay = aY[i], az = aZ[i], aw = aW[i]
+		let bx = bX[i], by = bY[i], bz = bZ[i], bw = bW[i]
+		out[i] = ax * bx + ay * by + az * bz + aw * bw
+	}
+}
+@_alwaysEmitIntoClient public func Float4SoALengthSquared(_ vX:UnsafePointer<Float>, _ vY:UnsafePointer<Float>, _ vZ:UnsafePointer<Float>, _ vW:UnsafePointer<Float>, _ out:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let vx = vX[i], vy = vY[i], vz = vZ[i], vw = vW[i]
+		out[i] = vx * vx + vy * vy + vz * vz + vw * vw
+	}
+}
+@_alwaysEmitIntoClient public func Float4SoALength(_ vX:UnsafePointer<Float>, _ vY:UnsafePointer<Float>, _ vZ:UnsafePointer<Float>, _ vW:UnsafePointer<Float>, _ out:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let vx = vX[i], vy = vY[i], vz = vZ[i], vw = vW[i]
+		out[i] = (vx * vx + vy * vy + vz * vz + vw * vw).squareRoot()
+	}
+}
+@_alwaysEmitIntoClient public func Float4SoANormalize(_ vX:UnsafePointer<Float>, _ vY:UnsafePointer<Float>, _ vZ:UnsafePointer<Float>, _ vW:UnsafePointer<Float>, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ outW:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let vx = vX[i], vy = vY[i], vz = vZ[i], vw = vW[i]
+		let inverseLength = 1 / (vx * vx + vy * vy + vz * vz + vw * vw).squareRoot()
+		outX[i] = vx * inverseLength
+		outY[i] = vy * inverseLength
+		outZ[i] = vz * inverseLength
+		outW[i] = vw * inverseLength
+	}
+}
+@_alwaysEmitIntoClient public func Float4SoAMix(_ aX:UnsafePointer<Float>, _ aY:UnsafePointer<Float>, _ aZ:UnsafePointer<Float>, _ aW:UnsafePointer<Float>, _ bX:UnsafePointer<Float>, _ bY:UnsafePointer<Float>, _ bZ:UnsafePointer<Float>, _ bW:UnsafePointer<Float>, _ ratio:Float, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ outW:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let ax = aX[i], ay = aY[i], az = aZ[i], aw = aW[i]
+		let bx = bX[i], by = bY[i], bz = bZ[i], bw = bW[i]
+		outX[i] = ax + (bx - ax) * ratio
+		outY[i] = ay + (by - ay) * ratio
+		outZ[i] = az + (bz - az) * ratio
+		outW[i] = aw + (bw - aw) * ratio
+	}
+}
+@_alwaysEmitIntoClient public func Float4SoAMin(_ aX:UnsafePointer<Float>, _ aY:UnsafePointer<Float>, _ aZ:UnsafePointer<Float>, _ aW:UnsafePointer<Float>, _ bX:UnsafePointer<Float>, _ bY:UnsafePointer<Float>, _ bZ:UnsafePointer<Float>, _ bW:UnsafePointer<Float>, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ outW:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let ax = aX[i], ay = aY[i], az = aZ[i], aw = aW[i]
+		let bx = bX[i], by = bY[i], bz = bZ[i], bw = bW[i]
+		outX[i] = bx < ax ? bx : ax
+		outY[i] = by < ay ? by : ay
+		outZ[i] = bz < az ? bz : az
+		outW[i] = bw < aw ? bw : aw
+	}
+}
+@_alwaysEmitIntoClient public func Float4SoAMax(_ aX:UnsafePointer<Float>, _ aY:UnsafePointer<Float>, _ aZ:UnsafePointer<Float>, _ aW:UnsafePointer<Float>, _ bX:UnsafePointer<Float>, _ bY:UnsafePointer<Float>, _ bZ:UnsafePointer<Float>, _ bW:UnsafePointer<Float>, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ outW:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let ax = aX[i], ay = aY[i], az = aZ[i], aw = aW[i]
+		let bx = bX[i], by = bY[i], bz = bZ[i], bw = bW[i]
+		outX[i] = bx > ax ? bx : ax
+		outY[i] = by > ay ? by : ay
+		outZ[i] = bz > az ? bz : az
+		outW[i] = bw > aw ? bw : aw
+	}
+}
+@_alwaysEmitIntoClient public func Float4SoAClamp(_ vX:UnsafePointer<Float>, _ vY:UnsafePointer<Float>, _ vZ:UnsafePointer<Float>, _ vW:UnsafePointer<Float>, _ lowerBound:Float4, _ upperBound:Float4, _ outX:UnsafeMutablePointer<Float>, _ outY:UnsafeMutablePointer<Float>, _ outZ:UnsafeMutablePointer<Float>, _ outW:UnsafeMutablePointer<Float>, _ n:Int) {
+	for i in 0..<n {
+		let vx = vX[i], vy = vY[i], vz = vZ[i], vw = vW[i]
+		let clampedX = vx < lowerBound.x ? lowerBound.x : vx
+		let clampedY = vy < lowerBound.y ? lowerBound.y : vy
+		let clampedZ = vz < lowerBound.z ? lowerBound.z : vz
+		let clampedW = vw < lowerBound.w ? lowerBound.w : vw
+		outX[i] = clampedX > upperBound.x ? upperBound.x : clampedX
+		outY[i] = clampedY > upperBound.y ? upperBound.y : clampedY
+		outZ[i] = clampedZ > upperBound.z ? upperBound.z : clampedZ
+		outW[i] = clampedW > upperBound.w ? upperBound.w : clampedW
+	}
+}
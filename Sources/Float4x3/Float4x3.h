@@ -0,0 +1,196 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+#if __has_include(<Vuckt/FloatQuaternion.h>)
+	#import <Vuckt/FloatQuaternion.h>
+#else
+	#include "../FloatQuaternion/FloatQuaternion.h"
+#endif
+#if __has_include(<Vuckt/Float4x4.h>)
+	#import <Vuckt/Float4x4.h>
+#else
+	#include "../Float4x4/Float4x4.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#if __OBJC__
+	#import <Foundation/NSValue.h>
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// An affine transform: 4 columns × 3 rows, the upper 3 rows of a `Float4x4` whose bottom row is the implied [ 0, 0, 0, 1 ].
+/// Columns 0–2 are the linear (rotation/scale/shear) part & column 3 is the translation.  Composing two costs 36 multiply-adds (vs. a `Float4x4`'s 64), & inverting needs only a 3×3 inverse.
+/// Members are named `m<column><row>`, as `Float4x4`'s are, but stored row by row: 3 unpadded `simd_float4` rows, 48 bytes (vs. 64 for 4 padded `simd_float3` columns).  So initializer lists run along each row (`m00, m10, m20, m30, m01, …`).
+struct Float4x3 {
+	float m00 __attribute__((aligned(__alignof__(simd_float4))));
+	float m10;
+	float m20;
+	float m30;
+	float m01 __attribute__((aligned(__alignof__(simd_float4))));
+	float m11;
+	float m21;
+	float m31;
+	float m02 __attribute__((aligned(__alignof__(simd_float4))));
+	float m12;
+	float m22;
+	float m32;
+} __attribute__((aligned(__alignof__(simd_float4)))) VUCKT_SIMD_MAY_ALIAS;
+typedef struct Float4x3 Float4x3;
+
+
+
+#pragma mark SIMD Row Access
+
+/// Writes the 3 rows of `m` to `outRows` as `simd_float4`s, each [ m0r, m1r, m2r, m3r ].
+NS_INLINE void Float4x3ToSimdRows(Float4x3 m, simd_float4 *outRows) {
+	memcpy(outRows, &m, sizeof(Float4x3));
+}
+/// A `Float4x3` from the 3 rows at `rows`, each [ m0r, m1r, m2r, m3r ].
+NS_INLINE Float4x3 Float4x3FromSimdRows(const simd_float4 *rows) {
+	Float4x3 m;
+	memcpy(&m, rows, sizeof(Float4x3));
+	return m;
+}
+
+
+
+#pragma mark Float4x4 Conversion
+
+/// Converts a `Float4x3` to a `Float4x4`, filling in the bottom row as [ 0, 0, 0, 1 ].
+NS_INLINE Float4x4 Float4x3ToFloat4x4(Float4x3 affineValue) {
+	return (Float4x4){
+		affineValue.m00, affineValue.m01, affineValue.m02, 0.0f,
+		affineValue.m10, affineValue.m11, affineValue.m12, 0.0f,
+		affineValue.m20, affineValue.m21, affineValue.m22, 0.0f,
+		affineValue.m30, affineValue.m31, affineValue.m32, 1.0f,
+	};
+}
+/// Converts a `Float4x4` to a `Float4x3` by dropping its bottom row.  (Lossless for affine matrices, whose bottom row is [ 0, 0, 0, 1 ].)
+NS_INLINE Float4x3 Float4x3FromFloat4x4(Float4x4 matrixValue) {
+	return (Float4x3){
+		matrixValue.m00, matrixValue.m10, matrixValue.m20, matrixValue.m30,
+		matrixValue.m01, matrixValue.m11, matrixValue.m21, matrixValue.m31,
+		matrixValue.m02, matrixValue.m12, matrixValue.m22, matrixValue.m32,
+	};
+}
+
+
+
+#pragma mark Construction
+
+/// Builds `translation * rotation * scale` (scaling first, then rotating, then translating) directly from the quaternion's components, with no intermediate matrix products.
+/// `rotation` must be unit-length.
+NS_INLINE Float4x3 Float4x3FromScaleRotationTranslation(Float3 scale, FloatQuaternion rotation, Float3 translation) {
+	float x = rotation.ix, y = rotation.iy, z = rotation.iz, w = rotation.r;
+	float xx = x * x, yy = y * y, zz = z * z;
+	float xy = x * y, xz = x * z, yz = y * z;
+	float wx = w * x, wy = w * y, wz = w * z;
+	return (Float4x3){
+		(1.0f - 2.0f * (yy + zz)) * scale.x, 2.0f * (xy - wz) * scale.y, 2.0f * (xz + wy) * scale.z, translation.x,
+		2.0f * (xy + wz) * scale.x, (1.0f - 2.0f * (xx + zz)) * scale.y, 2.0f * (yz - wx) * scale.z, translation.y,
+		2.0f * (xz - wy) * scale.x, 2.0f * (yz + wx) * scale.y, (1.0f - 2.0f * (xx + yy)) * scale.z, translation.z,
+	};
+}
+
+
+
+#pragma mark Affine Math
+
+/// `a * b` (applying `b`, then `a`): each of the result's rows is `b`'s 3 rows scaled by the matching row of `a`'s 3×3 part, plus `a`'s translation, summed in pairs (2 adds deep instead of 3).
+NS_INLINE Float4x3 Float4x3Concatenate(Float4x3 a, Float4x3 b) {
+	simd_float4 bRows[3];
+	Float4x3ToSimdRows(b, bRows);
+	simd_float4 rows[3] = {
+		(bRows[0] * a.m00 + bRows[1] * a.m10) + (bRows[2] * a.m20 + (simd_float4){ 0, 0, 0, a.m30 }),
+		(bRows[0] * a.m01 + bRows[1] * a.m11) + (bRows[2] * a.m21 + (simd_float4){ 0, 0, 0, a.m31 }),
+		(bRows[0] * a.m02 + bRows[1] * a.m12) + (bRows[2] * a.m22 + (simd_float4){ 0, 0, 0, a.m32 }),
+	};
+	return Float4x3FromSimdRows(rows);
+}
+
+/// Returns the inverse of any invertible affine transform: the 3×3 part inverted via its cofactors (cross products of the columns), & the translation mapped back through that.
+/// (Singular transforms produce infinities/NaNs, as `simd_inverse()` does.)
+NS_INLINE Float4x3 Float4x3Inverse(Float4x3 m) {
+	simd_float3 c0 = { m.m00, m.m01, m.m02 }, c1 = { m.m10, m.m11, m.m12 }, c2 = { m.m20, m.m21, m.m22 };
+	simd_float3 n0 = simd_cross(c1, c2), n1 = simd_cross(c2, c0), n2 = simd_cross(c0, c1);
+	float inverseDeterminant = 1.0f / (c0[0] * n0[0] + c0[1] * n0[1] + c0[2] * n0[2]);
+	n0 = n0 * inverseDeterminant;
+	n1 = n1 * inverseDeterminant;
+	n2 = n2 * inverseDeterminant;
+	// `n0`–`n2` are the inverse's rows.
+	return (Float4x3){
+		n0[0], n0[1], n0[2], -(n0[0] * m.m30 + n0[1] * m.m31 + n0[2] * m.m32),
+		n1[0], n1[1], n1[2], -(n1[0] * m.m30 + n1[1] * m.m31 + n1[2] * m.m32),
+		n2[0], n2[1], n2[2], -(n2[0] * m.m30 + n2[1] * m.m31 + n2[2] * m.m32),
+	};
+}
+
+/// Returns the inverse of an affine transform whose 3×3 part has mutually-orthogonal columns— rotation & (possibly non-uniform) scale, with no shear, as `Float4x3FromScaleRotationTranslation()` builds.
+/// The 3×3 part is inverted by transposing it (dividing each row by its squared length, to undo the scale), & the translation is mapped back through that; there's no determinant or cofactors to compute.
+NS_INLINE Float4x3 Float4x3OrthogonalInverse(Float4x3 m) {
+	simd_float3 c0 = { m.m00, m.m01, m.m02 }, c1 = { m.m10, m.m11, m.m12 }, c2 = { m.m20, m.m21, m.m22 };
+	c0 = c0 * (1.0f / (m.m00 * m.m00 + m.m01 * m.m01 + m.m02 * m.m02));
+	c1 = c1 * (1.0f / (m.m10 * m.m10 + m.m11 * m.m11 + m.m12 * m.m12));
+	c2 = c2 * (1.0f / (m.m20 * m.m20 + m.m21 * m.m21 + m.m22 * m.m22));
+	// `c0`–`c2` (scaled) are the inverse's rows.
+	return (Float4x3){
+		c0[0], c0[1], c0[2], -(c0[0] * m.m30 + c0[1] * m.m31 + c0[2] * m.m32),
+		c1[0], c1[1], c1[2], -(c1[0] * m.m30 + c1[1] * m.m31 + c1[2] * m.m32),
+		c2[0], c2[1], c2[2], -(c2[0] * m.m30 + c2[1] * m.m31 + c2[2] * m.m32),
+	};
+}
+
+/// `(m * Float4(point, 1)).xyz`
+NS_INLINE Float3 Float4x3TransformPoint(Float4x3 m, Float3 point) {
+	return (Float3){
+		m.m00 * point.x + m.m10 * point.y + m.m20 * point.z + m.m30,
+		m.m01 * point.x + m.m11 * point.y + m.m21 * point.z + m.m31,
+		m.m02 * point.x + m.m12 * point.y + m.m22 * point.z + m.m32,
+	};
+}
+/// `(m * Float4(vector, 0)).xyz`  (Ignores the translation.)
+NS_INLINE Float3 Float4x3TransformVector(Float4x3 m, Float3 vector) {
+	return (Float3){
+		m.m00 * vector.x + m.m10 * vector.y + m.m20 * vector.z,
+		m.m01 * vector.x + m.m11 * vector.y + m.m21 * vector.z,
+		m.m02 * vector.x + m.m12 * vector.y + m.m22 * vector.z,
+	};
+}
+
+
+
+#if __OBJC__
+#pragma mark `NSValue`-Wrapping
+
+@interface NSValue (Float4x3Additions)
+
++ (NSValue *)valueWithFloat4x3:(Float4x3)float4x3Value;
+
+@property(nonatomic, readonly) Float4x3 float4x3Value;
+
+@end
+#endif // __OBJC__
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
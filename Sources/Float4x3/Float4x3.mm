@@ -0,0 +1,44 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Float4x3.h"
+
+
+
+#pragma mark Struct Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Float4x3, m00) == sizeof(simd_float1),
+	"Float4x3's first member's size does not match simd_float1's on this platform.");
+static_assert((offsetof(Float4x3, m01) - offsetof(Float4x3, m00)) == sizeof(simd_float4),
+	"Float4x3's 1st row's size does not match simd_float4's on this platform.");
+static_assert((offsetof(Float4x3, m02) - offsetof(Float4x3, m01)) == sizeof(simd_float4),
+	"Float4x3's 2nd row's size does not match simd_float4's on this platform.");
+static_assert((sizeof(Float4x3) - offsetof(Float4x3, m02)) == sizeof(simd_float4),
+	"Float4x3's 3rd row's size does not match simd_float4's on this platform.");
+static_assert(sizeof(Float4x3) == 3 * sizeof(simd_float4),
+	"Float4x3's size is not 3 simd_float4 rows' on this platform.");
+static_assert(alignof(Float4x3) == alignof(simd_float4),
+	"Float4x3's alignment requirements does not match simd_float4's on this platform.");
+
+
+
+#pragma mark `NSValue`-Wrapping
+
+@implementation NSValue (Float4x3Additions)
+
+
++ (NSValue *)valueWithFloat4x3:(Float4x3)float4x3Value
+{
+	return [self valueWithBytes:&float4x3Value objCType:@encode(Float4x3)];
+}
+
+- (Float4x3)float4x3Value
+{
+	Float4x3 float4x3Value;
+	[self getValue:&float4x3Value];
+	return float4x3Value;
+}
+
+
+@end
@@ -0,0 +1,186 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension Float4x3
+{
+	// MARK: `init`s
+	
+	/// Initialize a matrix with the specified elements, in column-major order.
+	@_transparent public init(
+		_ m00:Float, _ m01:Float, _ m02:Float,
+		_ m10:Float, _ m11:Float, _ m12:Float,
+		_ m20:Float, _ m21:Float, _ m22:Float,
+		_ m30:Float, _ m31:Float, _ m32:Float
+	) {
+		self.init(
+			m00: m00, m10: m10, m20: m20, m30: m30,
+			m01: m01, m11: m11, m21: m21, m31: m31,
+			m02: m02, m12: m12, m22: m22, m32: m32
+		)
+	}
+	
+	@_transparent public init(columns c0:Float3, _ c1:Float3, _ c2:Float3, _ c3:Float3) {
+		self.init(c0.x, c0.y, c0.z, c1.x, c1.y, c1.z, c2.x, c2.y, c2.z, c3.x, c3.y, c3.z)
+	}
+	
+	/// Drops `float4x4`'s bottom row, which is lossless for affine matrices (whose bottom row is [ 0, 0, 0, 1 ]).
+	@_transparent public init(_ float4x4:Float4x4) {
+		self = Float4x3FromFloat4x4(float4x4)
+	}
+	
+	@_transparent public init(_ float3x3:Float3x3, translation:Float3 = Float3()) {
+		self.init(columns: Float3(float3x3.m00, float3x3.m01, float3x3.m02), Float3(float3x3.m10, float3x3.m11, float3x3.m12), Float3(float3x3.m20, float3x3.m21, float3x3.m22), translation)
+	}
+	
+	/// Scales, then rotates, then translates (`translation * rotation * scale`), built directly from the quaternion's components with no intermediate matrix products.
+	@_transparent public init(scale:Float3 = Float3(1, 1, 1), rotation quaternion:FloatQuaternion, translation:Float3 = Float3()) {
+		self = Float4x3FromScaleRotationTranslation(scale, quaternion, translation)
+	}
+	
+	public init(translation:Float3) {
+		self.init(columns: Self.identity.c0, Self.identity.c1, Self.identity.c2, translation)
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Float4x3 { return Float4x3() }
+	@_transparent public static var identity:Float4x3 { return Float4x3(1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	@_transparent public var asArray:[Float] {
+		return [ self.m00, self.m01, self.m02, self.m10, self.m11, self.m12, self.m20, self.m21, self.m22, self.m30, self.m31, self.m32 ]
+	}
+	
+	/// The equivalent `Float4x4`, with a bottom row of [ 0, 0, 0, 1 ].
+	@_transparent public var float4x4Value:Float4x4 {
+		return Float4x3ToFloat4x4(self)
+	}
+	
+	
+	// MARK: Column (`Float3`) Accessors
+	
+	@_transparent public var c0:Float3 {
+		get { return Float3(m00, m01, m02) }
+		set { ( self.m00, self.m01, self.m02 ) = ( newValue.x, newValue.y, newValue.z ) }
+	}
+	@_transparent public var c1:Float3 {
+		get { return Float3(m10, m11, m12) }
+		set { ( self.m10, self.m11, self.m12 ) = ( newValue.x, newValue.y, newValue.z ) }
+	}
+	@_transparent public var c2:Float3 {
+		get { return Float3(m20, m21, m22) }
+		set { ( self.m20, self.m21, self.m22 ) = ( newValue.x, newValue.y, newValue.z ) }
+	}
+	@_transparent public var c3:Float3 {
+		get { return Float3(m30, m31, m32) }
+		set { ( self.m30, self.m31, self.m32 ) = ( newValue.x, newValue.y, newValue.z ) }
+	}
+	
+	/// The translation column (`c3`).
+	@_transparent public var translation:Float3 {
+		get { return self.c3 }
+		set { self.c3 = newValue }
+	}
+}
+
+
+extension Float4x4
+{
+	/// Expands `affine` to a full `Float4x4`, with a bottom row of [ 0, 0, 0, 1 ].
+	@_transparent public init(_ affine:Float4x3) {
+		self = Float4x3ToFloat4x4(affine)
+	}
+}
+
+
+extension Float4x3 : CustomStringConvertible
+{
+	public var description:String {
+		var strings:[[String]] = [ self.c0, self.c1, self.c2, self.c3 ].map{ c in
+			c.asArray.map(String.init(describing:))
+		}
+		let columnMaxLengths:[Int] = strings.map{ c in
+			c.map{ $0.count }.max()!
+		}
+		strings = zip(strings, columnMaxLengths).map{ c, maxLength in
+			c.map{ $0.padding(toLength: maxLength, withPad:" ", startingAt: 0) }
+		}
+		return
+			"⎡\(strings[0][0])  \(strings[1][0])  \(strings[2][0])  \(strings[3][0])⎤\n" +
+			"⎢\(strings[0][1])  \(strings[1][1])  \(strings[2][1])  \(strings[3][1])⎥\n" +
+			"⎣\(strings[0][2])  \(strings[1][2])  \(strings[2][2])  \(strings[3][2])⎦\n"
+	}
+}
+
+
+extension Float4x3 : Equatable
+{
+	@_transparent public static func ==(a:Float4x3, b:Float4x3) -> Bool {
+		return a.c0 == b.c0 && a.c1 == b.c1 && a.c2 == b.c2 && a.c3 == b.c3
+	}
+}
+
+
+extension Float4x3 // Affine Math Operations
+{
+	/// Composes `a` & `b` (applying `b`, then `a`), in 36 multiply-adds.
+	@_transparent public static func * (a:Float4x3, b:Float4x3) -> Float4x3 { return a.concatenating(b) }
+	@_transparent public func concatenating(_ other:Float4x3) -> Float4x3 {
+		return Float4x3Concatenate(self, other)
+	}
+	@_transparent public static func *= (m:inout Float4x3, o:Float4x3) { m.concatenate(o) }
+	@_transparent public mutating func concatenate(_ other:Float4x3) {
+		self = self.concatenating(other)
+	}
+	
+	
+	/// Transforms `point` (as `w = 1`, so including the translation).
+	@_transparent public func transformPoint(_ point:Float3) -> Float3 {
+		return Float4x3TransformPoint(self, point)
+	}
+	/// Transforms direction `vector` (as `w = 0`, so ignoring the translation).
+	@_transparent public func transformVector(_ vector:Float3) -> Float3 {
+		return Float4x3TransformVector(self, vector)
+	}
+	
+	
+	/// The inverse of any invertible affine transform.
+	@_transparent public func inversed() -> Float4x3 {
+		return Float4x3Inverse(self)
+	}
+	@_transparent public mutating func inverse() {
+		self = self.inversed()
+	}
+	
+	/// A cheaper inverse for transforms with no shear (rotation & scale only, e.g. built via `init(scale:rotation:translation:)`): the transposed rotation & reciprocal scale, plus the un-translate.
+	@_transparent public func orthogonalInversed() -> Float4x3 {
+		return Float4x3OrthogonalInverse(self)
+	}
+	@_transparent public mutating func orthogonalInverse() {
+		self = self.orthogonalInversed()
+	}
+}
+
+
+extension Float4x3 : Hashable
+{
+	public func hash(into hasher:inout Hasher) {
+		self.asArray.forEach{ hasher.combine($0) }
+	}
+}
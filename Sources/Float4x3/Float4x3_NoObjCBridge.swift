@@ -0,0 +1,150 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Float4x3
+{
+	public var m00: Float
+	public var m10: Float
+	public var m20: Float
+	public var m30: Float
+	public var m01: Float
+	public var m11: Float
+	public var m21: Float
+	public var m31: Float
+	public var m02: Float
+	public var m12: Float
+	public var m22: Float
+	public var m32: Float
+	
+	public init() {
+		self.m00 = Float()
+		self.m10 = Float()
+		self.m20 = Float()
+		self.m30 = Float()
+		self.m01 = Float()
+		self.m11 = Float()
+		self.m21 = Float()
+		self.m31 = Float()
+		self.m02 = Float()
+		self.m12 = Float()
+		self.m22 = Float()
+		self.m32 = Float()
+	}
+	
+	public init(m00:Float, m10:Float, m20:Float, m30:Float, m01:Float, m11:Float, m21:Float, m31:Float, m02:Float, m12:Float, m22:Float, m32:Float) {
+		self.m00 = m00
+		self.m10 = m10
+		self.m20 = m20
+		self.m30 = m30
+		self.m01 = m01
+		self.m11 = m11
+		self.m21 = m21
+		self.m31 = m31
+		self.m02 = m02
+		self.m12 = m12
+		self.m22 = m22
+		self.m32 = m32
+	}
+}
+
+
+
+// MARK: Float4x4 Conversion
+
+@_transparent public func Float4x3ToFloat4x4(_ affineValue:Float4x3) -> Float4x4 {
+	return Float4x4(
+		m00: affineValue.m00, m01: affineValue.m01, m02: affineValue.m02, m03: 0,
+		m10: affineValue.m10, m11: affineValue.m11, m12: affineValue.m12, m13: 0,
+		m20: affineValue.m20, m21: affineValue.m21, m22: affineValue.m22, m23: 0,
+		m30: affineValue.m30, m31: affineValue.m31, m32: affineValue.m32, m33: 1
+	)
+}
+@_transparent public func Float4x3FromFloat4x4(_ matrixValue:Float4x4) -> Float4x3 {
+	return Float4x3(
+		m00: matrixValue.m00, m10: matrixValue.m10, m20: matrixValue.m20, m30: matrixValue.m30,
+		m01: matrixValue.m01, m11: matrixValue.m11, m21: matrixValue.m21, m31: matrixValue.m31,
+		m02: matrixValue.m02, m12: matrixValue.m12, m22: matrixValue.m22, m32: matrixValue.m32
+	)
+}
+
+
+
+// MARK: Construction
+
+@_alwaysEmitIntoClient public func Float4x3FromScaleRotationTranslation(_ scale:Float3, _ rotation:FloatQuaternion, _ translation:Float3) -> Float4x3 {
+	let rotation_simd = simd_matrix3x3(FloatQuaternionToSimd(rotation))
+	let c0 = rotation_simd[0] * scale.x, c1 = rotation_simd[1] * scale.y, c2 = rotation_simd[2] * scale.z
+	return Float4x3(
+		m00: c0.x, m10: c1.x, m20: c2.x, m30: translation.x,
+		m01: c0.y, m11: c1.y, m21: c2.y, m31: translation.y,
+		m02: c0.z, m12: c1.z, m22: c2.z, m32: translation.z
+	)
+}
+
+
+
+// MARK: Affine Math
+
+@_alwaysEmitIntoClient public func Float4x3Concatenate(_ a:Float4x3, _ b:Float4x3) -> Float4x3 {
+	let a0 = simd_float3(a.m00, a.m01, a.m02), a1 = simd_float3(a.m10, a.m11, a.m12), a2 = simd_float3(a.m20, a.m21, a.m22), a3 = simd_float3(a.m30, a.m31, a.m32)
+	let r0 = a0 * b.m00 + a1 * b.m01 + a2 * b.m02
+	let r1 = a0 * b.m10 + a1 * b.m11 + a2 * b.m12
+	let r2 = a0 * b.m20 + a1 * b.m21 + a2 * b.m22
+	let r3 = a0 * b.m30 + a1 * b.m31 + a2 * b.m32 + a3
+	return Float4x3(
+		m00: r0.x, m10: r1.x, m20: r2.x, m30: r3.x,
+		m01: r0.y, m11: r1.y, m21: r2.y, m31: r3.y,
+		m02: r0.z, m12: r1.z, m22: r2.z, m32: r3.z
+	)
+}
+
+@_alwaysEmitIntoClient public func Float4x3Inverse(_ m:Float4x3) -> Float4x3 {
+	let linearInverse = simd_inverse(simd_float3x3(
+		simd_float3(m.m00, m.m01, m.m02), simd_float3(m.m10, m.m11, m.m12), simd_float3(m.m20, m.m21, m.m22)
+	))
+	let translation = -simd_mul(linearInverse, simd_float3(m.m30, m.m31, m.m32))
+	return Float4x3(
+		m00: linearInverse[0, 0], m10: linearInverse[1, 0], m20: linearInverse[2, 0], m30: translation.x,
+		m01: linearInverse[0, 1], m11: linearInverse[1, 1], m21: linearInverse[2, 1], m31: translation.y,
+		m02: linearInverse[0, 2], m12: linearInverse[1, 2], m22: linearInverse[2, 2], m32: translation.z
+	)
+}
+
+@_alwaysEmitIntoClient public func Float4x3OrthogonalInverse(_ m:Float4x3) -> Float4x3 {
+	let c0 = simd_float3(m.m00, m.m01, m.m02), c1 = simd_float3(m.m10, m.m11, m.m12), c2 = simd_float3(m.m20, m.m21, m.m22)
+	let linearInverse = simd_transpose(simd_float3x3(
+		c0 / simd_length_squared(c0), c1 / simd_length_squared(c1), c2 / simd_length_squared(c2)
+	))
+	let translation = -simd_mul(linearInverse, simd_float3(m.m30, m.m31, m.m32))
+	return Float4x3(
+		m00: linearInverse[0, 0], m10: linearInverse[1, 0], m20: linearInverse[2, 0], m30: translation.x,
+		m01: linearInverse[0, 1], m11: linearInverse[1, 1], m21: linearInverse[2, 1], m31: translation.y,
+		m02: linearInverse[0, 2], m12: linearInverse[1, 2], m22: linearInverse[2, 2], m32: translation.z
+	)
+}
+
+@_transparent public func Float4x3TransformPoint(_ m:Float4x3, _ point:Float3) -> Float3 {
+	return Float3(
+		x: m.m00 * point.x + m.m10 * point.y + m.m20 * point.z + m.m30,
+		y: m.m01 * point.x + m.m11 * point.y + m.m21 * point.z + m.m31,
+		z: m.m02 * point.x + m.m12 * point.y + m.m22 * point.z + m.m32
+	)
+}
+@_transparent public func Float4x3TransformVector(_ m:Float4x3, _ vector:Float3) -> Float3 {
+	return Float3(
+		x: m.m00 * vector.x + m.m10 * vector.y + m.m20 * vector.z,
+		y: m.m01 * vector.x + m.m11 * vector.y + m.m21 * vector.z,
+		z: m.m02 * vector.x + m.m12 * vector.y + m.m22 * vector.z
+	)
+}
@@ -3,18 +3,38 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 #pragma once
 
-#import <Vuckt/Float4.h>
+#if __has_include(<Vuckt/Float4.h>)
+	#import <Vuckt/Float4.h>
+#else
+	#include "../Float4/Float4.h"
+#endif
+#if __has_include(<Vuckt/Float3x3.h>)
+	#import <Vuckt/Float3x3.h>
+#else
+	#include "../Float3x3/Float3x3.h"
+#endif
+#if __has_include(<Vuckt/PackedFloat3.h>)
+	#import <Vuckt/PackedFloat3.h>
+#else
+	#include "../PackedFloat3/PackedFloat3.h"
+#endif
 
-#import <Foundation/NSValue.h>
-#import <tgmath.h>
-#import <simd/simd.h>
-#if TARGET_OS_MAC
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#if __OBJC__
+	#import <Foundation/NSValue.h>
+#endif
+#include <tgmath.h>
+#if __OBJC__ && TARGET_OS_MAC
 	#import <SceneKit/SceneKitTypes.h>
 #endif
-#if TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 	#import <GLKit/GLKMatrix4.h>
 #endif
-#if TARGET_OS_MAC && !TARGET_OS_WATCH
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 	#import <QuartzCore/CATransform3D.h>
 #endif
 //#if TARGET_OS_MAC
@@ -29,6 +49,7 @@
 
 
 NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
 
 
 
@@ -51,7 +72,7 @@ struct Float4x4 {
 	float m31;
 	float m32;
 	float m33;
-} __attribute__((aligned(__alignof__(simd_float4x4))));
+} __attribute__((aligned(__alignof__(simd_float4x4)))) VUCKT_SIMD_MAY_ALIAS;
 typedef struct Float4x4 Float4x4;
 
 
@@ -75,15 +96,204 @@ NS_INLINE Float4x4 Float4x4FromSimd(simd_float4x4 simdValue) {
 
 NS_INLINE Float4x4 Float4x4OuterProduct(Float4 a, Float4 b) {
 	simd_float4 a_simd = Float4ToSimd(a);
-	simd_float4 b_simd = Float4ToSimd(b);
 	return Float4x4FromSimd(simd_matrix(
-		(a_simd * b_simd.x), (a_simd * b_simd.y), (a_simd * b_simd.z), (a_simd * b_simd.w)
+		(a_simd * b.x), (a_simd * b.y), (a_simd * b.z), (a_simd * b.w)
 	));
 }
 
+/// `a * b`, column-broadcast: each column of the result is `a`'s columns scaled by the components of `b`'s matching column & summed.
+NS_INLINE Float4x4 Float4x4Concatenate(Float4x4 a, Float4x4 b) {
+	simd_float4x4 a_simd = Float4x4ToSimd(a), b_simd = Float4x4ToSimd(b);
+	simd_float4 a0 = a_simd.columns[0], a1 = a_simd.columns[1], a2 = a_simd.columns[2], a3 = a_simd.columns[3];
+	simd_float4 b0 = b_simd.columns[0], b1 = b_simd.columns[1], b2 = b_simd.columns[2], b3 = b_simd.columns[3];
+	return Float4x4FromSimd(simd_matrix(
+		(a0 * b0[0] + a1 * b0[1] + a2 * b0[2] + a3 * b0[3]),
+		(a0 * b1[0] + a1 * b1[1] + a2 * b1[2] + a3 * b1[3]),
+		(a0 * b2[0] + a1 * b2[1] + a2 * b2[2] + a3 * b2[3]),
+		(a0 * b3[0] + a1 * b3[1] + a2 * b3[2] + a3 * b3[3])
+	));
+}
+
+/// Returns the inverse of `m`, via the adjugate built from 2×2 sub-determinants.  (Singular matrices produce infinities/NaNs, as `simd_inverse()` does.)
+NS_INLINE Float4x4 Float4x4Inverse(Float4x4 m) {
+	float s0 = m.m00 * m.m11 - m.m10 * m.m01;
+	float s1 = m.m00 * m.m12 - m.m10 * m.m02;
+	float s2 = m.m00 * m.m13 - m.m10 * m.m03;
+	float s3 = m.m01 * m.m12 - m.m11 * m.m02;
+	float s4 = m.m01 * m.m13 - m.m11 * m.m03;
+	float s5 = m.m02 * m.m13 - m.m12 * m.m03;
+	float c5 = m.m22 * m.m33 - m.m32 * m.m23;
+	float c4 = m.m21 * m.m33 - m.m31 * m.m23;
+	float c3 = m.m21 * m.m32 - m.m31 * m.m22;
+	float c2 = m.m20 * m.m33 - m.m30 * m.m23;
+	float c1 = m.m20 * m.m32 - m.m30 * m.m22;
+	float c0 = m.m20 * m.m31 - m.m30 * m.m21;
+	float inverseDeterminant = 1.0f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+	return (Float4x4){
+		( m.m11 * c5 - m.m12 * c4 + m.m13 * c3) * inverseDeterminant,
+		(-m.m01 * c5 + m.m02 * c4 - m.m03 * c3) * inverseDeterminant,
+		( m.m31 * s5 - m.m32 * s4 + m.m33 * s3) * inverseDeterminant,
+		(-m.m21 * s5 + m.m22 * s4 - m.m23 * s3) * inverseDeterminant,
+		(-m.m10 * c5 + m.m12 * c2 - m.m13 * c1) * inverseDeterminant,
+		( m.m00 * c5 - m.m02 * c2 + m.m03 * c1) * inverseDeterminant,
+		(-m.m30 * s5 + m.m32 * s2 - m.m33 * s1) * inverseDeterminant,
+		( m.m20 * s5 - m.m22 * s2 + m.m23 * s1) * inverseDeterminant,
+		( m.m10 * c4 - m.m11 * c2 + m.m13 * c0) * inverseDeterminant,
+		(-m.m00 * c4 + m.m01 * c2 - m.m03 * c0) * inverseDeterminant,
+		( m.m30 * s4 - m.m31 * s2 + m.m33 * s0) * inverseDeterminant,
+		(-m.m20 * s4 + m.m21 * s2 - m.m23 * s0) * inverseDeterminant,
+		(-m.m10 * c3 + m.m11 * c1 - m.m12 * c0) * inverseDeterminant,
+		( m.m00 * c3 - m.m01 * c1 + m.m02 * c0) * inverseDeterminant,
+		(-m.m30 * s3 + m.m31 * s1 - m.m32 * s0) * inverseDeterminant,
+		( m.m20 * s3 - m.m21 * s1 + m.m22 * s0) * inverseDeterminant,
+	};
+}
+
+
+
+#pragma mark Batch Transforms
+
+// Transforms of `n`-element arrays of 3D points/vectors/normals by a single matrix, for bulk passes (vertex buffers & the like) that would otherwise build a `Float4(xyz:w:)`, multiply, & divide per element.
+// The kernels are column-broadcast: the matrix's columns are loaded into vector registers once for the whole batch, then each point is `c0 * x + c1 * y + c2 * z + c3` (contracted to FMAs where the target has them).
+// `out` may be the same array as the input (for in-place operation), but must not otherwise overlap it.
+
+/// `out[i] = (m * Float4(points[i], 1)).xyz`, or with `perspectiveDivide`, that divided by its `w`.
+NS_INLINE void Float4x4TransformPoints(Float4x4 m, const Float3 *points, Float3 *out, size_t n, bool perspectiveDivide) {
+	simd_float4x4 m_simd = Float4x4ToSimd(m);
+	simd_float4 c0 = m_simd.columns[0], c1 = m_simd.columns[1], c2 = m_simd.columns[2], c3 = m_simd.columns[3];
+	for (size_t i = 0; i < n; ++i) {
+		Float3 p = points[i];
+		simd_float4 r = c0 * p.x + c1 * p.y + c2 * p.z + c3;
+		if (perspectiveDivide) {
+			r = r / r[3];
+		}
+		out[i] = (Float3){ r[0], r[1], r[2] };
+	}
+}
+/// `out[i] = (m * Float4(points[i], 1)).xyz`, or with `perspectiveDivide`, that divided by its `w`; reading & writing tightly-packed 12-byte points.
+NS_INLINE void Float4x4TransformPackedPoints(Float4x4 m, const PackedFloat3 *points, PackedFloat3 *out, size_t n, bool perspectiveDivide) {
+	simd_float4x4 m_simd = Float4x4ToSimd(m);
+	simd_float4 c0 = m_simd.columns[0], c1 = m_simd.columns[1], c2 = m_simd.columns[2], c3 = m_simd.columns[3];
+	for (size_t i = 0; i < n; ++i) {
+		PackedFloat3 p = points[i];
+		simd_float4 r = c0 * p.x + c1 * p.y + c2 * p.z + c3;
+		if (perspectiveDivide) {
+			r = r / r[3];
+		}
+		out[i] = (PackedFloat3){ r[0], r[1], r[2] };
+	}
+}
+
+/// Returns the upper-left 3×3 of `m`— its rotation/scale/shear part, which is all that applies to direction vectors & normals.
+NS_INLINE Float3x3 Float4x4UpperLeft3x3(Float4x4 m) {
+	return (Float3x3){
+		m.m00, m.m01, m.m02,
+		m.m10, m.m11, m.m12,
+		m.m20, m.m21, m.m22,
+	};
+}
+
+/// `out[i] = (m * Float4(vectors[i], 0)).xyz`  (Direction vectors ignore translation, and have no perspective `w` to divide by.)
+NS_INLINE void Float4x4TransformVectors(Float4x4 m, const Float3 *vectors, Float3 *out, size_t n) {
+	Float3x3TransformVectors(Float4x4UpperLeft3x3(m), vectors, out, n);
+}
+/// `out[i] = (m * Float4(vectors[i], 0)).xyz`, reading & writing tightly-packed 12-byte vectors.
+NS_INLINE void Float4x4TransformPackedVectors(Float4x4 m, const PackedFloat3 *vectors, PackedFloat3 *out, size_t n) {
+	Float3x3TransformPackedVectors(Float4x4UpperLeft3x3(m), vectors, out, n);
+}
+
+/// Transforms normals by the inverse-transpose of `m`'s upper-left 3×3, computed once for the whole batch.  (See `Float3x3TransformNormals()`.)
+NS_INLINE void Float4x4TransformNormals(Float4x4 m, const Float3 *normals, Float3 *out, size_t n, bool renormalize) {
+	Float3x3TransformNormals(Float4x4UpperLeft3x3(m), normals, out, n, renormalize);
+}
+/// Transforms tightly-packed 12-byte normals by the inverse-transpose of `m`'s upper-left 3×3, computed once for the whole batch.
+NS_INLINE void Float4x4TransformPackedNormals(Float4x4 m, const PackedFloat3 *normals, PackedFloat3 *out, size_t n, bool renormalize) {
+	Float3x3TransformPackedNormals(Float4x4UpperLeft3x3(m), normals, out, n, renormalize);
+}
+
+
+
+#pragma mark Hierarchy Propagation
+
+// World-matrix passes over a scene-graph hierarchy stored as flat, parent-indexed arrays.
+// `parentIndices[i]` is the index of node `i`'s parent, or negative for a root; nodes must be topologically sorted (every parent before its children, so `parentIndices[i] < i`).
+// That ordering lets a single linear sweep compute every `world[i] = world[parentIndices[i]] * local[i]`, reading each parent's already-finished world matrix from earlier in the same array.
+// `world` & `worldInverses` must not overlap `local` or each other.
+
+/// Computes all `n` world matrices from their `local` (parent-relative) matrices, also writing each one's inverse if `worldInverses` is given.
+NS_INLINE void Float4x4PropagateHierarchy(const Float4x4 *local, const int *parentIndices, Float4x4 *world, Float4x4 *VUCKT_NULLABLE worldInverses, size_t n) {
+	for (size_t i = 0; i < n; ++i) {
+		int parentIndex = parentIndices[i];
+		world[i] = (parentIndex < 0) ? local[i] : Float4x4Concatenate(world[parentIndex], local[i]);
+		if (worldInverses) {
+			worldInverses[i] = Float4x4Inverse(world[i]);
+		}
+	}
+}
+
+/// Like `Float4x4PropagateHierarchy()`, but only recomputes the subtrees under nodes whose `dirty` flag is set (those whose `local` matrix changed); other nodes' `world` (& `worldInverses`) entries are left as-is.
+/// `dirty` is updated in place: on return, the flag is set for every node that was recomputed (the dirty nodes & all their descendants).  Clear the flags before marking the next round of changes.
+NS_INLINE void Float4x4PropagateDirtyHierarchy(const Float4x4 *local, const int *parentIndices, bool *dirty, Float4x4 *world, Float4x4 *VUCKT_NULLABLE worldInverses, size_t n) {
+	for (size_t i = 0; i < n; ++i) {
+		int parentIndex = parentIndices[i];
+		if (parentIndex >= 0 && dirty[parentIndex]) {
+			dirty[i] = true;
+		}
+		if (!dirty[i]) {
+			continue;
+		}
+		world[i] = (parentIndex < 0) ? local[i] : Float4x4Concatenate(world[parentIndex], local[i]);
+		if (worldInverses) {
+			worldInverses[i] = Float4x4Inverse(world[i]);
+		}
+	}
+}
+
+
+
+#pragma mark Euler-Angle Conversion
+
+// The `Float3x3` conversions' closed form (see `Float3x3FromEulerAngles()`), widened to 4×4 with no matrix products.
+
+/// `rotation` in the upper-left 3×3, with no translation.
+NS_INLINE Float4x4 Float4x4FromRotation3x3(Float3x3 rotation) {
+	return (Float4x4){
+		rotation.m00, rotation.m01, rotation.m02, 0,
+		rotation.m10, rotation.m11, rotation.m12, 0,
+		rotation.m20, rotation.m21, rotation.m22, 0,
+		0, 0, 0, 1,
+	};
+}
+NS_INLINE Float4x4 Float4x4FromEulerAngles(Float3 eulerAngles, int firstAxis, int secondAxis, int thirdAxis) {
+	return Float4x4FromRotation3x3(Float3x3FromEulerAngles(eulerAngles, firstAxis, secondAxis, thirdAxis));
+}
+NS_INLINE Float4x4 Float4x4FromEulerAnglesFast(Float3 eulerAngles, int firstAxis, int secondAxis, int thirdAxis) {
+	return Float4x4FromRotation3x3(Float3x3FromEulerAnglesFast(eulerAngles, firstAxis, secondAxis, thirdAxis));
+}
+/// The Euler angles of the rotation in `m`'s upper-left 3×3.
+NS_INLINE Float3 Float4x4ToEulerAngles(Float4x4 m, int firstAxis, int secondAxis, int thirdAxis) {
+	return Float3x3ToEulerAngles(Float4x4UpperLeft3x3(m), firstAxis, secondAxis, thirdAxis);
+}
+
+/// `out[i] = Float4x4FromEulerAngles(eulerAngles[i], firstAxis, secondAxis, thirdAxis)`, taking the sines & cosines of 4 elements at a time with `Float3SinCosLanes()`.
+/// `out` must not overlap `eulerAngles`.
+NS_INLINE void Float4x4FromEulerAnglesArray(const Float3 *eulerAngles, Float4x4 *out, size_t n, int firstAxis, int secondAxis, int thirdAxis) {
+	VUCKT_FOR_EACH_BLOCK4(n, i, count, {
+		simd_float4 sinOfAngles[3], cosOfAngles[3];
+		Float3SinCosLanes(eulerAngles + i, count, 1.0f, sinOfAngles, cosOfAngles);
+		for (size_t laneI = 0; laneI < count; ++laneI) {
+			out[i + laneI] = Float4x4FromRotation3x3(Float3x3FromEulerSinCos(
+				(Float3){ sinOfAngles[0][laneI], sinOfAngles[1][laneI], sinOfAngles[2][laneI] },
+				(Float3){ cosOfAngles[0][laneI], cosOfAngles[1][laneI], cosOfAngles[2][laneI] },
+				firstAxis, secondAxis, thirdAxis
+			));
+		}
+	});
+}
+
 
 
-#if TARGET_OS_MAC
+#if __OBJC__ && TARGET_OS_MAC
 	#pragma mark SceneKit Conversion
 
 	/// Converts a `Float4x4` struct to `SCNMatrix4` struct using SceneKit-provided SIMD↔SCNMatrix conversion helper function.
@@ -98,7 +308,7 @@ NS_INLINE Float4x4 Float4x4OuterProduct(Float4 a, Float4 b) {
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 	#pragma mark GLKit Conversion
 
 	/// Converts a `Float4x4` struct to `GLKMatrix4` struct using passing-individual-members initialization.
@@ -119,7 +329,7 @@ NS_INLINE Float4x4 Float4x4OuterProduct(Float4 a, Float4 b) {
 			glkValue.m30, glkValue.m31, glkValue.m32, glkValue.m33,
 		};
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 
 
 
@@ -180,7 +390,7 @@ NS_INLINE Float4x4 Float4x4OuterProduct(Float4 a, Float4 b) {
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_WATCH
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 	#pragma mark CATransform3D Conversion
 
 	/// Converts a `Float4x4` struct to `CATransform3D` struct using passing-individual-members initialization.
@@ -201,7 +411,7 @@ NS_INLINE Float4x4 Float4x4OuterProduct(Float4 a, Float4 b) {
 			(float)caValue.m41, (float)caValue.m42, (float)caValue.m43, (float)caValue.m44,
 		};
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_WATCH
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 
 
 
@@ -219,6 +429,7 @@ NS_INLINE Float4x4 Float4x4OuterProduct(Float4 a, Float4 b) {
 
 
 
+#if __OBJC__
 #pragma mark `NSValue`-Wrapping
 
 @interface NSValue (Float4x4Additions)
@@ -228,7 +439,9 @@ NS_INLINE Float4x4 Float4x4OuterProduct(Float4 a, Float4 b) {
 @property(nonatomic, readonly) Float4x4 Float4x4Value;
 
 @end
+#endif // __OBJC__
 
 
 
+VUCKT_DIAGNOSTICS_END
 NS_ASSUME_NONNULL_END
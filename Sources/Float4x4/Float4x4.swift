@@ -3,7 +3,14 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
 import Foundation
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
 #if canImport(SceneKit)
 	import SceneKit.SceneKitTypes
 #endif
@@ -128,12 +135,22 @@ extension Float4x4
 		self.init(Float3x3(rotationAngle: angleMeasurement, axis: axis))
 	}
 	
-	public init(rotationEulerAngles eulerAngles_radians:Float3, order:RotationOrder = .zyx) {
-		self.init(Float3x3(rotationEulerAngles: eulerAngles_radians, order: order))
+	/// Computes the rotation in closed form for `order` (see `Float4x4FromEulerAngles()`), with no intermediate axis rotations.  With `precision: .fast`, computes the angles' sines & cosines with `Float3SinCosFast()`.
+	@_transparent public init(rotationEulerAngles eulerAngles_radians:Float3, order:RotationOrder = .zyx, precision:MathPrecision = .full) {
+		let axes = order.axisIndices
+		switch precision {
+			case .full: self = Float4x4FromEulerAngles(eulerAngles_radians, axes.first, axes.second, axes.third)
+			case .fast: self = Float4x4FromEulerAnglesFast(eulerAngles_radians, axes.first, axes.second, axes.third)
+		}
 	}
 	@available(macOS 10.12, iOS 10.10, tvOS 10.10, watchOS 3.0, *)
-	@_transparent public init(rotationEulerAngles eulerAnglesMeasurements:(x:Measurement<UnitAngle>,y:Measurement<UnitAngle>,z:Measurement<UnitAngle>), order:RotationOrder = .zyx) {
-		self.init(Float3x3(rotationEulerAngles: eulerAnglesMeasurements, order: order))
+	@_transparent public init(rotationEulerAngles eulerAnglesMeasurements:(x:Measurement<UnitAngle>,y:Measurement<UnitAngle>,z:Measurement<UnitAngle>), order:RotationOrder = .zyx, precision:MathPrecision = .full) {
+		self.init(Float3x3(rotationEulerAngles: eulerAnglesMeasurements, order: order, precision: precision))
+	}
+	/// The Euler angles (radians) of the rotation in the upper-left 3×3, which `init(rotationEulerAngles:order:)` turns back into that rotation.
+	@_transparent public func rotationEulerAngles(order:RotationOrder = .zyx) -> Float3 {
+		let axes = order.axisIndices
+		return Float4x4ToEulerAngles(self, axes.first, axes.second, axes.third)
 	}
 	
 	public init(scale:Float3) {
@@ -160,8 +177,8 @@ extension Float4x4
 	
 	// MARK: commonly-used “presets”
 	
-	public static let zero = Float4x4()
-	public static let identity = Float4x4(matrix_identity_float4x4);
+	@_transparent public static var zero:Float4x4 { return Float4x4() }
+	@_transparent public static var identity:Float4x4 { return Float4x4(diagonal: 1) }
 	
 	
 	
@@ -646,6 +663,211 @@ extension Float4x4 // Geometric Math Operations
 }
 
 
+extension Float4x4 // Batch Transforms
+{
+	/// Transforms each point in `points` (as `w = 1`) into `out`, dividing each result by its `w` if `perspectiveDivide` is set.  (Both buffers must have the same count; they may be the same buffer, but must not otherwise overlap.)
+	@_alwaysEmitIntoClient public func transformPoints(_ points:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>, perspectiveDivide:Bool = false) {
+		points._vucktBulkOperation(into: out){ Float4x4TransformPoints(self, $0, $1, $2, perspectiveDivide) }
+	}
+	@_alwaysEmitIntoClient public func transformPoints(_ points:UnsafeBufferPointer<PackedFloat3>, into out:UnsafeMutableBufferPointer<PackedFloat3>, perspectiveDivide:Bool = false) {
+		points._vucktBulkOperation(into: out){ Float4x4TransformPackedPoints(self, $0, $1, $2, perspectiveDivide) }
+	}
+	@_alwaysEmitIntoClient public func transformedPoints(_ points:[Float3], perspectiveDivide:Bool = false) -> [Float3] {
+		return points._vucktBulkOperation{ Float4x4TransformPoints(self, $0, $1, $2, perspectiveDivide) }
+	}
+	@_alwaysEmitIntoClient public func transformedPoints(_ points:[PackedFloat3], perspectiveDivide:Bool = false) -> [PackedFloat3] {
+		return points._vucktBulkOperation{ Float4x4TransformPackedPoints(self, $0, $1, $2, perspectiveDivide) }
+	}
+	
+	
+	/// Transforms each direction vector in `vectors` (as `w = 0`, so ignoring translation) into `out`.  (Both buffers must have the same count; they may be the same buffer, but must not otherwise overlap.)
+	@_alwaysEmitIntoClient public func transformVectors(_ vectors:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>) {
+		vectors._vucktBulkOperation(into: out){ Float4x4TransformVectors(self, $0, $1, $2) }
+	}
+	@_alwaysEmitIntoClient public func transformVectors(_ vectors:UnsafeBufferPointer<PackedFloat3>, into out:UnsafeMutableBufferPointer<PackedFloat3>) {
+		vectors._vucktBulkOperation(into: out){ Float4x4TransformPackedVectors(self, $0, $1, $2) }
+	}
+	@_alwaysEmitIntoClient public func transformedVectors(_ vectors:[Float3]) -> [Float3] {
+		return vectors._vucktBulkOperation{ Float4x4TransformVectors(self, $0, $1, $2) }
+	}
+	@_alwaysEmitIntoClient public func transformedVectors(_ vectors:[PackedFloat3]) -> [PackedFloat3] {
+		return vectors._vucktBulkOperation{ Float4x4TransformPackedVectors(self, $0, $1, $2) }
+	}
+	
+	
+	/// Transforms each normal in `normals` by the inverse-transpose (computed once for the whole batch) into `out`, normalizing each result if `renormalize` is set.  (Both buffers must have the same count; they may be the same buffer, but must not otherwise overlap.)
+	@_alwaysEmitIntoClient public func transformNormals(_ normals:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>, renormalize:Bool = false) {
+		normals._vucktBulkOperation(into: out){ Float4x4TransformNormals(self, $0, $1, $2, renormalize) }
+	}
+	@_alwaysEmitIntoClient public func transformNormals(_ normals:UnsafeBufferPointer<PackedFloat3>, into out:UnsafeMutableBufferPointer<PackedFloat3>, renormalize:Bool = false) {
+		normals._vucktBulkOperation(into: out){ Float4x4TransformPackedNormals(self, $0, $1, $2, renormalize) }
+	}
+	@_alwaysEmitIntoClient public func transformedNormals(_ normals:[Float3], renormalize:Bool = false) -> [Float3] {
+		return normals._vucktBulkOperation{ Float4x4TransformNormals(self, $0, $1, $2, renormalize) }
+	}
+	@_alwaysEmitIntoClient public func transformedNormals(_ normals:[PackedFloat3], renormalize:Bool = false) -> [PackedFloat3] {
+		return normals._vucktBulkOperation{ Float4x4TransformPackedNormals(self, $0, $1, $2, renormalize) }
+	}
+	
+	
+	/// The rotation matrix for each of `eulerAngles` (as `init(rotationEulerAngles:order:)`), written to `out`, taking the sines & cosines of 4 elements at a time.  (Both buffers must have the same count.)
+	@_alwaysEmitIntoClient public static func fromRotationEulerAngles(_ eulerAngles:UnsafeBufferPointer<Float3>, order:RotationOrder = .zyx, into out:UnsafeMutableBufferPointer<Float4x4>) {
+		let axes = order.axisIndices
+		eulerAngles._vucktBulkConversion(into: out){ Float4x4FromEulerAnglesArray($0, $1, $2, axes.first, axes.second, axes.third) }
+	}
+	@_alwaysEmitIntoClient public static func fromRotationEulerAngles(_ eulerAngles:[Float3], order:RotationOrder = .zyx) -> [Float4x4] {
+		let axes = order.axisIndices
+		return eulerAngles._vucktBulkConversion{ Float4x4FromEulerAnglesArray($0, $1, $2, axes.first, axes.second, axes.third) }
+	}
+}
+
+
+extension Float4x4 // Hierarchy Propagation
+{
+	/// Computes the world matrix of every node in a scene-graph hierarchy in one linear sweep, also writing each one's inverse if `worldInverses` is given.
+	/// `parentIndices[i]` is the index of node `i`'s parent, or negative for a root, and nodes must be topologically sorted (every parent before its children).  All buffers must have the same count.
+	@_alwaysEmitIntoClient public static func propagateHierarchy(local:UnsafeBufferPointer<Float4x4>, parentIndices:UnsafeBufferPointer<Int32>, world:UnsafeMutableBufferPointer<Float4x4>, worldInverses:UnsafeMutableBufferPointer<Float4x4>? = nil) {
+		precondition(parentIndices.count == local.count && world.count == local.count && (worldInverses?.count ?? local.count) == local.count, "Hierarchy buffers must all have the same count.")
+		guard local.count > 0 else { return }
+		Float4x4PropagateHierarchy(local.baseAddress!, parentIndices.baseAddress!, world.baseAddress!, worldInverses?.baseAddress, local.count)
+	}
+	
+	/// Like `propagateHierarchy(local:parentIndices:world:worldInverses:)`, but only recomputes the subtrees under nodes whose `dirty` flag is set, leaving the other nodes' `world` (& `worldInverses`) entries as-is.
+	/// On return, `dirty` is set for every node that was recomputed (the dirty nodes & all their descendants).
+	@_alwaysEmitIntoClient public static func propagateHierarchy(local:UnsafeBufferPointer<Float4x4>, parentIndices:UnsafeBufferPointer<Int32>, dirty:UnsafeMutableBufferPointer<Bool>, world:UnsafeMutableBufferPointer<Float4x4>, worldInverses:UnsafeMutableBufferPointer<Float4x4>? = nil) {
+		precondition(parentIndices.count == local.count && dirty.count == local.count && world.count == local.count && (worldInverses?.count ?? local.count) == local.count, "Hierarchy buffers must all have the same count.")
+		guard local.count > 0 else { return }
+		Float4x4PropagateDirtyHierarchy(local.baseAddress!, parentIndices.baseAddress!, dirty.baseAddress!, world.baseAddress!, worldInverses?.baseAddress, local.count)
+	}
+	
+	/// Returns the world matrices for a scene-graph hierarchy's `local` matrices.  (See `propagateHierarchy(local:parentIndices:world:worldInverses:)`.)
+	@_alwaysEmitIntoClient public static func worldTransforms(local:[Float4x4], parentIndices:[Int32]) -> [Float4x4] {
+		return local.withUnsafeBufferPointer{ localBuffer in
+			parentIndices.withUnsafeBufferPointer{ parentIndicesBuffer in
+				Array(unsafeUninitializedCapacity: local.count) { worldBuffer, initializedCount in
+					Self.propagateHierarchy(local: localBuffer, parentIndices: parentIndicesBuffer, world: UnsafeMutableBufferPointer(rebasing: worldBuffer[0..<local.count]))
+					initializedCount = local.count
+				}
+			}
+		}
+	}
+	/// Updates `world` for the subtrees under nodes whose `dirty` flag is set.  (See `propagateHierarchy(local:parentIndices:dirty:world:worldInverses:)`.)
+	@_alwaysEmitIntoClient public static func propagateHierarchy(local:[Float4x4], parentIndices:[Int32], dirty:inout [Bool], world:inout [Float4x4]) {
+		local.withUnsafeBufferPointer{ localBuffer in
+			parentIndices.withUnsafeBufferPointer{ parentIndicesBuffer in
+				dirty.withUnsafeMutableBufferPointer{ dirtyBuffer in
+					world.withUnsafeMutableBufferPointer{ worldBuffer in
+						Self.propagateHierarchy(local: localBuffer, parentIndices: parentIndicesBuffer, dirty: dirtyBuffer, world: worldBuffer)
+					}
+				}
+			}
+		}
+	}
+}
+
+
+/// One row of each matrix of an array, viewed in place: each `Float4` gathered from that row's components of the 4 (contiguous) columns.  (See `StridedArrayView` for the columns.)
+/// The view holds onto the array, so it stays valid for as long as it's kept.
+public struct Float4x4RowView : RandomAccessCollection
+{
+	public let base:[Float4x4]
+	public let row:Int
+	
+	@inlinable public init(_ base:[Float4x4], row:Int) {
+		precondition(row >= 0 && row < 4, "Row index out of range.")
+		self.base = base
+		self.row = row
+	}
+	
+	public typealias Index = Int
+	
+	@inlinable public var startIndex:Int { return 0 }
+	@inlinable public var endIndex:Int { return self.base.count }
+	
+	@inlinable public subscript(index:Int) -> Float4 {
+		return self.base.withUnsafeBufferPointer{ buffer in
+			precondition(index >= 0 && index < buffer.count, "Index out of range.")
+			let columnStride = 4 * MemoryLayout<Float>.stride
+			let rowStart = UnsafeRawPointer(buffer.baseAddress! + index) + self.row * MemoryLayout<Float>.stride
+			return Float4(
+				rowStart.load(as: Float.self),
+				rowStart.load(fromByteOffset: columnStride, as: Float.self),
+				rowStart.load(fromByteOffset: 2 * columnStride, as: Float.self),
+				rowStart.load(fromByteOffset: 3 * columnStride, as: Float.self)
+			)
+		}
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == Float4x4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `simd_float4x4`s, in place: `Float4x4` is laid out as `simd_float4x4` is (see the `static_assert`s in `Float4x4.mm`), so nothing's copied.  (Except on the Swift backend, whose `Float4x4`s are only 4-byte aligned; there they're converted through a temporary buffer.)
+	@_alwaysEmitIntoClient public func withSimdMemoryRebound<Result>(_ body:(UnsafeBufferPointer<simd_float4x4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: simd_float4x4.self, converting: Float4x4ToSimd, body)
+	}
+}
+
+extension UnsafeMutableBufferPointer where Element == Float4x4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as mutable `simd_float4x4`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withSimdMemoryRebound<Result>(_ body:(UnsafeMutableBufferPointer<simd_float4x4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: simd_float4x4.self, converting: Float4x4ToSimd, back: Float4x4FromSimd, body)
+	}
+}
+
+extension Array where Element == Float4x4 // Zero-Copy Views
+{
+	/// Column `column` of each matrix, viewed in place: the columns are contiguous (`m00`…`m03`, then `m10`…), so each is one `Float4`.
+	@_alwaysEmitIntoClient public func columns(_ column:Int) -> StridedArrayView<Float4x4, Float4> {
+		precondition(column >= 0 && column < 4, "Column index out of range.")
+		return StridedArrayView(self, fieldOffset: column * 4 * MemoryLayout<Float>.stride)
+	}
+	/// Row `row` of each matrix, viewed in place, each gathered from the 4 columns.
+	@_alwaysEmitIntoClient public func rows(_ row:Int) -> Float4x4RowView {
+		return Float4x4RowView(self, row: row)
+	}
+	
+	/// Calls `body` with the elements as `simd_float4x4`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withUnsafeSimdBufferPointer<Result>(_ body:(UnsafeBufferPointer<simd_float4x4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeBufferPointer{ try $0.withSimdMemoryRebound(body) }
+	}
+	/// Calls `body` with the elements as mutable `simd_float4x4`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public mutating func withUnsafeMutableSimdBufferPointer<Result>(_ body:(UnsafeMutableBufferPointer<simd_float4x4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeMutableBufferPointer{ try $0.withSimdMemoryRebound(body) }
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == simd_float4x4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `Float4x4`s, in place— see the `Float4x4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withFloat4x4MemoryRebound<Result>(_ body:(UnsafeBufferPointer<Float4x4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: Float4x4.self, converting: Float4x4FromSimd, body)
+	}
+}
+
+extension UnsafeMutableBufferPointer where Element == simd_float4x4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as mutable `Float4x4`s, in place— see the `Float4x4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withFloat4x4MemoryRebound<Result>(_ body:(UnsafeMutableBufferPointer<Float4x4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: Float4x4.self, converting: Float4x4FromSimd, back: Float4x4ToSimd, body)
+	}
+}
+
+extension Array where Element == simd_float4x4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `Float4x4`s, in place— see the `Float4x4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withUnsafeFloat4x4BufferPointer<Result>(_ body:(UnsafeBufferPointer<Float4x4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeBufferPointer{ try $0.withFloat4x4MemoryRebound(body) }
+	}
+	/// Calls `body` with the elements as mutable `Float4x4`s, in place— see the `Float4x4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public mutating func withUnsafeMutableFloat4x4BufferPointer<Result>(_ body:(UnsafeMutableBufferPointer<Float4x4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeMutableBufferPointer{ try $0.withFloat4x4MemoryRebound(body) }
+	}
+}
+
+
 extension Float4x4 : Hashable
 {
 	private static let _hashingLargePrimes:[UInt] = [
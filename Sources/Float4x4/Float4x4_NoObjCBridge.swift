@@ -2,7 +2,11 @@
 // @author: Slipp Douglas Thompson
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
 #if canImport(SceneKit)
 	import SceneKit.SceneKitTypes
 #endif
@@ -120,6 +124,107 @@ public struct Float4x4
 	))
 }
 
+@_transparent public func Float4x4Concatenate(_ a:Float4x4, _ b:Float4x4) -> Float4x4 {
+	return Float4x4FromSimd(simd_mul(Float4x4ToSimd(a), Float4x4ToSimd(b)))
+}
+
+@_transparent public func Float4x4Inverse(_ m:Float4x4) -> Float4x4 {
+	return Float4x4FromSimd(simd_inverse(Float4x4ToSimd(m)))
+}
+
+
+
+// MARK: Batch Transforms
+
+@_alwaysEmitIntoClient public func Float4x4TransformPoints(_ m:Float4x4, _ points:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int, _ perspectiveDivide:Bool) {
+	let m_simd = Float4x4ToSimd(m)
+	for i in 0..<n {
+		let p = points[i]
+		var r = simd_mul(m_simd, simd_float4(p.x, p.y, p.z, 1))
+		if perspectiveDivide {
+			r /= r.w
+		}
+		out[i] = Float3(x: r.x, y: r.y, z: r.z)
+	}
+}
+@_alwaysEmitIntoClient public func Float4x4TransformPackedPoints(_ m:Float4x4, _ points:UnsafePointer<PackedFloat3>, _ out:UnsafeMutablePointer<PackedFloat3>, _ n:Int, _ perspectiveDivide:Bool) {
+	let m_simd = Float4x4ToSimd(m)
+	for i in 0..<n {
+		let p = points[i]
+		var r = simd_mul(m_simd, simd_float4(p.x, p.y, p.z, 1))
+		if perspectiveDivide {
+			r /= r.w
+		}
+		out[i] = PackedFloat3(x: r.x, y: r.y, z: r.z)
+	}
+}
+
+@_transparent public func Float4x4UpperLeft3x3(_ m:Float4x4) -> Float3x3 {
+	return Float3x3(
+		m00: m.m00, m01: m.m01, m02: m.m02,
+		m10: m.m10, m11: m.m11, m12: m.m12,
+		m20: m.m20, m21: m.m21, m22: m.m22
+	)
+}
+
+@_alwaysEmitIntoClient public func Float4x4TransformVectors(_ m:Float4x4, _ vectors:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	Float3x3TransformVectors(Float4x4UpperLeft3x3(m), vectors, out, n)
+}
+@_alwaysEmitIntoClient public func Float4x4TransformPackedVectors(_ m:Float4x4, _ vectors:UnsafePointer<PackedFloat3>, _ out:UnsafeMutablePointer<PackedFloat3>, _ n:Int) {
+	Float3x3TransformPackedVectors(Float4x4UpperLeft3x3(m), vectors, out, n)
+}
+
+@_alwaysEmitIntoClient public func Float4x4TransformNormals(_ m:Float4x4, _ normals:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int, _ renormalize:Bool) {
+	Float3x3TransformNormals(Float4x4UpperLeft3x3(m), normals, out, n, renormalize)
+}
+@_alwaysEmitIntoClient public func Float4x4TransformPackedNormals(_ m:Float4x4, _ normals:UnsafePointer<PackedFloat3>, _ out:UnsafeMutablePointer<PackedFloat3>, _ n:Int, _ renormalize:Bool) {
+	Float3x3TransformPackedNormals(Float4x4UpperLeft3x3(m), normals, out, n, renormalize)
+}
+
+
+
+// MARK: Hierarchy Propagation
+
+@_alwaysEmitIntoClient public func Float4x4PropagateHierarchy(_ local:UnsafePointer<Float4x4>, _ parentIndices:UnsafePointer<Int32>, _ world:UnsafeMutablePointer<Float4x4>, _ worldInverses:UnsafeMutablePointer<Float4x4>?, _ n:Int) {
+	for i in 0..<n {
+		let parentIndex = Int(parentIndices[i])
+		world[i] = (parentIndex < 0) ? local[i] : Float4x4Concatenate(world[parentIndex], local[i])
+		worldInverses?[i] = Float4x4Inverse(world[i])
+	}
+}
+
+@_alwaysEmitIntoClient public func Float4x4PropagateDirtyHierarchy(_ local:UnsafePointer<Float4x4>, _ parentIndices:UnsafePointer<Int32>, _ dirty:UnsafeMutablePointer<Bool>, _ world:UnsafeMutablePointer<Float4x4>, _ worldInverses:UnsafeMutablePointer<Float4x4>?, _ n:Int) {
+	for i in 0..<n {
+		let parentIndex = Int(parentIndices[i])
+		if parentIndex >= 0 && dirty[parentIndex] {
+			dirty[i] = true
+		}
+		guard dirty[i] else { continue }
+		world[i] = (parentIndex < 0) ? local[i] : Float4x4Concatenate(world[parentIndex], local[i])
+		worldInverses?[i] = Float4x4Inverse(world[i])
+	}
+}
+
+
+
+// MARK: Euler-Angle Conversion
+
+@_alwaysEmitIntoClient public func Float4x4FromEulerAngles(_ eulerAngles:Float3, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) -> Float4x4 {
+	return Float4x4FromSimd(simd_float4x4(FloatQuaternionToSimd(FloatQuaternionFromEulerAngles(eulerAngles, firstAxis, secondAxis, thirdAxis))))
+}
+/// The Swift backend uses the full-precision sines & cosines here (trivially meeting the C backend's error bounds).
+@_alwaysEmitIntoClient public func Float4x4FromEulerAnglesFast(_ eulerAngles:Float3, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) -> Float4x4 {
+	return Float4x4FromEulerAngles(eulerAngles, firstAxis, secondAxis, thirdAxis)
+}
+@_alwaysEmitIntoClient public func Float4x4ToEulerAngles(_ m:Float4x4, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) -> Float3 {
+	return Float3x3ToEulerAngles(Float4x4UpperLeft3x3(m), firstAxis, secondAxis, thirdAxis)
+}
+@_alwaysEmitIntoClient public func Float4x4FromEulerAnglesArray(_ eulerAngles:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Float4x4>, _ n:Int, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) {
+	for i in 0..<n {
+		out[i] = Float4x4FromEulerAngles(eulerAngles[i], firstAxis, secondAxis, thirdAxis)
+	}
+}
+
 
 
 #if canImport(SceneKit)
@@ -3,24 +3,36 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 #pragma once
 
-#import <Foundation/NSValue.h>
-#import <simd/vector_types.h>
-#if TARGET_OS_MAC
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#if __OBJC__
+	#import <Foundation/NSValue.h>
+#endif
+#if __OBJC__ && TARGET_OS_MAC
 	#import <SceneKit/SceneKitTypes.h>
 #endif
-#if TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 	#import <GLKit/GLKQuaternion.h>
 #endif
-#if TARGET_OS_MAC && !TARGET_OS_WATCH
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 	#import <GameController/GCMotion.h>
 #endif
-#if TARGET_OS_MAC && !TARGET_OS_TV
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_TV
 	#import <CoreMotion/CMAttitude.h>
 #endif
 
 
 
 NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
 
 
 
@@ -28,7 +40,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 struct FloatQuaternion {
 	float ix, iy, iz, r;
-} __attribute__((aligned(__alignof__(simd_quatf))));
+} __attribute__((aligned(__alignof__(simd_quatf)))) VUCKT_SIMD_MAY_ALIAS;
 typedef struct FloatQuaternion FloatQuaternion;
 
 
@@ -48,7 +60,297 @@ NS_INLINE FloatQuaternion FloatQuaternionFromSimd(simd_quatf simdValue) {
 
 
 
-#if TARGET_OS_MAC
+#pragma mark Fast-Approximate Math
+
+// Faster, approximate counterparts of `FloatQuaternion`'s `normalized()` & `length()`; see `VucktPlatform.h`'s `vuckt_simd_fast_*()` kernels for their error bounds.
+
+/// `q` scaled to unit length, via `vuckt_fast_rsqrtf_unguarded()`.  A zero-length `q` yields NaNs, as the full-precision `normalized()` does.
+NS_INLINE FloatQuaternion FloatQuaternionNormalizeFast(FloatQuaternion q) {
+	float inverseLength = vuckt_fast_rsqrtf_unguarded(q.ix * q.ix + q.iy * q.iy + q.iz * q.iz + q.r * q.r);
+	return (FloatQuaternion){ q.ix * inverseLength, q.iy * inverseLength, q.iz * inverseLength, q.r * inverseLength };
+}
+NS_INLINE float FloatQuaternionLengthFast(FloatQuaternion q) {
+	return vuckt_fast_sqrtf(q.ix * q.ix + q.iy * q.iy + q.iz * q.iz + q.r * q.r);
+}
+
+
+
+
+#pragma mark Lane-Wise Operations
+
+// Building blocks for the batched kernels below: 4 quaternions at a time, transposed so each component is one vector (lane `i` of each belonging to quaternion `i`).
+// That turns dot products, Hamilton products, & the trigonometry of slerp into plain element-wise vector math, with no horizontal adds or per-quaternion branches.
+
+/// 4 quaternions in structure-of-arrays form.
+typedef struct FloatQuaternionLanes {
+	simd_float4 ix, iy, iz, r;
+} FloatQuaternionLanes;
+
+/// Transposes `q[0..<count]` (`count` ≤ 4) into lanes, repeating the last quaternion in any lanes past `count`.
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesLoad(const FloatQuaternion *q, size_t count) {
+	simd_float4 rows[4];
+	for (size_t laneI = 0; laneI < 4; ++laneI)
+		rows[laneI] = FloatQuaternionToSimd(q[(laneI < count) ? laneI : count - 1]).vector;
+	vuckt_simd_transpose4(&rows[0], &rows[1], &rows[2], &rows[3]);
+	return (FloatQuaternionLanes){ rows[0], rows[1], rows[2], rows[3] };
+}
+/// Transposes the first `count` (≤ 4) lanes back into `out[0..<count]`.
+NS_INLINE void FloatQuaternionLanesStore(FloatQuaternionLanes q, FloatQuaternion *out, size_t count) {
+	simd_float4 rows[4] = { q.ix, q.iy, q.iz, q.r };
+	vuckt_simd_transpose4(&rows[0], &rows[1], &rows[2], &rows[3]);
+	for (size_t laneI = 0; laneI < count; ++laneI)
+		out[laneI] = FloatQuaternionFromSimd((simd_quatf){ rows[laneI] });
+}
+/// Gathers `ratios[0]`, `ratios[ratioStride]`, … for `count` (≤ 4) lanes, repeating the last in any lanes past `count`.
+NS_INLINE simd_float4 FloatQuaternionLanesLoadRatios(const float *ratios, size_t ratioStride, size_t count) {
+	simd_float4 t;
+	for (size_t laneI = 0; laneI < 4; ++laneI)
+		t[laneI] = ratios[((laneI < count) ? laneI : count - 1) * ratioStride];
+	return t;
+}
+
+NS_INLINE simd_float4 FloatQuaternionLanesDotProduct(FloatQuaternionLanes a, FloatQuaternionLanes b) {
+	return a.ix * b.ix + a.iy * b.iy + a.iz * b.iz + a.r * b.r;
+}
+/// `a·aWeight + b·bWeight`
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesBlend(FloatQuaternionLanes a, simd_float4 aWeight, FloatQuaternionLanes b, simd_float4 bWeight) {
+	return (FloatQuaternionLanes){
+		a.ix * aWeight + b.ix * bWeight,
+		a.iy * aWeight + b.iy * bWeight,
+		a.iz * aWeight + b.iz * bWeight,
+		a.r * aWeight + b.r * bWeight,
+	};
+}
+/// Hamilton product `a * b`.
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesMultiply(FloatQuaternionLanes a, FloatQuaternionLanes b) {
+	return (FloatQuaternionLanes){
+		a.r * b.ix + b.r * a.ix + (a.iy * b.iz - a.iz * b.iy),
+		a.r * b.iy + b.r * a.iy + (a.iz * b.ix - a.ix * b.iz),
+		a.r * b.iz + b.r * a.iz + (a.ix * b.iy - a.iy * b.ix),
+		a.r * b.r - (a.ix * b.ix + a.iy * b.iy + a.iz * b.iz),
+	};
+}
+/// The conjugate of `q`, which is its inverse when `q` is unit-length.
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesConjugate(FloatQuaternionLanes q) {
+	return (FloatQuaternionLanes){ -q.ix, -q.iy, -q.iz, q.r };
+}
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesNormalize(FloatQuaternionLanes q) {
+	simd_float4 inverseLength = 1.0f / vuckt_simd_sqrt4(FloatQuaternionLanesDotProduct(q, q));
+	return (FloatQuaternionLanes){ q.ix * inverseLength, q.iy * inverseLength, q.iz * inverseLength, q.r * inverseLength };
+}
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesNormalizeFast(FloatQuaternionLanes q) {
+	simd_float4 inverseLength = vuckt_simd_fast_rsqrt4_unguarded(FloatQuaternionLanesDotProduct(q, q));
+	return (FloatQuaternionLanes){ q.ix * inverseLength, q.iy * inverseLength, q.iz * inverseLength, q.r * inverseLength };
+}
+
+/// `b`, negated in each lane where it's in the opposite hemisphere from `a` (or with `longest`, the same one), so interpolating from `a` takes the shorter (or longer) arc— as `simd_slerp()` (or `simd_slerp_longest()`) chooses.
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesAlign(FloatQuaternionLanes a, FloatQuaternionLanes b, bool longest) {
+	simd_float4 dotProduct = FloatQuaternionLanesDotProduct(a, b);
+	simd_int4 isFlipped = longest ? (dotProduct >= 0.0f) : (dotProduct < 0.0f);
+	simd_int4 signBits = isFlipped & (simd_int4)(simd_float4){ -0.0f, -0.0f, -0.0f, -0.0f };
+	return (FloatQuaternionLanes){
+		(simd_float4)((simd_int4)b.ix ^ signBits),
+		(simd_float4)((simd_int4)b.iy ^ signBits),
+		(simd_float4)((simd_int4)b.iz ^ signBits),
+		(simd_float4)((simd_int4)b.r ^ signBits),
+	};
+}
+
+/// Spherical linear interpolation from `a` to `b` along whichever arc `b`'s sign gives (see `FloatQuaternionLanesAlign()`), computed as `simd_slerp()` does.
+/// The angle θ between them is 2·atan2(|a − b|, |a + b|), which (unlike `acos(a·b)`) stays accurate near 0; the weights are sin((1 − t)·θ) / sin θ & sin(t·θ) / sin θ (tending to 1 − t & t as θ → 0), and the result is renormalized.
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesSlerp(FloatQuaternionLanes a, FloatQuaternionLanes b, simd_float4 t) {
+	simd_float4 ones = { 1, 1, 1, 1 };
+	FloatQuaternionLanes difference = FloatQuaternionLanesBlend(a, ones, b, -ones), sum = FloatQuaternionLanesBlend(a, ones, b, ones);
+	simd_float4 angle = 2.0f * vuckt_simd_fast_atan2_4(vuckt_simd_sqrt4(FloatQuaternionLanesDotProduct(difference, difference)), vuckt_simd_sqrt4(FloatQuaternionLanesDotProduct(sum, sum)));
+	
+	simd_float4 sinOfAngle, cosOfAngle, sinOfBAngle, cosOfBAngle;
+	vuckt_simd_fast_sincos4(angle, &sinOfAngle, &cosOfAngle);
+	vuckt_simd_fast_sincos4(t * angle, &sinOfBAngle, &cosOfBAngle);
+	simd_float4 sinOfAAngle = sinOfAngle * cosOfBAngle - cosOfAngle * sinOfBAngle; // sin(θ − t·θ)
+	
+	simd_int4 isLinear = (angle < 1e-4f); // where the sine ratios' error from their linear limits is < 1e-9 (& they'd otherwise be 0/0 at θ = 0)
+	simd_float4 inverseSinOfAngle = 1.0f / sinOfAngle;
+	simd_float4 aWeight = vuckt_simd_select4(isLinear, ones - t, sinOfAAngle * inverseSinOfAngle);
+	simd_float4 bWeight = vuckt_simd_select4(isLinear, t, sinOfBAngle * inverseSinOfAngle);
+	return FloatQuaternionLanesNormalize(FloatQuaternionLanesBlend(a, aWeight, b, bWeight));
+}
+/// Normalized linear interpolation from `a` to `b` (with `b`'s sign as given): constant-speed only at the ends & midpoint, but cheap.
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesNlerp(FloatQuaternionLanes a, FloatQuaternionLanes b, simd_float4 t) {
+	return FloatQuaternionLanesNormalize(FloatQuaternionLanesBlend(a, 1.0f - t, b, t));
+}
+/// Approximate slerp from `a` to `b`, where `b` is in the same hemisphere as `a` (see `FloatQuaternionLanesAlign()`): nlerp with `t` first corrected by a polynomial in `t` & `a·b` fitted to slerp's speed along the arc (after Kapoulkine's “onlerp”).
+/// Max error: 4e-4 absolute per component (vs. slerp, over every angle up to 180° of rotation).
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesSlerpFast(FloatQuaternionLanes a, FloatQuaternionLanes b, simd_float4 t) {
+	simd_float4 d = FloatQuaternionLanesDotProduct(a, b);
+	simd_float4 attenuation = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+	simd_float4 offset = 0.848013f + d * (-1.06021f + d * 0.215638f);
+	simd_float4 k = attenuation * (t - 0.5f) * (t - 0.5f) + offset;
+	simd_float4 correctedT = t + t * (t - 0.5f) * (t - 1.0f) * k;
+	return FloatQuaternionLanesNormalizeFast(FloatQuaternionLanesBlend(a, 1.0f - correctedT, b, correctedT));
+}
+
+/// The logarithm of unit-length `q`: its rotation axis scaled by half its rotation angle (a pure quaternion).
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesLog(FloatQuaternionLanes q) {
+	simd_float4 imaginaryLength = vuckt_simd_sqrt4(q.ix * q.ix + q.iy * q.iy + q.iz * q.iz);
+	simd_float4 halfAngle = vuckt_simd_fast_atan2_4(imaginaryLength, q.r);
+	simd_float4 scale = vuckt_simd_select4((imaginaryLength == 0.0f), (simd_float4){ 0, 0, 0, 0 }, halfAngle / imaginaryLength);
+	return (FloatQuaternionLanes){ q.ix * scale, q.iy * scale, q.iz * scale, (simd_float4){ 0, 0, 0, 0 } };
+}
+/// The exponential of pure quaternion `p` (`p.r` is ignored): the unit quaternion rotating by twice `p`'s length about its direction.
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesExp(FloatQuaternionLanes p) {
+	simd_float4 length = vuckt_simd_sqrt4(p.ix * p.ix + p.iy * p.iy + p.iz * p.iz);
+	simd_float4 sinOfLength, cosOfLength;
+	vuckt_simd_fast_sincos4(length, &sinOfLength, &cosOfLength);
+	simd_float4 scale = vuckt_simd_select4((length == 0.0f), (simd_float4){ 1, 1, 1, 1 }, sinOfLength / length);
+	return (FloatQuaternionLanes){ p.ix * scale, p.iy * scale, p.iz * scale, cosOfLength };
+}
+
+/// Cubic Bézier interpolation from `q0` to `q3` with control points `q1` & `q2`, by de Casteljau's construction from slerps, as `simd_bezier()` does.
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesBezier(FloatQuaternionLanes q0, FloatQuaternionLanes q1, FloatQuaternionLanes q2, FloatQuaternionLanes q3, simd_float4 t) {
+	FloatQuaternionLanes q01 = FloatQuaternionLanesSlerp(q0, q1, t), q12 = FloatQuaternionLanesSlerp(q1, q2, t), q23 = FloatQuaternionLanesSlerp(q2, q3, t);
+	FloatQuaternionLanes q012 = FloatQuaternionLanesSlerp(q01, q12, t), q123 = FloatQuaternionLanesSlerp(q12, q23, t);
+	return FloatQuaternionLanesSlerp(q012, q123, t);
+}
+/// The squad inner control point at key `q1` between neighbors `q0` & `q2`: q1 · exp(−(log(q0 · q1⁻¹) + log(q2 · q1⁻¹)) / 4).
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesSplineControlPoint(FloatQuaternionLanes q0, FloatQuaternionLanes q1, FloatQuaternionLanes q2) {
+	FloatQuaternionLanes q1Inverse = FloatQuaternionLanesConjugate(q1);
+	FloatQuaternionLanes p0 = FloatQuaternionLanesLog(FloatQuaternionLanesMultiply(q0, q1Inverse)), p2 = FloatQuaternionLanesLog(FloatQuaternionLanesMultiply(q2, q1Inverse));
+	simd_float4 negativeQuarter = { -0.25f, -0.25f, -0.25f, -0.25f };
+	return FloatQuaternionLanesNormalize(FloatQuaternionLanesMultiply(q1, FloatQuaternionLanesExp(FloatQuaternionLanesBlend(p0, negativeQuarter, p2, negativeQuarter))));
+}
+/// Spherical cubic spline (squad) interpolation from `q1` to `q2`, with `q0` & `q3` the keys before & after them, as `simd_spline()` does.
+NS_INLINE FloatQuaternionLanes FloatQuaternionLanesSpline(FloatQuaternionLanes q0, FloatQuaternionLanes q1, FloatQuaternionLanes q2, FloatQuaternionLanes q3, simd_float4 t) {
+	FloatQuaternionLanes s1 = FloatQuaternionLanesSplineControlPoint(q0, q1, q2), s2 = FloatQuaternionLanesSplineControlPoint(q1, q2, q3);
+	FloatQuaternionLanes outer = FloatQuaternionLanesSlerp(q1, q2, t), inner = FloatQuaternionLanesSlerp(s1, s2, t);
+	return FloatQuaternionLanesSlerp(outer, inner, 2.0f * t * (1.0f - t));
+}
+
+
+
+#pragma mark Batched Interpolation
+
+// Slerp, nlerp, & the cubic Bézier/spline forms of `interpolateBetween()` over `n`-element arrays, for bulk passes such as blending a skeleton's bone rotations each frame.
+// Each kernel works 8 quaternions at a time, as two independent 4-lane halves through the lane-wise operations above (so their long dependency chains overlap), in place of a `simd_slerp()` call (with its scalar `atan2f()` & `sinf()`s) & a `method` switch per element.
+// `ratios` is read every `ratioStride` elements: 1 for a ratio per quaternion, or 0 to share `ratios[0]` across all of them.
+// Inputs are expected to be unit-length.  `out` may be the same array as an input (for in-place operation), but must not otherwise overlap one.
+
+/// Runs the statement `...` over an `n`-element batch 8 at a time (see `VUCKT_FOR_EACH_BLOCK8()`), once per 4-lane half with `first` (the half's first index) & `laneCount` (its element count) in scope.
+#define _VUCKT_FLOATQUATERNION_FOR_EACH_HALF_BLOCK8(n, first, laneCount, ...) \
+	VUCKT_FOR_EACH_BLOCK8(n, i, count, { \
+		{ const size_t first = i, laneCount = (count < 4) ? count : 4; __VA_ARGS__; } \
+		if (count > 4) { const size_t first = i + 4, laneCount = count - 4; __VA_ARGS__; } \
+	})
+
+/// `out[i] = interpolateBetween(from[i], to[i], ratio: ratios[i * ratioStride], method: longest ? .longest : .shortest)`
+/// Max error: 3e-7 absolute per component, vs. a double-precision slerp.
+NS_INLINE void FloatQuaternionSlerpArrays(const FloatQuaternion *from, const FloatQuaternion *to, const float *ratios, size_t ratioStride, FloatQuaternion *out, size_t n, bool longest) {
+	_VUCKT_FLOATQUATERNION_FOR_EACH_HALF_BLOCK8(n, first, laneCount, {
+		FloatQuaternionLanes a = FloatQuaternionLanesLoad(from + first, laneCount), b = FloatQuaternionLanesLoad(to + first, laneCount);
+		simd_float4 t = FloatQuaternionLanesLoadRatios(ratios + first * ratioStride, ratioStride, laneCount);
+		FloatQuaternionLanesStore(FloatQuaternionLanesSlerp(a, FloatQuaternionLanesAlign(a, b, longest), t), out + first, laneCount);
+	});
+}
+/// Approximate `FloatQuaternionSlerpArrays()` (along the shorter arc) via corrected nlerp; see `FloatQuaternionLanesSlerpFast()`.
+/// Max error: 4e-4 absolute per component; several times faster.
+NS_INLINE void FloatQuaternionSlerpFastArrays(const FloatQuaternion *from, const FloatQuaternion *to, const float *ratios, size_t ratioStride, FloatQuaternion *out, size_t n) {
+	_VUCKT_FLOATQUATERNION_FOR_EACH_HALF_BLOCK8(n, first, laneCount, {
+		FloatQuaternionLanes a = FloatQuaternionLanesLoad(from + first, laneCount), b = FloatQuaternionLanesLoad(to + first, laneCount);
+		simd_float4 t = FloatQuaternionLanesLoadRatios(ratios + first * ratioStride, ratioStride, laneCount);
+		FloatQuaternionLanesStore(FloatQuaternionLanesSlerpFast(a, FloatQuaternionLanesAlign(a, b, false), t), out + first, laneCount);
+	});
+}
+/// `out[i] = normalize(lerp(from[i], ±to[i], ratios[i * ratioStride]))`, with `to[i]`'s sign chosen for the shorter arc.
+NS_INLINE void FloatQuaternionNlerpArrays(const FloatQuaternion *from, const FloatQuaternion *to, const float *ratios, size_t ratioStride, FloatQuaternion *out, size_t n) {
+	_VUCKT_FLOATQUATERNION_FOR_EACH_HALF_BLOCK8(n, first, laneCount, {
+		FloatQuaternionLanes a = FloatQuaternionLanesLoad(from + first, laneCount), b = FloatQuaternionLanesLoad(to + first, laneCount);
+		simd_float4 t = FloatQuaternionLanesLoadRatios(ratios + first * ratioStride, ratioStride, laneCount);
+		FloatQuaternionLanesStore(FloatQuaternionLanesNlerp(a, FloatQuaternionLanesAlign(a, b, false), t), out + first, laneCount);
+	});
+}
+/// `out[i] = interpolateBetween(q0[i], q1[i], q2[i], q3[i], ratio: ratios[i * ratioStride], method: .bezier)`
+NS_INLINE void FloatQuaternionBezierArrays(const FloatQuaternion *q0, const FloatQuaternion *q1, const FloatQuaternion *q2, const FloatQuaternion *q3, const float *ratios, size_t ratioStride, FloatQuaternion *out, size_t n) {
+	_VUCKT_FLOATQUATERNION_FOR_EACH_HALF_BLOCK8(n, first, laneCount, {
+		simd_float4 t = FloatQuaternionLanesLoadRatios(ratios + first * ratioStride, ratioStride, laneCount);
+		FloatQuaternionLanesStore(FloatQuaternionLanesBezier(
+			FloatQuaternionLanesLoad(q0 + first, laneCount), FloatQuaternionLanesLoad(q1 + first, laneCount), FloatQuaternionLanesLoad(q2 + first, laneCount), FloatQuaternionLanesLoad(q3 + first, laneCount), t
+		), out + first, laneCount);
+	});
+}
+/// `out[i] = interpolateBetween(q0[i], q1[i], q2[i], q3[i], ratio: ratios[i * ratioStride], method: .spline)`, which interpolates from `q1[i]` to `q2[i]`.
+NS_INLINE void FloatQuaternionSplineArrays(const FloatQuaternion *q0, const FloatQuaternion *q1, const FloatQuaternion *q2, const FloatQuaternion *q3, const float *ratios, size_t ratioStride, FloatQuaternion *out, size_t n) {
+	_VUCKT_FLOATQUATERNION_FOR_EACH_HALF_BLOCK8(n, first, laneCount, {
+		simd_float4 t = FloatQuaternionLanesLoadRatios(ratios + first * ratioStride, ratioStride, laneCount);
+		FloatQuaternionLanesStore(FloatQuaternionLanesSpline(
+			FloatQuaternionLanesLoad(q0 + first, laneCount), FloatQuaternionLanesLoad(q1 + first, laneCount), FloatQuaternionLanesLoad(q2 + first, laneCount), FloatQuaternionLanesLoad(q3 + first, laneCount), t
+		), out + first, laneCount);
+	});
+}
+
+
+
+#pragma mark Euler-Angle Conversion
+
+// Rotations to & from Euler angles (radians), rotating about `firstAxis`, then `secondAxis`, then `thirdAxis` (0 = x, 1 = y, 2 = z; e.g. `RotationOrder.zxy` is 2, 0, 1).  See `VucktPlatform.h`'s Euler-angle helpers for how one closed form covers every order.
+
+/// The rotation whose Euler angles' halves have the given sines & cosines: the product of the three axis rotations, `(ck + sk·k)(cj + sj·j)(ci + si·i)`, expanded.
+NS_INLINE FloatQuaternion FloatQuaternionFromEulerHalfAngleSinCos(Float3 sinOfHalfAngles, Float3 cosOfHalfAngles, int firstAxis, int secondAxis, int thirdAxis) {
+	const float s[3] = { sinOfHalfAngles.x, sinOfHalfAngles.y, sinOfHalfAngles.z }, c[3] = { cosOfHalfAngles.x, cosOfHalfAngles.y, cosOfHalfAngles.z };
+	float si = s[firstAxis], sj = s[secondAxis], sk = s[thirdAxis];
+	float ci = c[firstAxis], cj = c[secondAxis], ck = c[thirdAxis];
+	float parity = vuckt_euler_parity(firstAxis, secondAxis);
+	float imaginary[3];
+	imaginary[firstAxis] = si * cj * ck - parity * ci * sj * sk;
+	imaginary[secondAxis] = ci * sj * ck + parity * si * cj * sk;
+	imaginary[thirdAxis] = ci * cj * sk - parity * si * sj * ck;
+	return (FloatQuaternion){ imaginary[0], imaginary[1], imaginary[2], ci * cj * ck + parity * si * sj * sk };
+}
+NS_INLINE FloatQuaternion FloatQuaternionFromEulerAngles(Float3 eulerAngles, int firstAxis, int secondAxis, int thirdAxis) {
+	Float3 sinOfHalfAngles, cosOfHalfAngles;
+	Float3SinCos((Float3){ eulerAngles.x * 0.5f, eulerAngles.y * 0.5f, eulerAngles.z * 0.5f }, &sinOfHalfAngles, &cosOfHalfAngles);
+	return FloatQuaternionFromEulerHalfAngleSinCos(sinOfHalfAngles, cosOfHalfAngles, firstAxis, secondAxis, thirdAxis);
+}
+/// `FloatQuaternionFromEulerAngles()`, with the sines & cosines from `Float3SinCosFast()`.
+NS_INLINE FloatQuaternion FloatQuaternionFromEulerAnglesFast(Float3 eulerAngles, int firstAxis, int secondAxis, int thirdAxis) {
+	Float3 sinOfHalfAngles, cosOfHalfAngles;
+	Float3SinCosFast((Float3){ eulerAngles.x * 0.5f, eulerAngles.y * 0.5f, eulerAngles.z * 0.5f }, &sinOfHalfAngles, &cosOfHalfAngles);
+	return FloatQuaternionFromEulerHalfAngleSinCos(sinOfHalfAngles, cosOfHalfAngles, firstAxis, secondAxis, thirdAxis);
+}
+
+/// The Euler angles of unit-length `q`, which `FloatQuaternionFromEulerAngles()` turns back into `q` (or `-q`).
+NS_INLINE Float3 FloatQuaternionToEulerAngles(FloatQuaternion q, int firstAxis, int secondAxis, int thirdAxis) {
+	// `q`'s rotation matrix with its axes relabeled, which also negates the imaginary part for an odd relabeling.
+	float parity = vuckt_euler_parity(firstAxis, secondAxis);
+	const float imaginary[3] = { q.ix, q.iy, q.iz };
+	float x = parity * imaginary[firstAxis], y = parity * imaginary[secondAxis], z = parity * imaginary[thirdAxis], w = q.r;
+	const float r[3][3] = {
+		{ 1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y - w * z), 2.0f * (x * z + w * y) },
+		{ 2.0f * (x * y + w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z - w * x) },
+		{ 2.0f * (x * z - w * y), 2.0f * (y * z + w * x), 1.0f - 2.0f * (x * x + y * y) },
+	};
+	float angles[3];
+	vuckt_euler_angles_from_rotation(r, firstAxis, secondAxis, thirdAxis, angles);
+	return (Float3){ angles[0], angles[1], angles[2] };
+}
+
+/// `out[i] = FloatQuaternionFromEulerAngles(eulerAngles[i], firstAxis, secondAxis, thirdAxis)`, taking the sines & cosines of 8 elements at a time, as two 4-lane halves, with `Float3SinCosLanes()`.
+/// `out` must not overlap `eulerAngles`.
+NS_INLINE void FloatQuaternionFromEulerAnglesArray(const Float3 *eulerAngles, FloatQuaternion *out, size_t n, int firstAxis, int secondAxis, int thirdAxis) {
+	_VUCKT_FLOATQUATERNION_FOR_EACH_HALF_BLOCK8(n, first, laneCount, {
+		simd_float4 sinOfHalfAngles[3], cosOfHalfAngles[3];
+		Float3SinCosLanes(eulerAngles + first, laneCount, 0.5f, sinOfHalfAngles, cosOfHalfAngles);
+		for (size_t laneI = 0; laneI < laneCount; ++laneI) {
+			out[first + laneI] = FloatQuaternionFromEulerHalfAngleSinCos(
+				(Float3){ sinOfHalfAngles[0][laneI], sinOfHalfAngles[1][laneI], sinOfHalfAngles[2][laneI] },
+				(Float3){ cosOfHalfAngles[0][laneI], cosOfHalfAngles[1][laneI], cosOfHalfAngles[2][laneI] },
+				firstAxis, secondAxis, thirdAxis
+			);
+		}
+	});
+}
+
+
+
+#if __OBJC__ && TARGET_OS_MAC
 	#pragma mark SceneKit Conversion
 
 	/// Converts a `FloatQuaternion` struct to `SCNQuaternion` struct using SceneKit-provided SIMD↔SCNVector conversion helper function.
@@ -63,7 +365,7 @@ NS_INLINE FloatQuaternion FloatQuaternionFromSimd(simd_quatf simdValue) {
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 	#pragma mark GLKit Conversion
 
 	/// Converts a `FloatQuaternion` struct to `GLKQuaternion` struct using passing-individual-members initialization.
@@ -74,11 +376,11 @@ NS_INLINE FloatQuaternion FloatQuaternionFromSimd(simd_quatf simdValue) {
 	NS_INLINE FloatQuaternion FloatQuaternionFromGLK(GLKQuaternion glkValue) {
 		return (FloatQuaternion){ glkValue.q[0], glkValue.q[1], glkValue.q[2], glkValue.q[3] };
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH && !TARGET_OS_VISION
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_TV
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_TV
 	#pragma mark CoreMotion Conversion
 
 	/// Converts a `FloatQuaternion` struct to `CMQuaternion` struct using passing-individual-members initialization.
@@ -89,11 +391,11 @@ NS_INLINE FloatQuaternion FloatQuaternionFromSimd(simd_quatf simdValue) {
 	NS_INLINE FloatQuaternion FloatQuaternionFromCM(CMQuaternion cmValue) {
 		return (FloatQuaternion){ (float)cmValue.x, (float)cmValue.y, (float)cmValue.z, (float)cmValue.w };
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_TV
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_TV
 
 
 
-#if TARGET_OS_MAC && !TARGET_OS_WATCH
+#if __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 	#pragma mark GameController Conversion
 
 	/// Converts a `FloatQuaternion` struct to `GCQuaternion` struct using passing-individual-members initialization.
@@ -104,10 +406,11 @@ NS_INLINE FloatQuaternion FloatQuaternionFromSimd(simd_quatf simdValue) {
 	NS_INLINE FloatQuaternion FloatQuaternionFromGC(GCQuaternion gcValue) {
 		return (FloatQuaternion){ (float)gcValue.x, (float)gcValue.y, (float)gcValue.z, (float)gcValue.w };
 	}
-#endif // TARGET_OS_MAC && !TARGET_OS_WATCH
+#endif // __OBJC__ && TARGET_OS_MAC && !TARGET_OS_WATCH
 
 
 
+#if __OBJC__
 #pragma mark `NSValue`-Wrapping
 
 @interface NSValue (FloatQuaternionAdditions)
@@ -117,7 +420,9 @@ NS_INLINE FloatQuaternion FloatQuaternionFromSimd(simd_quatf simdValue) {
 @property(nonatomic, readonly) FloatQuaternion floatQuaternionValue;
 
 @end
+#endif // __OBJC__
 
 
 
+VUCKT_DIAGNOSTICS_END
 NS_ASSUME_NONNULL_END
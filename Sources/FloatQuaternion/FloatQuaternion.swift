@@ -3,7 +3,14 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
 import Foundation
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
 #if canImport(SceneKit)
 	import SceneKit.SceneKitTypes
 #endif
@@ -19,25 +26,8 @@ import simd
 
 
 
-fileprivate let SquareRootOfOneHalf = Float(0.5).squareRoot()
-
-fileprivate func simdSinAndCosFuncs() -> (sin: (_: simd_float3) -> simd_float3, cos: (_: simd_float3) -> simd_float3) {
-	let sin: (_: simd_float3) -> simd_float3
-	let cos: (_: simd_float3) -> simd_float3
-	#if canImport(Darwin)
-		if #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, visionOS 1.0, *) {
-			sin = simd.sin
-			cos = simd.cos
-		} else {
-			sin = __tg_sin
-			cos = __tg_cos
-		}
-	#else
-		sin = simd.sin
-		cos = simd.cos
-	#endif
-	return (sin, cos)
-}
+/// `√½` (the sine & cosine of 45°), as a literal so the presets below fold to constants.
+@_transparent @usableFromInline internal var SquareRootOfOneHalf:Float { return 0.70710678118654752440 }
 
 
 
@@ -78,19 +68,19 @@ extension FloatQuaternion
 	
 	// MARK: commonly-used “presets”
 	
-	public static let identity = FloatQuaternion(0, 0, 0, 1)
+	@_transparent public static var identity:FloatQuaternion { return FloatQuaternion(0, 0, 0, 1) }
 	
-	public static let rotation90AroundX = FloatQuaternion(SquareRootOfOneHalf, 0, 0, SquareRootOfOneHalf)
-	public static let rotation90AroundY = FloatQuaternion(0, SquareRootOfOneHalf, 0, SquareRootOfOneHalf)
-	public static let rotation90AroundZ = FloatQuaternion(0, 0, SquareRootOfOneHalf, SquareRootOfOneHalf)
+	@_transparent public static var rotation90AroundX:FloatQuaternion { return FloatQuaternion(SquareRootOfOneHalf, 0, 0, SquareRootOfOneHalf) }
+	@_transparent public static var rotation90AroundY:FloatQuaternion { return FloatQuaternion(0, SquareRootOfOneHalf, 0, SquareRootOfOneHalf) }
+	@_transparent public static var rotation90AroundZ:FloatQuaternion { return FloatQuaternion(0, 0, SquareRootOfOneHalf, SquareRootOfOneHalf) }
 	
-	public static let rotation180AroundX = FloatQuaternion(1, 0, 0, 0)
-	public static let rotation180AroundY = FloatQuaternion(0, 1, 0, 0)
-	public static let rotation180AroundZ = FloatQuaternion(0, 0, 1, 0)
+	@_transparent public static var rotation180AroundX:FloatQuaternion { return FloatQuaternion(1, 0, 0, 0) }
+	@_transparent public static var rotation180AroundY:FloatQuaternion { return FloatQuaternion(0, 1, 0, 0) }
+	@_transparent public static var rotation180AroundZ:FloatQuaternion { return FloatQuaternion(0, 0, 1, 0) }
 	
-	public static let rotation270AroundX = FloatQuaternion(-SquareRootOfOneHalf, 0, 0, SquareRootOfOneHalf)
-	public static let rotation270AroundY = FloatQuaternion(0, -SquareRootOfOneHalf, 0, SquareRootOfOneHalf)
-	public static let rotation270AroundZ = FloatQuaternion(0, 0, -SquareRootOfOneHalf, SquareRootOfOneHalf)
+	@_transparent public static var rotation270AroundX:FloatQuaternion { return FloatQuaternion(-SquareRootOfOneHalf, 0, 0, SquareRootOfOneHalf) }
+	@_transparent public static var rotation270AroundY:FloatQuaternion { return FloatQuaternion(0, -SquareRootOfOneHalf, 0, SquareRootOfOneHalf) }
+	@_transparent public static var rotation270AroundZ:FloatQuaternion { return FloatQuaternion(0, 0, -SquareRootOfOneHalf, SquareRootOfOneHalf) }
 	
 	
 	
@@ -207,30 +197,16 @@ extension FloatQuaternion
 		set { self = FloatQuaternion(angle: newValue.0, axis: newValue.1) }
 	}
 	
-	public init(eulerAngles eulerAngles_radians:Float3, order:RotationOrder = .zxy) {
-		let (sin, cos) = simdSinAndCosFuncs()
-		
-		let sinOfHalfAngles: simd_float3 = sin(eulerAngles_radians.simdValue * 0.5)
-		let cosOfHalfAngles: simd_float3 = cos(eulerAngles_radians.simdValue * 0.5)
-		
-		let xRotation = Self(sinOfHalfAngles.x, 0, 0, cosOfHalfAngles.x)
-		let yRotation = Self(0, sinOfHalfAngles.y, 0, cosOfHalfAngles.y)
-		let zRotation = Self(0, 0, sinOfHalfAngles.z, cosOfHalfAngles.z)
-		let rotationsInOrder:[Self] = {
-			switch order {
-				case .xyz: return [ xRotation, yRotation, zRotation ]
-				case .xzy: return [ xRotation, zRotation, yRotation ]
-				case .yxz: return [ yRotation, xRotation, zRotation ]
-				case .yzx: return [ yRotation, zRotation, xRotation ]
-				case .zxy: return [ zRotation, xRotation, yRotation ]
-				case .zyx: return [ zRotation, yRotation, xRotation ]
-			}
-		}()
-		
-		self = rotationsInOrder[2] * rotationsInOrder[1] * rotationsInOrder[0]
+	/// Computes the rotation in closed form for `order` (see `FloatQuaternionFromEulerAngles()`), with no intermediate axis rotations.  With `precision: .fast`, computes the half-angles' sines & cosines with `Float3SinCosFast()`.
+	@_transparent public init(eulerAngles eulerAngles_radians:Float3, order:RotationOrder = .zxy, precision:MathPrecision = .full) {
+		let axes = order.axisIndices
+		switch precision {
+			case .full: self = FloatQuaternionFromEulerAngles(eulerAngles_radians, axes.first, axes.second, axes.third)
+			case .fast: self = FloatQuaternionFromEulerAnglesFast(eulerAngles_radians, axes.first, axes.second, axes.third)
+		}
 	}
 	@available(macOS 10.12, iOS 10.10, tvOS 10.10, watchOS 3.0, *)
-	@_transparent public init(eulerAngles eulerAnglesMeasurements:(x:Measurement<UnitAngle>,y:Measurement<UnitAngle>,z:Measurement<UnitAngle>), order:RotationOrder = .zxy) {
+	@_transparent public init(eulerAngles eulerAnglesMeasurements:(x:Measurement<UnitAngle>,y:Measurement<UnitAngle>,z:Measurement<UnitAngle>), order:RotationOrder = .zxy, precision:MathPrecision = .full) {
 		let eulerAnglesMeasurements_radians = (
 			x: eulerAnglesMeasurements.x.converted(to: .radians),
 			y: eulerAnglesMeasurements.y.converted(to: .radians),
@@ -242,10 +218,17 @@ extension FloatQuaternion
 				Float(eulerAnglesMeasurements_radians.y.value),
 				Float(eulerAnglesMeasurements_radians.z.value)
 			),
-			order: order
+			order: order,
+			precision: precision
 		)
 	}
 	
+	/// The Euler angles (radians) that `init(eulerAngles:order:)` turns back into this unit-length rotation (or its negation).  The second-rotated axis' angle is in [ -π/2, π/2 ], the others in [ -π, π ].
+	@_transparent public func eulerAngles(order:RotationOrder = .zxy) -> Float3 {
+		let axes = order.axisIndices
+		return FloatQuaternionToEulerAngles(self, axes.first, axes.second, axes.third)
+	}
+	
 	
 	// MARK: From-To Initializer
 	
@@ -479,11 +462,28 @@ extension FloatQuaternion // Quaternion Math Operations
 	@_transparent public mutating func normalize() {
 		self = self.normalized()
 	}
+	/// With `.fast`, uses `FloatQuaternionNormalizeFast()`.
+	@_transparent public func normalized(precision:MathPrecision) -> FloatQuaternion {
+		switch precision {
+			case .full: return self.normalized()
+			case .fast: return FloatQuaternionNormalizeFast(self)
+		}
+	}
+	@_transparent public mutating func normalize(precision:MathPrecision) {
+		self = self.normalized(precision: precision)
+	}
 	
 	
 	@_transparent public func length() -> Float {
 		return simd_length(self.simdValue)
 	}
+	/// With `.fast`, uses `FloatQuaternionLengthFast()`.
+	@_transparent public func length(precision:MathPrecision) -> Float {
+		switch precision {
+			case .full: return self.length()
+			case .fast: return FloatQuaternionLengthFast(self)
+		}
+	}
 	@_transparent public func magnitude() -> Float { return self.length() }
 	
 	
@@ -538,6 +538,135 @@ extension FloatQuaternion // Quaternion Math Operations
 }
 
 
+// MARK: Batch Interpolation
+
+// Array forms of `interpolateBetween()` (& nlerp), for blending many rotations at once (e.g. a skeleton's bones each frame); each evaluates 4 quaternions at a time in the C backend.
+// Inputs should be unit-length; `out` may be the memory of one of the inputs, but must not otherwise overlap one.
+
+/// Element-wise `interpolateBetween(a[i], b[i], ratio: ratios[i], method: method)`, written to `out`.  (All buffers must have the same count.)
+/// With `precision: .fast`, `.shortest` uses a polynomial-corrected nlerp instead (max error 4e-4 per component, several times faster); `.longest` always uses the full slerp.
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, ratios:UnsafeBufferPointer<Float>, into out:UnsafeMutableBufferPointer<FloatQuaternion>, method:FloatQuaternion.SphericalLinearInterpolationMethod = .shortest, precision:MathPrecision = .full) {
+	precondition(ratios.count == a.count, "Bulk operation buffers must all have the same count.")
+	guard a.count > 0 else { return }
+	_vucktSlerpArrays(a, b, ratios.baseAddress!, 1, into: out, method: method, precision: precision)
+}
+/// Element-wise `interpolateBetween(a[i], b[i], ratio: ratio, method: method)`, written to `out`.  (All buffers must have the same count.)
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, ratio:Float, into out:UnsafeMutableBufferPointer<FloatQuaternion>, method:FloatQuaternion.SphericalLinearInterpolationMethod = .shortest, precision:MathPrecision = .full) {
+	withUnsafePointer(to: ratio){ _vucktSlerpArrays(a, b, $0, 0, into: out, method: method, precision: precision) }
+}
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:[FloatQuaternion], _ b:[FloatQuaternion], ratios:[Float], method:FloatQuaternion.SphericalLinearInterpolationMethod = .shortest, precision:MathPrecision = .full) -> [FloatQuaternion] {
+	return _vucktBatchInterpolationResult(count: a.count){ out in
+		a.withUnsafeBufferPointer{ a in b.withUnsafeBufferPointer{ b in ratios.withUnsafeBufferPointer{ ratios in
+			interpolateBetween(a, b, ratios: ratios, into: out, method: method, precision: precision)
+		} } }
+	}
+}
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:[FloatQuaternion], _ b:[FloatQuaternion], ratio:Float, method:FloatQuaternion.SphericalLinearInterpolationMethod = .shortest, precision:MathPrecision = .full) -> [FloatQuaternion] {
+	return _vucktBatchInterpolationResult(count: a.count){ out in
+		a.withUnsafeBufferPointer{ a in b.withUnsafeBufferPointer{ b in
+			interpolateBetween(a, b, ratio: ratio, into: out, method: method, precision: precision)
+		} }
+	}
+}
+
+/// Element-wise normalized linear interpolation from `a[i]` to `b[i]` (negated if needed to take the shorter arc) by `ratios[i]`, written to `out`: cheaper than slerp, but only constant-speed at the ends & midpoint.  (All buffers must have the same count.)
+@_alwaysEmitIntoClient public func normalizedLinearInterpolateBetween(_ a:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, ratios:UnsafeBufferPointer<Float>, into out:UnsafeMutableBufferPointer<FloatQuaternion>) {
+	precondition(ratios.count == a.count, "Bulk operation buffers must all have the same count.")
+	guard a.count > 0 else { return }
+	_vucktInterpolationArrays(a, b, ratios.baseAddress!, 1, into: out, FloatQuaternionNlerpArrays)
+}
+@_alwaysEmitIntoClient public func normalizedLinearInterpolateBetween(_ a:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, ratio:Float, into out:UnsafeMutableBufferPointer<FloatQuaternion>) {
+	withUnsafePointer(to: ratio){ _vucktInterpolationArrays(a, b, $0, 0, into: out, FloatQuaternionNlerpArrays) }
+}
+@_alwaysEmitIntoClient public func normalizedLinearInterpolateBetween(_ a:[FloatQuaternion], _ b:[FloatQuaternion], ratios:[Float]) -> [FloatQuaternion] {
+	return _vucktBatchInterpolationResult(count: a.count){ out in
+		a.withUnsafeBufferPointer{ a in b.withUnsafeBufferPointer{ b in ratios.withUnsafeBufferPointer{ ratios in
+			normalizedLinearInterpolateBetween(a, b, ratios: ratios, into: out)
+		} } }
+	}
+}
+@_alwaysEmitIntoClient public func normalizedLinearInterpolateBetween(_ a:[FloatQuaternion], _ b:[FloatQuaternion], ratio:Float) -> [FloatQuaternion] {
+	return _vucktBatchInterpolationResult(count: a.count){ out in
+		a.withUnsafeBufferPointer{ a in b.withUnsafeBufferPointer{ b in
+			normalizedLinearInterpolateBetween(a, b, ratio: ratio, into: out)
+		} }
+	}
+}
+
+/// Element-wise `interpolateBetween(a[i], control1[i], control2[i], b[i], ratio: ratios[i], method: method)`, written to `out`.  (All buffers must have the same count.)
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:UnsafeBufferPointer<FloatQuaternion>, _ control1:UnsafeBufferPointer<FloatQuaternion>, _ control2:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, ratios:UnsafeBufferPointer<Float>, into out:UnsafeMutableBufferPointer<FloatQuaternion>, method:FloatQuaternion.SphericalCubicInterpolationMethod) {
+	precondition(ratios.count == a.count, "Bulk operation buffers must all have the same count.")
+	guard a.count > 0 else { return }
+	_vucktCubicInterpolationArrays(a, control1, control2, b, ratios.baseAddress!, 1, into: out, method: method)
+}
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:UnsafeBufferPointer<FloatQuaternion>, _ control1:UnsafeBufferPointer<FloatQuaternion>, _ control2:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, ratio:Float, into out:UnsafeMutableBufferPointer<FloatQuaternion>, method:FloatQuaternion.SphericalCubicInterpolationMethod) {
+	withUnsafePointer(to: ratio){ _vucktCubicInterpolationArrays(a, control1, control2, b, $0, 0, into: out, method: method) }
+}
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:[FloatQuaternion], _ control1:[FloatQuaternion], _ control2:[FloatQuaternion], _ b:[FloatQuaternion], ratios:[Float], method:FloatQuaternion.SphericalCubicInterpolationMethod) -> [FloatQuaternion] {
+	return _vucktBatchInterpolationResult(count: a.count){ out in
+		a.withUnsafeBufferPointer{ a in control1.withUnsafeBufferPointer{ control1 in control2.withUnsafeBufferPointer{ control2 in b.withUnsafeBufferPointer{ b in ratios.withUnsafeBufferPointer{ ratios in
+			interpolateBetween(a, control1, control2, b, ratios: ratios, into: out, method: method)
+		} } } } }
+	}
+}
+@_alwaysEmitIntoClient public func interpolateBetween(_ a:[FloatQuaternion], _ control1:[FloatQuaternion], _ control2:[FloatQuaternion], _ b:[FloatQuaternion], ratio:Float, method:FloatQuaternion.SphericalCubicInterpolationMethod) -> [FloatQuaternion] {
+	return _vucktBatchInterpolationResult(count: a.count){ out in
+		a.withUnsafeBufferPointer{ a in control1.withUnsafeBufferPointer{ control1 in control2.withUnsafeBufferPointer{ control2 in b.withUnsafeBufferPointer{ b in
+			interpolateBetween(a, control1, control2, b, ratio: ratio, into: out, method: method)
+		} } } }
+	}
+}
+
+@usableFromInline internal func _vucktInterpolationArrays(_ a:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, into out:UnsafeMutableBufferPointer<FloatQuaternion>, _ operation:(UnsafePointer<FloatQuaternion>, UnsafePointer<FloatQuaternion>, UnsafePointer<Float>, Int, UnsafeMutablePointer<FloatQuaternion>, Int) -> Void) {
+	precondition(b.count == a.count && out.count == a.count, "Bulk operation buffers must all have the same count.")
+	guard a.count > 0 else { return }
+	operation(a.baseAddress!, b.baseAddress!, ratios, ratioStride, out.baseAddress!, a.count)
+}
+
+@usableFromInline internal func _vucktSlerpArrays(_ a:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, into out:UnsafeMutableBufferPointer<FloatQuaternion>, method:FloatQuaternion.SphericalLinearInterpolationMethod, precision:MathPrecision) {
+	switch (method, precision) {
+		case (.shortest, .full):
+			_vucktInterpolationArrays(a, b, ratios, ratioStride, into: out){ FloatQuaternionSlerpArrays($0, $1, $2, $3, $4, $5, false) }
+		case (.shortest, .fast):
+			_vucktInterpolationArrays(a, b, ratios, ratioStride, into: out, FloatQuaternionSlerpFastArrays)
+		case (.longest, _):
+			_vucktInterpolationArrays(a, b, ratios, ratioStride, into: out){ FloatQuaternionSlerpArrays($0, $1, $2, $3, $4, $5, true) }
+	}
+}
+
+@usableFromInline internal func _vucktCubicInterpolationArrays(_ a:UnsafeBufferPointer<FloatQuaternion>, _ control1:UnsafeBufferPointer<FloatQuaternion>, _ control2:UnsafeBufferPointer<FloatQuaternion>, _ b:UnsafeBufferPointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, into out:UnsafeMutableBufferPointer<FloatQuaternion>, method:FloatQuaternion.SphericalCubicInterpolationMethod) {
+	precondition(control1.count == a.count && control2.count == a.count && b.count == a.count && out.count == a.count, "Bulk operation buffers must all have the same count.")
+	guard a.count > 0 else { return }
+	switch method {
+		case .bezier:
+			FloatQuaternionBezierArrays(a.baseAddress!, control1.baseAddress!, control2.baseAddress!, b.baseAddress!, ratios, ratioStride, out.baseAddress!, a.count)
+		case .spline:
+			FloatQuaternionSplineArrays(a.baseAddress!, control1.baseAddress!, control2.baseAddress!, b.baseAddress!, ratios, ratioStride, out.baseAddress!, a.count)
+	}
+}
+
+@usableFromInline internal func _vucktBatchInterpolationResult(count:Int, _ body:(UnsafeMutableBufferPointer<FloatQuaternion>) -> Void) -> [FloatQuaternion] {
+	return Array(unsafeUninitializedCapacity: count) { outBuffer, initializedCount in
+		body(UnsafeMutableBufferPointer(rebasing: outBuffer[0..<count]))
+		initializedCount = count
+	}
+}
+
+
+extension FloatQuaternion // Batch Euler-Angle Conversion
+{
+	/// The rotation for each of `eulerAngles` (as `init(eulerAngles:order:)`), written to `out`, taking the sines & cosines of 4 elements at a time.  (Both buffers must have the same count.)
+	@_alwaysEmitIntoClient public static func fromEulerAngles(_ eulerAngles:UnsafeBufferPointer<Float3>, order:RotationOrder = .zxy, into out:UnsafeMutableBufferPointer<FloatQuaternion>) {
+		let axes = order.axisIndices
+		eulerAngles._vucktBulkConversion(into: out){ FloatQuaternionFromEulerAnglesArray($0, $1, $2, axes.first, axes.second, axes.third) }
+	}
+	@_alwaysEmitIntoClient public static func fromEulerAngles(_ eulerAngles:[Float3], order:RotationOrder = .zxy) -> [FloatQuaternion] {
+		let axes = order.axisIndices
+		return eulerAngles._vucktBulkConversion{ FloatQuaternionFromEulerAnglesArray($0, $1, $2, axes.first, axes.second, axes.third) }
+	}
+}
+
+
 extension FloatQuaternion : Hashable
 {
 	private static let _hashingLargePrimes:[UInt] = [ 982_917_223, 3_572_352_083, 4_259_235_067, 454_923_701 ]
@@ -2,7 +2,11 @@
 // @author: Slipp Douglas Thompson
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
 #if canImport(SceneKit)
 	import SceneKit.SceneKitTypes
 #endif
@@ -54,6 +58,80 @@ public struct FloatQuaternion
 
 
 
+// MARK: Fast-Approximate Math
+
+/// The Swift backend has no estimate instructions to build on, so these use the full-precision operations (trivially meeting the C backend's error bounds).
+@_alwaysEmitIntoClient public func FloatQuaternionNormalizeFast(_ q:FloatQuaternion) -> FloatQuaternion {
+	return FloatQuaternionFromSimd(simd_normalize(FloatQuaternionToSimd(q)))
+}
+@_alwaysEmitIntoClient public func FloatQuaternionLengthFast(_ q:FloatQuaternion) -> Float {
+	return simd_length(FloatQuaternionToSimd(q))
+}
+
+
+
+// MARK: Batched Interpolation
+
+@_alwaysEmitIntoClient public func FloatQuaternionSlerpArrays(_ from:UnsafePointer<FloatQuaternion>, _ to:UnsafePointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, _ out:UnsafeMutablePointer<FloatQuaternion>, _ n:Int, _ longest:Bool) {
+	for i in 0..<n {
+		let (a, b, t) = (FloatQuaternionToSimd(from[i]), FloatQuaternionToSimd(to[i]), ratios[i * ratioStride])
+		out[i] = FloatQuaternionFromSimd(longest ? simd_slerp_longest(a, b, t) : simd_slerp(a, b, t))
+	}
+}
+/// The Swift backend uses the full slerp here (trivially meeting the C backend's error bound).
+@_alwaysEmitIntoClient public func FloatQuaternionSlerpFastArrays(_ from:UnsafePointer<FloatQuaternion>, _ to:UnsafePointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, _ out:UnsafeMutablePointer<FloatQuaternion>, _ n:Int) {
+	FloatQuaternionSlerpArrays(from, to, ratios, ratioStride, out, n, false)
+}
+@_alwaysEmitIntoClient public func FloatQuaternionNlerpArrays(_ from:UnsafePointer<FloatQuaternion>, _ to:UnsafePointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, _ out:UnsafeMutablePointer<FloatQuaternion>, _ n:Int) {
+	for i in 0..<n {
+		let (a, t) = (FloatQuaternionToSimd(from[i]).vector, ratios[i * ratioStride])
+		var b = FloatQuaternionToSimd(to[i]).vector
+		if simd_dot(a, b) < 0 {
+			b = -b
+		}
+		out[i] = FloatQuaternionFromSimd(simd_quatf(vector: simd_normalize(a + (b - a) * t)))
+	}
+}
+@_alwaysEmitIntoClient public func FloatQuaternionBezierArrays(_ q0:UnsafePointer<FloatQuaternion>, _ q1:UnsafePointer<FloatQuaternion>, _ q2:UnsafePointer<FloatQuaternion>, _ q3:UnsafePointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, _ out:UnsafeMutablePointer<FloatQuaternion>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = FloatQuaternionFromSimd(simd_bezier(FloatQuaternionToSimd(q0[i]), FloatQuaternionToSimd(q1[i]), FloatQuaternionToSimd(q2[i]), FloatQuaternionToSimd(q3[i]), ratios[i * ratioStride]))
+	}
+}
+@_alwaysEmitIntoClient public func FloatQuaternionSplineArrays(_ q0:UnsafePointer<FloatQuaternion>, _ q1:UnsafePointer<FloatQuaternion>, _ q2:UnsafePointer<FloatQuaternion>, _ q3:UnsafePointer<FloatQuaternion>, _ ratios:UnsafePointer<Float>, _ ratioStride:Int, _ out:UnsafeMutablePointer<FloatQuaternion>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = FloatQuaternionFromSimd(simd_spline(FloatQuaternionToSimd(q0[i]), FloatQuaternionToSimd(q1[i]), FloatQuaternionToSimd(q2[i]), FloatQuaternionToSimd(q3[i]), ratios[i * ratioStride]))
+	}
+}
+
+
+
+// MARK: Euler-Angle Conversion
+
+/// The Swift backend composes the three axis rotations rather than using the C backend's closed form.
+@_alwaysEmitIntoClient public func FloatQuaternionFromEulerAngles(_ eulerAngles:Float3, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) -> FloatQuaternion {
+	let angles = Float3ToSimd(eulerAngles)
+	func axisRotation(_ axisIndex:Int32) -> simd_quatf {
+		var axis = simd_float3()
+		axis[Int(axisIndex)] = 1
+		return simd_quatf(angle: angles[Int(axisIndex)], axis: axis)
+	}
+	return FloatQuaternionFromSimd(axisRotation(thirdAxis) * axisRotation(secondAxis) * axisRotation(firstAxis))
+}
+/// The Swift backend uses the full-precision sines & cosines here (trivially meeting the C backend's error bounds).
+@_alwaysEmitIntoClient public func FloatQuaternionFromEulerAnglesFast(_ eulerAngles:Float3, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) -> FloatQuaternion {
+	return FloatQuaternionFromEulerAngles(eulerAngles, firstAxis, secondAxis, thirdAxis)
+}
+@_alwaysEmitIntoClient public func FloatQuaternionToEulerAngles(_ q:FloatQuaternion, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) -> Float3 {
+	return Float3x3ToEulerAngles(Float3x3FromSimd(simd_float3x3(FloatQuaternionToSimd(q))), firstAxis, secondAxis, thirdAxis)
+}
+@_alwaysEmitIntoClient public func FloatQuaternionFromEulerAnglesArray(_ eulerAngles:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<FloatQuaternion>, _ n:Int, _ firstAxis:Int32, _ secondAxis:Int32, _ thirdAxis:Int32) {
+	for i in 0..<n {
+		out[i] = FloatQuaternionFromEulerAngles(eulerAngles[i], firstAxis, secondAxis, thirdAxis)
+	}
+}
+
+
+
 #if canImport(SceneKit)
 	// MARK: SceneKit Conversion
 
@@ -0,0 +1,178 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float4.h>)
+	#import <Vuckt/Float4.h>
+#else
+	#include "../Float4/Float4.h"
+#endif
+#if __has_include(<Vuckt/Float4x4.h>)
+	#import <Vuckt/Float4x4.h>
+#else
+	#include "../Float4x4/Float4x4.h"
+#endif
+#if __has_include(<Vuckt/AABB3.h>)
+	#import <Vuckt/AABB3.h>
+#else
+	#include "../AABB3/AABB3.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#include <stdint.h>
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// The six planes bounding a view volume, each as `(a, b, c, d)` for the plane `a·x + b·y + c·z + d = 0`, with its unit normal `(a, b, c)` pointing inward— so a point's signed distance inside each plane is `dot(plane.xyz, point) + plane.w`.
+struct Frustum {
+	Float4 left;
+	Float4 right;
+	Float4 bottom;
+	Float4 top;
+	Float4 near;
+	Float4 far;
+};
+typedef struct Frustum Frustum;
+
+// Classification codes written by `FrustumClassifyAABB3()` & `FrustumClassifyAABB3Array()` (matching the Swift `FrustumContainment` enum's raw values).
+//	0: outside— entirely behind at least one plane, or empty (`AABB3IsEmpty()`).
+//	1: intersecting— straddling at least one plane (or, rarely, outside but near a corner of the frustum, where the plane-by-plane test is conservative).
+//	2: inside— entirely in front of all six planes.
+
+
+
+#pragma mark Plane Extraction
+
+/// The planes of the view volume of the view-projection matrix `viewProjection` (Gribb & Hartmann's method, from sums & differences of its rows), normalized, in the space `viewProjection` transforms from— world space, for a view-projection matrix.
+/// `zeroToOneDepth` selects the clip-space depth range the projection maps to: [ 0, 1 ] (Metal, Direct3D, & Vulkan) if set, else [ −1, 1 ] (OpenGL).
+NS_INLINE Frustum FrustumFromViewProjection(Float4x4 viewProjection, bool zeroToOneDepth) {
+	Float4x4 m = viewProjection;
+	simd_float4 row0 = { m.m00, m.m10, m.m20, m.m30 };
+	simd_float4 row1 = { m.m01, m.m11, m.m21, m.m31 };
+	simd_float4 row2 = { m.m02, m.m12, m.m22, m.m32 };
+	simd_float4 row3 = { m.m03, m.m13, m.m23, m.m33 };
+	simd_float4 planes[6] = { row3 + row0, row3 - row0, row3 + row1, row3 - row1, (zeroToOneDepth ? row2 : row3 + row2), row3 - row2 };
+	Float4 normalizedPlanes[6];
+	for (size_t planeI = 0; planeI < 6; ++planeI) {
+		simd_float4 plane = planes[planeI];
+		plane *= 1.0f / vuckt_sqrtf(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+		normalizedPlanes[planeI] = Float4FromSimd(plane);
+	}
+	return (Frustum){ normalizedPlanes[0], normalizedPlanes[1], normalizedPlanes[2], normalizedPlanes[3], normalizedPlanes[4], normalizedPlanes[5] };
+}
+
+
+
+#pragma mark AABB3 Culling
+
+// Each box is tested as its center & extents against each plane: its center's signed distance `d`, & its projected radius `r = dot(abs(plane.xyz), extents)`, put it outside the plane if `d < -r`, or straddling it if `d < r`.
+// Empty boxes start out outside (from `AABB3Lanes.emptyMask`), since their NaN centers would otherwise fail every comparison & pass as inside.
+// The batch kernels run 8 boxes per iteration, as two 4-lane `AABB3Lanes` (so each plane test is a handful of vector multiply-adds across 4 boxes) with the plane constants broadcast once for the whole batch.
+
+/// Per lane, the classification code (see above) of each of `boxes` against the 6 planes broadcast into `planeX`…`planeW` (with `planeAbsX`…`planeAbsZ` their normals' absolute values).
+NS_INLINE simd_int4 FrustumClassifyAABB3Lanes(const simd_float4 planeX[6], const simd_float4 planeY[6], const simd_float4 planeZ[6], const simd_float4 planeW[6], const simd_float4 planeAbsX[6], const simd_float4 planeAbsY[6], const simd_float4 planeAbsZ[6], AABB3Lanes boxes) {
+	simd_int4 outsideMask = boxes.emptyMask, straddlingMask = boxes.emptyMask;
+	for (size_t planeI = 0; planeI < 6; ++planeI) {
+		simd_float4 distance = planeX[planeI] * boxes.centerX + planeY[planeI] * boxes.centerY + planeZ[planeI] * boxes.centerZ + planeW[planeI];
+		simd_float4 radius = planeAbsX[planeI] * boxes.extentX + planeAbsY[planeI] * boxes.extentY + planeAbsZ[planeI] * boxes.extentZ;
+		outsideMask |= (distance + radius < 0);
+		straddlingMask |= (distance - radius < 0);
+	}
+	// The masks are all-ones (-1) where set, & outside implies straddling, so this is 2, 1, or 0.
+	return 2 + straddlingMask + outsideMask;
+}
+/// Per lane, all-ones if that box is outside the planes (as `FrustumClassifyAABB3Lanes()` would code it 0), else 0; for the culling kernels, which needn't tell straddling boxes from inside ones.
+NS_INLINE simd_int4 FrustumAABB3LanesOutsideMask(const simd_float4 planeX[6], const simd_float4 planeY[6], const simd_float4 planeZ[6], const simd_float4 planeW[6], const simd_float4 planeAbsX[6], const simd_float4 planeAbsY[6], const simd_float4 planeAbsZ[6], AABB3Lanes boxes) {
+	simd_int4 outsideMask = boxes.emptyMask;
+	for (size_t planeI = 0; planeI < 6; ++planeI) {
+		simd_float4 farthestDistance = planeX[planeI] * boxes.centerX + planeY[planeI] * boxes.centerY + planeZ[planeI] * boxes.centerZ + planeW[planeI]
+			+ planeAbsX[planeI] * boxes.extentX + planeAbsY[planeI] * boxes.extentY + planeAbsZ[planeI] * boxes.extentZ;
+		outsideMask |= (farthestDistance < 0);
+	}
+	return outsideMask;
+}
+
+/// Broadcasts `frustum`'s planes' components (& their normals' absolute values) into the per-plane vectors `FrustumClassifyAABB3Lanes()` takes.
+NS_INLINE void FrustumLoadPlaneLanes(Frustum frustum, simd_float4 planeX[6], simd_float4 planeY[6], simd_float4 planeZ[6], simd_float4 planeW[6], simd_float4 planeAbsX[6], simd_float4 planeAbsY[6], simd_float4 planeAbsZ[6]) {
+	const Float4 planes[6] = { frustum.left, frustum.right, frustum.bottom, frustum.top, frustum.near, frustum.far };
+	for (size_t planeI = 0; planeI < 6; ++planeI) {
+		Float4 plane = planes[planeI];
+		planeX[planeI] = (simd_float4){ plane.x, plane.x, plane.x, plane.x };
+		planeY[planeI] = (simd_float4){ plane.y, plane.y, plane.y, plane.y };
+		planeZ[planeI] = (simd_float4){ plane.z, plane.z, plane.z, plane.z };
+		planeW[planeI] = (simd_float4){ plane.w, plane.w, plane.w, plane.w };
+		planeAbsX[planeI] = vuckt_simd_abs4(planeX[planeI]);
+		planeAbsY[planeI] = vuckt_simd_abs4(planeY[planeI]);
+		planeAbsZ[planeI] = vuckt_simd_abs4(planeZ[planeI]);
+	}
+}
+
+/// The classification code (see above) of `box` against `frustum`.
+NS_INLINE uint8_t FrustumClassifyAABB3(Frustum frustum, AABB3 box) {
+	simd_float4 planeX[6], planeY[6], planeZ[6], planeW[6], planeAbsX[6], planeAbsY[6], planeAbsZ[6];
+	FrustumLoadPlaneLanes(frustum, planeX, planeY, planeZ, planeW, planeAbsX, planeAbsY, planeAbsZ);
+	return (uint8_t)FrustumClassifyAABB3Lanes(planeX, planeY, planeZ, planeW, planeAbsX, planeAbsY, planeAbsZ, AABB3LanesLoad(&box, 1))[0];
+}
+
+/// Runs `lanesFunction` (`FrustumClassifyAABB3Lanes` or `FrustumAABB3LanesOutsideMask`) over `boxes[i]`…`boxes[i + count - 1]` (`count` ≤ 8) into `result0` (the first 4) & `result1` (the rest), with lanes past `count` repeating the last box's result.
+#define _VUCKT_FRUSTUM_TEST_BLOCK8(lanesFunction, boxes, i, count, result0, result1) \
+	simd_int4 result0 = lanesFunction(planeX, planeY, planeZ, planeW, planeAbsX, planeAbsY, planeAbsZ, AABB3LanesLoad((boxes) + (i), ((count) < 4) ? (count) : 4)); \
+	simd_int4 result1 = ((count) > 4) \
+		? lanesFunction(planeX, planeY, planeZ, planeW, planeAbsX, planeAbsY, planeAbsZ, AABB3LanesLoad((boxes) + (i) + 4, (count) - 4)) \
+		: result0
+/// Runs the statement `...` over an `n`-box batch 8 boxes at a time, with `i` (the block's first index), `count` (its box count), & `result0`/`result1` (see `_VUCKT_FRUSTUM_TEST_BLOCK8()`) in scope.
+/// As with `VUCKT_FOR_EACH_BLOCK4()`, `count` is a constant 8 for every full block, so the lane loads within compile to whole-vector moves, then 1–7 for the final partial block, if any.
+#define VUCKT_FRUSTUM_FOR_EACH_TESTED_BLOCK8(frustum, lanesFunction, boxes, n, i, count, result0, result1, ...) \
+	do { \
+		simd_float4 planeX[6], planeY[6], planeZ[6], planeW[6], planeAbsX[6], planeAbsY[6], planeAbsZ[6]; \
+		FrustumLoadPlaneLanes((frustum), planeX, planeY, planeZ, planeW, planeAbsX, planeAbsY, planeAbsZ); \
+		size_t i = 0; \
+		for (; i + 8 <= (n); i += 8) { const size_t count = 8; _VUCKT_FRUSTUM_TEST_BLOCK8(lanesFunction, boxes, i, count, result0, result1); __VA_ARGS__; } \
+		if (i < (n)) { const size_t count = (n) - i; _VUCKT_FRUSTUM_TEST_BLOCK8(lanesFunction, boxes, i, count, result0, result1); __VA_ARGS__; } \
+	} while (0)
+
+/// `out[i] = FrustumClassifyAABB3(frustum, boxes[i])`
+NS_INLINE void FrustumClassifyAABB3Array(Frustum frustum, const AABB3 *boxes, uint8_t *out, size_t n) {
+	VUCKT_FRUSTUM_FOR_EACH_TESTED_BLOCK8(frustum, FrustumClassifyAABB3Lanes, boxes, n, i, count, codes0, codes1, {
+		for (size_t laneI = 0; laneI < count; ++laneI) {
+			out[i + laneI] = (uint8_t)((laneI < 4) ? codes0[laneI] : codes1[laneI - 4]);
+		}
+	});
+}
+/// Sets bit `i % 8` of `outVisibleBits[i / 8]` if `boxes[i]` isn't outside `frustum` (clearing it if it is), for all `(n + 7) / 8` bytes of `outVisibleBits` (a last partial byte's bits past `n` being cleared).
+NS_INLINE void FrustumCullAABB3ArrayToBitmask(Frustum frustum, const AABB3 *boxes, uint8_t *outVisibleBits, size_t n) {
+	VUCKT_FRUSTUM_FOR_EACH_TESTED_BLOCK8(frustum, FrustumAABB3LanesOutsideMask, boxes, n, i, count, outsideMask0, outsideMask1, {
+		simd_int4 visibleBits = (~outsideMask0 & (simd_int4){ 1, 2, 4, 8 }) | (~outsideMask1 & (simd_int4){ 16, 32, 64, 128 });
+		outVisibleBits[i / 8] = (uint8_t)((visibleBits[0] | visibleBits[1] | visibleBits[2] | visibleBits[3]) & ((1 << count) - 1));
+	});
+}
+/// Writes the indices of the boxes not outside `frustum` into `outVisibleIndices` (which must have room for `n`), in ascending order, & returns how many it wrote.
+/// - Precondition: `n` must fit in 32 bits.
+NS_INLINE size_t FrustumCullAABB3ArrayToIndices(Frustum frustum, const AABB3 *boxes, uint32_t *outVisibleIndices, size_t n) {
+	size_t visibleCount = 0;
+	VUCKT_FRUSTUM_FOR_EACH_TESTED_BLOCK8(frustum, FrustumAABB3LanesOutsideMask, boxes, n, i, count, outsideMask0, outsideMask1, {
+		// Branch-free compaction: every lane's index is written, but the write position only advances past the visible ones.
+		for (size_t laneI = 0; laneI < count; ++laneI) {
+			outVisibleIndices[visibleCount] = (uint32_t)(i + laneI);
+			visibleCount += 1 + ((laneI < 4) ? outsideMask0[laneI] : outsideMask1[laneI - 4]);
+		}
+	});
+	return visibleCount;
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,120 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+/// Where a bounding box lies relative to a `Frustum`.  (Raw values are the codes the C `FrustumClassify…()` functions write.)
+public enum FrustumContainment : UInt8 {
+	/// Entirely behind at least one plane.
+	case outside = 0
+	/// Straddling at least one plane (or, rarely, outside but near one of the frustum's edges, where the plane-by-plane test is conservative).
+	case intersecting = 1
+	/// Entirely in front of all six planes.
+	case inside = 2
+}
+
+
+/// The six planes bounding a view volume, each as `(a, b, c, d)` for the plane `a·x + b·y + c·z + d = 0`, with its unit normal `(a, b, c)` pointing inward.
+extension Frustum
+{
+	// MARK: `init`s
+	
+	/// Initialize to the planes of `viewProjection`'s view volume (Gribb & Hartmann's method), in the space `viewProjection` transforms from— world space, for a view-projection matrix.
+	/// `depthRange` is the clip-space depth range the projection maps to.
+	@_alwaysEmitIntoClient public init(viewProjection:Float4x4, depthRange:ClipDepthRange = .zeroToOne) {
+		self = FrustumFromViewProjection(viewProjection, depthRange == .zeroToOne)
+	}
+	
+	
+	// MARK: `as…` Functionality
+	
+	/// The planes, in `left`, `right`, `bottom`, `top`, `near`, `far` order.
+	@_transparent public var planes:[Float4] {
+		return [ self.left, self.right, self.bottom, self.top, self.near, self.far ]
+	}
+	
+	
+	// MARK: Queries
+	
+	/// Whether `point` is in front of (or on) all six planes.
+	@_alwaysEmitIntoClient public func contains(_ point:Float3) -> Bool {
+		return self.planes.allSatisfy{ $0.x * point.x + $0.y * point.y + $0.z * point.z + $0.w >= 0 }
+	}
+	
+	@_transparent public func classify(_ box:AABB3) -> FrustumContainment {
+		return FrustumContainment(rawValue: FrustumClassifyAABB3(self, box))!
+	}
+	/// Whether `box` isn't entirely outside the frustum.
+	@_transparent public func isVisible(_ box:AABB3) -> Bool {
+		return FrustumClassifyAABB3(self, box) != FrustumContainment.outside.rawValue
+	}
+}
+
+
+extension Frustum : Equatable
+{
+	@_transparent public static func ==(a:Frustum, b:Frustum) -> Bool {
+		return a.left == b.left && a.right == b.right && a.bottom == b.bottom && a.top == b.top && a.near == b.near && a.far == b.far
+	}
+}
+
+
+extension Frustum // Bulk Culling
+{
+	// These run 8 boxes per iteration through the C kernels (see `Frustum.h`), testing each plane against 4 boxes' worth of vector lanes at once.
+	
+	/// Writes each of `boxes`' `FrustumContainment` raw value into `out`.  (Both buffers must have the same count.)
+	@_alwaysEmitIntoClient public func classify(_ boxes:UnsafeBufferPointer<AABB3>, into out:UnsafeMutableBufferPointer<UInt8>) {
+		boxes._vucktBulkConversion(into: out){ FrustumClassifyAABB3Array(self, $0, $1, $2) }
+	}
+	@_alwaysEmitIntoClient public func classifications(of boxes:[AABB3]) -> [FrustumContainment] {
+		let codes:[UInt8] = boxes._vucktBulkConversion{ FrustumClassifyAABB3Array(self, $0, $1, $2) }
+		return codes.map{ FrustumContainment(rawValue: $0)! }
+	}
+	
+	/// Sets bit `i % 8` of `out[i / 8]` if `boxes[i]` isn't outside the frustum (clearing it if it is; bits past the last box are cleared too).
+	/// - Precondition: `out` must have `(boxes.count + 7) / 8` bytes.
+	@_alwaysEmitIntoClient public func cull(_ boxes:UnsafeBufferPointer<AABB3>, intoVisibilityBits out:UnsafeMutableBufferPointer<UInt8>) {
+		precondition(out.count == (boxes.count + 7) / 8, "Visibility bitmask must have one byte per 8 boxes.")
+		guard boxes.count > 0 else { return }
+		FrustumCullAABB3ArrayToBitmask(self, boxes.baseAddress!, out.baseAddress!, boxes.count)
+	}
+	/// One bit per box, set if it isn't outside the frustum— see `cull(_:intoVisibilityBits:)`.
+	@_alwaysEmitIntoClient public func visibilityBits(of boxes:[AABB3]) -> [UInt8] {
+		let byteCount = (boxes.count + 7) / 8
+		return boxes.withUnsafeBufferPointer{ boxesBuffer in
+			[UInt8](unsafeUninitializedCapacity: byteCount){ outBuffer, initializedCount in
+				self.cull(boxesBuffer, intoVisibilityBits: UnsafeMutableBufferPointer(rebasing: outBuffer[0..<byteCount]))
+				initializedCount = byteCount
+			}
+		}
+	}
+	
+	/// Writes the indices of the boxes not outside the frustum into the start of `out`, in ascending order, & returns how many it wrote.
+	/// - Precondition: `out` must have room for `boxes.count` indices.
+	@_alwaysEmitIntoClient public func cull(_ boxes:UnsafeBufferPointer<AABB3>, intoVisibleIndices out:UnsafeMutableBufferPointer<UInt32>) -> Int {
+		precondition(out.count >= boxes.count, "Visible-index buffer must have room for every box.")
+		precondition(boxes.count <= Int(UInt32.max), "Too many boxes for 32-bit indices.")
+		guard boxes.count > 0 else { return 0 }
+		return FrustumCullAABB3ArrayToIndices(self, boxes.baseAddress!, out.baseAddress!, boxes.count)
+	}
+	/// The indices of the boxes not outside the frustum, in ascending order (ready to upload as, e.g., an instance-index buffer).
+	@_alwaysEmitIntoClient public func visibleIndices(of boxes:[AABB3]) -> [UInt32] {
+		return boxes.withUnsafeBufferPointer{ boxesBuffer in
+			[UInt32](unsafeUninitializedCapacity: boxes.count){ outBuffer, initializedCount in
+				initializedCount = self.cull(boxesBuffer, intoVisibleIndices: outBuffer)
+			}
+		}
+	}
+}
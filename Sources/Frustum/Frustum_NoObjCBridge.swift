@@ -0,0 +1,105 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Frustum
+{
+	public var left:Float4
+	public var right:Float4
+	public var bottom:Float4
+	public var top:Float4
+	public var near:Float4
+	public var far:Float4
+	
+	public init() {
+		self.left = Float4()
+		self.right = Float4()
+		self.bottom = Float4()
+		self.top = Float4()
+		self.near = Float4()
+		self.far = Float4()
+	}
+	
+	public init(left:Float4, right:Float4, bottom:Float4, top:Float4, near:Float4, far:Float4) {
+		self.left = left
+		self.right = right
+		self.bottom = bottom
+		self.top = top
+		self.near = near
+		self.far = far
+	}
+}
+
+
+
+// MARK: Plane Extraction
+
+@_alwaysEmitIntoClient public func FrustumFromViewProjection(_ viewProjection:Float4x4, _ zeroToOneDepth:Bool) -> Frustum {
+	let m = viewProjection
+	let row0 = simd_float4(m.m00, m.m10, m.m20, m.m30)
+	let row1 = simd_float4(m.m01, m.m11, m.m21, m.m31)
+	let row2 = simd_float4(m.m02, m.m12, m.m22, m.m32)
+	let row3 = simd_float4(m.m03, m.m13, m.m23, m.m33)
+	func normalizedPlane(_ plane:simd_float4) -> Float4 {
+		let normalLength = (plane.x * plane.x + plane.y * plane.y + plane.z * plane.z).squareRoot()
+		return Float4FromSimd(plane * (1 / normalLength))
+	}
+	return Frustum(
+		left: normalizedPlane(row3 + row0),
+		right: normalizedPlane(row3 - row0),
+		bottom: normalizedPlane(row3 + row1),
+		top: normalizedPlane(row3 - row1),
+		near: normalizedPlane(zeroToOneDepth ? row2 : row3 + row2),
+		far: normalizedPlane(row3 - row2)
+	)
+}
+
+
+
+// MARK: AABB3 Culling
+
+@_alwaysEmitIntoClient public func FrustumClassifyAABB3(_ frustum:Frustum, _ box:AABB3) -> UInt8 {
+	if AABB3IsEmpty(box) { return 0 }
+	let center = AABB3Center(box), extents = AABB3Extents(box)
+	var outside = false, straddling = false
+	for plane in [ frustum.left, frustum.right, frustum.bottom, frustum.top, frustum.near, frustum.far ] {
+		let distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w
+		let radius = abs(plane.x) * extents.x + abs(plane.y) * extents.y + abs(plane.z) * extents.z
+		outside = outside || (distance < -radius)
+		straddling = straddling || (distance < radius)
+	}
+	return outside ? 0 : (straddling ? 1 : 2)
+}
+
+@_alwaysEmitIntoClient public func FrustumClassifyAABB3Array(_ frustum:Frustum, _ boxes:UnsafePointer<AABB3>, _ out:UnsafeMutablePointer<UInt8>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = FrustumClassifyAABB3(frustum, boxes[i])
+	}
+}
+@_alwaysEmitIntoClient public func FrustumCullAABB3ArrayToBitmask(_ frustum:Frustum, _ boxes:UnsafePointer<AABB3>, _ outVisibleBits:UnsafeMutablePointer<UInt8>, _ n:Int) {
+	for byteI in 0..<((n + 7) / 8) {
+		var bits:UInt8 = 0
+		for bitI in 0..<Swift.min(8, n - byteI * 8) where FrustumClassifyAABB3(frustum, boxes[byteI * 8 + bitI]) != 0 {
+			bits |= 1 << UInt8(bitI)
+		}
+		outVisibleBits[byteI] = bits
+	}
+}
+@_alwaysEmitIntoClient public func FrustumCullAABB3ArrayToIndices(_ frustum:Frustum, _ boxes:UnsafePointer<AABB3>, _ outVisibleIndices:UnsafeMutablePointer<UInt32>, _ n:Int) -> Int {
+	var visibleCount = 0
+	for i in 0..<n where FrustumClassifyAABB3(frustum, boxes[i]) != 0 {
+		outVisibleIndices[visibleCount] = UInt32(i)
+		visibleCount += 1
+	}
+	return visibleCount
+}
@@ -0,0 +1,94 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float2.h>)
+	#import <Vuckt/Float2.h>
+#else
+	#include "../Float2/Float2.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 2-component vector of IEEE 754 half-precision (binary16) floats, each stored as its 16-bit pattern (4 bytes, matching `simd_ushort2`), for compact storage— texture coordinates & the like.
+/// Widen to `Float2` (e.g. with `Half2ToFloat2()`, or in bulk with `Half2ArrayToFloat2Array()`) to do math.
+struct Half2 {
+	unsigned short x, y;
+} __attribute__((aligned(__alignof__(simd_ushort2))));
+typedef struct Half2 Half2;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Half2` struct to `simd_ushort2` vector (of the elements' bit patterns) using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_ushort2 Half2ToSimd(Half2 structValue) {
+	return *(simd_ushort2 *)&structValue;
+}
+/// Converts a `Half2` struct from `simd_ushort2` vector (of the elements' bit patterns) using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Half2 Half2FromSimd(simd_ushort2 simdValue) {
+	return *(Half2 *)&simdValue;
+}
+
+
+
+#pragma mark Float2 Conversion
+
+// These go through `VucktPlatform.h`'s 4-lane half-precision kernels (F16C on x86, `fcvtl`/`fcvtn` on 64-bit ARM, else a branch-free integer fallback), with `x` & `y` repeated in the upper 2 lanes.
+
+/// Widens each element to `float` (exactly).
+NS_INLINE Float2 Half2ToFloat2(Half2 value) {
+	simd_float4 lanes = vuckt_simd_half_to_float4((simd_ushort4){ value.x, value.y, value.x, value.y });
+	return (Float2){ lanes[0], lanes[1] };
+}
+/// Narrows each element to half precision, rounding to nearest-even (IEEE 754's default); values too large for half (past ±65504 after rounding) become ±Inf.
+NS_INLINE Half2 Half2FromFloat2(Float2 value) {
+	simd_ushort4 lanes = vuckt_simd_half_from_float4((simd_float4){ value.x, value.y, value.x, value.y });
+	return (Half2){ lanes[0], lanes[1] };
+}
+/// Narrows each element to half precision, rounding toward zero; finite values too large for half become ±65504.
+NS_INLINE Half2 Half2FromFloat2TowardZero(Float2 value) {
+	simd_ushort4 lanes = vuckt_simd_half_from_float_toward_zero4((simd_float4){ value.x, value.y, value.x, value.y });
+	return (Half2){ lanes[0], lanes[1] };
+}
+
+
+
+#pragma mark Bulk Conversion
+
+// Element-wise conversions over `n`-element arrays.  `out` must not overlap the input array.
+// These run over the flat lanes (2 per element on both sides), 8 lanes per instruction with F16C & AVX.
+
+/// `out[i] = Half2ToFloat2(values[i])`
+NS_INLINE void Half2ArrayToFloat2Array(const Half2 *values, Float2 *out, size_t n) {
+	vuckt_half_lanes_to_float_lanes((const unsigned short *)values, (float *)out, n * (sizeof(Half2) / sizeof(unsigned short)), false);
+}
+/// `out[i] = Half2FromFloat2(values[i])`
+NS_INLINE void Half2ArrayFromFloat2Array(const Float2 *values, Half2 *out, size_t n) {
+	vuckt_half_lanes_from_float_lanes((const float *)values, (unsigned short *)out, n * (sizeof(Half2) / sizeof(unsigned short)), false, false);
+}
+/// `out[i] = Half2FromFloat2TowardZero(values[i])`
+NS_INLINE void Half2ArrayFromFloat2ArrayTowardZero(const Float2 *values, Half2 *out, size_t n) {
+	vuckt_half_lanes_from_float_lanes((const float *)values, (unsigned short *)out, n * (sizeof(Half2) / sizeof(unsigned short)), false, true);
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
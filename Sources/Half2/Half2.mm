@@ -0,0 +1,20 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Half2.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Half2, x) == sizeof(simd_ushort1),
+	"Half2's first member's size does not match simd_ushort1's on this platform.");
+static_assert(sizeof(Half2) == sizeof(simd_ushort2),
+	"Half2's size does not match simd_ushort2's on this platform.");
+static_assert(sizeof_member(Half2, x) == sizeof_member(simd_ushort2, x),
+	"Half2's first member's size does not match simd_ushort2's first member's on this platform.");
+static_assert(alignof(Half2) == alignof(simd_ushort2),
+	"Half2's alignment requirements does not match simd_ushort2's on this platform.");
+static_assert(sizeof(Half2) / sizeof(unsigned short) == sizeof(Float2) / sizeof(float),
+	"Half2's lane count does not match Float2's on this platform (which the bulk conversions rely on).");
@@ -0,0 +1,157 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension Half2
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements, each rounded to nearest-even half precision.
+	@_transparent public init(_ x:Float, _ y:Float) {
+		self = Half2FromFloat2(Float2(x, y))
+	}
+	
+	/// Initialize to a vector with all elements equal to `scalar` (rounded to nearest-even half precision).
+	@_transparent public init(scalar:Float) {
+		self.init(scalar, scalar)
+	}
+	
+	/// Initialize from the elements' binary16 bit patterns.
+	@_transparent public init(bitPatterns value:SIMD2<UInt16>) {
+		self = Half2FromSimd(value)
+	}
+	
+	/// Initialize from a `Float2` value, narrowing each element to half precision per `rounding` (values too large for half becoming ±Inf when rounding to nearest-even, or ±65504 when rounding toward zero).
+	@_alwaysEmitIntoClient public init(_ float2Value:Float2, rounding:HalfRoundingMode = .toNearestOrEven) {
+		switch rounding {
+			case .toNearestOrEven: self = Half2FromFloat2(float2Value)
+			case .towardZero: self = Half2FromFloat2TowardZero(float2Value)
+		}
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Half2 { return Half2(scalar: 0) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	/// Each element widened to `Float`.
+	@_transparent public var asTuple:(x:Float,y:Float) {
+		let float2Value = Half2ToFloat2(self)
+		return ( float2Value.x, float2Value.y )
+	}
+	
+	/// Each element widened to `Float`.
+	@_transparent public var asArray:[Float] {
+		let float2Value = Half2ToFloat2(self)
+		return [ float2Value.x, float2Value.y ]
+	}
+	
+	/// Each element widened to `Float` (exactly).
+	@_transparent public var float2Value:Float2 {
+		return Half2ToFloat2(self)
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	/// The elements' binary16 bit patterns.
+	@_transparent public var simdValue:SIMD2<UInt16> {
+		return Half2ToSimd(self)
+	}
+}
+
+
+extension Float2
+{
+	/// Initialize from a `Half2` value, widening each element (exactly).
+	@_transparent public init(_ half2Value:Half2) {
+		self = Half2ToFloat2(half2Value)
+	}
+}
+
+
+extension Half2 : CustomStringConvertible
+{
+	public var description:String {
+		let float2Value = Half2ToFloat2(self)
+		return "(\(float2Value.x), \(float2Value.y))"
+	}
+}
+
+
+/// Compares the elements' bit patterns— so unlike `Float`'s `==`, identical NaNs are equal, & -0 & +0 aren't.
+extension Half2 : Equatable
+{
+	@_transparent public static func ==(a:Half2, b:Half2) -> Bool {
+		return a.x == b.x && a.y == b.y
+	}
+}
+
+
+extension Half2 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			hasher.combine(self.x)
+			hasher.combine(self.y)
+		}
+	#else
+		public var hashValue:Int {
+			return (Int(self.x) << 0) | (Int(self.y) << 16)
+		}
+	#endif
+}
+
+
+extension UnsafeBufferPointer where Element == Half2 // Bulk Conversion
+{
+	/// Widens every element into `out` (exactly).  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Float2>) {
+		self._vucktBulkConversion(into: out, Half2ArrayToFloat2Array)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float2 // Bulk Conversion
+{
+	/// Narrows every element into `out`, rounding per `rounding`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Half2>, rounding:HalfRoundingMode = .toNearestOrEven) {
+		switch rounding {
+			case .toNearestOrEven: self._vucktBulkConversion(into: out, Half2ArrayFromFloat2Array)
+			case .towardZero: self._vucktBulkConversion(into: out, Half2ArrayFromFloat2ArrayTowardZero)
+		}
+	}
+}
+
+extension Array where Element == Float2
+{
+	/// Widens an array of `Half2`s (exactly).
+	@_alwaysEmitIntoClient public init(_ half2Values:[Half2]) {
+		self = half2Values._vucktBulkConversion(Half2ArrayToFloat2Array)
+	}
+}
+
+extension Array where Element == Half2
+{
+	/// Narrows an array of `Float2`s, rounding per `rounding`.
+	@_alwaysEmitIntoClient public init(_ float2Values:[Float2], rounding:HalfRoundingMode = .toNearestOrEven) {
+		switch rounding {
+			case .toNearestOrEven: self = float2Values._vucktBulkConversion(Half2ArrayFromFloat2Array)
+			case .towardZero: self = float2Values._vucktBulkConversion(Half2ArrayFromFloat2ArrayTowardZero)
+		}
+	}
+}
@@ -0,0 +1,79 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Half2
+{
+	public var x:UInt16
+	public var y:UInt16
+	
+	public init() {
+		self.x = UInt16()
+		self.y = UInt16()
+	}
+	
+	public init(x:UInt16, y:UInt16) {
+		self.x = x
+		self.y = y
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Half2` struct to `SIMD2<UInt16>` vector using passing-individual-members initialization.
+@_transparent public func Half2ToSimd(_ structValue:Half2) -> SIMD2<UInt16> {
+	return SIMD2<UInt16>(structValue.x, structValue.y)
+}
+/// Converts a `Half2` struct from `SIMD2<UInt16>` vector using passing-individual-members initialization.
+@_transparent public func Half2FromSimd(_ simdValue:SIMD2<UInt16>) -> Half2 {
+	return Half2(x: simdValue.x, y: simdValue.y)
+}
+
+
+
+// MARK: Float2 Conversion
+
+@_alwaysEmitIntoClient public func Half2ToFloat2(_ value:Half2) -> Float2 {
+	let lanes = _vucktHalfToFloat(SIMD4<UInt16>(value.x, value.y, value.x, value.y))
+	return Float2(x: lanes.x, y: lanes.y)
+}
+@_alwaysEmitIntoClient public func Half2FromFloat2(_ value:Float2) -> Half2 {
+	let lanes = _vucktHalfFromFloat(simd_float4(value.x, value.y, value.x, value.y), towardZero: false)
+	return Half2(x: lanes.x, y: lanes.y)
+}
+@_alwaysEmitIntoClient public func Half2FromFloat2TowardZero(_ value:Float2) -> Half2 {
+	let lanes = _vucktHalfFromFloat(simd_float4(value.x, value.y, value.x, value.y), towardZero: true)
+	return Half2(x: lanes.x, y: lanes.y)
+}
+
+
+
+// MARK: Bulk Conversion
+
+@_alwaysEmitIntoClient public func Half2ArrayToFloat2Array(_ values:UnsafePointer<Half2>, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Half2ToFloat2(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Half2ArrayFromFloat2Array(_ values:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Half2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Half2FromFloat2(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Half2ArrayFromFloat2ArrayTowardZero(_ values:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Half2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Half2FromFloat2TowardZero(values[i])
+	}
+}
@@ -0,0 +1,107 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 3-component vector of IEEE 754 half-precision (binary16) floats, each stored as its 16-bit pattern (8 bytes including a padding lane, matching `simd_ushort3`), for compact storage— normals, positions, animation keys, & the like.
+/// Widen to `Float3` (e.g. with `Half3ToFloat3()`, or in bulk with `Half3ArrayToFloat3Array()`) to do math.
+struct Half3 {
+	unsigned short x, y, z;
+} __attribute__((aligned(__alignof__(simd_ushort3))));
+typedef struct Half3 Half3;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Half3` struct to `simd_ushort3` vector (of the elements' bit patterns) using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_ushort3 Half3ToSimd(Half3 structValue) {
+	#if VUCKT_SIMD3_IS_SIMD4
+		simd_ushort3 simdValue;
+		memcpy(&simdValue, &structValue, sizeof simdValue);
+		return __builtin_shuffle(simdValue, (simd_short3){ 0, 1, 2, 2 });
+	#else
+		return *(simd_ushort3 *)&structValue;
+	#endif
+}
+/// Converts a `Half3` struct from `simd_ushort3` vector (of the elements' bit patterns) using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Half3 Half3FromSimd(simd_ushort3 simdValue) {
+	#if VUCKT_SIMD3_IS_SIMD4
+		Half3 structValue;
+		memcpy(&structValue, &simdValue, sizeof structValue);
+		return structValue;
+	#else
+		return *(Half3 *)&simdValue;
+	#endif
+}
+
+
+
+#pragma mark Float3 Conversion
+
+// These go through `VucktPlatform.h`'s 4-lane half-precision kernels (F16C on x86, `fcvtl`/`fcvtn` on 64-bit ARM, else a branch-free integer fallback), with the lane past `z` repeating it.
+
+/// Widens each element to `float` (exactly).
+NS_INLINE Float3 Half3ToFloat3(Half3 value) {
+	simd_float4 lanes = vuckt_simd_half_to_float4((simd_ushort4){ value.x, value.y, value.z, value.z });
+	return (Float3){ lanes[0], lanes[1], lanes[2] };
+}
+/// Narrows each element to half precision, rounding to nearest-even (IEEE 754's default); values too large for half (past ±65504 after rounding) become ±Inf.
+NS_INLINE Half3 Half3FromFloat3(Float3 value) {
+	simd_ushort4 lanes = vuckt_simd_half_from_float4((simd_float4){ value.x, value.y, value.z, value.z });
+	return (Half3){ lanes[0], lanes[1], lanes[2] };
+}
+/// Narrows each element to half precision, rounding toward zero; finite values too large for half become ±65504.
+NS_INLINE Half3 Half3FromFloat3TowardZero(Float3 value) {
+	simd_ushort4 lanes = vuckt_simd_half_from_float_toward_zero4((simd_float4){ value.x, value.y, value.z, value.z });
+	return (Half3){ lanes[0], lanes[1], lanes[2] };
+}
+
+
+
+#pragma mark Bulk Conversion
+
+// Element-wise conversions over `n`-element arrays.  `out` must not overlap the input array.
+// These run over the flat lanes (4 per element on both sides), 8 lanes per instruction with F16C & AVX.
+// Only `x`, `y`, & `z` are converted: the input's padding lane is never read into the conversion, & `out`'s is written as a copy of its `z`.
+
+/// `out[i] = Half3ToFloat3(values[i])`
+NS_INLINE void Half3ArrayToFloat3Array(const Half3 *values, Float3 *out, size_t n) {
+	vuckt_half_lanes_to_float_lanes((const unsigned short *)values, (float *)out, n * (sizeof(Half3) / sizeof(unsigned short)), true);
+}
+/// `out[i] = Half3FromFloat3(values[i])`
+NS_INLINE void Half3ArrayFromFloat3Array(const Float3 *values, Half3 *out, size_t n) {
+	vuckt_half_lanes_from_float_lanes((const float *)values, (unsigned short *)out, n * (sizeof(Half3) / sizeof(unsigned short)), true, false);
+}
+/// `out[i] = Half3FromFloat3TowardZero(values[i])`
+NS_INLINE void Half3ArrayFromFloat3ArrayTowardZero(const Float3 *values, Half3 *out, size_t n) {
+	vuckt_half_lanes_from_float_lanes((const float *)values, (unsigned short *)out, n * (sizeof(Half3) / sizeof(unsigned short)), true, true);
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
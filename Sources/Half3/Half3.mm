@@ -0,0 +1,20 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Half3.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Half3, x) == sizeof(simd_ushort1),
+	"Half3's first member's size does not match simd_ushort1's on this platform.");
+static_assert(sizeof(Half3) == sizeof(simd_ushort3),
+	"Half3's size does not match simd_ushort3's on this platform.");
+static_assert(sizeof_member(Half3, x) == sizeof_member(simd_ushort3, x),
+	"Half3's first member's size does not match simd_ushort3's first member's on this platform.");
+static_assert(alignof(Half3) == alignof(simd_ushort3),
+	"Half3's alignment requirements does not match simd_ushort3's on this platform.");
+static_assert(sizeof(Half3) / sizeof(unsigned short) == sizeof(Float3) / sizeof(float),
+	"Half3's lane count does not match Float3's on this platform (which the bulk conversions rely on).");
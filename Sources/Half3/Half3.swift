@@ -0,0 +1,158 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension Half3
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements, each rounded to nearest-even half precision.
+	@_transparent public init(_ x:Float, _ y:Float, _ z:Float) {
+		self = Half3FromFloat3(Float3(x, y, z))
+	}
+	
+	/// Initialize to a vector with all elements equal to `scalar` (rounded to nearest-even half precision).
+	@_transparent public init(scalar:Float) {
+		self.init(scalar, scalar, scalar)
+	}
+	
+	/// Initialize from the elements' binary16 bit patterns.
+	@_transparent public init(bitPatterns value:SIMD3<UInt16>) {
+		self = Half3FromSimd(value)
+	}
+	
+	/// Initialize from a `Float3` value, narrowing each element to half precision per `rounding` (values too large for half becoming ±Inf when rounding to nearest-even, or ±65504 when rounding toward zero).
+	@_alwaysEmitIntoClient public init(_ float3Value:Float3, rounding:HalfRoundingMode = .toNearestOrEven) {
+		switch rounding {
+			case .toNearestOrEven: self = Half3FromFloat3(float3Value)
+			case .towardZero: self = Half3FromFloat3TowardZero(float3Value)
+		}
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Half3 { return Half3(scalar: 0) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	/// Each element widened to `Float`.
+	@_transparent public var asTuple:(x:Float,y:Float,z:Float) {
+		let float3Value = Half3ToFloat3(self)
+		return ( float3Value.x, float3Value.y, float3Value.z )
+	}
+	
+	/// Each element widened to `Float`.
+	@_transparent public var asArray:[Float] {
+		let float3Value = Half3ToFloat3(self)
+		return [ float3Value.x, float3Value.y, float3Value.z ]
+	}
+	
+	/// Each element widened to `Float` (exactly).
+	@_transparent public var float3Value:Float3 {
+		return Half3ToFloat3(self)
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	/// The elements' binary16 bit patterns.
+	@_transparent public var simdValue:SIMD3<UInt16> {
+		return Half3ToSimd(self)
+	}
+}
+
+
+extension Float3
+{
+	/// Initialize from a `Half3` value, widening each element (exactly).
+	@_transparent public init(_ half3Value:Half3) {
+		self = Half3ToFloat3(half3Value)
+	}
+}
+
+
+extension Half3 : CustomStringConvertible
+{
+	public var description:String {
+		let float3Value = Half3ToFloat3(self)
+		return "(\(float3Value.x), \(float3Value.y), \(float3Value.z))"
+	}
+}
+
+
+/// Compares the elements' bit patterns— so unlike `Float`'s `==`, identical NaNs are equal, & -0 & +0 aren't.
+extension Half3 : Equatable
+{
+	@_transparent public static func ==(a:Half3, b:Half3) -> Bool {
+		return a.x == b.x && a.y == b.y && a.z == b.z
+	}
+}
+
+
+extension Half3 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			hasher.combine(self.x)
+			hasher.combine(self.y)
+			hasher.combine(self.z)
+		}
+	#else
+		public var hashValue:Int {
+			return (Int(self.x) << 0) | (Int(self.y) << 16) | (Int(self.z) << 32)
+		}
+	#endif
+}
+
+
+extension UnsafeBufferPointer where Element == Half3 // Bulk Conversion
+{
+	/// Widens every element into `out` (exactly).  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktBulkConversion(into: out, Half3ArrayToFloat3Array)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float3 // Bulk Conversion
+{
+	/// Narrows every element into `out`, rounding per `rounding`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Half3>, rounding:HalfRoundingMode = .toNearestOrEven) {
+		switch rounding {
+			case .toNearestOrEven: self._vucktBulkConversion(into: out, Half3ArrayFromFloat3Array)
+			case .towardZero: self._vucktBulkConversion(into: out, Half3ArrayFromFloat3ArrayTowardZero)
+		}
+	}
+}
+
+extension Array where Element == Float3
+{
+	/// Widens an array of `Half3`s (exactly).
+	@_alwaysEmitIntoClient public init(_ half3Values:[Half3]) {
+		self = half3Values._vucktBulkConversion(Half3ArrayToFloat3Array)
+	}
+}
+
+extension Array where Element == Half3
+{
+	/// Narrows an array of `Float3`s, rounding per `rounding`.
+	@_alwaysEmitIntoClient public init(_ float3Values:[Float3], rounding:HalfRoundingMode = .toNearestOrEven) {
+		switch rounding {
+			case .toNearestOrEven: self = float3Values._vucktBulkConversion(Half3ArrayFromFloat3Array)
+			case .towardZero: self = float3Values._vucktBulkConversion(Half3ArrayFromFloat3ArrayTowardZero)
+		}
+	}
+}
@@ -0,0 +1,82 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Half3
+{
+	public var x:UInt16
+	public var y:UInt16
+	public var z:UInt16
+	
+	public init() {
+		self.x = UInt16()
+		self.y = UInt16()
+		self.z = UInt16()
+	}
+	
+	public init(x:UInt16, y:UInt16, z:UInt16) {
+		self.x = x
+		self.y = y
+		self.z = z
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Half3` struct to `SIMD3<UInt16>` vector using passing-individual-members initialization.
+@_transparent public func Half3ToSimd(_ structValue:Half3) -> SIMD3<UInt16> {
+	return SIMD3<UInt16>(structValue.x, structValue.y, structValue.z)
+}
+/// Converts a `Half3` struct from `SIMD3<UInt16>` vector using passing-individual-members initialization.
+@_transparent public func Half3FromSimd(_ simdValue:SIMD3<UInt16>) -> Half3 {
+	return Half3(x: simdValue.x, y: simdValue.y, z: simdValue.z)
+}
+
+
+
+// MARK: Float3 Conversion
+
+@_alwaysEmitIntoClient public func Half3ToFloat3(_ value:Half3) -> Float3 {
+	let lanes = _vucktHalfToFloat(SIMD4<UInt16>(value.x, value.y, value.z, value.z))
+	return Float3(x: lanes.x, y: lanes.y, z: lanes.z)
+}
+@_alwaysEmitIntoClient public func Half3FromFloat3(_ value:Float3) -> Half3 {
+	let lanes = _vucktHalfFromFloat(simd_float4(value.x, value.y, value.z, value.z), towardZero: false)
+	return Half3(x: lanes.x, y: lanes.y, z: lanes.z)
+}
+@_alwaysEmitIntoClient public func Half3FromFloat3TowardZero(_ value:Float3) -> Half3 {
+	let lanes = _vucktHalfFromFloat(simd_float4(value.x, value.y, value.z, value.z), towardZero: true)
+	return Half3(x: lanes.x, y: lanes.y, z: lanes.z)
+}
+
+
+
+// MARK: Bulk Conversion
+
+@_alwaysEmitIntoClient public func Half3ArrayToFloat3Array(_ values:UnsafePointer<Half3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Half3ToFloat3(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Half3ArrayFromFloat3Array(_ values:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Half3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Half3FromFloat3(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Half3ArrayFromFloat3ArrayTowardZero(_ values:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Half3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Half3FromFloat3TowardZero(values[i])
+	}
+}
@@ -0,0 +1,91 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float4.h>)
+	#import <Vuckt/Float4.h>
+#else
+	#include "../Float4/Float4.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 4-component vector of IEEE 754 half-precision (binary16) floats, each stored as its 16-bit pattern (8 bytes, matching `simd_ushort4`), for compact storage— colors, tangents, rotation keys, & the like.
+/// Widen to `Float4` (e.g. with `Half4ToFloat4()`, or in bulk with `Half4ArrayToFloat4Array()`) to do math.
+struct Half4 {
+	unsigned short x, y, z, w;
+} __attribute__((aligned(__alignof__(simd_ushort4))));
+typedef struct Half4 Half4;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Half4` struct to `simd_ushort4` vector (of the elements' bit patterns) using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_ushort4 Half4ToSimd(Half4 structValue) {
+	return *(simd_ushort4 *)&structValue;
+}
+/// Converts a `Half4` struct from `simd_ushort4` vector (of the elements' bit patterns) using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Half4 Half4FromSimd(simd_ushort4 simdValue) {
+	return *(Half4 *)&simdValue;
+}
+
+
+
+#pragma mark Float4 Conversion
+
+// These go through `VucktPlatform.h`'s 4-lane half-precision kernels (F16C on x86, `fcvtl`/`fcvtn` on 64-bit ARM, else a branch-free integer fallback).
+
+/// Widens each element to `float` (exactly).
+NS_INLINE Float4 Half4ToFloat4(Half4 value) {
+	return Float4FromSimd(vuckt_simd_half_to_float4(Half4ToSimd(value)));
+}
+/// Narrows each element to half precision, rounding to nearest-even (IEEE 754's default); values too large for half (past ±65504 after rounding) become ±Inf.
+NS_INLINE Half4 Half4FromFloat4(Float4 value) {
+	return Half4FromSimd(vuckt_simd_half_from_float4(Float4ToSimd(value)));
+}
+/// Narrows each element to half precision, rounding toward zero; finite values too large for half become ±65504.
+NS_INLINE Half4 Half4FromFloat4TowardZero(Float4 value) {
+	return Half4FromSimd(vuckt_simd_half_from_float_toward_zero4(Float4ToSimd(value)));
+}
+
+
+
+#pragma mark Bulk Conversion
+
+// Element-wise conversions over `n`-element arrays.  `out` must not overlap the input array.
+// These run over the flat lanes (4 per element on both sides), 8 lanes per instruction with F16C & AVX.
+
+/// `out[i] = Half4ToFloat4(values[i])`
+NS_INLINE void Half4ArrayToFloat4Array(const Half4 *values, Float4 *out, size_t n) {
+	vuckt_half_lanes_to_float_lanes((const unsigned short *)values, (float *)out, n * (sizeof(Half4) / sizeof(unsigned short)), false);
+}
+/// `out[i] = Half4FromFloat4(values[i])`
+NS_INLINE void Half4ArrayFromFloat4Array(const Float4 *values, Half4 *out, size_t n) {
+	vuckt_half_lanes_from_float_lanes((const float *)values, (unsigned short *)out, n * (sizeof(Half4) / sizeof(unsigned short)), false, false);
+}
+/// `out[i] = Half4FromFloat4TowardZero(values[i])`
+NS_INLINE void Half4ArrayFromFloat4ArrayTowardZero(const Float4 *values, Half4 *out, size_t n) {
+	vuckt_half_lanes_from_float_lanes((const float *)values, (unsigned short *)out, n * (sizeof(Half4) / sizeof(unsigned short)), false, true);
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,20 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Half4.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Half4, x) == sizeof(simd_ushort1),
+	"Half4's first member's size does not match simd_ushort1's on this platform.");
+static_assert(sizeof(Half4) == sizeof(simd_ushort4),
+	"Half4's size does not match simd_ushort4's on this platform.");
+static_assert(sizeof_member(Half4, x) == sizeof_member(simd_ushort4, x),
+	"Half4's first member's size does not match simd_ushort4's first member's on this platform.");
+static_assert(alignof(Half4) == alignof(simd_ushort4),
+	"Half4's alignment requirements does not match simd_ushort4's on this platform.");
+static_assert(sizeof(Half4) / sizeof(unsigned short) == sizeof(Float4) / sizeof(float),
+	"Half4's lane count does not match Float4's on this platform (which the bulk conversions rely on).");
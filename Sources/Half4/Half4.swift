@@ -0,0 +1,159 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension Half4
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements, each rounded to nearest-even half precision.
+	@_transparent public init(_ x:Float, _ y:Float, _ z:Float, _ w:Float) {
+		self = Half4FromFloat4(Float4(x, y, z, w))
+	}
+	
+	/// Initialize to a vector with all elements equal to `scalar` (rounded to nearest-even half precision).
+	@_transparent public init(scalar:Float) {
+		self.init(scalar, scalar, scalar, scalar)
+	}
+	
+	/// Initialize from the elements' binary16 bit patterns.
+	@_transparent public init(bitPatterns value:SIMD4<UInt16>) {
+		self = Half4FromSimd(value)
+	}
+	
+	/// Initialize from a `Float4` value, narrowing each element to half precision per `rounding` (values too large for half becoming ±Inf when rounding to nearest-even, or ±65504 when rounding toward zero).
+	@_alwaysEmitIntoClient public init(_ float4Value:Float4, rounding:HalfRoundingMode = .toNearestOrEven) {
+		switch rounding {
+			case .toNearestOrEven: self = Half4FromFloat4(float4Value)
+			case .towardZero: self = Half4FromFloat4TowardZero(float4Value)
+		}
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Half4 { return Half4(scalar: 0) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	/// Each element widened to `Float`.
+	@_transparent public var asTuple:(x:Float,y:Float,z:Float,w:Float) {
+		let float4Value = Half4ToFloat4(self)
+		return ( float4Value.x, float4Value.y, float4Value.z, float4Value.w )
+	}
+	
+	/// Each element widened to `Float`.
+	@_transparent public var asArray:[Float] {
+		let float4Value = Half4ToFloat4(self)
+		return [ float4Value.x, float4Value.y, float4Value.z, float4Value.w ]
+	}
+	
+	/// Each element widened to `Float` (exactly).
+	@_transparent public var float4Value:Float4 {
+		return Half4ToFloat4(self)
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	/// The elements' binary16 bit patterns.
+	@_transparent public var simdValue:SIMD4<UInt16> {
+		return Half4ToSimd(self)
+	}
+}
+
+
+extension Float4
+{
+	/// Initialize from a `Half4` value, widening each element (exactly).
+	@_transparent public init(_ half4Value:Half4) {
+		self = Half4ToFloat4(half4Value)
+	}
+}
+
+
+extension Half4 : CustomStringConvertible
+{
+	public var description:String {
+		let float4Value = Half4ToFloat4(self)
+		return "(\(float4Value.x), \(float4Value.y), \(float4Value.z), \(float4Value.w))"
+	}
+}
+
+
+/// Compares the elements' bit patterns— so unlike `Float`'s `==`, identical NaNs are equal, & -0 & +0 aren't.
+extension Half4 : Equatable
+{
+	@_transparent public static func ==(a:Half4, b:Half4) -> Bool {
+		return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w
+	}
+}
+
+
+extension Half4 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			hasher.combine(self.x)
+			hasher.combine(self.y)
+			hasher.combine(self.z)
+			hasher.combine(self.w)
+		}
+	#else
+		public var hashValue:Int {
+			return (Int(self.x) << 0) | (Int(self.y) << 16) | (Int(self.z) << 32) | (Int(self.w) << 48)
+		}
+	#endif
+}
+
+
+extension UnsafeBufferPointer where Element == Half4 // Bulk Conversion
+{
+	/// Widens every element into `out` (exactly).  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktBulkConversion(into: out, Half4ArrayToFloat4Array)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float4 // Bulk Conversion
+{
+	/// Narrows every element into `out`, rounding per `rounding`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Half4>, rounding:HalfRoundingMode = .toNearestOrEven) {
+		switch rounding {
+			case .toNearestOrEven: self._vucktBulkConversion(into: out, Half4ArrayFromFloat4Array)
+			case .towardZero: self._vucktBulkConversion(into: out, Half4ArrayFromFloat4ArrayTowardZero)
+		}
+	}
+}
+
+extension Array where Element == Float4
+{
+	/// Widens an array of `Half4`s (exactly).
+	@_alwaysEmitIntoClient public init(_ half4Values:[Half4]) {
+		self = half4Values._vucktBulkConversion(Half4ArrayToFloat4Array)
+	}
+}
+
+extension Array where Element == Half4
+{
+	/// Narrows an array of `Float4`s, rounding per `rounding`.
+	@_alwaysEmitIntoClient public init(_ float4Values:[Float4], rounding:HalfRoundingMode = .toNearestOrEven) {
+		switch rounding {
+			case .toNearestOrEven: self = float4Values._vucktBulkConversion(Half4ArrayFromFloat4Array)
+			case .towardZero: self = float4Values._vucktBulkConversion(Half4ArrayFromFloat4ArrayTowardZero)
+		}
+	}
+}
@@ -0,0 +1,82 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Half4
+{
+	public var x:UInt16
+	public var y:UInt16
+	public var z:UInt16
+	public var w:UInt16
+	
+	public init() {
+		self.x = UInt16()
+		self.y = UInt16()
+		self.z = UInt16()
+		self.w = UInt16()
+	}
+	
+	public init(x:UInt16, y:UInt16, z:UInt16, w:UInt16) {
+		self.x = x
+		self.y = y
+		self.z = z
+		self.w = w
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Half4` struct to `SIMD4<UInt16>` vector using passing-individual-members initialization.
+@_transparent public func Half4ToSimd(_ structValue:Half4) -> SIMD4<UInt16> {
+	return SIMD4<UInt16>(structValue.x, structValue.y, structValue.z, structValue.w)
+}
+/// Converts a `Half4` struct from `SIMD4<UInt16>` vector using passing-individual-members initialization.
+@_transparent public func Half4FromSimd(_ simdValue:SIMD4<UInt16>) -> Half4 {
+	return Half4(x: simdValue.x, y: simdValue.y, z: simdValue.z, w: simdValue.w)
+}
+
+
+
+// MARK: Float4 Conversion
+
+@_alwaysEmitIntoClient public func Half4ToFloat4(_ value:Half4) -> Float4 {
+	return Float4FromSimd(_vucktHalfToFloat(Half4ToSimd(value)))
+}
+@_alwaysEmitIntoClient public func Half4FromFloat4(_ value:Float4) -> Half4 {
+	return Half4FromSimd(_vucktHalfFromFloat(Float4ToSimd(value), towardZero: false))
+}
+@_alwaysEmitIntoClient public func Half4FromFloat4TowardZero(_ value:Float4) -> Half4 {
+	return Half4FromSimd(_vucktHalfFromFloat(Float4ToSimd(value), towardZero: true))
+}
+
+
+
+// MARK: Bulk Conversion
+
+@_alwaysEmitIntoClient public func Half4ArrayToFloat4Array(_ values:UnsafePointer<Half4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Half4ToFloat4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Half4ArrayFromFloat4Array(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Half4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Half4FromFloat4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Half4ArrayFromFloat4ArrayTowardZero(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Half4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Half4FromFloat4TowardZero(values[i])
+	}
+}
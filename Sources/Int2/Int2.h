@@ -3,12 +3,19 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 #pragma once
 
-#import <Foundation/NSValue.h>
-#import <simd/simd.h>
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#if __OBJC__
+	#import <Foundation/NSValue.h>
+#endif
 
 
 
 NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
 
 
 
@@ -75,21 +82,150 @@ NS_INLINE Int2 Int2ModulusingScalar(int s, Int2 v) {
 	return Int2FromSimd(s % Int2ToSimd(v));
 }
 
-NS_INLINE BOOL Int2LessThan(Int2 a, Int2 b) {
+NS_INLINE bool Int2LessThan(Int2 a, Int2 b) {
 	return simd_all(Int2ToSimd(a) < Int2ToSimd(b));
 }
-NS_INLINE BOOL Int2LessThanOrEqual(Int2 a, Int2 b) {
+NS_INLINE bool Int2LessThanOrEqual(Int2 a, Int2 b) {
 	return simd_all(Int2ToSimd(a) <= Int2ToSimd(b));
 }
-NS_INLINE BOOL Int2GreaterThan(Int2 a, Int2 b) {
+NS_INLINE bool Int2GreaterThan(Int2 a, Int2 b) {
 	return simd_all(Int2ToSimd(a) > Int2ToSimd(b));
 }
-NS_INLINE BOOL Int2GreaterThanOrEqual(Int2 a, Int2 b) {
+NS_INLINE bool Int2GreaterThanOrEqual(Int2 a, Int2 b) {
 	return simd_all(Int2ToSimd(a) >= Int2ToSimd(b));
 }
 
 
 
+#pragma mark Wrapping, Overflow-Reporting & Saturating Arithmetic
+
+// Per-lane variants of `Int2Add()`, `Int2Subtract()`, & `Int2Multiply()` that define (or detect) what happens past `INT_MAX`/`INT_MIN`, built on `VucktPlatform.h`'s integer overflow kernels.
+// The `…ReportingOverflow` forms return the wrapped result & write an overflow mask to `outOverflowMask`: -1 in each lane that overflowed, else 0.
+
+NS_INLINE Int2 Int2AddWrapping(Int2 a, Int2 b) {
+	return Int2FromSimd((simd_int2)((vuckt_simd_uint32x2)Int2ToSimd(a) + (vuckt_simd_uint32x2)Int2ToSimd(b)));
+}
+NS_INLINE Int2 Int2SubtractWrapping(Int2 a, Int2 b) {
+	return Int2FromSimd((simd_int2)((vuckt_simd_uint32x2)Int2ToSimd(a) - (vuckt_simd_uint32x2)Int2ToSimd(b)));
+}
+NS_INLINE Int2 Int2MultiplyWrapping(Int2 a, Int2 b) {
+	return Int2FromSimd((simd_int2)((vuckt_simd_uint32x2)Int2ToSimd(a) * (vuckt_simd_uint32x2)Int2ToSimd(b)));
+}
+
+NS_INLINE Int2 Int2AddReportingOverflow(Int2 a, Int2 b, Int2 *outOverflowMask) {
+	simd_int2 overflowMask;
+	Int2 result = Int2FromSimd(vuckt_simd_add_overflow2(Int2ToSimd(a), Int2ToSimd(b), &overflowMask));
+	*outOverflowMask = Int2FromSimd(overflowMask);
+	return result;
+}
+NS_INLINE Int2 Int2SubtractReportingOverflow(Int2 a, Int2 b, Int2 *outOverflowMask) {
+	simd_int2 overflowMask;
+	Int2 result = Int2FromSimd(vuckt_simd_subtract_overflow2(Int2ToSimd(a), Int2ToSimd(b), &overflowMask));
+	*outOverflowMask = Int2FromSimd(overflowMask);
+	return result;
+}
+NS_INLINE Int2 Int2MultiplyReportingOverflow(Int2 a, Int2 b, Int2 *outOverflowMask) {
+	simd_int2 overflowMask;
+	Int2 result = Int2FromSimd(vuckt_simd_multiply_overflow2(Int2ToSimd(a), Int2ToSimd(b), &overflowMask));
+	*outOverflowMask = Int2FromSimd(overflowMask);
+	return result;
+}
+
+NS_INLINE Int2 Int2AddSaturated(Int2 a, Int2 b) {
+	return Int2FromSimd(vuckt_simd_add_saturated2(Int2ToSimd(a), Int2ToSimd(b)));
+}
+NS_INLINE Int2 Int2SubtractSaturated(Int2 a, Int2 b) {
+	return Int2FromSimd(vuckt_simd_subtract_saturated2(Int2ToSimd(a), Int2ToSimd(b)));
+}
+NS_INLINE Int2 Int2MultiplySaturated(Int2 a, Int2 b) {
+	return Int2FromSimd(vuckt_simd_multiply_saturated2(Int2ToSimd(a), Int2ToSimd(b)));
+}
+
+
+
+#pragma mark Array Operations
+
+// Element-wise operations over `n`-element arrays, for bulk passes that would otherwise pay per-element call & load overhead.
+// `out` may be the same array as an input (for in-place operation), but must not otherwise overlap one.
+// Where possible these loop over the flat `int` lanes rather than per-`Int2`, so the compiler can vectorize across elements at the target's full vector width.
+
+/// `out[i] = a[i] + b[i]` (wrapping on overflow)
+NS_INLINE void Int2AddArrays(const Int2 *a, const Int2 *b, Int2 *out, size_t n) {
+	const int *aLanes = (const int *)a, *bLanes = (const int *)b;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int2) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (int)((unsigned)aLanes[laneI] + (unsigned)bLanes[laneI]);
+	}
+}
+/// `out[i] = a[i] - b[i]` (wrapping on overflow)
+NS_INLINE void Int2SubtractArrays(const Int2 *a, const Int2 *b, Int2 *out, size_t n) {
+	const int *aLanes = (const int *)a, *bLanes = (const int *)b;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int2) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (int)((unsigned)aLanes[laneI] - (unsigned)bLanes[laneI]);
+	}
+}
+/// `out[i] = a[i] * b[i]` (wrapping on overflow)
+NS_INLINE void Int2MultiplyArrays(const Int2 *a, const Int2 *b, Int2 *out, size_t n) {
+	const int *aLanes = (const int *)a, *bLanes = (const int *)b;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int2) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (int)((unsigned)aLanes[laneI] * (unsigned)bLanes[laneI]);
+	}
+}
+/// `out[i] = a[i] / b[i]`
+NS_INLINE void Int2DivideArrays(const Int2 *a, const Int2 *b, Int2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Int2Divide(a[i], b[i]);
+	}
+}
+/// `out[i] = a[i] %% b[i]`
+NS_INLINE void Int2ModulusArrays(const Int2 *a, const Int2 *b, Int2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Int2Modulus(a[i], b[i]);
+	}
+}
+/// `out[i] = -v[i]` (wrapping on overflow)
+NS_INLINE void Int2NegateArray(const Int2 *v, Int2 *out, size_t n) {
+	const int *vLanes = (const int *)v;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int2) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (int)(0u - (unsigned)vLanes[laneI]);
+	}
+}
+/// `out[i] = v[i] * s` (wrapping on overflow)
+NS_INLINE void Int2MultiplyByScalarArray(const Int2 *v, int s, Int2 *out, size_t n) {
+	const int *vLanes = (const int *)v;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int2) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (int)((unsigned)vLanes[laneI] * (unsigned)s);
+	}
+}
+/// `out[i] = v[i] / s`
+NS_INLINE void Int2DivideByScalarArray(const Int2 *v, int s, Int2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Int2DivideByScalar(v[i], s);
+	}
+}
+/// `out[i] = v[i] %% s`
+NS_INLINE void Int2ModulusByScalarArray(const Int2 *v, int s, Int2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Int2ModulusByScalar(v[i], s);
+	}
+}
+
+
+
+#if __OBJC__
 #pragma mark `NSValue`-Wrapping
 
 @interface NSValue (Int2Additions)
@@ -99,7 +235,9 @@ NS_INLINE BOOL Int2GreaterThanOrEqual(Int2 a, Int2 b) {
 @property(nonatomic, readonly) Int2 int2Value;
 
 @end
+#endif // __OBJC__
 
 
 
+VUCKT_DIAGNOSTICS_END
 NS_ASSUME_NONNULL_END
@@ -3,7 +3,14 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
 import Foundation
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
 
 
 
@@ -91,19 +98,19 @@ extension Int2
 	
 	// MARK: commonly-used “presets”
 	
-	public static let zero = Int2(scalar: 0)
+	@_transparent public static var zero:Int2 { return Int2(scalar: 0) }
 	
-	public static let one = Self.positiveOne
-	public static let positiveOne = Int2(scalar: 1)
-	public static let negativeOne = Int2(scalar: -1)
+	@_transparent public static var one:Int2 { return Self.positiveOne }
+	@_transparent public static var positiveOne:Int2 { return Int2(scalar: 1) }
+	@_transparent public static var negativeOne:Int2 { return Int2(scalar: -1) }
 	
-	public static let unitX = Self.unitXPositive
-	public static let unitXPositive = Int2(x: 1)
-	public static let unitY = Self.unitYPositive
-	public static let unitYPositive = Int2(y: 1)
+	@_transparent public static var unitX:Int2 { return Self.unitXPositive }
+	@_transparent public static var unitXPositive:Int2 { return Int2(x: 1) }
+	@_transparent public static var unitY:Int2 { return Self.unitYPositive }
+	@_transparent public static var unitYPositive:Int2 { return Int2(y: 1) }
 	
-	public static let unitXNegative = Int2(x: -1)
-	public static let unitYNegative = Int2(y: -1)
+	@_transparent public static var unitXNegative:Int2 { return Int2(x: -1) }
+	@_transparent public static var unitYNegative:Int2 { return Int2(y: -1) }
 	
 	
 	
@@ -310,10 +317,28 @@ extension Int2 // pseudo-IntegerArithmetic/FixedWidthInteger
 	@_transparent public static func += (v:inout Int2, o:Int2) {
 		v = v + o
 	}
+	/// `a + b` per lane, wrapping on overflow.
+	@_transparent public static func &+ (a:Int2, b:Int2) -> Int2 {
+		return Int2AddWrapping(a, b)
+	}
+	@_transparent public static func &+= (v:inout Int2, o:Int2) {
+		v = v &+ o
+	}
 	
 	#if swift(>=4.0)
 		public func addingReportingOverflow(_ other:Int2) -> (partialValue:Int2,overflow:Bool) {
-			return Int2.doComponentCalculationWithOverflow(self, other, componentCalculationMethod: Int32.addingReportingOverflow)
+			let (partialValue, overflowMask) = self.addingReportingLaneOverflow(other)
+			return (partialValue, overflow: overflowMask != Int2())
+		}
+		/// Like `addingReportingOverflow(_:)`, but reporting which lanes overflowed: `overflowMask` is -1 in each of those, else 0.
+		@_transparent public func addingReportingLaneOverflow(_ other:Int2) -> (partialValue:Int2,overflowMask:Int2) {
+			var overflowMask = Int2()
+			let partialValue = Int2AddReportingOverflow(self, other, &overflowMask)
+			return (partialValue, overflowMask)
+		}
+		/// `self + other` per lane, clamped to `Int32.min`…`Int32.max` rather than overflowing.
+		@_transparent public func addingSaturated(_ other:Int2) -> Int2 {
+			return Int2AddSaturated(self, other)
 		}
 		
 		public func unsafeAdding(_ other:Int2) -> Int2 {
@@ -332,10 +357,28 @@ extension Int2 // pseudo-IntegerArithmetic/FixedWidthInteger
 	@_transparent public static func -= (v:inout Int2, o:Int2) {
 		v = v - o
 	}
+	/// `a - b` per lane, wrapping on overflow.
+	@_transparent public static func &- (a:Int2, b:Int2) -> Int2 {
+		return Int2SubtractWrapping(a, b)
+	}
+	@_transparent public static func &-= (v:inout Int2, o:Int2) {
+		v = v &- o
+	}
 	
 	#if swift(>=4.0)
 		public func subtractingReportingOverflow(_ other:Int2) -> (partialValue:Int2,overflow:Bool) {
-			return Int2.doComponentCalculationWithOverflow(self, other, componentCalculationMethod: Int32.subtractingReportingOverflow)
+			let (partialValue, overflowMask) = self.subtractingReportingLaneOverflow(other)
+			return (partialValue, overflow: overflowMask != Int2())
+		}
+		/// Like `subtractingReportingOverflow(_:)`, but reporting which lanes overflowed: `overflowMask` is -1 in each of those, else 0.
+		@_transparent public func subtractingReportingLaneOverflow(_ other:Int2) -> (partialValue:Int2,overflowMask:Int2) {
+			var overflowMask = Int2()
+			let partialValue = Int2SubtractReportingOverflow(self, other, &overflowMask)
+			return (partialValue, overflowMask)
+		}
+		/// `self - other` per lane, clamped to `Int32.min`…`Int32.max` rather than overflowing.
+		@_transparent public func subtractingSaturated(_ other:Int2) -> Int2 {
+			return Int2SubtractSaturated(self, other)
 		}
 		
 		public func unsafeSubstracting(_ other:Int2) -> Int2 {
@@ -354,10 +397,28 @@ extension Int2 // pseudo-IntegerArithmetic/FixedWidthInteger
 	@_transparent public static func *= (v:inout Int2, o:Int2) {
 		v = v * o
 	}
+	/// `a * b` per lane, wrapping on overflow.
+	@_transparent public static func &* (a:Int2, b:Int2) -> Int2 {
+		return Int2MultiplyWrapping(a, b)
+	}
+	@_transparent public static func &*= (v:inout Int2, o:Int2) {
+		v = v &* o
+	}
 	
 	#if swift(>=4.0)
 		public func multipliedReportingOverflow(by other:Int2) -> (partialValue:Int2,overflow:Bool) {
-			return Int2.doComponentCalculationWithOverflow(self, other, componentCalculationMethod: Int32.multipliedReportingOverflow(by:))
+			let (partialValue, overflowMask) = self.multipliedReportingLaneOverflow(by: other)
+			return (partialValue, overflow: overflowMask != Int2())
+		}
+		/// Like `multipliedReportingOverflow(by:)`, but reporting which lanes overflowed: `overflowMask` is -1 in each of those, else 0.
+		@_transparent public func multipliedReportingLaneOverflow(by other:Int2) -> (partialValue:Int2,overflowMask:Int2) {
+			var overflowMask = Int2()
+			let partialValue = Int2MultiplyReportingOverflow(self, other, &overflowMask)
+			return (partialValue, overflowMask)
+		}
+		/// `self * other` per lane, clamped to `Int32.min`…`Int32.max` rather than overflowing.
+		@_transparent public func multipliedSaturated(by other:Int2) -> Int2 {
+			return Int2MultiplySaturated(self, other)
 		}
 		
 		public func unsafeMultiplied(by other:Int2) -> Int2 {
@@ -469,6 +530,113 @@ extension Int2 // Geometric Math Operations
 }
 
 
+extension UnsafeBufferPointer where Element == Int2 // Bulk Math Operations
+{
+	/// Element-wise `self[i] + other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func add(_ other:UnsafeBufferPointer<Int2>, into out:UnsafeMutableBufferPointer<Int2>) {
+		self._vucktBulkOperation(other, into: out, Int2AddArrays)
+	}
+	/// Element-wise `self[i] - other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func subtract(_ other:UnsafeBufferPointer<Int2>, into out:UnsafeMutableBufferPointer<Int2>) {
+		self._vucktBulkOperation(other, into: out, Int2SubtractArrays)
+	}
+	/// Element-wise `self[i] * other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func multiply(by other:UnsafeBufferPointer<Int2>, into out:UnsafeMutableBufferPointer<Int2>) {
+		self._vucktBulkOperation(other, into: out, Int2MultiplyArrays)
+	}
+	/// Element-wise `self[i] / other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func divide(by other:UnsafeBufferPointer<Int2>, into out:UnsafeMutableBufferPointer<Int2>) {
+		self._vucktBulkOperation(other, into: out, Int2DivideArrays)
+	}
+	/// Element-wise `self[i] % other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:UnsafeBufferPointer<Int2>, into out:UnsafeMutableBufferPointer<Int2>) {
+		self._vucktBulkOperation(other, into: out, Int2ModulusArrays)
+	}
+	/// Element-wise `-self[i]`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func negate(into out:UnsafeMutableBufferPointer<Int2>) {
+		self._vucktBulkOperation(into: out, Int2NegateArray)
+	}
+	/// Element-wise `self[i] * scale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func multiply(by scale:Int32, into out:UnsafeMutableBufferPointer<Int2>) {
+		self._vucktBulkOperation(scale, into: out, Int2MultiplyByScalarArray)
+	}
+	/// Element-wise `self[i] / inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func divide(by inverseScale:Int32, into out:UnsafeMutableBufferPointer<Int2>) {
+		self._vucktBulkOperation(inverseScale, into: out, Int2DivideByScalarArray)
+	}
+	/// Element-wise `self[i] % inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Int32, into out:UnsafeMutableBufferPointer<Int2>) {
+		self._vucktBulkOperation(inverseScale, into: out, Int2ModulusByScalarArray)
+	}
+}
+
+extension Array where Element == Int2 // Bulk Math Operations
+{
+	@_alwaysEmitIntoClient public func adding(_ other:[Int2]) -> [Int2] {
+		return self._vucktBulkOperation(other, Int2AddArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func add(_ other:[Int2]) {
+		self._vucktFormBulkOperation(other, Int2AddArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func subtracting(_ other:[Int2]) -> [Int2] {
+		return self._vucktBulkOperation(other, Int2SubtractArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func subtract(_ other:[Int2]) {
+		self._vucktFormBulkOperation(other, Int2SubtractArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by other:[Int2]) -> [Int2] {
+		return self._vucktBulkOperation(other, Int2MultiplyArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by other:[Int2]) {
+		self._vucktFormBulkOperation(other, Int2MultiplyArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by other:[Int2]) -> [Int2] {
+		return self._vucktBulkOperation(other, Int2DivideArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by other:[Int2]) {
+		self._vucktFormBulkOperation(other, Int2DivideArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:[Int2]) -> [Int2] {
+		return self._vucktBulkOperation(other, Int2ModulusArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy other:[Int2]) {
+		self._vucktFormBulkOperation(other, Int2ModulusArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func negated() -> [Int2] {
+		return self._vucktBulkOperation(Int2NegateArray)
+	}
+	@_alwaysEmitIntoClient public mutating func negate() {
+		self._vucktFormBulkOperation(Int2NegateArray)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by scale:Int32) -> [Int2] {
+		return self._vucktBulkOperation(scale, Int2MultiplyByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by scale:Int32) {
+		self._vucktFormBulkOperation(scale, Int2MultiplyByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by inverseScale:Int32) -> [Int2] {
+		return self._vucktBulkOperation(inverseScale, Int2DivideByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by inverseScale:Int32) {
+		self._vucktFormBulkOperation(inverseScale, Int2DivideByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Int32) -> [Int2] {
+		return self._vucktBulkOperation(inverseScale, Int2ModulusByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy inverseScale:Int32) {
+		self._vucktFormBulkOperation(inverseScale, Int2ModulusByScalarArray)
+	}
+}
+
+
 extension Int2 : Hashable
 {
 	private static let _hashingLargePrimes:[UInt] = [ 982_917_223, 3_572_352_083 ]
@@ -2,7 +2,11 @@
 // @author: Slipp Douglas Thompson
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
 
 
 
@@ -90,3 +94,107 @@ public struct Int2
 @_alwaysEmitIntoClient public func Int2GreaterThanOrEqual(_ a:Int2, _ b:Int2) -> Bool {
 	return all(a.simdValue .>= b.simdValue)
 }
+
+
+
+// MARK: Wrapping, Overflow-Reporting & Saturating Arithmetic
+
+@_alwaysEmitIntoClient public func Int2AddWrapping(_ a:Int2, _ b:Int2) -> Int2 {
+	return Int2FromSimd(Int2ToSimd(a) &+ Int2ToSimd(b))
+}
+@_alwaysEmitIntoClient public func Int2SubtractWrapping(_ a:Int2, _ b:Int2) -> Int2 {
+	return Int2FromSimd(Int2ToSimd(a) &- Int2ToSimd(b))
+}
+@_alwaysEmitIntoClient public func Int2MultiplyWrapping(_ a:Int2, _ b:Int2) -> Int2 {
+	return Int2FromSimd(Int2ToSimd(a) &* Int2ToSimd(b))
+}
+
+@_alwaysEmitIntoClient public func Int2AddReportingOverflow(_ a:Int2, _ b:Int2, _ outOverflowMask:UnsafeMutablePointer<Int2>) -> Int2 {
+	let (a, b) = (Int2ToSimd(a), Int2ToSimd(b))
+	let sum = a &+ b
+	outOverflowMask.pointee = Int2FromSimd(((a ^ sum) & (b ^ sum)) &>> 31)
+	return Int2FromSimd(sum)
+}
+@_alwaysEmitIntoClient public func Int2SubtractReportingOverflow(_ a:Int2, _ b:Int2, _ outOverflowMask:UnsafeMutablePointer<Int2>) -> Int2 {
+	let (a, b) = (Int2ToSimd(a), Int2ToSimd(b))
+	let difference = a &- b
+	outOverflowMask.pointee = Int2FromSimd(((a ^ b) & (a ^ difference)) &>> 31)
+	return Int2FromSimd(difference)
+}
+@_alwaysEmitIntoClient public func Int2MultiplyReportingOverflow(_ a:Int2, _ b:Int2, _ outOverflowMask:UnsafeMutablePointer<Int2>) -> Int2 {
+	let fullProduct = SIMD2<Int64>(truncatingIfNeeded: Int2ToSimd(a)) &* SIMD2<Int64>(truncatingIfNeeded: Int2ToSimd(b))
+	let product = SIMD2<Int32>(truncatingIfNeeded: fullProduct)
+	let highBits = SIMD2<Int32>(truncatingIfNeeded: fullProduct &>> 32)
+	outOverflowMask.pointee = Int2FromSimd(SIMD2<Int32>(repeating: 0).replacing(with: -1, where: highBits .!= (product &>> 31)))
+	return Int2FromSimd(product)
+}
+
+@usableFromInline internal func _vucktInt2Saturate(_ wrapped:Int2, _ overflowMask:Int2, towardSign:SIMD2<Int32>) -> Int2 {
+	let (wrapped, overflowMask) = (Int2ToSimd(wrapped), Int2ToSimd(overflowMask))
+	return Int2FromSimd((((towardSign &>> 31) ^ Int32.max) & overflowMask) | (wrapped & ~overflowMask))
+}
+@_alwaysEmitIntoClient public func Int2AddSaturated(_ a:Int2, _ b:Int2) -> Int2 {
+	var overflowMask = Int2()
+	let sum = Int2AddReportingOverflow(a, b, &overflowMask)
+	return _vucktInt2Saturate(sum, overflowMask, towardSign: Int2ToSimd(a))
+}
+@_alwaysEmitIntoClient public func Int2SubtractSaturated(_ a:Int2, _ b:Int2) -> Int2 {
+	var overflowMask = Int2()
+	let difference = Int2SubtractReportingOverflow(a, b, &overflowMask)
+	return _vucktInt2Saturate(difference, overflowMask, towardSign: Int2ToSimd(a))
+}
+@_alwaysEmitIntoClient public func Int2MultiplySaturated(_ a:Int2, _ b:Int2) -> Int2 {
+	var overflowMask = Int2()
+	let product = Int2MultiplyReportingOverflow(a, b, &overflowMask)
+	return _vucktInt2Saturate(product, overflowMask, towardSign: Int2ToSimd(a) ^ Int2ToSimd(b))
+}
+
+
+
+// MARK: Array Operations
+
+@_alwaysEmitIntoClient public func Int2AddArrays(_ a:UnsafePointer<Int2>, _ b:UnsafePointer<Int2>, _ out:UnsafeMutablePointer<Int2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int2Add(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int2SubtractArrays(_ a:UnsafePointer<Int2>, _ b:UnsafePointer<Int2>, _ out:UnsafeMutablePointer<Int2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int2Subtract(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int2MultiplyArrays(_ a:UnsafePointer<Int2>, _ b:UnsafePointer<Int2>, _ out:UnsafeMutablePointer<Int2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int2Multiply(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int2DivideArrays(_ a:UnsafePointer<Int2>, _ b:UnsafePointer<Int2>, _ out:UnsafeMutablePointer<Int2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int2Divide(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int2ModulusArrays(_ a:UnsafePointer<Int2>, _ b:UnsafePointer<Int2>, _ out:UnsafeMutablePointer<Int2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int2Modulus(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int2NegateArray(_ v:UnsafePointer<Int2>, _ out:UnsafeMutablePointer<Int2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int2Negate(v[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int2MultiplyByScalarArray(_ v:UnsafePointer<Int2>, _ s:Int32, _ out:UnsafeMutablePointer<Int2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int2MultiplyByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Int2DivideByScalarArray(_ v:UnsafePointer<Int2>, _ s:Int32, _ out:UnsafeMutablePointer<Int2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int2DivideByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Int2ModulusByScalarArray(_ v:UnsafePointer<Int2>, _ s:Int32, _ out:UnsafeMutablePointer<Int2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int2ModulusByScalar(v[i], s)
+	}
+}
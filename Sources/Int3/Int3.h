@@ -3,12 +3,19 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 #pragma once
 
-#import <Foundation/NSValue.h>
-#import <simd/simd.h>
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#if __OBJC__
+	#import <Foundation/NSValue.h>
+#endif
 
 
 
 NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
 
 
 
@@ -26,12 +33,24 @@ typedef struct Int3 Int3;
 /// Converts an `Int3` struct to `simd_int3` vector using zero-op/(dangerous?) C-casts.
 /// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
 NS_INLINE simd_int3 Int3ToSimd(Int3 structValue) {
-	return *(simd_int3 *)&structValue;
+	#if VUCKT_SIMD3_IS_SIMD4
+		simd_int3 simdValue;
+		memcpy(&simdValue, &structValue, sizeof simdValue);
+		return __builtin_shuffle(simdValue, (simd_int3){ 0, 1, 2, 2 });
+	#else
+		return *(simd_int3 *)&structValue;
+	#endif
 }
 /// Converts an `Int3` struct from `simd_int3` vector using zero-op/(dangerous?) C-casts.
 /// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
 NS_INLINE Int3 Int3FromSimd(simd_int3 simdValue) {
-	return *(Int3 *)&simdValue;
+	#if VUCKT_SIMD3_IS_SIMD4
+		Int3 structValue;
+		memcpy(&structValue, &simdValue, sizeof structValue);
+		return structValue;
+	#else
+		return *(Int3 *)&simdValue;
+	#endif
 }
 
 
@@ -75,21 +94,235 @@ NS_INLINE Int3 Int3ModulusingScalar(int s, Int3 v) {
 	return Int3FromSimd(s % Int3ToSimd(v));
 }
 
-NS_INLINE BOOL Int3LessThan(Int3 a, Int3 b) {
+NS_INLINE bool Int3LessThan(Int3 a, Int3 b) {
 	return simd_all(Int3ToSimd(a) < Int3ToSimd(b));
 }
-NS_INLINE BOOL Int3LessThanOrEqual(Int3 a, Int3 b) {
+NS_INLINE bool Int3LessThanOrEqual(Int3 a, Int3 b) {
 	return simd_all(Int3ToSimd(a) <= Int3ToSimd(b));
 }
-NS_INLINE BOOL Int3GreaterThan(Int3 a, Int3 b) {
+NS_INLINE bool Int3GreaterThan(Int3 a, Int3 b) {
 	return simd_all(Int3ToSimd(a) > Int3ToSimd(b));
 }
-NS_INLINE BOOL Int3GreaterThanOrEqual(Int3 a, Int3 b) {
+NS_INLINE bool Int3GreaterThanOrEqual(Int3 a, Int3 b) {
 	return simd_all(Int3ToSimd(a) >= Int3ToSimd(b));
 }
 
 
 
+#pragma mark Wrapping, Overflow-Reporting & Saturating Arithmetic
+
+// Per-lane variants of `Int3Add()`, `Int3Subtract()`, & `Int3Multiply()` that define (or detect) what happens past `INT_MAX`/`INT_MIN`, built on `VucktPlatform.h`'s integer overflow kernels.
+// The `…ReportingOverflow` forms return the wrapped result & write an overflow mask to `outOverflowMask`: -1 in each lane that overflowed, else 0.
+// These go through the 4-lane kernels (the lanes past `z` repeating it), by way of `Int3ToSimdInt4()` & `Int3FromSimdInt4()`.
+
+NS_INLINE simd_int4 Int3ToSimdInt4(Int3 v) {
+	return (simd_int4){ v.x, v.y, v.z, v.z };
+}
+NS_INLINE Int3 Int3FromSimdInt4(simd_int4 v) {
+	return (Int3){ v[0], v[1], v[2] };
+}
+
+NS_INLINE Int3 Int3AddWrapping(Int3 a, Int3 b) {
+	return Int3FromSimdInt4((simd_int4)((vuckt_simd_uint32x4)Int3ToSimdInt4(a) + (vuckt_simd_uint32x4)Int3ToSimdInt4(b)));
+}
+NS_INLINE Int3 Int3SubtractWrapping(Int3 a, Int3 b) {
+	return Int3FromSimdInt4((simd_int4)((vuckt_simd_uint32x4)Int3ToSimdInt4(a) - (vuckt_simd_uint32x4)Int3ToSimdInt4(b)));
+}
+NS_INLINE Int3 Int3MultiplyWrapping(Int3 a, Int3 b) {
+	return Int3FromSimdInt4((simd_int4)((vuckt_simd_uint32x4)Int3ToSimdInt4(a) * (vuckt_simd_uint32x4)Int3ToSimdInt4(b)));
+}
+
+NS_INLINE Int3 Int3AddReportingOverflow(Int3 a, Int3 b, Int3 *outOverflowMask) {
+	simd_int4 overflowMask;
+	Int3 result = Int3FromSimdInt4(vuckt_simd_add_overflow4(Int3ToSimdInt4(a), Int3ToSimdInt4(b), &overflowMask));
+	*outOverflowMask = Int3FromSimdInt4(overflowMask);
+	return result;
+}
+NS_INLINE Int3 Int3SubtractReportingOverflow(Int3 a, Int3 b, Int3 *outOverflowMask) {
+	simd_int4 overflowMask;
+	Int3 result = Int3FromSimdInt4(vuckt_simd_subtract_overflow4(Int3ToSimdInt4(a), Int3ToSimdInt4(b), &overflowMask));
+	*outOverflowMask = Int3FromSimdInt4(overflowMask);
+	return result;
+}
+NS_INLINE Int3 Int3MultiplyReportingOverflow(Int3 a, Int3 b, Int3 *outOverflowMask) {
+	simd_int4 overflowMask;
+	Int3 result = Int3FromSimdInt4(vuckt_simd_multiply_overflow4(Int3ToSimdInt4(a), Int3ToSimdInt4(b), &overflowMask));
+	*outOverflowMask = Int3FromSimdInt4(overflowMask);
+	return result;
+}
+
+NS_INLINE Int3 Int3AddSaturated(Int3 a, Int3 b) {
+	return Int3FromSimdInt4(vuckt_simd_add_saturated4(Int3ToSimdInt4(a), Int3ToSimdInt4(b)));
+}
+NS_INLINE Int3 Int3SubtractSaturated(Int3 a, Int3 b) {
+	return Int3FromSimdInt4(vuckt_simd_subtract_saturated4(Int3ToSimdInt4(a), Int3ToSimdInt4(b)));
+}
+NS_INLINE Int3 Int3MultiplySaturated(Int3 a, Int3 b) {
+	return Int3FromSimdInt4(vuckt_simd_multiply_saturated4(Int3ToSimdInt4(a), Int3ToSimdInt4(b)));
+}
+
+
+
+#pragma mark Array Operations
+
+// Element-wise operations over `n`-element arrays, for bulk passes that would otherwise pay per-element call & load overhead.
+// `out` may be the same array as an input (for in-place operation), but must not otherwise overlap one.
+// Each runs on whole elements' 4-lane storage, 2 at a time as one 8-lane vector where `VUCKT_PAIRED_ARRAY_LANES`, so the compiler works across elements at the target's full vector width.
+// Padding lanes are loaded as `0` (`1` for divisors), so nothing uninitialized is ever operated on, & `out`'s padding lanes keep their values.
+
+/// Loads `element`'s 4-lane storage, its padding lane as `padding`.
+NS_INLINE simd_int4 _Int3LoadLanes(const Int3 *element, int padding) {
+	const simd_int4 dataLanes = { -1, -1, -1, 0 };
+	simd_int4 lanes;
+	memcpy(&lanes, element, sizeof lanes);
+	return (lanes & dataLanes) | ((simd_int4){ padding, padding, padding, padding } & ~dataLanes);
+}
+/// Stores `lanes` to `element`'s storage, but for its padding lane, which keeps its value.
+NS_INLINE void _Int3StoreLanes(Int3 *element, simd_int4 lanes) {
+	const simd_int4 dataLanes = { -1, -1, -1, 0 };
+	simd_int4 original;
+	memcpy(&original, element, sizeof original);
+	lanes = (lanes & dataLanes) | (original & ~dataLanes);
+	memcpy(element, &lanes, sizeof lanes);
+}
+#if VUCKT_PAIRED_ARRAY_LANES
+	/// Loads `elements[0]` & `elements[1]`'s storage as lanes 0–3 & 4–7, their padding lanes as `padding`.
+	NS_INLINE simd_int8 _Int3LoadPairLanes(const Int3 *elements, int padding) {
+		const simd_int8 dataLanes = { -1, -1, -1, 0, -1, -1, -1, 0 };
+		simd_int8 lanes;
+		memcpy(&lanes, elements, sizeof lanes);
+		return (lanes & dataLanes) | ((simd_int8){ padding, padding, padding, padding, padding, padding, padding, padding } & ~dataLanes);
+	}
+	/// Stores `lanes` to `elements[0]` & `elements[1]`'s storage, but for their padding lanes, which keep their values.
+	NS_INLINE void _Int3StorePairLanes(Int3 *elements, simd_int8 lanes) {
+		const simd_int8 dataLanes = { -1, -1, -1, 0, -1, -1, -1, 0 };
+		simd_int8 original;
+		memcpy(&original, elements, sizeof original);
+		lanes = (lanes & dataLanes) | (original & ~dataLanes);
+		memcpy(elements, &lanes, sizeof lanes);
+	}
+#endif
+
+/// `out[i] = a[i] + b[i]` (wrapping on overflow)
+NS_INLINE void Int3AddArrays(const Int3 *a, const Int3 *b, Int3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Int3StorePairLanes(&out[i], _Int3LoadPairLanes(&a[i], 0) + _Int3LoadPairLanes(&b[i], 0));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Int3StoreLanes(&out[i], _Int3LoadLanes(&a[i], 0) + _Int3LoadLanes(&b[i], 0));
+	}
+}
+/// `out[i] = a[i] - b[i]` (wrapping on overflow)
+NS_INLINE void Int3SubtractArrays(const Int3 *a, const Int3 *b, Int3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Int3StorePairLanes(&out[i], _Int3LoadPairLanes(&a[i], 0) - _Int3LoadPairLanes(&b[i], 0));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Int3StoreLanes(&out[i], _Int3LoadLanes(&a[i], 0) - _Int3LoadLanes(&b[i], 0));
+	}
+}
+/// `out[i] = a[i] * b[i]` (wrapping on overflow)
+NS_INLINE void Int3MultiplyArrays(const Int3 *a, const Int3 *b, Int3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Int3StorePairLanes(&out[i], _Int3LoadPairLanes(&a[i], 0) * _Int3LoadPairLanes(&b[i], 0));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Int3StoreLanes(&out[i], _Int3LoadLanes(&a[i], 0) * _Int3LoadLanes(&b[i], 0));
+	}
+}
+/// `out[i] = a[i] / b[i]`
+NS_INLINE void Int3DivideArrays(const Int3 *a, const Int3 *b, Int3 *out, size_t n) {
+	// (Each padding lane is divided by 1, never by 0.)
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Int3StorePairLanes(&out[i], _Int3LoadPairLanes(&a[i], 0) / _Int3LoadPairLanes(&b[i], 1));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Int3StoreLanes(&out[i], _Int3LoadLanes(&a[i], 0) / _Int3LoadLanes(&b[i], 1));
+	}
+}
+/// `out[i] = a[i] %% b[i]`
+NS_INLINE void Int3ModulusArrays(const Int3 *a, const Int3 *b, Int3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Int3Modulus(a[i], b[i]);
+	}
+}
+/// `out[i] = -v[i]` (wrapping on overflow)
+NS_INLINE void Int3NegateArray(const Int3 *v, Int3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Int3StorePairLanes(&out[i], -_Int3LoadPairLanes(&v[i], 0));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Int3StoreLanes(&out[i], -_Int3LoadLanes(&v[i], 0));
+	}
+}
+/// `out[i] = v[i] * s` (wrapping on overflow)
+NS_INLINE void Int3MultiplyByScalarArray(const Int3 *v, int s, Int3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Int3StorePairLanes(&out[i], _Int3LoadPairLanes(&v[i], 0) * s);
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Int3StoreLanes(&out[i], _Int3LoadLanes(&v[i], 0) * s);
+	}
+}
+/// `out[i] = v[i] / s`
+NS_INLINE void Int3DivideByScalarArray(const Int3 *v, int s, Int3 *out, size_t n) {
+	// (Each padding lane is divided by 1, never by 0.)
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		const simd_int8 pairDivisor = { s, s, s, 1, s, s, s, 1 };
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Int3StorePairLanes(&out[i], _Int3LoadPairLanes(&v[i], 0) / pairDivisor);
+		}
+	#endif
+	const simd_int4 divisor = { s, s, s, 1 };
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Int3StoreLanes(&out[i], _Int3LoadLanes(&v[i], 0) / divisor);
+	}
+}
+/// `out[i] = v[i] %% s`
+NS_INLINE void Int3ModulusByScalarArray(const Int3 *v, int s, Int3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Int3ModulusByScalar(v[i], s);
+	}
+}
+
+
+
+#if __OBJC__
 #pragma mark `NSValue`-Wrapping
 
 @interface NSValue (Int3Additions)
@@ -99,7 +332,9 @@ NS_INLINE BOOL Int3GreaterThanOrEqual(Int3 a, Int3 b) {
 @property(nonatomic, readonly) Int3 int3Value;
 
 @end
+#endif // __OBJC__
 
 
 
+VUCKT_DIAGNOSTICS_END
 NS_ASSUME_NONNULL_END
@@ -3,7 +3,14 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
 import Foundation
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
 
 
 
@@ -99,22 +106,22 @@ extension Int3
 	
 	// MARK: commonly-used “presets”
 	
-	public static let zero = Int3(scalar: 0)
+	@_transparent public static var zero:Int3 { return Int3(scalar: 0) }
 	
-	public static let one = Self.positiveOne
-	public static let positiveOne = Int3(scalar: 1)
-	public static let negativeOne = Int3(scalar: -1)
+	@_transparent public static var one:Int3 { return Self.positiveOne }
+	@_transparent public static var positiveOne:Int3 { return Int3(scalar: 1) }
+	@_transparent public static var negativeOne:Int3 { return Int3(scalar: -1) }
 	
-	public static let unitX = Self.unitXPositive
-	public static let unitXPositive = Int3(x: 1)
-	public static let unitY = Self.unitYPositive
-	public static let unitYPositive = Int3(y: 1)
-	public static let unitZ = Self.unitZPositive
-	public static let unitZPositive = Int3(z: 1)
+	@_transparent public static var unitX:Int3 { return Self.unitXPositive }
+	@_transparent public static var unitXPositive:Int3 { return Int3(x: 1) }
+	@_transparent public static var unitY:Int3 { return Self.unitYPositive }
+	@_transparent public static var unitYPositive:Int3 { return Int3(y: 1) }
+	@_transparent public static var unitZ:Int3 { return Self.unitZPositive }
+	@_transparent public static var unitZPositive:Int3 { return Int3(z: 1) }
 	
-	public static let unitXNegative = Int3(x: -1)
-	public static let unitYNegative = Int3(y: -1)
-	public static let unitZNegative = Int3(z: -1)
+	@_transparent public static var unitXNegative:Int3 { return Int3(x: -1) }
+	@_transparent public static var unitYNegative:Int3 { return Int3(y: -1) }
+	@_transparent public static var unitZNegative:Int3 { return Int3(z: -1) }
 	
 	
 	
@@ -371,10 +378,28 @@ extension Int3 // pseudo-IntegerArithmetic/FixedWidthInteger
 	@_transparent public static func += (v:inout Int3, o:Int3) {
 		v = v + o
 	}
+	/// `a + b` per lane, wrapping on overflow.
+	@_transparent public static func &+ (a:Int3, b:Int3) -> Int3 {
+		return Int3AddWrapping(a, b)
+	}
+	@_transparent public static func &+= (v:inout Int3, o:Int3) {
+		v = v &+ o
+	}
 	
 	#if swift(>=4.0)
 		public func addingReportingOverflow(_ other:Int3) -> (partialValue:Int3,overflow:Bool) {
-			return Int3.doComponentCalculationWithOverflow(self, other, componentCalculationMethod: Int32.addingReportingOverflow)
+			let (partialValue, overflowMask) = self.addingReportingLaneOverflow(other)
+			return (partialValue, overflow: overflowMask != Int3())
+		}
+		/// Like `addingReportingOverflow(_:)`, but reporting which lanes overflowed: `overflowMask` is -1 in each of those, else 0.
+		@_transparent public func addingReportingLaneOverflow(_ other:Int3) -> (partialValue:Int3,overflowMask:Int3) {
+			var overflowMask = Int3()
+			let partialValue = Int3AddReportingOverflow(self, other, &overflowMask)
+			return (partialValue, overflowMask)
+		}
+		/// `self + other` per lane, clamped to `Int32.min`…`Int32.max` rather than overflowing.
+		@_transparent public func addingSaturated(_ other:Int3) -> Int3 {
+			return Int3AddSaturated(self, other)
 		}
 		
 		public func unsafeAdding(_ other:Int3) -> Int3 {
@@ -393,10 +418,28 @@ extension Int3 // pseudo-IntegerArithmetic/FixedWidthInteger
 	@_transparent public static func -= (v:inout Int3, o:Int3) {
 		v = v - o
 	}
+	/// `a - b` per lane, wrapping on overflow.
+	@_transparent public static func &- (a:Int3, b:Int3) -> Int3 {
+		return Int3SubtractWrapping(a, b)
+	}
+	@_transparent public static func &-= (v:inout Int3, o:Int3) {
+		v = v &- o
+	}
 	
 	#if swift(>=4.0)
 		public func subtractingReportingOverflow(_ other:Int3) -> (partialValue:Int3,overflow:Bool) {
-			return Int3.doComponentCalculationWithOverflow(self, other, componentCalculationMethod: Int32.subtractingReportingOverflow)
+			let (partialValue, overflowMask) = self.subtractingReportingLaneOverflow(other)
+			return (partialValue, overflow: overflowMask != Int3())
+		}
+		/// Like `subtractingReportingOverflow(_:)`, but reporting which lanes overflowed: `overflowMask` is -1 in each of those, else 0.
+		@_transparent public func subtractingReportingLaneOverflow(_ other:Int3) -> (partialValue:Int3,overflowMask:Int3) {
+			var overflowMask = Int3()
+			let partialValue = Int3SubtractReportingOverflow(self, other, &overflowMask)
+			return (partialValue, overflowMask)
+		}
+		/// `self - other` per lane, clamped to `Int32.min`…`Int32.max` rather than overflowing.
+		@_transparent public func subtractingSaturated(_ other:Int3) -> Int3 {
+			return Int3SubtractSaturated(self, other)
 		}
 		
 		public func unsafeSubstracting(_ other:Int3) -> Int3 {
@@ -415,10 +458,28 @@ extension Int3 // pseudo-IntegerArithmetic/FixedWidthInteger
 	@_transparent public static func *= (v:inout Int3, o:Int3) {
 		v = v * o
 	}
+	/// `a * b` per lane, wrapping on overflow.
+	@_transparent public static func &* (a:Int3, b:Int3) -> Int3 {
+		return Int3MultiplyWrapping(a, b)
+	}
+	@_transparent public static func &*= (v:inout Int3, o:Int3) {
+		v = v &* o
+	}
 	
 	#if swift(>=4.0)
 		public func multipliedReportingOverflow(by other:Int3) -> (partialValue:Int3,overflow:Bool) {
-			return Int3.doComponentCalculationWithOverflow(self, other, componentCalculationMethod: Int32.multipliedReportingOverflow(by:))
+			let (partialValue, overflowMask) = self.multipliedReportingLaneOverflow(by: other)
+			return (partialValue, overflow: overflowMask != Int3())
+		}
+		/// Like `multipliedReportingOverflow(by:)`, but reporting which lanes overflowed: `overflowMask` is -1 in each of those, else 0.
+		@_transparent public func multipliedReportingLaneOverflow(by other:Int3) -> (partialValue:Int3,overflowMask:Int3) {
+			var overflowMask = Int3()
+			let partialValue = Int3MultiplyReportingOverflow(self, other, &overflowMask)
+			return (partialValue, overflowMask)
+		}
+		/// `self * other` per lane, clamped to `Int32.min`…`Int32.max` rather than overflowing.
+		@_transparent public func multipliedSaturated(by other:Int3) -> Int3 {
+			return Int3MultiplySaturated(self, other)
 		}
 		
 		public func unsafeMultiplied(by other:Int3) -> Int3 {
@@ -530,6 +591,113 @@ extension Int3 // Geometric Math Operations
 }
 
 
+extension UnsafeBufferPointer where Element == Int3 // Bulk Math Operations
+{
+	/// Element-wise `self[i] + other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func add(_ other:UnsafeBufferPointer<Int3>, into out:UnsafeMutableBufferPointer<Int3>) {
+		self._vucktBulkOperation(other, into: out, Int3AddArrays)
+	}
+	/// Element-wise `self[i] - other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func subtract(_ other:UnsafeBufferPointer<Int3>, into out:UnsafeMutableBufferPointer<Int3>) {
+		self._vucktBulkOperation(other, into: out, Int3SubtractArrays)
+	}
+	/// Element-wise `self[i] * other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func multiply(by other:UnsafeBufferPointer<Int3>, into out:UnsafeMutableBufferPointer<Int3>) {
+		self._vucktBulkOperation(other, into: out, Int3MultiplyArrays)
+	}
+	/// Element-wise `self[i] / other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func divide(by other:UnsafeBufferPointer<Int3>, into out:UnsafeMutableBufferPointer<Int3>) {
+		self._vucktBulkOperation(other, into: out, Int3DivideArrays)
+	}
+	/// Element-wise `self[i] % other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:UnsafeBufferPointer<Int3>, into out:UnsafeMutableBufferPointer<Int3>) {
+		self._vucktBulkOperation(other, into: out, Int3ModulusArrays)
+	}
+	/// Element-wise `-self[i]`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func negate(into out:UnsafeMutableBufferPointer<Int3>) {
+		self._vucktBulkOperation(into: out, Int3NegateArray)
+	}
+	/// Element-wise `self[i] * scale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func multiply(by scale:Int32, into out:UnsafeMutableBufferPointer<Int3>) {
+		self._vucktBulkOperation(scale, into: out, Int3MultiplyByScalarArray)
+	}
+	/// Element-wise `self[i] / inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func divide(by inverseScale:Int32, into out:UnsafeMutableBufferPointer<Int3>) {
+		self._vucktBulkOperation(inverseScale, into: out, Int3DivideByScalarArray)
+	}
+	/// Element-wise `self[i] % inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Int32, into out:UnsafeMutableBufferPointer<Int3>) {
+		self._vucktBulkOperation(inverseScale, into: out, Int3ModulusByScalarArray)
+	}
+}
+
+extension Array where Element == Int3 // Bulk Math Operations
+{
+	@_alwaysEmitIntoClient public func adding(_ other:[Int3]) -> [Int3] {
+		return self._vucktBulkOperation(other, Int3AddArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func add(_ other:[Int3]) {
+		self._vucktFormBulkOperation(other, Int3AddArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func subtracting(_ other:[Int3]) -> [Int3] {
+		return self._vucktBulkOperation(other, Int3SubtractArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func subtract(_ other:[Int3]) {
+		self._vucktFormBulkOperation(other, Int3SubtractArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by other:[Int3]) -> [Int3] {
+		return self._vucktBulkOperation(other, Int3MultiplyArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by other:[Int3]) {
+		self._vucktFormBulkOperation(other, Int3MultiplyArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by other:[Int3]) -> [Int3] {
+		return self._vucktBulkOperation(other, Int3DivideArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by other:[Int3]) {
+		self._vucktFormBulkOperation(other, Int3DivideArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:[Int3]) -> [Int3] {
+		return self._vucktBulkOperation(other, Int3ModulusArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy other:[Int3]) {
+		self._vucktFormBulkOperation(other, Int3ModulusArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func negated() -> [Int3] {
+		return self._vucktBulkOperation(Int3NegateArray)
+	}
+	@_alwaysEmitIntoClient public mutating func negate() {
+		self._vucktFormBulkOperation(Int3NegateArray)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by scale:Int32) -> [Int3] {
+		return self._vucktBulkOperation(scale, Int3MultiplyByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by scale:Int32) {
+		self._vucktFormBulkOperation(scale, Int3MultiplyByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by inverseScale:Int32) -> [Int3] {
+		return self._vucktBulkOperation(inverseScale, Int3DivideByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by inverseScale:Int32) {
+		self._vucktFormBulkOperation(inverseScale, Int3DivideByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Int32) -> [Int3] {
+		return self._vucktBulkOperation(inverseScale, Int3ModulusByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy inverseScale:Int32) {
+		self._vucktFormBulkOperation(inverseScale, Int3ModulusByScalarArray)
+	}
+}
+
+
 extension Int3 : Hashable
 {
 	private static let _hashingLargePrimes:[UInt] = [ 982_917_223, 3_572_352_083, 4_259_235_067 ]
@@ -2,7 +2,11 @@
 // @author: Slipp Douglas Thompson
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
 
 
 
@@ -94,3 +98,106 @@ public struct Int3
 	return all(a.simdValue .>= b.simdValue)
 }
 
+
+
+// MARK: Wrapping, Overflow-Reporting & Saturating Arithmetic
+
+@_alwaysEmitIntoClient public func Int3AddWrapping(_ a:Int3, _ b:Int3) -> Int3 {
+	return Int3FromSimd(Int3ToSimd(a) &+ Int3ToSimd(b))
+}
+@_alwaysEmitIntoClient public func Int3SubtractWrapping(_ a:Int3, _ b:Int3) -> Int3 {
+	return Int3FromSimd(Int3ToSimd(a) &- Int3ToSimd(b))
+}
+@_alwaysEmitIntoClient public func Int3MultiplyWrapping(_ a:Int3, _ b:Int3) -> Int3 {
+	return Int3FromSimd(Int3ToSimd(a) &* Int3ToSimd(b))
+}
+
+@_alwaysEmitIntoClient public func Int3AddReportingOverflow(_ a:Int3, _ b:Int3, _ outOverflowMask:UnsafeMutablePointer<Int3>) -> Int3 {
+	let (a, b) = (Int3ToSimd(a), Int3ToSimd(b))
+	let sum = a &+ b
+	outOverflowMask.pointee = Int3FromSimd(((a ^ sum) & (b ^ sum)) &>> 31)
+	return Int3FromSimd(sum)
+}
+@_alwaysEmitIntoClient public func Int3SubtractReportingOverflow(_ a:Int3, _ b:Int3, _ outOverflowMask:UnsafeMutablePointer<Int3>) -> Int3 {
+	let (a, b) = (Int3ToSimd(a), Int3ToSimd(b))
+	let difference = a &- b
+	outOverflowMask.pointee = Int3FromSimd(((a ^ b) & (a ^ difference)) &>> 31)
+	return Int3FromSimd(difference)
+}
+@_alwaysEmitIntoClient public func Int3MultiplyReportingOverflow(_ a:Int3, _ b:Int3, _ outOverflowMask:UnsafeMutablePointer<Int3>) -> Int3 {
+	let fullProduct = SIMD3<Int64>(truncatingIfNeeded: Int3ToSimd(a)) &* SIMD3<Int64>(truncatingIfNeeded: Int3ToSimd(b))
+	let product = SIMD3<Int32>(truncatingIfNeeded: fullProduct)
+	let highBits = SIMD3<Int32>(truncatingIfNeeded: fullProduct &>> 32)
+	outOverflowMask.pointee = Int3FromSimd(SIMD3<Int32>(repeating: 0).replacing(with: -1, where: highBits .!= (product &>> 31)))
+	return Int3FromSimd(product)
+}
+
+@usableFromInline internal func _vucktInt3Saturate(_ wrapped:Int3, _ overflowMask:Int3, towardSign:SIMD3<Int32>) -> Int3 {
+	let (wrapped, overflowMask) = (Int3ToSimd(wrapped), Int3ToSimd(overflowMask))
+	return Int3FromSimd((((towardSign &>> 31) ^ Int32.max) & overflowMask) | (wrapped & ~overflowMask))
+}
+@_alwaysEmitIntoClient public func Int3AddSaturated(_ a:Int3, _ b:Int3) -> Int3 {
+	var overflowMask = Int3()
+	let sum = Int3AddReportingOverflow(a, b, &overflowMask)
+	return _vucktInt3Saturate(sum, overflowMask, towardSign: Int3ToSimd(a))
+}
+@_alwaysEmitIntoClient public func Int3SubtractSaturated(_ a:Int3, _ b:Int3) -> Int3 {
+	var overflowMask = Int3()
+	let difference = Int3SubtractReportingOverflow(a, b, &overflowMask)
+	return _vucktInt3Saturate(difference, overflowMask, towardSign: Int3ToSimd(a))
+}
+@_alwaysEmitIntoClient public func Int3MultiplySaturated(_ a:Int3, _ b:Int3) -> Int3 {
+	var overflowMask = Int3()
+	let product = Int3MultiplyReportingOverflow(a, b, &overflowMask)
+	return _vucktInt3Saturate(product, overflowMask, towardSign: Int3ToSimd(a) ^ Int3ToSimd(b))
+}
+
+
+
+// MARK: Array Operations
+
+@_alwaysEmitIntoClient public func Int3AddArrays(_ a:UnsafePointer<Int3>, _ b:UnsafePointer<Int3>, _ out:UnsafeMutablePointer<Int3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int3Add(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int3SubtractArrays(_ a:UnsafePointer<Int3>, _ b:UnsafePointer<Int3>, _ out:UnsafeMutablePointer<Int3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int3Subtract(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int3MultiplyArrays(_ a:UnsafePointer<Int3>, _ b:UnsafePointer<Int3>, _ out:UnsafeMutablePointer<Int3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int3Multiply(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int3DivideArrays(_ a:UnsafePointer<Int3>, _ b:UnsafePointer<Int3>, _ out:UnsafeMutablePointer<Int3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int3Divide(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int3ModulusArrays(_ a:UnsafePointer<Int3>, _ b:UnsafePointer<Int3>, _ out:UnsafeMutablePointer<Int3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int3Modulus(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int3NegateArray(_ v:UnsafePointer<Int3>, _ out:UnsafeMutablePointer<Int3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int3Negate(v[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int3MultiplyByScalarArray(_ v:UnsafePointer<Int3>, _ s:Int32, _ out:UnsafeMutablePointer<Int3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int3MultiplyByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Int3DivideByScalarArray(_ v:UnsafePointer<Int3>, _ s:Int32, _ out:UnsafeMutablePointer<Int3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int3DivideByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Int3ModulusByScalarArray(_ v:UnsafePointer<Int3>, _ s:Int32, _ out:UnsafeMutablePointer<Int3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int3ModulusByScalar(v[i], s)
+	}
+}
@@ -3,12 +3,19 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 #pragma once
 
-#import <Foundation/NSValue.h>
-#import <simd/simd.h>
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#if __OBJC__
+	#import <Foundation/NSValue.h>
+#endif
 
 
 
 NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
 
 
 
@@ -75,21 +82,150 @@ NS_INLINE Int4 Int4ModulusingScalar(int s, Int4 v) {
 	return Int4FromSimd(s % Int4ToSimd(v));
 }
 
-NS_INLINE BOOL Int4LessThan(Int4 a, Int4 b) {
+NS_INLINE bool Int4LessThan(Int4 a, Int4 b) {
 	return simd_all(Int4ToSimd(a) < Int4ToSimd(b));
 }
-NS_INLINE BOOL Int4LessThanOrEqual(Int4 a, Int4 b) {
+NS_INLINE bool Int4LessThanOrEqual(Int4 a, Int4 b) {
 	return simd_all(Int4ToSimd(a) <= Int4ToSimd(b));
 }
-NS_INLINE BOOL Int4GreaterThan(Int4 a, Int4 b) {
+NS_INLINE bool Int4GreaterThan(Int4 a, Int4 b) {
 	return simd_all(Int4ToSimd(a) > Int4ToSimd(b));
 }
-NS_INLINE BOOL Int4GreaterThanOrEqual(Int4 a, Int4 b) {
+NS_INLINE bool Int4GreaterThanOrEqual(Int4 a, Int4 b) {
 	return simd_all(Int4ToSimd(a) >= Int4ToSimd(b));
 }
 
 
 
+#pragma mark Wrapping, Overflow-Reporting & Saturating Arithmetic
+
+// Per-lane variants of `Int4Add()`, `Int4Subtract()`, & `Int4Multiply()` that define (or detect) what happens past `INT_MAX`/`INT_MIN`, built on `VucktPlatform.h`'s integer overflow kernels.
+// The `…ReportingOverflow` forms return the wrapped result & write an overflow mask to `outOverflowMask`: -1 in each lane that overflowed, else 0.
+
+NS_INLINE Int4 Int4AddWrapping(Int4 a, Int4 b) {
+	return Int4FromSimd((simd_int4)((vuckt_simd_uint32x4)Int4ToSimd(a) + (vuckt_simd_uint32x4)Int4ToSimd(b)));
+}
+NS_INLINE Int4 Int4SubtractWrapping(Int4 a, Int4 b) {
+	return Int4FromSimd((simd_int4)((vuckt_simd_uint32x4)Int4ToSimd(a) - (vuckt_simd_uint32x4)Int4ToSimd(b)));
+}
+NS_INLINE Int4 Int4MultiplyWrapping(Int4 a, Int4 b) {
+	return Int4FromSimd((simd_int4)((vuckt_simd_uint32x4)Int4ToSimd(a) * (vuckt_simd_uint32x4)Int4ToSimd(b)));
+}
+
+NS_INLINE Int4 Int4AddReportingOverflow(Int4 a, Int4 b, Int4 *outOverflowMask) {
+	simd_int4 overflowMask;
+	Int4 result = Int4FromSimd(vuckt_simd_add_overflow4(Int4ToSimd(a), Int4ToSimd(b), &overflowMask));
+	*outOverflowMask = Int4FromSimd(overflowMask);
+	return result;
+}
+NS_INLINE Int4 Int4SubtractReportingOverflow(Int4 a, Int4 b, Int4 *outOverflowMask) {
+	simd_int4 overflowMask;
+	Int4 result = Int4FromSimd(vuckt_simd_subtract_overflow4(Int4ToSimd(a), Int4ToSimd(b), &overflowMask));
+	*outOverflowMask = Int4FromSimd(overflowMask);
+	return result;
+}
+NS_INLINE Int4 Int4MultiplyReportingOverflow(Int4 a, Int4 b, Int4 *outOverflowMask) {
+	simd_int4 overflowMask;
+	Int4 result = Int4FromSimd(vuckt_simd_multiply_overflow4(Int4ToSimd(a), Int4ToSimd(b), &overflowMask));
+	*outOverflowMask = Int4FromSimd(overflowMask);
+	return result;
+}
+
+NS_INLINE Int4 Int4AddSaturated(Int4 a, Int4 b) {
+	return Int4FromSimd(vuckt_simd_add_saturated4(Int4ToSimd(a), Int4ToSimd(b)));
+}
+NS_INLINE Int4 Int4SubtractSaturated(Int4 a, Int4 b) {
+	return Int4FromSimd(vuckt_simd_subtract_saturated4(Int4ToSimd(a), Int4ToSimd(b)));
+}
+NS_INLINE Int4 Int4MultiplySaturated(Int4 a, Int4 b) {
+	return Int4FromSimd(vuckt_simd_multiply_saturated4(Int4ToSimd(a), Int4ToSimd(b)));
+}
+
+
+
+#pragma mark Array Operations
+
+// Element-wise operations over `n`-element arrays, for bulk passes that would otherwise pay per-element call & load overhead.
+// `out` may be the same array as an input (for in-place operation), but must not otherwise overlap one.
+// Where possible these loop over the flat `int` lanes rather than per-`Int4`, so the compiler can vectorize across elements at the target's full vector width.
+
+/// `out[i] = a[i] + b[i]` (wrapping on overflow)
+NS_INLINE void Int4AddArrays(const Int4 *a, const Int4 *b, Int4 *out, size_t n) {
+	const int *aLanes = (const int *)a, *bLanes = (const int *)b;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int4) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (int)((unsigned)aLanes[laneI] + (unsigned)bLanes[laneI]);
+	}
+}
+/// `out[i] = a[i] - b[i]` (wrapping on overflow)
+NS_INLINE void Int4SubtractArrays(const Int4 *a, const Int4 *b, Int4 *out, size_t n) {
+	const int *aLanes = (const int *)a, *bLanes = (const int *)b;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int4) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (int)((unsigned)aLanes[laneI] - (unsigned)bLanes[laneI]);
+	}
+}
+/// `out[i] = a[i] * b[i]` (wrapping on overflow)
+NS_INLINE void Int4MultiplyArrays(const Int4 *a, const Int4 *b, Int4 *out, size_t n) {
+	const int *aLanes = (const int *)a, *bLanes = (const int *)b;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int4) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (int)((unsigned)aLanes[laneI] * (unsigned)bLanes[laneI]);
+	}
+}
+/// `out[i] = a[i] / b[i]`
+NS_INLINE void Int4DivideArrays(const Int4 *a, const Int4 *b, Int4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Int4Divide(a[i], b[i]);
+	}
+}
+/// `out[i] = a[i] %% b[i]`
+NS_INLINE void Int4ModulusArrays(const Int4 *a, const Int4 *b, Int4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Int4Modulus(a[i], b[i]);
+	}
+}
+/// `out[i] = -v[i]` (wrapping on overflow)
+NS_INLINE void Int4NegateArray(const Int4 *v, Int4 *out, size_t n) {
+	const int *vLanes = (const int *)v;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int4) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (int)(0u - (unsigned)vLanes[laneI]);
+	}
+}
+/// `out[i] = v[i] * s` (wrapping on overflow)
+NS_INLINE void Int4MultiplyByScalarArray(const Int4 *v, int s, Int4 *out, size_t n) {
+	const int *vLanes = (const int *)v;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int4) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (int)((unsigned)vLanes[laneI] * (unsigned)s);
+	}
+}
+/// `out[i] = v[i] / s`
+NS_INLINE void Int4DivideByScalarArray(const Int4 *v, int s, Int4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Int4DivideByScalar(v[i], s);
+	}
+}
+/// `out[i] = v[i] %% s`
+NS_INLINE void Int4ModulusByScalarArray(const Int4 *v, int s, Int4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Int4ModulusByScalar(v[i], s);
+	}
+}
+
+
+
+#if __OBJC__
 #pragma mark `NSValue`-Wrapping
 
 @interface NSValue (Int4Additions)
@@ -99,7 +235,9 @@ NS_INLINE BOOL Int4GreaterThanOrEqual(Int4 a, Int4 b) {
 @property(nonatomic, readonly) Int4 int4Value;
 
 @end
+#endif // __OBJC__
 
 
 
+VUCKT_DIAGNOSTICS_END
 NS_ASSUME_NONNULL_END
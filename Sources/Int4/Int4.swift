@@ -3,7 +3,14 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
 import Foundation
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
 
 
 
@@ -135,25 +142,25 @@ extension Int4
 	
 	// MARK: commonly-used “presets”
 	
-	public static let zero = Int4(scalar: 0)
+	@_transparent public static var zero:Int4 { return Int4(scalar: 0) }
 	
-	public static let one = Self.positiveOne
-	public static let positiveOne = Int4(scalar: 1)
-	public static let negativeOne = Int4(scalar: -1)
+	@_transparent public static var one:Int4 { return Self.positiveOne }
+	@_transparent public static var positiveOne:Int4 { return Int4(scalar: 1) }
+	@_transparent public static var negativeOne:Int4 { return Int4(scalar: -1) }
 	
-	public static let unitX = Self.unitXPositive
-	public static let unitXPositive = Int4(x: 1)
-	public static let unitY = Self.unitYPositive
-	public static let unitYPositive = Int4(y: 1)
-	public static let unitZ = Self.unitZPositive
-	public static let unitZPositive = Int4(z: 1)
-	public static let unitW = Self.unitWPositive
-	public static let unitWPositive = Int4(w: 1)
+	@_transparent public static var unitX:Int4 { return Self.unitXPositive }
+	@_transparent public static var unitXPositive:Int4 { return Int4(x: 1) }
+	@_transparent public static var unitY:Int4 { return Self.unitYPositive }
+	@_transparent public static var unitYPositive:Int4 { return Int4(y: 1) }
+	@_transparent public static var unitZ:Int4 { return Self.unitZPositive }
+	@_transparent public static var unitZPositive:Int4 { return Int4(z: 1) }
+	@_transparent public static var unitW:Int4 { return Self.unitWPositive }
+	@_transparent public static var unitWPositive:Int4 { return Int4(w: 1) }
 	
-	public static let unitXNegative = Int4(x: -1)
-	public static let unitYNegative = Int4(y: -1)
-	public static let unitZNegative = Int4(z: -1)
-	public static let unitWNegative = Int4(w: -1)
+	@_transparent public static var unitXNegative:Int4 { return Int4(x: -1) }
+	@_transparent public static var unitYNegative:Int4 { return Int4(y: -1) }
+	@_transparent public static var unitZNegative:Int4 { return Int4(z: -1) }
+	@_transparent public static var unitWNegative:Int4 { return Int4(w: -1) }
 	
 	
 	
@@ -612,10 +619,28 @@ extension Int4 // pseudo-IntegerArithmetic/FixedWidthInteger
 	@_transparent public static func += (v:inout Int4, o:Int4) {
 		v = v + o
 	}
+	/// `a + b` per lane, wrapping on overflow.
+	@_transparent public static func &+ (a:Int4, b:Int4) -> Int4 {
+		return Int4AddWrapping(a, b)
+	}
+	@_transparent public static func &+= (v:inout Int4, o:Int4) {
+		v = v &+ o
+	}
 	
 	#if swift(>=4.0)
 		public func addingReportingOverflow(_ other:Int4) -> (partialValue:Int4,overflow:Bool) {
-			return Int4.doComponentCalculationWithOverflow(self, other, componentCalculationMethod: Int32.addingReportingOverflow)
+			let (partialValue, overflowMask) = self.addingReportingLaneOverflow(other)
+			return (partialValue, overflow: overflowMask != Int4())
+		}
+		/// Like `addingReportingOverflow(_:)`, but reporting which lanes overflowed: `overflowMask` is -1 in each of those, else 0.
+		@_transparent public func addingReportingLaneOverflow(_ other:Int4) -> (partialValue:Int4,overflowMask:Int4) {
+			var overflowMask = Int4()
+			let partialValue = Int4AddReportingOverflow(self, other, &overflowMask)
+			return (partialValue, overflowMask)
+		}
+		/// `self + other` per lane, clamped to `Int32.min`…`Int32.max` rather than overflowing.
+		@_transparent public func addingSaturated(_ other:Int4) -> Int4 {
+			return Int4AddSaturated(self, other)
 		}
 		
 		public func unsafeAdding(_ other:Int4) -> Int4 {
@@ -634,10 +659,28 @@ extension Int4 // pseudo-IntegerArithmetic/FixedWidthInteger
 	@_transparent public static func -= (v:inout Int4, o:Int4) {
 		v = v - o
 	}
+	/// `a - b` per lane, wrapping on overflow.
+	@_transparent public static func &- (a:Int4, b:Int4) -> Int4 {
+		return Int4SubtractWrapping(a, b)
+	}
+	@_transparent public static func &-= (v:inout Int4, o:Int4) {
+		v = v &- o
+	}
 	
 	#if swift(>=4.0)
 		public func subtractingReportingOverflow(_ other:Int4) -> (partialValue:Int4,overflow:Bool) {
-			return Int4.doComponentCalculationWithOverflow(self, other, componentCalculationMethod: Int32.subtractingReportingOverflow)
+			let (partialValue, overflowMask) = self.subtractingReportingLaneOverflow(other)
+			return (partialValue, overflow: overflowMask != Int4())
+		}
+		/// Like `subtractingReportingOverflow(_:)`, but reporting which lanes overflowed: `overflowMask` is -1 in each of those, else 0.
+		@_transparent public func subtractingReportingLaneOverflow(_ other:Int4) -> (partialValue:Int4,overflowMask:Int4) {
+			var overflowMask = Int4()
+			let partialValue = Int4SubtractReportingOverflow(self, other, &overflowMask)
+			return (partialValue, overflowMask)
+		}
+		/// `self - other` per lane, clamped to `Int32.min`…`Int32.max` rather than overflowing.
+		@_transparent public func subtractingSaturated(_ other:Int4) -> Int4 {
+			return Int4SubtractSaturated(self, other)
 		}
 		
 		public func unsafeSubstracting(_ other:Int4) -> Int4 {
@@ -656,10 +699,28 @@ extension Int4 // pseudo-IntegerArithmetic/FixedWidthInteger
 	@_transparent public static func *= (v:inout Int4, o:Int4) {
 		v = v * o
 	}
+	/// `a * b` per lane, wrapping on overflow.
+	@_transparent public static func &* (a:Int4, b:Int4) -> Int4 {
+		return Int4MultiplyWrapping(a, b)
+	}
+	@_transparent public static func &*= (v:inout Int4, o:Int4) {
+		v = v &* o
+	}
 	
 	#if swift(>=4.0)
 		public func multipliedReportingOverflow(by other:Int4) -> (partialValue:Int4,overflow:Bool) {
-			return Int4.doComponentCalculationWithOverflow(self, other, componentCalculationMethod: Int32.multipliedReportingOverflow(by:))
+			let (partialValue, overflowMask) = self.multipliedReportingLaneOverflow(by: other)
+			return (partialValue, overflow: overflowMask != Int4())
+		}
+		/// Like `multipliedReportingOverflow(by:)`, but reporting which lanes overflowed: `overflowMask` is -1 in each of those, else 0.
+		@_transparent public func multipliedReportingLaneOverflow(by other:Int4) -> (partialValue:Int4,overflowMask:Int4) {
+			var overflowMask = Int4()
+			let partialValue = Int4MultiplyReportingOverflow(self, other, &overflowMask)
+			return (partialValue, overflowMask)
+		}
+		/// `self * other` per lane, clamped to `Int32.min`…`Int32.max` rather than overflowing.
+		@_transparent public func multipliedSaturated(by other:Int4) -> Int4 {
+			return Int4MultiplySaturated(self, other)
 		}
 		
 		public func unsafeMultiplied(by other:Int4) -> Int4 {
@@ -771,6 +832,176 @@ extension Int4 // Geometric Math Operations
 }
 
 
+extension UnsafeBufferPointer where Element == Int4 // Bulk Math Operations
+{
+	/// Element-wise `self[i] + other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func add(_ other:UnsafeBufferPointer<Int4>, into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkOperation(other, into: out, Int4AddArrays)
+	}
+	/// Element-wise `self[i] - other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func subtract(_ other:UnsafeBufferPointer<Int4>, into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkOperation(other, into: out, Int4SubtractArrays)
+	}
+	/// Element-wise `self[i] * other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func multiply(by other:UnsafeBufferPointer<Int4>, into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkOperation(other, into: out, Int4MultiplyArrays)
+	}
+	/// Element-wise `self[i] / other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func divide(by other:UnsafeBufferPointer<Int4>, into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkOperation(other, into: out, Int4DivideArrays)
+	}
+	/// Element-wise `self[i] % other[i]`, written to `out`.  (All three buffers must have the same count; `out` may be the memory of `self` or `other`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:UnsafeBufferPointer<Int4>, into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkOperation(other, into: out, Int4ModulusArrays)
+	}
+	/// Element-wise `-self[i]`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func negate(into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkOperation(into: out, Int4NegateArray)
+	}
+	/// Element-wise `self[i] * scale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func multiply(by scale:Int32, into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkOperation(scale, into: out, Int4MultiplyByScalarArray)
+	}
+	/// Element-wise `self[i] / inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func divide(by inverseScale:Int32, into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkOperation(inverseScale, into: out, Int4DivideByScalarArray)
+	}
+	/// Element-wise `self[i] % inverseScale`, written to `out`.  (Both buffers must have the same count; `out` may be the memory of `self`.)
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Int32, into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkOperation(inverseScale, into: out, Int4ModulusByScalarArray)
+	}
+}
+
+extension Array where Element == Int4 // Bulk Math Operations
+{
+	@_alwaysEmitIntoClient public func adding(_ other:[Int4]) -> [Int4] {
+		return self._vucktBulkOperation(other, Int4AddArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func add(_ other:[Int4]) {
+		self._vucktFormBulkOperation(other, Int4AddArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func subtracting(_ other:[Int4]) -> [Int4] {
+		return self._vucktBulkOperation(other, Int4SubtractArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func subtract(_ other:[Int4]) {
+		self._vucktFormBulkOperation(other, Int4SubtractArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by other:[Int4]) -> [Int4] {
+		return self._vucktBulkOperation(other, Int4MultiplyArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by other:[Int4]) {
+		self._vucktFormBulkOperation(other, Int4MultiplyArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by other:[Int4]) -> [Int4] {
+		return self._vucktBulkOperation(other, Int4DivideArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by other:[Int4]) {
+		self._vucktFormBulkOperation(other, Int4DivideArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy other:[Int4]) -> [Int4] {
+		return self._vucktBulkOperation(other, Int4ModulusArrays)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy other:[Int4]) {
+		self._vucktFormBulkOperation(other, Int4ModulusArrays)
+	}
+	
+	@_alwaysEmitIntoClient public func negated() -> [Int4] {
+		return self._vucktBulkOperation(Int4NegateArray)
+	}
+	@_alwaysEmitIntoClient public mutating func negate() {
+		self._vucktFormBulkOperation(Int4NegateArray)
+	}
+	
+	@_alwaysEmitIntoClient public func multiplied(by scale:Int32) -> [Int4] {
+		return self._vucktBulkOperation(scale, Int4MultiplyByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func multiply(by scale:Int32) {
+		self._vucktFormBulkOperation(scale, Int4MultiplyByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func divided(by inverseScale:Int32) -> [Int4] {
+		return self._vucktBulkOperation(inverseScale, Int4DivideByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func divide(by inverseScale:Int32) {
+		self._vucktFormBulkOperation(inverseScale, Int4DivideByScalarArray)
+	}
+	
+	@_alwaysEmitIntoClient public func remainder(dividingBy inverseScale:Int32) -> [Int4] {
+		return self._vucktBulkOperation(inverseScale, Int4ModulusByScalarArray)
+	}
+	@_alwaysEmitIntoClient public mutating func formRemainder(dividingBy inverseScale:Int32) {
+		self._vucktFormBulkOperation(inverseScale, Int4ModulusByScalarArray)
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == Int4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `simd_int4`s (`SIMD4<Int32>`s), in place: `Int4` is laid out as `simd_int4` is (see the `static_assert`s in `Int4.mm`), so nothing's copied.  (Except on the Swift backend, whose `Int4`s are only 4-byte aligned; there they're converted through a temporary buffer.)
+	@_alwaysEmitIntoClient public func withSimdMemoryRebound<Result>(_ body:(UnsafeBufferPointer<simd_int4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: simd_int4.self, converting: Int4ToSimd, body)
+	}
+}
+
+extension UnsafeMutableBufferPointer where Element == Int4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as mutable `simd_int4`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withSimdMemoryRebound<Result>(_ body:(UnsafeMutableBufferPointer<simd_int4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: simd_int4.self, converting: Int4ToSimd, back: Int4FromSimd, body)
+	}
+}
+
+extension Array where Element == Int4 // Zero-Copy Views
+{
+	/// One component of each element (e.g. `components(\.x)`), viewed in place rather than copied out.
+	@_alwaysEmitIntoClient public func components(_ component:KeyPath<Int4, Int32>) -> StridedArrayView<Int4, Int32> {
+		return StridedArrayView(self, field: component)
+	}
+	
+	/// Calls `body` with the elements as `simd_int4`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withUnsafeSimdBufferPointer<Result>(_ body:(UnsafeBufferPointer<simd_int4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeBufferPointer{ try $0.withSimdMemoryRebound(body) }
+	}
+	/// Calls `body` with the elements as mutable `simd_int4`s, in place— see `UnsafeBufferPointer.withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public mutating func withUnsafeMutableSimdBufferPointer<Result>(_ body:(UnsafeMutableBufferPointer<simd_int4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeMutableBufferPointer{ try $0.withSimdMemoryRebound(body) }
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == simd_int4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `Int4`s, in place— see the `Int4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withInt4MemoryRebound<Result>(_ body:(UnsafeBufferPointer<Int4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: Int4.self, converting: Int4FromSimd, body)
+	}
+}
+
+extension UnsafeMutableBufferPointer where Element == simd_int4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as mutable `Int4`s, in place— see the `Int4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withInt4MemoryRebound<Result>(_ body:(UnsafeMutableBufferPointer<Int4>) throws -> Result) rethrows -> Result {
+		return try self._vucktWithReinterpretedBuffer(as: Int4.self, converting: Int4FromSimd, back: Int4ToSimd, body)
+	}
+}
+
+extension Array where Element == simd_int4 // Zero-Copy Views
+{
+	/// Calls `body` with the elements as `Int4`s, in place— see the `Int4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public func withUnsafeInt4BufferPointer<Result>(_ body:(UnsafeBufferPointer<Int4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeBufferPointer{ try $0.withInt4MemoryRebound(body) }
+	}
+	/// Calls `body` with the elements as mutable `Int4`s, in place— see the `Int4` `withSimdMemoryRebound(_:)`.
+	@_alwaysEmitIntoClient public mutating func withUnsafeMutableInt4BufferPointer<Result>(_ body:(UnsafeMutableBufferPointer<Int4>) throws -> Result) rethrows -> Result {
+		return try self.withUnsafeMutableBufferPointer{ try $0.withInt4MemoryRebound(body) }
+	}
+}
+
+
 extension Int4 : Hashable
 {
 	private static let _hashingLargePrimes:[UInt] = [ 982_917_223, 3_572_352_083, 4_259_235_067, 454_923_701 ]
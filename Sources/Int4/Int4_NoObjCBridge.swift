@@ -2,7 +2,11 @@
 // @author: Slipp Douglas Thompson
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
 
 
 
@@ -97,3 +101,106 @@ public struct Int4
 	return all(a.simdValue .>= b.simdValue)
 }
 
+
+
+// MARK: Wrapping, Overflow-Reporting & Saturating Arithmetic
+
+@_alwaysEmitIntoClient public func Int4AddWrapping(_ a:Int4, _ b:Int4) -> Int4 {
+	return Int4FromSimd(Int4ToSimd(a) &+ Int4ToSimd(b))
+}
+@_alwaysEmitIntoClient public func Int4SubtractWrapping(_ a:Int4, _ b:Int4) -> Int4 {
+	return Int4FromSimd(Int4ToSimd(a) &- Int4ToSimd(b))
+}
+@_alwaysEmitIntoClient public func Int4MultiplyWrapping(_ a:Int4, _ b:Int4) -> Int4 {
+	return Int4FromSimd(Int4ToSimd(a) &* Int4ToSimd(b))
+}
+
+@_alwaysEmitIntoClient public func Int4AddReportingOverflow(_ a:Int4, _ b:Int4, _ outOverflowMask:UnsafeMutablePointer<Int4>) -> Int4 {
+	let (a, b) = (Int4ToSimd(a), Int4ToSimd(b))
+	let sum = a &+ b
+	outOverflowMask.pointee = Int4FromSimd(((a ^ sum) & (b ^ sum)) &>> 31)
+	return Int4FromSimd(sum)
+}
+@_alwaysEmitIntoClient public func Int4SubtractReportingOverflow(_ a:Int4, _ b:Int4, _ outOverflowMask:UnsafeMutablePointer<Int4>) -> Int4 {
+	let (a, b) = (Int4ToSimd(a), Int4ToSimd(b))
+	let difference = a &- b
+	outOverflowMask.pointee = Int4FromSimd(((a ^ b) & (a ^ difference)) &>> 31)
+	return Int4FromSimd(difference)
+}
+@_alwaysEmitIntoClient public func Int4MultiplyReportingOverflow(_ a:Int4, _ b:Int4, _ outOverflowMask:UnsafeMutablePointer<Int4>) -> Int4 {
+	let fullProduct = SIMD4<Int64>(truncatingIfNeeded: Int4ToSimd(a)) &* SIMD4<Int64>(truncatingIfNeeded: Int4ToSimd(b))
+	let product = SIMD4<Int32>(truncatingIfNeeded: fullProduct)
+	let highBits = SIMD4<Int32>(truncatingIfNeeded: fullProduct &>> 32)
+	outOverflowMask.pointee = Int4FromSimd(SIMD4<Int32>(repeating: 0).replacing(with: -1, where: highBits .!= (product &>> 31)))
+	return Int4FromSimd(product)
+}
+
+@usableFromInline internal func _vucktInt4Saturate(_ wrapped:Int4, _ overflowMask:Int4, towardSign:SIMD4<Int32>) -> Int4 {
+	let (wrapped, overflowMask) = (Int4ToSimd(wrapped), Int4ToSimd(overflowMask))
+	return Int4FromSimd((((towardSign &>> 31) ^ Int32.max) & overflowMask) | (wrapped & ~overflowMask))
+}
+@_alwaysEmitIntoClient public func Int4AddSaturated(_ a:Int4, _ b:Int4) -> Int4 {
+	var overflowMask = Int4()
+	let sum = Int4AddReportingOverflow(a, b, &overflowMask)
+	return _vucktInt4Saturate(sum, overflowMask, towardSign: Int4ToSimd(a))
+}
+@_alwaysEmitIntoClient public func Int4SubtractSaturated(_ a:Int4, _ b:Int4) -> Int4 {
+	var overflowMask = Int4()
+	let difference = Int4SubtractReportingOverflow(a, b, &overflowMask)
+	return _vucktInt4Saturate(difference, overflowMask, towardSign: Int4ToSimd(a))
+}
+@_alwaysEmitIntoClient public func Int4MultiplySaturated(_ a:Int4, _ b:Int4) -> Int4 {
+	var overflowMask = Int4()
+	let product = Int4MultiplyReportingOverflow(a, b, &overflowMask)
+	return _vucktInt4Saturate(product, overflowMask, towardSign: Int4ToSimd(a) ^ Int4ToSimd(b))
+}
+
+
+
+// MARK: Array Operations
+
+@_alwaysEmitIntoClient public func Int4AddArrays(_ a:UnsafePointer<Int4>, _ b:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int4Add(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int4SubtractArrays(_ a:UnsafePointer<Int4>, _ b:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int4Subtract(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int4MultiplyArrays(_ a:UnsafePointer<Int4>, _ b:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int4Multiply(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int4DivideArrays(_ a:UnsafePointer<Int4>, _ b:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int4Divide(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int4ModulusArrays(_ a:UnsafePointer<Int4>, _ b:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int4Modulus(a[i], b[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int4NegateArray(_ v:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int4Negate(v[i])
+	}
+}
+@_alwaysEmitIntoClient public func Int4MultiplyByScalarArray(_ v:UnsafePointer<Int4>, _ s:Int32, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int4MultiplyByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Int4DivideByScalarArray(_ v:UnsafePointer<Int4>, _ s:Int32, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int4DivideByScalar(v[i], s)
+	}
+}
+@_alwaysEmitIntoClient public func Int4ModulusByScalarArray(_ v:UnsafePointer<Int4>, _ s:Int32, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Int4ModulusByScalar(v[i], s)
+	}
+}
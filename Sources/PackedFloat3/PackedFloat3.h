@@ -0,0 +1,107 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#include <string.h>
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A tightly-packed 3-component vector (12 bytes, 4-byte aligned), for storage & transfer only— vertex buffers, point clouds, file formats.
+/// Unpack to `Float3` (which is padded to 16 bytes, matching `simd_float3`) to do math.
+struct PackedFloat3 {
+	float x, y, z;
+};
+typedef struct PackedFloat3 PackedFloat3;
+
+
+
+#pragma mark Float3 Conversion
+
+NS_INLINE Float3 PackedFloat3ToFloat3(PackedFloat3 packedValue) {
+	return (Float3){ packedValue.x, packedValue.y, packedValue.z };
+}
+NS_INLINE PackedFloat3 PackedFloat3FromFloat3(Float3 value) {
+	return (PackedFloat3){ value.x, value.y, value.z };
+}
+
+
+
+#pragma mark Bulk Float3 Conversion
+
+// `out` must not overlap the input array.
+
+/// Unpacks `n` `PackedFloat3`s into `Float3`s.
+/// Works 4 vectors at a time: three 16-byte loads (48 packed bytes) shuffled into four 16-byte `Float3` stores.  (Each `Float3`'s padding lane is written as a copy of its `z`.)
+NS_INLINE void PackedFloat3ArrayToFloat3Array(const PackedFloat3 *packed, Float3 *out, size_t n) {
+	const float *packedLanes = (const float *)packed;
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4, packedLanes += 12) {
+		simd_float4 x0y0z0x1, y1z1x2y2, z2x3y3z3;
+		memcpy(&x0y0z0x1, packedLanes + 0, sizeof(simd_float4));
+		memcpy(&y1z1x2y2, packedLanes + 4, sizeof(simd_float4));
+		memcpy(&z2x3y3z3, packedLanes + 8, sizeof(simd_float4));
+
+		simd_float4 value0 = vuckt_simd_shuffle4(x0y0z0x1, x0y0z0x1, 0, 1, 2, 2);
+		simd_float4 value1 = vuckt_simd_shuffle4(x0y0z0x1, y1z1x2y2, 3, 4, 5, 5);
+		simd_float4 value2 = vuckt_simd_shuffle4(y1z1x2y2, z2x3y3z3, 2, 3, 4, 4);
+		simd_float4 value3 = vuckt_simd_shuffle4(z2x3y3z3, z2x3y3z3, 1, 2, 3, 3);
+		memcpy(&out[i + 0], &value0, sizeof(Float3));
+		memcpy(&out[i + 1], &value1, sizeof(Float3));
+		memcpy(&out[i + 2], &value2, sizeof(Float3));
+		memcpy(&out[i + 3], &value3, sizeof(Float3));
+	}
+	for (; i < n; ++i) {
+		out[i] = PackedFloat3ToFloat3(packed[i]);
+	}
+}
+
+/// Packs `n` `Float3`s into `PackedFloat3`s.
+/// With Clang, works 4 vectors at a time: four 16-byte `Float3` loads shuffled into three 16-byte stores (48 packed bytes).
+/// (GCC splits those shuffles into scalar moves, so it gets the plain per-element loop instead, which it handles better.)
+NS_INLINE void PackedFloat3ArrayFromFloat3Array(const Float3 *values, PackedFloat3 *out, size_t n) {
+	size_t i = 0;
+	#if __clang__
+		float *packedLanes = (float *)out;
+		for (; i + 4 <= n; i += 4, packedLanes += 12) {
+			simd_float4 value0, value1, value2, value3;
+			memcpy(&value0, &values[i + 0], sizeof(simd_float4));
+			memcpy(&value1, &values[i + 1], sizeof(simd_float4));
+			memcpy(&value2, &values[i + 2], sizeof(simd_float4));
+			memcpy(&value3, &values[i + 3], sizeof(simd_float4));
+
+			simd_float4 x0y0z0x1 = vuckt_simd_shuffle4(value0, value1, 0, 1, 2, 4);
+			simd_float4 y1z1x2y2 = vuckt_simd_shuffle4(value1, value2, 1, 2, 4, 5);
+			simd_float4 z2x3y3z3 = vuckt_simd_shuffle4(value2, value3, 2, 4, 5, 6);
+			memcpy(packedLanes + 0, &x0y0z0x1, sizeof(simd_float4));
+			memcpy(packedLanes + 4, &y1z1x2y2, sizeof(simd_float4));
+			memcpy(packedLanes + 8, &z2x3y3z3, sizeof(simd_float4));
+		}
+	#endif
+	for (; i < n; ++i) {
+		out[i] = PackedFloat3FromFloat3(values[i]);
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
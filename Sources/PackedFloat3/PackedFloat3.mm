@@ -0,0 +1,16 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "PackedFloat3.h"
+
+
+
+#pragma mark Struct Data Size/Alignment Sanity Checks
+
+static_assert(sizeof(PackedFloat3) == 3 * sizeof(float),
+	"PackedFloat3 is not tightly packed on this platform.");
+static_assert(alignof(PackedFloat3) == alignof(float),
+	"PackedFloat3's alignment requirements do not match float's on this platform.");
+static_assert(offsetof(PackedFloat3, y) == sizeof(float) && offsetof(PackedFloat3, z) == 2 * sizeof(float),
+	"PackedFloat3's members are not contiguous on this platform.");
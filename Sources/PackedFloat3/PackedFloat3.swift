@@ -0,0 +1,103 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension PackedFloat3
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements.
+	@_transparent public init(_ x:Float, _ y:Float, _ z:Float) {
+		self.init(x: x, y: y, z: z)
+	}
+	
+	@_transparent public init(_ float3Value:Float3) {
+		self = PackedFloat3FromFloat3(float3Value)
+	}
+	
+	
+	// MARK: `as…` Functionality
+	
+	@_transparent public var float3Value:Float3 {
+		return PackedFloat3ToFloat3(self)
+	}
+}
+
+
+extension Float3
+{
+	@_transparent public init(_ packedValue:PackedFloat3) {
+		self = PackedFloat3ToFloat3(packedValue)
+	}
+}
+
+
+extension PackedFloat3 : CustomStringConvertible
+{
+	public var description:String {
+		return "(\(self.x), \(self.y), \(self.z))"
+	}
+}
+
+
+extension PackedFloat3 : Equatable
+{
+	@_transparent public static func ==(a:PackedFloat3, b:PackedFloat3) -> Bool {
+		return a.x == b.x && a.y == b.y && a.z == b.z
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == PackedFloat3 // Bulk Conversion
+{
+	/// Unpacks every element into `out`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func unpack(into out:UnsafeMutableBufferPointer<Float3>) {
+		precondition(out.count == self.count, "Bulk conversion buffers must have the same count.")
+		guard self.count > 0 else { return }
+		PackedFloat3ArrayToFloat3Array(self.baseAddress!, out.baseAddress!, self.count)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float3 // Bulk Conversion
+{
+	/// Packs every element into `out`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func pack(into out:UnsafeMutableBufferPointer<PackedFloat3>) {
+		precondition(out.count == self.count, "Bulk conversion buffers must have the same count.")
+		guard self.count > 0 else { return }
+		PackedFloat3ArrayFromFloat3Array(self.baseAddress!, out.baseAddress!, self.count)
+	}
+}
+
+extension Array where Element == Float3
+{
+	/// Unpacks an array of `PackedFloat3`s.
+	@_alwaysEmitIntoClient public init(_ packedValues:[PackedFloat3]) {
+		self.init(unsafeUninitializedCapacity: packedValues.count){ buffer, initializedCount in
+			packedValues.withUnsafeBufferPointer{ $0.unpack(into: UnsafeMutableBufferPointer(rebasing: buffer[0..<packedValues.count])) }
+			initializedCount = packedValues.count
+		}
+	}
+}
+
+extension Array where Element == PackedFloat3
+{
+	/// Packs an array of `Float3`s.
+	@_alwaysEmitIntoClient public init(_ values:[Float3]) {
+		self.init(unsafeUninitializedCapacity: values.count){ buffer, initializedCount in
+			values.withUnsafeBufferPointer{ $0.pack(into: UnsafeMutableBufferPointer(rebasing: buffer[0..<values.count])) }
+			initializedCount = values.count
+		}
+	}
+}
@@ -0,0 +1,52 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+
+
+// MARK: Struct Definition
+
+public struct PackedFloat3
+{
+	public var x:Float
+	public var y:Float
+	public var z:Float
+	
+	public init() {
+		self.x = Float()
+		self.y = Float()
+		self.z = Float()
+	}
+	
+	public init(x:Float, y:Float, z:Float) {
+		self.x = x
+		self.y = y
+		self.z = z
+	}
+}
+
+
+
+// MARK: Float3 Conversion
+
+@_transparent public func PackedFloat3ToFloat3(_ packedValue:PackedFloat3) -> Float3 {
+	return Float3(x: packedValue.x, y: packedValue.y, z: packedValue.z)
+}
+@_transparent public func PackedFloat3FromFloat3(_ value:Float3) -> PackedFloat3 {
+	return PackedFloat3(x: value.x, y: value.y, z: value.z)
+}
+
+
+
+// MARK: Bulk Float3 Conversion
+
+@_alwaysEmitIntoClient public func PackedFloat3ArrayToFloat3Array(_ packed:UnsafePointer<PackedFloat3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = PackedFloat3ToFloat3(packed[i])
+	}
+}
+@_alwaysEmitIntoClient public func PackedFloat3ArrayFromFloat3Array(_ values:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<PackedFloat3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = PackedFloat3FromFloat3(values[i])
+	}
+}
@@ -0,0 +1,109 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+// Chunking for running a bulk pass (e.g. `Float3NormalizeArray()` over millions of elements) on many cores: the elements split into chunks, each chunk a call of the single-threaded kernel on its sub-array, & the chunks spread across threads.
+// The threading is left to the caller: the Swift side's `concurrentPerform(chunks:execute:)` (over `DispatchQueue.concurrentPerform`), or C++'s `vuckt::ThreadPool` (`Parallel.hpp`).
+// • Chunks are sized so each one's working set fills about half a core's L2 cache, so a chunk's inputs stay cached while it's written out, & there are plenty of chunks to balance the load.
+// • Given the output array, the chunks after the first start on cache-line boundaries of it, so no two threads ever write the same line (no false sharing).
+// • Chunking over no output array depends on the element count alone, so a reduction that sums each chunk then sums the chunks' sums in order (see `Float3SumArray()`) gets the same result however many threads run it, in whatever order.
+
+
+
+#pragma mark Tuning Constants
+
+/// The bytes of L2 cache per core the chunks are sized for.  (Define it beforehand to tune for a known target.)
+#ifndef VUCKT_PARALLEL_L2_CACHE_SIZE
+	#define VUCKT_PARALLEL_L2_CACHE_SIZE (256 * 1024)
+#endif
+
+/// The bytes per cache line, which the output chunk boundaries are aligned to.  (Apple's arm64 cores have 128-byte lines; most others, 64.)
+#ifndef VUCKT_PARALLEL_CACHE_LINE_SIZE
+	#if defined(__APPLE__) && (defined(__aarch64__) || defined(__arm64__))
+		#define VUCKT_PARALLEL_CACHE_LINE_SIZE 128
+	#else
+		#define VUCKT_PARALLEL_CACHE_LINE_SIZE 64
+	#endif
+#endif
+
+
+
+#pragma mark Struct Definition
+
+/// How a pass over `elementCount` elements splits into `chunkCount` chunks: the first of `firstChunkElementCount` elements, then the rest of `chunkElementCount` each (the last taking what remains).
+struct ParallelChunking {
+	size_t elementCount;
+	size_t chunkElementCount;
+	/// Between 1 & `chunkElementCount`: short of it where that puts the following chunks' output on cache-line boundaries.
+	size_t firstChunkElementCount;
+	size_t chunkCount;
+};
+typedef struct ParallelChunking ParallelChunking;
+
+
+
+#pragma mark Chunking
+
+/// Chunks `elementCount` elements, each reading & writing `bytesPerElement` bytes in all (e.g. `2 * sizeof(Float3)` to normalize `Float3`s into another array), into chunks of about half of `VUCKT_PARALLEL_L2_CACHE_SIZE`.
+/// `out` is the output array, of elements `outElementSize` bytes apart: the chunks after the first start on its cache-line boundaries.  For a reduction (with no output array), `out` is `NULL` & `outElementSize` 0, & the chunking depends on `elementCount` & `bytesPerElement` alone.
+NS_INLINE ParallelChunking ParallelChunkingMake(size_t elementCount, size_t bytesPerElement, const void *VUCKT_NULLABLE out, size_t outElementSize) {
+	const size_t lineSize = VUCKT_PARALLEL_CACHE_LINE_SIZE;
+	// The fewest elements spanning whole cache lines of output: `lineSize / gcd(lineSize, outElementSize)`.
+	size_t lineElementCount = 1;
+	if (outElementSize > 0) {
+		size_t a = lineSize, b = outElementSize % lineSize;
+		while (b != 0) {
+			size_t remainder = a % b;
+			a = b;
+			b = remainder;
+		}
+		lineElementCount = lineSize / a;
+	}
+	size_t chunkElementCount = (VUCKT_PARALLEL_L2_CACHE_SIZE / 2) / (bytesPerElement > 0 ? bytesPerElement : 1);
+	chunkElementCount = (chunkElementCount > lineElementCount ? chunkElementCount / lineElementCount : 1) * lineElementCount;
+	
+	size_t firstChunkElementCount = chunkElementCount;
+	size_t misalignment = (out != NULL && outElementSize > 0) ? (size_t)((uintptr_t)out % lineSize) : 0;
+	if (misalignment != 0 && (lineSize - misalignment) % outElementSize == 0) {
+		size_t leadElementCount = (lineSize - misalignment) / outElementSize % lineElementCount;
+		if (leadElementCount != 0)
+			firstChunkElementCount = chunkElementCount - lineElementCount + leadElementCount;
+	}
+	
+	size_t chunkCount = (elementCount == 0) ? 0
+		: (elementCount <= firstChunkElementCount) ? 1
+		: 1 + (elementCount - firstChunkElementCount + chunkElementCount - 1) / chunkElementCount;
+	return (ParallelChunking){ elementCount, chunkElementCount, firstChunkElementCount, chunkCount };
+}
+
+/// The index of chunk `chunkI`'s first element.
+NS_INLINE size_t ParallelChunkStart(ParallelChunking chunking, size_t chunkI) {
+	return (chunkI == 0) ? 0 : chunking.firstChunkElementCount + (chunkI - 1) * chunking.chunkElementCount;
+}
+/// The elements in chunk `chunkI`.
+NS_INLINE size_t ParallelChunkElementCount(ParallelChunking chunking, size_t chunkI) {
+	size_t start = ParallelChunkStart(chunking, chunkI);
+	size_t end = start + ((chunkI == 0) ? chunking.firstChunkElementCount : chunking.chunkElementCount);
+	return ((end < chunking.elementCount) ? end : chunking.elementCount) - start;
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
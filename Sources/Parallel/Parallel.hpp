@@ -0,0 +1,287 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#ifndef __cplusplus
+	#error "Parallel.hpp is C++-only; C code chunks its passes with Parallel.h's `ParallelChunkingMake()` & threads them itself."
+#endif
+
+#if __has_include(<Vuckt/Parallel.h>)
+	#import <Vuckt/Parallel.h>
+#else
+	#include "Parallel.h"
+#endif
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+#if __has_include(<Vuckt/Float4.h>)
+	#import <Vuckt/Float4.h>
+#else
+	#include "../Float4/Float4.h"
+#endif
+#if __has_include(<Vuckt/Float4x4.h>)
+	#import <Vuckt/Float4x4.h>
+#else
+	#include "../Float4x4/Float4x4.h"
+#endif
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+
+VUCKT_DIAGNOSTICS_BEGIN
+
+// A work-stealing thread pool & the bulk operations run across it, chunked per `Parallel.h`: `vuckt::parallelNormalize()`, `vuckt::parallelTransformPoints()`, & the deterministic `vuckt::parallelSum()`.
+// Plain `std::thread`s, mutexes, & condition variables, so it runs the same on Linux as on Apple platforms.
+
+
+
+#pragma mark Thread Pool
+
+namespace vuckt
+{
+	/// A fixed set of worker threads that run parallel-for jobs: `parallelFor(taskCount, body)` calls `body(taskI)` for each task across them & the calling thread, returning once all are done.
+	/// A job's tasks start out split evenly between the threads, as contiguous ranges (so neighboring chunks run on the same core, in order); a thread that finishes its range steals the back half of the largest one left.
+	/// Jobs from different threads run one at a time; a `parallelFor()` from within a task runs its tasks serially, on that task's thread.
+	class ThreadPool
+	{
+	public:
+		/// `threadCount` threads in all, counting the thread calling `parallelFor()` (so `threadCount - 1` workers are started); 0 for one per hardware thread.
+		explicit ThreadPool(size_t threadCount = 0)
+			: _threadCount(std::max<size_t>(1, threadCount > 0 ? threadCount : std::thread::hardware_concurrency())),
+			_ranges(new TaskRange[_threadCount])
+		{
+			for (size_t threadI = 1; threadI < _threadCount; ++threadI)
+				_workers.emplace_back([this, threadI] { _runWorker(threadI); });
+		}
+		~ThreadPool() {
+			{
+				std::lock_guard<std::mutex> lock(_jobMutex);
+				_isStopping = true;
+			}
+			_jobStarted.notify_all();
+			for (std::thread &worker : _workers)
+				worker.join();
+		}
+		ThreadPool(const ThreadPool &) = delete;
+		ThreadPool &operator=(const ThreadPool &) = delete;
+		
+		/// One thread per hardware thread, started on first use.
+		static ThreadPool &shared() {
+			static ThreadPool sharedPool;
+			return sharedPool;
+		}
+		
+		size_t threadCount() const { return _threadCount; }
+		
+		template <typename Body>
+		void parallelFor(size_t taskCount, Body &&body) {
+			if (taskCount == 0)
+				return;
+			if (taskCount == 1 || _threadCount == 1 || _currentPool() != nullptr) {
+				for (size_t taskI = 0; taskI < taskCount; ++taskI)
+					body(taskI);
+				return;
+			}
+			
+			std::lock_guard<std::mutex> submitLock(_submitMutex);
+			{
+				// The whole job is published in one `_jobMutex` critical section, once no worker is still in the last one.  Workers join a job under the same lock (when they see its generation), so none can start stealing from— or have its stolen range overwritten by— ranges still being handed out.
+				std::unique_lock<std::mutex> lock(_jobMutex);
+				_jobFinished.wait(lock, [this] { return _activeWorkerCount == 0; });
+				_runTask = [](void *context, size_t taskI) { (*static_cast<typename std::remove_reference<Body>::type *>(context))(taskI); };
+				_runTaskContext = const_cast<void *>(static_cast<const void *>(&body));
+				_remainingTaskCount.store(taskCount, std::memory_order_relaxed);
+				for (size_t threadI = 0; threadI < _threadCount; ++threadI) {
+					std::lock_guard<std::mutex> rangeLock(_ranges[threadI].mutex);
+					_ranges[threadI].begin = taskCount * threadI / _threadCount;
+					_ranges[threadI].end = taskCount * (threadI + 1) / _threadCount;
+				}
+				++_jobGeneration;
+			}
+			_jobStarted.notify_all();
+			
+			_currentPool() = this;
+			_runTasks(0);
+			_currentPool() = nullptr;
+			
+			std::unique_lock<std::mutex> lock(_jobMutex);
+			_jobFinished.wait(lock, [this] { return _remainingTaskCount.load(std::memory_order_acquire) == 0; });
+		}
+		
+	private:
+		/// A thread's share of the current job: tasks `begin..<end`, taken from the front by the thread & stolen from the back by others.  (A cache line each, so threads taking from their own don't contend.)
+		struct alignas(VUCKT_PARALLEL_CACHE_LINE_SIZE) TaskRange {
+			std::mutex mutex;
+			size_t begin = 0, end = 0;
+		};
+		
+		static const ThreadPool *&_currentPool() {
+			static thread_local const ThreadPool *currentPool = nullptr;
+			return currentPool;
+		}
+		
+		void _runWorker(size_t threadI) {
+			_currentPool() = this;
+			uint64_t lastJobGeneration = 0;
+			while (true) {
+				{
+					std::unique_lock<std::mutex> lock(_jobMutex);
+					_jobStarted.wait(lock, [&] { return _isStopping || _jobGeneration != lastJobGeneration; });
+					if (_isStopping)
+						return;
+					lastJobGeneration = _jobGeneration;
+					++_activeWorkerCount;
+				}
+				_runTasks(threadI);
+				{
+					std::lock_guard<std::mutex> lock(_jobMutex);
+					--_activeWorkerCount;
+				}
+				_jobFinished.notify_all();
+			}
+		}
+		
+		void _runTasks(size_t threadI) {
+			size_t taskI;
+			while (_takeTask(threadI, taskI) || _stealTasks(threadI, taskI)) {
+				_runTask(_runTaskContext, taskI);
+				if (_remainingTaskCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					std::lock_guard<std::mutex> lock(_jobMutex);
+					_jobFinished.notify_all();
+				}
+			}
+		}
+		
+		bool _takeTask(size_t threadI, size_t &outTaskI) {
+			TaskRange &range = _ranges[threadI];
+			std::lock_guard<std::mutex> lock(range.mutex);
+			if (range.begin == range.end)
+				return false;
+			outTaskI = range.begin++;
+			return true;
+		}
+		
+		/// Moves the back half of the largest other range into this (empty) thread's, & takes its first task.
+		bool _stealTasks(size_t threadI, size_t &outTaskI) {
+			while (true) {
+				size_t victimI = threadI, victimTaskCount = 0;
+				for (size_t otherI = 0; otherI < _threadCount; ++otherI) {
+					if (otherI == threadI)
+						continue;
+					std::lock_guard<std::mutex> lock(_ranges[otherI].mutex);
+					if (_ranges[otherI].end - _ranges[otherI].begin > victimTaskCount) {
+						victimI = otherI;
+						victimTaskCount = _ranges[otherI].end - _ranges[otherI].begin;
+					}
+				}
+				if (victimTaskCount == 0)
+					return false;
+				
+				size_t stolenBegin, stolenEnd;
+				{
+					TaskRange &victim = _ranges[victimI];
+					std::lock_guard<std::mutex> lock(victim.mutex);
+					if (victim.begin == victim.end)
+						continue;
+					stolenEnd = victim.end;
+					stolenBegin = victim.end - (victim.end - victim.begin + 1) / 2;
+					victim.end = stolenBegin;
+				}
+				TaskRange &range = _ranges[threadI];
+				std::lock_guard<std::mutex> lock(range.mutex);
+				range.begin = stolenBegin + 1;
+				range.end = stolenEnd;
+				outTaskI = stolenBegin;
+				return true;
+			}
+		}
+		
+		const size_t _threadCount;
+		std::unique_ptr<TaskRange[]> _ranges;
+		std::vector<std::thread> _workers;
+		
+		std::mutex _submitMutex;
+		void (*_runTask)(void *context, size_t taskI) = nullptr;
+		void *_runTaskContext = nullptr;
+		std::atomic<size_t> _remainingTaskCount{ 0 };
+		
+		std::mutex _jobMutex;
+		std::condition_variable _jobStarted, _jobFinished;
+		uint64_t _jobGeneration = 0;
+		size_t _activeWorkerCount = 0;
+		bool _isStopping = false;
+	};
+}
+
+
+
+#pragma mark Chunked Bulk Operations
+
+namespace vuckt
+{
+	/// Calls `body(start, count)` for each chunk of `chunking` (see `Parallel.h`) across `pool`; a pass of just one chunk runs on the calling thread.
+	template <typename Body>
+	void parallelForChunks(ParallelChunking chunking, Body &&body, ThreadPool &pool = ThreadPool::shared()) {
+		if (chunking.chunkCount == 1) {
+			body((size_t)0, chunking.elementCount);
+			return;
+		}
+		pool.parallelFor(chunking.chunkCount, [&](size_t chunkI) {
+			body(ParallelChunkStart(chunking, chunkI), ParallelChunkElementCount(chunking, chunkI));
+		});
+	}
+	
+	/// `Float3NormalizeArray()` across `pool`.
+	inline void parallelNormalize(const Float3 *v, Float3 *out, size_t n, ThreadPool &pool = ThreadPool::shared()) {
+		parallelForChunks(ParallelChunkingMake(n, 2 * sizeof(Float3), out, sizeof(Float3)), [&](size_t start, size_t count) {
+			Float3NormalizeArray(v + start, out + start, count);
+		}, pool);
+	}
+	/// `Float4NormalizeArray()` across `pool`.
+	inline void parallelNormalize(const Float4 *v, Float4 *out, size_t n, ThreadPool &pool = ThreadPool::shared()) {
+		parallelForChunks(ParallelChunkingMake(n, 2 * sizeof(Float4), out, sizeof(Float4)), [&](size_t start, size_t count) {
+			Float4NormalizeArray(v + start, out + start, count);
+		}, pool);
+	}
+	
+	/// `Float4x4TransformPoints()` across `pool`.
+	inline void parallelTransformPoints(Float4x4 m, const Float3 *points, Float3 *out, size_t n, bool perspectiveDivide, ThreadPool &pool = ThreadPool::shared()) {
+		parallelForChunks(ParallelChunkingMake(n, 2 * sizeof(Float3), out, sizeof(Float3)), [&](size_t start, size_t count) {
+			Float4x4TransformPoints(m, points + start, out + start, count, perspectiveDivide);
+		}, pool);
+	}
+	
+	/// `v[0] + v[1] + … + v[n - 1]`: each chunk summed by `Float3SumArray()`, then the chunks' sums by it in order.  The chunking depends on `n` alone, so the result is the same bit for bit whatever `pool`'s thread count (or the Swift side's `sumConcurrently()`, on the C backend).
+	inline Float3 parallelSum(const Float3 *v, size_t n, ThreadPool &pool = ThreadPool::shared()) {
+		const ParallelChunking chunking = ParallelChunkingMake(n, sizeof(Float3), nullptr, 0);
+		std::vector<Float3> chunkSums(chunking.chunkCount);
+		pool.parallelFor(chunking.chunkCount, [&](size_t chunkI) {
+			chunkSums[chunkI] = Float3SumArray(v + ParallelChunkStart(chunking, chunkI), ParallelChunkElementCount(chunking, chunkI));
+		});
+		return Float3SumArray(chunkSums.data(), chunkSums.size());
+	}
+	/// `v[0] + v[1] + … + v[n - 1]`, deterministically— see the `Float3` `parallelSum()`.
+	inline Float4 parallelSum(const Float4 *v, size_t n, ThreadPool &pool = ThreadPool::shared()) {
+		const ParallelChunking chunking = ParallelChunkingMake(n, sizeof(Float4), nullptr, 0);
+		std::vector<Float4> chunkSums(chunking.chunkCount);
+		pool.parallelFor(chunking.chunkCount, [&](size_t chunkI) {
+			chunkSums[chunkI] = Float4SumArray(v + ParallelChunkStart(chunking, chunkI), ParallelChunkElementCount(chunking, chunkI));
+		});
+		return Float4SumArray(chunkSums.data(), chunkSums.size());
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
@@ -0,0 +1,160 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension ParallelChunking
+{
+	/// Chunks a pass over `count` elements, each reading & writing `bytesPerElement` bytes in all, writing `output`— see `ParallelChunkingMake()`.
+	@_alwaysEmitIntoClient public init<Output>(count:Int, bytesPerElement:Int, output:UnsafeMutableBufferPointer<Output>) {
+		self = ParallelChunkingMake(count, bytesPerElement, UnsafeRawPointer(output.baseAddress), MemoryLayout<Output>.stride)
+	}
+	/// Chunks a reduction over `count` elements of `bytesPerElement` bytes, by `count` alone— see `ParallelChunkingMake()`.
+	@_alwaysEmitIntoClient public init(count:Int, bytesPerElement:Int) {
+		self = ParallelChunkingMake(count, bytesPerElement, nil, 0)
+	}
+	
+	/// The indices of chunk `chunkI`'s elements.
+	@_alwaysEmitIntoClient public func elementRange(ofChunk chunkI:Int) -> Range<Int> {
+		let start = ParallelChunkStart(self, chunkI)
+		return start ..< (start + ParallelChunkElementCount(self, chunkI))
+	}
+}
+
+
+/// Calls `body` with each chunk of `chunking`'s element indices, concurrently across all cores (via `DispatchQueue.concurrentPerform`), returning once all chunks are done.  A pass of just one chunk runs on the calling thread.
+@_alwaysEmitIntoClient public func concurrentPerform(chunks chunking:ParallelChunking, execute body:(Range<Int>) -> Void) {
+	switch chunking.chunkCount {
+		case 0: return
+		case 1: body(0 ..< chunking.elementCount)
+		default: DispatchQueue.concurrentPerform(iterations: chunking.chunkCount){ body(chunking.elementRange(ofChunk: $0)) }
+	}
+}
+
+
+internal extension UnsafeBufferPointer
+{
+	@inlinable func _vucktConcurrentBulkOperation<Result>(into out:UnsafeMutableBufferPointer<Result>, _ operation:(UnsafePointer<Element>, UnsafeMutablePointer<Result>, Int) -> Void) {
+		precondition(out.count == self.count, "Bulk operation buffers must all have the same count.")
+		guard self.count > 0 else { return }
+		let input = self.baseAddress!, output = out.baseAddress!
+		concurrentPerform(chunks: ParallelChunking(count: self.count, bytesPerElement: MemoryLayout<Element>.stride + MemoryLayout<Result>.stride, output: out)){ chunk in
+			operation(input + chunk.lowerBound, output + chunk.lowerBound, chunk.count)
+		}
+	}
+	
+	/// Each chunk summed by `sum` (concurrently), then the chunks' sums by it (in order).
+	@inlinable func _vucktConcurrentSum(zero:Element, _ sum:(UnsafePointer<Element>, Int) -> Element) -> Element {
+		guard self.count > 0 else { return zero }
+		let input = self.baseAddress!
+		let chunking = ParallelChunking(count: self.count, bytesPerElement: MemoryLayout<Element>.stride)
+		var chunkSums = [Element](repeating: zero, count: chunking.chunkCount)
+		chunkSums.withUnsafeMutableBufferPointer{ chunkSumsBuffer in
+			let chunkSumsPointer = chunkSumsBuffer.baseAddress!
+			DispatchQueue.concurrentPerform(iterations: chunking.chunkCount){ chunkI in
+				let chunk = chunking.elementRange(ofChunk: chunkI)
+				chunkSumsPointer[chunkI] = sum(input + chunk.lowerBound, chunk.count)
+			}
+		}
+		return chunkSums.withUnsafeBufferPointer{ sum($0.baseAddress!, $0.count) }
+	}
+}
+
+
+
+extension UnsafeBufferPointer where Element == Float3 // Concurrent Bulk Operations
+{
+	/// `normalize(into:)`, chunked across all cores (see `Parallel.h`).
+	@_alwaysEmitIntoClient public func normalizeConcurrently(into out:UnsafeMutableBufferPointer<Float3>) {
+		self._vucktConcurrentBulkOperation(into: out, Float3NormalizeArray)
+	}
+	/// The sum of the elements, chunked across all cores: each chunk summed by `Float3SumArray()`, then the chunks' sums by it in order.  The chunking depends on the count alone, so the same elements always give the same sum, however many cores run it.
+	@_alwaysEmitIntoClient public func sumConcurrently() -> Float3 {
+		return self._vucktConcurrentSum(zero: Float3(), Float3SumArray)
+	}
+}
+
+extension Array where Element == Float3 // Concurrent Bulk Operations
+{
+	@_alwaysEmitIntoClient public func normalizedConcurrently() -> [Float3] {
+		return self.withUnsafeBufferPointer{ selfBuffer in
+			Array(unsafeUninitializedCapacity: self.count) { outBuffer, initializedCount in
+				selfBuffer.normalizeConcurrently(into: UnsafeMutableBufferPointer(rebasing: outBuffer[0..<self.count]))
+				initializedCount = self.count
+			}
+		}
+	}
+	@_alwaysEmitIntoClient public mutating func normalizeConcurrently() {
+		self.withUnsafeMutableBufferPointer{ selfBuffer in
+			UnsafeBufferPointer(selfBuffer).normalizeConcurrently(into: selfBuffer)
+		}
+	}
+	
+	/// The sum of the elements— see `UnsafeBufferPointer.sumConcurrently()`.
+	@_alwaysEmitIntoClient public func sumConcurrently() -> Float3 {
+		return self.withUnsafeBufferPointer{ $0.sumConcurrently() }
+	}
+}
+
+
+extension UnsafeBufferPointer where Element == Float4 // Concurrent Bulk Operations
+{
+	/// `normalize(into:)`, chunked across all cores (see `Parallel.h`).
+	@_alwaysEmitIntoClient public func normalizeConcurrently(into out:UnsafeMutableBufferPointer<Float4>) {
+		self._vucktConcurrentBulkOperation(into: out, Float4NormalizeArray)
+	}
+	/// The sum of the elements, chunked across all cores, deterministically— see the `Float3` `sumConcurrently()`.
+	@_alwaysEmitIntoClient public func sumConcurrently() -> Float4 {
+		return self._vucktConcurrentSum(zero: Float4(), Float4SumArray)
+	}
+}
+
+extension Array where Element == Float4 // Concurrent Bulk Operations
+{
+	@_alwaysEmitIntoClient public func normalizedConcurrently() -> [Float4] {
+		return self.withUnsafeBufferPointer{ selfBuffer in
+			Array(unsafeUninitializedCapacity: self.count) { outBuffer, initializedCount in
+				selfBuffer.normalizeConcurrently(into: UnsafeMutableBufferPointer(rebasing: outBuffer[0..<self.count]))
+				initializedCount = self.count
+			}
+		}
+	}
+	@_alwaysEmitIntoClient public mutating func normalizeConcurrently() {
+		self.withUnsafeMutableBufferPointer{ selfBuffer in
+			UnsafeBufferPointer(selfBuffer).normalizeConcurrently(into: selfBuffer)
+		}
+	}
+	
+	/// The sum of the elements— see `UnsafeBufferPointer.sumConcurrently()`.
+	@_alwaysEmitIntoClient public func sumConcurrently() -> Float4 {
+		return self.withUnsafeBufferPointer{ $0.sumConcurrently() }
+	}
+}
+
+
+extension Float4x4 // Concurrent Batch Transforms
+{
+	/// `transformPoints(_:into:perspectiveDivide:)`, chunked across all cores (see `Parallel.h`).
+	@_alwaysEmitIntoClient public func transformPointsConcurrently(_ points:UnsafeBufferPointer<Float3>, into out:UnsafeMutableBufferPointer<Float3>, perspectiveDivide:Bool = false) {
+		points._vucktConcurrentBulkOperation(into: out){ Float4x4TransformPoints(self, $0, $1, $2, perspectiveDivide) }
+	}
+	@_alwaysEmitIntoClient public func transformedPointsConcurrently(_ points:[Float3], perspectiveDivide:Bool = false) -> [Float3] {
+		return points.withUnsafeBufferPointer{ pointsBuffer in
+			Array(unsafeUninitializedCapacity: points.count) { outBuffer, initializedCount in
+				self.transformPointsConcurrently(pointsBuffer, into: UnsafeMutableBufferPointer(rebasing: outBuffer[0..<points.count]), perspectiveDivide: perspectiveDivide)
+				initializedCount = points.count
+			}
+		}
+	}
+}
@@ -0,0 +1,82 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+
+
+// MARK: Tuning Constants
+
+public let VUCKT_PARALLEL_L2_CACHE_SIZE:Int32 = 256 * 1024
+
+#if canImport(Darwin) && arch(arm64)
+	public let VUCKT_PARALLEL_CACHE_LINE_SIZE:Int32 = 128
+#else
+	public let VUCKT_PARALLEL_CACHE_LINE_SIZE:Int32 = 64
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct ParallelChunking
+{
+	public var elementCount:Int
+	public var chunkElementCount:Int
+	public var firstChunkElementCount:Int
+	public var chunkCount:Int
+	
+	public init() {
+		self.elementCount = Int()
+		self.chunkElementCount = Int()
+		self.firstChunkElementCount = Int()
+		self.chunkCount = Int()
+	}
+	
+	public init(elementCount:Int, chunkElementCount:Int, firstChunkElementCount:Int, chunkCount:Int) {
+		self.elementCount = elementCount
+		self.chunkElementCount = chunkElementCount
+		self.firstChunkElementCount = firstChunkElementCount
+		self.chunkCount = chunkCount
+	}
+}
+
+
+
+// MARK: Chunking
+
+@_alwaysEmitIntoClient public func ParallelChunkingMake(_ elementCount:Int, _ bytesPerElement:Int, _ out:UnsafeRawPointer?, _ outElementSize:Int) -> ParallelChunking {
+	let lineSize = Int(VUCKT_PARALLEL_CACHE_LINE_SIZE)
+	var lineElementCount = 1
+	if outElementSize > 0 {
+		var a = lineSize, b = outElementSize % lineSize
+		while b != 0 {
+			(a, b) = (b, a % b)
+		}
+		lineElementCount = lineSize / a
+	}
+	var chunkElementCount = (Int(VUCKT_PARALLEL_L2_CACHE_SIZE) / 2) / max(bytesPerElement, 1)
+	chunkElementCount = (chunkElementCount > lineElementCount ? chunkElementCount / lineElementCount : 1) * lineElementCount
+	
+	var firstChunkElementCount = chunkElementCount
+	let misalignment = (out != nil && outElementSize > 0) ? Int(bitPattern: UInt(bitPattern: out!) % UInt(lineSize)) : 0
+	if misalignment != 0 && (lineSize - misalignment) % outElementSize == 0 {
+		let leadElementCount = (lineSize - misalignment) / outElementSize % lineElementCount
+		if leadElementCount != 0 {
+			firstChunkElementCount = chunkElementCount - lineElementCount + leadElementCount
+		}
+	}
+	
+	let chunkCount = (elementCount == 0) ? 0
+		: (elementCount <= firstChunkElementCount) ? 1
+		: 1 + (elementCount - firstChunkElementCount + chunkElementCount - 1) / chunkElementCount
+	return ParallelChunking(elementCount: elementCount, chunkElementCount: chunkElementCount, firstChunkElementCount: firstChunkElementCount, chunkCount: chunkCount)
+}
+
+@_transparent public func ParallelChunkStart(_ chunking:ParallelChunking, _ chunkI:Int) -> Int {
+	return (chunkI == 0) ? 0 : chunking.firstChunkElementCount + (chunkI - 1) * chunking.chunkElementCount
+}
+@_transparent public func ParallelChunkElementCount(_ chunking:ParallelChunking, _ chunkI:Int) -> Int {
+	let start = ParallelChunkStart(chunking, chunkI)
+	let end = start + ((chunkI == 0) ? chunking.firstChunkElementCount : chunking.chunkElementCount)
+	return min(end, chunking.elementCount) - start
+}
@@ -0,0 +1,308 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+#if __has_include(<Vuckt/AABB3.h>)
+	#import <Vuckt/AABB3.h>
+#else
+	#include "../AABB3/AABB3.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A ray, `origin + t · direction` for `t` ≥ 0 (32 bytes: two padded `Float3`s).
+/// `direction` needn't be normalized; distances along the ray are in units of its length (so true distances if it is).
+struct Ray3 {
+	Float3 origin;
+	Float3 direction;
+};
+typedef struct Ray3 Ray3;
+
+
+
+#pragma mark Construction & Queries
+
+/// The point `distance` along `ray`.
+NS_INLINE Float3 Ray3PointAt(Ray3 ray, float distance) {
+	return (Float3){ ray.origin.x + ray.direction.x * distance, ray.origin.y + ray.direction.y * distance, ray.origin.z + ray.direction.z * distance };
+}
+
+
+
+#pragma mark Scalar Intersection
+
+// Triangles are hit from either side, edges & vertices included.
+// The test is Möller & Trumbore's, rearranged (after Kensler & Shirley) into signed volumes about the ray's origin: with the vertices taken relative to it (`A`, `B`, `C`), each edge `P`→`Q`'s weight is `direction · (Q × P)`, & the ray passes inside where all 3 weights share a sign.
+// Two triangles sharing an edge compute that edge's weight from the very same vertex values, in mirrored order, so get exactly opposite results— no ray can slip between them (or hit neither) through rounding, as it can with the edge-vector form.  (Rays through a shared *vertex* may still, very rarely, miss the whole fan.)
+// The lane & batch kernels below do the very same arithmetic per lane, in the same order (FMA contraction is off throughout), so their distances match these bit-for-bit.
+// (That takes Clang, or GCC with `-ffp-contract=off` or an ISO C `-std=`: GCC has no per-function switch that survives inlining, so in its GNU dialects & in C++, with FMA available (e.g. `-march=native`, or AArch64), it fuses each kernel's products differently & a few hundred of every 400,000 ray/triangle pairs differ in the last bits.)
+
+/// The distance along `ray` to where it hits triangle `a`,`b`,`c` (with the hit's barycentric coordinates— the weights of `b` & `c`— in `*outU` & `*outV`, if given), or +∞ if it misses it or hits it only past `maxDistance`.
+NS_INLINE float Ray3IntersectTriangle(Ray3 ray, Float3 a, Float3 b, Float3 c, float maxDistance, float *VUCKT_NULLABLE outU, float *VUCKT_NULLABLE outV) {
+	VUCKT_NO_FP_CONTRACT
+	float aX = a.x - ray.origin.x, aY = a.y - ray.origin.y, aZ = a.z - ray.origin.z;
+	float bX = b.x - ray.origin.x, bY = b.y - ray.origin.y, bZ = b.z - ray.origin.z;
+	float cX = c.x - ray.origin.x, cY = c.y - ray.origin.y, cZ = c.z - ray.origin.z;
+	float cbX = cY * bZ - cZ * bY, cbY = cZ * bX - cX * bZ, cbZ = cX * bY - cY * bX;
+	float acX = aY * cZ - aZ * cY, acY = aZ * cX - aX * cZ, acZ = aX * cY - aY * cX;
+	float baX = bY * aZ - bZ * aY, baY = bZ * aX - bX * aZ, baZ = bX * aY - bY * aX;
+	float weightA = ray.direction.x * cbX + ray.direction.y * cbY + ray.direction.z * cbZ;
+	float weightB = ray.direction.x * acX + ray.direction.y * acY + ray.direction.z * acZ;
+	float weightC = ray.direction.x * baX + ray.direction.y * baY + ray.direction.z * baZ;
+	float determinant = weightA + weightB + weightC;
+	float distance = (aX * cbX + aY * cbY + aZ * cbZ) / determinant;
+	if (outU != NULL)
+		*outU = weightB / determinant;
+	if (outV != NULL)
+		*outV = weightC / determinant;
+	bool isInside = (weightA >= 0 && weightB >= 0 && weightC >= 0) || (weightA <= 0 && weightB <= 0 && weightC <= 0);
+	return (isInside && determinant != 0 && distance >= 0 && distance <= maxDistance) ? distance : INFINITY;
+}
+
+/// Narrows `[*entry, *exit]` to where the ray (`origin` & `inverseDirection` components along one axis) is within that axis's slab `min`…`max`.
+NS_INLINE void _Ray3ClipToSlab(float *entry, float *exit, float min, float max, float origin, float inverseDirection) {
+	float t0 = (min - origin) * inverseDirection, t1 = (max - origin) * inverseDirection;
+	bool isT0Nearer = (t0 < t1);
+	float tNear = isT0Nearer ? t0 : t1, tFar = isT0Nearer ? t1 : t0;
+	// A ray along one of the slab's faces (zero direction component, zero offset) gets `0 · ∞` = NaN there, but is within the slab.
+	bool isDefined = (t0 == t0) && (t1 == t1);
+	*entry = (isDefined && tNear > *entry) ? tNear : *entry;
+	*exit = (isDefined && tFar < *exit) ? tFar : *exit;
+}
+/// The distance along `ray` to where it enters `box` (0 if it starts inside), or +∞ if it misses it or only enters past `maxDistance` (by the slab test; faces included).
+NS_INLINE float Ray3IntersectAABB3(Ray3 ray, AABB3 box, float maxDistance) {
+	float entry = 0, exit = maxDistance;
+	_Ray3ClipToSlab(&entry, &exit, box.min.x, box.max.x, ray.origin.x, 1.0f / ray.direction.x);
+	_Ray3ClipToSlab(&entry, &exit, box.min.y, box.max.y, ray.origin.y, 1.0f / ray.direction.y);
+	_Ray3ClipToSlab(&entry, &exit, box.min.z, box.max.z, ray.origin.z, 1.0f / ray.direction.z);
+	return (entry <= exit) ? entry : INFINITY;
+}
+
+
+
+#pragma mark Lane Kernels
+
+// Packets of 4 rays or primitives, transposed into vector lanes (component-major), for intersecting 4 ray–primitive pairs per call: 4 rays against one primitive (broadcast into all lanes), one ray (broadcast) against 4 primitives, or 4 rays against 4 primitives pairwise.
+// Each kernel returns a hit mask (all-ones in each lane that hit, else 0) & writes each lane's distance (+∞ where it missed).
+
+/// 4 rays in lanes, with their directions' reciprocals (for the slab test).
+typedef struct Ray3Lanes {
+	simd_float4 originX, originY, originZ;
+	simd_float4 directionX, directionY, directionZ;
+	simd_float4 inverseDirectionX, inverseDirectionY, inverseDirectionZ;
+} Ray3Lanes;
+
+/// Transposes `rays[0..<count]` (`count` ≤ 4) into lanes, repeating the last ray in any lanes past `count`.
+NS_INLINE Ray3Lanes Ray3LanesLoad(const Ray3 *rays, size_t count) {
+	simd_float4 origins[4], directions[4];
+	for (size_t laneI = 0; laneI < 4; ++laneI) {
+		const Ray3 *ray = &rays[(laneI < count) ? laneI : count - 1];
+		memcpy(&origins[laneI], &ray->origin, sizeof(simd_float4));
+		memcpy(&directions[laneI], &ray->direction, sizeof(simd_float4));
+	}
+	vuckt_simd_transpose4(&origins[0], &origins[1], &origins[2], &origins[3]);
+	vuckt_simd_transpose4(&directions[0], &directions[1], &directions[2], &directions[3]);
+	return (Ray3Lanes){
+		origins[0], origins[1], origins[2],
+		directions[0], directions[1], directions[2],
+		1.0f / directions[0], 1.0f / directions[1], 1.0f / directions[2],
+	};
+}
+/// `ray` in all 4 lanes.
+NS_INLINE Ray3Lanes Ray3LanesBroadcast(Ray3 ray) {
+	return Ray3LanesLoad(&ray, 1);
+}
+
+/// 4 triangles' vertices in lanes.
+typedef struct Ray3TriangleLanes {
+	simd_float4 aX, aY, aZ;
+	simd_float4 bX, bY, bZ;
+	simd_float4 cX, cY, cZ;
+} Ray3TriangleLanes;
+
+/// Transposes triangles `0..<count` (`count` ≤ 4)— `vertices` indexed by each 3 consecutive `triangleVertexIndices`— into lanes, repeating the last triangle in any lanes past `count`.
+NS_INLINE Ray3TriangleLanes Ray3TriangleLanesLoad(const Float3 *vertices, const uint32_t *triangleVertexIndices, size_t count) {
+	simd_float4 a[4], b[4], c[4];
+	for (size_t laneI = 0; laneI < 4; ++laneI) {
+		const uint32_t *vertexIndices = &triangleVertexIndices[((laneI < count) ? laneI : count - 1) * 3];
+		memcpy(&a[laneI], &vertices[vertexIndices[0]], sizeof(simd_float4));
+		memcpy(&b[laneI], &vertices[vertexIndices[1]], sizeof(simd_float4));
+		memcpy(&c[laneI], &vertices[vertexIndices[2]], sizeof(simd_float4));
+	}
+	vuckt_simd_transpose4(&a[0], &a[1], &a[2], &a[3]);
+	vuckt_simd_transpose4(&b[0], &b[1], &b[2], &b[3]);
+	vuckt_simd_transpose4(&c[0], &c[1], &c[2], &c[3]);
+	return (Ray3TriangleLanes){ a[0], a[1], a[2], b[0], b[1], b[2], c[0], c[1], c[2] };
+}
+/// Triangle `a`,`b`,`c` in all 4 lanes.
+NS_INLINE Ray3TriangleLanes Ray3TriangleLanesBroadcast(Float3 a, Float3 b, Float3 c) {
+	const Float3 vertices[3] = { a, b, c };
+	const uint32_t vertexIndices[3] = { 0, 1, 2 };
+	return Ray3TriangleLanesLoad(vertices, vertexIndices, 1);
+}
+
+/// 4 boxes' corners in lanes.
+typedef struct Ray3BoxLanes {
+	simd_float4 minX, minY, minZ;
+	simd_float4 maxX, maxY, maxZ;
+} Ray3BoxLanes;
+
+/// Transposes `boxes[0..<count]` (`count` ≤ 4) into lanes, repeating the last box in any lanes past `count`.
+NS_INLINE Ray3BoxLanes Ray3BoxLanesLoad(const AABB3 *boxes, size_t count) {
+	simd_float4 minimums[4], maximums[4];
+	for (size_t laneI = 0; laneI < 4; ++laneI) {
+		const AABB3 *box = &boxes[(laneI < count) ? laneI : count - 1];
+		memcpy(&minimums[laneI], &box->min, sizeof(simd_float4));
+		memcpy(&maximums[laneI], &box->max, sizeof(simd_float4));
+	}
+	vuckt_simd_transpose4(&minimums[0], &minimums[1], &minimums[2], &minimums[3]);
+	vuckt_simd_transpose4(&maximums[0], &maximums[1], &maximums[2], &maximums[3]);
+	return (Ray3BoxLanes){ minimums[0], minimums[1], minimums[2], maximums[0], maximums[1], maximums[2] };
+}
+/// `box` in all 4 lanes.
+NS_INLINE Ray3BoxLanes Ray3BoxLanesBroadcast(AABB3 box) {
+	return Ray3BoxLanesLoad(&box, 1);
+}
+
+/// Per lane, `Ray3IntersectTriangle()` of that lane's ray & triangle, within that lane's `maxDistances`.
+NS_INLINE simd_int4 Ray3LanesIntersectTriangleLanes(Ray3Lanes rays, Ray3TriangleLanes triangles, simd_float4 maxDistances, simd_float4 *outDistances) {
+	VUCKT_NO_FP_CONTRACT
+	simd_float4 aX = triangles.aX - rays.originX, aY = triangles.aY - rays.originY, aZ = triangles.aZ - rays.originZ;
+	simd_float4 bX = triangles.bX - rays.originX, bY = triangles.bY - rays.originY, bZ = triangles.bZ - rays.originZ;
+	simd_float4 cX = triangles.cX - rays.originX, cY = triangles.cY - rays.originY, cZ = triangles.cZ - rays.originZ;
+	simd_float4 cbX = cY * bZ - cZ * bY, cbY = cZ * bX - cX * bZ, cbZ = cX * bY - cY * bX;
+	simd_float4 acX = aY * cZ - aZ * cY, acY = aZ * cX - aX * cZ, acZ = aX * cY - aY * cX;
+	simd_float4 baX = bY * aZ - bZ * aY, baY = bZ * aX - bX * aZ, baZ = bX * aY - bY * aX;
+	simd_float4 weightA = rays.directionX * cbX + rays.directionY * cbY + rays.directionZ * cbZ;
+	simd_float4 weightB = rays.directionX * acX + rays.directionY * acY + rays.directionZ * acZ;
+	simd_float4 weightC = rays.directionX * baX + rays.directionY * baY + rays.directionZ * baZ;
+	simd_float4 determinant = weightA + weightB + weightC;
+	simd_float4 distance = (aX * cbX + aY * cbY + aZ * cbZ) / determinant;
+	simd_int4 isInside = ((weightA >= 0) & (weightB >= 0) & (weightC >= 0)) | ((weightA <= 0) & (weightB <= 0) & (weightC <= 0));
+	simd_int4 isHit = isInside & (determinant != 0) & (distance >= 0) & (distance <= maxDistances);
+	*outDistances = vuckt_simd_select4(isHit, distance, (simd_float4){ INFINITY, INFINITY, INFINITY, INFINITY });
+	return isHit;
+}
+
+/// `_Ray3ClipToSlab()`, per lane.
+NS_INLINE void _Ray3LanesClipToSlab(simd_float4 *entry, simd_float4 *exit, simd_float4 min, simd_float4 max, simd_float4 origin, simd_float4 inverseDirection) {
+	simd_float4 t0 = (min - origin) * inverseDirection, t1 = (max - origin) * inverseDirection;
+	simd_int4 isT0Nearer = (t0 < t1);
+	simd_float4 tNear = vuckt_simd_select4(isT0Nearer, t0, t1), tFar = vuckt_simd_select4(isT0Nearer, t1, t0);
+	simd_int4 isDefined = (t0 == t0) & (t1 == t1);
+	*entry = vuckt_simd_select4(isDefined & (tNear > *entry), tNear, *entry);
+	*exit = vuckt_simd_select4(isDefined & (tFar < *exit), tFar, *exit);
+}
+/// Per lane, `Ray3IntersectAABB3()` of that lane's ray & box, within that lane's `maxDistances`.
+NS_INLINE simd_int4 Ray3LanesIntersectBoxLanes(Ray3Lanes rays, Ray3BoxLanes boxes, simd_float4 maxDistances, simd_float4 *outDistances) {
+	simd_float4 entry = { 0, 0, 0, 0 }, exit = maxDistances;
+	_Ray3LanesClipToSlab(&entry, &exit, boxes.minX, boxes.maxX, rays.originX, rays.inverseDirectionX);
+	_Ray3LanesClipToSlab(&entry, &exit, boxes.minY, boxes.maxY, rays.originY, rays.inverseDirectionY);
+	_Ray3LanesClipToSlab(&entry, &exit, boxes.minZ, boxes.maxZ, rays.originZ, rays.inverseDirectionZ);
+	simd_int4 isHit = (entry <= exit);
+	*outDistances = vuckt_simd_select4(isHit, entry, (simd_float4){ INFINITY, INFINITY, INFINITY, INFINITY });
+	return isHit;
+}
+
+
+
+#pragma mark Batch Kernels
+
+// Many rays against one primitive, or one ray against many primitives, 8 per iteration as two 4-lane halves (with the one side broadcast once for the whole batch).
+// Each writes every pair's distance (+∞ for a miss) to `outDistances`, & if `outHitBits` is given, sets bit `i % 8` of `outHitBits[i / 8]` for each pair `i` that hit (clearing it for each that missed, & any bits past the last), for all `(n + 7) / 8` of its bytes; & returns the hit count.
+
+/// Stores a block's two halves' results (see above) at `i`, returning its hit count.
+NS_INLINE size_t _Ray3StoreBlock8(simd_int4 hitMask0, simd_int4 hitMask1, simd_float4 distances0, simd_float4 distances1, size_t i, size_t count, float *outDistances, uint8_t *VUCKT_NULLABLE outHitBits) {
+	simd_int4 hitBits = (hitMask0 & (simd_int4){ 1, 2, 4, 8 }) | (hitMask1 & (simd_int4){ 16, 32, 64, 128 });
+	unsigned int blockHitBits = (unsigned int)(hitBits[0] | hitBits[1] | hitBits[2] | hitBits[3]) & ((1u << count) - 1);
+	if (outHitBits != NULL)
+		outHitBits[i / 8] = (uint8_t)blockHitBits;
+	if (count == 8) {
+		memcpy(&outDistances[i], &distances0, sizeof(simd_float4));
+		memcpy(&outDistances[i + 4], &distances1, sizeof(simd_float4));
+	}
+	else {
+		for (size_t laneI = 0; laneI < count; ++laneI)
+			outDistances[i + laneI] = (laneI < 4) ? distances0[laneI] : distances1[laneI - 4];
+	}
+	return (size_t)__builtin_popcount(blockHitBits);
+}
+/// Runs the lane-kernel call `...` over an `n`-element batch 8 at a time (see `VUCKT_FOR_EACH_BLOCK8()`), once per 4-lane half with `first` (the half's first index), `laneCount` (its element count), & `outLaneDistances` (where it writes its distances) in scope, storing each block's results & accumulating its hit count into `hitCount`.
+#define _VUCKT_RAY3_FOR_EACH_INTERSECTED_BLOCK8(n, outDistances, outHitBits, hitCount, first, laneCount, outLaneDistances, ...) \
+	VUCKT_FOR_EACH_BLOCK8(n, i, count, { \
+		simd_float4 distances0, distances1; \
+		simd_int4 hitMask0, hitMask1; \
+		{ const size_t first = i, laneCount = (count < 4) ? count : 4; simd_float4 *outLaneDistances = &distances0; hitMask0 = (__VA_ARGS__); } \
+		hitMask1 = hitMask0, distances1 = distances0; \
+		if (count > 4) { const size_t first = i + 4, laneCount = count - 4; simd_float4 *outLaneDistances = &distances1; hitMask1 = (__VA_ARGS__); } \
+		hitCount += _Ray3StoreBlock8(hitMask0, hitMask1, distances0, distances1, i, count, (outDistances), (outHitBits)); \
+	})
+
+/// `outDistances[i] = Ray3IntersectTriangle(rays[i], a, b, c, maxDistance, NULL, NULL)`
+NS_INLINE size_t Ray3ArrayIntersectTriangle(const Ray3 *rays, Float3 a, Float3 b, Float3 c, float maxDistance, float *outDistances, uint8_t *VUCKT_NULLABLE outHitBits, size_t n) {
+	Ray3TriangleLanes triangle = Ray3TriangleLanesBroadcast(a, b, c);
+	simd_float4 maxDistances = { maxDistance, maxDistance, maxDistance, maxDistance };
+	size_t hitCount = 0;
+	_VUCKT_RAY3_FOR_EACH_INTERSECTED_BLOCK8(n, outDistances, outHitBits, hitCount, first, laneCount, laneDistances,
+		Ray3LanesIntersectTriangleLanes(Ray3LanesLoad(rays + first, laneCount), triangle, maxDistances, laneDistances)
+	);
+	return hitCount;
+}
+/// `outDistances[i] = Ray3IntersectAABB3(rays[i], box, maxDistance)`
+NS_INLINE size_t Ray3ArrayIntersectAABB3(const Ray3 *rays, AABB3 box, float maxDistance, float *outDistances, uint8_t *VUCKT_NULLABLE outHitBits, size_t n) {
+	Ray3BoxLanes boxLanes = Ray3BoxLanesBroadcast(box);
+	simd_float4 maxDistances = { maxDistance, maxDistance, maxDistance, maxDistance };
+	size_t hitCount = 0;
+	_VUCKT_RAY3_FOR_EACH_INTERSECTED_BLOCK8(n, outDistances, outHitBits, hitCount, first, laneCount, laneDistances,
+		Ray3LanesIntersectBoxLanes(Ray3LanesLoad(rays + first, laneCount), boxLanes, maxDistances, laneDistances)
+	);
+	return hitCount;
+}
+
+/// `outDistances[i] = Ray3IntersectTriangle(ray, <triangle i>, maxDistance, NULL, NULL)`, for the `n` triangles of `vertices` indexed by each 3 consecutive `triangleVertexIndices`.
+NS_INLINE size_t Ray3IntersectTriangleArray(Ray3 ray, const Float3 *vertices, const uint32_t *triangleVertexIndices, float maxDistance, float *outDistances, uint8_t *VUCKT_NULLABLE outHitBits, size_t n) {
+	Ray3Lanes rayLanes = Ray3LanesBroadcast(ray);
+	simd_float4 maxDistances = { maxDistance, maxDistance, maxDistance, maxDistance };
+	size_t hitCount = 0;
+	_VUCKT_RAY3_FOR_EACH_INTERSECTED_BLOCK8(n, outDistances, outHitBits, hitCount, first, laneCount, laneDistances,
+		Ray3LanesIntersectTriangleLanes(rayLanes, Ray3TriangleLanesLoad(vertices, triangleVertexIndices + first * 3, laneCount), maxDistances, laneDistances)
+	);
+	return hitCount;
+}
+/// `outDistances[i] = Ray3IntersectAABB3(ray, boxes[i], maxDistance)`
+NS_INLINE size_t Ray3IntersectAABB3Array(Ray3 ray, const AABB3 *boxes, float maxDistance, float *outDistances, uint8_t *VUCKT_NULLABLE outHitBits, size_t n) {
+	Ray3Lanes rayLanes = Ray3LanesBroadcast(ray);
+	simd_float4 maxDistances = { maxDistance, maxDistance, maxDistance, maxDistance };
+	size_t hitCount = 0;
+	_VUCKT_RAY3_FOR_EACH_INTERSECTED_BLOCK8(n, outDistances, outHitBits, hitCount, first, laneCount, laneDistances,
+		Ray3LanesIntersectBoxLanes(rayLanes, Ray3BoxLanesLoad(boxes + first, laneCount), maxDistances, laneDistances)
+	);
+	return hitCount;
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
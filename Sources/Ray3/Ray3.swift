@@ -0,0 +1,132 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+/// A ray, `origin + t · direction` for `t` ≥ 0.  Distances along it are in units of `direction`'s length (so true distances if it's normalized).
+extension Ray3
+{
+	// MARK: `init`s
+	
+	/// Initialize to the ray from `origin` through `target` (which is then at distance 1).
+	@_transparent public init(from origin:Float3, through target:Float3) {
+		self.init(origin: origin, direction: target - origin)
+	}
+	
+	
+	// MARK: Queries
+	
+	/// The point `distance` along the ray.
+	@_transparent public func point(at distance:Float) -> Float3 {
+		return Ray3PointAt(self, distance)
+	}
+	
+	/// Where the ray hits triangle `a`,`b`,`c` (from either side, edges & vertices included) within `maxDistance`, if it does: the distance along it, & the hit's barycentric `u` & `v` (the weights of `b` & `c`).
+	/// Watertight along shared edges: a ray through an edge two triangles share hits at least one of them.
+	@_alwaysEmitIntoClient public func intersect(triangle a:Float3, _ b:Float3, _ c:Float3, maxDistance:Float = .infinity) -> (distance:Float, u:Float, v:Float)? {
+		var u:Float = 0, v:Float = 0
+		let distance = Ray3IntersectTriangle(self, a, b, c, maxDistance, &u, &v)
+		return (distance != .infinity) ? (distance, u, v) : nil
+	}
+	/// The distance along the ray to where it enters `box` (0 if it starts inside) within `maxDistance`, if it does.
+	@_alwaysEmitIntoClient public func intersect(_ box:AABB3, maxDistance:Float = .infinity) -> Float? {
+		let distance = Ray3IntersectAABB3(self, box, maxDistance)
+		return (distance != .infinity) ? distance : nil
+	}
+}
+
+
+extension Ray3 : CustomStringConvertible
+{
+	public var description:String {
+		return "\(self.origin) + t·\(self.direction)"
+	}
+}
+
+
+extension Ray3 : Equatable
+{
+	@_transparent public static func ==(a:Ray3, b:Ray3) -> Bool {
+		return a.origin == b.origin && a.direction == b.direction
+	}
+}
+
+
+extension Ray3 // Batch Intersection
+{
+	// These run 8 primitives per iteration through the C kernels (see `Ray3.h`), as two packets of 4 in vector lanes, with this ray broadcast across them.
+	// Each writes every primitive's distance (+∞ for a miss), bit-for-bit the same as the single-primitive `intersect(…)` would find, & returns the hit count.
+	
+	/// Writes the distance along the ray to each triangle of `vertices` (indexed by each 3 consecutive `triangleVertexIndices`) into `out`.
+	/// - Precondition: `triangleVertexIndices.count` must be a multiple of 3, & `out` have one element per triangle.
+	@_alwaysEmitIntoClient public func intersect(triangles vertices:UnsafeBufferPointer<Float3>, triangleVertexIndices:UnsafeBufferPointer<UInt32>, maxDistance:Float = .infinity, distancesInto out:UnsafeMutableBufferPointer<Float>) -> Int {
+		precondition(triangleVertexIndices.count % 3 == 0, "Triangle vertex indices must come in 3s.")
+		precondition(out.count == triangleVertexIndices.count / 3, "Distance buffer must have one element per triangle.")
+		guard out.count > 0 else { return 0 }
+		return Ray3IntersectTriangleArray(self, vertices.baseAddress!, triangleVertexIndices.baseAddress!, maxDistance, out.baseAddress!, nil, out.count)
+	}
+	/// The distance along the ray to each triangle of `vertices` (indexed by each 3 consecutive `triangleVertexIndices`), +∞ for each it misses.
+	@_alwaysEmitIntoClient public func distances(toTriangles vertices:[Float3], triangleVertexIndices:[UInt32], maxDistance:Float = .infinity) -> [Float] {
+		let triangleCount = triangleVertexIndices.count / 3
+		return vertices.withUnsafeBufferPointer{ verticesBuffer in
+			triangleVertexIndices.withUnsafeBufferPointer{ indicesBuffer in
+				[Float](unsafeUninitializedCapacity: triangleCount){ outBuffer, initializedCount in
+					_ = self.intersect(triangles: verticesBuffer, triangleVertexIndices: indicesBuffer, maxDistance: maxDistance, distancesInto: UnsafeMutableBufferPointer(rebasing: outBuffer[0..<triangleCount]))
+					initializedCount = triangleCount
+				}
+			}
+		}
+	}
+	
+	/// Writes the distance along the ray to each of `boxes` into `out`.  (Both buffers must have the same count.)
+	@_alwaysEmitIntoClient public func intersect(_ boxes:UnsafeBufferPointer<AABB3>, maxDistance:Float = .infinity, distancesInto out:UnsafeMutableBufferPointer<Float>) -> Int {
+		precondition(out.count == boxes.count, "Bulk operation buffers must all have the same count.")
+		guard boxes.count > 0 else { return 0 }
+		return Ray3IntersectAABB3Array(self, boxes.baseAddress!, maxDistance, out.baseAddress!, nil, boxes.count)
+	}
+	/// The distance along the ray to each of `boxes`, +∞ for each it misses.
+	@_alwaysEmitIntoClient public func distances(to boxes:[AABB3], maxDistance:Float = .infinity) -> [Float] {
+		return boxes._vucktBulkConversion{ _ = Ray3IntersectAABB3Array(self, $0, maxDistance, $1, nil, $2) }
+	}
+}
+
+extension UnsafeBufferPointer where Element == Ray3 // Batch Intersection
+{
+	// As with `Ray3`'s, these run 8 rays per iteration, as two packets of 4, with the primitive broadcast across them.
+	
+	/// Writes the distance along each ray to triangle `a`,`b`,`c` (see `Ray3.intersect(triangle:_:_:maxDistance:)`) into `out`, returning the hit count.  (Both buffers must have the same count.)
+	@_alwaysEmitIntoClient public func intersect(triangle a:Float3, _ b:Float3, _ c:Float3, maxDistance:Float = .infinity, distancesInto out:UnsafeMutableBufferPointer<Float>) -> Int {
+		precondition(out.count == self.count, "Bulk operation buffers must all have the same count.")
+		guard self.count > 0 else { return 0 }
+		return Ray3ArrayIntersectTriangle(self.baseAddress!, a, b, c, maxDistance, out.baseAddress!, nil, self.count)
+	}
+	/// Writes the distance along each ray to `box` (see `Ray3.intersect(_:maxDistance:)`) into `out`, returning the hit count.  (Both buffers must have the same count.)
+	@_alwaysEmitIntoClient public func intersect(_ box:AABB3, maxDistance:Float = .infinity, distancesInto out:UnsafeMutableBufferPointer<Float>) -> Int {
+		precondition(out.count == self.count, "Bulk operation buffers must all have the same count.")
+		guard self.count > 0 else { return 0 }
+		return Ray3ArrayIntersectAABB3(self.baseAddress!, box, maxDistance, out.baseAddress!, nil, self.count)
+	}
+}
+
+extension Array where Element == Ray3 // Batch Intersection
+{
+	/// The distance along each ray to triangle `a`,`b`,`c`, +∞ for each that misses it.
+	@_alwaysEmitIntoClient public func distances(toTriangle a:Float3, _ b:Float3, _ c:Float3, maxDistance:Float = .infinity) -> [Float] {
+		return self._vucktBulkConversion{ _ = Ray3ArrayIntersectTriangle($0, a, b, c, maxDistance, $1, nil, $2) }
+	}
+	/// The distance along each ray to `box`, +∞ for each that misses it.
+	@_alwaysEmitIntoClient public func distances(to box:AABB3, maxDistance:Float = .infinity) -> [Float] {
+		return self._vucktBulkConversion{ _ = Ray3ArrayIntersectAABB3($0, box, maxDistance, $1, nil, $2) }
+	}
+}
@@ -0,0 +1,109 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Ray3
+{
+	public var origin:Float3
+	public var direction:Float3
+	
+	public init() {
+		self.origin = Float3()
+		self.direction = Float3()
+	}
+	
+	public init(origin:Float3, direction:Float3) {
+		self.origin = origin
+		self.direction = direction
+	}
+}
+
+
+
+// MARK: Construction & Queries
+
+@_transparent public func Ray3PointAt(_ ray:Ray3, _ distance:Float) -> Float3 {
+	return Float3(ray.origin.x + ray.direction.x * distance, ray.origin.y + ray.direction.y * distance, ray.origin.z + ray.direction.z * distance)
+}
+
+
+
+// MARK: Scalar Intersection
+
+@_alwaysEmitIntoClient public func Ray3IntersectTriangle(_ ray:Ray3, _ a:Float3, _ b:Float3, _ c:Float3, _ maxDistance:Float, _ outU:UnsafeMutablePointer<Float>?, _ outV:UnsafeMutablePointer<Float>?) -> Float {
+	let o = ray.origin, d = ray.direction
+	let aX = a.x - o.x, aY = a.y - o.y, aZ = a.z - o.z
+	let bX = b.x - o.x, bY = b.y - o.y, bZ = b.z - o.z
+	let cX = c.x - o.x, cY = c.y - o.y, cZ = c.z - o.z
+	let cbX = cY * bZ - cZ * bY, cbY = cZ * bX - cX * bZ, cbZ = cX * bY - cY * bX
+	let acX = aY * cZ - aZ * cY, acY = aZ * cX - aX * cZ, acZ = aX * cY - aY * cX
+	let baX = bY * aZ - bZ * aY, baY = bZ * aX - bX * aZ, baZ = bX * aY - bY * aX
+	let weightA = d.x * cbX + d.y * cbY + d.z * cbZ
+	let weightB = d.x * acX + d.y * acY + d.z * acZ
+	let weightC = d.x * baX + d.y * baY + d.z * baZ
+	let determinant = weightA + weightB + weightC
+	let distance = (aX * cbX + aY * cbY + aZ * cbZ) / determinant
+	outU?.pointee = weightB / determinant
+	outV?.pointee = weightC / determinant
+	let isInside = (weightA >= 0 && weightB >= 0 && weightC >= 0) || (weightA <= 0 && weightB <= 0 && weightC <= 0)
+	return (isInside && determinant != 0 && distance >= 0 && distance <= maxDistance) ? distance : .infinity
+}
+
+@_alwaysEmitIntoClient public func Ray3IntersectAABB3(_ ray:Ray3, _ box:AABB3, _ maxDistance:Float) -> Float {
+	let t0 = (Float3ToSimd(box.min) - Float3ToSimd(ray.origin)) * (1 / Float3ToSimd(ray.direction))
+	let t1 = (Float3ToSimd(box.max) - Float3ToSimd(ray.origin)) * (1 / Float3ToSimd(ray.direction))
+	var entry:Float = 0, exit = maxDistance
+	for axis in 0..<3 where !t0[axis].isNaN && !t1[axis].isNaN {
+		entry = Swift.max(entry, Swift.min(t0[axis], t1[axis]))
+		exit = Swift.min(exit, Swift.max(t0[axis], t1[axis]))
+	}
+	return (entry <= exit) ? entry : .infinity
+}
+
+
+
+// MARK: Batch Kernels
+
+@usableFromInline internal func _vucktRay3StoreResults(_ n:Int, _ outDistances:UnsafeMutablePointer<Float>, _ outHitBits:UnsafeMutablePointer<UInt8>?, _ distanceAt:(Int) -> Float) -> Int {
+	var hitCount = 0
+	for byteI in 0..<((n + 7) / 8) {
+		var bits:UInt8 = 0
+		for bitI in 0..<Swift.min(8, n - byteI * 8) {
+			let distance = distanceAt(byteI * 8 + bitI)
+			outDistances[byteI * 8 + bitI] = distance
+			if distance != .infinity {
+				bits |= 1 << UInt8(bitI)
+				hitCount += 1
+			}
+		}
+		outHitBits?[byteI] = bits
+	}
+	return hitCount
+}
+
+@_alwaysEmitIntoClient public func Ray3ArrayIntersectTriangle(_ rays:UnsafePointer<Ray3>, _ a:Float3, _ b:Float3, _ c:Float3, _ maxDistance:Float, _ outDistances:UnsafeMutablePointer<Float>, _ outHitBits:UnsafeMutablePointer<UInt8>?, _ n:Int) -> Int {
+	return _vucktRay3StoreResults(n, outDistances, outHitBits){ Ray3IntersectTriangle(rays[$0], a, b, c, maxDistance, nil, nil) }
+}
+@_alwaysEmitIntoClient public func Ray3ArrayIntersectAABB3(_ rays:UnsafePointer<Ray3>, _ box:AABB3, _ maxDistance:Float, _ outDistances:UnsafeMutablePointer<Float>, _ outHitBits:UnsafeMutablePointer<UInt8>?, _ n:Int) -> Int {
+	return _vucktRay3StoreResults(n, outDistances, outHitBits){ Ray3IntersectAABB3(rays[$0], box, maxDistance) }
+}
+
+@_alwaysEmitIntoClient public func Ray3IntersectTriangleArray(_ ray:Ray3, _ vertices:UnsafePointer<Float3>, _ triangleVertexIndices:UnsafePointer<UInt32>, _ maxDistance:Float, _ outDistances:UnsafeMutablePointer<Float>, _ outHitBits:UnsafeMutablePointer<UInt8>?, _ n:Int) -> Int {
+	return _vucktRay3StoreResults(n, outDistances, outHitBits){ triangleI in
+		let vertexIndices = triangleVertexIndices + triangleI * 3
+		return Ray3IntersectTriangle(ray, vertices[Int(vertexIndices[0])], vertices[Int(vertexIndices[1])], vertices[Int(vertexIndices[2])], maxDistance, nil, nil)
+	}
+}
+@_alwaysEmitIntoClient public func Ray3IntersectAABB3Array(_ ray:Ray3, _ boxes:UnsafePointer<AABB3>, _ maxDistance:Float, _ outDistances:UnsafeMutablePointer<Float>, _ outHitBits:UnsafeMutablePointer<UInt8>?, _ n:Int) -> Int {
+	return _vucktRay3StoreResults(n, outDistances, outHitBits){ Ray3IntersectAABB3(ray, boxes[$0], maxDistance) }
+}
@@ -0,0 +1,164 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Int2.h>)
+	#import <Vuckt/Int2.h>
+#else
+	#include "../Int2/Int2.h"
+#endif
+#if __has_include(<Vuckt/Float2.h>)
+	#import <Vuckt/Float2.h>
+#else
+	#include "../Float2/Float2.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 2-component vector of 16-bit signed integers (4 bytes, matching `simd_short2`), for compact storage— quantized texture coordinates & 2D positions, & the like.
+/// Widen to `Int2` or `Float2` (e.g. with `Short2ToInt2()`, or in bulk with `Short2ArrayToInt2Array()`) to do math.
+struct Short2 {
+	short x, y;
+} __attribute__((aligned(__alignof__(simd_short2))));
+typedef struct Short2 Short2;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Short2` struct to `simd_short2` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_short2 Short2ToSimd(Short2 structValue) {
+	return *(simd_short2 *)&structValue;
+}
+/// Converts a `Short2` struct from `simd_short2` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Short2 Short2FromSimd(simd_short2 simdValue) {
+	return *(Short2 *)&simdValue;
+}
+
+
+
+#pragma mark Int2 Conversion
+
+// The clamping & normalizing conversions go through `VucktPlatform.h`'s 4-lane kernels, with `x` & `y` repeated in the upper 2 lanes.
+
+/// Widens each element to `int` (exactly).
+NS_INLINE Int2 Short2ToInt2(Short2 value) {
+	return Int2FromSimd(__builtin_convertvector(Short2ToSimd(value), simd_int2));
+}
+/// Narrows each element to its low 16 bits, wrapping out-of-range values around (as a `(short)` cast does).
+NS_INLINE Short2 Short2FromInt2Truncating(Int2 value) {
+	return Short2FromSimd(__builtin_convertvector(Int2ToSimd(value), simd_short2));
+}
+/// Narrows each element, clamping it to [ -32768, 32767 ].
+NS_INLINE Short2 Short2FromInt2Saturating(Int2 value) {
+	simd_int4 lanes = vuckt_simd_clamp4((simd_int4){ value.x, value.y, value.x, value.y }, -32768, 32767);
+	return (Short2){ (short)lanes[0], (short)lanes[1] };
+}
+
+
+
+#pragma mark Float2 Conversion
+
+/// Converts each element to `float` (exactly).
+NS_INLINE Float2 Short2ToFloat2(Short2 value) {
+	return Float2FromSimd(__builtin_convertvector(Short2ToSimd(value), simd_float2));
+}
+/// Converts each element, clamping it to [ -32768, 32767 ] (NaN becoming 0) & truncating toward zero.
+NS_INLINE Short2 Short2FromFloat2Saturating(Float2 value) {
+	simd_int4 lanes = vuckt_simd_float_to_int_clamped4((simd_float4){ value.x, value.y, value.x, value.y }, -32768.0f, 32767.0f);
+	return (Short2){ (short)lanes[0], (short)lanes[1] };
+}
+/// Decodes each element as SNORM, mapping [ -32767, 32767 ] onto [ -1, 1 ] (with -32768 also mapping to -1).
+NS_INLINE Float2 Short2ToFloat2Normalized(Short2 value) {
+	simd_float4 lanes = vuckt_simd_snorm_to_float4((simd_int4){ value.x, value.y, value.x, value.y }, 32767.0f);
+	return (Float2){ lanes[0], lanes[1] };
+}
+/// Encodes each element as SNORM: clamps it to [ -1, 1 ] (NaN becoming 0) & maps that onto [ -32767, 32767 ], rounding to nearest.
+NS_INLINE Short2 Short2FromFloat2Normalized(Float2 value) {
+	simd_int4 lanes = vuckt_simd_snorm_from_float4((simd_float4){ value.x, value.y, value.x, value.y }, 32767.0f);
+	return (Short2){ (short)lanes[0], (short)lanes[1] };
+}
+
+
+
+#pragma mark Bulk Conversion
+
+// Element-wise conversions over `n`-element arrays.  `out` must not overlap the input array.
+// The widening & truncating conversions loop over the flat lanes, so the compiler can vectorize them across elements at the target's full vector width; the clamping & normalizing ones go element-by-element through the branch-free vector kernels above.
+
+/// `out[i] = Short2ToInt2(values[i])`
+NS_INLINE void Short2ArrayToInt2Array(const Short2 *values, Int2 *out, size_t n) {
+	const short *valueLanes = (const short *)values;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Short2) / sizeof(short)); ++laneI) {
+		outLanes[laneI] = valueLanes[laneI];
+	}
+}
+/// `out[i] = Short2FromInt2Truncating(values[i])`
+NS_INLINE void Short2ArrayFromInt2ArrayTruncating(const Int2 *values, Short2 *out, size_t n) {
+	const int *valueLanes = (const int *)values;
+	short *outLanes = (short *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int2) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (short)valueLanes[laneI];
+	}
+}
+/// `out[i] = Short2FromInt2Saturating(values[i])`
+NS_INLINE void Short2ArrayFromInt2ArraySaturating(const Int2 *values, Short2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short2FromInt2Saturating(values[i]);
+	}
+}
+/// `out[i] = Short2ToFloat2(values[i])`
+NS_INLINE void Short2ArrayToFloat2Array(const Short2 *values, Float2 *out, size_t n) {
+	const short *valueLanes = (const short *)values;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Short2) / sizeof(short)); ++laneI) {
+		outLanes[laneI] = (float)valueLanes[laneI];
+	}
+}
+/// `out[i] = Short2FromFloat2Saturating(values[i])`
+NS_INLINE void Short2ArrayFromFloat2ArraySaturating(const Float2 *values, Short2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short2FromFloat2Saturating(values[i]);
+	}
+}
+/// `out[i] = Short2ToFloat2Normalized(values[i])`
+NS_INLINE void Short2ArrayToFloat2ArrayNormalized(const Short2 *values, Float2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short2ToFloat2Normalized(values[i]);
+	}
+}
+/// `out[i] = Short2FromFloat2Normalized(values[i])`
+NS_INLINE void Short2ArrayFromFloat2ArrayNormalized(const Float2 *values, Short2 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short2FromFloat2Normalized(values[i]);
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
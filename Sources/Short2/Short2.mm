@@ -0,0 +1,18 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Short2.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Short2, x) == sizeof(simd_short1),
+	"Short2's first member's size does not match simd_short1's on this platform.");
+static_assert(sizeof(Short2) == sizeof(simd_short2),
+	"Short2's size does not match simd_short2's on this platform.");
+static_assert(sizeof_member(Short2, x) == sizeof_member(simd_short2, x),
+	"Short2's first member's size does not match simd_short2's first member's on this platform.");
+static_assert(alignof(Short2) == alignof(simd_short2),
+	"Short2's alignment requirements does not match simd_short2's on this platform.");
@@ -0,0 +1,214 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension Short2
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements.
+	@_transparent public init(_ x:Int16, _ y:Int16) {
+		self.init(x: x, y: y)
+	}
+	
+	/// Initialize to a vector with all elements equal to `scalar`.
+	@_transparent public init(scalar:Int16) {
+		self.init(scalar, scalar)
+	}
+	
+	/// Initialize to a SIMD vector.
+	@_transparent public init(_ value:SIMD2<Int16>) {
+		self = Short2FromSimd(value)
+	}
+	
+	/// Initialize from an `Int2` value, keeping each element's low 16 bits (wrapping out-of-range values around).
+	@_transparent public init(truncatingIfNeeded int2Value:Int2) {
+		self = Short2FromInt2Truncating(int2Value)
+	}
+	/// Initialize from an `Int2` value, clamping to the representable range of the element type.
+	@_transparent public init(clamping int2Value:Int2) {
+		self = Short2FromInt2Saturating(int2Value)
+	}
+	/// Initialize from a `Float2` value, clamping to the representable range of the element type (NaN becoming 0) & truncating toward zero.
+	@_transparent public init(saturating float2Value:Float2) {
+		self = Short2FromFloat2Saturating(float2Value)
+	}
+	/// Initialize from a `Float2` value by SNORM encoding, clamping each element to [ -1, 1 ] & mapping it onto [ -32767, 32767 ], rounding to nearest.
+	@_transparent public init(normalized float2Value:Float2) {
+		self = Short2FromFloat2Normalized(float2Value)
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Short2 { return Short2(scalar: 0) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	@_transparent public var asTuple:(x:Int16,y:Int16) {
+		return ( self.x, self.y )
+	}
+	
+	@_transparent public var asArray:[Int16] {
+		return [ self.x, self.y ]
+	}
+	
+	/// Each element widened to `Int32`.
+	@_transparent public var int2Value:Int2 {
+		return Short2ToInt2(self)
+	}
+	
+	/// Each element converted to `Float`.
+	@_transparent public var float2Value:Float2 {
+		return Short2ToFloat2(self)
+	}
+	
+	/// Each element decoded as SNORM, mapping [ -32767, 32767 ] onto [ -1, 1 ] (with -32768 also mapping to -1).
+	@_transparent public var normalizedFloat2Value:Float2 {
+		return Short2ToFloat2Normalized(self)
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	@_transparent public var simdValue:SIMD2<Int16> {
+		return Short2ToSimd(self)
+	}
+}
+
+
+extension Int2
+{
+	/// Initialize from a `Short2` value, widening each element.
+	@_transparent public init(_ short2Value:Short2) {
+		self = Short2ToInt2(short2Value)
+	}
+}
+
+extension Float2
+{
+	/// Initialize from a `Short2` value, converting each element.
+	@_transparent public init(_ short2Value:Short2) {
+		self = Short2ToFloat2(short2Value)
+	}
+	
+	/// Initialize from a `Short2` value by SNORM decoding, mapping [ -32767, 32767 ] onto [ -1, 1 ] (with -32768 also mapping to -1).
+	@_transparent public init(normalized short2Value:Short2) {
+		self = Short2ToFloat2Normalized(short2Value)
+	}
+}
+
+
+extension Short2 : CustomStringConvertible
+{
+	public var description:String {
+		return "(\(self.x), \(self.y))"
+	}
+}
+
+
+extension Short2 : Equatable
+{
+	@_transparent public static func ==(a:Short2, b:Short2) -> Bool {
+		return a.x == b.x && a.y == b.y
+	}
+}
+
+
+extension Short2 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			self.asArray.forEach{ hasher.combine($0) }
+		}
+	#else
+		public var hashValue:Int {
+			return self.asArray.enumerated().reduce(0){ (hashValue, element:(offset:Int,value:Int16)) in
+				return hashValue | ((Int(truncatingIfNeeded: element.value) & 0xFFFF) << (element.offset * 16))
+			}
+		}
+	#endif
+}
+
+
+extension UnsafeBufferPointer where Element == Short2 // Bulk Conversion
+{
+	/// Widens every element into `out`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Int2>) {
+		self._vucktBulkConversion(into: out, Short2ArrayToInt2Array)
+	}
+	/// Converts every element into `out`, decoding them as SNORM if `normalized`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Float2>, normalized:Bool = false) {
+		self._vucktBulkConversion(into: out, normalized ? Short2ArrayToFloat2ArrayNormalized : Short2ArrayToFloat2Array)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Int2 // Bulk Conversion
+{
+	/// Narrows every element into `out`, handling out-of-range values per `mode`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Short2>, mode:IntegerNarrowingMode = .truncating) {
+		switch mode {
+			case .truncating: self._vucktBulkConversion(into: out, Short2ArrayFromInt2ArrayTruncating)
+			case .clamping: self._vucktBulkConversion(into: out, Short2ArrayFromInt2ArraySaturating)
+		}
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float2 // Bulk Conversion
+{
+	/// Narrows every element into `out`, per `mode`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Short2>, mode:FloatNarrowingMode = .saturating) {
+		switch mode {
+			case .saturating: self._vucktBulkConversion(into: out, Short2ArrayFromFloat2ArraySaturating)
+			case .normalized: self._vucktBulkConversion(into: out, Short2ArrayFromFloat2ArrayNormalized)
+		}
+	}
+}
+
+extension Array where Element == Int2
+{
+	/// Widens an array of `Short2`s.
+	@_alwaysEmitIntoClient public init(_ short2Values:[Short2]) {
+		self = short2Values._vucktBulkConversion(Short2ArrayToInt2Array)
+	}
+}
+
+extension Array where Element == Float2
+{
+	/// Converts an array of `Short2`s, decoding them as SNORM if `normalized`.
+	@_alwaysEmitIntoClient public init(_ short2Values:[Short2], normalized:Bool = false) {
+		self = short2Values._vucktBulkConversion(normalized ? Short2ArrayToFloat2ArrayNormalized : Short2ArrayToFloat2Array)
+	}
+}
+
+extension Array where Element == Short2
+{
+	/// Narrows an array of `Int2`s, handling out-of-range values per `mode`.
+	@_alwaysEmitIntoClient public init(_ int2Values:[Int2], mode:IntegerNarrowingMode = .truncating) {
+		switch mode {
+			case .truncating: self = int2Values._vucktBulkConversion(Short2ArrayFromInt2ArrayTruncating)
+			case .clamping: self = int2Values._vucktBulkConversion(Short2ArrayFromInt2ArraySaturating)
+		}
+	}
+	
+	/// Narrows an array of `Float2`s, per `mode`.
+	@_alwaysEmitIntoClient public init(_ float2Values:[Float2], mode:FloatNarrowingMode = .saturating) {
+		switch mode {
+			case .saturating: self = float2Values._vucktBulkConversion(Short2ArrayFromFloat2ArraySaturating)
+			case .normalized: self = float2Values._vucktBulkConversion(Short2ArrayFromFloat2ArrayNormalized)
+		}
+	}
+}
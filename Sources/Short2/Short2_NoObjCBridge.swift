@@ -0,0 +1,116 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Short2
+{
+	public var x:Int16
+	public var y:Int16
+	
+	public init() {
+		self.x = Int16()
+		self.y = Int16()
+	}
+	
+	public init(x:Int16, y:Int16) {
+		self.x = x
+		self.y = y
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Short2` struct to `SIMD2<Int16>` vector using passing-individual-members initialization.
+@_transparent public func Short2ToSimd(_ structValue:Short2) -> SIMD2<Int16> {
+	return SIMD2<Int16>(structValue.x, structValue.y)
+}
+/// Converts a `Short2` struct from `SIMD2<Int16>` vector using passing-individual-members initialization.
+@_transparent public func Short2FromSimd(_ simdValue:SIMD2<Int16>) -> Short2 {
+	return Short2(x: simdValue.x, y: simdValue.y)
+}
+
+
+
+// MARK: Int2 Conversion
+
+@_transparent public func Short2ToInt2(_ value:Short2) -> Int2 {
+	return Int2FromSimd(simd_int2(truncatingIfNeeded: Short2ToSimd(value)))
+}
+@_transparent public func Short2FromInt2Truncating(_ value:Int2) -> Short2 {
+	return Short2FromSimd(SIMD2<Int16>(truncatingIfNeeded: Int2ToSimd(value)))
+}
+@_transparent public func Short2FromInt2Saturating(_ value:Int2) -> Short2 {
+	return Short2FromSimd(SIMD2<Int16>(clamping: Int2ToSimd(value)))
+}
+
+
+
+// MARK: Float2 Conversion
+
+@_transparent public func Short2ToFloat2(_ value:Short2) -> Float2 {
+	return Float2FromSimd(simd_float2(Short2ToSimd(value)))
+}
+@_alwaysEmitIntoClient public func Short2FromFloat2Saturating(_ value:Float2) -> Short2 {
+	let lanes = _vucktFloatToIntClamped(simd_float4(value.x, value.y, value.x, value.y), -32768, 32767)
+	return Short2(x: Int16(truncatingIfNeeded: lanes.x), y: Int16(truncatingIfNeeded: lanes.y))
+}
+@_alwaysEmitIntoClient public func Short2ToFloat2Normalized(_ value:Short2) -> Float2 {
+	let lanes = _vucktSnormToFloat(simd_int4(Int32(value.x), Int32(value.y), Int32(value.x), Int32(value.y)), 32767)
+	return Float2(x: lanes.x, y: lanes.y)
+}
+@_alwaysEmitIntoClient public func Short2FromFloat2Normalized(_ value:Float2) -> Short2 {
+	let lanes = _vucktSnormFromFloat(simd_float4(value.x, value.y, value.x, value.y), 32767)
+	return Short2(x: Int16(truncatingIfNeeded: lanes.x), y: Int16(truncatingIfNeeded: lanes.y))
+}
+
+
+
+// MARK: Bulk Conversion
+
+@_alwaysEmitIntoClient public func Short2ArrayToInt2Array(_ values:UnsafePointer<Short2>, _ out:UnsafeMutablePointer<Int2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short2ToInt2(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short2ArrayFromInt2ArrayTruncating(_ values:UnsafePointer<Int2>, _ out:UnsafeMutablePointer<Short2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short2FromInt2Truncating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short2ArrayFromInt2ArraySaturating(_ values:UnsafePointer<Int2>, _ out:UnsafeMutablePointer<Short2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short2FromInt2Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short2ArrayToFloat2Array(_ values:UnsafePointer<Short2>, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short2ToFloat2(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short2ArrayFromFloat2ArraySaturating(_ values:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Short2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short2FromFloat2Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short2ArrayToFloat2ArrayNormalized(_ values:UnsafePointer<Short2>, _ out:UnsafeMutablePointer<Float2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short2ToFloat2Normalized(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short2ArrayFromFloat2ArrayNormalized(_ values:UnsafePointer<Float2>, _ out:UnsafeMutablePointer<Short2>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short2FromFloat2Normalized(values[i])
+	}
+}
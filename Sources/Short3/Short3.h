@@ -0,0 +1,222 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Int3.h>)
+	#import <Vuckt/Int3.h>
+#else
+	#include "../Int3/Int3.h"
+#endif
+#if __has_include(<Vuckt/Float3.h>)
+	#import <Vuckt/Float3.h>
+#else
+	#include "../Float3/Float3.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 3-component vector of 16-bit signed integers (8 bytes including a padding lane, matching `simd_short3`), for compact storage— quantized positions, voxel coordinates, & the like.
+/// Widen to `Int3` or `Float3` (e.g. with `Short3ToInt3()`, or in bulk with `Short3ArrayToInt3Array()`) to do math.
+struct Short3 {
+	short x, y, z;
+} __attribute__((aligned(__alignof__(simd_short3))));
+typedef struct Short3 Short3;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Short3` struct to `simd_short3` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_short3 Short3ToSimd(Short3 structValue) {
+	#if VUCKT_SIMD3_IS_SIMD4
+		simd_short3 simdValue;
+		memcpy(&simdValue, &structValue, sizeof simdValue);
+		return __builtin_shuffle(simdValue, (simd_short3){ 0, 1, 2, 2 });
+	#else
+		return *(simd_short3 *)&structValue;
+	#endif
+}
+/// Converts a `Short3` struct from `simd_short3` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Short3 Short3FromSimd(simd_short3 simdValue) {
+	#if VUCKT_SIMD3_IS_SIMD4
+		Short3 structValue;
+		memcpy(&structValue, &simdValue, sizeof structValue);
+		return structValue;
+	#else
+		return *(Short3 *)&simdValue;
+	#endif
+}
+
+
+
+#pragma mark Int3 Conversion
+
+// The clamping & normalizing conversions go through `VucktPlatform.h`'s 4-lane kernels, with the lane past `z` repeating it.
+
+/// Widens each element to `int` (exactly).
+NS_INLINE Int3 Short3ToInt3(Short3 value) {
+	return Int3FromSimd(__builtin_convertvector(Short3ToSimd(value), simd_int3));
+}
+/// Narrows each element to its low 16 bits, wrapping out-of-range values around (as a `(short)` cast does).
+NS_INLINE Short3 Short3FromInt3Truncating(Int3 value) {
+	return Short3FromSimd(__builtin_convertvector(Int3ToSimd(value), simd_short3));
+}
+/// Narrows each element, clamping it to [ -32768, 32767 ].
+NS_INLINE Short3 Short3FromInt3Saturating(Int3 value) {
+	simd_int4 lanes = vuckt_simd_clamp4(Int3ToSimdInt4(value), -32768, 32767);
+	return (Short3){ (short)lanes[0], (short)lanes[1], (short)lanes[2] };
+}
+
+
+
+#pragma mark Float3 Conversion
+
+/// Converts each element to `float` (exactly).
+NS_INLINE Float3 Short3ToFloat3(Short3 value) {
+	return Float3FromSimd(__builtin_convertvector(Short3ToSimd(value), simd_float3));
+}
+/// Converts each element, clamping it to [ -32768, 32767 ] (NaN becoming 0) & truncating toward zero.
+NS_INLINE Short3 Short3FromFloat3Saturating(Float3 value) {
+	simd_int4 lanes = vuckt_simd_float_to_int_clamped4((simd_float4){ value.x, value.y, value.z, value.z }, -32768.0f, 32767.0f);
+	return (Short3){ (short)lanes[0], (short)lanes[1], (short)lanes[2] };
+}
+/// Decodes each element as SNORM, mapping [ -32767, 32767 ] onto [ -1, 1 ] (with -32768 also mapping to -1).
+NS_INLINE Float3 Short3ToFloat3Normalized(Short3 value) {
+	simd_float4 lanes = vuckt_simd_snorm_to_float4((simd_int4){ value.x, value.y, value.z, value.z }, 32767.0f);
+	return (Float3){ lanes[0], lanes[1], lanes[2] };
+}
+/// Encodes each element as SNORM: clamps it to [ -1, 1 ] (NaN becoming 0) & maps that onto [ -32767, 32767 ], rounding to nearest.
+NS_INLINE Short3 Short3FromFloat3Normalized(Float3 value) {
+	simd_int4 lanes = vuckt_simd_snorm_from_float4((simd_float4){ value.x, value.y, value.z, value.z }, 32767.0f);
+	return (Short3){ (short)lanes[0], (short)lanes[1], (short)lanes[2] };
+}
+
+
+
+#pragma mark Bulk Conversion
+
+// Element-wise conversions over `n`-element arrays.  `out` must not overlap the input array.
+// The widening & truncating ones run on whole elements' 4-lane storage, 2 at a time as 8-lane vectors where `VUCKT_PAIRED_ARRAY_LANES`, as `Int3`'s & `Float3`'s array operations do (padding lanes loaded as `0`, & `out`'s keeping their values); the clamping & normalizing ones go element by element through the branch-free vector kernels above.
+
+/// Loads `element`'s 4-lane storage, its padding lane as `0`.
+NS_INLINE simd_short4 _Short3LoadLanes(const Short3 *element) {
+	simd_short4 lanes;
+	memcpy(&lanes, element, sizeof lanes);
+	return lanes & (simd_short4){ -1, -1, -1, 0 };
+}
+/// Stores `lanes` to `element`'s storage, but for its padding lane, which keeps its value.
+NS_INLINE void _Short3StoreLanes(Short3 *element, simd_short4 lanes) {
+	const simd_short4 dataLanes = { -1, -1, -1, 0 };
+	simd_short4 original;
+	memcpy(&original, element, sizeof original);
+	lanes = (lanes & dataLanes) | (original & ~dataLanes);
+	memcpy(element, &lanes, sizeof lanes);
+}
+#if VUCKT_PAIRED_ARRAY_LANES
+	/// Loads `elements[0]` & `elements[1]`'s storage as lanes 0–3 & 4–7, their padding lanes as `0`.
+	NS_INLINE simd_short8 _Short3LoadPairLanes(const Short3 *elements) {
+		simd_short8 lanes;
+		memcpy(&lanes, elements, sizeof lanes);
+		return lanes & (simd_short8){ -1, -1, -1, 0, -1, -1, -1, 0 };
+	}
+	/// Stores `lanes` to `elements[0]` & `elements[1]`'s storage, but for their padding lanes, which keep their values.
+	NS_INLINE void _Short3StorePairLanes(Short3 *elements, simd_short8 lanes) {
+		const simd_short8 dataLanes = { -1, -1, -1, 0, -1, -1, -1, 0 };
+		simd_short8 original;
+		memcpy(&original, elements, sizeof original);
+		lanes = (lanes & dataLanes) | (original & ~dataLanes);
+		memcpy(elements, &lanes, sizeof lanes);
+	}
+#endif
+
+/// `out[i] = Short3ToInt3(values[i])`
+NS_INLINE void Short3ArrayToInt3Array(const Short3 *values, Int3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Int3StorePairLanes(&out[i], __builtin_convertvector(_Short3LoadPairLanes(&values[i]), simd_int8));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Int3StoreLanes(&out[i], __builtin_convertvector(_Short3LoadLanes(&values[i]), simd_int4));
+	}
+}
+/// `out[i] = Short3FromInt3Truncating(values[i])`
+NS_INLINE void Short3ArrayFromInt3ArrayTruncating(const Int3 *values, Short3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Short3StorePairLanes(&out[i], __builtin_convertvector(_Int3LoadPairLanes(&values[i], 0), simd_short8));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Short3StoreLanes(&out[i], __builtin_convertvector(_Int3LoadLanes(&values[i], 0), simd_short4));
+	}
+}
+/// `out[i] = Short3FromInt3Saturating(values[i])`
+NS_INLINE void Short3ArrayFromInt3ArraySaturating(const Int3 *values, Short3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short3FromInt3Saturating(values[i]);
+	}
+}
+/// `out[i] = Short3ToFloat3(values[i])`
+NS_INLINE void Short3ArrayToFloat3Array(const Short3 *values, Float3 *out, size_t n) {
+	size_t i = 0;
+	#if VUCKT_PAIRED_ARRAY_LANES
+		VUCKT_INDEPENDENT_LOOP
+		for (; i + 1 < n; i += 2) {
+			_Float3StorePairLanes(&out[i], __builtin_convertvector(_Short3LoadPairLanes(&values[i]), simd_float8));
+		}
+	#endif
+	VUCKT_INDEPENDENT_LOOP
+	for (; i < n; ++i) {
+		_Float3StoreLanes(&out[i], __builtin_convertvector(_Short3LoadLanes(&values[i]), simd_float4));
+	}
+}
+/// `out[i] = Short3FromFloat3Saturating(values[i])`
+NS_INLINE void Short3ArrayFromFloat3ArraySaturating(const Float3 *values, Short3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short3FromFloat3Saturating(values[i]);
+	}
+}
+/// `out[i] = Short3ToFloat3Normalized(values[i])`
+NS_INLINE void Short3ArrayToFloat3ArrayNormalized(const Short3 *values, Float3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short3ToFloat3Normalized(values[i]);
+	}
+}
+/// `out[i] = Short3FromFloat3Normalized(values[i])`
+NS_INLINE void Short3ArrayFromFloat3ArrayNormalized(const Float3 *values, Short3 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short3FromFloat3Normalized(values[i]);
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,18 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Short3.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Short3, x) == sizeof(simd_short1),
+	"Short3's first member's size does not match simd_short1's on this platform.");
+static_assert(sizeof(Short3) == sizeof(simd_short3),
+	"Short3's size does not match simd_short3's on this platform.");
+static_assert(sizeof_member(Short3, x) == sizeof_member(simd_short3, x),
+	"Short3's first member's size does not match simd_short3's first member's on this platform.");
+static_assert(alignof(Short3) == alignof(simd_short3),
+	"Short3's alignment requirements does not match simd_short3's on this platform.");
@@ -0,0 +1,214 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension Short3
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements.
+	@_transparent public init(_ x:Int16, _ y:Int16, _ z:Int16) {
+		self.init(x: x, y: y, z: z)
+	}
+	
+	/// Initialize to a vector with all elements equal to `scalar`.
+	@_transparent public init(scalar:Int16) {
+		self.init(scalar, scalar, scalar)
+	}
+	
+	/// Initialize to a SIMD vector.
+	@_transparent public init(_ value:SIMD3<Int16>) {
+		self = Short3FromSimd(value)
+	}
+	
+	/// Initialize from an `Int3` value, keeping each element's low 16 bits (wrapping out-of-range values around).
+	@_transparent public init(truncatingIfNeeded int3Value:Int3) {
+		self = Short3FromInt3Truncating(int3Value)
+	}
+	/// Initialize from an `Int3` value, clamping to the representable range of the element type.
+	@_transparent public init(clamping int3Value:Int3) {
+		self = Short3FromInt3Saturating(int3Value)
+	}
+	/// Initialize from a `Float3` value, clamping to the representable range of the element type (NaN becoming 0) & truncating toward zero.
+	@_transparent public init(saturating float3Value:Float3) {
+		self = Short3FromFloat3Saturating(float3Value)
+	}
+	/// Initialize from a `Float3` value by SNORM encoding, clamping each element to [ -1, 1 ] & mapping it onto [ -32767, 32767 ], rounding to nearest.
+	@_transparent public init(normalized float3Value:Float3) {
+		self = Short3FromFloat3Normalized(float3Value)
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:Short3 { return Short3(scalar: 0) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	@_transparent public var asTuple:(x:Int16,y:Int16,z:Int16) {
+		return ( self.x, self.y, self.z )
+	}
+	
+	@_transparent public var asArray:[Int16] {
+		return [ self.x, self.y, self.z ]
+	}
+	
+	/// Each element widened to `Int32`.
+	@_transparent public var int3Value:Int3 {
+		return Short3ToInt3(self)
+	}
+	
+	/// Each element converted to `Float`.
+	@_transparent public var float3Value:Float3 {
+		return Short3ToFloat3(self)
+	}
+	
+	/// Each element decoded as SNORM, mapping [ -32767, 32767 ] onto [ -1, 1 ] (with -32768 also mapping to -1).
+	@_transparent public var normalizedFloat3Value:Float3 {
+		return Short3ToFloat3Normalized(self)
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	@_transparent public var simdValue:SIMD3<Int16> {
+		return Short3ToSimd(self)
+	}
+}
+
+
+extension Int3
+{
+	/// Initialize from a `Short3` value, widening each element.
+	@_transparent public init(_ short3Value:Short3) {
+		self = Short3ToInt3(short3Value)
+	}
+}
+
+extension Float3
+{
+	/// Initialize from a `Short3` value, converting each element.
+	@_transparent public init(_ short3Value:Short3) {
+		self = Short3ToFloat3(short3Value)
+	}
+	
+	/// Initialize from a `Short3` value by SNORM decoding, mapping [ -32767, 32767 ] onto [ -1, 1 ] (with -32768 also mapping to -1).
+	@_transparent public init(normalized short3Value:Short3) {
+		self = Short3ToFloat3Normalized(short3Value)
+	}
+}
+
+
+extension Short3 : CustomStringConvertible
+{
+	public var description:String {
+		return "(\(self.x), \(self.y), \(self.z))"
+	}
+}
+
+
+extension Short3 : Equatable
+{
+	@_transparent public static func ==(a:Short3, b:Short3) -> Bool {
+		return a.x == b.x && a.y == b.y && a.z == b.z
+	}
+}
+
+
+extension Short3 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			self.asArray.forEach{ hasher.combine($0) }
+		}
+	#else
+		public var hashValue:Int {
+			return self.asArray.enumerated().reduce(0){ (hashValue, element:(offset:Int,value:Int16)) in
+				return hashValue | ((Int(truncatingIfNeeded: element.value) & 0xFFFF) << (element.offset * 16))
+			}
+		}
+	#endif
+}
+
+
+extension UnsafeBufferPointer where Element == Short3 // Bulk Conversion
+{
+	/// Widens every element into `out`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Int3>) {
+		self._vucktBulkConversion(into: out, Short3ArrayToInt3Array)
+	}
+	/// Converts every element into `out`, decoding them as SNORM if `normalized`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Float3>, normalized:Bool = false) {
+		self._vucktBulkConversion(into: out, normalized ? Short3ArrayToFloat3ArrayNormalized : Short3ArrayToFloat3Array)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Int3 // Bulk Conversion
+{
+	/// Narrows every element into `out`, handling out-of-range values per `mode`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Short3>, mode:IntegerNarrowingMode = .truncating) {
+		switch mode {
+			case .truncating: self._vucktBulkConversion(into: out, Short3ArrayFromInt3ArrayTruncating)
+			case .clamping: self._vucktBulkConversion(into: out, Short3ArrayFromInt3ArraySaturating)
+		}
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float3 // Bulk Conversion
+{
+	/// Narrows every element into `out`, per `mode`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<Short3>, mode:FloatNarrowingMode = .saturating) {
+		switch mode {
+			case .saturating: self._vucktBulkConversion(into: out, Short3ArrayFromFloat3ArraySaturating)
+			case .normalized: self._vucktBulkConversion(into: out, Short3ArrayFromFloat3ArrayNormalized)
+		}
+	}
+}
+
+extension Array where Element == Int3
+{
+	/// Widens an array of `Short3`s.
+	@_alwaysEmitIntoClient public init(_ short3Values:[Short3]) {
+		self = short3Values._vucktBulkConversion(Short3ArrayToInt3Array)
+	}
+}
+
+extension Array where Element == Float3
+{
+	/// Converts an array of `Short3`s, decoding them as SNORM if `normalized`.
+	@_alwaysEmitIntoClient public init(_ short3Values:[Short3], normalized:Bool = false) {
+		self = short3Values._vucktBulkConversion(normalized ? Short3ArrayToFloat3ArrayNormalized : Short3ArrayToFloat3Array)
+	}
+}
+
+extension Array where Element == Short3
+{
+	/// Narrows an array of `Int3`s, handling out-of-range values per `mode`.
+	@_alwaysEmitIntoClient public init(_ int3Values:[Int3], mode:IntegerNarrowingMode = .truncating) {
+		switch mode {
+			case .truncating: self = int3Values._vucktBulkConversion(Short3ArrayFromInt3ArrayTruncating)
+			case .clamping: self = int3Values._vucktBulkConversion(Short3ArrayFromInt3ArraySaturating)
+		}
+	}
+	
+	/// Narrows an array of `Float3`s, per `mode`.
+	@_alwaysEmitIntoClient public init(_ float3Values:[Float3], mode:FloatNarrowingMode = .saturating) {
+		switch mode {
+			case .saturating: self = float3Values._vucktBulkConversion(Short3ArrayFromFloat3ArraySaturating)
+			case .normalized: self = float3Values._vucktBulkConversion(Short3ArrayFromFloat3ArrayNormalized)
+		}
+	}
+}
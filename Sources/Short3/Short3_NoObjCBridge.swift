@@ -0,0 +1,119 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Short3
+{
+	public var x:Int16
+	public var y:Int16
+	public var z:Int16
+	
+	public init() {
+		self.x = Int16()
+		self.y = Int16()
+		self.z = Int16()
+	}
+	
+	public init(x:Int16, y:Int16, z:Int16) {
+		self.x = x
+		self.y = y
+		self.z = z
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Short3` struct to `SIMD3<Int16>` vector using passing-individual-members initialization.
+@_transparent public func Short3ToSimd(_ structValue:Short3) -> SIMD3<Int16> {
+	return SIMD3<Int16>(structValue.x, structValue.y, structValue.z)
+}
+/// Converts a `Short3` struct from `SIMD3<Int16>` vector using passing-individual-members initialization.
+@_transparent public func Short3FromSimd(_ simdValue:SIMD3<Int16>) -> Short3 {
+	return Short3(x: simdValue.x, y: simdValue.y, z: simdValue.z)
+}
+
+
+
+// MARK: Int3 Conversion
+
+@_transparent public func Short3ToInt3(_ value:Short3) -> Int3 {
+	return Int3FromSimd(simd_int3(truncatingIfNeeded: Short3ToSimd(value)))
+}
+@_transparent public func Short3FromInt3Truncating(_ value:Int3) -> Short3 {
+	return Short3FromSimd(SIMD3<Int16>(truncatingIfNeeded: Int3ToSimd(value)))
+}
+@_transparent public func Short3FromInt3Saturating(_ value:Int3) -> Short3 {
+	return Short3FromSimd(SIMD3<Int16>(clamping: Int3ToSimd(value)))
+}
+
+
+
+// MARK: Float3 Conversion
+
+@_transparent public func Short3ToFloat3(_ value:Short3) -> Float3 {
+	return Float3FromSimd(simd_float3(Short3ToSimd(value)))
+}
+@_alwaysEmitIntoClient public func Short3FromFloat3Saturating(_ value:Float3) -> Short3 {
+	let lanes = _vucktFloatToIntClamped(simd_float4(value.x, value.y, value.z, value.z), -32768, 32767)
+	return Short3(x: Int16(truncatingIfNeeded: lanes.x), y: Int16(truncatingIfNeeded: lanes.y), z: Int16(truncatingIfNeeded: lanes.z))
+}
+@_alwaysEmitIntoClient public func Short3ToFloat3Normalized(_ value:Short3) -> Float3 {
+	let lanes = _vucktSnormToFloat(simd_int4(Int32(value.x), Int32(value.y), Int32(value.z), Int32(value.z)), 32767)
+	return Float3(x: lanes.x, y: lanes.y, z: lanes.z)
+}
+@_alwaysEmitIntoClient public func Short3FromFloat3Normalized(_ value:Float3) -> Short3 {
+	let lanes = _vucktSnormFromFloat(simd_float4(value.x, value.y, value.z, value.z), 32767)
+	return Short3(x: Int16(truncatingIfNeeded: lanes.x), y: Int16(truncatingIfNeeded: lanes.y), z: Int16(truncatingIfNeeded: lanes.z))
+}
+
+
+
+// MARK: Bulk Conversion
+
+@_alwaysEmitIntoClient public func Short3ArrayToInt3Array(_ values:UnsafePointer<Short3>, _ out:UnsafeMutablePointer<Int3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short3ToInt3(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short3ArrayFromInt3ArrayTruncating(_ values:UnsafePointer<Int3>, _ out:UnsafeMutablePointer<Short3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short3FromInt3Truncating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short3ArrayFromInt3ArraySaturating(_ values:UnsafePointer<Int3>, _ out:UnsafeMutablePointer<Short3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short3FromInt3Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short3ArrayToFloat3Array(_ values:UnsafePointer<Short3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short3ToFloat3(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short3ArrayFromFloat3ArraySaturating(_ values:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Short3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short3FromFloat3Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short3ArrayToFloat3ArrayNormalized(_ values:UnsafePointer<Short3>, _ out:UnsafeMutablePointer<Float3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short3ToFloat3Normalized(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short3ArrayFromFloat3ArrayNormalized(_ values:UnsafePointer<Float3>, _ out:UnsafeMutablePointer<Short3>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short3FromFloat3Normalized(values[i])
+	}
+}
@@ -0,0 +1,158 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Int4.h>)
+	#import <Vuckt/Int4.h>
+#else
+	#include "../Int4/Int4.h"
+#endif
+#if __has_include(<Vuckt/Float4.h>)
+	#import <Vuckt/Float4.h>
+#else
+	#include "../Float4/Float4.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 4-component vector of 16-bit signed integers (8 bytes, matching `simd_short4`), for compact storage— quantized positions & tangents, & the like.
+/// Widen to `Int4` or `Float4` (e.g. with `Short4ToInt4()`, or in bulk with `Short4ArrayToInt4Array()`) to do math.
+struct Short4 {
+	short x, y, z, w;
+} __attribute__((aligned(__alignof__(simd_short4))));
+typedef struct Short4 Short4;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `Short4` struct to `simd_short4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_short4 Short4ToSimd(Short4 structValue) {
+	return *(simd_short4 *)&structValue;
+}
+/// Converts a `Short4` struct from `simd_short4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE Short4 Short4FromSimd(simd_short4 simdValue) {
+	return *(Short4 *)&simdValue;
+}
+
+
+
+#pragma mark Int4 Conversion
+
+/// Widens each element to `int` (exactly).
+NS_INLINE Int4 Short4ToInt4(Short4 value) {
+	return Int4FromSimd(__builtin_convertvector(Short4ToSimd(value), simd_int4));
+}
+/// Narrows each element to its low 16 bits, wrapping out-of-range values around (as a `(short)` cast does).
+NS_INLINE Short4 Short4FromInt4Truncating(Int4 value) {
+	return Short4FromSimd(__builtin_convertvector(Int4ToSimd(value), simd_short4));
+}
+/// Narrows each element, clamping it to [ -32768, 32767 ].
+NS_INLINE Short4 Short4FromInt4Saturating(Int4 value) {
+	return Short4FromSimd(__builtin_convertvector(vuckt_simd_clamp4(Int4ToSimd(value), -32768, 32767), simd_short4));
+}
+
+
+
+#pragma mark Float4 Conversion
+
+/// Converts each element to `float` (exactly).
+NS_INLINE Float4 Short4ToFloat4(Short4 value) {
+	return Float4FromSimd(__builtin_convertvector(Short4ToSimd(value), simd_float4));
+}
+/// Converts each element, clamping it to [ -32768, 32767 ] (NaN becoming 0) & truncating toward zero.
+NS_INLINE Short4 Short4FromFloat4Saturating(Float4 value) {
+	return Short4FromSimd(__builtin_convertvector(vuckt_simd_float_to_int_clamped4(Float4ToSimd(value), -32768.0f, 32767.0f), simd_short4));
+}
+/// Decodes each element as SNORM, mapping [ -32767, 32767 ] onto [ -1, 1 ] (with -32768 also mapping to -1).
+NS_INLINE Float4 Short4ToFloat4Normalized(Short4 value) {
+	return Float4FromSimd(vuckt_simd_snorm_to_float4(__builtin_convertvector(Short4ToSimd(value), simd_int4), 32767.0f));
+}
+/// Encodes each element as SNORM: clamps it to [ -1, 1 ] (NaN becoming 0) & maps that onto [ -32767, 32767 ], rounding to nearest.
+NS_INLINE Short4 Short4FromFloat4Normalized(Float4 value) {
+	return Short4FromSimd(__builtin_convertvector(vuckt_simd_snorm_from_float4(Float4ToSimd(value), 32767.0f), simd_short4));
+}
+
+
+
+#pragma mark Bulk Conversion
+
+// Element-wise conversions over `n`-element arrays.  `out` must not overlap the input array.
+// The widening & truncating conversions loop over the flat lanes, so the compiler can vectorize them across elements at the target's full vector width; the clamping & normalizing ones go element-by-element through the branch-free vector kernels above.
+
+/// `out[i] = Short4ToInt4(values[i])`
+NS_INLINE void Short4ArrayToInt4Array(const Short4 *values, Int4 *out, size_t n) {
+	const short *valueLanes = (const short *)values;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Short4) / sizeof(short)); ++laneI) {
+		outLanes[laneI] = valueLanes[laneI];
+	}
+}
+/// `out[i] = Short4FromInt4Truncating(values[i])`
+NS_INLINE void Short4ArrayFromInt4ArrayTruncating(const Int4 *values, Short4 *out, size_t n) {
+	const int *valueLanes = (const int *)values;
+	short *outLanes = (short *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int4) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (short)valueLanes[laneI];
+	}
+}
+/// `out[i] = Short4FromInt4Saturating(values[i])`
+NS_INLINE void Short4ArrayFromInt4ArraySaturating(const Int4 *values, Short4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short4FromInt4Saturating(values[i]);
+	}
+}
+/// `out[i] = Short4ToFloat4(values[i])`
+NS_INLINE void Short4ArrayToFloat4Array(const Short4 *values, Float4 *out, size_t n) {
+	const short *valueLanes = (const short *)values;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Short4) / sizeof(short)); ++laneI) {
+		outLanes[laneI] = (float)valueLanes[laneI];
+	}
+}
+/// `out[i] = Short4FromFloat4Saturating(values[i])`
+NS_INLINE void Short4ArrayFromFloat4ArraySaturating(const Float4 *values, Short4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short4FromFloat4Saturating(values[i]);
+	}
+}
+/// `out[i] = Short4ToFloat4Normalized(values[i])`
+NS_INLINE void Short4ArrayToFloat4ArrayNormalized(const Short4 *values, Float4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short4ToFloat4Normalized(values[i]);
+	}
+}
+/// `out[i] = Short4FromFloat4Normalized(values[i])`
+NS_INLINE void Short4ArrayFromFloat4ArrayNormalized(const Float4 *values, Short4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = Short4FromFloat4Normalized(values[i]);
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
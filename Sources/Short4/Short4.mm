@@ -0,0 +1,18 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "Short4.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Short4, x) == sizeof(simd_short1),
+	"Short4's first member's size does not match simd_short1's on this platform.");
+static_assert(sizeof(Short4) == sizeof(simd_short4),
+	"Short4's size does not match simd_short4's on this platform.");
+static_assert(sizeof_member(Short4, x) == sizeof_member(simd_short4, x),
+	"Short4's first member's size does not match simd_short4's first member's on this platform.");
+static_assert(alignof(Short4) == alignof(simd_short4),
+	"Short4's alignment requirements does not match simd_short4's on this platform.");
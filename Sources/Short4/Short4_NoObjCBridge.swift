@@ -0,0 +1,119 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct Short4
+{
+	public var x:Int16
+	public var y:Int16
+	public var z:Int16
+	public var w:Int16
+	
+	public init() {
+		self.x = Int16()
+		self.y = Int16()
+		self.z = Int16()
+		self.w = Int16()
+	}
+	
+	public init(x:Int16, y:Int16, z:Int16, w:Int16) {
+		self.x = x
+		self.y = y
+		self.z = z
+		self.w = w
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `Short4` struct to `SIMD4<Int16>` vector using passing-individual-members initialization.
+@_transparent public func Short4ToSimd(_ structValue:Short4) -> SIMD4<Int16> {
+	return SIMD4<Int16>(structValue.x, structValue.y, structValue.z, structValue.w)
+}
+/// Converts a `Short4` struct from `SIMD4<Int16>` vector using passing-individual-members initialization.
+@_transparent public func Short4FromSimd(_ simdValue:SIMD4<Int16>) -> Short4 {
+	return Short4(x: simdValue.x, y: simdValue.y, z: simdValue.z, w: simdValue.w)
+}
+
+
+
+// MARK: Int4 Conversion
+
+@_transparent public func Short4ToInt4(_ value:Short4) -> Int4 {
+	return Int4FromSimd(simd_int4(truncatingIfNeeded: Short4ToSimd(value)))
+}
+@_transparent public func Short4FromInt4Truncating(_ value:Int4) -> Short4 {
+	return Short4FromSimd(SIMD4<Int16>(truncatingIfNeeded: Int4ToSimd(value)))
+}
+@_transparent public func Short4FromInt4Saturating(_ value:Int4) -> Short4 {
+	return Short4FromSimd(SIMD4<Int16>(clamping: Int4ToSimd(value)))
+}
+
+
+
+// MARK: Float4 Conversion
+
+@_transparent public func Short4ToFloat4(_ value:Short4) -> Float4 {
+	return Float4FromSimd(simd_float4(Short4ToSimd(value)))
+}
+@_alwaysEmitIntoClient public func Short4FromFloat4Saturating(_ value:Float4) -> Short4 {
+	return Short4FromSimd(SIMD4<Int16>(truncatingIfNeeded: _vucktFloatToIntClamped(Float4ToSimd(value), -32768, 32767)))
+}
+@_alwaysEmitIntoClient public func Short4ToFloat4Normalized(_ value:Short4) -> Float4 {
+	return Float4FromSimd(_vucktSnormToFloat(simd_int4(truncatingIfNeeded: Short4ToSimd(value)), 32767))
+}
+@_alwaysEmitIntoClient public func Short4FromFloat4Normalized(_ value:Float4) -> Short4 {
+	return Short4FromSimd(SIMD4<Int16>(truncatingIfNeeded: _vucktSnormFromFloat(Float4ToSimd(value), 32767)))
+}
+
+
+
+// MARK: Bulk Conversion
+
+@_alwaysEmitIntoClient public func Short4ArrayToInt4Array(_ values:UnsafePointer<Short4>, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short4ToInt4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short4ArrayFromInt4ArrayTruncating(_ values:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<Short4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short4FromInt4Truncating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short4ArrayFromInt4ArraySaturating(_ values:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<Short4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short4FromInt4Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short4ArrayToFloat4Array(_ values:UnsafePointer<Short4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short4ToFloat4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short4ArrayFromFloat4ArraySaturating(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Short4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short4FromFloat4Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short4ArrayToFloat4ArrayNormalized(_ values:UnsafePointer<Short4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short4ToFloat4Normalized(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func Short4ArrayFromFloat4ArrayNormalized(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<Short4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = Short4FromFloat4Normalized(values[i])
+	}
+}
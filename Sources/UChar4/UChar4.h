@@ -0,0 +1,158 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Int4.h>)
+	#import <Vuckt/Int4.h>
+#else
+	#include "../Int4/Int4.h"
+#endif
+#if __has_include(<Vuckt/Float4.h>)
+	#import <Vuckt/Float4.h>
+#else
+	#include "../Float4/Float4.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 4-component vector of 8-bit unsigned integers (4 bytes, matching `simd_uchar4`), for compact storage— RGBA colors, voxel data, & the like.
+/// Widen to `Int4` or `Float4` (e.g. with `UChar4ToInt4()`, or in bulk with `UChar4ArrayToInt4Array()`) to do math.
+struct UChar4 {
+	unsigned char x, y, z, w;
+} __attribute__((aligned(__alignof__(simd_uchar4))));
+typedef struct UChar4 UChar4;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `UChar4` struct to `simd_uchar4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_uchar4 UChar4ToSimd(UChar4 structValue) {
+	return *(simd_uchar4 *)&structValue;
+}
+/// Converts a `UChar4` struct from `simd_uchar4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE UChar4 UChar4FromSimd(simd_uchar4 simdValue) {
+	return *(UChar4 *)&simdValue;
+}
+
+
+
+#pragma mark Int4 Conversion
+
+/// Widens each element to `int` (exactly).
+NS_INLINE Int4 UChar4ToInt4(UChar4 value) {
+	return Int4FromSimd(__builtin_convertvector(UChar4ToSimd(value), simd_int4));
+}
+/// Narrows each element to its low 8 bits, wrapping out-of-range values around (as a `(unsigned char)` cast does).
+NS_INLINE UChar4 UChar4FromInt4Truncating(Int4 value) {
+	return UChar4FromSimd(__builtin_convertvector(Int4ToSimd(value), simd_uchar4));
+}
+/// Narrows each element, clamping it to [ 0, 255 ].
+NS_INLINE UChar4 UChar4FromInt4Saturating(Int4 value) {
+	return UChar4FromSimd(__builtin_convertvector(vuckt_simd_clamp4(Int4ToSimd(value), 0, 255), simd_uchar4));
+}
+
+
+
+#pragma mark Float4 Conversion
+
+/// Converts each element to `float` (exactly).
+NS_INLINE Float4 UChar4ToFloat4(UChar4 value) {
+	return Float4FromSimd(__builtin_convertvector(UChar4ToSimd(value), simd_float4));
+}
+/// Converts each element, clamping it to [ 0, 255 ] (NaN becoming 0) & truncating toward zero.
+NS_INLINE UChar4 UChar4FromFloat4Saturating(Float4 value) {
+	return UChar4FromSimd(__builtin_convertvector(vuckt_simd_float_to_int_clamped4(Float4ToSimd(value), 0.0f, 255.0f), simd_uchar4));
+}
+/// Decodes each element as UNORM, mapping [ 0, 255 ] onto [ 0, 1 ].
+NS_INLINE Float4 UChar4ToFloat4Normalized(UChar4 value) {
+	return Float4FromSimd(vuckt_simd_unorm_to_float4(__builtin_convertvector(UChar4ToSimd(value), simd_int4), 255.0f));
+}
+/// Encodes each element as UNORM: clamps it to [ 0, 1 ] (NaN becoming 0) & maps that onto [ 0, 255 ], rounding to nearest.
+NS_INLINE UChar4 UChar4FromFloat4Normalized(Float4 value) {
+	return UChar4FromSimd(__builtin_convertvector(vuckt_simd_unorm_from_float4(Float4ToSimd(value), 255.0f), simd_uchar4));
+}
+
+
+
+#pragma mark Bulk Conversion
+
+// Element-wise conversions over `n`-element arrays.  `out` must not overlap the input array.
+// The widening & truncating conversions loop over the flat lanes, so the compiler can vectorize them across elements at the target's full vector width; the clamping & normalizing ones go element-by-element through the branch-free vector kernels above.
+
+/// `out[i] = UChar4ToInt4(values[i])`
+NS_INLINE void UChar4ArrayToInt4Array(const UChar4 *values, Int4 *out, size_t n) {
+	const unsigned char *valueLanes = (const unsigned char *)values;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(UChar4) / sizeof(unsigned char)); ++laneI) {
+		outLanes[laneI] = valueLanes[laneI];
+	}
+}
+/// `out[i] = UChar4FromInt4Truncating(values[i])`
+NS_INLINE void UChar4ArrayFromInt4ArrayTruncating(const Int4 *values, UChar4 *out, size_t n) {
+	const int *valueLanes = (const int *)values;
+	unsigned char *outLanes = (unsigned char *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int4) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (unsigned char)valueLanes[laneI];
+	}
+}
+/// `out[i] = UChar4FromInt4Saturating(values[i])`
+NS_INLINE void UChar4ArrayFromInt4ArraySaturating(const Int4 *values, UChar4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = UChar4FromInt4Saturating(values[i]);
+	}
+}
+/// `out[i] = UChar4ToFloat4(values[i])`
+NS_INLINE void UChar4ArrayToFloat4Array(const UChar4 *values, Float4 *out, size_t n) {
+	const unsigned char *valueLanes = (const unsigned char *)values;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(UChar4) / sizeof(unsigned char)); ++laneI) {
+		outLanes[laneI] = (float)valueLanes[laneI];
+	}
+}
+/// `out[i] = UChar4FromFloat4Saturating(values[i])`
+NS_INLINE void UChar4ArrayFromFloat4ArraySaturating(const Float4 *values, UChar4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = UChar4FromFloat4Saturating(values[i]);
+	}
+}
+/// `out[i] = UChar4ToFloat4Normalized(values[i])`
+NS_INLINE void UChar4ArrayToFloat4ArrayNormalized(const UChar4 *values, Float4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = UChar4ToFloat4Normalized(values[i]);
+	}
+}
+/// `out[i] = UChar4FromFloat4Normalized(values[i])`
+NS_INLINE void UChar4ArrayFromFloat4ArrayNormalized(const Float4 *values, UChar4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = UChar4FromFloat4Normalized(values[i]);
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
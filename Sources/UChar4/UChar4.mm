@@ -0,0 +1,18 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "UChar4.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(UChar4, x) == sizeof(simd_uchar1),
+	"UChar4's first member's size does not match simd_uchar1's on this platform.");
+static_assert(sizeof(UChar4) == sizeof(simd_uchar4),
+	"UChar4's size does not match simd_uchar4's on this platform.");
+static_assert(sizeof_member(UChar4, x) == sizeof_member(simd_uchar4, x),
+	"UChar4's first member's size does not match simd_uchar4's first member's on this platform.");
+static_assert(alignof(UChar4) == alignof(simd_uchar4),
+	"UChar4's alignment requirements does not match simd_uchar4's on this platform.");
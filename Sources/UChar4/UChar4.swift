@@ -0,0 +1,214 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+import Foundation
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+#if canImport(VucktC)
+	import VucktC
+#endif
+
+
+
+extension UChar4
+{
+	// MARK: `init`s
+	
+	/// Initialize a vector with the specified elements.
+	@_transparent public init(_ x:UInt8, _ y:UInt8, _ z:UInt8, _ w:UInt8) {
+		self.init(x: x, y: y, z: z, w: w)
+	}
+	
+	/// Initialize to a vector with all elements equal to `scalar`.
+	@_transparent public init(scalar:UInt8) {
+		self.init(scalar, scalar, scalar, scalar)
+	}
+	
+	/// Initialize to a SIMD vector.
+	@_transparent public init(_ value:SIMD4<UInt8>) {
+		self = UChar4FromSimd(value)
+	}
+	
+	/// Initialize from an `Int4` value, keeping each element's low 8 bits (wrapping out-of-range values around).
+	@_transparent public init(truncatingIfNeeded int4Value:Int4) {
+		self = UChar4FromInt4Truncating(int4Value)
+	}
+	/// Initialize from an `Int4` value, clamping to the representable range of the element type.
+	@_transparent public init(clamping int4Value:Int4) {
+		self = UChar4FromInt4Saturating(int4Value)
+	}
+	/// Initialize from a `Float4` value, clamping to the representable range of the element type (NaN becoming 0) & truncating toward zero.
+	@_transparent public init(saturating float4Value:Float4) {
+		self = UChar4FromFloat4Saturating(float4Value)
+	}
+	/// Initialize from a `Float4` value by UNORM encoding, clamping each element to [ 0, 1 ] & mapping it onto [ 0, 255 ], rounding to nearest.
+	@_transparent public init(normalized float4Value:Float4) {
+		self = UChar4FromFloat4Normalized(float4Value)
+	}
+	
+	
+	// MARK: commonly-used “presets”
+	
+	@_transparent public static var zero:UChar4 { return UChar4(scalar: 0) }
+	
+	
+	// MARK: `as…` Functionality
+	
+	@_transparent public var asTuple:(x:UInt8,y:UInt8,z:UInt8,w:UInt8) {
+		return ( self.x, self.y, self.z, self.w )
+	}
+	
+	@_transparent public var asArray:[UInt8] {
+		return [ self.x, self.y, self.z, self.w ]
+	}
+	
+	/// Each element widened to `Int32`.
+	@_transparent public var int4Value:Int4 {
+		return UChar4ToInt4(self)
+	}
+	
+	/// Each element converted to `Float`.
+	@_transparent public var float4Value:Float4 {
+		return UChar4ToFloat4(self)
+	}
+	
+	/// Each element decoded as UNORM, mapping [ 0, 255 ] onto [ 0, 1 ].
+	@_transparent public var normalizedFloat4Value:Float4 {
+		return UChar4ToFloat4Normalized(self)
+	}
+	
+	
+	// MARK: `simdValue` Functionality
+	
+	@_transparent public var simdValue:SIMD4<UInt8> {
+		return UChar4ToSimd(self)
+	}
+}
+
+
+extension Int4
+{
+	/// Initialize from a `UChar4` value, widening each element.
+	@_transparent public init(_ uChar4Value:UChar4) {
+		self = UChar4ToInt4(uChar4Value)
+	}
+}
+
+extension Float4
+{
+	/// Initialize from a `UChar4` value, converting each element.
+	@_transparent public init(_ uChar4Value:UChar4) {
+		self = UChar4ToFloat4(uChar4Value)
+	}
+	
+	/// Initialize from a `UChar4` value by UNORM decoding, mapping [ 0, 255 ] onto [ 0, 1 ].
+	@_transparent public init(normalized uChar4Value:UChar4) {
+		self = UChar4ToFloat4Normalized(uChar4Value)
+	}
+}
+
+
+extension UChar4 : CustomStringConvertible
+{
+	public var description:String {
+		return "(\(self.x), \(self.y), \(self.z), \(self.w))"
+	}
+}
+
+
+extension UChar4 : Equatable
+{
+	@_transparent public static func ==(a:UChar4, b:UChar4) -> Bool {
+		return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w
+	}
+}
+
+
+extension UChar4 : Hashable
+{
+	#if swift(>=4.2)
+		public func hash(into hasher:inout Hasher) {
+			self.asArray.forEach{ hasher.combine($0) }
+		}
+	#else
+		public var hashValue:Int {
+			return self.asArray.enumerated().reduce(0){ (hashValue, element:(offset:Int,value:UInt8)) in
+				return hashValue | ((Int(truncatingIfNeeded: element.value) & 0xFF) << (element.offset * 8))
+			}
+		}
+	#endif
+}
+
+
+extension UnsafeBufferPointer where Element == UChar4 // Bulk Conversion
+{
+	/// Widens every element into `out`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Int4>) {
+		self._vucktBulkConversion(into: out, UChar4ArrayToInt4Array)
+	}
+	/// Converts every element into `out`, decoding them as UNORM if `normalized`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func widen(into out:UnsafeMutableBufferPointer<Float4>, normalized:Bool = false) {
+		self._vucktBulkConversion(into: out, normalized ? UChar4ArrayToFloat4ArrayNormalized : UChar4ArrayToFloat4Array)
+	}
+}
+
+extension UnsafeBufferPointer where Element == Int4 // Bulk Conversion
+{
+	/// Narrows every element into `out`, handling out-of-range values per `mode`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<UChar4>, mode:IntegerNarrowingMode = .truncating) {
+		switch mode {
+			case .truncating: self._vucktBulkConversion(into: out, UChar4ArrayFromInt4ArrayTruncating)
+			case .clamping: self._vucktBulkConversion(into: out, UChar4ArrayFromInt4ArraySaturating)
+		}
+	}
+}
+
+extension UnsafeBufferPointer where Element == Float4 // Bulk Conversion
+{
+	/// Narrows every element into `out`, per `mode`.  (Both buffers must have the same count, and must not overlap.)
+	@_alwaysEmitIntoClient public func narrow(into out:UnsafeMutableBufferPointer<UChar4>, mode:FloatNarrowingMode = .saturating) {
+		switch mode {
+			case .saturating: self._vucktBulkConversion(into: out, UChar4ArrayFromFloat4ArraySaturating)
+			case .normalized: self._vucktBulkConversion(into: out, UChar4ArrayFromFloat4ArrayNormalized)
+		}
+	}
+}
+
+extension Array where Element == Int4
+{
+	/// Widens an array of `UChar4`s.
+	@_alwaysEmitIntoClient public init(_ uChar4Values:[UChar4]) {
+		self = uChar4Values._vucktBulkConversion(UChar4ArrayToInt4Array)
+	}
+}
+
+extension Array where Element == Float4
+{
+	/// Converts an array of `UChar4`s, decoding them as UNORM if `normalized`.
+	@_alwaysEmitIntoClient public init(_ uChar4Values:[UChar4], normalized:Bool = false) {
+		self = uChar4Values._vucktBulkConversion(normalized ? UChar4ArrayToFloat4ArrayNormalized : UChar4ArrayToFloat4Array)
+	}
+}
+
+extension Array where Element == UChar4
+{
+	/// Narrows an array of `Int4`s, handling out-of-range values per `mode`.
+	@_alwaysEmitIntoClient public init(_ int4Values:[Int4], mode:IntegerNarrowingMode = .truncating) {
+		switch mode {
+			case .truncating: self = int4Values._vucktBulkConversion(UChar4ArrayFromInt4ArrayTruncating)
+			case .clamping: self = int4Values._vucktBulkConversion(UChar4ArrayFromInt4ArraySaturating)
+		}
+	}
+	
+	/// Narrows an array of `Float4`s, per `mode`.
+	@_alwaysEmitIntoClient public init(_ float4Values:[Float4], mode:FloatNarrowingMode = .saturating) {
+		switch mode {
+			case .saturating: self = float4Values._vucktBulkConversion(UChar4ArrayFromFloat4ArraySaturating)
+			case .normalized: self = float4Values._vucktBulkConversion(UChar4ArrayFromFloat4ArrayNormalized)
+		}
+	}
+}
@@ -0,0 +1,119 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct UChar4
+{
+	public var x:UInt8
+	public var y:UInt8
+	public var z:UInt8
+	public var w:UInt8
+	
+	public init() {
+		self.x = UInt8()
+		self.y = UInt8()
+		self.z = UInt8()
+		self.w = UInt8()
+	}
+	
+	public init(x:UInt8, y:UInt8, z:UInt8, w:UInt8) {
+		self.x = x
+		self.y = y
+		self.z = z
+		self.w = w
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `UChar4` struct to `SIMD4<UInt8>` vector using passing-individual-members initialization.
+@_transparent public func UChar4ToSimd(_ structValue:UChar4) -> SIMD4<UInt8> {
+	return SIMD4<UInt8>(structValue.x, structValue.y, structValue.z, structValue.w)
+}
+/// Converts a `UChar4` struct from `SIMD4<UInt8>` vector using passing-individual-members initialization.
+@_transparent public func UChar4FromSimd(_ simdValue:SIMD4<UInt8>) -> UChar4 {
+	return UChar4(x: simdValue.x, y: simdValue.y, z: simdValue.z, w: simdValue.w)
+}
+
+
+
+// MARK: Int4 Conversion
+
+@_transparent public func UChar4ToInt4(_ value:UChar4) -> Int4 {
+	return Int4FromSimd(simd_int4(truncatingIfNeeded: UChar4ToSimd(value)))
+}
+@_transparent public func UChar4FromInt4Truncating(_ value:Int4) -> UChar4 {
+	return UChar4FromSimd(SIMD4<UInt8>(truncatingIfNeeded: Int4ToSimd(value)))
+}
+@_transparent public func UChar4FromInt4Saturating(_ value:Int4) -> UChar4 {
+	return UChar4FromSimd(SIMD4<UInt8>(clamping: Int4ToSimd(value)))
+}
+
+
+
+// MARK: Float4 Conversion
+
+@_transparent public func UChar4ToFloat4(_ value:UChar4) -> Float4 {
+	return Float4FromSimd(simd_float4(UChar4ToSimd(value)))
+}
+@_alwaysEmitIntoClient public func UChar4FromFloat4Saturating(_ value:Float4) -> UChar4 {
+	return UChar4FromSimd(SIMD4<UInt8>(truncatingIfNeeded: _vucktFloatToIntClamped(Float4ToSimd(value), 0, 255)))
+}
+@_alwaysEmitIntoClient public func UChar4ToFloat4Normalized(_ value:UChar4) -> Float4 {
+	return Float4FromSimd(_vucktUnormToFloat(simd_int4(truncatingIfNeeded: UChar4ToSimd(value)), 255))
+}
+@_alwaysEmitIntoClient public func UChar4FromFloat4Normalized(_ value:Float4) -> UChar4 {
+	return UChar4FromSimd(SIMD4<UInt8>(truncatingIfNeeded: _vucktUnormFromFloat(Float4ToSimd(value), 255)))
+}
+
+
+
+// MARK: Bulk Conversion
+
+@_alwaysEmitIntoClient public func UChar4ArrayToInt4Array(_ values:UnsafePointer<UChar4>, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UChar4ToInt4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UChar4ArrayFromInt4ArrayTruncating(_ values:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<UChar4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UChar4FromInt4Truncating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UChar4ArrayFromInt4ArraySaturating(_ values:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<UChar4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UChar4FromInt4Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UChar4ArrayToFloat4Array(_ values:UnsafePointer<UChar4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UChar4ToFloat4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UChar4ArrayFromFloat4ArraySaturating(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<UChar4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UChar4FromFloat4Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UChar4ArrayToFloat4ArrayNormalized(_ values:UnsafePointer<UChar4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UChar4ToFloat4Normalized(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UChar4ArrayFromFloat4ArrayNormalized(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<UChar4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UChar4FromFloat4Normalized(values[i])
+	}
+}
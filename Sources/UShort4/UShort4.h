@@ -0,0 +1,158 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#if __has_include(<Vuckt/Int4.h>)
+	#import <Vuckt/Int4.h>
+#else
+	#include "../Int4/Int4.h"
+#endif
+#if __has_include(<Vuckt/Float4.h>)
+	#import <Vuckt/Float4.h>
+#else
+	#include "../Float4/Float4.h"
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/VucktPlatform.h>
+#else
+	#include "../VucktPlatform.h"
+#endif
+
+
+
+NS_ASSUME_NONNULL_BEGIN
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Struct Definition
+
+/// A 4-component vector of 16-bit unsigned integers (8 bytes, matching `simd_ushort4`), for compact storage— high-precision colors, bone indices, & the like.
+/// Widen to `Int4` or `Float4` (e.g. with `UShort4ToInt4()`, or in bulk with `UShort4ArrayToInt4Array()`) to do math.
+struct UShort4 {
+	unsigned short x, y, z, w;
+} __attribute__((aligned(__alignof__(simd_ushort4))));
+typedef struct UShort4 UShort4;
+
+
+
+#pragma mark SIMD Conversion
+
+/// Converts a `UShort4` struct to `simd_ushort4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE simd_ushort4 UShort4ToSimd(UShort4 structValue) {
+	return *(simd_ushort4 *)&structValue;
+}
+/// Converts a `UShort4` struct from `simd_ushort4` vector using zero-op/(dangerous?) C-casts.
+/// (Sanity `static_assert`s in the `.mm` file do their best to ensure out struct's layout match the simd vector's.)
+NS_INLINE UShort4 UShort4FromSimd(simd_ushort4 simdValue) {
+	return *(UShort4 *)&simdValue;
+}
+
+
+
+#pragma mark Int4 Conversion
+
+/// Widens each element to `int` (exactly).
+NS_INLINE Int4 UShort4ToInt4(UShort4 value) {
+	return Int4FromSimd(__builtin_convertvector(UShort4ToSimd(value), simd_int4));
+}
+/// Narrows each element to its low 16 bits, wrapping out-of-range values around (as a `(unsigned short)` cast does).
+NS_INLINE UShort4 UShort4FromInt4Truncating(Int4 value) {
+	return UShort4FromSimd(__builtin_convertvector(Int4ToSimd(value), simd_ushort4));
+}
+/// Narrows each element, clamping it to [ 0, 65535 ].
+NS_INLINE UShort4 UShort4FromInt4Saturating(Int4 value) {
+	return UShort4FromSimd(__builtin_convertvector(vuckt_simd_clamp4(Int4ToSimd(value), 0, 65535), simd_ushort4));
+}
+
+
+
+#pragma mark Float4 Conversion
+
+/// Converts each element to `float` (exactly).
+NS_INLINE Float4 UShort4ToFloat4(UShort4 value) {
+	return Float4FromSimd(__builtin_convertvector(UShort4ToSimd(value), simd_float4));
+}
+/// Converts each element, clamping it to [ 0, 65535 ] (NaN becoming 0) & truncating toward zero.
+NS_INLINE UShort4 UShort4FromFloat4Saturating(Float4 value) {
+	return UShort4FromSimd(__builtin_convertvector(vuckt_simd_float_to_int_clamped4(Float4ToSimd(value), 0.0f, 65535.0f), simd_ushort4));
+}
+/// Decodes each element as UNORM, mapping [ 0, 65535 ] onto [ 0, 1 ].
+NS_INLINE Float4 UShort4ToFloat4Normalized(UShort4 value) {
+	return Float4FromSimd(vuckt_simd_unorm_to_float4(__builtin_convertvector(UShort4ToSimd(value), simd_int4), 65535.0f));
+}
+/// Encodes each element as UNORM: clamps it to [ 0, 1 ] (NaN becoming 0) & maps that onto [ 0, 65535 ], rounding to nearest.
+NS_INLINE UShort4 UShort4FromFloat4Normalized(Float4 value) {
+	return UShort4FromSimd(__builtin_convertvector(vuckt_simd_unorm_from_float4(Float4ToSimd(value), 65535.0f), simd_ushort4));
+}
+
+
+
+#pragma mark Bulk Conversion
+
+// Element-wise conversions over `n`-element arrays.  `out` must not overlap the input array.
+// The widening & truncating conversions loop over the flat lanes, so the compiler can vectorize them across elements at the target's full vector width; the clamping & normalizing ones go element-by-element through the branch-free vector kernels above.
+
+/// `out[i] = UShort4ToInt4(values[i])`
+NS_INLINE void UShort4ArrayToInt4Array(const UShort4 *values, Int4 *out, size_t n) {
+	const unsigned short *valueLanes = (const unsigned short *)values;
+	int *outLanes = (int *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(UShort4) / sizeof(unsigned short)); ++laneI) {
+		outLanes[laneI] = valueLanes[laneI];
+	}
+}
+/// `out[i] = UShort4FromInt4Truncating(values[i])`
+NS_INLINE void UShort4ArrayFromInt4ArrayTruncating(const Int4 *values, UShort4 *out, size_t n) {
+	const int *valueLanes = (const int *)values;
+	unsigned short *outLanes = (unsigned short *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(Int4) / sizeof(int)); ++laneI) {
+		outLanes[laneI] = (unsigned short)valueLanes[laneI];
+	}
+}
+/// `out[i] = UShort4FromInt4Saturating(values[i])`
+NS_INLINE void UShort4ArrayFromInt4ArraySaturating(const Int4 *values, UShort4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = UShort4FromInt4Saturating(values[i]);
+	}
+}
+/// `out[i] = UShort4ToFloat4(values[i])`
+NS_INLINE void UShort4ArrayToFloat4Array(const UShort4 *values, Float4 *out, size_t n) {
+	const unsigned short *valueLanes = (const unsigned short *)values;
+	float *outLanes = (float *)out;
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t laneI = 0; laneI < n * (sizeof(UShort4) / sizeof(unsigned short)); ++laneI) {
+		outLanes[laneI] = (float)valueLanes[laneI];
+	}
+}
+/// `out[i] = UShort4FromFloat4Saturating(values[i])`
+NS_INLINE void UShort4ArrayFromFloat4ArraySaturating(const Float4 *values, UShort4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = UShort4FromFloat4Saturating(values[i]);
+	}
+}
+/// `out[i] = UShort4ToFloat4Normalized(values[i])`
+NS_INLINE void UShort4ArrayToFloat4ArrayNormalized(const UShort4 *values, Float4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = UShort4ToFloat4Normalized(values[i]);
+	}
+}
+/// `out[i] = UShort4FromFloat4Normalized(values[i])`
+NS_INLINE void UShort4ArrayFromFloat4ArrayNormalized(const Float4 *values, UShort4 *out, size_t n) {
+	VUCKT_INDEPENDENT_LOOP
+	for (size_t i = 0; i < n; ++i) {
+		out[i] = UShort4FromFloat4Normalized(values[i]);
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,18 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#import "UShort4.h"
+
+
+
+#pragma mark Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(UShort4, x) == sizeof(simd_ushort1),
+	"UShort4's first member's size does not match simd_ushort1's on this platform.");
+static_assert(sizeof(UShort4) == sizeof(simd_ushort4),
+	"UShort4's size does not match simd_ushort4's on this platform.");
+static_assert(sizeof_member(UShort4, x) == sizeof_member(simd_ushort4, x),
+	"UShort4's first member's size does not match simd_ushort4's first member's on this platform.");
+static_assert(alignof(UShort4) == alignof(simd_ushort4),
+	"UShort4's alignment requirements does not match simd_ushort4's on this platform.");
@@ -0,0 +1,119 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
+
+
+
+// MARK: Struct Definition
+
+public struct UShort4
+{
+	public var x:UInt16
+	public var y:UInt16
+	public var z:UInt16
+	public var w:UInt16
+	
+	public init() {
+		self.x = UInt16()
+		self.y = UInt16()
+		self.z = UInt16()
+		self.w = UInt16()
+	}
+	
+	public init(x:UInt16, y:UInt16, z:UInt16, w:UInt16) {
+		self.x = x
+		self.y = y
+		self.z = z
+		self.w = w
+	}
+}
+
+
+
+// MARK: SIMD Conversion
+
+/// Converts a `UShort4` struct to `SIMD4<UInt16>` vector using passing-individual-members initialization.
+@_transparent public func UShort4ToSimd(_ structValue:UShort4) -> SIMD4<UInt16> {
+	return SIMD4<UInt16>(structValue.x, structValue.y, structValue.z, structValue.w)
+}
+/// Converts a `UShort4` struct from `SIMD4<UInt16>` vector using passing-individual-members initialization.
+@_transparent public func UShort4FromSimd(_ simdValue:SIMD4<UInt16>) -> UShort4 {
+	return UShort4(x: simdValue.x, y: simdValue.y, z: simdValue.z, w: simdValue.w)
+}
+
+
+
+// MARK: Int4 Conversion
+
+@_transparent public func UShort4ToInt4(_ value:UShort4) -> Int4 {
+	return Int4FromSimd(simd_int4(truncatingIfNeeded: UShort4ToSimd(value)))
+}
+@_transparent public func UShort4FromInt4Truncating(_ value:Int4) -> UShort4 {
+	return UShort4FromSimd(SIMD4<UInt16>(truncatingIfNeeded: Int4ToSimd(value)))
+}
+@_transparent public func UShort4FromInt4Saturating(_ value:Int4) -> UShort4 {
+	return UShort4FromSimd(SIMD4<UInt16>(clamping: Int4ToSimd(value)))
+}
+
+
+
+// MARK: Float4 Conversion
+
+@_transparent public func UShort4ToFloat4(_ value:UShort4) -> Float4 {
+	return Float4FromSimd(simd_float4(UShort4ToSimd(value)))
+}
+@_alwaysEmitIntoClient public func UShort4FromFloat4Saturating(_ value:Float4) -> UShort4 {
+	return UShort4FromSimd(SIMD4<UInt16>(truncatingIfNeeded: _vucktFloatToIntClamped(Float4ToSimd(value), 0, 65535)))
+}
+@_alwaysEmitIntoClient public func UShort4ToFloat4Normalized(_ value:UShort4) -> Float4 {
+	return Float4FromSimd(_vucktUnormToFloat(simd_int4(truncatingIfNeeded: UShort4ToSimd(value)), 65535))
+}
+@_alwaysEmitIntoClient public func UShort4FromFloat4Normalized(_ value:Float4) -> UShort4 {
+	return UShort4FromSimd(SIMD4<UInt16>(truncatingIfNeeded: _vucktUnormFromFloat(Float4ToSimd(value), 65535)))
+}
+
+
+
+// MARK: Bulk Conversion
+
+@_alwaysEmitIntoClient public func UShort4ArrayToInt4Array(_ values:UnsafePointer<UShort4>, _ out:UnsafeMutablePointer<Int4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UShort4ToInt4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UShort4ArrayFromInt4ArrayTruncating(_ values:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<UShort4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UShort4FromInt4Truncating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UShort4ArrayFromInt4ArraySaturating(_ values:UnsafePointer<Int4>, _ out:UnsafeMutablePointer<UShort4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UShort4FromInt4Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UShort4ArrayToFloat4Array(_ values:UnsafePointer<UShort4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UShort4ToFloat4(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UShort4ArrayFromFloat4ArraySaturating(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<UShort4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UShort4FromFloat4Saturating(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UShort4ArrayToFloat4ArrayNormalized(_ values:UnsafePointer<UShort4>, _ out:UnsafeMutablePointer<Float4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UShort4ToFloat4Normalized(values[i])
+	}
+}
+@_alwaysEmitIntoClient public func UShort4ArrayFromFloat4ArrayNormalized(_ values:UnsafePointer<Float4>, _ out:UnsafeMutablePointer<UShort4>, _ n:Int) {
+	for i in 0..<n {
+		out[i] = UShort4FromFloat4Normalized(values[i])
+	}
+}
@@ -15,6 +15,8 @@ FOUNDATION_EXPORT const unsigned char VucktVersionString[];
 
 
 
+#import <Vuckt/VucktPlatform.h>
+
 #import <Vuckt/Int2.h>
 #import <Vuckt/Int3.h>
 #import <Vuckt/Int4.h>
@@ -25,3 +27,28 @@ FOUNDATION_EXPORT const unsigned char VucktVersionString[];
 //#import <Vuckt/Float2x2.h>
 #import <Vuckt/Float3x3.h>
 #import <Vuckt/Float4x4.h>
+#import <Vuckt/Float3SoA.h>
+#import <Vuckt/Float4SoA.h>
+#import <Vuckt/PackedFloat3.h>
+#import <Vuckt/Float4x3.h>
+#import <Vuckt/Char4.h>
+#import <Vuckt/UChar4.h>
+#import <Vuckt/Short2.h>
+#import <Vuckt/Short3.h>
+#import <Vuckt/Short4.h>
+#import <Vuckt/UShort4.h>
+#import <Vuckt/Half2.h>
+#import <Vuckt/Half3.h>
+#import <Vuckt/Half4.h>
+#import <Vuckt/Double2.h>
+#import <Vuckt/Double3.h>
+#import <Vuckt/Double4.h>
+#import <Vuckt/Double4x4.h>
+#import <Vuckt/AABB3.h>
+#import <Vuckt/Frustum.h>
+#import <Vuckt/Ray3.h>
+#import <Vuckt/BVH.h>
+#import <Vuckt/ArrayFile.h>
+#import <Vuckt/BulkCodec.h>
+#import <Vuckt/Curve.h>
+#import <Vuckt/Parallel.h>
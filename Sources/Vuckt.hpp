@@ -0,0 +1,497 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#ifndef __cplusplus
+	#error "Vuckt.hpp is C++-only; C & Objective-C code includes the per-type headers (or Vuckt.h) instead."
+#endif
+
+#if __has_include(<Vuckt/VucktPlatform.h>)
+	#import <Vuckt/Int2.h>
+	#import <Vuckt/Int3.h>
+	#import <Vuckt/Int4.h>
+	#import <Vuckt/Float2.h>
+	#import <Vuckt/Float3.h>
+	#import <Vuckt/Float4.h>
+	#import <Vuckt/FloatQuaternion.h>
+	#import <Vuckt/Float3x3.h>
+	#import <Vuckt/Float4x4.h>
+	#import <Vuckt/PackedFloat3.h>
+	#import <Vuckt/Float4x3.h>
+	#import <Vuckt/Char4.h>
+	#import <Vuckt/UChar4.h>
+	#import <Vuckt/Short2.h>
+	#import <Vuckt/Short3.h>
+	#import <Vuckt/Short4.h>
+	#import <Vuckt/UShort4.h>
+	#import <Vuckt/Double2.h>
+	#import <Vuckt/Double3.h>
+	#import <Vuckt/Double4.h>
+	#import <Vuckt/Double4x4.h>
+#else
+	#include "Int2/Int2.h"
+	#include "Int3/Int3.h"
+	#include "Int4/Int4.h"
+	#include "Float2/Float2.h"
+	#include "Float3/Float3.h"
+	#include "Float4/Float4.h"
+	#include "FloatQuaternion/FloatQuaternion.h"
+	#include "Float3x3/Float3x3.h"
+	#include "Float4x4/Float4x4.h"
+	#include "PackedFloat3/PackedFloat3.h"
+	#include "Float4x3/Float4x3.h"
+	#include "Char4/Char4.h"
+	#include "UChar4/UChar4.h"
+	#include "Short2/Short2.h"
+	#include "Short3/Short3.h"
+	#include "Short4/Short4.h"
+	#include "UShort4/UShort4.h"
+	#include "Double2/Double2.h"
+	#include "Double3/Double3.h"
+	#include "Double4/Double4.h"
+	#include "Double4x4/Double4x4.h"
+#endif
+#include <functional>
+#include <utility>
+
+
+
+// A C++ layer over Vuckt's C structs: `constexpr` presets, operators & swizzles, so C++ code can use the structs directly (no wrapper types) & have constant expressions of them fold at compile time.
+// The structs stay plain aggregates, so `constexpr Float3 p = { 1, 2, 3 };` is their `constexpr` constructor.
+// Each operator computes per component when constant-evaluated, & otherwise calls the type's `NS_INLINE` C function (e.g. `Float3Add()`), so at run time it compiles to exactly what the C API does.
+// Operators are declared in the global namespace (with the structs, so argument-dependent lookup finds them); the helpers & swizzles are in `vuckt`.
+
+VUCKT_DIAGNOSTICS_BEGIN
+
+
+
+#pragma mark Constant-Evaluation Detection
+
+/// Whether the enclosing `constexpr` function is being evaluated at compile time (so mustn't call the non-`constexpr` C functions).  Where the compiler can't tell, always true, which just forgoes the C functions' SIMD at run time.
+#if defined(__has_builtin) && __has_builtin(__builtin_is_constant_evaluated)
+	#define VUCKT_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+	#define VUCKT_IS_CONSTANT_EVALUATED() true
+#endif
+
+
+
+#pragma mark Vector Traits & Component Access
+
+namespace vuckt
+{
+	/// The scalar type & component count of a Vuckt vector struct (`isVector` is false for anything else).
+	template <typename V>
+	struct VectorTraits {
+		static constexpr bool isVector = false;
+	};
+	/// The Vuckt vector struct of `count` `Scalar`s, as `Type`.
+	template <typename Scalar, size_t count>
+	struct VectorOf;
+	
+	#define _VUCKT_CPP_VECTOR_TRAITS(TYPE, SCALAR, COUNT) \
+		template <> struct VectorTraits<TYPE> { static constexpr bool isVector = true; using Scalar = SCALAR; static constexpr size_t count = COUNT; }; \
+		template <> struct VectorOf<SCALAR, COUNT> { using Type = TYPE; };
+	
+	_VUCKT_CPP_VECTOR_TRAITS(Float2, float, 2)
+	_VUCKT_CPP_VECTOR_TRAITS(Float3, float, 3)
+	_VUCKT_CPP_VECTOR_TRAITS(Float4, float, 4)
+	_VUCKT_CPP_VECTOR_TRAITS(Int2, int, 2)
+	_VUCKT_CPP_VECTOR_TRAITS(Int3, int, 3)
+	_VUCKT_CPP_VECTOR_TRAITS(Int4, int, 4)
+	_VUCKT_CPP_VECTOR_TRAITS(Double2, double, 2)
+	_VUCKT_CPP_VECTOR_TRAITS(Double3, double, 3)
+	_VUCKT_CPP_VECTOR_TRAITS(Double4, double, 4)
+	_VUCKT_CPP_VECTOR_TRAITS(Char4, signed char, 4)
+	_VUCKT_CPP_VECTOR_TRAITS(UChar4, unsigned char, 4)
+	_VUCKT_CPP_VECTOR_TRAITS(Short2, short, 2)
+	_VUCKT_CPP_VECTOR_TRAITS(Short3, short, 3)
+	_VUCKT_CPP_VECTOR_TRAITS(Short4, short, 4)
+	_VUCKT_CPP_VECTOR_TRAITS(UShort4, unsigned short, 4)
+	// (`PackedFloat3` shares `Float3`'s scalar & count, so isn't `VectorOf`'s pick for them.)
+	template <> struct VectorTraits<PackedFloat3> { static constexpr bool isVector = true; using Scalar = float; static constexpr size_t count = 3; };
+	// (The `Half*` types are omitted: their `unsigned short` components are bit patterns, which compare & swizzle differently than the halves they hold.)
+	
+	#undef _VUCKT_CPP_VECTOR_TRAITS
+	
+	/// Component `index` (0–3 for `x`–`w`) of `v`.
+	template <size_t index, typename V>
+	constexpr typename VectorTraits<V>::Scalar component(const V &v) {
+		static_assert(index < VectorTraits<V>::count, "Component index is out of range for this vector type.");
+		if constexpr (index == 0)
+			return v.x;
+		else if constexpr (index == 1)
+			return v.y;
+		else if constexpr (index == 2)
+			return v.z;
+		else
+			return v.w;
+	}
+	
+	/// A vector with every component `s` (like Swift's `init(scalar:)`).
+	template <typename V>
+	constexpr V broadcast(typename VectorTraits<V>::Scalar s) {
+		if constexpr (VectorTraits<V>::count == 2)
+			return V{ s, s };
+		else if constexpr (VectorTraits<V>::count == 3)
+			return V{ s, s, s };
+		else
+			return V{ s, s, s, s };
+	}
+	
+	/// `v`'s components at `indices` (0–3 for `x`–`w`, in any order & repeated or not), as the vector of that many components: e.g. `swizzle<2, 1, 0>(float3Value)` is its `zyx`, & `swizzle<0, 1>(float4Value)` its `xy` (a `Float2`).
+	template <size_t... indices, typename V>
+	constexpr typename VectorOf<typename VectorTraits<V>::Scalar, sizeof...(indices)>::Type swizzle(const V &v) {
+		return { component<indices>(v)... };
+	}
+	
+	namespace detail
+	{
+		template <typename V, typename Operation, size_t... indices>
+		constexpr V map(const V &a, const V &b, Operation operation, std::index_sequence<indices...>) {
+			return V{ operation(component<indices>(a), component<indices>(b))... };
+		}
+		/// `operation` applied to each pair of `a`'s & `b`'s components.
+		template <typename V, typename Operation>
+		constexpr V map(const V &a, const V &b, Operation operation) {
+			return map(a, b, operation, std::make_index_sequence<VectorTraits<V>::count>());
+		}
+		
+		template <typename V, size_t... indices>
+		constexpr bool equal(const V &a, const V &b, std::index_sequence<indices...>) {
+			return ((component<indices>(a) == component<indices>(b)) && ...);
+		}
+		/// Whether every one of `a`'s components equals `b`'s.
+		template <typename V>
+		constexpr bool equal(const V &a, const V &b) {
+			return equal(a, b, std::make_index_sequence<VectorTraits<V>::count>());
+		}
+	}
+}
+
+
+
+#pragma mark Vector Operators
+
+/// `==` & `!=` (all components equal, or not), for any vector type.
+#define _VUCKT_CPP_VECTOR_EQUALITY(T) \
+	constexpr bool operator==(const T &a, const T &b) { return vuckt::detail::equal(a, b); } \
+	constexpr bool operator!=(const T &a, const T &b) { return !vuckt::detail::equal(a, b); }
+
+/// Per-component arithmetic with another vector & with a scalar, unary `-`, & compound assignment, for the vector types with `T##Add()` &c.
+#define _VUCKT_CPP_VECTOR_ARITHMETIC(T, S) \
+	_VUCKT_CPP_VECTOR_EQUALITY(T) \
+	constexpr T operator+(const T &a, const T &b) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(a, b, std::plus<S>()) : T##Add(a, b); } \
+	constexpr T operator-(const T &a, const T &b) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(a, b, std::minus<S>()) : T##Subtract(a, b); } \
+	constexpr T operator*(const T &a, const T &b) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(a, b, std::multiplies<S>()) : T##Multiply(a, b); } \
+	constexpr T operator/(const T &a, const T &b) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(a, b, std::divides<S>()) : T##Divide(a, b); } \
+	constexpr T operator-(const T &v) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(v, v, [](S component, S) { return -component; }) : T##Negate(v); } \
+	constexpr T operator+(const T &v) { return v; } \
+	constexpr T operator*(const T &v, S s) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(v, vuckt::broadcast<T>(s), std::multiplies<S>()) : T##MultiplyByScalar(v, s); } \
+	constexpr T operator*(S s, const T &v) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(vuckt::broadcast<T>(s), v, std::multiplies<S>()) : T##MultiplyingScalar(s, v); } \
+	constexpr T operator/(const T &v, S s) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(v, vuckt::broadcast<T>(s), std::divides<S>()) : T##DivideByScalar(v, s); } \
+	constexpr T operator/(S s, const T &v) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(vuckt::broadcast<T>(s), v, std::divides<S>()) : T##DividingScalar(s, v); } \
+	constexpr T &operator+=(T &a, const T &b) { return a = a + b; } \
+	constexpr T &operator-=(T &a, const T &b) { return a = a - b; } \
+	constexpr T &operator*=(T &a, const T &b) { return a = a * b; } \
+	constexpr T &operator/=(T &a, const T &b) { return a = a / b; } \
+	constexpr T &operator*=(T &v, S s) { return v = v * s; } \
+	constexpr T &operator/=(T &v, S s) { return v = v / s; }
+
+/// `%` & `%=`: `constexpr` for the integer types, …
+#define _VUCKT_CPP_VECTOR_INTEGER_MODULUS(T, S) \
+	constexpr T operator%(const T &a, const T &b) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(a, b, std::modulus<S>()) : T##Modulus(a, b); } \
+	constexpr T operator%(const T &v, S s) { return VUCKT_IS_CONSTANT_EVALUATED() ? vuckt::detail::map(v, vuckt::broadcast<T>(s), std::modulus<S>()) : T##ModulusByScalar(v, s); } \
+	constexpr T &operator%=(T &a, const T &b) { return a = a % b; } \
+	constexpr T &operator%=(T &v, S s) { return v = v % s; }
+/// … but only at run time for the floating-point ones (as `fmod()` isn't `constexpr`).
+#define _VUCKT_CPP_VECTOR_FLOATING_POINT_MODULUS(T, S) \
+	inline T operator%(const T &a, const T &b) { return T##Modulus(a, b); } \
+	inline T operator%(const T &v, S s) { return T##ModulusByScalar(v, s); } \
+	inline T &operator%=(T &a, const T &b) { return a = a % b; } \
+	inline T &operator%=(T &v, S s) { return v = v % s; }
+
+_VUCKT_CPP_VECTOR_ARITHMETIC(Float2, float)
+_VUCKT_CPP_VECTOR_ARITHMETIC(Float3, float)
+_VUCKT_CPP_VECTOR_ARITHMETIC(Float4, float)
+_VUCKT_CPP_VECTOR_ARITHMETIC(Int2, int)
+_VUCKT_CPP_VECTOR_ARITHMETIC(Int3, int)
+_VUCKT_CPP_VECTOR_ARITHMETIC(Int4, int)
+_VUCKT_CPP_VECTOR_ARITHMETIC(Double2, double)
+_VUCKT_CPP_VECTOR_ARITHMETIC(Double3, double)
+_VUCKT_CPP_VECTOR_ARITHMETIC(Double4, double)
+
+_VUCKT_CPP_VECTOR_FLOATING_POINT_MODULUS(Float2, float)
+_VUCKT_CPP_VECTOR_FLOATING_POINT_MODULUS(Float3, float)
+_VUCKT_CPP_VECTOR_FLOATING_POINT_MODULUS(Float4, float)
+_VUCKT_CPP_VECTOR_INTEGER_MODULUS(Int2, int)
+_VUCKT_CPP_VECTOR_INTEGER_MODULUS(Int3, int)
+_VUCKT_CPP_VECTOR_INTEGER_MODULUS(Int4, int)
+_VUCKT_CPP_VECTOR_FLOATING_POINT_MODULUS(Double2, double)
+_VUCKT_CPP_VECTOR_FLOATING_POINT_MODULUS(Double3, double)
+_VUCKT_CPP_VECTOR_FLOATING_POINT_MODULUS(Double4, double)
+
+// The storage-only types (no C arithmetic) get equality alone.
+_VUCKT_CPP_VECTOR_EQUALITY(PackedFloat3)
+_VUCKT_CPP_VECTOR_EQUALITY(Char4)
+_VUCKT_CPP_VECTOR_EQUALITY(UChar4)
+_VUCKT_CPP_VECTOR_EQUALITY(Short2)
+_VUCKT_CPP_VECTOR_EQUALITY(Short3)
+_VUCKT_CPP_VECTOR_EQUALITY(Short4)
+_VUCKT_CPP_VECTOR_EQUALITY(UShort4)
+
+#undef _VUCKT_CPP_VECTOR_EQUALITY
+#undef _VUCKT_CPP_VECTOR_ARITHMETIC
+#undef _VUCKT_CPP_VECTOR_INTEGER_MODULUS
+#undef _VUCKT_CPP_VECTOR_FLOATING_POINT_MODULUS
+
+
+
+#pragma mark Quaternion Operators
+
+// Computed per component both at compile & run time: the C API has no single-quaternion arithmetic to defer to (its `…Lanes…` kernels work 4 quaternions at a time), & these are short enough to vectorize as written.
+
+constexpr bool operator==(const FloatQuaternion &a, const FloatQuaternion &b) { return a.ix == b.ix && a.iy == b.iy && a.iz == b.iz && a.r == b.r; }
+constexpr bool operator!=(const FloatQuaternion &a, const FloatQuaternion &b) { return !(a == b); }
+
+constexpr FloatQuaternion operator+(const FloatQuaternion &a, const FloatQuaternion &b) { return { a.ix + b.ix, a.iy + b.iy, a.iz + b.iz, a.r + b.r }; }
+constexpr FloatQuaternion operator-(const FloatQuaternion &a, const FloatQuaternion &b) { return { a.ix - b.ix, a.iy - b.iy, a.iz - b.iz, a.r - b.r }; }
+constexpr FloatQuaternion operator-(const FloatQuaternion &q) { return { -q.ix, -q.iy, -q.iz, -q.r }; }
+constexpr FloatQuaternion operator*(const FloatQuaternion &q, float s) { return { q.ix * s, q.iy * s, q.iz * s, q.r * s }; }
+constexpr FloatQuaternion operator*(float s, const FloatQuaternion &q) { return q * s; }
+constexpr FloatQuaternion operator/(const FloatQuaternion &q, float s) { return { q.ix / s, q.iy / s, q.iz / s, q.r / s }; }
+
+/// The Hamilton product (rotating by `b`, then `a`, for unit quaternions).
+constexpr FloatQuaternion operator*(const FloatQuaternion &a, const FloatQuaternion &b) {
+	return {
+		a.r * b.ix + a.ix * b.r + a.iy * b.iz - a.iz * b.iy,
+		a.r * b.iy - a.ix * b.iz + a.iy * b.r + a.iz * b.ix,
+		a.r * b.iz + a.ix * b.iy - a.iy * b.ix + a.iz * b.r,
+		a.r * b.r - a.ix * b.ix - a.iy * b.iy - a.iz * b.iz,
+	};
+}
+/// `v` rotated by the unit quaternion `q`: `v + 2r(u × v) + 2u × (u × v)`, where `u` is `q`'s imaginary part.
+constexpr Float3 operator*(const FloatQuaternion &q, const Float3 &v) {
+	Float3 t = {
+		2 * (q.iy * v.z - q.iz * v.y),
+		2 * (q.iz * v.x - q.ix * v.z),
+		2 * (q.ix * v.y - q.iy * v.x),
+	};
+	return {
+		v.x + q.r * t.x + (q.iy * t.z - q.iz * t.y),
+		v.y + q.r * t.y + (q.iz * t.x - q.ix * t.z),
+		v.z + q.r * t.z + (q.ix * t.y - q.iy * t.x),
+	};
+}
+
+constexpr FloatQuaternion &operator+=(FloatQuaternion &a, const FloatQuaternion &b) { return a = a + b; }
+constexpr FloatQuaternion &operator-=(FloatQuaternion &a, const FloatQuaternion &b) { return a = a - b; }
+constexpr FloatQuaternion &operator*=(FloatQuaternion &a, const FloatQuaternion &b) { return a = a * b; }
+constexpr FloatQuaternion &operator*=(FloatQuaternion &q, float s) { return q = q * s; }
+constexpr FloatQuaternion &operator/=(FloatQuaternion &q, float s) { return q = q / s; }
+
+
+
+#pragma mark Matrix Column Access
+
+namespace vuckt
+{
+	/// Column `index` of a matrix, & a matrix from its columns.
+	constexpr Float3 column(const Float3x3 &m, size_t index) {
+		return (index == 0) ? Float3{ m.m00, m.m01, m.m02 } : (index == 1) ? Float3{ m.m10, m.m11, m.m12 } : Float3{ m.m20, m.m21, m.m22 };
+	}
+	constexpr Float3x3 float3x3FromColumns(const Float3 &c0, const Float3 &c1, const Float3 &c2) {
+		return { c0.x, c0.y, c0.z, c1.x, c1.y, c1.z, c2.x, c2.y, c2.z };
+	}
+	
+	constexpr Float4 column(const Float4x4 &m, size_t index) {
+		return (index == 0) ? Float4{ m.m00, m.m01, m.m02, m.m03 } : (index == 1) ? Float4{ m.m10, m.m11, m.m12, m.m13 }
+			: (index == 2) ? Float4{ m.m20, m.m21, m.m22, m.m23 } : Float4{ m.m30, m.m31, m.m32, m.m33 };
+	}
+	constexpr Float4x4 float4x4FromColumns(const Float4 &c0, const Float4 &c1, const Float4 &c2, const Float4 &c3) {
+		return { c0.x, c0.y, c0.z, c0.w, c1.x, c1.y, c1.z, c1.w, c2.x, c2.y, c2.z, c2.w, c3.x, c3.y, c3.z, c3.w };
+	}
+	
+	constexpr Double4 column(const Double4x4 &m, size_t index) {
+		return (index == 0) ? Double4{ m.m00, m.m01, m.m02, m.m03 } : (index == 1) ? Double4{ m.m10, m.m11, m.m12, m.m13 }
+			: (index == 2) ? Double4{ m.m20, m.m21, m.m22, m.m23 } : Double4{ m.m30, m.m31, m.m32, m.m33 };
+	}
+	constexpr Double4x4 double4x4FromColumns(const Double4 &c0, const Double4 &c1, const Double4 &c2, const Double4 &c3) {
+		return { c0.x, c0.y, c0.z, c0.w, c1.x, c1.y, c1.z, c1.w, c2.x, c2.y, c2.z, c2.w, c3.x, c3.y, c3.z, c3.w };
+	}
+	
+	/// Column `index` of an affine transform: the 3×3 part's for 0–2, & the translation for 3.
+	constexpr Float3 column(const Float4x3 &m, size_t index) {
+		return (index == 0) ? Float3{ m.m00, m.m01, m.m02 } : (index == 1) ? Float3{ m.m10, m.m11, m.m12 }
+			: (index == 2) ? Float3{ m.m20, m.m21, m.m22 } : Float3{ m.m30, m.m31, m.m32 };
+	}
+	constexpr Float4x3 float4x3FromColumns(const Float3 &c0, const Float3 &c1, const Float3 &c2, const Float3 &c3) {
+		return { c0.x, c1.x, c2.x, c3.x, c0.y, c1.y, c2.y, c3.y, c0.z, c1.z, c2.z, c3.z };
+	}
+}
+
+
+
+#pragma mark Matrix Operators
+
+// `m * v` treats `v` as a column vector; `a * b` applies `b`, then `a` (as `…Concatenate()` does).
+// Equality, `+` & `-` are per column, via the vector operators above (so SIMD at run time).
+
+constexpr bool operator==(const Float3x3 &a, const Float3x3 &b) {
+	return vuckt::column(a, 0) == vuckt::column(b, 0) && vuckt::column(a, 1) == vuckt::column(b, 1) && vuckt::column(a, 2) == vuckt::column(b, 2);
+}
+constexpr bool operator!=(const Float3x3 &a, const Float3x3 &b) { return !(a == b); }
+constexpr Float3x3 operator+(const Float3x3 &a, const Float3x3 &b) {
+	return vuckt::float3x3FromColumns(vuckt::column(a, 0) + vuckt::column(b, 0), vuckt::column(a, 1) + vuckt::column(b, 1), vuckt::column(a, 2) + vuckt::column(b, 2));
+}
+constexpr Float3x3 operator-(const Float3x3 &a, const Float3x3 &b) {
+	return vuckt::float3x3FromColumns(vuckt::column(a, 0) - vuckt::column(b, 0), vuckt::column(a, 1) - vuckt::column(b, 1), vuckt::column(a, 2) - vuckt::column(b, 2));
+}
+constexpr Float3x3 operator*(const Float3x3 &m, float s) {
+	return vuckt::float3x3FromColumns(vuckt::column(m, 0) * s, vuckt::column(m, 1) * s, vuckt::column(m, 2) * s);
+}
+constexpr Float3x3 operator*(float s, const Float3x3 &m) { return m * s; }
+constexpr Float3 operator*(const Float3x3 &m, const Float3 &v) {
+	return vuckt::column(m, 0) * v.x + vuckt::column(m, 1) * v.y + vuckt::column(m, 2) * v.z;
+}
+constexpr Float3x3 operator*(const Float3x3 &a, const Float3x3 &b) {
+	return vuckt::float3x3FromColumns(a * vuckt::column(b, 0), a * vuckt::column(b, 1), a * vuckt::column(b, 2));
+}
+
+
+constexpr bool operator==(const Float4x4 &a, const Float4x4 &b) {
+	return vuckt::column(a, 0) == vuckt::column(b, 0) && vuckt::column(a, 1) == vuckt::column(b, 1)
+		&& vuckt::column(a, 2) == vuckt::column(b, 2) && vuckt::column(a, 3) == vuckt::column(b, 3);
+}
+constexpr bool operator!=(const Float4x4 &a, const Float4x4 &b) { return !(a == b); }
+constexpr Float4x4 operator+(const Float4x4 &a, const Float4x4 &b) {
+	return vuckt::float4x4FromColumns(vuckt::column(a, 0) + vuckt::column(b, 0), vuckt::column(a, 1) + vuckt::column(b, 1),
+		vuckt::column(a, 2) + vuckt::column(b, 2), vuckt::column(a, 3) + vuckt::column(b, 3));
+}
+constexpr Float4x4 operator-(const Float4x4 &a, const Float4x4 &b) {
+	return vuckt::float4x4FromColumns(vuckt::column(a, 0) - vuckt::column(b, 0), vuckt::column(a, 1) - vuckt::column(b, 1),
+		vuckt::column(a, 2) - vuckt::column(b, 2), vuckt::column(a, 3) - vuckt::column(b, 3));
+}
+constexpr Float4x4 operator*(const Float4x4 &m, float s) {
+	return vuckt::float4x4FromColumns(vuckt::column(m, 0) * s, vuckt::column(m, 1) * s, vuckt::column(m, 2) * s, vuckt::column(m, 3) * s);
+}
+constexpr Float4x4 operator*(float s, const Float4x4 &m) { return m * s; }
+constexpr Float4 operator*(const Float4x4 &m, const Float4 &v) {
+	return vuckt::column(m, 0) * v.x + vuckt::column(m, 1) * v.y + vuckt::column(m, 2) * v.z + vuckt::column(m, 3) * v.w;
+}
+constexpr Float4x4 operator*(const Float4x4 &a, const Float4x4 &b) {
+	if (!VUCKT_IS_CONSTANT_EVALUATED())
+		return Float4x4Concatenate(a, b);
+	return vuckt::float4x4FromColumns(a * vuckt::column(b, 0), a * vuckt::column(b, 1), a * vuckt::column(b, 2), a * vuckt::column(b, 3));
+}
+
+
+constexpr bool operator==(const Double4x4 &a, const Double4x4 &b) {
+	return vuckt::column(a, 0) == vuckt::column(b, 0) && vuckt::column(a, 1) == vuckt::column(b, 1)
+		&& vuckt::column(a, 2) == vuckt::column(b, 2) && vuckt::column(a, 3) == vuckt::column(b, 3);
+}
+constexpr bool operator!=(const Double4x4 &a, const Double4x4 &b) { return !(a == b); }
+constexpr Double4 operator*(const Double4x4 &m, const Double4 &v) {
+	return vuckt::column(m, 0) * v.x + vuckt::column(m, 1) * v.y + vuckt::column(m, 2) * v.z + vuckt::column(m, 3) * v.w;
+}
+constexpr Double4x4 operator*(const Double4x4 &a, const Double4x4 &b) {
+	if (!VUCKT_IS_CONSTANT_EVALUATED())
+		return Double4x4Concatenate(a, b);
+	return vuckt::double4x4FromColumns(a * vuckt::column(b, 0), a * vuckt::column(b, 1), a * vuckt::column(b, 2), a * vuckt::column(b, 3));
+}
+
+
+// (No `Float4x3 * Float3`: whether that's a point or a direction is ambiguous, so use `Float4x3TransformPoint()` or `…TransformVector()`.)
+constexpr bool operator==(const Float4x3 &a, const Float4x3 &b) {
+	return vuckt::column(a, 0) == vuckt::column(b, 0) && vuckt::column(a, 1) == vuckt::column(b, 1)
+		&& vuckt::column(a, 2) == vuckt::column(b, 2) && vuckt::column(a, 3) == vuckt::column(b, 3);
+}
+constexpr bool operator!=(const Float4x3 &a, const Float4x3 &b) { return !(a == b); }
+constexpr Float4x3 operator*(const Float4x3 &a, const Float4x3 &b) {
+	if (!VUCKT_IS_CONSTANT_EVALUATED())
+		return Float4x3Concatenate(a, b);
+	Float3 a0 = vuckt::column(a, 0), a1 = vuckt::column(a, 1), a2 = vuckt::column(a, 2);
+	return vuckt::float4x3FromColumns(
+		a0 * b.m00 + a1 * b.m01 + a2 * b.m02,
+		a0 * b.m10 + a1 * b.m11 + a2 * b.m12,
+		a0 * b.m20 + a1 * b.m21 + a2 * b.m22,
+		a0 * b.m30 + a1 * b.m31 + a2 * b.m32 + vuckt::column(a, 3)
+	);
+}
+
+
+constexpr Float3x3 &operator+=(Float3x3 &a, const Float3x3 &b) { return a = a + b; }
+constexpr Float3x3 &operator-=(Float3x3 &a, const Float3x3 &b) { return a = a - b; }
+constexpr Float3x3 &operator*=(Float3x3 &a, const Float3x3 &b) { return a = a * b; }
+constexpr Float3x3 &operator*=(Float3x3 &m, float s) { return m = m * s; }
+constexpr Float4x4 &operator+=(Float4x4 &a, const Float4x4 &b) { return a = a + b; }
+constexpr Float4x4 &operator-=(Float4x4 &a, const Float4x4 &b) { return a = a - b; }
+constexpr Float4x4 &operator*=(Float4x4 &a, const Float4x4 &b) { return a = a * b; }
+constexpr Float4x4 &operator*=(Float4x4 &m, float s) { return m = m * s; }
+constexpr Double4x4 &operator*=(Double4x4 &a, const Double4x4 &b) { return a = a * b; }
+constexpr Float4x3 &operator*=(Float4x3 &a, const Float4x3 &b) { return a = a * b; }
+
+
+
+#pragma mark Presets
+
+// The Swift presets' C++ twins (e.g. `Float3.unitX` is `Float3UnitX`), as compile-time constants.  (Negative ones are just `-Float3UnitX` &c.)
+
+inline constexpr Float2 Float2Zero = { 0, 0 };
+inline constexpr Float2 Float2One = { 1, 1 };
+inline constexpr Float2 Float2UnitX = { 1, 0 };
+inline constexpr Float2 Float2UnitY = { 0, 1 };
+
+inline constexpr Float3 Float3Zero = { 0, 0, 0 };
+inline constexpr Float3 Float3One = { 1, 1, 1 };
+inline constexpr Float3 Float3UnitX = { 1, 0, 0 };
+inline constexpr Float3 Float3UnitY = { 0, 1, 0 };
+inline constexpr Float3 Float3UnitZ = { 0, 0, 1 };
+
+inline constexpr Float4 Float4Zero = { 0, 0, 0, 0 };
+inline constexpr Float4 Float4One = { 1, 1, 1, 1 };
+inline constexpr Float4 Float4UnitX = { 1, 0, 0, 0 };
+inline constexpr Float4 Float4UnitY = { 0, 1, 0, 0 };
+inline constexpr Float4 Float4UnitZ = { 0, 0, 1, 0 };
+inline constexpr Float4 Float4UnitW = { 0, 0, 0, 1 };
+
+inline constexpr Int2 Int2Zero = { 0, 0 };
+inline constexpr Int2 Int2One = { 1, 1 };
+inline constexpr Int2 Int2UnitX = { 1, 0 };
+inline constexpr Int2 Int2UnitY = { 0, 1 };
+
+inline constexpr Int3 Int3Zero = { 0, 0, 0 };
+inline constexpr Int3 Int3One = { 1, 1, 1 };
+inline constexpr Int3 Int3UnitX = { 1, 0, 0 };
+inline constexpr Int3 Int3UnitY = { 0, 1, 0 };
+inline constexpr Int3 Int3UnitZ = { 0, 0, 1 };
+
+inline constexpr Int4 Int4Zero = { 0, 0, 0, 0 };
+inline constexpr Int4 Int4One = { 1, 1, 1, 1 };
+inline constexpr Int4 Int4UnitX = { 1, 0, 0, 0 };
+inline constexpr Int4 Int4UnitY = { 0, 1, 0, 0 };
+inline constexpr Int4 Int4UnitZ = { 0, 0, 1, 0 };
+inline constexpr Int4 Int4UnitW = { 0, 0, 0, 1 };
+
+inline constexpr Double2 Double2Zero = { 0, 0 };
+inline constexpr Double2 Double2One = { 1, 1 };
+inline constexpr Double3 Double3Zero = { 0, 0, 0 };
+inline constexpr Double3 Double3One = { 1, 1, 1 };
+inline constexpr Double4 Double4Zero = { 0, 0, 0, 0 };
+inline constexpr Double4 Double4One = { 1, 1, 1, 1 };
+
+inline constexpr FloatQuaternion FloatQuaternionIdentity = { 0, 0, 0, 1 };
+
+inline constexpr Float3x3 Float3x3Zero = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+inline constexpr Float3x3 Float3x3Identity = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+inline constexpr Float4x4 Float4x4Zero = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+inline constexpr Float4x4 Float4x4Identity = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+inline constexpr Float4x3 Float4x3Zero = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+inline constexpr Float4x3 Float4x3Identity = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0 };
+inline constexpr Double4x4 Double4x4Zero = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+inline constexpr Double4x4 Double4x4Identity = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+
+
+
+VUCKT_DIAGNOSTICS_END
@@ -3,6 +3,9 @@
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
 import Foundation
+#if canImport(VucktC)
+	@_exported import VucktC
+#endif
 
 
 
@@ -42,3 +45,277 @@ public enum RotationOrder : UInt {
 	case zxy = 5
 	case zyx = 6
 }
+
+extension RotationOrder
+{
+	/// The indices (0 = x, 1 = y, 2 = z) of the axes rotated about first, second, & third, as the C Euler-angle functions (e.g. `FloatQuaternionFromEulerAngles()`) take them.
+	@_transparent public var axisIndices:(first:Int32, second:Int32, third:Int32) {
+		switch self {
+			case .xyz: return (0, 1, 2)
+			case .xzy: return (0, 2, 1)
+			case .yxz: return (1, 0, 2)
+			case .yzx: return (1, 2, 0)
+			case .zxy: return (2, 0, 1)
+			case .zyx: return (2, 1, 0)
+		}
+	}
+}
+
+
+/// Selects between full-precision math & the faster approximations (CPU reciprocal/reciprocal-square-root estimates refined by one Newton-Raphson step, & a polynomial sine/cosine) for the operations offering both, such as `normalized(precision:)`.
+/// `.fast` results are within 2.4e-5 relative error on any platform (& within a few ULP on x86); see the `vuckt_simd_fast_*()` kernels in `VucktPlatform.h` for each operation's bounds.
+public enum MathPrecision {
+	case full
+	case fast
+}
+
+
+/// How the narrowing conversions from `Int…` vectors to the compact integer vectors (`Char4`, `UChar4`, `Short2`…`Short4`, `UShort4`) treat values outside the narrower element type's range.
+public enum IntegerNarrowingMode {
+	/// Keep each value's low bits, wrapping out-of-range values around (as `init(truncatingIfNeeded:)` does).
+	case truncating
+	/// Clamp each value to the element type's range (as `init(clamping:)` does).
+	case clamping
+}
+
+/// How the narrowing conversions from `Float…` vectors to the compact integer vectors (`Char4`, `UChar4`, `Short2`…`Short4`, `UShort4`) map values onto the narrower element type.
+public enum FloatNarrowingMode {
+	/// Clamp each value to the element type's range (NaN becoming 0) & truncate it toward zero (as `init(saturating:)` does).
+	case saturating
+	/// Encode each value as UNORM (unsigned types: [ 0, 1 ] onto [ 0, max ]) or SNORM (signed types: [ -1, 1 ] onto [ -max, max ]), clamping & rounding to nearest (as `init(normalized:)` does).
+	case normalized
+}
+
+/// How the narrowing conversions from `Float…` vectors to the half-precision vectors (`Half2`…`Half4`) round values that half precision can't represent exactly.
+public enum HalfRoundingMode {
+	/// Round to the nearest representable value, ties to even (IEEE 754's default); values too large for half become ±Inf.
+	case toNearestOrEven
+	/// Round toward zero (truncate); finite values too large for half become ±65504, the largest finite half.
+	case towardZero
+}
+
+/// The clip-space depth range a projection matrix maps its view volume's near & far planes onto, which `Frustum(viewProjection:depthRange:)` needs to find those planes.
+public enum ClipDepthRange {
+	/// [ 0, 1 ], as Metal, Direct3D, & Vulkan use.
+	case zeroToOne
+	/// [ −1, 1 ], as OpenGL uses.
+	case negativeOneToOne
+}
+
+
+
+// MARK: Narrow Integer Conversion Helpers
+
+// The Swift backend's (`…_NoObjCBridge.swift`) counterparts to the narrow integer conversion kernels in `VucktPlatform.h`, which `Short2` & `Short3` also go through 4 lanes at a time.
+
+@usableFromInline internal func _vucktClampFloat(_ x:SIMD4<Float>, _ lo:Float, _ hi:Float) -> SIMD4<Float> {
+	return x.replacing(with: 0, where: x .!= x).clamped(lowerBound: SIMD4(repeating: lo), upperBound: SIMD4(repeating: hi))
+}
+@usableFromInline internal func _vucktFloatToIntClamped(_ x:SIMD4<Float>, _ lo:Float, _ hi:Float) -> SIMD4<Int32> {
+	return SIMD4<Int32>(_vucktClampFloat(x, lo, hi), rounding: .towardZero)
+}
+@usableFromInline internal func _vucktUnormFromFloat(_ x:SIMD4<Float>, _ maxValue:Float) -> SIMD4<Int32> {
+	return SIMD4<Int32>(_vucktClampFloat(x, 0, 1) * maxValue, rounding: .toNearestOrAwayFromZero)
+}
+@usableFromInline internal func _vucktSnormFromFloat(_ x:SIMD4<Float>, _ maxValue:Float) -> SIMD4<Int32> {
+	return SIMD4<Int32>(_vucktClampFloat(x, -1, 1) * maxValue, rounding: .toNearestOrAwayFromZero)
+}
+@usableFromInline internal func _vucktUnormToFloat(_ x:SIMD4<Int32>, _ maxValue:Float) -> SIMD4<Float> {
+	return SIMD4<Float>(x) * (1 / maxValue)
+}
+@usableFromInline internal func _vucktSnormToFloat(_ x:SIMD4<Int32>, _ maxValue:Float) -> SIMD4<Float> {
+	return _vucktClampFloat(SIMD4<Float>(x) * (1 / maxValue), -1, 1)
+}
+
+
+
+// MARK: Half-Precision Conversion Helpers
+
+// The Swift backend's (`…_NoObjCBridge.swift`) counterparts to the half-precision kernels in `VucktPlatform.h`, ported from their branch-free integer fallback (since `Float16` isn't available on every platform), which `Half2` & `Half3` also go through 4 lanes at a time.
+
+@usableFromInline internal func _vucktHalfToFloat(_ bits:SIMD4<UInt16>) -> SIMD4<Float> {
+	let halfBits = SIMD4<UInt32>(truncatingIfNeeded: bits)
+	let shifted = (halfBits & 0x7FFF) &<< 13
+	let exponent = shifted & 0x0F80_0000
+	var magnitude = (shifted &+ 0x3800_0000).replacing(with: shifted &+ 0x7000_0000, where: exponent .== 0x0F80_0000)
+	let subnormal = unsafeBitCast(magnitude &+ 0x0080_0000, to: SIMD4<Float>.self) - Float(bitPattern: 0x3880_0000)
+	magnitude.replace(with: unsafeBitCast(subnormal, to: SIMD4<UInt32>.self), where: exponent .== 0)
+	return unsafeBitCast(magnitude | ((halfBits & 0x8000) &<< 16), to: SIMD4<Float>.self)
+}
+@usableFromInline internal func _vucktHalfFromFloat(_ x:SIMD4<Float>, towardZero:Bool) -> SIMD4<UInt16> {
+	let floatBits = unsafeBitCast(x, to: SIMD4<UInt32>.self), magnitude = floatBits & 0x7FFF_FFFF
+	let subnormalMask = magnitude .< (113 << 23), overflowMask = magnitude .>= (143 << 23)
+	let subnormalMagnitude = unsafeBitCast(magnitude.replacing(with: 0, where: .!subnormalMask), to: SIMD4<Float>.self)
+	var halfBits:SIMD4<UInt32>, overflow:SIMD4<UInt32>
+	if towardZero {
+		halfBits = (magnitude &- 0x3800_0000) &>> 13
+		halfBits.replace(with: SIMD4<UInt32>(subnormalMagnitude * 16_777_216, rounding: .towardZero), where: subnormalMask)
+		overflow = SIMD4<UInt32>(repeating: 0x7BFF).replacing(with: 0x7C00, where: magnitude .== 0x7F80_0000)
+	} else {
+		halfBits = (magnitude &- 0x37FF_F001 &+ ((magnitude &>> 13) & 1)) &>> 13
+		halfBits.replace(with: unsafeBitCast(subnormalMagnitude + 0.5, to: SIMD4<UInt32>.self) &- 0x3F00_0000, where: subnormalMask)
+		overflow = SIMD4<UInt32>(repeating: 0x7C00)
+	}
+	halfBits.replace(with: overflow.replacing(with: 0x7E00, where: magnitude .> 0x7F80_0000), where: overflowMask)
+	return SIMD4<UInt16>(truncatingIfNeeded: halfBits | ((floatBits &>> 16) & 0x8000))
+}
+
+
+
+// MARK: Bulk Operation Helpers
+
+// Shared plumbing for the per-type `UnsafeBufferPointer`/`Array` bulk math extensions, which each hand in their `…Arrays`/`…Array` C function as `operation`.
+
+internal extension UnsafeBufferPointer
+{
+	@inlinable func _vucktBulkOperation(_ other:UnsafeBufferPointer<Element>, into out:UnsafeMutableBufferPointer<Element>, _ operation:(UnsafePointer<Element>, UnsafePointer<Element>, UnsafeMutablePointer<Element>, Int) -> Void) {
+		precondition(other.count == self.count && out.count == self.count, "Bulk operation buffers must all have the same count.")
+		guard self.count > 0 else { return }
+		operation(self.baseAddress!, other.baseAddress!, out.baseAddress!, self.count)
+	}
+	@inlinable func _vucktBulkOperation<Scalar>(_ scalar:Scalar, into out:UnsafeMutableBufferPointer<Element>, _ operation:(UnsafePointer<Element>, Scalar, UnsafeMutablePointer<Element>, Int) -> Void) {
+		precondition(out.count == self.count, "Bulk operation buffers must all have the same count.")
+		guard self.count > 0 else { return }
+		operation(self.baseAddress!, scalar, out.baseAddress!, self.count)
+	}
+	@inlinable func _vucktBulkOperation(into out:UnsafeMutableBufferPointer<Element>, _ operation:(UnsafePointer<Element>, UnsafeMutablePointer<Element>, Int) -> Void) {
+		precondition(out.count == self.count, "Bulk operation buffers must all have the same count.")
+		guard self.count > 0 else { return }
+		operation(self.baseAddress!, out.baseAddress!, self.count)
+	}
+	@inlinable func _vucktBulkConversion<Result>(into out:UnsafeMutableBufferPointer<Result>, _ operation:(UnsafePointer<Element>, UnsafeMutablePointer<Result>, Int) -> Void) {
+		precondition(out.count == self.count, "Bulk operation buffers must all have the same count.")
+		guard self.count > 0 else { return }
+		operation(self.baseAddress!, out.baseAddress!, self.count)
+	}
+}
+
+internal extension Array
+{
+	@inlinable func _vucktBulkOperation(_ other:[Element], _ operation:(UnsafePointer<Element>, UnsafePointer<Element>, UnsafeMutablePointer<Element>, Int) -> Void) -> [Element] {
+		precondition(other.count == self.count, "Bulk operation arrays must have the same count.")
+		return self.withUnsafeBufferPointer{ selfBuffer in
+			other.withUnsafeBufferPointer{ otherBuffer in
+				Array(unsafeUninitializedCapacity: self.count) { outBuffer, initializedCount in
+					selfBuffer._vucktBulkOperation(otherBuffer, into: UnsafeMutableBufferPointer(rebasing: outBuffer[0..<self.count]), operation)
+					initializedCount = self.count
+				}
+			}
+		}
+	}
+	@inlinable func _vucktBulkOperation<Scalar>(_ scalar:Scalar, _ operation:(UnsafePointer<Element>, Scalar, UnsafeMutablePointer<Element>, Int) -> Void) -> [Element] {
+		return self.withUnsafeBufferPointer{ selfBuffer in
+			Array(unsafeUninitializedCapacity: self.count) { outBuffer, initializedCount in
+				selfBuffer._vucktBulkOperation(scalar, into: UnsafeMutableBufferPointer(rebasing: outBuffer[0..<self.count]), operation)
+				initializedCount = self.count
+			}
+		}
+	}
+	@inlinable func _vucktBulkOperation(_ operation:(UnsafePointer<Element>, UnsafeMutablePointer<Element>, Int) -> Void) -> [Element] {
+		return self.withUnsafeBufferPointer{ selfBuffer in
+			Array(unsafeUninitializedCapacity: self.count) { outBuffer, initializedCount in
+				selfBuffer._vucktBulkOperation(into: UnsafeMutableBufferPointer(rebasing: outBuffer[0..<self.count]), operation)
+				initializedCount = self.count
+			}
+		}
+	}
+	@inlinable func _vucktBulkConversion<Result>(_ operation:(UnsafePointer<Element>, UnsafeMutablePointer<Result>, Int) -> Void) -> [Result] {
+		return self.withUnsafeBufferPointer{ selfBuffer in
+			Array<Result>(unsafeUninitializedCapacity: self.count) { outBuffer, initializedCount in
+				selfBuffer._vucktBulkConversion(into: UnsafeMutableBufferPointer(rebasing: outBuffer[0..<self.count]), operation)
+				initializedCount = self.count
+			}
+		}
+	}
+	
+	@inlinable mutating func _vucktFormBulkOperation(_ other:[Element], _ operation:(UnsafePointer<Element>, UnsafePointer<Element>, UnsafeMutablePointer<Element>, Int) -> Void) {
+		precondition(other.count == self.count, "Bulk operation arrays must have the same count.")
+		other.withUnsafeBufferPointer{ otherBuffer in
+			self.withUnsafeMutableBufferPointer{ selfBuffer in
+				UnsafeBufferPointer(selfBuffer)._vucktBulkOperation(otherBuffer, into: selfBuffer, operation)
+			}
+		}
+	}
+	@inlinable mutating func _vucktFormBulkOperation<Scalar>(_ scalar:Scalar, _ operation:(UnsafePointer<Element>, Scalar, UnsafeMutablePointer<Element>, Int) -> Void) {
+		self.withUnsafeMutableBufferPointer{ selfBuffer in
+			UnsafeBufferPointer(selfBuffer)._vucktBulkOperation(scalar, into: selfBuffer, operation)
+		}
+	}
+	@inlinable mutating func _vucktFormBulkOperation(_ operation:(UnsafePointer<Element>, UnsafeMutablePointer<Element>, Int) -> Void) {
+		self.withUnsafeMutableBufferPointer{ selfBuffer in
+			UnsafeBufferPointer(selfBuffer)._vucktBulkOperation(into: selfBuffer, operation)
+		}
+	}
+}
+
+
+
+// MARK: Zero-Copy Views
+
+/// One field of each element of an array— a vector's component (e.g. `points.components(\.x)`), or a matrix's column (`matrices.columns(3)`)— viewed in place, rather than copied out by a `map`.
+/// The view holds onto the array (sharing its storage, as any copy of an array does), so it stays valid for as long as it's kept, whatever becomes of the original.
+public struct StridedArrayView<Element, Field> : RandomAccessCollection
+{
+	public let base:[Element]
+	/// The byte offset of the field within each element.
+	public let fieldOffset:Int
+	
+	/// - Precondition: `fieldOffset` must place a whole `Field`, aligned for its type, within each element.
+	@inlinable public init(_ base:[Element], fieldOffset:Int) {
+		precondition(fieldOffset >= 0 && fieldOffset + MemoryLayout<Field>.size <= MemoryLayout<Element>.stride, "Field must lie within each element.")
+		precondition(fieldOffset % MemoryLayout<Field>.alignment == 0 && MemoryLayout<Element>.alignment % MemoryLayout<Field>.alignment == 0, "Field must be aligned within each element.")
+		self.base = base
+		self.fieldOffset = fieldOffset
+	}
+	/// - Precondition: `field` must be a stored property (e.g. `\Float3.x`), not a computed one.
+	@inlinable public init(_ base:[Element], field:KeyPath<Element, Field>) {
+		guard let fieldOffset = MemoryLayout<Element>.offset(of: field) else {
+			preconditionFailure("Field must be a stored property of the element.")
+		}
+		self.init(base, fieldOffset: fieldOffset)
+	}
+	
+	public typealias Index = Int
+	
+	@inlinable public var startIndex:Int { return 0 }
+	@inlinable public var endIndex:Int { return self.base.count }
+	
+	@inlinable public subscript(index:Int) -> Field {
+		return self.base.withUnsafeBufferPointer{ buffer in
+			precondition(index >= 0 && index < buffer.count, "Index out of range.")
+			return UnsafeRawPointer(buffer.baseAddress!).load(fromByteOffset: index * MemoryLayout<Element>.stride + self.fieldOffset, as: Field.self)
+		}
+	}
+}
+
+
+
+// MARK: Reinterpreting Helpers
+
+// Shared plumbing for the per-type `with…MemoryRebound` extensions between Vuckt's structs & their simd counterparts: rebinding the memory in place where the two are laid out alike (as the `static_assert`s in each type's `.mm` file ensure for the C backend), or else converting through a temporary buffer (for the Swift backend's 12-byte `Float3`s, & its 4-byte-aligned structs viewed as 16-byte-aligned simd types).
+
+internal extension UnsafeBufferPointer
+{
+	@inlinable func _vucktWithReinterpretedBuffer<Other, Result>(as _:Other.Type, converting convert:(Element) -> Other, _ body:(UnsafeBufferPointer<Other>) throws -> Result) rethrows -> Result {
+		if MemoryLayout<Element>.stride == MemoryLayout<Other>.stride && MemoryLayout<Element>.alignment % MemoryLayout<Other>.alignment == 0 {
+			return try self.withMemoryRebound(to: Other.self, body)
+		}
+		return try self.map(convert).withUnsafeBufferPointer(body)
+	}
+}
+
+internal extension UnsafeMutableBufferPointer
+{
+	@inlinable func _vucktWithReinterpretedBuffer<Other, Result>(as _:Other.Type, converting convert:(Element) -> Other, back convertBack:(Other) -> Element, _ body:(UnsafeMutableBufferPointer<Other>) throws -> Result) rethrows -> Result {
+		if MemoryLayout<Element>.stride == MemoryLayout<Other>.stride && MemoryLayout<Element>.alignment % MemoryLayout<Other>.alignment == 0 {
+			return try self.withMemoryRebound(to: Other.self, body)
+		}
+		var converted = self.map(convert)
+		defer {
+			for (index, value) in converted.enumerated() {
+				self[index] = convertBack(value)
+			}
+		}
+		return try converted.withUnsafeMutableBufferPointer{ try body($0) }
+	}
+}
@@ -0,0 +1,424 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+// The portable (non-Objective-C) translation unit, built by SwiftPM's `VucktC` target.
+// Repeats each type's `.mm` layout sanity checks, so they also guard the portable SIMD types from `VucktPlatform.h`.
+
+#include <assert.h>
+#include <stdalign.h>
+#include <stddef.h>
+
+#include "../Int2/Int2.h"
+#include "../Int3/Int3.h"
+#include "../Int4/Int4.h"
+#include "../Float2/Float2.h"
+#include "../Float3/Float3.h"
+#include "../Float4/Float4.h"
+#include "../FloatQuaternion/FloatQuaternion.h"
+#include "../Float3x3/Float3x3.h"
+#include "../Float4x4/Float4x4.h"
+#include "../PackedFloat3/PackedFloat3.h"
+#include "../Float4x3/Float4x3.h"
+#include "../Char4/Char4.h"
+#include "../UChar4/UChar4.h"
+#include "../Short2/Short2.h"
+#include "../Short3/Short3.h"
+#include "../Short4/Short4.h"
+#include "../UShort4/UShort4.h"
+#include "../Half2/Half2.h"
+#include "../Half3/Half3.h"
+#include "../Half4/Half4.h"
+#include "../Double2/Double2.h"
+#include "../Double3/Double3.h"
+#include "../Double4/Double4.h"
+#include "../Double4x4/Double4x4.h"
+#include "../AABB3/AABB3.h"
+#include "../Ray3/Ray3.h"
+#include "../BVH/BVH.h"
+#include "../ArrayFile/ArrayFile.h"
+#include "../BulkCodec/BulkCodec.h"
+#include "../Curve/Curve.h"
+#include "../Parallel/Parallel.h"
+
+
+
+#pragma mark Int2 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Int2, x) == sizeof(simd_int1),
+	"Int2's first member's size does not match simd_int1's on this platform.");
+static_assert(sizeof(Int2) == sizeof(simd_int2),
+	"Int2's size does not match simd_int2's on this platform.");
+static_assert(sizeof_member(Int2, x) == sizeof((*(simd_int2 *)0)[0]),
+	"Int2's first member's size does not match simd_int2's first member's on this platform.");
+static_assert(alignof(Int2) == alignof(simd_int2),
+	"Int2's alignment requirements does not match simd_int2's on this platform.");
+
+
+
+#pragma mark Int3 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Int3, x) == sizeof(simd_int1),
+	"Int3's first member's size does not match simd_int1's on this platform.");
+static_assert(sizeof(Int3) == sizeof(simd_int3),
+	"Int3's size does not match simd_int3's on this platform.");
+static_assert(sizeof_member(Int3, x) == sizeof((*(simd_int3 *)0)[0]),
+	"Int3's first member's size does not match simd_int3's first member's on this platform.");
+static_assert(alignof(Int3) == alignof(simd_int3),
+	"Int3's alignment requirements does not match simd_int3's on this platform.");
+
+
+
+#pragma mark Int4 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Int4, x) == sizeof(simd_int1),
+	"Int4's first member's size does not match simd_int1's on this platform.");
+static_assert(sizeof(Int4) == sizeof(simd_int4),
+	"Int4's size does not match simd_int4's on this platform.");
+static_assert(sizeof_member(Int4, x) == sizeof((*(simd_int4 *)0)[0]),
+	"Int4's first member's size does not match simd_int4's first member's on this platform.");
+static_assert(alignof(Int4) == alignof(simd_int4),
+	"Int4's alignment requirements does not match simd_int4's on this platform.");
+
+
+
+#pragma mark Float2 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Float2, x) == sizeof(simd_float1),
+	"Float2's first member's size does not match simd_float1's on this platform.");
+static_assert(sizeof(Float2) == sizeof(simd_float2),
+	"Float2's size does not match simd_float2's on this platform.");
+static_assert(sizeof_member(Float2, x) == sizeof((*(simd_float2 *)0)[0]),
+	"Float2's first member's size does not match simd_float2's first member's on this platform.");
+static_assert(alignof(Float2) == alignof(simd_float2),
+	"Float2's alignment requirements does not match simd_float2's on this platform.");
+
+
+
+#pragma mark Float3 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Float3, x) == sizeof(simd_float1),
+	"Float3's first member's size does not match simd_float1's on this platform.");
+static_assert(sizeof(Float3) == sizeof(simd_float3),
+	"Float3's size does not match simd_float3's on this platform.");
+static_assert(sizeof_member(Float3, x) == sizeof((*(simd_float3 *)0)[0]),
+	"Float3's first member's size does not match simd_float3's first member's on this platform.");
+static_assert(alignof(Float3) == alignof(simd_float3),
+	"Float3's alignment requirements does not match simd_float3's on this platform.");
+
+
+
+#pragma mark Float4 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Float4, x) == sizeof(simd_float1),
+	"Float4's first member's size does not match simd_float1's on this platform.");
+static_assert(sizeof(Float4) == sizeof(simd_float4),
+	"Float4's size does not match simd_float4's on this platform.");
+static_assert(sizeof_member(Float4, x) == sizeof((*(simd_float4 *)0)[0]),
+	"Float4's first member's size does not match simd_float4's first member's on this platform.");
+static_assert(alignof(Float4) == alignof(simd_float4),
+	"Float4's alignment requirements does not match simd_float4's on this platform.");
+
+
+
+#pragma mark FloatQuaternion Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(FloatQuaternion, ix) == sizeof(simd_float1),
+	"FloatQuaternion's first member's size does not match simd_float1's on this platform.");
+static_assert(sizeof(FloatQuaternion) == sizeof(simd_quatf),
+	"FloatQuaternion's size does not match simd_quatf's on this platform.");
+static_assert(sizeof_member(FloatQuaternion, ix) == sizeof_member(simd_quatf, vector[0]),
+	"FloatQuaternion's first member's size does not match simd_quatf's first member's on this platform.");
+static_assert(alignof(FloatQuaternion) == alignof(simd_quatf),
+	"FloatQuaternion's alignment requirements does not match simd_quatf's on this platform.");
+
+
+
+#pragma mark Float3x3 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Float3x3, m00) == sizeof(simd_float1),
+	"Float3x3's first member's size does not match simd_float1's on this platform.");
+static_assert((offsetof(Float3x3, m10) - offsetof(Float3x3, m00)) == sizeof(simd_float3),
+	"Float3x3's 1st column's size does not match simd_float3's on this platform.");
+static_assert((offsetof(Float3x3, m20) - offsetof(Float3x3, m10)) == sizeof(simd_float3),
+	"Float3x3's 2nd column's size does not match simd_float3's on this platform.");
+static_assert((sizeof(Float3x3) - offsetof(Float3x3, m20)) == sizeof(simd_float3),
+	"Float3x3's 3rd column's size does not match simd_float3's on this platform.");
+static_assert(sizeof_member(Float3x3, m00) == sizeof_member(simd_float3x3, columns[0][0]),
+	"Float3x3's first member's size does not match simd_float3x3's first member's on this platform.");
+static_assert(sizeof(Float3x3) == sizeof(simd_float3x3),
+	"Float3x3's size does not match simd_float3x3's on this platform.");
+static_assert(alignof(Float3x3) == alignof(simd_float3x3),
+	"Float3x3's alignment requirements does not match simd_float3x3's on this platform.");
+
+
+
+#pragma mark Float4x4 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Float4x4, m00) == sizeof(simd_float1),
+	"Float4x4's first member's size does not match simd_float1's on this platform.");
+static_assert((offsetof(Float4x4, m10) - offsetof(Float4x4, m00)) == sizeof(simd_float4),
+	"Float4x4's 1st column's size does not match simd_float4's on this platform.");
+static_assert((offsetof(Float4x4, m20) - offsetof(Float4x4, m10)) == sizeof(simd_float4),
+	"Float4x4's 2nd column's size does not match simd_float4's on this platform.");
+static_assert((offsetof(Float4x4, m30) - offsetof(Float4x4, m20)) == sizeof(simd_float4),
+	"Float4x4's 3rd column's size does not match simd_float4's on this platform.");
+static_assert((sizeof(Float4x4) - offsetof(Float4x4, m30)) == sizeof(simd_float4),
+	"Float4x4's 4th column's size does not match simd_float4's on this platform.");
+static_assert(sizeof_member(Float4x4, m00) == sizeof_member(simd_float4x4, columns[0][0]),
+	"Float4x4's first member's size does not match simd_float4x4's first member's on this platform.");
+static_assert(sizeof(Float4x4) == sizeof(simd_float4x4),
+	"Float4x4's size does not match simd_float4x4's on this platform.");
+static_assert(alignof(Float4x4) == alignof(simd_float4x4),
+	"Float4x4's alignment requirements does not match simd_float4x4's on this platform.");
+
+
+
+#pragma mark PackedFloat3 Struct Data Size/Alignment Sanity Checks
+
+static_assert(sizeof(PackedFloat3) == 3 * sizeof(float),
+	"PackedFloat3 is not tightly packed on this platform.");
+static_assert(alignof(PackedFloat3) == alignof(float),
+	"PackedFloat3's alignment requirements do not match float's on this platform.");
+static_assert(offsetof(PackedFloat3, y) == sizeof(float) && offsetof(PackedFloat3, z) == 2 * sizeof(float),
+	"PackedFloat3's members are not contiguous on this platform.");
+
+
+
+#pragma mark Float4x3 Struct Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Float4x3, m00) == sizeof(simd_float1),
+	"Float4x3's first member's size does not match simd_float1's on this platform.");
+static_assert((offsetof(Float4x3, m01) - offsetof(Float4x3, m00)) == sizeof(simd_float4),
+	"Float4x3's 1st row's size does not match simd_float4's on this platform.");
+static_assert((offsetof(Float4x3, m02) - offsetof(Float4x3, m01)) == sizeof(simd_float4),
+	"Float4x3's 2nd row's size does not match simd_float4's on this platform.");
+static_assert((sizeof(Float4x3) - offsetof(Float4x3, m02)) == sizeof(simd_float4),
+	"Float4x3's 3rd row's size does not match simd_float4's on this platform.");
+static_assert(sizeof(Float4x3) == 3 * sizeof(simd_float4),
+	"Float4x3's size is not 3 simd_float4 rows' on this platform.");
+static_assert(alignof(Float4x3) == alignof(simd_float4),
+	"Float4x3's alignment requirements does not match simd_float4's on this platform.");
+
+
+
+#pragma mark Char4 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Char4, x) == sizeof(simd_char1),
+	"Char4's first member's size does not match simd_char1's on this platform.");
+static_assert(sizeof(Char4) == sizeof(simd_char4),
+	"Char4's size does not match simd_char4's on this platform.");
+static_assert(sizeof_member(Char4, x) == sizeof((*(simd_char4 *)0)[0]),
+	"Char4's first member's size does not match simd_char4's first member's on this platform.");
+static_assert(alignof(Char4) == alignof(simd_char4),
+	"Char4's alignment requirements does not match simd_char4's on this platform.");
+
+
+
+#pragma mark UChar4 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(UChar4, x) == sizeof(simd_uchar1),
+	"UChar4's first member's size does not match simd_uchar1's on this platform.");
+static_assert(sizeof(UChar4) == sizeof(simd_uchar4),
+	"UChar4's size does not match simd_uchar4's on this platform.");
+static_assert(sizeof_member(UChar4, x) == sizeof((*(simd_uchar4 *)0)[0]),
+	"UChar4's first member's size does not match simd_uchar4's first member's on this platform.");
+static_assert(alignof(UChar4) == alignof(simd_uchar4),
+	"UChar4's alignment requirements does not match simd_uchar4's on this platform.");
+
+
+
+#pragma mark Short2 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Short2, x) == sizeof(simd_short1),
+	"Short2's first member's size does not match simd_short1's on this platform.");
+static_assert(sizeof(Short2) == sizeof(simd_short2),
+	"Short2's size does not match simd_short2's on this platform.");
+static_assert(sizeof_member(Short2, x) == sizeof((*(simd_short2 *)0)[0]),
+	"Short2's first member's size does not match simd_short2's first member's on this platform.");
+static_assert(alignof(Short2) == alignof(simd_short2),
+	"Short2's alignment requirements does not match simd_short2's on this platform.");
+
+
+
+#pragma mark Short3 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Short3, x) == sizeof(simd_short1),
+	"Short3's first member's size does not match simd_short1's on this platform.");
+static_assert(sizeof(Short3) == sizeof(simd_short3),
+	"Short3's size does not match simd_short3's on this platform.");
+static_assert(sizeof_member(Short3, x) == sizeof((*(simd_short3 *)0)[0]),
+	"Short3's first member's size does not match simd_short3's first member's on this platform.");
+static_assert(alignof(Short3) == alignof(simd_short3),
+	"Short3's alignment requirements does not match simd_short3's on this platform.");
+
+
+
+#pragma mark Short4 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Short4, x) == sizeof(simd_short1),
+	"Short4's first member's size does not match simd_short1's on this platform.");
+static_assert(sizeof(Short4) == sizeof(simd_short4),
+	"Short4's size does not match simd_short4's on this platform.");
+static_assert(sizeof_member(Short4, x) == sizeof((*(simd_short4 *)0)[0]),
+	"Short4's first member's size does not match simd_short4's first member's on this platform.");
+static_assert(alignof(Short4) == alignof(simd_short4),
+	"Short4's alignment requirements does not match simd_short4's on this platform.");
+
+
+
+#pragma mark UShort4 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(UShort4, x) == sizeof(simd_ushort1),
+	"UShort4's first member's size does not match simd_ushort1's on this platform.");
+static_assert(sizeof(UShort4) == sizeof(simd_ushort4),
+	"UShort4's size does not match simd_ushort4's on this platform.");
+static_assert(sizeof_member(UShort4, x) == sizeof((*(simd_ushort4 *)0)[0]),
+	"UShort4's first member's size does not match simd_ushort4's first member's on this platform.");
+static_assert(alignof(UShort4) == alignof(simd_ushort4),
+	"UShort4's alignment requirements does not match simd_ushort4's on this platform.");
+
+
+
+#pragma mark Half2 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Half2, x) == sizeof(simd_ushort1),
+	"Half2's first member's size does not match simd_ushort1's on this platform.");
+static_assert(sizeof(Half2) == sizeof(simd_ushort2),
+	"Half2's size does not match simd_ushort2's on this platform.");
+static_assert(sizeof_member(Half2, x) == sizeof((*(simd_ushort2 *)0)[0]),
+	"Half2's first member's size does not match simd_ushort2's first member's on this platform.");
+static_assert(alignof(Half2) == alignof(simd_ushort2),
+	"Half2's alignment requirements does not match simd_ushort2's on this platform.");
+static_assert(sizeof(Half2) / sizeof(unsigned short) == sizeof(Float2) / sizeof(float),
+	"Half2's lane count does not match Float2's on this platform (which the bulk conversions rely on).");
+
+
+
+#pragma mark Half3 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Half3, x) == sizeof(simd_ushort1),
+	"Half3's first member's size does not match simd_ushort1's on this platform.");
+static_assert(sizeof(Half3) == sizeof(simd_ushort3),
+	"Half3's size does not match simd_ushort3's on this platform.");
+static_assert(sizeof_member(Half3, x) == sizeof((*(simd_ushort3 *)0)[0]),
+	"Half3's first member's size does not match simd_ushort3's first member's on this platform.");
+static_assert(alignof(Half3) == alignof(simd_ushort3),
+	"Half3's alignment requirements does not match simd_ushort3's on this platform.");
+static_assert(sizeof(Half3) / sizeof(unsigned short) == sizeof(Float3) / sizeof(float),
+	"Half3's lane count does not match Float3's on this platform (which the bulk conversions rely on).");
+
+
+
+#pragma mark Half4 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Half4, x) == sizeof(simd_ushort1),
+	"Half4's first member's size does not match simd_ushort1's on this platform.");
+static_assert(sizeof(Half4) == sizeof(simd_ushort4),
+	"Half4's size does not match simd_ushort4's on this platform.");
+static_assert(sizeof_member(Half4, x) == sizeof((*(simd_ushort4 *)0)[0]),
+	"Half4's first member's size does not match simd_ushort4's first member's on this platform.");
+static_assert(alignof(Half4) == alignof(simd_ushort4),
+	"Half4's alignment requirements does not match simd_ushort4's on this platform.");
+static_assert(sizeof(Half4) / sizeof(unsigned short) == sizeof(Float4) / sizeof(float),
+	"Half4's lane count does not match Float4's on this platform (which the bulk conversions rely on).");
+
+
+#pragma mark Double2 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Double2, x) == sizeof(simd_double1),
+	"Double2's first member's size does not match simd_double1's on this platform.");
+static_assert(sizeof(Double2) == sizeof(simd_double2),
+	"Double2's size does not match simd_double2's on this platform.");
+static_assert(sizeof_member(Double2, x) == sizeof((*(simd_double2 *)0)[0]),
+	"Double2's first member's size does not match simd_double2's first member's on this platform.");
+static_assert(alignof(Double2) == alignof(simd_double2),
+	"Double2's alignment requirements does not match simd_double2's on this platform.");
+static_assert(sizeof(Double2) / sizeof(double) == sizeof(Float2) / sizeof(float),
+	"Double2's lane count does not match Float2's on this platform (which the bulk conversions rely on).");
+
+
+#pragma mark Double3 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Double3, x) == sizeof(simd_double1),
+	"Double3's first member's size does not match simd_double1's on this platform.");
+static_assert(sizeof(Double3) == sizeof(simd_double3),
+	"Double3's size does not match simd_double3's on this platform.");
+static_assert(sizeof_member(Double3, x) == sizeof((*(simd_double3 *)0)[0]),
+	"Double3's first member's size does not match simd_double3's first member's on this platform.");
+static_assert(alignof(Double3) == alignof(simd_double3),
+	"Double3's alignment requirements does not match simd_double3's on this platform.");
+static_assert(sizeof(Double3) / sizeof(double) == sizeof(Float3) / sizeof(float),
+	"Double3's lane count does not match Float3's on this platform (which the bulk conversions rely on).");
+
+
+#pragma mark Double4 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Double4, x) == sizeof(simd_double1),
+	"Double4's first member's size does not match simd_double1's on this platform.");
+static_assert(sizeof(Double4) == sizeof(simd_double4),
+	"Double4's size does not match simd_double4's on this platform.");
+static_assert(sizeof_member(Double4, x) == sizeof((*(simd_double4 *)0)[0]),
+	"Double4's first member's size does not match simd_double4's first member's on this platform.");
+static_assert(alignof(Double4) == alignof(simd_double4),
+	"Double4's alignment requirements does not match simd_double4's on this platform.");
+static_assert(sizeof(Double4) / sizeof(double) == sizeof(Float4) / sizeof(float),
+	"Double4's lane count does not match Float4's on this platform (which the bulk conversions rely on).");
+
+
+#pragma mark Double4x4 Struct↔SIMD Data Size/Alignment Sanity Checks
+
+static_assert(sizeof_member(Double4x4, m00) == sizeof(simd_double1),
+	"Double4x4's first member's size does not match simd_double1's on this platform.");
+static_assert((offsetof(Double4x4, m10) - offsetof(Double4x4, m00)) == sizeof(simd_double4),
+	"Double4x4's 1st column's size does not match simd_double4's on this platform.");
+static_assert((offsetof(Double4x4, m20) - offsetof(Double4x4, m10)) == sizeof(simd_double4),
+	"Double4x4's 2nd column's size does not match simd_double4's on this platform.");
+static_assert((offsetof(Double4x4, m30) - offsetof(Double4x4, m20)) == sizeof(simd_double4),
+	"Double4x4's 3rd column's size does not match simd_double4's on this platform.");
+static_assert((sizeof(Double4x4) - offsetof(Double4x4, m30)) == sizeof(simd_double4),
+	"Double4x4's 4th column's size does not match simd_double4's on this platform.");
+static_assert(sizeof_member(Double4x4, m00) == sizeof_member(simd_double4x4, columns[0][0]),
+	"Double4x4's first member's size does not match simd_double4x4's first member's on this platform.");
+static_assert(sizeof(Double4x4) == sizeof(simd_double4x4),
+	"Double4x4's size does not match simd_double4x4's on this platform.");
+static_assert(alignof(Double4x4) == alignof(simd_double4x4),
+	"Double4x4's alignment requirements does not match simd_double4x4's on this platform.");
+
+
+
+#pragma mark AABB3 Struct Layout Sanity Checks
+
+static_assert(offsetof(AABB3, max) == sizeof(simd_float4),
+	"AABB3's max corner does not start 1 simd_float4 in on this platform (which the lane loads rely on).");
+static_assert(sizeof(AABB3) == 2 * sizeof(simd_float4),
+	"AABB3's size does not match 2 simd_float4s' on this platform (which the lane loads rely on).");
+
+
+
+#pragma mark Ray3 Struct Layout Sanity Checks
+
+static_assert(offsetof(Ray3, direction) == sizeof(simd_float4),
+	"Ray3's direction does not start 1 simd_float4 in on this platform (which the lane loads rely on).");
+static_assert(sizeof(Ray3) == 2 * sizeof(simd_float4),
+	"Ray3's size does not match 2 simd_float4s' on this platform (which the lane loads rely on).");
+
+
+
+#pragma mark BVH Struct Layout Sanity Checks
+
+static_assert(sizeof(BVHNode) == 32,
+	"BVHNode's size is not 32 bytes on this platform (which keeps two nodes to a cache line).");
+static_assert(offsetof(BVHNode, minX) == 0,
+	"BVHNode's min corner does not start at its beginning on this platform (which the bounds' lane loads rely on).");
+static_assert(offsetof(BVHNode, maxX) == sizeof(simd_float4),
+	"BVHNode's max corner does not start 1 simd_float4 in on this platform (which the bounds' lane loads rely on).");
+
+
+
+#pragma mark ArrayFile Struct Layout Sanity Checks
+
+static_assert(sizeof(ArrayFileHeader) == VUCKT_ARRAY_FILE_HEADER_SIZE,
+	"ArrayFileHeader's size does not match the format's header size on this platform.");
+static_assert(offsetof(ArrayFileHeader, count) == 32 && offsetof(ArrayFileHeader, dataOffset) == 40,
+	"ArrayFileHeader's 64-bit fields are not at the format's offsets on this platform.");
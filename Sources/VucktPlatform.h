@@ -0,0 +1,961 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+#pragma once
+
+#ifdef __cplusplus
+	#include <cstddef>
+#else
+	#include <stddef.h>
+	#include <stdbool.h>
+#endif
+#include <math.h>
+#include <string.h>
+
+#if __APPLE__
+	#import <TargetConditionals.h>
+#endif
+
+#if __has_include(<simd/simd.h>)
+	#import <simd/simd.h>
+	#define VUCKT_PORTABLE_SIMD 0
+#else
+	#define VUCKT_PORTABLE_SIMD 1
+#endif
+
+#if defined(__SSE__)
+	#include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+	#include <arm_neon.h>
+#endif
+#if defined(__F16C__) || defined(__BMI2__) || ((defined(__x86_64__) || defined(__i386__)) && (__GNUC__ || __clang__))
+	#include <immintrin.h>
+#endif
+
+
+
+#pragma mark Foundation Macro Fallbacks & Compiler Hints
+
+// Vuckt's headers are written against Foundation's macros; these stand in for them wherever Foundation isn't available (Linux, or plain-C translation units on Apple platforms).
+
+#ifndef NS_INLINE
+	#define NS_INLINE static inline __attribute__((always_inline))
+#endif
+
+#ifndef NS_ASSUME_NONNULL_BEGIN
+	#if __clang__
+		#define NS_ASSUME_NONNULL_BEGIN _Pragma("clang assume_nonnull begin")
+		#define NS_ASSUME_NONNULL_END _Pragma("clang assume_nonnull end")
+	#else
+		#define NS_ASSUME_NONNULL_BEGIN
+		#define NS_ASSUME_NONNULL_END
+	#endif
+#endif
+
+#ifndef sizeof_member
+	#define sizeof_member(type, member) \
+		sizeof(((type *)0)->member)
+#endif
+
+/// Marks a pointer parameter as optional (imported into Swift as an `Optional`) within an `NS_ASSUME_NONNULL` region.  (Only Clang has nullability qualifiers.)
+#if __clang__
+	#define VUCKT_NULLABLE _Nullable
+#else
+	#define VUCKT_NULLABLE
+#endif
+
+/// Bracket each Vuckt header's declarations (just inside its `NS_ASSUME_NONNULL_BEGIN`/`END`), so the warnings Vuckt's own code needs silenced stay silenced only there.
+/// (GCC's `-Wpsabi`, for now: see the portable SIMD types below.  Without AVX, GCC also reports it at the including file's first call returning each `double` vector type, outside this scope, & prints a one-time note on the first function passing a `Double3` (32-byte aligned) by value, which no pragma (nor `-w`) reaches; so such files need their own `-Wno-psabi`, or that pragma ahead of their includes for the former.)
+#if __GNUC__ && !__clang__
+	#define VUCKT_DIAGNOSTICS_BEGIN _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Wpsabi\"")
+	#define VUCKT_DIAGNOSTICS_END _Pragma("GCC diagnostic pop")
+#else
+	#define VUCKT_DIAGNOSTICS_BEGIN
+	#define VUCKT_DIAGNOSTICS_END
+#endif
+
+VUCKT_DIAGNOSTICS_BEGIN
+
+/// Marks the following loop's iterations as independent of one another (iteration `i` reads only index `i` of its inputs & writes only index `i` of its output), so the compiler can vectorize & interleave it without runtime overlap checks.
+#if __clang__
+	#define VUCKT_INDEPENDENT_LOOP _Pragma("clang loop vectorize(assume_safety) interleave(enable)")
+#elif __GNUC__
+	#define VUCKT_INDEPENDENT_LOOP _Pragma("GCC ivdep")
+#else
+	#define VUCKT_INDEPENDENT_LOOP
+#endif
+
+/// Whether the 3-element types' array kernels step through 2 elements at a time, as one 8-lane vector (a full AVX register; a pair of SSE or NEON ones).
+/// Always so with Clang, which splits 8-lane vectors into register pairs where it must; with GCC only given AVX, since without it GCC round-trips 32-byte vectors through the stack.
+#if __clang__ || defined(__AVX__)
+	#define VUCKT_PAIRED_ARRAY_LANES 1
+#else
+	#define VUCKT_PAIRED_ARRAY_LANES 0
+#endif
+
+/// Placed first in a function body, keeps the compiler from fusing that body's multiplies & adds into FMAs (as Clang otherwise does within an expression), so it rounds exactly as written— & so identically to another function doing the same arithmetic in another form (e.g. scalar vs. 4-lane).
+/// (GCC fuses across expressions in its GNU C dialects & in C++, & has no per-block switch— its `optimize("fp-contract=off")` attribute is lost once the function is inlined; build with `-ffp-contract=off` there, or an ISO C dialect, to get the same guarantee.)
+#if __clang__
+	#define VUCKT_NO_FP_CONTRACT _Pragma("clang fp contract(off)")
+#else
+	#define VUCKT_NO_FP_CONTRACT
+#endif
+
+/// Runs the statement `...` over an `n`-element batch 4 elements at a time, with `i` (the block's first index) & `count` (its element count) in scope: `count` is a constant 4 for every full block, so the lane loads & stores within compile to whole-vector moves, then 1–3 for the final partial block, if any.
+#define VUCKT_FOR_EACH_BLOCK4(n, i, count, ...) \
+	do { \
+		size_t i = 0; \
+		for (; i + 4 <= (n); i += 4) { const size_t count = 4; __VA_ARGS__; } \
+		if (i < (n)) { const size_t count = (n) - i; __VA_ARGS__; } \
+	} while (0)
+/// `VUCKT_FOR_EACH_BLOCK4()`, 8 elements at a time (`count` being 1–7 for the final partial block), for kernels that run each block as two 4-lane halves.
+#define VUCKT_FOR_EACH_BLOCK8(n, i, count, ...) \
+	do { \
+		size_t i = 0; \
+		for (; i + 8 <= (n); i += 8) { const size_t count = 8; __VA_ARGS__; } \
+		if (i < (n)) { const size_t count = (n) - i; __VA_ARGS__; } \
+	} while (0)
+
+/// `sqrtf()` without the `errno` side effect where the compiler offers one, so loops calling it can still vectorize under `-fmath-errno` (the default on Linux).
+#if defined(__has_builtin) && __has_builtin(__builtin_elementwise_sqrt)
+	#define vuckt_sqrtf(x) __builtin_elementwise_sqrt((float)(x))
+#else
+	#define vuckt_sqrtf(x) sqrtf(x)
+#endif
+
+
+
+#if !VUCKT_PORTABLE_SIMD
+	#pragma mark Apple SIMD Shims
+
+	/// Element-wise floating-point modulus of two simd vectors.
+	#ifdef __cplusplus
+		#define vuckt_simd_fmod(a, b) simd::fmod(a, b)
+	#else
+		#define vuckt_simd_fmod(a, b) fmod(a, b)
+	#endif
+
+	#define VUCKT_SIMD3_IS_SIMD4 0
+
+	#define VUCKT_SIMD_MAY_ALIAS
+
+#else // VUCKT_PORTABLE_SIMD
+	#pragma mark Portable SIMD Types
+
+	// Mirrors the subset of `<simd/simd.h>` that Vuckt uses, built on the compiler's own vector extensions so the same `*ToSimd()`/`*FromSimd()` casts & operators compile unchanged.
+	// Sizes & alignments match Apple's types (3-element vectors are 16 bytes, 16-byte aligned), which the `static_assert`s in `VucktC/Vuckt.c` verify.
+	// Everything is declared with a `vuckt_` prefix and `#define`d to its Apple name, so Swift (which ignores such macros) sees no clash with its own `simd_*` names.
+
+	#if __clang__
+		typedef float vuckt_simd_float1;
+		typedef float vuckt_simd_float2 __attribute__((ext_vector_type(2)));
+		typedef float vuckt_simd_float3 __attribute__((ext_vector_type(3)));
+		typedef float vuckt_simd_float4 __attribute__((ext_vector_type(4)));
+		typedef float vuckt_simd_float8 __attribute__((ext_vector_type(8)));
+		typedef int vuckt_simd_int1;
+		typedef int vuckt_simd_int2 __attribute__((ext_vector_type(2)));
+		typedef int vuckt_simd_int3 __attribute__((ext_vector_type(3)));
+		typedef int vuckt_simd_int4 __attribute__((ext_vector_type(4)));
+		typedef int vuckt_simd_int8 __attribute__((ext_vector_type(8)));
+		typedef signed char vuckt_simd_char1;
+		typedef signed char vuckt_simd_char4 __attribute__((ext_vector_type(4)));
+		typedef unsigned char vuckt_simd_uchar1;
+		typedef unsigned char vuckt_simd_uchar4 __attribute__((ext_vector_type(4)));
+		typedef short vuckt_simd_short1;
+		typedef short vuckt_simd_short2 __attribute__((ext_vector_type(2)));
+		typedef short vuckt_simd_short3 __attribute__((ext_vector_type(3)));
+		typedef short vuckt_simd_short4 __attribute__((ext_vector_type(4)));
+		typedef short vuckt_simd_short8 __attribute__((ext_vector_type(8)));
+		typedef unsigned short vuckt_simd_ushort1;
+		typedef unsigned short vuckt_simd_ushort2 __attribute__((ext_vector_type(2)));
+		typedef unsigned short vuckt_simd_ushort3 __attribute__((ext_vector_type(3)));
+		typedef unsigned short vuckt_simd_ushort4 __attribute__((ext_vector_type(4)));
+		typedef double vuckt_simd_double1;
+		typedef double vuckt_simd_double2 __attribute__((ext_vector_type(2)));
+		typedef double vuckt_simd_double3 __attribute__((ext_vector_type(3)));
+		typedef double vuckt_simd_double4 __attribute__((ext_vector_type(4)));
+		typedef long vuckt_simd_long1;
+		typedef long vuckt_simd_long2 __attribute__((ext_vector_type(2)));
+		typedef long vuckt_simd_long3 __attribute__((ext_vector_type(3)));
+		typedef long vuckt_simd_long4 __attribute__((ext_vector_type(4)));
+
+		#define VUCKT_SIMD3_IS_SIMD4 0
+
+		#define VUCKT_SIMD_MAY_ALIAS
+	#elif __GNUC__
+		// GCC's `vector_size` only allows power-of-2 lane counts, so 3-element vectors are 4-lane vectors (the same storage Apple's use).
+		// The 4th lane is kept a copy of the 3rd (see `Float3ToSimd()`/`Int3ToSimd()`), so whole-vector comparisons, divisions, & reductions stay correct.
+		// Those conversions copy the struct's full (padded) width in & out via `memcpy`— which GCC keeps in registers— then mirror the 3rd lane into the 4th; going member-wise instead costs a lane insert/extract per member, and a pointer-cast has GCC round-trip the padding through memory.
+		// The exception is a 3-element struct local carried from one loop iteration to the next (e.g. an accumulator): GCC keeps it on the stack as an 8-byte & a 4-byte store, so each conversion back to a vector stalls on store-forwarding, & such a loop runs several times slower than the member-wise equivalent.
+		// The 32-byte vectors (`double` ones, & the 8-lane `float` & `int` ones) would have GCC warn (without AVX) that passing them changes the ABI; every Vuckt function is `static inline`, so no such call crosses a translation unit, & `VUCKT_DIAGNOSTICS_BEGIN`/`END` silence that warning within Vuckt's headers (only).
+		// They're also explicitly 32-byte aligned, as Apple's are, since without AVX GCC's `_Alignof` reports only 16.
+		typedef float vuckt_simd_float1;
+		typedef float vuckt_simd_float2 __attribute__((vector_size(8)));
+		typedef float vuckt_simd_float3 __attribute__((vector_size(16)));
+		typedef float vuckt_simd_float4 __attribute__((vector_size(16)));
+		typedef float vuckt_simd_float8 __attribute__((vector_size(32), aligned(32)));
+		typedef int vuckt_simd_int1;
+		typedef int vuckt_simd_int2 __attribute__((vector_size(8)));
+		typedef int vuckt_simd_int3 __attribute__((vector_size(16)));
+		typedef int vuckt_simd_int4 __attribute__((vector_size(16)));
+		typedef int vuckt_simd_int8 __attribute__((vector_size(32), aligned(32)));
+		typedef signed char vuckt_simd_char1;
+		typedef signed char vuckt_simd_char4 __attribute__((vector_size(4)));
+		typedef unsigned char vuckt_simd_uchar1;
+		typedef unsigned char vuckt_simd_uchar4 __attribute__((vector_size(4)));
+		typedef short vuckt_simd_short1;
+		typedef short vuckt_simd_short2 __attribute__((vector_size(4)));
+		typedef short vuckt_simd_short3 __attribute__((vector_size(8)));
+		typedef short vuckt_simd_short4 __attribute__((vector_size(8)));
+		typedef short vuckt_simd_short8 __attribute__((vector_size(16)));
+		typedef unsigned short vuckt_simd_ushort1;
+		typedef unsigned short vuckt_simd_ushort2 __attribute__((vector_size(4)));
+		typedef unsigned short vuckt_simd_ushort3 __attribute__((vector_size(8)));
+		typedef unsigned short vuckt_simd_ushort4 __attribute__((vector_size(8)));
+		typedef double vuckt_simd_double1;
+		typedef double vuckt_simd_double2 __attribute__((vector_size(16)));
+		typedef double vuckt_simd_double3 __attribute__((vector_size(32), aligned(32)));
+		typedef double vuckt_simd_double4 __attribute__((vector_size(32), aligned(32)));
+		typedef long vuckt_simd_long1;
+		typedef long vuckt_simd_long2 __attribute__((vector_size(16)));
+		typedef long vuckt_simd_long3 __attribute__((vector_size(32), aligned(32)));
+		typedef long vuckt_simd_long4 __attribute__((vector_size(32), aligned(32)));
+
+		#define VUCKT_SIMD3_IS_SIMD4 1
+
+		/// Marks Vuckt's multi-vector structs (matrices, quaternions) as aliasing their simd counterparts, which GCC's strict-aliasing analysis otherwise flags in `*FromSimd()`.
+		#define VUCKT_SIMD_MAY_ALIAS __attribute__((__may_alias__))
+	#else
+		#error "Vuckt's portable SIMD backend requires Clang's or GCC's vector extensions."
+	#endif
+
+	// `__may_alias__` since Vuckt's structs are converted to & from these by pointer-cast.
+	typedef struct { vuckt_simd_float3 columns[3]; } __attribute__((__may_alias__)) vuckt_simd_float3x3;
+	typedef struct { vuckt_simd_float4 columns[4]; } __attribute__((__may_alias__)) vuckt_simd_float4x4;
+	typedef struct { vuckt_simd_float4 vector; } __attribute__((__may_alias__)) vuckt_simd_quatf;
+	typedef struct { vuckt_simd_double4 columns[4]; } __attribute__((__may_alias__)) vuckt_simd_double4x4;
+
+	#define simd_float1 vuckt_simd_float1
+	#define simd_float2 vuckt_simd_float2
+	#define simd_float3 vuckt_simd_float3
+	#define simd_float4 vuckt_simd_float4
+	#define simd_float8 vuckt_simd_float8
+	#define simd_int1 vuckt_simd_int1
+	#define simd_int2 vuckt_simd_int2
+	#define simd_int3 vuckt_simd_int3
+	#define simd_int4 vuckt_simd_int4
+	#define simd_int8 vuckt_simd_int8
+	#define simd_char1 vuckt_simd_char1
+	#define simd_char4 vuckt_simd_char4
+	#define simd_uchar1 vuckt_simd_uchar1
+	#define simd_uchar4 vuckt_simd_uchar4
+	#define simd_short1 vuckt_simd_short1
+	#define simd_short2 vuckt_simd_short2
+	#define simd_short3 vuckt_simd_short3
+	#define simd_short4 vuckt_simd_short4
+	#define simd_short8 vuckt_simd_short8
+	#define simd_ushort1 vuckt_simd_ushort1
+	#define simd_ushort2 vuckt_simd_ushort2
+	#define simd_ushort3 vuckt_simd_ushort3
+	#define simd_ushort4 vuckt_simd_ushort4
+	#define simd_double1 vuckt_simd_double1
+	#define simd_double2 vuckt_simd_double2
+	#define simd_double3 vuckt_simd_double3
+	#define simd_double4 vuckt_simd_double4
+	#define simd_long1 vuckt_simd_long1
+	#define simd_long2 vuckt_simd_long2
+	#define simd_long3 vuckt_simd_long3
+	#define simd_long4 vuckt_simd_long4
+	#define simd_float3x3 vuckt_simd_float3x3
+	#define simd_float4x4 vuckt_simd_float4x4
+	#define simd_quatf vuckt_simd_quatf
+	#define simd_double4x4 vuckt_simd_double4x4
+
+
+
+	#pragma mark Portable SIMD Functions
+
+	NS_INLINE bool vuckt_simd_all_int2(vuckt_simd_int2 x) {
+		return (x[0] & x[1]) < 0;
+	}
+	/// (On x86 & arm64, the lanes' sign bits are gathered in one instruction, rather than each lane being moved out & ANDed— which, for the comparisons feeding these, cost more than the comparison itself.)
+	NS_INLINE bool vuckt_simd_all_int4(vuckt_simd_int4 x) {
+		#if defined(__SSE__)
+			return _mm_movemask_ps((__m128)x) == 0xF;
+		#elif defined(__aarch64__) && defined(__ARM_NEON)
+			return (vminvq_s32((int32x4_t)x)) < 0;
+		#else
+			return (x[0] & x[1] & x[2] & x[3]) < 0;
+		#endif
+	}
+	#if !VUCKT_SIMD3_IS_SIMD4
+		NS_INLINE bool vuckt_simd_all_int3(vuckt_simd_int3 x) {
+			return (x[0] & x[1] & x[2]) < 0;
+		}
+	#endif
+	NS_INLINE bool vuckt_simd_all_long2(vuckt_simd_long2 x) {
+		return (x[0] & x[1]) < 0;
+	}
+	NS_INLINE bool vuckt_simd_all_long4(vuckt_simd_long4 x) {
+		return (x[0] & x[1] & x[2] & x[3]) < 0;
+	}
+	#if !VUCKT_SIMD3_IS_SIMD4
+		NS_INLINE bool vuckt_simd_all_long3(vuckt_simd_long3 x) {
+			return (x[0] & x[1] & x[2]) < 0;
+		}
+	#endif
+
+	NS_INLINE vuckt_simd_float2 vuckt_simd_fmod_float2(vuckt_simd_float2 a, vuckt_simd_float2 b) {
+		return (vuckt_simd_float2){ fmodf(a[0], b[0]), fmodf(a[1], b[1]) };
+	}
+	NS_INLINE vuckt_simd_float4 vuckt_simd_fmod_float4(vuckt_simd_float4 a, vuckt_simd_float4 b) {
+		return (vuckt_simd_float4){ fmodf(a[0], b[0]), fmodf(a[1], b[1]), fmodf(a[2], b[2]), fmodf(a[3], b[3]) };
+	}
+	#if !VUCKT_SIMD3_IS_SIMD4
+		NS_INLINE vuckt_simd_float3 vuckt_simd_fmod_float3(vuckt_simd_float3 a, vuckt_simd_float3 b) {
+			return (vuckt_simd_float3){ fmodf(a[0], b[0]), fmodf(a[1], b[1]), fmodf(a[2], b[2]) };
+		}
+	#endif
+	NS_INLINE vuckt_simd_double2 vuckt_simd_fmod_double2(vuckt_simd_double2 a, vuckt_simd_double2 b) {
+		return (vuckt_simd_double2){ fmod(a[0], b[0]), fmod(a[1], b[1]) };
+	}
+	NS_INLINE vuckt_simd_double4 vuckt_simd_fmod_double4(vuckt_simd_double4 a, vuckt_simd_double4 b) {
+		return (vuckt_simd_double4){ fmod(a[0], b[0]), fmod(a[1], b[1]), fmod(a[2], b[2]), fmod(a[3], b[3]) };
+	}
+	#if !VUCKT_SIMD3_IS_SIMD4
+		NS_INLINE vuckt_simd_double3 vuckt_simd_fmod_double3(vuckt_simd_double3 a, vuckt_simd_double3 b) {
+			return (vuckt_simd_double3){ fmod(a[0], b[0]), fmod(a[1], b[1]), fmod(a[2], b[2]) };
+		}
+	#endif
+
+	NS_INLINE vuckt_simd_float3 vuckt_simd_cross(vuckt_simd_float3 a, vuckt_simd_float3 b) {
+		float x = a[1] * b[2] - a[2] * b[1], y = a[2] * b[0] - a[0] * b[2], z = a[0] * b[1] - a[1] * b[0];
+		#if VUCKT_SIMD3_IS_SIMD4
+			return (vuckt_simd_float3){ x, y, z, z };
+		#else
+			return (vuckt_simd_float3){ x, y, z };
+		#endif
+	}
+
+	NS_INLINE vuckt_simd_float3x3 vuckt_simd_matrix3(vuckt_simd_float3 col0, vuckt_simd_float3 col1, vuckt_simd_float3 col2) {
+		vuckt_simd_float3x3 result = { { col0, col1, col2 } };
+		return result;
+	}
+	NS_INLINE vuckt_simd_float4x4 vuckt_simd_matrix4(vuckt_simd_float4 col0, vuckt_simd_float4 col1, vuckt_simd_float4 col2, vuckt_simd_float4 col3) {
+		vuckt_simd_float4x4 result = { { col0, col1, col2, col3 } };
+		return result;
+	}
+
+	#ifdef __cplusplus
+		NS_INLINE bool vuckt_simd_all(vuckt_simd_int2 x) { return vuckt_simd_all_int2(x); }
+		NS_INLINE bool vuckt_simd_all(vuckt_simd_int4 x) { return vuckt_simd_all_int4(x); }
+		NS_INLINE vuckt_simd_float2 vuckt_simd_fmod(vuckt_simd_float2 a, vuckt_simd_float2 b) { return vuckt_simd_fmod_float2(a, b); }
+		NS_INLINE vuckt_simd_float4 vuckt_simd_fmod(vuckt_simd_float4 a, vuckt_simd_float4 b) { return vuckt_simd_fmod_float4(a, b); }
+		NS_INLINE bool vuckt_simd_all(vuckt_simd_long2 x) { return vuckt_simd_all_long2(x); }
+		NS_INLINE bool vuckt_simd_all(vuckt_simd_long4 x) { return vuckt_simd_all_long4(x); }
+		NS_INLINE vuckt_simd_double2 vuckt_simd_fmod(vuckt_simd_double2 a, vuckt_simd_double2 b) { return vuckt_simd_fmod_double2(a, b); }
+		NS_INLINE vuckt_simd_double4 vuckt_simd_fmod(vuckt_simd_double4 a, vuckt_simd_double4 b) { return vuckt_simd_fmod_double4(a, b); }
+		#if !VUCKT_SIMD3_IS_SIMD4
+			NS_INLINE bool vuckt_simd_all(vuckt_simd_int3 x) { return vuckt_simd_all_int3(x); }
+			NS_INLINE vuckt_simd_float3 vuckt_simd_fmod(vuckt_simd_float3 a, vuckt_simd_float3 b) { return vuckt_simd_fmod_float3(a, b); }
+			NS_INLINE bool vuckt_simd_all(vuckt_simd_long3 x) { return vuckt_simd_all_long3(x); }
+			NS_INLINE vuckt_simd_double3 vuckt_simd_fmod(vuckt_simd_double3 a, vuckt_simd_double3 b) { return vuckt_simd_fmod_double3(a, b); }
+		#endif
+		NS_INLINE vuckt_simd_float3x3 vuckt_simd_matrix(vuckt_simd_float3 col0, vuckt_simd_float3 col1, vuckt_simd_float3 col2) { return vuckt_simd_matrix3(col0, col1, col2); }
+		NS_INLINE vuckt_simd_float4x4 vuckt_simd_matrix(vuckt_simd_float4 col0, vuckt_simd_float4 col1, vuckt_simd_float4 col2, vuckt_simd_float4 col3) { return vuckt_simd_matrix4(col0, col1, col2, col3); }
+	#else // !__cplusplus
+		#if !VUCKT_SIMD3_IS_SIMD4
+			#define vuckt_simd_all(x) _Generic((x), \
+				vuckt_simd_int2: vuckt_simd_all_int2, \
+				vuckt_simd_int3: vuckt_simd_all_int3, \
+				vuckt_simd_int4: vuckt_simd_all_int4, \
+				vuckt_simd_long2: vuckt_simd_all_long2, \
+				vuckt_simd_long3: vuckt_simd_all_long3, \
+				vuckt_simd_long4: vuckt_simd_all_long4 \
+			)(x)
+			#define vuckt_simd_fmod(a, b) _Generic((a), \
+				vuckt_simd_float2: vuckt_simd_fmod_float2, \
+				vuckt_simd_float3: vuckt_simd_fmod_float3, \
+				vuckt_simd_float4: vuckt_simd_fmod_float4, \
+				vuckt_simd_double2: vuckt_simd_fmod_double2, \
+				vuckt_simd_double3: vuckt_simd_fmod_double3, \
+				vuckt_simd_double4: vuckt_simd_fmod_double4 \
+			)(a, b)
+		#else
+			#define vuckt_simd_all(x) _Generic((x), \
+				vuckt_simd_int2: vuckt_simd_all_int2, \
+				vuckt_simd_int4: vuckt_simd_all_int4, \
+				vuckt_simd_long2: vuckt_simd_all_long2, \
+				vuckt_simd_long4: vuckt_simd_all_long4 \
+			)(x)
+			#define vuckt_simd_fmod(a, b) _Generic((a), \
+				vuckt_simd_float2: vuckt_simd_fmod_float2, \
+				vuckt_simd_float4: vuckt_simd_fmod_float4, \
+				vuckt_simd_double2: vuckt_simd_fmod_double2, \
+				vuckt_simd_double4: vuckt_simd_fmod_double4 \
+			)(a, b)
+		#endif
+		#define _vuckt_simd_matrix_select(_0, _1, _2, _3, name, ...) name
+		#define vuckt_simd_matrix(...) _vuckt_simd_matrix_select(__VA_ARGS__, vuckt_simd_matrix4, vuckt_simd_matrix3, _, _)(__VA_ARGS__)
+	#endif // !__cplusplus
+
+	#define simd_all vuckt_simd_all
+	#define simd_cross vuckt_simd_cross
+	#define simd_matrix vuckt_simd_matrix
+
+#endif // VUCKT_PORTABLE_SIMD
+
+
+
+#pragma mark Vector Shuffles
+
+/// Builds a 4-lane vector from lanes of the 4-lane vectors `a` & `b`: indices 0–3 select from `a`, 4–7 from `b`.
+#if __clang__ || __GNUC__ >= 12
+	#define vuckt_simd_shuffle4(a, b, i0, i1, i2, i3) __builtin_shufflevector((a), (b), i0, i1, i2, i3)
+#else
+	#define vuckt_simd_shuffle4(a, b, i0, i1, i2, i3) __builtin_shuffle((a), (b), (simd_int4){ i0, i1, i2, i3 })
+#endif
+
+/// Transposes the 4×4 block whose rows are `a`, `b`, `c`, & `d` in place (e.g. 4 quaternions ↔ their 4 components' lanes).
+NS_INLINE void vuckt_simd_transpose4(simd_float4 *a, simd_float4 *b, simd_float4 *c, simd_float4 *d) {
+	simd_float4 ab01 = vuckt_simd_shuffle4(*a, *b, 0, 4, 1, 5), cd01 = vuckt_simd_shuffle4(*c, *d, 0, 4, 1, 5);
+	simd_float4 ab23 = vuckt_simd_shuffle4(*a, *b, 2, 6, 3, 7), cd23 = vuckt_simd_shuffle4(*c, *d, 2, 6, 3, 7);
+	*a = vuckt_simd_shuffle4(ab01, cd01, 0, 1, 4, 5);
+	*b = vuckt_simd_shuffle4(ab01, cd01, 2, 3, 6, 7);
+	*c = vuckt_simd_shuffle4(ab23, cd23, 0, 1, 4, 5);
+	*d = vuckt_simd_shuffle4(ab23, cd23, 2, 3, 6, 7);
+}
+
+
+
+#pragma mark Vector Math
+
+/// Per lane, `ifTrue` where `mask` is all-ones (as vector comparisons produce) & `ifFalse` where it's zero.
+NS_INLINE simd_float4 vuckt_simd_select4(simd_int4 mask, simd_float4 ifTrue, simd_float4 ifFalse) {
+	return (simd_float4)(((simd_int4)ifTrue & mask) | ((simd_int4)ifFalse & ~mask));
+}
+
+/// `fabs(x)` per lane, by clearing the sign bits.
+NS_INLINE simd_float4 vuckt_simd_abs4(simd_float4 x) {
+	return (simd_float4)((simd_int4)x & 0x7FFFFFFF);
+}
+
+/// `sqrt(x)` per lane, as a single vector instruction where the target has one.
+NS_INLINE simd_float4 vuckt_simd_sqrt4(simd_float4 x) {
+	#if defined(__has_builtin) && __has_builtin(__builtin_elementwise_sqrt)
+		return __builtin_elementwise_sqrt(x);
+	#elif defined(__SSE__)
+		return (simd_float4)_mm_sqrt_ps((__m128)x);
+	#elif defined(__ARM_NEON) && defined(__aarch64__)
+		return (simd_float4)vsqrtq_f32((float32x4_t)x);
+	#else
+		return (simd_float4){ vuckt_sqrtf(x[0]), vuckt_sqrtf(x[1]), vuckt_sqrtf(x[2]), vuckt_sqrtf(x[3]) };
+	#endif
+}
+
+
+
+#pragma mark Integer Overflow Arithmetic
+
+// Kernels behind the `Int2`/`Int3`/`Int4` wrapping, overflow-reporting, & saturating operations (e.g. `Int4AddReportingOverflow()`), each a short branch-free vector sequence.
+// Wrapping math goes through unsigned lanes (signed vector overflow being as undefined as scalar), & overflow is reported as a per-lane mask: all-ones in the lanes that overflowed, as vector comparisons produce.
+// `Int3` goes through the 4-lane kernels, with its 4th lane a copy of its 3rd.
+
+typedef unsigned vuckt_simd_uint32x2 __attribute__((vector_size(8)));
+typedef unsigned vuckt_simd_uint32x4 __attribute__((vector_size(16)));
+typedef long long vuckt_simd_int64x2 __attribute__((vector_size(16)));
+typedef long long vuckt_simd_int64x4 __attribute__((vector_size(32)));
+
+/// `a + b` per lane, wrapping on overflow, with `*outOverflowMask` set in the lanes that overflowed.
+NS_INLINE simd_int2 vuckt_simd_add_overflow2(simd_int2 a, simd_int2 b, simd_int2 *outOverflowMask) {
+	simd_int2 sum = (simd_int2)((vuckt_simd_uint32x2)a + (vuckt_simd_uint32x2)b);
+	*outOverflowMask = ((a ^ sum) & (b ^ sum)) >> 31; // both operands' signs differ from the sum's
+	return sum;
+}
+NS_INLINE simd_int4 vuckt_simd_add_overflow4(simd_int4 a, simd_int4 b, simd_int4 *outOverflowMask) {
+	simd_int4 sum = (simd_int4)((vuckt_simd_uint32x4)a + (vuckt_simd_uint32x4)b);
+	*outOverflowMask = ((a ^ sum) & (b ^ sum)) >> 31;
+	return sum;
+}
+/// `a - b` per lane, wrapping on overflow, with `*outOverflowMask` set in the lanes that overflowed.
+NS_INLINE simd_int2 vuckt_simd_subtract_overflow2(simd_int2 a, simd_int2 b, simd_int2 *outOverflowMask) {
+	simd_int2 difference = (simd_int2)((vuckt_simd_uint32x2)a - (vuckt_simd_uint32x2)b);
+	*outOverflowMask = ((a ^ b) & (a ^ difference)) >> 31; // the operands' signs differ, & the difference's sign isn't `a`'s
+	return difference;
+}
+NS_INLINE simd_int4 vuckt_simd_subtract_overflow4(simd_int4 a, simd_int4 b, simd_int4 *outOverflowMask) {
+	simd_int4 difference = (simd_int4)((vuckt_simd_uint32x4)a - (vuckt_simd_uint32x4)b);
+	*outOverflowMask = ((a ^ b) & (a ^ difference)) >> 31;
+	return difference;
+}
+/// `a * b` per lane, wrapping on overflow, with `*outOverflowMask` set in the lanes that overflowed (whose full 64-bit product doesn't survive truncation to 32 bits).
+NS_INLINE simd_int2 vuckt_simd_multiply_overflow2(simd_int2 a, simd_int2 b, simd_int2 *outOverflowMask) {
+	simd_int2 product = (simd_int2)((vuckt_simd_uint32x2)a * (vuckt_simd_uint32x2)b);
+	vuckt_simd_int64x2 fullProduct = __builtin_convertvector(a, vuckt_simd_int64x2) * __builtin_convertvector(b, vuckt_simd_int64x2);
+	*outOverflowMask = __builtin_convertvector(__builtin_convertvector(product, vuckt_simd_int64x2) != fullProduct, simd_int2);
+	return product;
+}
+NS_INLINE simd_int4 vuckt_simd_multiply_overflow4(simd_int4 a, simd_int4 b, simd_int4 *outOverflowMask) {
+	simd_int4 product = (simd_int4)((vuckt_simd_uint32x4)a * (vuckt_simd_uint32x4)b);
+	vuckt_simd_int64x4 fullProduct = __builtin_convertvector(a, vuckt_simd_int64x4) * __builtin_convertvector(b, vuckt_simd_int64x4);
+	*outOverflowMask = __builtin_convertvector(__builtin_convertvector(product, vuckt_simd_int64x4) != fullProduct, simd_int4);
+	return product;
+}
+
+/// Per lane, `wrapped` where `overflowMask` is clear, else the limit (`INT_MAX` or `INT_MIN`) with the sign of `towardSign`.
+NS_INLINE simd_int2 vuckt_simd_saturate2(simd_int2 wrapped, simd_int2 overflowMask, simd_int2 towardSign) {
+	return (((towardSign >> 31) ^ 0x7FFFFFFF) & overflowMask) | (wrapped & ~overflowMask);
+}
+NS_INLINE simd_int4 vuckt_simd_saturate4(simd_int4 wrapped, simd_int4 overflowMask, simd_int4 towardSign) {
+	return (((towardSign >> 31) ^ 0x7FFFFFFF) & overflowMask) | (wrapped & ~overflowMask);
+}
+
+/// `a + b` per lane, clamped to [ `INT_MIN`, `INT_MAX` ] (a single instruction on NEON).
+NS_INLINE simd_int2 vuckt_simd_add_saturated2(simd_int2 a, simd_int2 b) {
+	#if defined(__ARM_NEON)
+		return (simd_int2)vqadd_s32((int32x2_t)a, (int32x2_t)b);
+	#else
+		simd_int2 overflowMask, sum = vuckt_simd_add_overflow2(a, b, &overflowMask);
+		return vuckt_simd_saturate2(sum, overflowMask, a); // an overflowing sum's operands share a sign
+	#endif
+}
+NS_INLINE simd_int4 vuckt_simd_add_saturated4(simd_int4 a, simd_int4 b) {
+	#if defined(__ARM_NEON)
+		return (simd_int4)vqaddq_s32((int32x4_t)a, (int32x4_t)b);
+	#else
+		simd_int4 overflowMask, sum = vuckt_simd_add_overflow4(a, b, &overflowMask);
+		return vuckt_simd_saturate4(sum, overflowMask, a);
+	#endif
+}
+/// `a - b` per lane, clamped to [ `INT_MIN`, `INT_MAX` ] (a single instruction on NEON).
+NS_INLINE simd_int2 vuckt_simd_subtract_saturated2(simd_int2 a, simd_int2 b) {
+	#if defined(__ARM_NEON)
+		return (simd_int2)vqsub_s32((int32x2_t)a, (int32x2_t)b);
+	#else
+		simd_int2 overflowMask, difference = vuckt_simd_subtract_overflow2(a, b, &overflowMask);
+		return vuckt_simd_saturate2(difference, overflowMask, a); // an overflowing difference goes the way of `a`'s sign
+	#endif
+}
+NS_INLINE simd_int4 vuckt_simd_subtract_saturated4(simd_int4 a, simd_int4 b) {
+	#if defined(__ARM_NEON)
+		return (simd_int4)vqsubq_s32((int32x4_t)a, (int32x4_t)b);
+	#else
+		simd_int4 overflowMask, difference = vuckt_simd_subtract_overflow4(a, b, &overflowMask);
+		return vuckt_simd_saturate4(difference, overflowMask, a);
+	#endif
+}
+/// `a * b` per lane, clamped to [ `INT_MIN`, `INT_MAX` ].
+NS_INLINE simd_int2 vuckt_simd_multiply_saturated2(simd_int2 a, simd_int2 b) {
+	simd_int2 overflowMask, product = vuckt_simd_multiply_overflow2(a, b, &overflowMask);
+	return vuckt_simd_saturate2(product, overflowMask, a ^ b); // an overflowing product's sign is the operands' signs combined
+}
+NS_INLINE simd_int4 vuckt_simd_multiply_saturated4(simd_int4 a, simd_int4 b) {
+	simd_int4 overflowMask, product = vuckt_simd_multiply_overflow4(a, b, &overflowMask);
+	return vuckt_simd_saturate4(product, overflowMask, a ^ b);
+}
+
+
+
+#pragma mark Narrow Integer Conversion
+
+// Kernels behind the `Char4`/`UChar4`/`Short2`…`Short4`/`UShort4` clamping & normalizing conversions (e.g. `UChar4FromFloat4Normalized()`), each a short branch-free vector sequence.
+// Values are clamped while still wide, so the narrowing that follows is a plain truncation, & NaNs are zeroed first (float→int conversion of NaN being undefined).
+// `Short2` & `Short3` go through these 4-lane kernels too.
+
+/// Each lane of `x` clamped to [ `lo`, `hi` ].
+NS_INLINE simd_int4 vuckt_simd_clamp4(simd_int4 x, int lo, int hi) {
+	simd_int4 belowMask = x < lo, aboveMask = x > hi;
+	return (x & ~(belowMask | aboveMask)) | (lo & belowMask) | (hi & aboveMask);
+}
+/// Each lane of `x` clamped to [ `lo`, `hi` ], with NaN becoming 0.
+NS_INLINE simd_float4 vuckt_simd_clamp_float4(simd_float4 x, float lo, float hi) {
+	x = (simd_float4)((simd_int4)x & (x == x));
+	x = vuckt_simd_select4(x < lo, (simd_float4){ lo, lo, lo, lo }, x);
+	return vuckt_simd_select4(x > hi, (simd_float4){ hi, hi, hi, hi }, x);
+}
+
+/// Each lane of `x` clamped to [ `lo`, `hi` ] (NaN becoming 0) & truncated toward zero.
+NS_INLINE simd_int4 vuckt_simd_float_to_int_clamped4(simd_float4 x, float lo, float hi) {
+	return __builtin_convertvector(vuckt_simd_clamp_float4(x, lo, hi), simd_int4);
+}
+/// UNORM encoding: each lane of `x` clamped to [ 0, 1 ] (NaN becoming 0) & scaled onto [ 0, `maxValue` ], rounding to nearest.
+NS_INLINE simd_int4 vuckt_simd_unorm_from_float4(simd_float4 x, float maxValue) {
+	return __builtin_convertvector(vuckt_simd_clamp_float4(x, 0.0f, 1.0f) * maxValue + 0.5f, simd_int4);
+}
+/// SNORM encoding: each lane of `x` clamped to [ -1, 1 ] (NaN becoming 0) & scaled onto [ -`maxValue`, `maxValue` ], rounding half away from zero.
+NS_INLINE simd_int4 vuckt_simd_snorm_from_float4(simd_float4 x, float maxValue) {
+	simd_float4 scaled = vuckt_simd_clamp_float4(x, -1.0f, 1.0f) * maxValue;
+	simd_float4 signedHalf = (simd_float4)(((simd_int4)scaled & ~0x7FFFFFFF) | 0x3F000000); // ±0.5, with `scaled`'s sign
+	return __builtin_convertvector(scaled + signedHalf, simd_int4);
+}
+/// UNORM decoding: each lane of `x` divided by `maxValue` (by reciprocal: within 1 ULP of the quotient, & exact at 0 & `maxValue`).
+NS_INLINE simd_float4 vuckt_simd_unorm_to_float4(simd_int4 x, float maxValue) {
+	return __builtin_convertvector(x, simd_float4) * (1.0f / maxValue);
+}
+/// SNORM decoding: each lane of `x` divided by `maxValue` (as `vuckt_simd_unorm_to_float4()` does), with the extra most-negative value (e.g. -128 for 8 bits) also mapping to -1.
+NS_INLINE simd_float4 vuckt_simd_snorm_to_float4(simd_int4 x, float maxValue) {
+	return __builtin_convertvector(vuckt_simd_clamp4(x, -(int)maxValue, (int)maxValue), simd_float4) * (1.0f / maxValue);
+}
+
+
+
+#pragma mark Half-Precision Conversion
+
+// Kernels behind the `Half2`/`Half3`/`Half4` conversions (e.g. `Half4FromFloat4()`), which store each element as an IEEE 754 binary16 bit pattern.
+// x86 with F16C uses `vcvtph2ps`/`vcvtps2ph`, & 64-bit ARM uses `fcvtl`/`fcvtn`; elsewhere they fall back to a short branch-free integer sequence with identical results (NaN payloads aside: the fallback quiets every NaN to the canonical `0x7E00`, with its sign kept).
+// x86 needn't enable F16C at compile time: unless it is (`-mf16c`, or an `-march` of Haswell or later), the F16C paths are built for F16C & AVX alone with `__attribute__((target))` & taken only once `vuckt_cpu_has_f16c()` reports the CPU has them, so baseline x86-64 builds (e.g. SwiftPM's) still get `vcvtph2ps`/`vcvtps2ph` wherever it exists.
+// Rounding toward zero has no NEON instruction (`fcvtn` rounds per `FPCR`, so to nearest-even), so ARM takes the fallback for it.
+
+#if (defined(__x86_64__) || defined(__i386__)) && (__GNUC__ || __clang__)
+	#define VUCKT_HAS_F16C_PATH 1
+	#if defined(__F16C__)
+		#define VUCKT_F16C_FUNCTION NS_INLINE
+	#else
+		#define VUCKT_F16C_FUNCTION static inline __attribute__((target("f16c,avx")))
+	#endif
+#else
+	#define VUCKT_HAS_F16C_PATH 0
+#endif
+
+#if VUCKT_HAS_F16C_PATH
+	/// Whether the F16C paths can run: always when F16C is enabled at compile time, else per the CPU's (& OS's) F16C & AVX support, checked on the first call (per translation unit) & cached.
+	/// The per-element conversions check it per call (a load & branch, once cached); the array conversions check it once per call, outside their loops.
+	NS_INLINE bool vuckt_cpu_has_f16c(void) {
+		#if defined(__F16C__)
+			return true;
+		#else
+			static int cachedHasF16C = -1; // -1 until checked; racing first calls just store the same result
+			int hasF16C = __atomic_load_n(&cachedHasF16C, __ATOMIC_RELAXED);
+			if (__builtin_expect(hasF16C < 0, 0)) {
+				__builtin_cpu_init(); // (in case this runs in a constructor ahead of libgcc's/compiler-rt's own)
+				hasF16C = __builtin_cpu_supports("f16c") && __builtin_cpu_supports("avx");
+				__atomic_store_n(&cachedHasF16C, hasF16C, __ATOMIC_RELAXED);
+			}
+			return hasF16C;
+		#endif
+	}
+	
+	/// `vuckt_simd_half_to_float4()`'s F16C path.
+	VUCKT_F16C_FUNCTION simd_float4 vuckt_f16c_half_to_float4(simd_ushort4 bits) {
+		return (simd_float4)_mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)&bits));
+	}
+	/// `vuckt_simd_half_from_float4()`'s & `vuckt_simd_half_from_float_toward_zero4()`'s F16C path.
+	VUCKT_F16C_FUNCTION simd_ushort4 vuckt_f16c_half_from_float4(simd_float4 x, bool towardZero) {
+		simd_ushort4 bits;
+		__m128i halfLanes = towardZero ? _mm_cvtps_ph((__m128)x, _MM_FROUND_TO_ZERO) : _mm_cvtps_ph((__m128)x, _MM_FROUND_TO_NEAREST_INT);
+		_mm_storel_epi64((__m128i *)&bits, halfLanes);
+		return bits;
+	}
+	/// `vuckt_half_lanes_to_float_lanes()`'s F16C path: 8 lanes at a time (via AVX), & any 1–7-lane remainder through a zero-padded vector.
+	VUCKT_F16C_FUNCTION void vuckt_f16c_half_lanes_to_float_lanes(const unsigned short *halfLanes, float *floatLanes, size_t laneCount, bool padded3) {
+		size_t laneI = 0;
+		for (; laneI + 8 <= laneCount; laneI += 8) {
+			__m128i bits = _mm_loadu_si128((const __m128i *)(halfLanes + laneI));
+			if (padded3) bits = _mm_shufflehi_epi16(_mm_shufflelo_epi16(bits, _MM_SHUFFLE(2, 2, 1, 0)), _MM_SHUFFLE(2, 2, 1, 0));
+			_mm256_storeu_ps(floatLanes + laneI, _mm256_cvtph_ps(bits));
+		}
+		if (laneI < laneCount) {
+			unsigned short remainderHalfLanes[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+			float remainderFloatLanes[8];
+			memcpy(remainderHalfLanes, halfLanes + laneI, (laneCount - laneI) * sizeof(unsigned short));
+			__m128i bits = _mm_loadu_si128((const __m128i *)remainderHalfLanes);
+			if (padded3) bits = _mm_shufflehi_epi16(_mm_shufflelo_epi16(bits, _MM_SHUFFLE(2, 2, 1, 0)), _MM_SHUFFLE(2, 2, 1, 0));
+			_mm256_storeu_ps(remainderFloatLanes, _mm256_cvtph_ps(bits));
+			memcpy(floatLanes + laneI, remainderFloatLanes, (laneCount - laneI) * sizeof(float));
+		}
+	}
+	/// `vuckt_half_lanes_from_float_lanes()`'s F16C path: 8 lanes at a time (via AVX), & any 1–7-lane remainder through a zero-padded vector.
+	VUCKT_F16C_FUNCTION void vuckt_f16c_half_lanes_from_float_lanes(const float *floatLanes, unsigned short *halfLanes, size_t laneCount, bool padded3, bool towardZero) {
+		size_t laneI = 0;
+		for (; laneI + 8 <= laneCount; laneI += 8) {
+			__m256 values = _mm256_loadu_ps(floatLanes + laneI);
+			if (padded3) values = _mm256_permute_ps(values, _MM_SHUFFLE(2, 2, 1, 0));
+			__m128i bits = towardZero ? _mm256_cvtps_ph(values, _MM_FROUND_TO_ZERO) : _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT);
+			_mm_storeu_si128((__m128i *)(halfLanes + laneI), bits);
+		}
+		if (laneI < laneCount) {
+			float remainderFloatLanes[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+			unsigned short remainderHalfLanes[8];
+			memcpy(remainderFloatLanes, floatLanes + laneI, (laneCount - laneI) * sizeof(float));
+			__m256 values = _mm256_loadu_ps(remainderFloatLanes);
+			if (padded3) values = _mm256_permute_ps(values, _MM_SHUFFLE(2, 2, 1, 0));
+			__m128i bits = towardZero ? _mm256_cvtps_ph(values, _MM_FROUND_TO_ZERO) : _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT);
+			_mm_storeu_si128((__m128i *)remainderHalfLanes, bits);
+			memcpy(halfLanes + laneI, remainderHalfLanes, (laneCount - laneI) * sizeof(unsigned short));
+		}
+	}
+#endif
+
+/// `vuckt_simd_half_to_float4()` without the F16C path.
+NS_INLINE simd_float4 vuckt_generic_half_to_float4(simd_ushort4 bits) {
+	#if defined(__ARM_NEON) && defined(__aarch64__)
+		return (simd_float4)vcvt_f32_f16(vreinterpret_f16_u16((uint16x4_t)bits));
+	#else
+		simd_int4 halfBits = __builtin_convertvector(bits, simd_int4);
+		simd_int4 shifted = (halfBits & 0x7FFF) << 13; // exponent & mantissa, aligned to `float`'s
+		simd_int4 exponent = shifted & 0x0F800000;
+		simd_int4 infOrNaNMask = exponent == 0x0F800000, zeroOrSubnormalMask = exponent == 0;
+		simd_int4 rebiased = shifted + 0x38000000 + (infOrNaNMask & 0x38000000); // +112 to the exponent (+224 for Inf/NaN, which keeps it all-ones)
+		simd_float4 subnormal = (simd_float4)(rebiased + 0x00800000) - (simd_float4)(simd_int4){ 0x38800000, 0x38800000, 0x38800000, 0x38800000 }; // renormalized by the FPU: (1.mantissa − 1)·2⁻¹⁴
+		simd_int4 magnitude = ((simd_int4)subnormal & zeroOrSubnormalMask) | (rebiased & ~zeroOrSubnormalMask);
+		return (simd_float4)(magnitude | ((halfBits & 0x8000) << 16));
+	#endif
+}
+
+/// `vuckt_simd_half_from_float4()` without the F16C path.
+NS_INLINE simd_ushort4 vuckt_generic_half_from_float4(simd_float4 x) {
+	#if defined(__ARM_NEON) && defined(__aarch64__)
+		return (simd_ushort4)vreinterpret_u16_f16(vcvt_f16_f32((float32x4_t)x));
+	#else
+		simd_int4 floatBits = (simd_int4)x, magnitude = floatBits & 0x7FFFFFFF;
+		simd_int4 subnormalMask = magnitude < (113 << 23), overflowMask = magnitude >= (143 << 23); // below 2⁻¹⁴; at or above 2¹⁶
+		// Normal: rebias the exponent (−112) & round the 13 dropped mantissa bits to nearest-even (a carry out of the mantissa correctly bumps the exponent, up to Inf).
+		simd_int4 normal = (magnitude - 0x37FFF001 + ((magnitude >> 13) & 1)) >> 13;
+		// Subnormal: adding 0.5 lines the result's mantissa up with half's 2⁻²⁴ subnormal spacing, so the FPU's add does the rounding.
+		simd_int4 subnormal = (simd_int4)((simd_float4)(magnitude & subnormalMask) + 0.5f) - 0x3F000000;
+		simd_int4 infOrNaN = 0x7C00 | ((magnitude > 0x7F800000) & 0x0200);
+		simd_int4 halfBits = (normal & ~(subnormalMask | overflowMask)) | (subnormal & subnormalMask) | (infOrNaN & overflowMask);
+		return __builtin_convertvector(halfBits | ((floatBits >> 16) & 0x8000), simd_ushort4);
+	#endif
+}
+/// `vuckt_simd_half_from_float_toward_zero4()` without the F16C path.
+NS_INLINE simd_ushort4 vuckt_generic_half_from_float_toward_zero4(simd_float4 x) {
+	simd_int4 floatBits = (simd_int4)x, magnitude = floatBits & 0x7FFFFFFF;
+	simd_int4 subnormalMask = magnitude < (113 << 23), overflowMask = magnitude >= (143 << 23);
+	simd_int4 normal = (magnitude - 0x38000000) >> 13;
+	simd_int4 subnormal = __builtin_convertvector((simd_float4)(magnitude & subnormalMask) * 16777216.0f, simd_int4); // ·2²⁴, truncated
+	simd_int4 overflow = (0x7BFF - (magnitude >= 0x7F800000)) | ((magnitude > 0x7F800000) & 0x0200); // 65504, Inf, or NaN
+	simd_int4 halfBits = (normal & ~(subnormalMask | overflowMask)) | (subnormal & subnormalMask) | (overflow & overflowMask);
+	return __builtin_convertvector(halfBits | ((floatBits >> 16) & 0x8000), simd_ushort4);
+}
+
+/// Each lane of `bits` (binary16) widened to `float` (exactly).
+NS_INLINE simd_float4 vuckt_simd_half_to_float4(simd_ushort4 bits) {
+	#if VUCKT_HAS_F16C_PATH
+		if (vuckt_cpu_has_f16c()) return vuckt_f16c_half_to_float4(bits);
+	#endif
+	return vuckt_generic_half_to_float4(bits);
+}
+/// Each lane of `x` narrowed to binary16, rounding to nearest-even; out-of-range values become ±Inf.
+NS_INLINE simd_ushort4 vuckt_simd_half_from_float4(simd_float4 x) {
+	#if VUCKT_HAS_F16C_PATH
+		if (vuckt_cpu_has_f16c()) return vuckt_f16c_half_from_float4(x, false);
+	#endif
+	return vuckt_generic_half_from_float4(x);
+}
+/// Each lane of `x` narrowed to binary16, rounding toward zero; out-of-range finite values become ±65504 (the largest finite half).
+NS_INLINE simd_ushort4 vuckt_simd_half_from_float_toward_zero4(simd_float4 x) {
+	#if VUCKT_HAS_F16C_PATH
+		if (vuckt_cpu_has_f16c()) return vuckt_f16c_half_from_float4(x, true);
+	#endif
+	return vuckt_generic_half_from_float_toward_zero4(x);
+}
+
+/// Widens `laneCount` contiguous binary16 lanes into `float` lanes: 8 at a time with F16C (via AVX), 4 at a time otherwise, & any remainder through a zero-padded vector.
+/// If `padded3`, the lanes are 3-element vectors padded to 4 (as `Half3`'s & `Float3`'s are), & each padding lane is written as a copy of the lane before it rather than converted from the input's.
+NS_INLINE void vuckt_half_lanes_to_float_lanes(const unsigned short *halfLanes, float *floatLanes, size_t laneCount, bool padded3) {
+	#if VUCKT_HAS_F16C_PATH
+		if (vuckt_cpu_has_f16c()) {
+			vuckt_f16c_half_lanes_to_float_lanes(halfLanes, floatLanes, laneCount, padded3);
+			return;
+		}
+	#endif
+	size_t laneI = 0;
+	for (; laneI + 4 <= laneCount; laneI += 4) {
+		simd_ushort4 bits;
+		memcpy(&bits, halfLanes + laneI, sizeof(bits));
+		if (padded3) bits[3] = bits[2];
+		simd_float4 values = vuckt_generic_half_to_float4(bits);
+		memcpy(floatLanes + laneI, &values, sizeof(values));
+	}
+	if (laneI < laneCount) {
+		simd_ushort4 bits = { 0, 0, 0, 0 };
+		memcpy(&bits, halfLanes + laneI, (laneCount - laneI) * sizeof(unsigned short));
+		simd_float4 values = vuckt_generic_half_to_float4(bits);
+		memcpy(floatLanes + laneI, &values, (laneCount - laneI) * sizeof(float));
+	}
+}
+/// Narrows `laneCount` contiguous `float` lanes into binary16 lanes, rounding to nearest-even or (if `towardZero`) toward zero; blocked, & with `padded3` handled, as `vuckt_half_lanes_to_float_lanes()` does.
+NS_INLINE void vuckt_half_lanes_from_float_lanes(const float *floatLanes, unsigned short *halfLanes, size_t laneCount, bool padded3, bool towardZero) {
+	#if VUCKT_HAS_F16C_PATH
+		if (vuckt_cpu_has_f16c()) {
+			vuckt_f16c_half_lanes_from_float_lanes(floatLanes, halfLanes, laneCount, padded3, towardZero);
+			return;
+		}
+	#endif
+	size_t laneI = 0;
+	for (; laneI + 4 <= laneCount; laneI += 4) {
+		simd_float4 values;
+		memcpy(&values, floatLanes + laneI, sizeof(values));
+		if (padded3) values[3] = values[2];
+		simd_ushort4 bits = towardZero ? vuckt_generic_half_from_float_toward_zero4(values) : vuckt_generic_half_from_float4(values);
+		memcpy(halfLanes + laneI, &bits, sizeof(bits));
+	}
+	if (laneI < laneCount) {
+		simd_float4 values = { 0, 0, 0, 0 };
+		memcpy(&values, floatLanes + laneI, (laneCount - laneI) * sizeof(float));
+		simd_ushort4 bits = towardZero ? vuckt_generic_half_from_float_toward_zero4(values) : vuckt_generic_half_from_float4(values);
+		memcpy(halfLanes + laneI, &bits, (laneCount - laneI) * sizeof(unsigned short));
+	}
+}
+
+
+
+#pragma mark Fast-Approximate Math
+
+// Kernels behind the `…Fast` functions (e.g. `Float3NormalizeFast()`), for callers that can trade a little accuracy (≤ 2.4e-5 relative, on any platform) for speed.
+// Reciprocals & reciprocal square roots start from the CPU's estimate instruction & take a single Newton-Raphson step; platforms with neither SSE nor NEON fall back to the exact operations.
+
+/// Approximates `1 / x` per lane.
+/// Max error: 3.5 ULP (2.0e-7 relative) with SSE (`rcpps`, ≤ 1.5·2⁻¹² before refinement); ≤ 1.6e-5 relative with NEON (`frecpe`, ≤ 2⁻⁸ before refinement); 0.5 ULP otherwise.
+/// Exact for ±0 & ±∞ lanes (→ ±∞ & ±0); subnormal lanes aren't supported.
+NS_INLINE simd_float4 vuckt_simd_fast_recip4(simd_float4 x) {
+	#if defined(__SSE__)
+		simd_float4 estimate = (simd_float4)_mm_rcp_ps((__m128)x);
+		simd_float4 refined = estimate * (2.0f - x * estimate);
+	#elif defined(__ARM_NEON)
+		simd_float4 estimate = (simd_float4)vrecpeq_f32((float32x4_t)x);
+		simd_float4 refined = estimate * (simd_float4)vrecpsq_f32((float32x4_t)x, (float32x4_t)estimate);
+	#else
+		simd_float4 estimate = 1.0f / x, refined = estimate;
+	#endif
+	// The Newton step turns ±0 & ±∞ lanes into NaN (∞·0), so those keep the estimate, which is already exact.
+	simd_int4 isExtreme = (x == 0.0f) | (x == INFINITY) | (x == -INFINITY);
+	return (simd_float4)(((simd_int4)refined & ~isExtreme) | ((simd_int4)estimate & isExtreme));
+}
+
+/// `vuckt_simd_fast_rsqrt4()` without its 0 & +∞ handling (those lanes may yield NaN), for callers that special-case them or whose results are NaN for them anyway (e.g. normalizing a zero vector).
+NS_INLINE simd_float4 vuckt_simd_fast_rsqrt4_unguarded(simd_float4 x) {
+	#if defined(__SSE__)
+		simd_float4 estimate = (simd_float4)_mm_rsqrt_ps((__m128)x);
+		return estimate * (1.5f - 0.5f * x * estimate * estimate);
+	#elif defined(__ARM_NEON)
+		simd_float4 estimate = (simd_float4)vrsqrteq_f32((float32x4_t)x);
+		return estimate * (simd_float4)vrsqrtsq_f32((float32x4_t)(x * estimate), (float32x4_t)estimate);
+	#else
+		return 1.0f / vuckt_simd_sqrt4(x);
+	#endif
+}
+
+/// Approximates `1 / sqrt(x)` per lane.
+/// Max error: 4.5 ULP (2.8e-7 relative) with SSE (`rsqrtps`, ≤ 1.5·2⁻¹² before refinement); ≤ 2.4e-5 relative with NEON (`frsqrte`, ≤ 2⁻⁸ before refinement); 1.5 ULP otherwise.
+/// Exact for 0 & +∞ lanes (→ +∞ & 0); subnormal lanes aren't supported.
+NS_INLINE simd_float4 vuckt_simd_fast_rsqrt4(simd_float4 x) {
+	simd_float4 refined = vuckt_simd_fast_rsqrt4_unguarded(x);
+	// The Newton step turns 0 & +∞ lanes into NaN (∞·0), so those take the exact results instead.
+	simd_int4 isZero = (x == 0.0f), isExtreme = isZero | (x == INFINITY);
+	simd_int4 exact = (simd_int4)(simd_float4){ INFINITY, INFINITY, INFINITY, INFINITY } & isZero; // +∞ → +0 (all bits clear)
+	return (simd_float4)(((simd_int4)refined & ~isExtreme) | exact);
+}
+
+/// Scalar `vuckt_simd_fast_rsqrt4()`.
+NS_INLINE float vuckt_fast_rsqrtf(float x) {
+	return vuckt_simd_fast_rsqrt4((simd_float4){ x, x, x, x })[0];
+}
+/// Scalar `vuckt_simd_fast_rsqrt4_unguarded()`.
+NS_INLINE float vuckt_fast_rsqrtf_unguarded(float x) {
+	return vuckt_simd_fast_rsqrt4_unguarded((simd_float4){ x, x, x, x })[0];
+}
+/// Approximates `sqrt(x)` as `x · vuckt_fast_rsqrtf(x)`, which trades `sqrt`'s long latency for a multiply-add chain that pipelines (within `vuckt_simd_fast_rsqrt4()`'s bounds, +0.5 ULP).  Exact for 0 & +∞.
+NS_INLINE float vuckt_fast_sqrtf(float x) {
+	return (x == 0.0f || x == INFINITY) ? x : x * vuckt_fast_rsqrtf_unguarded(x);
+}
+
+/// Approximates the sine & cosine of `x` (radians) per lane, by reduction to [ -π/4, π/4 ] & minimax polynomials (Cephes' `sinf`/`cosf` coefficients), with no table lookups or branches.
+/// Max error: 1e-7 absolute (2 ULP wherever the result's magnitude is ≥ ½) for |x| ≤ 8192, growing to 1e-6 absolute by |x| = 10⁵ as the π/2 reduction loses precision; NaN & ±∞ lanes yield NaN.
+NS_INLINE void vuckt_simd_fast_sincos4(simd_float4 x, simd_float4 *outSin, simd_float4 *outCos) {
+	// Rounds x·2/π to the nearest integer quadrant by adding & subtracting 1.5·2²³, which leaves the quadrant in the low mantissa bits of `shifted`.
+	const float roundingBias = 12582912.0f;
+	simd_float4 shifted = x * 0.636619772f + roundingBias;
+	simd_float4 quadrant = shifted - roundingBias;
+	simd_int4 quadrantBits = (simd_int4)shifted;
+	
+	// x − quadrant·π/2, with π/2 split into 3 parts (the first two exactly representable in few enough bits that their products with the quadrant are exact).
+	simd_float4 r = x - quadrant * 1.5703125f;
+	r = r - quadrant * 4.837512969970703125e-4f;
+	r = r - quadrant * 7.54978995489188216e-8f;
+	
+	simd_float4 r2 = r * r;
+	simd_float4 sinOfR = r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+	simd_float4 cosOfR = 1.0f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+	
+	// Quadrants 1 & 3 swap sine & cosine; sine is negated in quadrants 2 & 3, cosine in 1 & 2.
+	simd_int4 isSwapped = -(quadrantBits & 1);
+	simd_int4 sinSignBit = (quadrantBits & 2) << 30;
+	simd_int4 cosSignBit = ((quadrantBits + 1) & 2) << 30;
+	simd_int4 sinBits = (simd_int4)sinOfR, cosBits = (simd_int4)cosOfR;
+	*outSin = (simd_float4)(((sinBits & ~isSwapped) | (cosBits & isSwapped)) ^ sinSignBit);
+	*outCos = (simd_float4)(((cosBits & ~isSwapped) | (sinBits & isSwapped)) ^ cosSignBit);
+}
+
+/// Approximates `2ˣ` per lane, by splitting `x` into its nearest integer `k` & a remainder in [ -½, ½ ], raising 2 to the remainder by Cephes' `exp2f` minimax polynomial, & scaling by `2ᵏ` through the exponent bits, with no branches.
+/// Max error: 1 ULP for x in [ -126, 127.5 ); lanes below that flush to +0 (rather than going subnormal) & lanes above it yield +∞; NaN lanes aren't supported.
+NS_INLINE simd_float4 vuckt_simd_fast_exp2_4(simd_float4 x) {
+	x = vuckt_simd_select4((x < -127.0f), (simd_float4){ -127.0f, -127.0f, -127.0f, -127.0f }, x);
+	x = vuckt_simd_select4((x > 128.0f), (simd_float4){ 128.0f, 128.0f, 128.0f, 128.0f }, x);
+	
+	// Rounds `x` to the nearest integer by adding & subtracting 1.5·2²³ (as `vuckt_simd_fast_sincos4()` does its quadrant), which leaves it in the low mantissa bits of `shifted`.
+	const float roundingBias = 12582912.0f;
+	simd_float4 shifted = x + roundingBias;
+	simd_float4 f = x - (shifted - roundingBias);
+	simd_int4 k = (simd_int4)shifted - 0x4B400000;
+	
+	simd_float4 twoToF = 1.0f + f * (6.931472028550421e-1f + f * (2.402264791363012e-1f + f * (5.550332471162809e-2f + f * (9.618437357674640e-3f + f * (1.339887440266574e-3f + f * 1.535336188319500e-4f)))));
+	// `k` = -127 gives all-zero bits (+0) & `k` = 128 gives +∞'s.
+	simd_float4 twoToK = (simd_float4)((k + 127) << 23);
+	return twoToF * twoToK;
+}
+
+/// Approximates `atan2(y, x)` per lane (radians, in [ -π, π ]), by reduction to [ -tan(π/8), tan(π/8) ] & Cephes' `atanf` minimax polynomial, with no branches.
+/// Max error: 3.2 ULP & 2.7e-7 absolute (measured over every direction, & over random finite & unit-square `y`,`x` pairs); signed zeros follow `atan2f()` (e.g. `atan2(+0, -0)` → π), but NaN & ±∞ lanes aren't supported.
+NS_INLINE simd_float4 vuckt_simd_fast_atan2_4(simd_float4 y, simd_float4 x) {
+	const simd_int4 signBit = (simd_int4)(simd_float4){ -0.0f, -0.0f, -0.0f, -0.0f };
+	simd_float4 absY = (simd_float4)((simd_int4)y & ~signBit), absX = (simd_float4)((simd_int4)x & ~signBit);
+	
+	// atan of min/max (in [ 0, 1 ]), further reduced around tan(π/8) to keep the polynomial's argument small.
+	simd_int4 isSteep = (absY > absX);
+	simd_float4 numerator = vuckt_simd_select4(isSteep, absX, absY), denominator = vuckt_simd_select4(isSteep, absY, absX);
+	simd_float4 z = vuckt_simd_select4((denominator == 0.0f), (simd_float4){ 0, 0, 0, 0 }, numerator / denominator);
+	simd_int4 isAboveTanPiOver8 = (z > 0.414213562f);
+	simd_float4 base = vuckt_simd_select4(isAboveTanPiOver8, (simd_float4){ 0.785398163f, 0.785398163f, 0.785398163f, 0.785398163f }, (simd_float4){ 0, 0, 0, 0 });
+	z = vuckt_simd_select4(isAboveTanPiOver8, (z - 1.0f) / (z + 1.0f), z);
+	simd_float4 z2 = z * z;
+	simd_float4 angle = base + (z + z * z2 * (-3.33329491539e-1f + z2 * (1.99777106478e-1f + z2 * (-1.38776856032e-1f + z2 * 8.05374449538e-2f))));
+	
+	// Unfold to the full circle: reflect about π/4 for steep angles, about π/2 for negative `x`, & take `y`'s sign.
+	angle = vuckt_simd_select4(isSteep, 1.570796327f - angle, angle);
+	angle = vuckt_simd_select4(((simd_int4)x & signBit) != 0, 3.141592654f - angle, angle);
+	return (simd_float4)((simd_int4)angle | ((simd_int4)y & signBit));
+}
+
+
+
+#pragma mark Euler Angles
+
+// Shared by the per-type Euler-angle conversions (e.g. `FloatQuaternionFromEulerAngles()`), which take their rotation order as the indices (0 = x, 1 = y, 2 = z) of the axes rotated about first, second, & third.
+// Relabeling the axes in that order turns every order into x-then-y-then-z, so one closed form serves all six; but when the relabeling is an odd permutation (e.g. x-z-y) it flips handedness, which negates each rotation's sine.
+// With constant axes (as Swift's `RotationOrder` passes), the relabeling & parity fold away once inlined.
+
+/// +1 if rotating about `firstAxis` then `secondAxis` (then the third) is an even permutation of x-y-z (x-y-z, y-z-x, or z-x-y), else -1.
+NS_INLINE float vuckt_euler_parity(int firstAxis, int secondAxis) {
+	return ((secondAxis - firstAxis + 3) % 3 == 1) ? 1.0f : -1.0f;
+}
+
+/// Recovers the Euler angles of rotation matrix `r` (`r[row][column]`), relabeled so rows & columns 0, 1, & 2 are `firstAxis`, `secondAxis`, & `thirdAxis`, writing each axis' angle (radians) to `outAngles[axis]`.
+/// The second angle is in [ -π/2, π/2 ], the others in [ -π, π ].  In gimbal lock (the second angle at ±π/2, which leaves the first & third rotations about the same axis) the third angle is taken as 0.
+NS_INLINE void vuckt_euler_angles_from_rotation(const float r[3][3], int firstAxis, int secondAxis, int thirdAxis, float outAngles[3]) {
+	float parity = vuckt_euler_parity(firstAxis, secondAxis);
+	float cosOfSecond = vuckt_sqrtf(r[0][0] * r[0][0] + r[1][0] * r[1][0]);
+	outAngles[secondAxis] = parity * atan2f(-r[2][0], cosOfSecond);
+	if (cosOfSecond > 4e-6f) {
+		outAngles[firstAxis] = parity * atan2f(r[2][1], r[2][2]);
+		outAngles[thirdAxis] = parity * atan2f(r[1][0], r[0][0]);
+	} else {
+		outAngles[firstAxis] = parity * atan2f(-r[1][2], r[1][1]);
+		outAngles[thirdAxis] = 0.0f;
+	}
+}
+
+
+
+VUCKT_DIAGNOSTICS_END
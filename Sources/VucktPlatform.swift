@@ -0,0 +1,75 @@
+// Vuckt
+// @author: Slipp Douglas Thompson
+// @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
+
+#if canImport(VucktC) && !canImport(simd)
+
+import kvSIMD
+import VucktC
+
+
+
+// The portable C backend's `simd_float3x3`, `simd_float4x4`, & `simd_quatf` (see `VucktPlatform.h`) are plain C structs, not kvSIMD's types.
+// These overloads convert to & from kvSIMD's types instead, so the shared Swift extensions see the same simd types as they do on Apple platforms.
+// (Vectors need no such help; Swift imports the C backend's vector types as `SIMDn<Scalar>` directly.)
+
+
+
+// MARK: Float3x3 SIMD Conversion
+
+/// Converts a `Float3x3` struct to `simd_float3x3` vector using passing-individual-members initialization.
+@_transparent public func Float3x3ToSimd(_ structValue:Float3x3) -> simd_float3x3 {
+	return simd_float3x3(
+		simd_float3(structValue.m00, structValue.m01, structValue.m02),
+		simd_float3(structValue.m10, structValue.m11, structValue.m12),
+		simd_float3(structValue.m20, structValue.m21, structValue.m22)
+	)
+}
+/// Converts a `Float3x3` struct from `simd_float3x3` vector using passing-individual-members initialization.
+@_transparent public func Float3x3FromSimd(_ simdValue:simd_float3x3) -> Float3x3 {
+	return Float3x3(
+		m00: simdValue[0, 0], m01: simdValue[0, 1], m02: simdValue[0, 2],
+		m10: simdValue[1, 0], m11: simdValue[1, 1], m12: simdValue[1, 2],
+		m20: simdValue[2, 0], m21: simdValue[2, 1], m22: simdValue[2, 2]
+	)
+}
+
+
+
+// MARK: Float4x4 SIMD Conversion
+
+/// Converts a `Float4x4` struct to `simd_float4x4` vector using passing-individual-members initialization.
+@_transparent public func Float4x4ToSimd(_ structValue:Float4x4) -> simd_float4x4 {
+	return simd_float4x4(
+		simd_float4(structValue.m00, structValue.m01, structValue.m02, structValue.m03),
+		simd_float4(structValue.m10, structValue.m11, structValue.m12, structValue.m13),
+		simd_float4(structValue.m20, structValue.m21, structValue.m22, structValue.m23),
+		simd_float4(structValue.m30, structValue.m31, structValue.m32, structValue.m33)
+	)
+}
+/// Converts a `Float4x4` struct from `simd_float4x4` vector using passing-individual-members initialization.
+@_transparent public func Float4x4FromSimd(_ simdValue:simd_float4x4) -> Float4x4 {
+	return Float4x4(
+		m00: simdValue[0, 0], m01: simdValue[0, 1], m02: simdValue[0, 2], m03: simdValue[0, 3],
+		m10: simdValue[1, 0], m11: simdValue[1, 1], m12: simdValue[1, 2], m13: simdValue[1, 3],
+		m20: simdValue[2, 0], m21: simdValue[2, 1], m22: simdValue[2, 2], m23: simdValue[2, 3],
+		m30: simdValue[3, 0], m31: simdValue[3, 1], m32: simdValue[3, 2], m33: simdValue[3, 3]
+	)
+}
+
+
+
+// MARK: FloatQuaternion SIMD Conversion
+
+/// Converts a `FloatQuaternion` struct to `simd_quatf` vector using passing-individual-members initialization.
+@_transparent public func FloatQuaternionToSimd(_ structValue:FloatQuaternion) -> simd_quatf {
+	return simd_quatf(ix: structValue.ix, iy: structValue.iy, iz: structValue.iz, r: structValue.r)
+}
+/// Converts a `FloatQuaternion` struct from `simd_quatf` vector using passing-individual-members initialization.
+@_transparent public func FloatQuaternionFromSimd(_ simdValue:simd_quatf) -> FloatQuaternion {
+	return FloatQuaternion(ix: simdValue.vector.x, iy: simdValue.vector.y, iz: simdValue.vector.z, r: simdValue.vector.w)
+}
+
+
+
+#endif // canImport(VucktC) && !canImport(simd)
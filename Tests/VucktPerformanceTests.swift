@@ -100,6 +100,30 @@ class VucktPerformanceTests : XCTestCase
 		}
 	}
 	
+	func testFloat3ArrayNormalizePerformance()
+	{
+		let testSet:[Float3] = (0..<Self.iterationCount).map{ i in
+			Float3(x: Float(i) + 1, y: -Float(i) * 10.0, z: Float(i) / 2.0)
+		}
+		
+		
+		self.measure {
+			_ = testSet.map{ $0.normalized() }
+		}
+	}
+	
+	func testFloat3SoANormalizePerformance()
+	{
+		let testSet = Float3SoA((0..<Self.iterationCount).map{ i in
+			Float3(x: Float(i) + 1, y: -Float(i) * 10.0, z: Float(i) / 2.0)
+		})
+		
+		
+		self.measure {
+			_ = testSet.normalized()
+		}
+	}
+	
 #if canImport(GLKit) && !targetEnvironment(macCatalyst)
 	func testGLKVector3Performance()
 	{
@@ -2,9 +2,14 @@
 // @author: Slipp Douglas Thompson
 // @license: Public Domain per The Unlicense.  See accompanying LICENSE file or <http://unlicense.org/>.
 
+import Foundation
 import Testing
 import Vuckt
-import simd
+#if canImport(simd)
+	import simd
+#else
+	import kvSIMD
+#endif
 import Numerics
 
 
@@ -531,6 +536,706 @@ struct VucktTests
 		)
 	}
 	
+	@Test func bulkArrayMath()
+	{
+		let int3s = Self._int3TestValues.map{ Int3(array: $0) }
+		#expect(int3s.adding(int3s.reversed()) == zip(int3s, int3s.reversed()).map{ $0 + $1 })
+		#expect(int3s.multiplied(by: -3) == int3s.map{ $0 * -3 })
+		#expect(int3s.negated() == int3s.map{ -$0 })
+		
+		let float3s = Self._float3RegularTestValues.map{ Float3(array: $0) }
+		#expect(float3s.subtracting(float3s.reversed()) == zip(float3s, float3s.reversed()).map{ $0 - $1 })
+		#expect(float3s.divided(by: 4) == float3s.map{ $0 / 4 })
+		#expect(float3s.remainder(dividingBy: 3) == float3s.map{ $0 % 3 })
+		
+		var float4s = [ Float4(1, 2, 3, 4), Float4(-10, -20, -30, -40) ]
+		float4s.multiply(by: [ Float4(2, 2, 2, 2), Float4(0.5, 0.5, 0.5, 0.5) ])
+		#expect(float4s == [ Float4(2, 4, 6, 8), Float4(-5, -10, -15, -20) ])
+		
+		#expect([Float2]().adding([]) == [])
+	}
+	
+	@Test func soaMath()
+	{
+		let float3sA = Self._float3RegularTestValues.map{ Float3(array: $0) }
+		let float3sB = float3sA.reversed().map{ $0 + Float3(1, 1, 1) }
+		let soaA = Float3SoA(float3sA), soaB = Float3SoA(float3sB)
+		#expect([Float3](soaA) == float3sA)
+		#expect(soaA[2] == float3sA[2])
+		
+		for (soaDot, dot) in zip(soaA.dotProduct(soaB), zip(float3sA, float3sB).map{ $0.dotProduct($1) }) {
+			assertAlmostEqual(soaDot, dot)
+		}
+		for (soaCross, cross) in zip([Float3](soaA.crossProduct(soaB)), zip(float3sA, float3sB).map{ $0.crossProduct($1) }) {
+			assertAlmostEqual(soaCross, cross)
+		}
+		#expect([Float3](min(soaA, soaB)) == zip(float3sA, float3sB).map{ min($0, $1) })
+		#expect([Float3](soaA.clamped(to: Float3(-1, -1, -1)...Float3(1, 1, 1))) == float3sA.map{ $0.clamped(to: Float3(-1, -1, -1)...Float3(1, 1, 1)) })
+		for (soaLength, length) in zip(soaB.lengths(), float3sB.map{ $0.length() }) {
+			assertAlmostEqual(soaLength, length)
+		}
+		for (soaNormal, normal) in zip([Float3](soaB.normalized()), float3sB.map{ $0.normalized() }) {
+			assertAlmostEqual(soaNormal, normal)
+		}
+		for (soaMix, mix) in zip([Float3](soaA.mixed(with: soaB, ratio: 0.25)), zip(float3sA, float3sB).map{ $0.mixed(with: $1, ratio: 0.25) }) {
+			assertAlmostEqual(soaMix, mix)
+		}
+		
+		let float4s = Self._float4TestValues.map{ Float4(array: $0) }
+		#expect([Float4](Float4SoA(float4s)) == float4s)
+		#expect(Float4SoA().normalized().isEmpty)
+	}
+	
+	@Test func packedFloat3Conversion()
+	{
+		// 7 elements, to cover both the 4-at-a-time path & the remainder.
+		let float3s = (Self._float3TestValues + Self._float3SimpleTestValues).prefix(7).map{ Float3(array: $0) }
+		let packedFloat3s = [PackedFloat3](float3s)
+		#expect(MemoryLayout<PackedFloat3>.stride == 12)
+		#expect(packedFloat3s == float3s.map{ PackedFloat3($0) })
+		#expect([Float3](packedFloat3s) == float3s)
+		#expect([Float3]([PackedFloat3]()) == [])
+	}
+	
+	@Test func batchTransforms()
+	{
+		let values = Self._float3RegularTestValues.map{ Float3(array: $0) }
+		var matrix = Float4x4(scale: Float3(2, 3, 4), rotation: FloatQuaternion(angle: 0.3 * Float.pi, axis: Float3(1, 0.5, 0.25).normalized()), translation: Float3(1, 2, 3))
+		matrix.m03 = 0.5 // non-trivial `w`, for the perspective divide
+		let normalMatrix = Float4x4UpperLeft3x3(matrix).inversed().transposed()
+		
+		let points = matrix.transformedPoints(values, perspectiveDivide: true)
+		let packedPoints = matrix.transformedPoints([PackedFloat3](values), perspectiveDivide: true)
+		let vectors = matrix.transformedVectors(values)
+		let normals = matrix.transformedNormals(values, renormalize: true)
+		for (i, value) in values.enumerated() {
+			let point = matrix * Float4(xyz: value, w: 1)
+			assertAlmostEqual(points[i], point.xyz / point.w)
+			assertAlmostEqual(Float3(packedPoints[i]), point.xyz / point.w)
+			assertAlmostEqual(vectors[i], (matrix * Float4(xyz: value, w: 0)).xyz)
+			if value != Float3() {
+				assertAlmostEqual(normals[i], (normalMatrix * value).normalized())
+			}
+		}
+	}
+	
+	@Test func hierarchyPropagation()
+	{
+		var local = Self._eulerAnglesRotationTestValues.enumerated().map{ (i, eulerAngles) in
+			Float4x4(scaleAndRotation: Float3x3(rotationEulerAngles: eulerAngles), translation: Float3(Float(i), 1, -2))
+		}
+		let parentIndices:[Int32] = [ -1, 0, 1, 0 ]
+		var world = Float4x4.worldTransforms(local: local, parentIndices: parentIndices)
+		for (expected, actual) in zip((local[0] * local[1] * local[2]).asArray, world[2].asArray) {
+			assertAlmostEqual(actual, expected)
+		}
+		
+		local[1] = local[1].translated(by: Float3(5, 0, 0))
+		var dirty = [ false, true, false, false ]
+		Float4x4.propagateHierarchy(local: local, parentIndices: parentIndices, dirty: &dirty, world: &world)
+		#expect(dirty == [ false, true, true, false ])
+		#expect(world == Float4x4.worldTransforms(local: local, parentIndices: parentIndices))
+	}
+	
+	@Test func affineTransforms()
+	{
+		#expect(MemoryLayout<Float4x3>.stride == 48)
+		
+		let scale = Float3(2, 3, 0.5)
+		let translation = Float3(1, -2, 3)
+		for (angle_rad, axis) in Self._angleAxisRotationTestValues {
+			let rotation = FloatQuaternion(angle: angle_rad, axis: axis)
+			let affine = Float4x3(scale: scale, rotation: rotation, translation: translation)
+			let matrix = Float4x4(translation: translation) * Float4x4(rotation: rotation) * Float4x4(scale: scale)
+			for (expected, actual) in zip(matrix.asArray, Float4x4(affine).asArray) {
+				assertAlmostEqual(actual, expected)
+			}
+			#expect(Float4x3(Float4x4(affine)) == affine)
+			
+			let other = Float4x3(Float3x3(rotationAngle: angle_rad * 0.5, axis: Float3.unitZPositive), translation: Float3(-4, 0, 1))
+			for (expected, actual) in zip((matrix * Float4x4(other)).asArray, Float4x4(affine * other).asArray) {
+				assertAlmostEqual(actual, expected)
+			}
+			for value in Self._float3SimpleTestValues.map({ Float3(array: $0) }) {
+				assertAlmostEqual(affine.transformPoint(value), (matrix * Float4(xyz: value, w: 1)).xyz)
+				assertAlmostEqual(affine.transformVector(value), (matrix * Float4(xyz: value, w: 0)).xyz)
+				assertAlmostEqual(affine.inversed().transformPoint(affine.transformPoint(value)), value)
+				assertAlmostEqual(affine.orthogonalInversed().transformPoint(affine.transformPoint(value)), value)
+			}
+		}
+	}
+	
+	@Test func fastApproximateMath()
+	{
+		let float3s = Self._float3RegularTestValues.dropFirst().map{ Float3(array: $0) }
+		for value in float3s {
+			assertAlmostEqual(value.normalized(precision: .fast), value.normalized())
+			assertAlmostEqual(value.length(precision: .fast) / value.length(), 1)
+			assertAlmostEqual(value.reciprocal(precision: .fast) * value, Float3(1, 1, 1))
+		}
+		
+		for eulerAngles_rad in Self._eulerAnglesRotationTestValues {
+			let quaternion = FloatQuaternion(eulerAngles: eulerAngles_rad, order: .xyz)
+			let fastQuaternion = FloatQuaternion(eulerAngles: eulerAngles_rad, order: .xyz, precision: .fast)
+			let fastMatrix3 = Float3x3(rotationEulerAngles: eulerAngles_rad, order: .xyz, precision: .fast)
+			assertAlmostEqual(fastQuaternion.length(precision: .fast), 1)
+			
+			for value in float3s {
+				let unitValue = value.normalized()
+				assertAlmostEqual(fastQuaternion * unitValue, quaternion * unitValue)
+				assertAlmostEqual(fastMatrix3 * unitValue, quaternion * unitValue)
+			}
+		}
+	}
+	
+	
+	@Test func batchQuaternionInterpolation()
+	{
+		// 5 (not a multiple of 4) sets of nearby keys, so the cubic forms' control points all lie in one hemisphere.
+		let eulerAngles_rad = Self._eulerAnglesRotationTestValues + [ Float3(0.25, -0.75, 0.5) * Float.pi ]
+		let keys = (0..<4).map{ k in eulerAngles_rad.map{ FloatQuaternion(eulerAngles: $0 * (0.1 * Float(k + 1)), order: .xyz) } }
+		let ratios:[Float] = [ 0, 0.25, 0.5, 0.7, 1 ]
+		let unitValue = Float3(1, 2, 3).normalized()
+		
+		let shortest = interpolateBetween(keys[0], keys[3], ratios: ratios)
+		let shortestShared = interpolateBetween(keys[0], keys[3], ratio: 0.7)
+		let longest = interpolateBetween(keys[0], keys[3], ratios: ratios, method: .longest)
+		let fast = interpolateBetween(keys[0], keys[3], ratios: ratios, precision: .fast)
+		let nlerp = normalizedLinearInterpolateBetween(keys[0], keys[3], ratios: ratios)
+		let bezier = interpolateBetween(keys[0], keys[1], keys[2], keys[3], ratios: ratios, method: .bezier)
+		let spline = interpolateBetween(keys[0], keys[1], keys[2], keys[3], ratios: ratios, method: .spline)
+		for i in 0..<ratios.count {
+			let (a, control1, control2, b, ratio) = (keys[0][i], keys[1][i], keys[2][i], keys[3][i], ratios[i])
+			let expected = interpolateBetween(a, b, ratio: ratio)
+			assertAlmostEqual(shortest[i] * unitValue, expected * unitValue)
+			assertAlmostEqual(shortestShared[i] * unitValue, interpolateBetween(a, b, ratio: 0.7) * unitValue)
+			assertAlmostEqual(longest[i] * unitValue, interpolateBetween(a, b, ratio: ratio, method: .longest) * unitValue)
+			assertAlmostEqual(abs(dotProductOf(fast[i], expected)), 1)
+			assertAlmostEqual(nlerp[i].length(), 1)
+			assertAlmostEqual(bezier[i] * unitValue, interpolateBetween(a, control1, control2, b, ratio: ratio, method: .bezier) * unitValue)
+			assertAlmostEqual(spline[i] * unitValue, interpolateBetween(a, control1, control2, b, ratio: ratio, method: .spline) * unitValue)
+		}
+		assertAlmostEqual(nlerp[0] * unitValue, keys[0][0] * unitValue)
+		assertAlmostEqual(nlerp[4] * unitValue, keys[3][4] * unitValue)
+	}
+	
+	
+	@Test func eulerAngleRoundTripsAllOrders()
+	{
+		let orders:[RotationOrder] = [ .xyz, .xzy, .yxz, .yzx, .zxy, .zyx ]
+		let eulerAngles_rad = Self._eulerAnglesRotationTestValues + [ Float3(0.2, -0.3, 0.4) ]
+		let unitValue = Float3(1, 2, 3).normalized()
+		for order in orders {
+			let quaternions = FloatQuaternion.fromEulerAngles(eulerAngles_rad, order: order)
+			let matrix3s = Float3x3.fromRotationEulerAngles(eulerAngles_rad, order: order)
+			let matrix4s = Float4x4.fromRotationEulerAngles(eulerAngles_rad, order: order)
+			for (i, angles) in eulerAngles_rad.enumerated() {
+				let quaternion = FloatQuaternion(eulerAngles: angles, order: order)
+				let matrix3 = Float3x3(rotationEulerAngles: angles, order: order)
+				assertAlmostEqual(matrix3 * unitValue, quaternion * unitValue)
+				assertAlmostEqual((Float4x4(rotationEulerAngles: angles, order: order) * Float4(xyz: unitValue, w: 0)).xyz, quaternion * unitValue)
+				assertAlmostEqual(quaternions[i] * unitValue, quaternion * unitValue)
+				assertAlmostEqual(matrix3s[i] * unitValue, quaternion * unitValue)
+				assertAlmostEqual((matrix4s[i] * Float4(xyz: unitValue, w: 0)).xyz, quaternion * unitValue)
+				
+				// The recovered angles may differ from `angles` (e.g. in gimbal lock) but must describe the same rotation.
+				assertAlmostEqual(FloatQuaternion(eulerAngles: quaternion.eulerAngles(order: order), order: order) * unitValue, quaternion * unitValue)
+				assertAlmostEqual(Float3x3(rotationEulerAngles: matrix3.rotationEulerAngles(order: order), order: order) * unitValue, quaternion * unitValue)
+			}
+		}
+	}
+	
+	@Test func overflowArithmetic()
+	{
+		let (big, small) = (Int32.max - 1, Int32.min + 1)
+		let a = Int4(big, small, 7, -46341), b = Int4(5, -5, 3, 46341)
+		
+		let sum = a.addingReportingLaneOverflow(b)
+		#expect(sum.partialValue == a &+ b)
+		#expect(sum.overflowMask == Int4(-1, -1, 0, 0))
+		#expect(a.addingReportingOverflow(b).overflow)
+		#expect(a.addingSaturated(b) == Int4(Int32.max, Int32.min, 10, 0))
+		
+		let difference = Int4(small, big, 7, 0).subtractingReportingLaneOverflow(Int4(5, -5, 3, 0))
+		#expect(difference.partialValue == Int4(small, big, 7, 0) &- Int4(5, -5, 3, 0))
+		#expect(difference.overflowMask == Int4(-1, -1, 0, 0))
+		#expect(Int4(small, big, 7, 0).subtractingSaturated(Int4(5, -5, 3, 0)) == Int4(Int32.min, Int32.max, 4, 0))
+		
+		let product = a.multipliedReportingLaneOverflow(by: b)
+		#expect(product.partialValue == a &* b)
+		#expect(product.overflowMask == Int4(-1, -1, 0, -1))
+		#expect(a.multipliedSaturated(by: b) == Int4(Int32.max, Int32.max, 21, Int32.min))
+		#expect(!Int4(1, 2, 3, 4).multipliedReportingOverflow(by: Int4(5, 6, 7, 8)).overflow)
+		
+		#expect(Int3(big, 1, small).addingSaturated(Int3(big, 1, small)) == Int3(Int32.max, 2, Int32.min))
+		#expect(Int3(big, 1, small).addingReportingLaneOverflow(Int3(big, 1, small)).overflowMask == Int3(-1, 0, -1))
+		#expect(Int2(small, 46340).multipliedReportingLaneOverflow(by: Int2(-1, 46340)).overflowMask == Int2(0, 0))
+		#expect(Int2(Int32.min, 46341).multipliedReportingLaneOverflow(by: Int2(-1, 46341)).overflowMask == Int2(-1, -1))
+	}
+	
+	@Test func compactIntegerVectorConversions()
+	{
+		let wide = Int4(300, -300, -128, 127)
+		#expect(Char4(clamping: wide) == Char4(127, -128, -128, 127))
+		#expect(Char4(truncatingIfNeeded: wide) == Char4(44, -44, -128, 127))
+		#expect(Int4(Char4(clamping: wide)) == Int4(127, -128, -128, 127))
+		
+		let unitFloats = Float4(1, -1, 0.5, .nan)
+		#expect(UChar4(normalized: unitFloats) == UChar4(255, 0, 128, 0))
+		#expect(Char4(normalized: unitFloats) == Char4(127, -127, 64, 0))
+		#expect(Float4(normalized: Char4(-128, -127, 127, 0)) == Float4(-1, -1, 1, 0))
+		#expect(Short3(saturating: Float3(40000, -40000.5, -3.9)) == Short3(32767, -32768, -3))
+		#expect(UShort4(clamping: Int4(-1, 65536, 7, 0)) == UShort4(0, 65535, 7, 0))
+		
+		// 7 elements, to cover both the vectorized loop body & the remainder.
+		let int4s = (0..<7).map{ Int4(Int32($0) * 97 - 300, Int32($0) * -61, 127 + Int32($0), -128 - Int32($0)) }
+		#expect([Char4](int4s, mode: .clamping) == int4s.map{ Char4(clamping: $0) })
+		#expect([Char4](int4s) == int4s.map{ Char4(truncatingIfNeeded: $0) })
+		let uchar4s = (0..<7).map{ UChar4(UInt8($0 * 36), UInt8(255 - $0), 0, 255) }
+		#expect([UChar4]([Float4](uchar4s, normalized: true), mode: .normalized) == uchar4s)
+	}
+	
+	@Test func halfPrecisionConversions()
+	{
+		let exact = Half4(1, -2, 0.5, 65504)
+		#expect(exact.simdValue == SIMD4<UInt16>(0x3C00, 0xC000, 0x3800, 0x7BFF))
+		#expect(Float4(exact) == Float4(1, -2, 0.5, 65504))
+		
+		let outOfRange = Float4(65520, -1e9, .infinity, 1e-8)
+		#expect(Half4(outOfRange).simdValue == SIMD4<UInt16>(0x7C00, 0xFC00, 0x7C00, 0x0000))
+		#expect(Half4(outOfRange, rounding: .towardZero).simdValue == SIMD4<UInt16>(0x7BFF, 0xFBFF, 0x7C00, 0x0000))
+		
+		// Ties round to even; subnormals are kept.
+		let (tieToEven, tieToOdd, smallestSubnormal) = (1 + 0x1p-11 as Float, 1 + 0x3p-11 as Float, 0x1p-24 as Float)
+		#expect(Half4(tieToEven, tieToOdd, smallestSubnormal, 3 * smallestSubnormal).simdValue == SIMD4<UInt16>(0x3C00, 0x3C02, 0x0001, 0x0003))
+		#expect(Half4(Float4(tieToEven, tieToOdd, smallestSubnormal, -0.0), rounding: .towardZero).simdValue == SIMD4<UInt16>(0x3C00, 0x3C01, 0x0001, 0x8000))
+		#expect(Half2(.nan, 0).float2Value.x.isNaN)
+		
+		// 7 elements, to cover both the vectorized loop body & the remainder.
+		let float3s = (Self._float3TestValues + Self._float3SimpleTestValues).prefix(7).map{ Float3(array: $0) }
+		let half3s = [Half3](float3s)
+		#expect(half3s == float3s.map{ Half3($0) })
+		#expect([Float3](half3s) == half3s.map{ Float3($0) })
+		#expect([Half3]([Float3](half3s)) == half3s)
+	}
+	
+	@Test func doublePrecisionRebasing()
+	{
+		// ~10,000 km out, where `Float` only resolves to 1 m.
+		let origin = Double3(1e7, -2e7, 3e7)
+		let offsets = [ Double3(0.125, -0.25, 0.5), Double3(-3.75, 100.5, 0), Double3(0, 0, 0), Double3(1, 2, 3), Double3(-0.5, -0.5, -0.5) ]
+		let points = offsets.map{ origin + $0 }
+		#expect(points.rebased(origin: origin) == offsets.map{ Float3($0) })
+		#expect(points.map{ Float3($0) - Float3(origin) } != offsets.map{ Float3($0) })
+		
+		let packedPoints = [PackedFloat3](unsafeUninitializedCapacity: points.count) { buffer, initializedCount in
+			points.withUnsafeBufferPointer{ $0.rebase(origin: origin, into: buffer) }
+			initializedCount = points.count
+		}
+		#expect(packedPoints.map{ Float3($0) } == offsets.map{ Float3($0) })
+		
+		#expect([Float3](points) == points.map{ Float3($0) })
+		#expect([Double3]([Float3](offsets)) == offsets)
+		
+		// A model matrix placing geometry at `points[1]`, & a view matrix for a camera at `origin`: rebased to the same origin, their product matches the double-precision one.
+		let model = Double4x4(translation: points[1]), view = Double4x4(translation: origin).inversed()
+		let rebasedModel = model.rebased(origin: origin), rebasedView = view.rebasedView(origin: origin)
+		#expect(rebasedModel.c3 == Float4(-3.75, 100.5, 0, 1))
+		#expect(rebasedView == Float4x4.identity)
+		#expect(rebasedView * rebasedModel == Float4x4(view * model))
+		#expect([ model, model ].rebased(origin: origin) == [ rebasedModel, rebasedModel ])
+		
+		#expect(view.transformedPoints([ origin ]) == [ Double3.zero ])
+	}
+	
+	@Test func boundsAndFrustumCulling()
+	{
+		let bounds = AABB3(containing: [ Float3(1, 2, 3), Float3(-1, 5, 0), Float3(4, -2, 1) ])
+		#expect(bounds == AABB3(min: Float3(-1, -2, 0), max: Float3(4, 5, 3)))
+		#expect(bounds.center == Float3(1.5, 1.5, 1.5) && bounds.extents == Float3(2.5, 3.5, 1.5))
+		#expect(AABB3(containing: [Float3]()) == .empty && AABB3.empty.isEmpty && !bounds.isEmpty)
+		#expect(AABB3.empty.merged(with: bounds) == bounds)
+		#expect(AABB3(merging: [ AABB3(center: .zero, extents: Float3(1, 1, 1)), AABB3(center: Float3(10, 0, 0), extents: Float3(1, 1, 1)) ]) == AABB3(min: Float3(-1, -1, -1), max: Float3(11, 1, 1)))
+		
+		// A quarter-turn about z & a translation: the transformed box is exactly the bounds of the transformed corners.
+		let transform = Float4x4(0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 10, 0, 0, 1)
+		let corners = (0..<8).map{ i in
+			Float3((i & 1 == 0) ? bounds.min.x : bounds.max.x, (i & 2 == 0) ? bounds.min.y : bounds.max.y, (i & 4 == 0) ? bounds.min.z : bounds.max.z)
+		}
+		#expect(bounds.transformed(by: transform) == AABB3(containing: transform.transformedPoints(corners)))
+		#expect([ bounds, bounds ].transformed(by: transform) == [ bounds.transformed(by: transform), bounds.transformed(by: transform) ])
+		
+		// A 90°-FOV perspective projection (near 1, far 100) looking down -z, with unit boxes in a row across its view at z = -10.
+		let near:Float = 1, far:Float = 100
+		let projection = Float4x4(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, far / (near - far), -1, 0, 0, near * far / (near - far), 0)
+		let frustum = Frustum(viewProjection: projection)
+		#expect(frustum.contains(Float3(0, 0, -10)) && !frustum.contains(Float3(0, 0, 10)) && !frustum.contains(Float3(0, 0, -200)))
+		let boxes = (0..<11).map{ AABB3(center: Float3(Float($0 - 5) * 4, 0, -10), extents: Float3(1, 1, 1)) }
+		let classifications = frustum.classifications(of: boxes)
+		#expect(classifications == [ .outside, .outside, .intersecting, .inside, .inside, .inside, .inside, .inside, .intersecting, .outside, .outside ])
+		#expect(classifications == boxes.map{ frustum.classify($0) })
+		#expect(frustum.visibilityBits(of: boxes) == [ 0b1111_1100, 0b0000_0001 ])
+		#expect(frustum.visibleIndices(of: boxes) == Array(2...8))
+		#expect(frustum.visibleIndices(of: []) == [])
+		#expect(!frustum.isVisible(AABB3(center: Float3(0, 0, 10), extents: Float3(1, 1, 1))))
+		// Empty boxes (`.empty`, or `min` past `max` on any axis) are outside, not the NaN-centered “inside” their center & extents would otherwise give.
+		let emptyBoxes = [ AABB3.empty, AABB3(min: Float3(1, 0, -10), max: Float3(-1, 1, -9)), boxes[5] ]
+		#expect(frustum.classifications(of: emptyBoxes) == [ .outside, .outside, .inside ])
+		#expect(!frustum.isVisible(.empty) && frustum.classify(.empty) == .outside)
+		#expect(frustum.visibleIndices(of: emptyBoxes) == [ 2 ])
+		#expect(frustum.visibilityBits(of: emptyBoxes) == [ 0b100 ])
+		#expect(Frustum(viewProjection: projection, depthRange: .negativeOneToOne).near != frustum.near)
+	}
+	
+	@Test func boundingVolumeHierarchyQueries()
+	{
+		// A 32×32-quad height-field mesh over x, z ∈ [0, 32], checked against brute force.
+		let gridSize = 32
+		let vertices = (0...gridSize).flatMap{ z in (0...gridSize).map{ x in Float3(Float(x), Float.sin(Float(x) * 0.4) + Float.cos(Float(z) * 0.3), Float(z)) } }
+		let triangleVertexIndices:[UInt32] = (0..<gridSize).flatMap{ z in (0..<gridSize).flatMap{ x -> [UInt32] in
+			let corner = UInt32(z * (gridSize + 1) + x), rowStride = UInt32(gridSize + 1)
+			return [ corner, corner + rowStride, corner + 1, corner + 1, corner + rowStride, corner + rowStride + 1 ]
+		} }
+		let mesh = TriangleBVH(vertices: vertices, triangleVertexIndices: triangleVertexIndices)
+		#expect(mesh.hierarchy.nodes.count < 2 * triangleVertexIndices.count / 3)
+		#expect(mesh.hierarchy.primitiveIndices.sorted() == Array(0..<UInt32(triangleVertexIndices.count / 3)))
+		let serialMesh = TriangleBVH(vertices: vertices, triangleVertexIndices: triangleVertexIndices, isParallel: false)
+		#expect(serialMesh.hierarchy.primitiveIndices == mesh.hierarchy.primitiveIndices)
+		
+		let hit = mesh.intersect(origin: Float3(10.25, 10, 20.5), direction: Float3(0, -1, 0))
+		let groundHeight = Float.sin(10.25 * 0.4) + Float.cos(20.5 * 0.3)
+		#expect(hit != nil && abs(hit!.distance - (10 - groundHeight)) < 0.1)
+		#expect(mesh.intersect(origin: Float3(10.25, 10, 20.5), direction: Float3(0, 1, 0)) == nil)
+		#expect(mesh.intersect(origin: Float3(10.25, 10, 20.5), direction: Float3(0, -1, 0), maxDistance: 1) == nil)
+		#expect(mesh.isOccluded(origin: Float3(-5, 0.5, 16.1), direction: Float3(1, 0, 0)))
+		#expect(!mesh.isOccluded(origin: Float3(-5, 3, 16.1), direction: Float3(1, 0, 0)))
+		
+		let queryBox = AABB3(min: Float3(4.5, -5, 7.5), max: Float3(6.5, 5, 9.5))
+		let expectedTriangles = (0..<UInt32(triangleVertexIndices.count / 3)).filter{ triangleI in
+			AABB3(containing: (0..<3).map{ vertices[Int(triangleVertexIndices[Int(triangleI) * 3 + $0])] }).intersects(queryBox)
+		}
+		#expect(mesh.triangles(overlapping: queryBox).sorted() == expectedTriangles)
+		#expect(mesh.triangles(overlapping: AABB3(min: Float3(-5, -5, -5), max: Float3(-4, -4, -4))) == [])
+		
+		// The nearest point is no farther than the one straight below, & is the distance it's reported at.
+		let nearestQueryPoint = Float3(16.3, 8, 16.7)
+		let nearest = mesh.nearestPoint(to: nearestQueryPoint)
+		let pointBelow = Float3(16.3, 8 - mesh.intersect(origin: nearestQueryPoint, direction: Float3(0, -1, 0))!.distance, 16.7)
+		#expect(nearest != nil && nearest!.distanceSquared <= simd_length_squared((pointBelow - nearestQueryPoint).simdValue))
+		#expect(nearest != nil && abs(simd_length_squared((nearest!.point - nearestQueryPoint).simdValue) - nearest!.distanceSquared) < 1e-3)
+		#expect(mesh.nearestPoint(to: nearestQueryPoint, maxDistance: 1) == nil)
+		
+		// Scattered points (in a deterministic pseudo-random order).
+		let points = (0..<2000).map{ i in Float3(Float((i * 7919) % 1000) * 0.01, Float((i * 104729) % 997) * 0.01, Float((i * 1299709) % 991) * 0.01) }
+		let pointSet = PointBVH(points: points)
+		#expect(pointSet.points(in: queryBox).sorted() == (0..<UInt32(points.count)).filter{ queryBox.contains(points[Int($0)]) })
+		for queryPoint in [ Float3(5, 5, 5), Float3(-3, 12, 0.5), Float3(9.99, 0, 4) ] {
+			let expectedDistanceSquared = points.map{ simd_length_squared(($0 - queryPoint).simdValue) }.min()!
+			#expect(abs(pointSet.nearest(to: queryPoint)!.distanceSquared - expectedDistanceSquared) <= 1e-5 * Swift.max(1, expectedDistanceSquared))
+		}
+		#expect(pointSet.nearest(to: Float3(50, 50, 50), maxDistance: 1) == nil)
+		#expect(PointBVH(points: []).nearest(to: .zero) == nil && PointBVH(points: []).points(in: queryBox) == [])
+	}
+	
+	@Test func rayPacketIntersections()
+	{
+		// A 12×12-quad bumpy grid mesh, with rays angled down through points along each interior quad's edges (grid lines & diagonals), where a non-watertight test can miss both triangles sharing an edge.  (Plain Möller–Trumbore lets ~1% of these through.)
+		let gridSize = 12
+		let vertices = (0...gridSize).flatMap{ z in (0...gridSize).map{ x in Float3(Float(x) * 0.37, Float.sin(Float(x) * 0.9) * Float.cos(Float(z) * 0.7), Float(z) * 0.41) } }
+		let triangleVertexIndices:[UInt32] = (0..<gridSize).flatMap{ z in (0..<gridSize).flatMap{ x -> [UInt32] in
+			let corner = UInt32(z * (gridSize + 1) + x), rowStride = UInt32(gridSize + 1)
+			return [ corner, corner + rowStride, corner + 1, corner + 1, corner + rowStride, corner + rowStride + 1 ]
+		} }
+		let direction = Float3(0.05, -1, 0.03)
+		let rays:[Ray3] = (1..<(gridSize - 1)).flatMap{ z in (1..<(gridSize - 1)).flatMap{ x -> [Ray3] in
+			let cellTriangleIndices = triangleVertexIndices[((z * gridSize + x) * 6)..<((z * gridSize + x) * 6 + 6)].map{ Int($0) }
+			return (0..<6).flatMap{ cornerI -> [Ray3] in
+				let p = vertices[cellTriangleIndices[cornerI]], q = vertices[cellTriangleIndices[(cornerI / 3) * 3 + (cornerI + 1) % 3]]
+				return [ Float(0.25), 0.5, 0.8 ].map{ Ray3(origin: p + (q - p) * $0 - direction * 6, direction: direction) }
+			}
+		} }
+		
+		// Every ray hits the mesh; & the packet kernels' distances match the scalar test's exactly, both ways round.
+		let triangleCount = triangleVertexIndices.count / 3
+		let rayDistances = rays.map{ $0.distances(toTriangles: vertices, triangleVertexIndices: triangleVertexIndices) }
+		#expect(rayDistances.allSatisfy{ $0.contains{ $0 != .infinity } })
+		for rayI in stride(from: 0, to: rays.count, by: 37) {
+			let expectedDistances = (0..<triangleCount).map{ triangleI -> Float in
+				let vertexIndices = (0..<3).map{ Int(triangleVertexIndices[triangleI * 3 + $0]) }
+				return rays[rayI].intersect(triangle: vertices[vertexIndices[0]], vertices[vertexIndices[1]], vertices[vertexIndices[2]])?.distance ?? .infinity
+			}
+			#expect(rayDistances[rayI] == expectedDistances)
+		}
+		for triangleI in stride(from: 0, to: triangleCount, by: 7) {
+			let (a, b, c) = (vertices[Int(triangleVertexIndices[triangleI * 3])], vertices[Int(triangleVertexIndices[triangleI * 3 + 1])], vertices[Int(triangleVertexIndices[triangleI * 3 + 2])])
+			#expect(rays.distances(toTriangle: a, b, c) == rays.map{ $0.intersect(triangle: a, b, c)?.distance ?? .infinity })
+			#expect(rays.distances(toTriangle: a, b, c) == rayDistances.map{ $0[triangleI] })
+		}
+		
+		let hit = Ray3(origin: Float3(0.25, 1, 0.25), direction: Float3(0, -2, 0)).intersect(triangle: Float3(0, 0, 0), Float3(1, 0, 0), Float3(0, 0, 1))
+		#expect(hit != nil && hit!.distance == 0.5 && hit!.u == 0.25 && hit!.v == 0.25)
+		#expect(Ray3(origin: Float3(0.25, 1, 0.25), direction: Float3(0, -2, 0)).intersect(triangle: Float3(0, 0, 0), Float3(1, 0, 0), Float3(0, 0, 1), maxDistance: 0.4) == nil)
+		#expect(Ray3(origin: Float3(0.75, 1, 0.75), direction: Float3(0, -2, 0)).intersect(triangle: Float3(0, 0, 0), Float3(1, 0, 0), Float3(0, 0, 1)) == nil)
+		#expect(Ray3(from: Float3(1, 2, 3), through: Float3(2, 4, 6)).point(at: 2) == Float3(3, 6, 9))
+		
+		// Slab tests: entering, starting inside, lying in a face (included), just past one, & beyond `maxDistance`.
+		let box = AABB3(min: Float3(-1, -1, -1), max: Float3(1, 1, 1))
+		#expect(Ray3(origin: Float3(-3, 0, 0), direction: Float3(1, 0, 0)).intersect(box) == 2)
+		#expect(Ray3(origin: .zero, direction: Float3(0, 0, 1)).intersect(box) == 0)
+		#expect(Ray3(origin: Float3(-3, 1, 0), direction: Float3(1, 0, 0)).intersect(box) == 2)
+		#expect(Ray3(origin: Float3(-3, 1.5, 0), direction: Float3(1, 0, 0)).intersect(box) == nil)
+		#expect(Ray3(origin: Float3(-3, 0, 0), direction: Float3(1, 0, 0)).intersect(box, maxDistance: 1.5) == nil)
+		let cellBoxes = (0..<triangleCount).map{ triangleI in AABB3(containing: (0..<3).map{ vertices[Int(triangleVertexIndices[triangleI * 3 + $0])] }) }
+		#expect(rays[100].distances(to: cellBoxes) == cellBoxes.map{ rays[100].intersect($0) ?? .infinity })
+		#expect(rays.distances(to: cellBoxes[50]) == rays.map{ $0.intersect(cellBoxes[50]) ?? .infinity })
+	}
+	
+	@Test func arrayFileRoundTrip() throws
+	{
+		let directoryURL = FileManager.default.temporaryDirectory.appendingPathComponent("VucktTests-\(UUID().uuidString)")
+		try FileManager.default.createDirectory(at: directoryURL, withIntermediateDirectories: true)
+		defer { try? FileManager.default.removeItem(at: directoryURL) }
+		let path = { (name:String) in directoryURL.appendingPathComponent(name).path }
+		
+		// Streamed through a buffer smaller than some of the appends, so they take both the buffered & the direct paths.
+		let points = (0..<1000).map{ Float3(Float($0), Float($0) * -0.5, Float($0 % 7)) }
+		let writer = try ArrayFileWriter<Float3>(path: path("points"), bufferSize: 256)
+		try writer.append(points[0])
+		try writer.append(contentsOf: Array(points[1..<5]))
+		try writer.append(contentsOf: Array(points[5..<900]))
+		for point in points[900...] {
+			try writer.append(point)
+		}
+		try writer.finish()
+		#expect(writer.count == points.count)
+		
+		let mapped = try MappedArrayFile<Float3>(path: path("points"))
+		#expect(Array(mapped) == points)
+		#expect(mapped.header.typeTag == Float3.arrayFileTypeTag)
+		#expect(mapped.header.count == UInt64(points.count))
+		#expect(Int(bitPattern: mapped.elements.baseAddress) % MemoryLayout<Float3>.alignment == 0)
+		
+		let matrices = (0..<10).map{ Float4x4(diagonal: Float($0)) }
+		try matrices.write(toArrayFile: path("matrices"))
+		#expect(try [Float4x4](contentsOfArrayFile: path("matrices")) == matrices)
+		#expect(throws: ArrayFileError.typeMismatch) { try MappedArrayFile<Float4>(path: path("matrices")) }
+		
+		let matricesData = try Data(contentsOf: URL(fileURLWithPath: path("matrices")))
+		try matricesData.dropLast(1).write(to: URL(fileURLWithPath: path("truncated")))
+		#expect(throws: ArrayFileError.truncated) { try MappedArrayFile<Float4x4>(path: path("truncated")) }
+		try Data(repeating: 0xAB, count: 256).write(to: URL(fileURLWithPath: path("garbage")))
+		#expect(throws: ArrayFileError.notAnArrayFile) { try MappedArrayFile<Float4x4>(path: path("garbage")) }
+		
+		try [Int4]().write(toArrayFile: path("empty"))
+		#expect(try [Int4](contentsOfArrayFile: path("empty")) == [])
+	}
+	
+	@Test func bulkCodecRoundTrip() throws
+	{
+		func roundTrip<Element : BulkCodable & Equatable>(_ values:[Element], deltaFrom previous:[Element]? = nil, isCompacted:Bool) throws -> Int {
+			var bytes = [UInt8](repeating: 0, count: Element.bulkEncodedByteCountLimit(count: values.count, isCompacted: isCompacted))
+			let size = bytes.withUnsafeMutableBytes{ values.bulkEncode(deltaFrom: previous, isCompacted: isCompacted, into: $0) }
+			let decoded = try bytes.withUnsafeBytes{ try [Element](bulkDecoding: UnsafeRawBufferPointer(rebasing: $0[0..<size]), count: values.count, deltaFrom: previous, isCompacted: isCompacted) }
+			#expect(decoded == values)
+			return size
+		}
+		
+		// Canonical: little-endian components, without the padding.
+		var canonicalBytes = [UInt8](repeating: 0, count: 12)
+		_ = canonicalBytes.withUnsafeMutableBytes{ [ Float3(1, 2, 3) ].bulkEncode(into: $0) }
+		#expect(canonicalBytes == [ 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40 ])
+		
+		let points = (0..<1000).map{ Float3(Float($0), Float($0) * -0.5, Float($0 % 7)) }
+		let rotations = (0..<300).map{ FloatQuaternion(angle: Float($0) * 0.01, axis: Float3(0, 1, 0)) }
+		let matrices = (0..<50).map{ Double4x4(translation: Double3(Double($0), 2, -3)) }
+		for isCompacted in [ false, true ] {
+			#expect(try roundTrip(points, isCompacted: isCompacted) <= Float3.bulkEncodedByteCountLimit(count: points.count, isCompacted: isCompacted))
+			_ = try roundTrip(rotations, isCompacted: isCompacted)
+			_ = try roundTrip(points.map{ Half3($0) }, isCompacted: isCompacted)
+			_ = try roundTrip(matrices, isCompacted: isCompacted)
+			_ = try roundTrip([Int4](), isCompacted: isCompacted)
+		}
+		
+		// A delta with 1 in 10 points moved compacts to far less than the points.
+		var movedPoints = points
+		for pointI in stride(from: 0, to: movedPoints.count, by: 10) {
+			movedPoints[pointI] += Float3(0.25, 0.5, 1)
+		}
+		let deltaSize = try roundTrip(movedPoints, deltaFrom: points, isCompacted: true)
+		#expect(deltaSize < Float3.bulkEncodedByteCountLimit(count: points.count) / 4)
+		
+		var deltaBytes = [UInt8](repeating: 0, count: Float3.bulkEncodedByteCountLimit(count: points.count, isCompacted: true))
+		let size = deltaBytes.withUnsafeMutableBytes{ movedPoints.bulkEncode(deltaFrom: points, isCompacted: true, into: $0) }
+		var updatedPoints = points
+		#expect(try deltaBytes.withUnsafeBytes{ try updatedPoints.bulkApplyDelta(from: UnsafeRawBufferPointer(rebasing: $0[0..<size]), isCompacted: true) } == size)
+		#expect(updatedPoints == movedPoints)
+		
+		#expect(throws: BulkCodecError.malformedData) {
+			try deltaBytes.withUnsafeBytes{ try [Float3](bulkDecoding: UnsafeRawBufferPointer(rebasing: $0[0..<(size - 1)]), count: points.count, deltaFrom: points, isCompacted: true) }
+		}
+		#expect(throws: BulkCodecError.malformedData) {
+			try canonicalBytes.withUnsafeBytes{ try [Float3](bulkDecoding: $0, count: 2) }
+		}
+	}
+	
+	@Test func constantPresets()
+	{
+		#expect(Float3.zero == Float3(0, 0, 0))
+		#expect(Float3.one == Float3(1, 1, 1) && Float3.negativeOne == -Float3.one)
+		#expect(Float3.unitX == Float3(1, 0, 0) && Float3.unitYNegative == Float3(0, -1, 0) && Float3.unitZ == Float3(0, 0, 1))
+		#expect(Int4.unitW == Int4(0, 0, 0, 1) && Float2.unitY == Float2(0, 1) && Double4.positiveOne == Double4(1, 1, 1, 1))
+		#expect(Float3x3.identity == Float3x3(diagonal: 1) && Float4x4.identity * Float4(1, 2, 3, 4) == Float4(1, 2, 3, 4))
+		#expect(Float4x3.identity.transformPoint(Float3(1, 2, 3)) == Float3(1, 2, 3))
+		#expect(Double4x4.identity == Double4x4(diagonal: 1) && Float4x4.zero == Float4x4())
+		
+		// √½ as a literal is the same float `Float(0.5).squareRoot()` rounds to.
+		#expect(FloatQuaternion.rotation90AroundX.r == Float(0.5).squareRoot())
+		let rotated = FloatQuaternion.rotation90AroundZ * Float3.unitX
+		#expect(abs(rotated.x) < 1e-6 && abs(rotated.y - 1) < 1e-6)
+		#expect(FloatQuaternion.rotation180AroundY * FloatQuaternion.rotation180AroundY == FloatQuaternion(0, 0, 0, -1))
+		#expect(AABB3.empty.merged(with: Float3.one) == AABB3(min: .one, max: .one))
+	}
+	
+	@Test func easingAndCurves()
+	{
+		// One easing of each kind of formula, against Penner's (in double precision); the array & scalar forms must agree exactly.
+		let ratios:[Float] = (0...20).map{ Float($0) / 20 }
+		let penner:[(Easing, (Double) -> Double)] = [
+			(.quadraticInOut, { $0 < 0.5 ? 2 * $0 * $0 : 1 - pow(2 - 2 * $0, 2) / 2 }),
+			(.sineOut, { sin($0 * .pi / 2) }),
+			(.exponentialIn, { $0 == 0 ? 0 : pow(2, 10 * $0 - 10) }),
+			(.circularOut, { (1 - pow($0 - 1, 2)).squareRoot() }),
+			(.backOut, { 1 + 2.70158 * pow($0 - 1, 3) + 1.70158 * pow($0 - 1, 2) }),
+			(.elasticOut, { $0 == 0 ? 0 : $0 == 1 ? 1 : pow(2, -10 * $0) * sin(($0 * 10 - 0.75) * (2 * .pi / 3)) + 1 }),
+		]
+		for (easing, formula) in penner {
+			for (ratio, easedRatio) in zip(ratios, ratios.eased(by: easing)) {
+				#expect(abs(Double(easedRatio) - formula(Double(ratio))) < 2e-6, "\(easing) at \(ratio)")
+				#expect(easedRatio == easing.eased(ratio))
+			}
+		}
+		// Circular-out stays accurate right next to 0, where `1 - in(1 - t)` would cancel down to a few bits.
+		#expect(abs(Double(Easing.circularOut.eased(1e-6)) - (1e-6 * (2 - 1e-6)).squareRoot()) < 1e-9)
+		for rawValue in Easing.linear.rawValue...Easing.bounceInOut.rawValue {
+			let easing = Easing(rawValue: rawValue)!
+			#expect(easing.eased(0) == 0 && easing.eased(1) == 1, "\(easing)")
+		}
+		
+		// `.hermite` eases between the endpoints (3t² - 2t³) rather than being ignored.
+		#expect(Float3.zero.interpolated(to: .one, ratio: 0.25, method: .hermite) == Float3(scalar: 0.15625))
+		#expect(Float2.zero.interpolated(to: .one, ratio: 0.25, easing: .quadraticIn) == Float2(scalar: 0.0625))
+		
+		let segment = CurveSegment(basis: .bezier, Float2(0, 0), Float2(0, 1), Float2(1, 1), Float2(1, 0))
+		#expect(segment.point(at: 0.5) == Float2(0.5, 0.75))
+		#expect(segment.points(at: [ 0, 1 ]) == [ Float2(0, 0), Float2(1, 0) ])
+		#expect(CurveSegment<Float>.points(basis: .hermite, controlPoints: [ 0, 1, 1, 0, 2, 0, 3, 0 ], at: [ 0.5, 0.5 ]) == [ 0.625, 2.5 ])
+		
+		// A Catmull-Rom track passes through its keyframes, & clamps outside its times.
+		let keyframes = [ Float3(0, 0, 0), Float3(1, 2, 0), Float3(3, 2, 1), Float3(4, 0, 1) ]
+		let track = CurveTrack(basis: .catmullRom, keyframes: keyframes)
+		#expect(track.segmentCount == 3)
+		#expect(track.points(at: [ -1, 0, 1, 2, 3, 9 ]) == [ keyframes[0], keyframes[0], keyframes[1], keyframes[2], keyframes[3], keyframes[3] ])
+		
+		// A straight Bézier track that starts slowly: evenly spaced times bunch up near its start, but evenly spaced distances don't.
+		let line = CurveTrack(basis: .bezier, keyframes: [ Float2(0, 0), Float2(0.1, 0), Float2(0.2, 0), Float2(1, 0) ])
+		#expect(line.point(at: 0.5).x < 0.25)
+		let table = line.arcLengthTable()
+		#expect(abs(table.length - 1) < 1e-5)
+		for (pointI, point) in line.uniformlySpacedPoints(count: 5, table: table).enumerated() {
+			#expect(abs(point.x - Float(pointI) * 0.25) < 1e-4)
+		}
+		#expect(abs(line.point(at: table.time(atDistance: 0.5)).x - 0.5) < 1e-4)
+		
+		// Eased rotations, in bulk & singly.
+		let from = [ FloatQuaternion.identity, .identity ], to = [ FloatQuaternion.rotation90AroundZ, .rotation180AroundY ]
+		let easedRotations = interpolateBetween(from, to, ratios: [ 0.5, 0.25 ], easing: .cubicInOut)
+		for (rotationI, ratio) in [ Float(0.5), 0.25 ].enumerated() {
+			let expected = from[rotationI].interpolated(to: to[rotationI], ratio: ratio, easing: .cubicInOut)
+			#expect(abs(dotProductOf(easedRotations[rotationI], expected)) > 1 - 1e-6)
+		}
+	}
+	
+	@Test func parallelBulkOperations()
+	{
+		// Enough elements for many chunks, plus a ragged last one.
+		let float3s = (0..<100_003).map{ Float3(Float($0 % 97) - 48, Float($0 % 89) * 0.5, 1) }
+		let float4s = float3s.map{ Float4($0.x, $0.y, $0.z, -2) }
+		
+		#expect(float3s.normalizedConcurrently() == float3s.normalized())
+		#expect(float4s.normalizedConcurrently() == float4s.normalized())
+		let transform = Float4x4(scale: Float3(2, 3, 4), rotation: FloatQuaternion(angle: 0.3 * Float.pi, axis: Float3(1, 0.5, 0.25).normalized()), translation: Float3(1, 2, 3))
+		#expect(transform.transformedPointsConcurrently(float3s) == transform.transformedPoints(float3s))
+		
+		// Sums of halves, exact in any order, so the same as the serial sum; & sums that round, exactly repeatable, as the chunks' sums are combined in a fixed order.
+		#expect(float3s.sumConcurrently() == float3s.sum() && float4s.sumConcurrently() == float4s.sum())
+		let roundingFloat3s = float3s.map{ $0 * 0.1 }
+		let sum = roundingFloat3s.sumConcurrently()
+		for _ in 0..<4 {
+			#expect(roundingFloat3s.sumConcurrently() == sum)
+		}
+		#expect([Float3]().sumConcurrently() == Float3() && [Float4]().normalizedConcurrently() == [])
+		
+		// The chunks cover every element once, & (past the first) start on cache lines of the output, wherever it starts.
+		var output = [Float3](repeating: Float3(), count: float3s.count + 3)
+		output.withUnsafeMutableBufferPointer{ outputBuffer in
+			for offset in 0..<4 {
+				let out = UnsafeMutableBufferPointer(rebasing: outputBuffer[offset ..< (offset + float3s.count)])
+				let chunking = ParallelChunking(count: out.count, bytesPerElement: 2 * MemoryLayout<Float3>.stride, output: out)
+				#expect(chunking.chunkCount > 1)
+				var nextStart = 0
+				for chunkI in 0..<chunking.chunkCount {
+					let chunk = chunking.elementRange(ofChunk: chunkI)
+					#expect(chunk.lowerBound == nextStart && !chunk.isEmpty)
+					if chunkI > 0 {
+						#expect(UInt(bitPattern: out.baseAddress! + chunk.lowerBound) % UInt(VUCKT_PARALLEL_CACHE_LINE_SIZE) == 0)
+					}
+					nextStart = chunk.upperBound
+				}
+				#expect(nextStart == out.count)
+			}
+		}
+	}
+	
+	@Test func zeroCopyViews()
+	{
+		let float3s = Self._float3RegularTestValues.map{ Float3(array: $0) }
+		#expect(Array(float3s.components(\.y)) == float3s.map{ $0.y })
+		#expect(float3s.components(\.z).last == float3s.last?.z)
+		let int4s = [ Int4(1, 2, 3, 4), Int4(-5, -6, -7, -8) ]
+		#expect(Array(int4s.components(\.w)) == [ 4, -8 ])
+		
+		// A view keeps its array's storage alive, & is unaffected by later changes to the original.
+		var float4s = Self._float4TestValues.map{ Float4(array: $0) }
+		let xs = float4s.components(\.x)
+		let originalXs = float4s.map{ $0.x }
+		float4s = []
+		#expect(Array(xs) == originalXs)
+		
+		let matrices = (0..<5).map{ Float4x4(scale: Float3(1, 2, 3), rotation: FloatQuaternion(angle: Float($0), axis: Float3(0, 1, 0)), translation: Float3(Float($0), 0, -1)) }
+		#expect(Array(matrices.columns(3)) == matrices.map{ $0.c3 })
+		#expect(Array(matrices.rows(1)) == matrices.map{ $0.r1 })
+		#expect(Array(matrices.rows(3).reversed()) == matrices.reversed().map{ $0.r3 })
+		
+		// Reinterpreting as simd types & back, reading & writing in place.
+		var points = float3s
+		points.withUnsafeSimdBufferPointer{ simdPoints in
+			#expect(simdPoints.map{ Float3($0) } == float3s)
+		}
+		points.withUnsafeMutableSimdBufferPointer{ simdPoints in
+			for pointI in simdPoints.indices {
+				simdPoints[pointI] *= 2
+			}
+		}
+		#expect(points == float3s.map{ $0 * 2 })
+		var simdPoints = float3s.map{ $0.simdValue }
+		simdPoints.withUnsafeMutableFloat3BufferPointer{ $0[0] = Float3(7, 8, 9) }
+		#expect(simdPoints[0] == SIMD3<Float>(7, 8, 9))
+		#expect(matrices.withUnsafeSimdBufferPointer{ $0.map{ Float4x4($0) } } == matrices)
+		#expect(int4s.withUnsafeSimdBufferPointer{ $0.map{ $0 &* 2 } } == [ SIMD4<Int32>(2, 4, 6, 8), SIMD4<Int32>(-10, -12, -14, -16) ])
+		#expect([Float3]().withUnsafeSimdBufferPointer{ $0.isEmpty })
+	}
+	
+	
 	@Test func simpleAngleAxisConstructors()
 	{
 		for (rotationIndex, (angle_rad, axis)) in Self._angleAxisRotationSimpleTestValues.enumerated() {